@@ -0,0 +1,335 @@
+/**
+ * ARM64反汇编器 - 分配器实现（malloc、区域、大页）
+ */
+
+#include "arm64_alloc.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+    #include <stdlib.h>
+    #if defined(_WIN32)
+        #include <malloc.h>
+        #include <windows.h>
+    #else
+        #include <sys/mman.h>
+    #endif
+#endif
+
+static inline uintptr_t align_up(uintptr_t value, size_t align) {
+    return (value + (align - 1)) & ~(uintptr_t)(align - 1);
+}
+
+static inline void stats_alloc(arm64_alloc_stats_t *st, size_t size) {
+    st->allocs++;
+    st->bytes_requested += size;
+    st->bytes_in_use += size;
+    if (st->bytes_in_use > st->peak_bytes) {
+        st->peak_bytes = st->bytes_in_use;
+    }
+}
+
+static inline void stats_system(arm64_alloc_stats_t *st, size_t bytes) {
+    st->system_allocs++;
+    st->system_bytes += bytes;
+    if (st->system_bytes > st->system_peak) {
+        st->system_peak = st->system_bytes;
+    }
+}
+
+static inline void stats_free(arm64_alloc_stats_t *st, size_t size) {
+    st->frees++;
+    st->bytes_in_use -= size;
+}
+
+/* ========== malloc 分配器 ========== */
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+/* malloc 本身保证的对齐 */
+#define MALLOC_ALIGN (sizeof(void *) * 2)
+
+static void *malloc_alloc(void *ctx, size_t size, size_t align) {
+    (void)ctx;
+    if (size == 0) {
+        size = 1;
+    }
+#if defined(_WIN32)
+    return _aligned_malloc(size, align < MALLOC_ALIGN ? MALLOC_ALIGN : align);
+#else
+    if (align <= MALLOC_ALIGN) {
+        return malloc(size);
+    }
+    void *p;
+    return posix_memalign(&p, align, size) == 0 ? p : NULL;
+#endif
+}
+
+static void malloc_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+static const arm64_allocator_t malloc_allocator = { malloc_alloc, malloc_free, NULL };
+
+#define MALLOC_ALLOCATOR (&malloc_allocator)
+
+#else
+
+#define MALLOC_ALLOCATOR NULL
+
+#endif /* ARM64_DISASM_FREESTANDING */
+
+static const arm64_allocator_t *default_allocator = MALLOC_ALLOCATOR;
+
+const arm64_allocator_t *arm64_default_allocator(void) {
+    return default_allocator;
+}
+
+void arm64_set_default_allocator(const arm64_allocator_t *allocator) {
+    default_allocator = allocator ? allocator : MALLOC_ALLOCATOR;
+}
+
+/* ========== 区域分配器 ========== */
+
+struct arm64_arena_block {
+    arm64_arena_block_t *next;
+    size_t size;                // 整个块的大小（含头部）
+};
+
+/* 块头部占一个缓存行，数据区从缓存行边界开始 */
+#define ARENA_HEADER    64
+#define ARENA_ALIGN     64
+
+static arm64_arena_block_t *arena_new_block(arm64_arena_t *arena, size_t size) {
+    arm64_arena_block_t *block = arm64_alloc(arena->backing, size, ARENA_ALIGN);
+    if (!block) {
+        return NULL;
+    }
+    block->size = size;
+    stats_system(&arena->stats, size);
+    return block;
+}
+
+static void *arena_alloc(void *ctx, size_t size, size_t align) {
+    arm64_arena_t *arena = (arm64_arena_t *)ctx;
+    uint8_t *p = (uint8_t *)align_up((uintptr_t)arena->cur, align);
+
+    /* 快速路径：当前块剩余空间足够 */
+    if (arena->cur && p <= arena->end && size <= (size_t)(arena->end - p)) {
+        arena->cur = p + size;
+        stats_alloc(&arena->stats, size);
+        return p;
+    }
+
+    /* 大请求单独成块，挂在当前块之后，当前块继续使用 */
+    size_t need = ARENA_HEADER + size + (align > ARENA_ALIGN ? align : 0);
+    if (size > arena->block_size / 4) {
+        arm64_arena_block_t *block = arena_new_block(arena, need);
+        if (!block) {
+            return NULL;
+        }
+        if (arena->blocks) {
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        } else {
+            block->next = NULL;
+            arena->blocks = block;
+        }
+        stats_alloc(&arena->stats, size);
+        return (void *)align_up((uintptr_t)block + ARENA_HEADER, align);
+    }
+
+    arm64_arena_block_t *block = arena_new_block(arena, arena->block_size);
+    if (!block) {
+        return NULL;
+    }
+    block->next = arena->blocks;
+    arena->blocks = block;
+    p = (uint8_t *)align_up((uintptr_t)block + ARENA_HEADER, align);
+    arena->cur = p + size;
+    arena->end = (uint8_t *)block + block->size;
+    stats_alloc(&arena->stats, size);
+    return p;
+}
+
+/* 单独释放为空操作；释放的恰好是最近一次分配时回退，便于临时缓冲区复用空间 */
+static void arena_free(void *ctx, void *ptr, size_t size) {
+    arm64_arena_t *arena = (arm64_arena_t *)ctx;
+    if ((uint8_t *)ptr + size == arena->cur) {
+        arena->cur = (uint8_t *)ptr;
+    }
+    stats_free(&arena->stats, size);
+}
+
+void arm64_arena_init(arm64_arena_t *arena, size_t block_size, const arm64_allocator_t *backing) {
+    arena->allocator.alloc = arena_alloc;
+    arena->allocator.free = arena_free;
+    arena->allocator.ctx = arena;
+    arena->backing = backing ? backing : arm64_default_allocator();
+    arena->blocks = NULL;
+    arena->cur = NULL;
+    arena->end = NULL;
+    arena->block_size = block_size ? block_size : ARM64_ARENA_DEFAULT_BLOCK;
+    if (arena->block_size < ARENA_HEADER * 2) {
+        arena->block_size = ARENA_HEADER * 2;
+    }
+    arena->stats = (arm64_alloc_stats_t){0};
+}
+
+static void arena_release_blocks(arm64_arena_t *arena, arm64_arena_block_t *keep) {
+    arm64_arena_block_t *block = arena->blocks;
+    while (block) {
+        arm64_arena_block_t *next = block->next;
+        if (block != keep) {
+            arena->stats.system_bytes -= block->size;
+            arm64_free(arena->backing, block, block->size);
+        }
+        block = next;
+    }
+}
+
+void arm64_arena_reset(arm64_arena_t *arena) {
+    /* 保留最早分配的普通块（单独成块的大请求不保留） */
+    arm64_arena_block_t *keep = NULL;
+    for (arm64_arena_block_t *b = arena->blocks; b; b = b->next) {
+        if (b->size == arena->block_size) {
+            keep = b;
+        }
+    }
+    arena_release_blocks(arena, keep);
+    arena->blocks = keep;
+    if (keep) {
+        keep->next = NULL;
+        arena->cur = (uint8_t *)keep + ARENA_HEADER;
+        arena->end = (uint8_t *)keep + keep->size;
+    } else {
+        arena->cur = NULL;
+        arena->end = NULL;
+    }
+    arena->stats.bytes_in_use = 0;
+}
+
+void arm64_arena_destroy(arm64_arena_t *arena) {
+    arena_release_blocks(arena, NULL);
+    arena->blocks = NULL;
+    arena->cur = NULL;
+    arena->end = NULL;
+    arena->stats.bytes_in_use = 0;
+}
+
+/* ========== 大页分配器 ========== */
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#define SMALL_PAGE ((size_t)4096)
+
+/* 映射长度：使用大页时按2MB取整，否则按4KB取整 */
+static size_t mapping_size(const arm64_hugepage_allocator_t *hp, size_t size) {
+    size_t page = hp->mode == ARM64_HUGEPAGE_NONE ? SMALL_PAGE : ARM64_HUGEPAGE_SIZE;
+    return (size + page - 1) & ~(page - 1);
+}
+
+static void *map_pages(arm64_hugepage_allocator_t *hp, size_t len) {
+#if defined(_WIN32)
+    (void)hp;
+    return VirtualAlloc(NULL, len, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    if (hp->mode == ARM64_HUGEPAGE_NONE) {
+        void *p = mmap(NULL, len, prot, flags, -1, 0);
+        return p == MAP_FAILED ? NULL : p;
+    }
+
+#if defined(MAP_HUGETLB)
+    if (hp->mode == ARM64_HUGEPAGE_EXPLICIT) {
+        void *p = mmap(NULL, len, prot, flags | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            return p;
+        }
+        hp->stats.hugepage_fallbacks++;
+    }
+#endif
+
+    /* 透明大页：多映射一个大页的长度，裁掉首尾使起点按2MB对齐 */
+    uint8_t *raw = mmap(NULL, len + ARM64_HUGEPAGE_SIZE, prot, flags, -1, 0);
+    if (raw == MAP_FAILED) {
+        return NULL;
+    }
+    uint8_t *p = (uint8_t *)align_up((uintptr_t)raw, ARM64_HUGEPAGE_SIZE);
+    if (p > raw) {
+        munmap(raw, (size_t)(p - raw));
+    }
+    size_t tail = (size_t)(raw + len + ARM64_HUGEPAGE_SIZE - (p + len));
+    if (tail > 0) {
+        munmap(p + len, tail);
+    }
+#if defined(MADV_HUGEPAGE)
+    madvise(p, len, MADV_HUGEPAGE);
+#endif
+    return p;
+#endif
+}
+
+static void *hugepage_alloc(void *ctx, size_t size, size_t align) {
+    arm64_hugepage_allocator_t *hp = (arm64_hugepage_allocator_t *)ctx;
+    void *p;
+
+    if (size < hp->threshold) {
+        p = malloc_alloc(NULL, size, align);
+        if (p) {
+            stats_system(&hp->stats, size);
+        }
+    } else {
+        size_t len = mapping_size(hp, size);
+        p = map_pages(hp, len);
+        if (p) {
+            stats_system(&hp->stats, len);
+            if (hp->mode != ARM64_HUGEPAGE_NONE) {
+                hp->stats.hugepage_bytes += len;
+            }
+        }
+    }
+    if (p) {
+        stats_alloc(&hp->stats, size);
+    }
+    return p;
+}
+
+static void hugepage_free(void *ctx, void *ptr, size_t size) {
+    arm64_hugepage_allocator_t *hp = (arm64_hugepage_allocator_t *)ctx;
+
+    stats_free(&hp->stats, size);
+    if (size < hp->threshold) {
+        hp->stats.system_bytes -= size;
+        malloc_free(NULL, ptr, size);
+        return;
+    }
+    size_t len = mapping_size(hp, size);
+    hp->stats.system_bytes -= len;
+    if (hp->mode != ARM64_HUGEPAGE_NONE) {
+        hp->stats.hugepage_bytes -= len;
+    }
+#if defined(_WIN32)
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, len);
+#endif
+}
+
+void arm64_hugepage_allocator_init(arm64_hugepage_allocator_t *hp, arm64_hugepage_mode_t mode,
+                                   size_t threshold) {
+    hp->allocator.alloc = hugepage_alloc;
+    hp->allocator.free = hugepage_free;
+    hp->allocator.ctx = hp;
+    hp->mode = mode;
+    hp->threshold = threshold ? threshold : ARM64_HUGEPAGE_THRESHOLD;
+    hp->stats = (arm64_alloc_stats_t){0};
+}
+
+#endif /* ARM64_DISASM_FREESTANDING */
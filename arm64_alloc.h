@@ -0,0 +1,142 @@
+/**
+ * ARM64反汇编器 - 分配器接口
+ * 库中需要分配内存的子系统（Capstone 兼容接口、执行轨迹缓存）都通过 arm64_allocator_t 分配，
+ * 调用者可以替换为自己的实现。提供三种实现：
+ * - 默认分配器：malloc/free（独立环境中不提供，默认分配器为空）
+ * - 区域分配器：从大块中顺序切分，单独释放为空操作，整体重置或销毁（按映像/会话批量释放）
+ * - 大页分配器：大数组直接映射匿名内存并使用透明大页或显式大页（hugetlbfs），减少 TLB 未命中
+ *   （独立环境中不提供）
+ *
+ * 释放时必须传入分配时的大小，实现可以据此区分来源、解除映射而无需额外的头部
+ */
+
+#ifndef ARM64_ALLOC_H
+#define ARM64_ALLOC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========== 接口 ========== */
+
+/* 分配统计（各实现自行维护，不保证线程安全） */
+typedef struct {
+    uint64_t allocs;            // 分配次数
+    uint64_t frees;             // 释放次数（区域分配器中为空操作的次数）
+    uint64_t bytes_requested;   // 累计请求的字节数
+    uint64_t bytes_in_use;      // 当前未释放的请求字节数
+    uint64_t peak_bytes;        // bytes_in_use 的峰值
+    uint64_t system_allocs;     // 向下层（malloc/mmap/后备分配器）申请的次数
+    uint64_t system_bytes;      // 当前从下层占用的字节数
+    uint64_t system_peak;       // system_bytes 的峰值
+    uint64_t hugepage_bytes;    // system_bytes 中由大页映射的部分
+    uint64_t hugepage_fallbacks; // 显式大页不可用、退回透明大页的次数
+} arm64_alloc_stats_t;
+
+/**
+ * 分配器
+ * alloc: 分配 size 字节，按 align（2的幂）对齐；失败返回 NULL
+ * free:  释放 alloc 的结果，size 必须与分配时相同；ptr 为 NULL 时为空操作
+ */
+typedef struct arm64_allocator {
+    void *(*alloc)(void *ctx, size_t size, size_t align);
+    void (*free)(void *ctx, void *ptr, size_t size);
+    void *ctx;
+} arm64_allocator_t;
+
+/**
+ * 当前默认分配器（未设置时为 malloc 分配器；独立环境中未设置时为 NULL）
+ */
+const arm64_allocator_t *arm64_default_allocator(void);
+
+/**
+ * 设置默认分配器，NULL 恢复为 malloc 分配器
+ * 只影响之后创建的对象；应在启动时、创建其他线程之前调用
+ */
+void arm64_set_default_allocator(const arm64_allocator_t *allocator);
+
+static inline void *arm64_alloc(const arm64_allocator_t *a, size_t size, size_t align) {
+    return a ? a->alloc(a->ctx, size, align) : NULL;
+}
+
+static inline void arm64_free(const arm64_allocator_t *a, void *ptr, size_t size) {
+    if (a && ptr) {
+        a->free(a->ctx, ptr, size);
+    }
+}
+
+/* ========== 区域分配器 ========== */
+
+/* 默认块大小 */
+#define ARM64_ARENA_DEFAULT_BLOCK   (256u * 1024)
+
+typedef struct arm64_arena_block arm64_arena_block_t;
+
+typedef struct {
+    arm64_allocator_t allocator;        // 指向本区域的分配器接口，交给其他子系统使用
+    const arm64_allocator_t *backing;   // 块的来源
+    arm64_arena_block_t *blocks;        // 块链表（最新的在前）
+    uint8_t *cur;                       // 当前块中的空闲位置
+    uint8_t *end;
+    size_t block_size;
+    arm64_alloc_stats_t stats;
+} arm64_arena_t;
+
+/**
+ * 初始化区域分配器（不立即分配）
+ * @param block_size 块大小，0 使用 ARM64_ARENA_DEFAULT_BLOCK；当前块放不下且超过块大小1/4的请求单独成块
+ * @param backing 块的来源，NULL 使用默认分配器；与大页分配器组合可让整个区域使用大页
+ */
+void arm64_arena_init(arm64_arena_t *arena, size_t block_size, const arm64_allocator_t *backing);
+
+/**
+ * 释放全部分配，保留第一个块供复用（处理下一个映像前调用）
+ */
+void arm64_arena_reset(arm64_arena_t *arena);
+
+/**
+ * 释放全部块
+ */
+void arm64_arena_destroy(arm64_arena_t *arena);
+
+/* ========== 大页分配器 ========== */
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+typedef enum {
+    ARM64_HUGEPAGE_NONE = 0,        // 不使用大页（普通匿名映射）
+    ARM64_HUGEPAGE_TRANSPARENT,     // 2MB 对齐映射 + madvise(MADV_HUGEPAGE)
+    ARM64_HUGEPAGE_EXPLICIT,        // MAP_HUGETLB（需预留大页），失败时退回透明大页
+} arm64_hugepage_mode_t;
+
+/* 大页大小与默认阈值 */
+#define ARM64_HUGEPAGE_SIZE         ((size_t)2 * 1024 * 1024)
+#define ARM64_HUGEPAGE_THRESHOLD    ((size_t)1024 * 1024)
+
+typedef struct {
+    arm64_allocator_t allocator;        // 指向本分配器的接口
+    arm64_hugepage_mode_t mode;
+    size_t threshold;                   // 小于此大小的请求交给 malloc
+    arm64_alloc_stats_t stats;
+} arm64_hugepage_allocator_t;
+
+/**
+ * 初始化大页分配器
+ * 不少于 threshold 字节的请求按2MB取整后直接映射，较小的请求交给 malloc 分配器
+ * 非 Linux 系统不支持大页，映射时忽略 mode
+ * @param threshold 0 使用 ARM64_HUGEPAGE_THRESHOLD
+ */
+void arm64_hugepage_allocator_init(arm64_hugepage_allocator_t *hp, arm64_hugepage_mode_t mode,
+                                   size_t threshold);
+
+#endif /* ARM64_DISASM_FREESTANDING */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_ALLOC_H */
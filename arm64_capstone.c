@@ -0,0 +1,731 @@
+/**
+ * ARM64反汇编器 - Capstone 兼容接口
+ * 把 Capstone 的 AArch64 接口映射到 disassemble_arm64/format_instruction
+ */
+
+#include "arm64_capstone.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#include <stdlib.h>
+#include <string.h>
+
+/* ========== 句柄 ========== */
+
+typedef struct {
+    cs_mode mode;
+    bool detail;
+    bool skipdata;
+    cs_err errnum;
+    const arm64_allocator_t *allocator;
+} cs_handle_t;
+
+#define HANDLE(h) ((cs_handle_t *)(uintptr_t)(h))
+
+/* ========== 内存 ========== */
+
+/* CS_OPT_MEM 设置的内存函数，包装为分配器接口 */
+static cs_opt_mem user_mem;
+
+static void *user_mem_alloc(void *ctx, size_t size, size_t align) {
+    (void)ctx;
+    (void)align;
+    return user_mem.malloc(size);
+}
+
+static void user_mem_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    user_mem.free(ptr);
+}
+
+static const arm64_allocator_t user_allocator = { user_mem_alloc, user_mem_free, NULL };
+
+static const arm64_allocator_t *shim_allocator(void) {
+    return user_mem.malloc ? &user_allocator : arm64_default_allocator();
+}
+
+/*
+ * cs_free 不带句柄，每块内存在头部记录来源分配器和大小
+ * 头部占16字节，保持返回地址的16字节对齐
+ */
+typedef struct {
+    const arm64_allocator_t *allocator;
+    size_t size;
+} mem_header_t;
+
+#define MEM_HEADER 16
+
+static void *mem_alloc(const arm64_allocator_t *allocator, size_t size) {
+    mem_header_t *h = arm64_alloc(allocator, MEM_HEADER + size, MEM_HEADER);
+    if (!h) {
+        return NULL;
+    }
+    h->allocator = allocator;
+    h->size = MEM_HEADER + size;
+    return (uint8_t *)h + MEM_HEADER;
+}
+
+static void mem_free(void *ptr) {
+    if (ptr) {
+        mem_header_t *h = (mem_header_t *)((uint8_t *)ptr - MEM_HEADER);
+        arm64_free(h->allocator, h, h->size);
+    }
+}
+
+unsigned int cs_version(int *major, int *minor) {
+    if (major) {
+        *major = CS_API_MAJOR;
+    }
+    if (minor) {
+        *minor = CS_API_MINOR;
+    }
+    return (CS_API_MAJOR << 8) + CS_API_MINOR;
+}
+
+bool cs_support(int query) {
+    return query == CS_ARCH_ARM64;
+}
+
+cs_err cs_open(cs_arch arch, cs_mode mode, csh *handle) {
+    if (!handle) {
+        return CS_ERR_CSH;
+    }
+    *handle = 0;
+    if (arch != CS_ARCH_ARM64) {
+        return CS_ERR_ARCH;
+    }
+    if (mode & ~CS_MODE_BIG_ENDIAN) {
+        return CS_ERR_MODE;
+    }
+
+    const arm64_allocator_t *allocator = shim_allocator();
+    cs_handle_t *h = mem_alloc(allocator, sizeof(*h));
+    if (!h) {
+        return CS_ERR_MEM;
+    }
+    memset(h, 0, sizeof(*h));
+    h->mode = mode;
+    h->allocator = allocator;
+    *handle = (csh)(uintptr_t)h;
+    return CS_ERR_OK;
+}
+
+cs_err cs_close(csh *handle) {
+    if (!handle || !*handle) {
+        return CS_ERR_HANDLE;
+    }
+    mem_free(HANDLE(*handle));
+    *handle = 0;
+    return CS_ERR_OK;
+}
+
+cs_err cs_option(csh handle, cs_opt_type type, size_t value) {
+    /* 全局选项，不需要句柄 */
+    if (type == CS_OPT_MEM) {
+        const cs_opt_mem *mem = (const cs_opt_mem *)(uintptr_t)value;
+        if (!mem || !mem->malloc || !mem->free) {
+            return CS_ERR_OPTION;
+        }
+        user_mem = *mem;
+        return CS_ERR_OK;
+    }
+
+    cs_handle_t *h = HANDLE(handle);
+    if (!h) {
+        return CS_ERR_HANDLE;
+    }
+
+    switch (type) {
+        case CS_OPT_DETAIL:
+            h->detail = (value == CS_OPT_ON);
+            return CS_ERR_OK;
+        case CS_OPT_SKIPDATA:
+            h->skipdata = (value == CS_OPT_ON);
+            return CS_ERR_OK;
+        case CS_OPT_MODE:
+            if (value & ~(size_t)CS_MODE_BIG_ENDIAN) {
+                return h->errnum = CS_ERR_MODE;
+            }
+            h->mode = (cs_mode)value;
+            return CS_ERR_OK;
+        default:
+            return h->errnum = CS_ERR_OPTION;
+    }
+}
+
+cs_err cs_errno(csh handle) {
+    cs_handle_t *h = HANDLE(handle);
+    return h ? h->errnum : CS_ERR_CSH;
+}
+
+const char *cs_strerror(cs_err code) {
+    switch (code) {
+        case CS_ERR_OK:     return "OK (CS_ERR_OK)";
+        case CS_ERR_MEM:    return "Out of memory (CS_ERR_MEM)";
+        case CS_ERR_ARCH:   return "Invalid/unsupported architecture (CS_ERR_ARCH)";
+        case CS_ERR_HANDLE: return "Invalid handle (CS_ERR_HANDLE)";
+        case CS_ERR_CSH:    return "Invalid csh (CS_ERR_CSH)";
+        case CS_ERR_MODE:   return "Invalid mode (CS_ERR_MODE)";
+        case CS_ERR_OPTION: return "Invalid option (CS_ERR_OPTION)";
+        case CS_ERR_DETAIL: return "Details are unavailable (CS_ERR_DETAIL)";
+        default:            return "Unknown error code";
+    }
+}
+
+/* ========== 寄存器映射 ========== */
+
+/* 本库的寄存器编号和类型转换为 arm64_reg */
+static arm64_reg map_reg(uint8_t num, uint8_t type, bool is_64bit) {
+    num &= 31;
+    switch ((reg_type_t)type) {
+        case REG_TYPE_X:   return num == 31 ? ARM64_REG_XZR : (arm64_reg)(ARM64_REG_X0 + num);
+        case REG_TYPE_W:   return num == 31 ? ARM64_REG_WZR : (arm64_reg)(ARM64_REG_W0 + num);
+        case REG_TYPE_SP:  return is_64bit ? ARM64_REG_SP : ARM64_REG_WSP;
+        case REG_TYPE_XZR: return ARM64_REG_XZR;
+        case REG_TYPE_WZR: return ARM64_REG_WZR;
+        case REG_TYPE_B:   return (arm64_reg)(ARM64_REG_B0 + num);
+        case REG_TYPE_H:   return (arm64_reg)(ARM64_REG_H0 + num);
+        case REG_TYPE_S:   return (arm64_reg)(ARM64_REG_S0 + num);
+        case REG_TYPE_D:   return (arm64_reg)(ARM64_REG_D0 + num);
+        case REG_TYPE_Q:   return (arm64_reg)(ARM64_REG_Q0 + num);
+        case REG_TYPE_V:   return (arm64_reg)(ARM64_REG_V0 + num);
+        default:           return ARM64_REG_INVALID;
+    }
+}
+
+/* 寄存器名称按类别前缀和编号拼出，存放在静态表中 */
+static char reg_name_table[ARM64_REG_ENDING][6];
+
+static void fill_reg_names(arm64_reg first, int count, char prefix) {
+    for (int i = 0; i < count; i++) {
+        char *p = reg_name_table[first + i];
+        *p++ = prefix;
+        if (i >= 10) {
+            *p++ = (char)('0' + i / 10);
+        }
+        *p++ = (char)('0' + i % 10);
+        *p = '\0';
+    }
+}
+
+static void init_reg_names(void) {
+    if (reg_name_table[ARM64_REG_X0][0]) {
+        return;
+    }
+    fill_reg_names(ARM64_REG_X0, 31, 'x');
+    fill_reg_names(ARM64_REG_W0, 31, 'w');
+    fill_reg_names(ARM64_REG_B0, 32, 'b');
+    fill_reg_names(ARM64_REG_H0, 32, 'h');
+    fill_reg_names(ARM64_REG_S0, 32, 's');
+    fill_reg_names(ARM64_REG_D0, 32, 'd');
+    fill_reg_names(ARM64_REG_Q0, 32, 'q');
+    fill_reg_names(ARM64_REG_V0, 32, 'v');
+    memcpy(reg_name_table[ARM64_REG_SP], "sp", 3);
+    memcpy(reg_name_table[ARM64_REG_XZR], "xzr", 4);
+    memcpy(reg_name_table[ARM64_REG_WSP], "wsp", 4);
+    memcpy(reg_name_table[ARM64_REG_WZR], "wzr", 4);
+    memcpy(reg_name_table[ARM64_REG_NZCV], "nzcv", 5);
+}
+
+const char *cs_reg_name(csh handle, unsigned int reg_id) {
+    (void)handle;
+    if (reg_id == ARM64_REG_INVALID || reg_id >= ARM64_REG_ENDING) {
+        return NULL;
+    }
+    init_reg_names();
+    return reg_name_table[reg_id];
+}
+
+const char *cs_insn_name(csh handle, unsigned int insn_id) {
+    (void)handle;
+    if (insn_id == ARM64_INS_INVALID || insn_id >= ARM64_INS_ENDING) {
+        return NULL;
+    }
+    return get_inst_type_name((inst_type_t)insn_id);
+}
+
+const char *cs_group_name(csh handle, unsigned int group_id) {
+    (void)handle;
+    switch (group_id) {
+        case ARM64_GRP_JUMP:            return "jump";
+        case ARM64_GRP_CALL:            return "call";
+        case ARM64_GRP_RET:             return "return";
+        case ARM64_GRP_INT:             return "int";
+        case ARM64_GRP_PRIVILEGE:       return "privilege";
+        case ARM64_GRP_BRANCH_RELATIVE: return "branch_relative";
+        case ARM64_GRP_FPARMV8:         return "fparmv8";
+        default:                        return NULL;
+    }
+}
+
+/* ========== 细节填写 ========== */
+
+static const arm64_shifter shift_map[] = {
+    [EXTEND_LSL] = ARM64_SFT_LSL,
+    [EXTEND_LSR] = ARM64_SFT_LSR,
+    [EXTEND_ASR] = ARM64_SFT_ASR,
+    [EXTEND_ROR] = ARM64_SFT_ROR,
+};
+
+/* 把移位/扩展（extend_t 和移位量）设置到 Capstone 操作数上 */
+static void apply_shift(cs_arm64_op *op, uint8_t type, uint8_t amount) {
+    if (type <= EXTEND_SXTX) {
+        op->ext = (arm64_extender)(ARM64_EXT_UXTB + type);
+        if (amount) {
+            op->shift.type = ARM64_SFT_LSL;
+            op->shift.value = amount;
+        }
+    } else if (type <= EXTEND_ROR) {
+        op->shift.type = shift_map[type];
+        op->shift.value = amount;
+    }
+}
+
+static cs_arm64_op *new_op(cs_arm64 *arm64, arm64_op_type type, uint8_t access) {
+    if (arm64->op_count >= sizeof(arm64->operands) / sizeof(arm64->operands[0])) {
+        return NULL;
+    }
+    cs_arm64_op *op = &arm64->operands[arm64->op_count++];
+    memset(op, 0, sizeof(*op));
+    op->vector_index = -1;
+    op->type = type;
+    op->access = access;
+    return op;
+}
+
+static void add_group(cs_detail *detail, uint8_t group) {
+    if (detail->groups_count < sizeof(detail->groups)) {
+        detail->groups[detail->groups_count++] = group;
+    }
+}
+
+/* 由解码结果填写 cs_detail */
+static void fill_detail(const disasm_inst_t *inst, cs_detail *detail) {
+    cs_arm64 *arm64 = &detail->arm64;
+    cs_arm64_op *last = NULL;
+
+    detail->regs_read_count = 0;
+    detail->regs_write_count = 0;
+    detail->groups_count = 0;
+    arm64->cc = ARM64_CC_INVALID;
+    arm64->writeback = false;
+    arm64->op_count = 0;
+
+    for (uint8_t i = 0; i < inst->operand_count; i++) {
+        const disasm_operand_t *src = &inst->operands[i];
+        cs_arm64_op *op;
+
+        switch (src->kind) {
+            case OPERAND_REG:
+                op = new_op(arm64, ARM64_OP_REG, src->access);
+                if (op) {
+                    op->reg = map_reg(src->reg.num, src->reg.type, src->width != 32);
+                }
+                last = op;
+                break;
+
+            case OPERAND_IMM:
+                last = op = new_op(arm64, ARM64_OP_IMM, src->access);
+                if (op) {
+                    op->imm = src->imm;
+                }
+                break;
+
+            case OPERAND_MEM:
+                /* 字面量寻址：Capstone 给出目标地址立即数 */
+                if (src->mem.mode == ADDR_MODE_LITERAL) {
+                    last = op = new_op(arm64, ARM64_OP_IMM, CS_AC_READ);
+                    if (op) {
+                        op->imm = src->mem.disp;
+                    }
+                    break;
+                }
+                last = op = new_op(arm64, ARM64_OP_MEM, src->access);
+                if (!op) {
+                    break;
+                }
+                op->mem.base = map_reg(src->mem.base, src->mem.base_type, true);
+                op->mem.index = src->mem.has_index
+                    ? map_reg(src->mem.index, src->mem.index_type, true) : ARM64_REG_INVALID;
+                if (src->mem.has_index) {
+                    apply_shift(op, src->mem.extend, src->mem.shift);
+                }
+                arm64->writeback |= src->mem.writeback;
+                /* 后索引：偏移量作为单独的立即数操作数 */
+                if (src->mem.mode == ADDR_MODE_POST_INDEX) {
+                    cs_arm64_op *imm = new_op(arm64, ARM64_OP_IMM, CS_AC_READ);
+                    if (imm) {
+                        imm->imm = src->mem.disp;
+                    }
+                } else {
+                    op->mem.disp = (int32_t)src->mem.disp;
+                }
+                break;
+
+            case OPERAND_SHIFT:
+                if (last) {
+                    apply_shift(last, src->shift.type, src->shift.amount);
+                }
+                break;
+
+            case OPERAND_COND:
+                arm64->cc = (arm64_cc)(ARM64_CC_EQ + src->cond);
+                break;
+
+            case OPERAND_SYSREG:
+                last = op = new_op(arm64, ARM64_OP_REG_MRS, src->access);
+                if (op) {
+                    op->reg = (arm64_reg)src->sysreg;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (inst->type == INST_TYPE_BCOND) {
+        arm64->cc = (arm64_cc)(ARM64_CC_EQ + (inst->cond & 0xF));
+    }
+
+    /* 隐式寄存器和分组 */
+    uint32_t props = get_inst_props(inst);
+    arm64->update_flags = (props & INST_PROP_SETS_FLAGS) != 0;
+    if (props & INST_PROP_READS_FLAGS) {
+        detail->regs_read[detail->regs_read_count++] = ARM64_REG_NZCV;
+    }
+    if (props & INST_PROP_SETS_FLAGS) {
+        detail->regs_write[detail->regs_write_count++] = ARM64_REG_NZCV;
+    }
+    if (props & INST_PROP_CALL) {
+        detail->regs_write[detail->regs_write_count++] = ARM64_REG_LR;
+        add_group(detail, ARM64_GRP_CALL);
+    } else if (props & INST_PROP_RETURN) {
+        add_group(detail, ARM64_GRP_RET);
+    } else if (props & INST_PROP_BRANCH) {
+        add_group(detail, ARM64_GRP_JUMP);
+    }
+    if ((props & INST_PROP_BRANCH) && !(props & INST_PROP_INDIRECT)) {
+        add_group(detail, ARM64_GRP_BRANCH_RELATIVE);
+    }
+    if (props & INST_PROP_EXCEPTION) {
+        add_group(detail, ARM64_GRP_INT);
+    }
+    if (props & INST_PROP_PRIVILEGED) {
+        add_group(detail, ARM64_GRP_PRIVILEGE);
+    }
+    if (props & INST_PROP_FP_SIMD) {
+        add_group(detail, ARM64_GRP_FPARMV8);
+    }
+}
+
+/* ========== 反汇编 ========== */
+
+static uint32_t read_word(const cs_handle_t *h, const uint8_t *code) {
+    if (h->mode & CS_MODE_BIG_ENDIAN) {
+        return (uint32_t)code[0] << 24 | (uint32_t)code[1] << 16 |
+               (uint32_t)code[2] << 8 | code[3];
+    }
+    return (uint32_t)code[3] << 24 | (uint32_t)code[2] << 16 |
+           (uint32_t)code[1] << 8 | code[0];
+}
+
+/* 输出 .byte 数据（CS_OPT_SKIPDATA） */
+static void fill_skipdata(const uint8_t *code, uint64_t address, cs_insn *insn) {
+    static const char hex[] = "0123456789abcdef";
+    char *p = insn->op_str;
+
+    insn->id = ARM64_INS_INVALID;
+    insn->address = address;
+    insn->size = 4;
+    memcpy(insn->bytes, code, 4);
+    memcpy(insn->mnemonic, ".byte", 6);
+    for (int i = 0; i < 4; i++) {
+        if (i) {
+            *p++ = ',';
+            *p++ = ' ';
+        }
+        *p++ = '0';
+        *p++ = 'x';
+        *p++ = hex[code[i] >> 4];
+        *p++ = hex[code[i] & 0xF];
+    }
+    *p = '\0';
+    if (insn->detail) {
+        memset(insn->detail, 0, sizeof(*insn->detail));
+    }
+}
+
+/**
+ * 解码一条指令并填写 insn（code 至少4字节）
+ * @return 是否产生了一条指令（解码成功或按 SKIPDATA 输出数据）
+ */
+static bool decode_one(const cs_handle_t *h, const uint8_t *code, uint64_t address,
+                       cs_insn *insn, cs_detail *detail) {
+    disasm_inst_t inst;
+    insn->detail = detail;
+
+    if (!disassemble_arm64(read_word(h, code), address, &inst)) {
+        if (!h->skipdata) {
+            return false;
+        }
+        fill_skipdata(code, address, insn);
+        return true;
+    }
+
+    insn->id = (inst.type == INST_TYPE_BCOND) ? ARM64_INS_B : (unsigned int)inst.type;
+    insn->address = address;
+    insn->size = 4;
+    memcpy(insn->bytes, code, 4);
+    memcpy(insn->mnemonic, inst.mnemonic, sizeof(inst.mnemonic));
+    format_instruction_operands(&inst, insn->op_str, sizeof(insn->op_str));
+    if (detail) {
+        fill_detail(&inst, detail);
+    }
+    return true;
+}
+
+/* 复制到较小的新块；分配失败时保留原块 */
+static void *shrink(cs_handle_t *h, void *ptr, size_t size) {
+    void *p = mem_alloc(h->allocator, size);
+    if (!p) {
+        return ptr;
+    }
+    memcpy(p, ptr, size);
+    mem_free(ptr);
+    return p;
+}
+
+size_t cs_disasm(csh handle, const uint8_t *code, size_t code_size,
+                 uint64_t address, size_t count, cs_insn **insn) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h) {
+        return 0;
+    }
+    if (!insn) {
+        h->errnum = CS_ERR_OK;
+        return 0;
+    }
+    *insn = NULL;
+
+    size_t total = code_size / 4;
+    if (count == 0 || count > total) {
+        count = total;
+    }
+    if (count == 0) {
+        h->errnum = CS_ERR_OK;
+        return 0;
+    }
+
+    /* 按上限一次分配，实际数量不到一半时返回前收缩 */
+    cs_insn *insns = mem_alloc(h->allocator, count * sizeof(cs_insn));
+    cs_detail *details = h->detail ? mem_alloc(h->allocator, count * sizeof(cs_detail)) : NULL;
+    if (!insns || (h->detail && !details)) {
+        mem_free(insns);
+        mem_free(details);
+        h->errnum = CS_ERR_MEM;
+        return 0;
+    }
+
+    size_t n = 0;
+    while (n < count &&
+           decode_one(h, code + n * 4, address + n * 4, &insns[n], details ? &details[n] : NULL)) {
+        n++;
+    }
+
+    h->errnum = CS_ERR_OK;
+    if (n == 0) {
+        mem_free(insns);
+        mem_free(details);
+        return 0;
+    }
+    if (n < count / 2) {
+        insns = shrink(h, insns, n * sizeof(cs_insn));
+        if (details) {
+            details = shrink(h, details, n * sizeof(cs_detail));
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        insns[i].detail = details ? &details[i] : NULL;
+    }
+    *insn = insns;
+    return n;
+}
+
+/* cs_disasm 的细节数组整体分配，首条指令的 detail 指向数组起点 */
+void cs_free(cs_insn *insn, size_t count) {
+    if (!insn) {
+        return;
+    }
+    if (count > 0) {
+        mem_free(insn[0].detail);
+    }
+    mem_free(insn);
+}
+
+cs_insn *cs_malloc(csh handle) {
+    cs_handle_t *h = HANDLE(handle);
+    const arm64_allocator_t *allocator = h ? h->allocator : shim_allocator();
+    cs_insn *insn = mem_alloc(allocator, sizeof(cs_insn));
+    cs_detail *detail = mem_alloc(allocator, sizeof(cs_detail));
+    if (!insn || !detail) {
+        mem_free(insn);
+        mem_free(detail);
+        if (h) {
+            h->errnum = CS_ERR_MEM;
+        }
+        return NULL;
+    }
+    memset(insn, 0, sizeof(*insn));
+    insn->detail = detail;
+    return insn;
+}
+
+bool cs_disasm_iter(csh handle, const uint8_t **code, size_t *size,
+                    uint64_t *address, cs_insn *insn) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h || !insn || *size < 4) {
+        return false;
+    }
+
+    /* detail 由 cs_malloc 预先分配；关闭 CS_OPT_DETAIL 时不填写 */
+    cs_detail *detail = insn->detail;
+    if (!decode_one(h, *code, *address, insn, h->detail ? detail : NULL)) {
+        insn->detail = detail;
+        return false;
+    }
+    insn->detail = detail;
+
+    *code += 4;
+    *size -= 4;
+    *address += 4;
+    return true;
+}
+
+/* ========== 细节查询 ========== */
+
+bool cs_insn_group(csh handle, const cs_insn *insn, unsigned int group_id) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h || !insn || !insn->detail || !h->detail) {
+        if (h) {
+            h->errnum = CS_ERR_DETAIL;
+        }
+        return false;
+    }
+    return memchr(insn->detail->groups, (int)group_id, insn->detail->groups_count) != NULL;
+}
+
+static bool reg_in(const uint16_t *regs, uint8_t count, unsigned int reg_id) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (regs[i] == reg_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool cs_reg_read(csh handle, const cs_insn *insn, unsigned int reg_id) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h || !insn || !insn->detail || !h->detail) {
+        if (h) {
+            h->errnum = CS_ERR_DETAIL;
+        }
+        return false;
+    }
+    return reg_in(insn->detail->regs_read, insn->detail->regs_read_count, reg_id);
+}
+
+bool cs_reg_write(csh handle, const cs_insn *insn, unsigned int reg_id) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h || !insn || !insn->detail || !h->detail) {
+        if (h) {
+            h->errnum = CS_ERR_DETAIL;
+        }
+        return false;
+    }
+    return reg_in(insn->detail->regs_write, insn->detail->regs_write_count, reg_id);
+}
+
+int cs_op_count(csh handle, const cs_insn *insn, unsigned int op_type) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h || !insn || !insn->detail || !h->detail) {
+        if (h) {
+            h->errnum = CS_ERR_DETAIL;
+        }
+        return -1;
+    }
+    int n = 0;
+    for (uint8_t i = 0; i < insn->detail->arm64.op_count; i++) {
+        n += (insn->detail->arm64.operands[i].type == op_type);
+    }
+    return n;
+}
+
+int cs_op_index(csh handle, const cs_insn *insn, unsigned int op_type, unsigned int position) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h || !insn || !insn->detail || !h->detail) {
+        if (h) {
+            h->errnum = CS_ERR_DETAIL;
+        }
+        return -1;
+    }
+    unsigned int seen = 0;
+    for (uint8_t i = 0; i < insn->detail->arm64.op_count; i++) {
+        if (insn->detail->arm64.operands[i].type == op_type && ++seen == position) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void add_reg_unique(uint16_t *regs, uint8_t *count, uint16_t reg) {
+    if (reg != ARM64_REG_INVALID && !reg_in(regs, *count, reg) && *count < 64) {
+        regs[(*count)++] = reg;
+    }
+}
+
+cs_err cs_regs_access(csh handle, const cs_insn *insn,
+                      uint16_t regs_read[64], uint8_t *regs_read_count,
+                      uint16_t regs_write[64], uint8_t *regs_write_count) {
+    cs_handle_t *h = HANDLE(handle);
+    if (!h) {
+        return CS_ERR_CSH;
+    }
+    if (!insn || !insn->detail || !h->detail) {
+        return h->errnum = CS_ERR_DETAIL;
+    }
+
+    const cs_detail *detail = insn->detail;
+    uint8_t nr = 0, nw = 0;
+
+    for (uint8_t i = 0; i < detail->regs_read_count; i++) {
+        add_reg_unique(regs_read, &nr, detail->regs_read[i]);
+    }
+    for (uint8_t i = 0; i < detail->regs_write_count; i++) {
+        add_reg_unique(regs_write, &nw, detail->regs_write[i]);
+    }
+    for (uint8_t i = 0; i < detail->arm64.op_count; i++) {
+        const cs_arm64_op *op = &detail->arm64.operands[i];
+        if (op->type == ARM64_OP_REG) {
+            if (op->access & CS_AC_READ) {
+                add_reg_unique(regs_read, &nr, (uint16_t)op->reg);
+            }
+            if (op->access & CS_AC_WRITE) {
+                add_reg_unique(regs_write, &nw, (uint16_t)op->reg);
+            }
+        } else if (op->type == ARM64_OP_MEM) {
+            add_reg_unique(regs_read, &nr, (uint16_t)op->mem.base);
+            add_reg_unique(regs_read, &nr, (uint16_t)op->mem.index);
+            if (detail->arm64.writeback) {
+                add_reg_unique(regs_write, &nw, (uint16_t)op->mem.base);
+            }
+        }
+    }
+
+    *regs_read_count = nr;
+    *regs_write_count = nw;
+    return CS_ERR_OK;
+}
+
+#endif /* ARM64_DISASM_FREESTANDING */
@@ -0,0 +1,441 @@
+/**
+ * ARM64反汇编器 - Capstone 兼容接口
+ * 提供 cs_open/cs_disasm/cs_disasm_iter/cs_free 等 Capstone AArch64 接口的子集，
+ * 内部使用 disassemble_arm64/format_instruction，现有调用者只需改为包含本头文件并重新编译
+ *
+ * 与 Capstone 的差异：
+ * - 只支持 CS_ARCH_ARM64；枚举值与 Capstone 不同（源码兼容，二进制不兼容）
+ * - 指令 ID 按本库的指令类型划分（如 ldur 归入 ARM64_INS_LDR，b.cond 为 ARM64_INS_B）
+ * - op_str 使用本库的格式化输出（x29/x30 显示为 fp/lr）
+ * - 只支持 CS_OPT_DETAIL、CS_OPT_MODE、CS_OPT_SKIPDATA、CS_OPT_MEM 选项
+ * 内存通过 arm64_alloc.h 的分配器分配：句柄在 cs_open 时取得默认分配器（或 CS_OPT_MEM 设置的函数），
+ * 之后 cs_disasm/cs_malloc 的结果都来自该分配器；独立环境（ARM64_DISASM_FREESTANDING）中不提供
+ */
+
+#ifndef ARM64_CAPSTONE_H
+#define ARM64_CAPSTONE_H
+
+#include "arm64_disasm.h"
+#include "arm64_alloc.h"
+#include <stdarg.h>
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CS_API_MAJOR 5
+#define CS_API_MINOR 0
+
+/* ========== 基本类型 ========== */
+
+typedef size_t csh;
+
+typedef enum cs_arch {
+    CS_ARCH_ARM64 = 1,
+} cs_arch;
+
+typedef enum cs_mode {
+    CS_MODE_LITTLE_ENDIAN = 0,
+    CS_MODE_ARM = 0,
+    CS_MODE_BIG_ENDIAN = 1u << 31,
+} cs_mode;
+
+typedef enum cs_opt_type {
+    CS_OPT_INVALID = 0,
+    CS_OPT_SYNTAX,
+    CS_OPT_DETAIL,
+    CS_OPT_MODE,
+    CS_OPT_MEM,
+    CS_OPT_SKIPDATA,
+} cs_opt_type;
+
+typedef enum cs_opt_value {
+    CS_OPT_OFF = 0,
+    CS_OPT_ON = 3,
+} cs_opt_value;
+
+typedef enum cs_err {
+    CS_ERR_OK = 0,
+    CS_ERR_MEM,         // 内存不足
+    CS_ERR_ARCH,        // 不支持的架构
+    CS_ERR_HANDLE,      // 无效句柄
+    CS_ERR_CSH,         // cs_open 的句柄参数无效
+    CS_ERR_MODE,        // 不支持的模式
+    CS_ERR_OPTION,      // 不支持的选项
+    CS_ERR_DETAIL,      // 未打开 CS_OPT_DETAIL 时访问细节
+} cs_err;
+
+/* 访问方式（与 OPERAND_ACCESS_* 相同） */
+#define CS_AC_INVALID   0
+#define CS_AC_READ      OPERAND_ACCESS_READ
+#define CS_AC_WRITE     OPERAND_ACCESS_WRITE
+
+/* ========== AArch64 寄存器 ========== */
+
+typedef enum arm64_reg {
+    ARM64_REG_INVALID = 0,
+
+    /* 64位通用寄存器 */
+    ARM64_REG_X0, ARM64_REG_X1, ARM64_REG_X2, ARM64_REG_X3, ARM64_REG_X4, ARM64_REG_X5, ARM64_REG_X6, ARM64_REG_X7,
+    ARM64_REG_X8, ARM64_REG_X9, ARM64_REG_X10, ARM64_REG_X11, ARM64_REG_X12, ARM64_REG_X13, ARM64_REG_X14, ARM64_REG_X15,
+    ARM64_REG_X16, ARM64_REG_X17, ARM64_REG_X18, ARM64_REG_X19, ARM64_REG_X20, ARM64_REG_X21, ARM64_REG_X22, ARM64_REG_X23,
+    ARM64_REG_X24, ARM64_REG_X25, ARM64_REG_X26, ARM64_REG_X27, ARM64_REG_X28, ARM64_REG_X29, ARM64_REG_X30,
+    ARM64_REG_SP,
+    ARM64_REG_XZR,
+
+    /* 32位通用寄存器 */
+    ARM64_REG_W0, ARM64_REG_W1, ARM64_REG_W2, ARM64_REG_W3, ARM64_REG_W4, ARM64_REG_W5, ARM64_REG_W6, ARM64_REG_W7,
+    ARM64_REG_W8, ARM64_REG_W9, ARM64_REG_W10, ARM64_REG_W11, ARM64_REG_W12, ARM64_REG_W13, ARM64_REG_W14, ARM64_REG_W15,
+    ARM64_REG_W16, ARM64_REG_W17, ARM64_REG_W18, ARM64_REG_W19, ARM64_REG_W20, ARM64_REG_W21, ARM64_REG_W22, ARM64_REG_W23,
+    ARM64_REG_W24, ARM64_REG_W25, ARM64_REG_W26, ARM64_REG_W27, ARM64_REG_W28, ARM64_REG_W29, ARM64_REG_W30,
+    ARM64_REG_WSP,
+    ARM64_REG_WZR,
+
+    /* 标志寄存器 */
+    ARM64_REG_NZCV,
+
+    /* 8位 SIMD/FP寄存器 */
+    ARM64_REG_B0, ARM64_REG_B1, ARM64_REG_B2, ARM64_REG_B3, ARM64_REG_B4, ARM64_REG_B5, ARM64_REG_B6, ARM64_REG_B7,
+    ARM64_REG_B8, ARM64_REG_B9, ARM64_REG_B10, ARM64_REG_B11, ARM64_REG_B12, ARM64_REG_B13, ARM64_REG_B14, ARM64_REG_B15,
+    ARM64_REG_B16, ARM64_REG_B17, ARM64_REG_B18, ARM64_REG_B19, ARM64_REG_B20, ARM64_REG_B21, ARM64_REG_B22, ARM64_REG_B23,
+    ARM64_REG_B24, ARM64_REG_B25, ARM64_REG_B26, ARM64_REG_B27, ARM64_REG_B28, ARM64_REG_B29, ARM64_REG_B30, ARM64_REG_B31,
+
+    /* 16位 SIMD/FP寄存器 */
+    ARM64_REG_H0, ARM64_REG_H1, ARM64_REG_H2, ARM64_REG_H3, ARM64_REG_H4, ARM64_REG_H5, ARM64_REG_H6, ARM64_REG_H7,
+    ARM64_REG_H8, ARM64_REG_H9, ARM64_REG_H10, ARM64_REG_H11, ARM64_REG_H12, ARM64_REG_H13, ARM64_REG_H14, ARM64_REG_H15,
+    ARM64_REG_H16, ARM64_REG_H17, ARM64_REG_H18, ARM64_REG_H19, ARM64_REG_H20, ARM64_REG_H21, ARM64_REG_H22, ARM64_REG_H23,
+    ARM64_REG_H24, ARM64_REG_H25, ARM64_REG_H26, ARM64_REG_H27, ARM64_REG_H28, ARM64_REG_H29, ARM64_REG_H30, ARM64_REG_H31,
+
+    /* 32位 SIMD/FP寄存器 */
+    ARM64_REG_S0, ARM64_REG_S1, ARM64_REG_S2, ARM64_REG_S3, ARM64_REG_S4, ARM64_REG_S5, ARM64_REG_S6, ARM64_REG_S7,
+    ARM64_REG_S8, ARM64_REG_S9, ARM64_REG_S10, ARM64_REG_S11, ARM64_REG_S12, ARM64_REG_S13, ARM64_REG_S14, ARM64_REG_S15,
+    ARM64_REG_S16, ARM64_REG_S17, ARM64_REG_S18, ARM64_REG_S19, ARM64_REG_S20, ARM64_REG_S21, ARM64_REG_S22, ARM64_REG_S23,
+    ARM64_REG_S24, ARM64_REG_S25, ARM64_REG_S26, ARM64_REG_S27, ARM64_REG_S28, ARM64_REG_S29, ARM64_REG_S30, ARM64_REG_S31,
+
+    /* 64位 SIMD/FP寄存器 */
+    ARM64_REG_D0, ARM64_REG_D1, ARM64_REG_D2, ARM64_REG_D3, ARM64_REG_D4, ARM64_REG_D5, ARM64_REG_D6, ARM64_REG_D7,
+    ARM64_REG_D8, ARM64_REG_D9, ARM64_REG_D10, ARM64_REG_D11, ARM64_REG_D12, ARM64_REG_D13, ARM64_REG_D14, ARM64_REG_D15,
+    ARM64_REG_D16, ARM64_REG_D17, ARM64_REG_D18, ARM64_REG_D19, ARM64_REG_D20, ARM64_REG_D21, ARM64_REG_D22, ARM64_REG_D23,
+    ARM64_REG_D24, ARM64_REG_D25, ARM64_REG_D26, ARM64_REG_D27, ARM64_REG_D28, ARM64_REG_D29, ARM64_REG_D30, ARM64_REG_D31,
+
+    /* 128位 SIMD/FP寄存器 */
+    ARM64_REG_Q0, ARM64_REG_Q1, ARM64_REG_Q2, ARM64_REG_Q3, ARM64_REG_Q4, ARM64_REG_Q5, ARM64_REG_Q6, ARM64_REG_Q7,
+    ARM64_REG_Q8, ARM64_REG_Q9, ARM64_REG_Q10, ARM64_REG_Q11, ARM64_REG_Q12, ARM64_REG_Q13, ARM64_REG_Q14, ARM64_REG_Q15,
+    ARM64_REG_Q16, ARM64_REG_Q17, ARM64_REG_Q18, ARM64_REG_Q19, ARM64_REG_Q20, ARM64_REG_Q21, ARM64_REG_Q22, ARM64_REG_Q23,
+    ARM64_REG_Q24, ARM64_REG_Q25, ARM64_REG_Q26, ARM64_REG_Q27, ARM64_REG_Q28, ARM64_REG_Q29, ARM64_REG_Q30, ARM64_REG_Q31,
+
+    /* 向量 SIMD/FP寄存器 */
+    ARM64_REG_V0, ARM64_REG_V1, ARM64_REG_V2, ARM64_REG_V3, ARM64_REG_V4, ARM64_REG_V5, ARM64_REG_V6, ARM64_REG_V7,
+    ARM64_REG_V8, ARM64_REG_V9, ARM64_REG_V10, ARM64_REG_V11, ARM64_REG_V12, ARM64_REG_V13, ARM64_REG_V14, ARM64_REG_V15,
+    ARM64_REG_V16, ARM64_REG_V17, ARM64_REG_V18, ARM64_REG_V19, ARM64_REG_V20, ARM64_REG_V21, ARM64_REG_V22, ARM64_REG_V23,
+    ARM64_REG_V24, ARM64_REG_V25, ARM64_REG_V26, ARM64_REG_V27, ARM64_REG_V28, ARM64_REG_V29, ARM64_REG_V30, ARM64_REG_V31,
+
+    ARM64_REG_ENDING,
+
+    /* 别名 */
+    ARM64_REG_IP0 = ARM64_REG_X16,
+    ARM64_REG_IP1 = ARM64_REG_X17,
+    ARM64_REG_FP = ARM64_REG_X29,
+    ARM64_REG_LR = ARM64_REG_X30,
+} arm64_reg;
+
+/* ========== AArch64 指令 ID（与 inst_type_t 数值相同） ========== */
+
+typedef enum arm64_insn {
+    ARM64_INS_INVALID = INST_TYPE_UNKNOWN,
+    ARM64_INS_LDR = INST_TYPE_LDR,
+    ARM64_INS_LDRB = INST_TYPE_LDRB,
+    ARM64_INS_LDRH = INST_TYPE_LDRH,
+    ARM64_INS_LDRSW = INST_TYPE_LDRSW,
+    ARM64_INS_LDRSB = INST_TYPE_LDRSB,
+    ARM64_INS_LDRSH = INST_TYPE_LDRSH,
+    ARM64_INS_STR = INST_TYPE_STR,
+    ARM64_INS_STRB = INST_TYPE_STRB,
+    ARM64_INS_STRH = INST_TYPE_STRH,
+    ARM64_INS_STP = INST_TYPE_STP,
+    ARM64_INS_LDP = INST_TYPE_LDP,
+    ARM64_INS_MOV = INST_TYPE_MOV,
+    ARM64_INS_MOVZ = INST_TYPE_MOVZ,
+    ARM64_INS_MOVN = INST_TYPE_MOVN,
+    ARM64_INS_MOVK = INST_TYPE_MOVK,
+    ARM64_INS_ADD = INST_TYPE_ADD,
+    ARM64_INS_SUB = INST_TYPE_SUB,
+    ARM64_INS_ADDS = INST_TYPE_ADDS,
+    ARM64_INS_SUBS = INST_TYPE_SUBS,
+    ARM64_INS_ADR = INST_TYPE_ADR,
+    ARM64_INS_ADRP = INST_TYPE_ADRP,
+    ARM64_INS_B = INST_TYPE_B,
+    ARM64_INS_BL = INST_TYPE_BL,
+    ARM64_INS_BR = INST_TYPE_BR,
+    ARM64_INS_BLR = INST_TYPE_BLR,
+    ARM64_INS_RET = INST_TYPE_RET,
+    ARM64_INS_CBZ = INST_TYPE_CBZ,
+    ARM64_INS_CBNZ = INST_TYPE_CBNZ,
+    ARM64_INS_TBZ = INST_TYPE_TBZ,
+    ARM64_INS_TBNZ = INST_TYPE_TBNZ,
+    ARM64_INS_AND = INST_TYPE_AND,
+    ARM64_INS_ORR = INST_TYPE_ORR,
+    ARM64_INS_EOR = INST_TYPE_EOR,
+    ARM64_INS_LSL = INST_TYPE_LSL,
+    ARM64_INS_LSR = INST_TYPE_LSR,
+    ARM64_INS_ASR = INST_TYPE_ASR,
+    ARM64_INS_ROR = INST_TYPE_ROR,
+    ARM64_INS_CMP = INST_TYPE_CMP,
+    ARM64_INS_CMN = INST_TYPE_CMN,
+    ARM64_INS_TST = INST_TYPE_TST,
+    ARM64_INS_MUL = INST_TYPE_MUL,
+    ARM64_INS_MADD = INST_TYPE_MADD,
+    ARM64_INS_MSUB = INST_TYPE_MSUB,
+    ARM64_INS_SDIV = INST_TYPE_SDIV,
+    ARM64_INS_UDIV = INST_TYPE_UDIV,
+    ARM64_INS_SMULL = INST_TYPE_SMULL,
+    ARM64_INS_UMULL = INST_TYPE_UMULL,
+    ARM64_INS_CSEL = INST_TYPE_CSEL,
+    ARM64_INS_CSINC = INST_TYPE_CSINC,
+    ARM64_INS_CSINV = INST_TYPE_CSINV,
+    ARM64_INS_CSNEG = INST_TYPE_CSNEG,
+    ARM64_INS_CSET = INST_TYPE_CSET,
+    ARM64_INS_CSETM = INST_TYPE_CSETM,
+    ARM64_INS_CINC = INST_TYPE_CINC,
+    ARM64_INS_CINV = INST_TYPE_CINV,
+    ARM64_INS_CNEG = INST_TYPE_CNEG,
+    ARM64_INS_CLZ = INST_TYPE_CLZ,
+    ARM64_INS_CLS = INST_TYPE_CLS,
+    ARM64_INS_RBIT = INST_TYPE_RBIT,
+    ARM64_INS_REV = INST_TYPE_REV,
+    ARM64_INS_REV16 = INST_TYPE_REV16,
+    ARM64_INS_REV32 = INST_TYPE_REV32,
+    ARM64_INS_EXTR = INST_TYPE_EXTR,
+    ARM64_INS_LDXR = INST_TYPE_LDXR,
+    ARM64_INS_STXR = INST_TYPE_STXR,
+    ARM64_INS_LDAXR = INST_TYPE_LDAXR,
+    ARM64_INS_STLXR = INST_TYPE_STLXR,
+    ARM64_INS_LDAR = INST_TYPE_LDAR,
+    ARM64_INS_STLR = INST_TYPE_STLR,
+    ARM64_INS_LDADD = INST_TYPE_LDADD,
+    ARM64_INS_LDCLR = INST_TYPE_LDCLR,
+    ARM64_INS_LDEOR = INST_TYPE_LDEOR,
+    ARM64_INS_LDSET = INST_TYPE_LDSET,
+    ARM64_INS_LDSMAX = INST_TYPE_LDSMAX,
+    ARM64_INS_LDSMIN = INST_TYPE_LDSMIN,
+    ARM64_INS_LDUMAX = INST_TYPE_LDUMAX,
+    ARM64_INS_LDUMIN = INST_TYPE_LDUMIN,
+    ARM64_INS_SWP = INST_TYPE_SWP,
+    ARM64_INS_CAS = INST_TYPE_CAS,
+    ARM64_INS_NOP = INST_TYPE_NOP,
+    ARM64_INS_MRS = INST_TYPE_MRS,
+    ARM64_INS_MSR = INST_TYPE_MSR,
+    ARM64_INS_DMB = INST_TYPE_DMB,
+    ARM64_INS_DSB = INST_TYPE_DSB,
+    ARM64_INS_ISB = INST_TYPE_ISB,
+    ARM64_INS_SVC = INST_TYPE_SVC,
+    ARM64_INS_HVC = INST_TYPE_HVC,
+    ARM64_INS_SMC = INST_TYPE_SMC,
+    ARM64_INS_FMOV = INST_TYPE_FMOV,
+    ARM64_INS_FADD = INST_TYPE_FADD,
+    ARM64_INS_FSUB = INST_TYPE_FSUB,
+    ARM64_INS_FMUL = INST_TYPE_FMUL,
+    ARM64_INS_FDIV = INST_TYPE_FDIV,
+    ARM64_INS_FABS = INST_TYPE_FABS,
+    ARM64_INS_FNEG = INST_TYPE_FNEG,
+    ARM64_INS_FSQRT = INST_TYPE_FSQRT,
+    ARM64_INS_FMADD = INST_TYPE_FMADD,
+    ARM64_INS_FMSUB = INST_TYPE_FMSUB,
+    ARM64_INS_FNMADD = INST_TYPE_FNMADD,
+    ARM64_INS_FNMSUB = INST_TYPE_FNMSUB,
+    ARM64_INS_FCMP = INST_TYPE_FCMP,
+    ARM64_INS_FCMPE = INST_TYPE_FCMPE,
+    ARM64_INS_FCCMP = INST_TYPE_FCCMP,
+    ARM64_INS_FCSEL = INST_TYPE_FCSEL,
+    ARM64_INS_FCVT = INST_TYPE_FCVT,
+    ARM64_INS_FCVTZS = INST_TYPE_FCVTZS,
+    ARM64_INS_FCVTZU = INST_TYPE_FCVTZU,
+    ARM64_INS_SCVTF = INST_TYPE_SCVTF,
+    ARM64_INS_UCVTF = INST_TYPE_UCVTF,
+    ARM64_INS_FRINT = INST_TYPE_FRINT,
+    ARM64_INS_FMAX = INST_TYPE_FMAX,
+    ARM64_INS_FMIN = INST_TYPE_FMIN,
+    ARM64_INS_PRFM = INST_TYPE_PRFM,
+    ARM64_INS_ENDING = INST_TYPE_COUNT,
+} arm64_insn;
+
+/* ========== 指令分组 ========== */
+
+typedef enum arm64_insn_group {
+    ARM64_GRP_INVALID = 0,
+    ARM64_GRP_JUMP = 1,             // 跳转（不含调用和返回）
+    ARM64_GRP_CALL = 2,             // 调用
+    ARM64_GRP_RET = 3,              // 返回
+    ARM64_GRP_INT = 4,              // 产生异常（SVC/HVC/SMC）
+    ARM64_GRP_PRIVILEGE = 6,        // 特权指令
+    ARM64_GRP_BRANCH_RELATIVE = 7,  // PC相对直接分支
+    ARM64_GRP_FPARMV8 = 129,        // 浮点/SIMD
+    ARM64_GRP_ENDING,
+} arm64_insn_group;
+
+/* ========== AArch64 操作数 ========== */
+
+typedef enum arm64_cc {
+    ARM64_CC_INVALID = 0,
+    ARM64_CC_EQ, ARM64_CC_NE, ARM64_CC_HS, ARM64_CC_LO,
+    ARM64_CC_MI, ARM64_CC_PL, ARM64_CC_VS, ARM64_CC_VC,
+    ARM64_CC_HI, ARM64_CC_LS, ARM64_CC_GE, ARM64_CC_LT,
+    ARM64_CC_GT, ARM64_CC_LE, ARM64_CC_AL, ARM64_CC_NV,
+} arm64_cc;
+
+typedef enum arm64_shifter {
+    ARM64_SFT_INVALID = 0,
+    ARM64_SFT_LSL,
+    ARM64_SFT_MSL,
+    ARM64_SFT_LSR,
+    ARM64_SFT_ASR,
+    ARM64_SFT_ROR,
+} arm64_shifter;
+
+typedef enum arm64_extender {
+    ARM64_EXT_INVALID = 0,
+    ARM64_EXT_UXTB, ARM64_EXT_UXTH, ARM64_EXT_UXTW, ARM64_EXT_UXTX,
+    ARM64_EXT_SXTB, ARM64_EXT_SXTH, ARM64_EXT_SXTW, ARM64_EXT_SXTX,
+} arm64_extender;
+
+typedef enum arm64_op_type {
+    ARM64_OP_INVALID = 0,
+    ARM64_OP_REG,       // 寄存器
+    ARM64_OP_IMM,       // 立即数（PC相对目标为绝对地址）
+    ARM64_OP_MEM,       // 内存访问
+    ARM64_OP_FP,        // 浮点立即数
+    ARM64_OP_CIMM = 64,
+    ARM64_OP_REG_MRS,   // MRS 的系统寄存器（reg 为指令位[20:5]的编码）
+    ARM64_OP_REG_MSR,
+} arm64_op_type;
+
+typedef struct arm64_op_mem {
+    arm64_reg base;
+    arm64_reg index;
+    int32_t disp;
+} arm64_op_mem;
+
+typedef struct cs_arm64_op {
+    int vector_index;               // 向量元素下标，-1 表示无
+    int vas;                        // 向量排列（未使用，始终为0）
+    struct {
+        arm64_shifter type;
+        unsigned int value;
+    } shift;
+    arm64_extender ext;
+    arm64_op_type type;
+    union {
+        arm64_reg reg;              // ARM64_OP_REG
+        int64_t imm;                // ARM64_OP_IMM
+        double fp;                  // ARM64_OP_FP
+        arm64_op_mem mem;           // ARM64_OP_MEM
+    };
+    uint8_t access;                 // CS_AC_* 组合
+} cs_arm64_op;
+
+typedef struct cs_arm64 {
+    arm64_cc cc;                    // 条件码
+    bool update_flags;              // 是否更新 NZCV
+    bool writeback;                 // 是否回写基址寄存器
+    uint8_t op_count;
+    cs_arm64_op operands[8];
+} cs_arm64;
+
+/* ========== 指令 ========== */
+
+/* 指令细节（打开 CS_OPT_DETAIL 时有效）：regs_read/regs_write 只含隐式寄存器 */
+typedef struct cs_detail {
+    uint16_t regs_read[16];
+    uint8_t regs_read_count;
+    uint16_t regs_write[20];
+    uint8_t regs_write_count;
+    uint8_t groups[8];
+    uint8_t groups_count;
+    union {
+        cs_arm64 arm64;
+    };
+} cs_detail;
+
+typedef struct cs_insn {
+    unsigned int id;                // arm64_insn
+    uint64_t address;
+    uint16_t size;
+    uint8_t bytes[24];
+    char mnemonic[32];
+    char op_str[160];
+    cs_detail *detail;              // 未打开 CS_OPT_DETAIL 时 cs_disasm 返回的指令中为 NULL
+} cs_insn;
+
+/* CS_OPT_MEM：cs_option(0, CS_OPT_MEM, (size_t)&mem) 替换全局内存函数（在 cs_open 之前调用） */
+typedef void *(*cs_malloc_t)(size_t size);
+typedef void *(*cs_calloc_t)(size_t nmemb, size_t size);
+typedef void *(*cs_realloc_t)(void *ptr, size_t size);
+typedef void (*cs_free_t)(void *ptr);
+typedef int (*cs_vsnprintf_t)(char *str, size_t size, const char *format, va_list ap);
+
+typedef struct cs_opt_mem {
+    cs_malloc_t malloc;
+    cs_calloc_t calloc;             // 未使用
+    cs_realloc_t realloc;           // 未使用
+    cs_free_t free;
+    cs_vsnprintf_t vsnprintf;       // 未使用（格式化不经过 vsnprintf）
+} cs_opt_mem;
+
+/* ========== 接口 ========== */
+
+unsigned int cs_version(int *major, int *minor);
+bool cs_support(int query);
+
+cs_err cs_open(cs_arch arch, cs_mode mode, csh *handle);
+cs_err cs_close(csh *handle);
+cs_err cs_option(csh handle, cs_opt_type type, size_t value);
+cs_err cs_errno(csh handle);
+const char *cs_strerror(cs_err code);
+
+/**
+ * 反汇编最多 count 条指令（0 表示全部），结果数组由 cs_free 释放
+ * 遇到无法解码的指令时停止（打开 CS_OPT_SKIPDATA 时跳过4字节并输出 .byte）
+ * @return 反汇编的指令数，0 表示失败（cs_errno 给出原因）
+ */
+size_t cs_disasm(csh handle, const uint8_t *code, size_t code_size,
+                 uint64_t address, size_t count, cs_insn **insn);
+void cs_free(cs_insn *insn, size_t count);
+
+/**
+ * 为 cs_disasm_iter 分配一条指令（含细节），由 cs_free(insn, 1) 释放
+ */
+cs_insn *cs_malloc(csh handle);
+
+/**
+ * 反汇编一条指令并前移 code/size/address，不分配内存
+ * @return 成功时为 true；剩余不足4字节或无法解码时为 false
+ */
+bool cs_disasm_iter(csh handle, const uint8_t **code, size_t *size,
+                    uint64_t *address, cs_insn *insn);
+
+const char *cs_reg_name(csh handle, unsigned int reg_id);
+const char *cs_insn_name(csh handle, unsigned int insn_id);
+const char *cs_group_name(csh handle, unsigned int group_id);
+
+bool cs_insn_group(csh handle, const cs_insn *insn, unsigned int group_id);
+bool cs_reg_read(csh handle, const cs_insn *insn, unsigned int reg_id);
+bool cs_reg_write(csh handle, const cs_insn *insn, unsigned int reg_id);
+int cs_op_count(csh handle, const cs_insn *insn, unsigned int op_type);
+int cs_op_index(csh handle, const cs_insn *insn, unsigned int op_type, unsigned int position);
+
+/**
+ * 列出指令读写的全部寄存器（显式操作数 + 隐式寄存器）
+ */
+cs_err cs_regs_access(csh handle, const cs_insn *insn,
+                      uint16_t regs_read[64], uint8_t *regs_read_count,
+                      uint16_t regs_write[64], uint8_t *regs_write_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_DISASM_FREESTANDING */
+
+#endif /* ARM64_CAPSTONE_H */
@@ -7,34 +7,83 @@
 #define ARM64_DECODE_TABLE_H
 
 #include "arm64_disasm.h"
+#include "arm64_strbuf.h"
 
 /* 解码器函数类型 */
 typedef bool (*decode_func_t)(uint32_t inst, uint64_t addr, disasm_inst_t *result);
 
-/* 解码表条目 */
-typedef struct {
-    uint32_t mask;          /* 掩码：用于提取关键位 */
-    uint32_t value;         /* 期望值：与掩码后的结果比较 */
-    decode_func_t decoder;  /* 解码函数 */
-    const char *name;       /* 调试用：指令类别名称 */
-} decode_entry_t;
+/*
+ * 解码表：匹配时逐条扫描的 mask/value（热数据）与命中后才访问的解码函数、名称、
+ * 扩展（冷数据）分别存放在并行数组中，扫描只读连续的 mask/value
+ */
+#define DECODE_TABLE_MAX    32      /* 按目标配置解码的条目掩码为32位 */
 
-/* 解码表组（用于分层解码） */
 typedef struct {
-    const decode_entry_t *entries;
+    const uint32_t *mask;           /* 掩码：用于提取关键位 */
+    const uint32_t *value;          /* 期望值：与掩码后的结果比较 */
+    const decode_func_t *decoders;  /* 解码函数 */
+    const char *const *names;       /* 调试用：指令类别名称 */
+    const uint8_t *exts;            /* 解码器只产生该扩展的指令时为该扩展，否则为 ARM64_EXT_BASE */
     size_t count;
-    const char *group_name;
-} decode_group_t;
+} decode_table_t;
+
+/*
+ * 定义解码表：ENTRIES 是形如
+ *     #define XXX_DECODE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT) \
+ *         DECODE_ENTRY(mask, value, fn) \
+ *         DECODE_ENTRY_NAMED(mask, value, fn, "name") \
+ *         DECODE_ENTRY_EXT(mask, value, fn, ARM64_EXT_xxx)
+ * 的条目列表，按顺序展开为 mask/value/解码函数/名称/扩展五个并行数组
+ */
+#define DECODE_MASK_(m, v, fn)              (m),
+#define DECODE_MASK_NAMED_(m, v, fn, n)     (m),
+#define DECODE_MASK_EXT_(m, v, fn, e)       (m),
+#define DECODE_VALUE_(m, v, fn)             (v),
+#define DECODE_VALUE_NAMED_(m, v, fn, n)    (v),
+#define DECODE_VALUE_EXT_(m, v, fn, e)      (v),
+#define DECODE_FUNC_(m, v, fn)              fn,
+#define DECODE_FUNC_NAMED_(m, v, fn, n)     fn,
+#define DECODE_FUNC_EXT_(m, v, fn, e)       fn,
+#define DECODE_NAME_(m, v, fn)              #fn,
+#define DECODE_NAME_NAMED_(m, v, fn, n)     n,
+#define DECODE_NAME_EXT_(m, v, fn, e)       #fn,
+#define DECODE_EXT_(m, v, fn)               ARM64_EXT_BASE,
+#define DECODE_EXT_NAMED_(m, v, fn, n)      ARM64_EXT_BASE,
+#define DECODE_EXT_EXT_(m, v, fn, e)        (e),
 
-/* 便捷宏：定义解码表条目 */
-#define DECODE_ENTRY(m, v, fn) { (m), (v), (fn), #fn }
-#define DECODE_ENTRY_NAMED(m, v, fn, n) { (m), (v), (fn), (n) }
+#define DEFINE_DECODE_TABLE(table, ENTRIES)                                             \
+    static const uint32_t table##_mask[] = {                                            \
+        ENTRIES(DECODE_MASK_, DECODE_MASK_NAMED_, DECODE_MASK_EXT_)                     \
+    };                                                                                  \
+    static const uint32_t table##_value[] = {                                           \
+        ENTRIES(DECODE_VALUE_, DECODE_VALUE_NAMED_, DECODE_VALUE_EXT_)                  \
+    };                                                                                  \
+    static const decode_func_t table##_decoders[] = {                                   \
+        ENTRIES(DECODE_FUNC_, DECODE_FUNC_NAMED_, DECODE_FUNC_EXT_)                     \
+    };                                                                                  \
+    static const char *const table##_names[] = {                                        \
+        ENTRIES(DECODE_NAME_, DECODE_NAME_NAMED_, DECODE_NAME_EXT_)                     \
+    };                                                                                  \
+    static const uint8_t table##_exts[] = {                                             \
+        ENTRIES(DECODE_EXT_, DECODE_EXT_NAMED_, DECODE_EXT_EXT_)                        \
+    };                                                                                  \
+    _Static_assert(ARRAY_SIZE(table##_mask) <= DECODE_TABLE_MAX,                        \
+                   #table " has too many entries");                                     \
+    const decode_table_t table = {                                                      \
+        table##_mask, table##_value, table##_decoders, table##_names, table##_exts,     \
+        ARRAY_SIZE(table##_mask)                                                        \
+    }
+
+/* 条目列表中被裁剪的部分：不展开任何条目 */
+#define DECODE_NO_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)
 
 /* 便捷宏：计算数组大小 */
 #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0]))
 
 /* 安全字符串复制宏 */
-#ifdef _WIN32
+#if defined(ARM64_DISASM_FREESTANDING)
+    #define SAFE_STRCPY(dst, src) strbuf_copy((dst), sizeof(dst), (src))
+#elif defined(_WIN32)
     #define SAFE_STRCPY(dst, src) strcpy_s((dst), sizeof(dst), (src))
 #else
     #define SAFE_STRCPY(dst, src) do { \
@@ -43,6 +92,123 @@ typedef struct {
     } while(0)
 #endif
 
+/* ========== 操作数填写辅助函数 ========== */
+
+/**
+ * 获取寄存器类型对应的位宽
+ */
+static inline uint8_t reg_type_width(reg_type_t type) {
+    switch (type) {
+        case REG_TYPE_W:
+        case REG_TYPE_WZR:
+        case REG_TYPE_S:
+            return 32;
+        case REG_TYPE_B:
+            return 8;
+        case REG_TYPE_H:
+            return 16;
+        case REG_TYPE_V:
+        case REG_TYPE_Q:
+            return 128;
+        default:
+            return 64;
+    }
+}
+
+/**
+ * 追加一个操作数，返回其指针（已满时返回NULL）
+ */
+static inline disasm_operand_t *add_operand(disasm_inst_t *result, operand_kind_t kind,
+                                            uint8_t access, uint16_t width) {
+    if (result->operand_count >= DISASM_MAX_OPERANDS) {
+        return NULL;
+    }
+    disasm_operand_t *op = &result->operands[result->operand_count++];
+    op->kind = (uint8_t)kind;
+    op->access = access;
+    op->width = width;
+    return op;
+}
+
+static inline void add_reg_operand(disasm_inst_t *result, uint8_t num,
+                                   reg_type_t type, uint8_t access) {
+    disasm_operand_t *op = add_operand(result, OPERAND_REG, access, reg_type_width(type));
+    if (op) {
+        op->reg.num = num;
+        op->reg.type = (uint8_t)type;
+    }
+}
+
+static inline void add_imm_operand(disasm_inst_t *result, int64_t imm) {
+    disasm_operand_t *op = add_operand(result, OPERAND_IMM, OPERAND_ACCESS_READ, 64);
+    if (op) {
+        op->imm = imm;
+    }
+}
+
+static inline void add_shift_operand(disasm_inst_t *result, extend_t type, uint8_t amount) {
+    disasm_operand_t *op = add_operand(result, OPERAND_SHIFT, OPERAND_ACCESS_READ, 0);
+    if (op) {
+        op->shift.type = (uint8_t)type;
+        op->shift.amount = amount;
+    }
+}
+
+static inline void add_cond_operand(disasm_inst_t *result, uint8_t cond) {
+    disasm_operand_t *op = add_operand(result, OPERAND_COND, OPERAND_ACCESS_READ, 0);
+    if (op) {
+        op->cond = cond & 0xF;
+    }
+}
+
+static inline void add_sysreg_operand(disasm_inst_t *result, uint16_t sysreg, uint8_t access) {
+    disasm_operand_t *op = add_operand(result, OPERAND_SYSREG, access, 64);
+    if (op) {
+        op->sysreg = sysreg;
+    }
+}
+
+/**
+ * 根据已解码的 rn/rm/addr_mode/imm 等字段追加内存操作数
+ * @param access_bits 内存访问大小（按位）
+ */
+static inline void add_mem_operand(disasm_inst_t *result, uint8_t access, uint16_t access_bits) {
+    disasm_operand_t *op = add_operand(result, OPERAND_MEM, access, access_bits);
+    if (!op) {
+        return;
+    }
+    op->mem.base = result->rn;
+    op->mem.base_type = (uint8_t)result->rn_type;
+    op->mem.index = 0;
+    op->mem.index_type = 0;
+    op->mem.mode = (uint8_t)result->addr_mode;
+    op->mem.extend = 0;
+    op->mem.shift = 0;
+    op->mem.has_index = false;
+    op->mem.writeback = false;
+    op->mem.disp = result->has_imm ? result->imm : 0;
+    
+    switch (result->addr_mode) {
+        case ADDR_MODE_PRE_INDEX:
+        case ADDR_MODE_POST_INDEX:
+            op->mem.writeback = true;
+            break;
+        case ADDR_MODE_REG_OFFSET:
+        case ADDR_MODE_REG_EXTEND:
+            op->mem.has_index = true;
+            op->mem.index = result->rm;
+            op->mem.index_type = (uint8_t)result->rm_type;
+            op->mem.extend = (uint8_t)result->extend_type;
+            op->mem.shift = result->shift_amount;
+            break;
+        case ADDR_MODE_LITERAL:
+            op->mem.disp = (int64_t)(result->address + result->imm);
+            break;
+        default:
+            break;
+    }
+}
+
 /*
  * ARM64 指令编码位字段说明：
  * 
@@ -56,41 +222,46 @@ typedef struct {
  */
 
 /* ========== 分支指令解码表声明 ========== */
-extern const decode_entry_t branch_decode_table[];
-extern const size_t branch_decode_table_size;
+extern const decode_table_t branch_decode_table;
 
 /* ========== 数据处理（立即数）解码表声明 ========== */
-extern const decode_entry_t data_proc_imm_decode_table[];
-extern const size_t data_proc_imm_decode_table_size;
+extern const decode_table_t data_proc_imm_decode_table;
 
 /* ========== 数据处理（寄存器）解码表声明 ========== */
-extern const decode_entry_t data_proc_reg_decode_table[];
-extern const size_t data_proc_reg_decode_table_size;
+extern const decode_table_t data_proc_reg_decode_table;
 
 /* ========== 加载/存储解码表声明 ========== */
-extern const decode_entry_t load_store_decode_table[];
-extern const size_t load_store_decode_table_size;
+extern const decode_table_t load_store_decode_table;
 
 /* ========== 浮点/SIMD解码表声明 ========== */
-extern const decode_entry_t fp_simd_decode_table[];
-extern const size_t fp_simd_decode_table_size;
+extern const decode_table_t fp_simd_decode_table;
+
+/* ========== 子解码表编号 ========== */
+
+/* 按目标配置解码时每个子解码表有一个条目掩码（arm64_target_t.group_entries） */
+typedef enum {
+    DECODE_GROUP_BRANCH,
+    DECODE_GROUP_DATA_PROC_IMM,
+    DECODE_GROUP_DATA_PROC_REG,
+    DECODE_GROUP_LOAD_STORE,
+    DECODE_GROUP_FP_SIMD,
+    DECODE_GROUP_COUNT
+} decode_group_id_t;
 
 /* ========== 顶层解码表声明 ========== */
-extern const decode_entry_t top_level_decode_table[];
-extern const size_t top_level_decode_table_size;
+extern const decode_table_t top_level_decode_table;
 
 /* ========== 解码辅助函数 ========== */
 
 /**
- * 在解码表中查找匹配的条目并执行解码
+ * 按表中顺序依次尝试所有匹配的条目，直到某个解码函数成功
  * @param table 解码表
- * @param table_size 表大小
  * @param inst 原始指令
  * @param addr 指令地址
  * @param result 输出结果
  * @return 解码成功返回true
  */
-bool decode_with_table(const decode_entry_t *table, size_t table_size,
-                       uint32_t inst, uint64_t addr, disasm_inst_t *result);
+bool decode_with_table(const decode_table_t *table, uint32_t inst, uint64_t addr,
+                       disasm_inst_t *result);
 
 #endif /* ARM64_DECODE_TABLE_H */
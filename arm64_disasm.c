@@ -5,19 +5,24 @@
 
 #include "arm64_disasm.h"
 #include "arm64_decode_table.h"
+#ifndef ARM64_DISASM_FREESTANDING
 #include <stdio.h>
-#include <string.h>
+#endif
 
 /* ========== 解码表辅助函数 ========== */
 
 /**
- * 在解码表中查找匹配的条目并执行解码
+ * 按表中顺序依次尝试所有匹配的条目，直到某个解码函数成功
  */
-bool decode_with_table(const decode_entry_t *table, size_t table_size,
-                       uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    for (size_t i = 0; i < table_size; i++) {
-        if ((inst & table[i].mask) == table[i].value) {
-            if (table[i].decoder(inst, addr, result)) {
+bool decode_with_table(const decode_table_t *table, uint32_t inst, uint64_t addr,
+                       disasm_inst_t *result) {
+    const uint32_t *mask = table->mask;
+    const uint32_t *value = table->value;
+    for (size_t i = 0; i < table->count; i++) {
+        if ((inst & mask[i]) == value[i]) {
+            /* 丢弃上一个未成功的解码器留下的操作数 */
+            result->operand_count = 0;
+            if (table->decoders[i](inst, addr, result)) {
                 return true;
             }
         }
@@ -27,6 +32,9 @@ bool decode_with_table(const decode_entry_t *table, size_t table_size,
 
 /* ========== 顶层解码分发函数 ========== */
 
+/* 未编译进库的指令组（ARM64_DISASM_NO_<组>）没有分发函数和顶层表条目 */
+
+#if ARM64_DISASM_HAS_DATA_PROC
 /**
  * 分发到数据处理（立即数）解码
  */
@@ -40,27 +48,34 @@ static bool dispatch_data_proc_imm(uint32_t inst, uint64_t addr, disasm_inst_t *
 static bool dispatch_data_proc_reg(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     return decode_data_proc_reg(inst, addr, result);
 }
+#endif
 
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
 /**
  * 分发到分支指令解码
  */
 static bool dispatch_branch(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     return decode_branch(inst, addr, result);
 }
+#endif
 
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
 /**
  * 分发到加载/存储解码
  */
 static bool dispatch_load_store(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     return decode_load_store(inst, addr, result);
 }
+#endif
 
+#if ARM64_DISASM_HAS_FP_SIMD
 /**
  * 分发到浮点/SIMD解码
  */
 static bool dispatch_fp_simd(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     return decode_fp_simd(inst, addr, result);
 }
+#endif
 
 /* ========== 顶层解码表 ========== */
 
@@ -78,27 +93,97 @@ static bool dispatch_fp_simd(uint32_t inst, uint64_t addr, disasm_inst_t *result
  * 1111: 加载/存储 / SIMD
  */
 
-const decode_entry_t top_level_decode_table[] = {
-    /* 数据处理（立即数）: bits[28:26] = 100 */
-    DECODE_ENTRY_NAMED(0x1C000000, 0x10000000, dispatch_data_proc_imm, "data_proc_imm"),
-    
-    /* 分支、异常、系统: bits[28:26] = 101 */
-    DECODE_ENTRY_NAMED(0x1C000000, 0x14000000, dispatch_branch, "branch"),
-    
-    /* 加载/存储: bits[27] = 1, bits[25] = 0 */
-    DECODE_ENTRY_NAMED(0x0A000000, 0x08000000, dispatch_load_store, "load_store_1"),
-    
-    /* 加载/存储: bits[28:26] = 110 或 111 */
-    DECODE_ENTRY_NAMED(0x1C000000, 0x18000000, dispatch_load_store, "load_store_2"),
-    
-    /* 数据处理（寄存器）: bits[28:25] = 0101 或 1101 */
-    DECODE_ENTRY_NAMED(0x0E000000, 0x0A000000, dispatch_data_proc_reg, "data_proc_reg"),
-    
-    /* 浮点/SIMD数据处理: bits[28:25] = 1111 或 0111 */
-    DECODE_ENTRY_NAMED(0x0E000000, 0x0E000000, dispatch_fp_simd, "fp_simd"),
+#if ARM64_DISASM_HAS_DATA_PROC
+#define TOP_DATA_PROC_IMM_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)   \
+    /* 数据处理（立即数）: bits[28:26] = 100 */                                         \
+    DECODE_ENTRY_NAMED(0x1C000000, 0x10000000, dispatch_data_proc_imm, "data_proc_imm")
+#else
+#define TOP_DATA_PROC_IMM_ENTRIES DECODE_NO_ENTRIES
+#endif
+
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
+#define TOP_BRANCH_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)          \
+    /* 分支、异常、系统: bits[28:26] = 101 */                                           \
+    DECODE_ENTRY_NAMED(0x1C000000, 0x14000000, dispatch_branch, "branch")
+#else
+#define TOP_BRANCH_ENTRIES DECODE_NO_ENTRIES
+#endif
+
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
+#define TOP_LOAD_STORE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)      \
+    /* 加载/存储: bits[27] = 1, bits[25] = 0 */                                         \
+    DECODE_ENTRY_NAMED(0x0A000000, 0x08000000, dispatch_load_store, "load_store_1")     \
+                                                                                        \
+    /* 加载/存储: bits[28:26] = 110 或 111 */                                           \
+    DECODE_ENTRY_NAMED(0x1C000000, 0x18000000, dispatch_load_store, "load_store_2")
+#else
+#define TOP_LOAD_STORE_ENTRIES DECODE_NO_ENTRIES
+#endif
+
+#if ARM64_DISASM_HAS_DATA_PROC
+#define TOP_DATA_PROC_REG_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)   \
+    /* 数据处理（寄存器）: bits[28:25] = 0101 或 1101 */                                \
+    DECODE_ENTRY_NAMED(0x0E000000, 0x0A000000, dispatch_data_proc_reg, "data_proc_reg")
+#else
+#define TOP_DATA_PROC_REG_ENTRIES DECODE_NO_ENTRIES
+#endif
+
+#if ARM64_DISASM_HAS_FP_SIMD
+#define TOP_FP_SIMD_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)         \
+    /* 浮点/SIMD数据处理: bits[28:25] = 1111 或 0111 */                                 \
+    DECODE_ENTRY_NAMED(0x0E000000, 0x0E000000, dispatch_fp_simd, "fp_simd")
+#else
+#define TOP_FP_SIMD_ENTRIES DECODE_NO_ENTRIES
+#endif
+
+#define TOP_LEVEL_DECODE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)    \
+    TOP_DATA_PROC_IMM_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)       \
+    TOP_BRANCH_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)              \
+    TOP_LOAD_STORE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)          \
+    TOP_DATA_PROC_REG_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)       \
+    TOP_FP_SIMD_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)
+
+DEFINE_DECODE_TABLE(top_level_decode_table, TOP_LEVEL_DECODE_ENTRIES);
+
+/* 各顶层条目分发到的子解码表（与 top_level_decode_table 一一对应） */
+static const uint8_t top_level_groups[] = {
+#if ARM64_DISASM_HAS_DATA_PROC
+    DECODE_GROUP_DATA_PROC_IMM,
+#endif
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
+    DECODE_GROUP_BRANCH,
+#endif
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
+    DECODE_GROUP_LOAD_STORE,
+    DECODE_GROUP_LOAD_STORE,
+#endif
+#if ARM64_DISASM_HAS_DATA_PROC
+    DECODE_GROUP_DATA_PROC_REG,
+#endif
+#if ARM64_DISASM_HAS_FP_SIMD
+    DECODE_GROUP_FP_SIMD,
+#endif
+    DECODE_GROUP_COUNT      /* 哨兵：保证数组非空 */
 };
 
-const size_t top_level_decode_table_size = ARRAY_SIZE(top_level_decode_table);
+_Static_assert(DECODE_GROUP_COUNT == ARM64_DECODE_GROUPS, "arm64_target_t.group_entries size");
+
+/* 各子解码表（未编译进库的组为NULL） */
+static const decode_table_t *const group_tables[DECODE_GROUP_COUNT] = {
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
+    [DECODE_GROUP_BRANCH] = &branch_decode_table,
+#endif
+#if ARM64_DISASM_HAS_DATA_PROC
+    [DECODE_GROUP_DATA_PROC_IMM] = &data_proc_imm_decode_table,
+    [DECODE_GROUP_DATA_PROC_REG] = &data_proc_reg_decode_table,
+#endif
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
+    [DECODE_GROUP_LOAD_STORE] = &load_store_decode_table,
+#endif
+#if ARM64_DISASM_HAS_FP_SIMD
+    [DECODE_GROUP_FP_SIMD] = &fp_simd_decode_table,
+#endif
+};
 
 /* ========== 初始化函数 ========== */
 
@@ -106,13 +191,33 @@ const size_t top_level_decode_table_size = ARRAY_SIZE(top_level_decode_table);
  * 初始化反汇编指令结构
  */
 static void init_disasm_inst(disasm_inst_t *inst, uint32_t raw, uint64_t address) {
-    memset(inst, 0, sizeof(disasm_inst_t));
+    ARM64_MEMSET(inst, 0, sizeof(disasm_inst_t));
     inst->raw = raw;
     inst->address = address;
     inst->type = INST_TYPE_UNKNOWN;
     SAFE_STRCPY(inst->mnemonic, "unknown");
 }
 
+/**
+ * 顶层表未匹配时依次直接尝试各子解码器
+ */
+static bool decode_fallback(uint32_t raw_inst, uint64_t address, disasm_inst_t *inst) {
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
+    if (decode_branch(raw_inst, address, inst)) return true;
+#endif
+#if ARM64_DISASM_HAS_DATA_PROC
+    if (decode_data_proc_imm(raw_inst, address, inst)) return true;
+    if (decode_data_proc_reg(raw_inst, address, inst)) return true;
+#endif
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
+    if (decode_load_store(raw_inst, address, inst)) return true;
+#endif
+#if ARM64_DISASM_HAS_FP_SIMD
+    if (decode_fp_simd(raw_inst, address, inst)) return true;
+#endif
+    return false;
+}
+
 /* ========== 主反汇编函数 ========== */
 
 /**
@@ -126,71 +231,250 @@ bool disassemble_arm64(uint32_t raw_inst, uint64_t address, disasm_inst_t *inst)
     init_disasm_inst(inst, raw_inst, address);
     
     /* 使用顶层解码表进行分发 */
-    if (decode_with_table(top_level_decode_table, top_level_decode_table_size,
-                         raw_inst, address, inst)) {
+    if (decode_with_table(&top_level_decode_table, raw_inst, address, inst)) {
         return true;
     }
     
     /* 如果顶层表未匹配，尝试直接调用各子解码器 */
     /* 这是为了处理一些边界情况 */
-    if (decode_branch(raw_inst, address, inst)) return true;
-    if (decode_data_proc_imm(raw_inst, address, inst)) return true;
-    if (decode_data_proc_reg(raw_inst, address, inst)) return true;
-    if (decode_load_store(raw_inst, address, inst)) return true;
-    if (decode_fp_simd(raw_inst, address, inst)) return true;
+    if (decode_fallback(raw_inst, address, inst)) {
+        return true;
+    }
     
-    return (inst->type != INST_TYPE_UNKNOWN);
+    /* 所有解码器都失败：丢弃失败的解码器留下的部分字段 */
+    init_disasm_inst(inst, raw_inst, address);
+    return false;
 }
 
-/* ========== 批量反汇编 ========== */
+/* ========== 按目标配置解码 ========== */
 
 /**
- * 批量反汇编
+ * 由扩展集合初始化目标配置
  */
-void disassemble_block(const uint32_t *code, size_t count, uint64_t start_addr) {
-    if (!code || count == 0) {
-        return;
+void arm64_target_init(arm64_target_t *target, const arm64_ext_set_t *exts) {
+    target->exts = *exts;
+    arm64_ext_set_add(&target->exts, ARM64_EXT_BASE);
+    
+    /* 子表条目：独占扩展不在配置中的条目不参与分发；
+       浮点/SIMD解码器只产生 ASIMD（及其上的 FP16 等）指令，没有 ASIMD 时整表裁剪 */
+    for (int g = 0; g < DECODE_GROUP_COUNT; g++) {
+        const decode_table_t *table = group_tables[g];
+        target->group_entries[g] = 0;
+        target->group_pruned[g] = 0;
+        for (size_t i = 0; table && i < table->count; i++) {
+            if (arm64_ext_set_contains(&target->exts, (arm64_ext_t)table->exts[i])) {
+                target->group_entries[g] |= 1u << i;
+            } else {
+                target->group_pruned[g] |= 1u << i;
+            }
+        }
+    }
+    if (!arm64_ext_set_contains(&target->exts, ARM64_EXT_ASIMD)) {
+        target->group_entries[DECODE_GROUP_FP_SIMD] = 0;
+        target->group_pruned[DECODE_GROUP_FP_SIMD] = 0;
+    }
+    
+    /* 顶层条目：子表条目全部裁剪时整条不参与分发 */
+    target->top_entries = 0;
+    for (size_t i = 0; i < top_level_decode_table.count; i++) {
+        if (target->group_entries[top_level_groups[i]]) {
+            target->top_entries |= 1u << i;
+        }
+    }
+    
+    for (uint32_t key = 0; key < ARM64_EXT_BUCKETS; key++) {
+        bool covered = true;
+        for (uint32_t i = arm64_ext_buckets[key]; i < arm64_ext_buckets[key + 1] && covered; i++) {
+            covered = arm64_ext_set_contains(&target->exts, (arm64_ext_t)arm64_ext_pattern_exts[i]);
+        }
+        if (covered) {
+            target->covered[key / 64] |= 1ull << (key % 64);
+        } else {
+            target->covered[key / 64] &= ~(1ull << (key % 64));
+        }
+    }
+}
+
+/**
+ * 与 decode_with_table 相同，但只调用 enabled 中对应位为1的条目的解码器；
+ * 编码匹配 pruned 中的条目时停止（该编码属于配置中没有的扩展）
+ * @param exclusive 解码成功时置为该条目是否只产生一个扩展的指令
+ * @param rejected 匹配到裁剪的条目时置为true
+ */
+static bool decode_with_table_enabled(const decode_table_t *table, uint32_t enabled,
+                                      uint32_t pruned, uint32_t inst, uint64_t addr,
+                                      disasm_inst_t *result, bool *exclusive, bool *rejected) {
+    uint32_t entries = enabled | pruned;
+    for (size_t i = 0; entries; i++, entries >>= 1) {
+        if (!(entries & 1) || (inst & table->mask[i]) != table->value[i]) {
+            continue;
+        }
+        if (!((enabled >> i) & 1)) {
+            *rejected = true;
+            return false;
+        }
+        result->operand_count = 0;
+        if (table->decoders[i](inst, addr, result)) {
+            *exclusive = table->exts[i] != ARM64_EXT_BASE;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 按目标配置反汇编单条指令
+ */
+bool disassemble_arm64_target(const arm64_target_t *target, uint32_t raw_inst,
+                              uint64_t address, disasm_inst_t *inst) {
+    if (!target || !inst) {
+        return false;
     }
     
+    init_disasm_inst(inst, raw_inst, address);
+    
+    /* 与 disassemble_arm64 相同的分发，但跳过配置中裁剪掉的顶层条目和子表条目 */
+    bool decoded = false;
+    bool exclusive = false;
+    bool rejected = false;
+    uint32_t top = target->top_entries;
+    for (size_t i = 0; top && !decoded && !rejected; i++, top >>= 1) {
+        if ((top & 1) &&
+            (raw_inst & top_level_decode_table.mask[i]) == top_level_decode_table.value[i]) {
+            uint8_t group = top_level_groups[i];
+            decoded = decode_with_table_enabled(group_tables[group], target->group_entries[group],
+                                                target->group_pruned[group], raw_inst, address,
+                                                inst, &exclusive, &rejected);
+        }
+    }
+    if (!decoded && !rejected) {
+        /* 与 decode_fallback 相同的顺序 */
+        static const uint8_t fallback_groups[] = {
+            DECODE_GROUP_BRANCH, DECODE_GROUP_DATA_PROC_IMM, DECODE_GROUP_DATA_PROC_REG,
+            DECODE_GROUP_LOAD_STORE, DECODE_GROUP_FP_SIMD,
+        };
+        for (size_t i = 0; i < ARRAY_SIZE(fallback_groups) && !decoded && !rejected; i++) {
+            uint8_t group = fallback_groups[i];
+            decoded = decode_with_table_enabled(group_tables[group], target->group_entries[group],
+                                                target->group_pruned[group], raw_inst, address,
+                                                inst, &exclusive, &rejected);
+        }
+    }
+    
+    /* 条目独占的扩展已在配置中；组内共用解码器的扩展指令（FP16、CRC32 等）在解码后
+       按编码检查，编码桶内全部模式都在配置中时只需查类型表 */
+    if (decoded) {
+        if (exclusive) {
+            return true;
+        }
+        uint32_t key = raw_inst >> ARM64_EXT_BUCKET_SHIFT;
+        if ((target->covered[key / 64] >> (key % 64)) & 1) {
+            if (arm64_ext_set_contains(&target->exts, (arm64_ext_t)inst_ext_table[inst->type])) {
+                return true;
+            }
+        }
+        if (arm64_ext_set_contains(&target->exts, get_inst_extension(inst))) {
+            return true;
+        }
+    }
+    init_disasm_inst(inst, raw_inst, address);
+    return false;
+}
+
+/* ========== 批量反汇编 ========== */
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+/* 字节缓冲区反汇编时每批转换的指令字数量 */
+#define BLOCK_BATCH_WORDS 64
+
+/**
+ * 打印批量反汇编的表头
+ */
+static void print_block_header(size_t count, uint64_t start_addr) {
     printf("=== ARM64 反汇编 ===\n");
     printf("起始地址: 0x%016llx\n", (unsigned long long)start_addr);
     printf("指令数量: %zu\n\n", count);
     printf("%-18s  %-10s  %s\n", "地址", "机器码", "指令");
     printf("--------------------------------------------------\n");
+}
+
+/**
+ * 反汇编并打印一行
+ */
+static void print_block_line(uint32_t raw, uint64_t addr) {
+    disasm_inst_t inst;
+    
+    if (disassemble_arm64(raw, addr, &inst)) {
+        char buffer[256];
+        format_instruction(&inst, buffer, sizeof(buffer));
+        printf("0x%016llx:  %08x  %s\n", 
+               (unsigned long long)addr, raw, buffer);
+    } else {
+        printf("0x%016llx:  %08x  <未知指令>\n", 
+               (unsigned long long)addr, raw);
+    }
+}
+
+/**
+ * 批量反汇编
+ */
+void disassemble_block(const uint32_t *code, size_t count, uint64_t start_addr) {
+    if (!code || count == 0) {
+        return;
+    }
+    
+    print_block_header(count, start_addr);
     
     for (size_t i = 0; i < count; i++) {
-        disasm_inst_t inst;
-        uint64_t addr = start_addr + (i * 4);
-        
-        if (disassemble_arm64(code[i], addr, &inst)) {
-            char buffer[256];
-            format_instruction(&inst, buffer, sizeof(buffer));
-            printf("0x%016llx:  %08x  %s\n", 
-                   (unsigned long long)addr, code[i], buffer);
-        } else {
-            printf("0x%016llx:  %08x  <未知指令>\n", 
-                   (unsigned long long)addr, code[i]);
-        }
+        print_block_line(code[i], start_addr + (i * 4));
     }
     
     printf("\n=== 反汇编完成 ===\n");
 }
 
 /**
- * 从内存中反汇编指定范围
+ * 批量反汇编字节缓冲区（任意对齐）
  */
-void disassemble_from_memory(const void *start_addr, size_t byte_count) {
-    if (!start_addr || byte_count == 0 || byte_count % 4 != 0) {
+void disassemble_block_bytes(const void *bytes, size_t byte_count,
+                             uint64_t start_addr, arm64_endian_t endian) {
+    if (!bytes || byte_count == 0 || byte_count % 4 != 0) {
         fprintf(stderr, "错误：无效的地址或大小（大小必须是4的倍数）\n");
         return;
     }
     
-    const uint32_t *code = (const uint32_t *)start_addr;
+    const uint8_t *src = (const uint8_t *)bytes;
     size_t inst_count = byte_count / 4;
+    uint32_t words[BLOCK_BATCH_WORDS];
+    
+    print_block_header(inst_count, start_addr);
     
-    disassemble_block(code, inst_count, (uint64_t)start_addr);
+    for (size_t done = 0; done < inst_count; ) {
+        size_t n = inst_count - done;
+        if (n > BLOCK_BATCH_WORDS) {
+            n = BLOCK_BATCH_WORDS;
+        }
+        
+        arm64_load_words(src + done * 4, n * 4, endian, words);
+        for (size_t i = 0; i < n; i++) {
+            print_block_line(words[i], start_addr + (done + i) * 4);
+        }
+        done += n;
+    }
+    
+    printf("\n=== 反汇编完成 ===\n");
 }
 
+/**
+ * 从内存中反汇编指定范围
+ * 不再将指针强制转换为uint32_t*，未对齐的地址同样安全
+ */
+void disassemble_from_memory(const void *start_addr, size_t byte_count) {
+    disassemble_block_bytes(start_addr, byte_count,
+                            (uint64_t)(uintptr_t)start_addr, ARM64_ENDIAN_LITTLE);
+}
+#endif /* ARM64_DISASM_FREESTANDING */
+
 /* ========== 辅助函数 ========== */
 
 /**
@@ -203,64 +487,148 @@ bool get_branch_target(const disasm_inst_t *inst, uint64_t *target) {
     
     switch (inst->type) {
         case INST_TYPE_B:
+        case INST_TYPE_BCOND:
         case INST_TYPE_BL:
         case INST_TYPE_CBZ:
         case INST_TYPE_CBNZ:
         case INST_TYPE_TBZ:
         case INST_TYPE_TBNZ:
         case INST_TYPE_ADR:
-        case INST_TYPE_ADRP:
             *target = inst->address + inst->imm;
             return true;
+        case INST_TYPE_ADRP:
+            /* ADRP 相对于当前指令所在的4KB页 */
+            *target = (inst->address & ~0xFFFULL) + inst->imm;
+            return true;
         default:
             return false;
     }
 }
 
+/* ========== 指令属性查询 ========== */
+
 /**
- * 判断指令是否为分支指令
+ * 获取指令的属性位
  */
-bool is_branch_instruction(const disasm_inst_t *inst) {
-    if (!inst) return false;
+uint32_t get_inst_props(const disasm_inst_t *inst) {
+    if (!inst) return 0;
     
-    switch (inst->type) {
-        case INST_TYPE_B:
-        case INST_TYPE_BL:
-        case INST_TYPE_BR:
-        case INST_TYPE_BLR:
-        case INST_TYPE_RET:
-        case INST_TYPE_CBZ:
-        case INST_TYPE_CBNZ:
-        case INST_TYPE_TBZ:
-        case INST_TYPE_TBNZ:
-            return true;
-        default:
-            return false;
+    uint32_t props = inst_type_props(inst->type);
+    
+    /* ands/bics/tst 与 and 共用类型 */
+    if (inst->set_flags) {
+        props |= INST_PROP_SETS_FLAGS;
+    }
+    
+    /* 原子操作的获取/释放语义由 A/R 位决定 */
+    if (inst->is_acquire) props |= INST_PROP_ACQUIRE;
+    if (inst->is_release) props |= INST_PROP_RELEASE;
+    
+    /* ERET/DRPS 与 RET 共用类型 */
+    if (inst->type == INST_TYPE_RET && BITS(inst->raw, 21, 24) >= 0x04) {
+        props |= INST_PROP_PRIVILEGED;
+    }
+    
+    /* SIMD标量运算复用了通用指令类型 */
+    if (inst->rd_type >= REG_TYPE_V || inst->rn_type >= REG_TYPE_V) {
+        props |= INST_PROP_FP_SIMD;
     }
+    
+    return props;
 }
 
 /**
- * 判断指令是否为加载/存储指令
+ * 获取指令所需的最低架构扩展
  */
-bool is_load_store_instruction(const disasm_inst_t *inst) {
-    if (!inst) return false;
+arm64_ext_t get_inst_extension(const disasm_inst_t *inst) {
+    if (!inst || (unsigned)inst->type >= INST_TYPE_COUNT) {
+        return ARM64_EXT_BASE;
+    }
     
-    switch (inst->type) {
-        case INST_TYPE_LDR:
-        case INST_TYPE_LDRB:
-        case INST_TYPE_LDRH:
-        case INST_TYPE_LDRSW:
-        case INST_TYPE_LDRSB:
-        case INST_TYPE_LDRSH:
-        case INST_TYPE_STR:
-        case INST_TYPE_STRB:
-        case INST_TYPE_STRH:
-        case INST_TYPE_LDP:
-        case INST_TYPE_STP:
-            return true;
-        default:
-            return false;
+    /* HINT 空间（BTI、PACIASP、ESB 等）在没有该扩展的 CPU 上按 NOP 执行，不构成要求 */
+    if ((inst->raw & 0xFFFFF01F) == 0xD503201F) {
+        return ARM64_EXT_BASE;
+    }
+    
+    arm64_ext_t ext = get_encoding_extension(inst->raw);
+    if (ext != ARM64_EXT_BASE) {
+        return ext;
+    }
+    
+    /* LDLAR/STLLR（o0=0）属于 LOR 扩展 */
+    if ((inst->type == INST_TYPE_LDAR || inst->type == INST_TYPE_STLR) && !BIT(inst->raw, 15)) {
+        return ARM64_EXT_LOR;
     }
+    
+    return (arm64_ext_t)inst_ext_table[inst->type];
+}
+
+/**
+ * 按编码获取所需的架构扩展：在 bits[31:21] 对应的桶内按顺序匹配
+ */
+arm64_ext_t get_encoding_extension(uint32_t raw) {
+    uint32_t key = raw >> ARM64_EXT_BUCKET_SHIFT;
+    for (uint32_t i = arm64_ext_buckets[key]; i < arm64_ext_buckets[key + 1]; i++) {
+        if ((raw & arm64_ext_patterns[i].mask) == arm64_ext_patterns[i].value) {
+            return (arm64_ext_t)arm64_ext_pattern_exts[i];
+        }
+    }
+    return ARM64_EXT_BASE;
+}
+
+/**
+ * 获取扩展名称
+ */
+const char *get_extension_name(arm64_ext_t ext) {
+    if ((unsigned)ext >= ARM64_EXT_COUNT) {
+        return "unknown";
+    }
+    return arm64_ext_names[ext];
+}
+
+/**
+ * 获取指令类型名称
+ */
+const char *get_inst_type_name(inst_type_t type) {
+    if ((unsigned)type >= INST_TYPE_COUNT) {
+        return "unknown";
+    }
+    return inst_type_names[type];
+}
+
+/**
+ * 判断指令是否为分支指令
+ */
+bool is_branch_instruction(const disasm_inst_t *inst) {
+    return inst && (inst_type_props(inst->type) & INST_PROP_BRANCH) != 0;
+}
+
+/**
+ * 判断指令是否为加载/存储指令
+ */
+bool is_load_store_instruction(const disasm_inst_t *inst) {
+    return inst && (inst_type_props(inst->type) & INST_PROP_MEM) != 0;
+}
+
+/**
+ * 判断指令是否为屏障指令
+ */
+bool is_barrier_instruction(const disasm_inst_t *inst) {
+    return inst && (inst_type_props(inst->type) & INST_PROP_BARRIER) != 0;
+}
+
+/**
+ * 判断指令是否可能需要特权级执行
+ */
+bool is_privileged_instruction(const disasm_inst_t *inst) {
+    return (get_inst_props(inst) & INST_PROP_PRIVILEGED) != 0;
+}
+
+/**
+ * 判断指令是否为原子或独占内存访问
+ */
+bool is_atomic_instruction(const disasm_inst_t *inst) {
+    return inst && (inst_type_props(inst->type) & (INST_PROP_ATOMIC | INST_PROP_EXCLUSIVE)) != 0;
 }
 
 /**
@@ -309,6 +677,54 @@ bool get_immediate_value(const disasm_inst_t *inst, int64_t *value) {
     return false;
 }
 
+#ifndef ARM64_DISASM_FREESTANDING
+/**
+ * 打印单个操作数（用于详细信息输出）
+ */
+static void print_operand(const disasm_operand_t *op, size_t index) {
+    static const char *access_names[] = { "-", "r", "w", "rw" };
+    char reg_name[16];
+    
+    printf("  [%zu] %-2s ", index, access_names[op->access & 3]);
+    
+    switch (op->kind) {
+        case OPERAND_REG:
+            get_register_name(op->reg.num, (reg_type_t)op->reg.type, reg_name);
+            printf("reg %s (%u位)\n", reg_name, op->width);
+            break;
+        case OPERAND_IMM:
+            printf("imm %lld (0x%llx)\n", (long long)op->imm, (unsigned long long)op->imm);
+            break;
+        case OPERAND_MEM:
+            if (op->mem.mode == ADDR_MODE_LITERAL) {
+                printf("mem [0x%llx] (%u位)\n", (unsigned long long)op->mem.disp, op->width);
+                break;
+            }
+            get_register_name(op->mem.base, (reg_type_t)op->mem.base_type, reg_name);
+            printf("mem [%s", reg_name);
+            if (op->mem.has_index) {
+                get_register_name(op->mem.index, (reg_type_t)op->mem.index_type, reg_name);
+                printf(" + %s<<%u", reg_name, op->mem.shift);
+            } else if (op->mem.disp != 0) {
+                printf(" %+lld", (long long)op->mem.disp);
+            }
+            printf("]%s (%u位)\n", op->mem.writeback ? "!" : "", op->width);
+            break;
+        case OPERAND_SHIFT:
+            printf("shift %d #%u\n", op->shift.type, op->shift.amount);
+            break;
+        case OPERAND_COND:
+            printf("cond %u\n", op->cond);
+            break;
+        case OPERAND_SYSREG:
+            printf("sysreg 0x%04x\n", op->sysreg);
+            break;
+        default:
+            printf("none\n");
+            break;
+    }
+}
+
 /**
  * 打印指令的详细信息
  */
@@ -358,5 +774,13 @@ void print_instruction_details(const disasm_inst_t *inst) {
         printf("分支目标:   0x%016llx\n", (unsigned long long)target);
     }
     
+    if (inst->operand_count > 0) {
+        printf("操作数:     %u个\n", inst->operand_count);
+        for (size_t i = 0; i < inst->operand_count; i++) {
+            print_operand(&inst->operands[i], i);
+        }
+    }
+    
     printf("====================\n");
 }
+#endif /* ARM64_DISASM_FREESTANDING */
@@ -3,6 +3,61 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+
+#include "arm64_inst_props.h"
+
+/* ========== 构建配置：指令组 ========== */
+
+/*
+ * 定义 ARM64_DISASM_NO_<组> 可在编译期去掉一个指令组的解码器、解码表条目和格式化代码
+ * （CMake 选项 ARM64_DISASM_GROUP_<组>=OFF），被去掉的指令按未知指令处理。
+ * 库和使用者必须用同一组定义编译
+ */
+#if defined(ARM64_DISASM_NO_DATA_PROC)
+#define ARM64_DISASM_HAS_DATA_PROC  0   // 数据处理（立即数/寄存器）
+#else
+#define ARM64_DISASM_HAS_DATA_PROC  1
+#endif
+
+#if defined(ARM64_DISASM_NO_BRANCH)
+#define ARM64_DISASM_HAS_BRANCH     0   // B/BL/B.cond/CBZ/TBZ/BR/BLR/RET
+#else
+#define ARM64_DISASM_HAS_BRANCH     1
+#endif
+
+#if defined(ARM64_DISASM_NO_SYSTEM)
+#define ARM64_DISASM_HAS_SYSTEM     0   // NOP/HINT/MRS
+#else
+#define ARM64_DISASM_HAS_SYSTEM     1
+#endif
+
+#if defined(ARM64_DISASM_NO_LOAD_STORE)
+#define ARM64_DISASM_HAS_LOAD_STORE 0   // 普通加载/存储（单寄存器、寄存器对、字面量）
+#else
+#define ARM64_DISASM_HAS_LOAD_STORE 1
+#endif
+
+#if defined(ARM64_DISASM_NO_ATOMICS)
+#define ARM64_DISASM_HAS_ATOMICS    0   // 独占、获取/释放、CAS、LSE原子操作
+#else
+#define ARM64_DISASM_HAS_ATOMICS    1
+#endif
+
+#if defined(ARM64_DISASM_NO_FP_SIMD)
+#define ARM64_DISASM_HAS_FP_SIMD    0   // 浮点/SIMD数据处理
+#else
+#define ARM64_DISASM_HAS_FP_SIMD    1
+#endif
+
+#if !ARM64_DISASM_HAS_DATA_PROC && !ARM64_DISASM_HAS_BRANCH && !ARM64_DISASM_HAS_SYSTEM && \
+    !ARM64_DISASM_HAS_LOAD_STORE && !ARM64_DISASM_HAS_ATOMICS && !ARM64_DISASM_HAS_FP_SIMD
+#error "ARM64 disassembler: at least one instruction group must be enabled"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /* 寄存器类型 */
 typedef enum {
@@ -146,8 +201,38 @@ typedef enum {
     INST_TYPE_FRINT,        // 浮点舍入
     INST_TYPE_FMAX,         // 浮点最大值
     INST_TYPE_FMIN,         // 浮点最小值
+    
+    // 条件分支（追加在末尾以保持已有类型的数值不变）
+    INST_TYPE_BCOND,        // 条件分支 B.cond
+    INST_TYPE_PRFM,         // 预取内存 PRFM/PRFUM
+    INST_TYPE_COUNT         // 指令类型数量（非指令，用于定义表大小）
 } inst_type_t;
 
+/* 指令类型集合（位图，用于按类型过滤） */
+typedef struct {
+    uint64_t bits[(INST_TYPE_COUNT + 63) / 64];
+} inst_type_set_t;
+
+/* 扩展集合（位图，第 i 位对应 arm64_ext_t 值 i） */
+typedef struct {
+    uint64_t bits[(ARM64_EXT_COUNT + 63) / 64];
+} arm64_ext_set_t;
+
+/* 子解码表数（分支、数据处理立即数/寄存器、加载存储、浮点/SIMD） */
+#define ARM64_DECODE_GROUPS 5
+
+/*
+ * 目标配置：部署的 CPU 支持的扩展。按配置解码时，所需扩展不在集合中的指令视为未定义；
+ * 配置中没有的扩展独占的解码器（顶层条目或子解码表条目）不参与分发
+ */
+typedef struct {
+    arm64_ext_set_t exts;
+    uint32_t top_entries;       // 顶层解码表中仍参与分发的条目（位掩码）
+    uint32_t group_entries[ARM64_DECODE_GROUPS];    // 各子解码表中仍参与分发的条目（位掩码）
+    uint32_t group_pruned[ARM64_DECODE_GROUPS];     // 独占的扩展不在配置中的条目：编码匹配即为未定义
+    uint64_t covered[ARM64_EXT_BUCKETS / 64];   // 全部模式的扩展都在配置中的编码桶，解码后不必再查
+} arm64_target_t;
+
 /* 寻址模式 */
 typedef enum {
     ADDR_MODE_NONE,
@@ -170,9 +255,80 @@ typedef enum {
     EXTEND_SXTH = 5,    // 有符号扩展半字
     EXTEND_SXTW = 6,    // 有符号扩展字
     EXTEND_SXTX = 7,    // 有符号扩展双字
-    EXTEND_LSL = 8      // 逻辑左移
+    EXTEND_LSL = 8,     // 逻辑左移
+    EXTEND_LSR = 9,     // 逻辑右移（移位寄存器）
+    EXTEND_ASR = 10,    // 算术右移（移位寄存器）
+    EXTEND_ROR = 11     // 循环右移（移位寄存器）
 } extend_t;
 
+/* 指令字节序（用于字节缓冲区输入） */
+typedef enum {
+    ARM64_ENDIAN_LITTLE,    // 小端：AArch64指令的标准存放方式
+    ARM64_ENDIAN_BIG        // 大端：按字节交换后存放的指令字（数据大端固件、BE转储等）
+} arm64_endian_t;
+
+/* 格式化时的寄存器命名方式 */
+typedef enum {
+    DISASM_REGS_ALIAS,      // x29/x30 写作 fp/lr（默认）
+    DISASM_REGS_NUMERIC     // x29/x30 按编号书写（GNU objdump 的写法）
+} disasm_reg_names_t;
+
+/* 操作数种类 */
+typedef enum {
+    OPERAND_NONE,
+    OPERAND_REG,        // 寄存器
+    OPERAND_IMM,        // 立即数（PC相对目标以绝对地址给出）
+    OPERAND_MEM,        // 内存访问
+    OPERAND_SHIFT,      // 移位/扩展（作用于前一个寄存器操作数）
+    OPERAND_COND,       // 条件码
+    OPERAND_SYSREG      // 系统寄存器
+} operand_kind_t;
+
+/* 操作数访问方式（可组合） */
+#define OPERAND_ACCESS_READ     0x01
+#define OPERAND_ACCESS_WRITE    0x02
+
+/* 每条指令最多的显式操作数数量 */
+#define DISASM_MAX_OPERANDS     5
+
+/* 操作数 */
+typedef struct {
+    uint8_t kind;               // operand_kind_t
+    uint8_t access;             // OPERAND_ACCESS_* 组合
+    uint16_t width;             // 位宽：寄存器宽度或内存访问大小（按位）
+    union {
+        /* OPERAND_REG */
+        struct {
+            uint8_t num;        // 寄存器编号
+            uint8_t type;       // reg_type_t
+        } reg;
+        /* OPERAND_IMM */
+        int64_t imm;
+        /* OPERAND_MEM */
+        struct {
+            uint8_t base;       // 基址寄存器（字面量寻址时无效）
+            uint8_t base_type;  // reg_type_t
+            uint8_t index;      // 偏移寄存器（has_index为true时有效）
+            uint8_t index_type; // reg_type_t
+            uint8_t mode;       // addr_mode_t
+            uint8_t extend;     // extend_t（寄存器偏移时有效）
+            uint8_t shift;      // 偏移寄存器的移位量
+            bool has_index;     // 是否使用寄存器偏移
+            bool writeback;     // 是否回写基址寄存器（预/后索引）
+            int64_t disp;       // 偏移量；字面量寻址时为绝对地址
+        } mem;
+        /* OPERAND_SHIFT */
+        struct {
+            uint8_t type;       // extend_t
+            uint8_t amount;     // 移位量
+        } shift;
+        /* OPERAND_COND */
+        uint8_t cond;           // 条件码 (0-15)
+        /* OPERAND_SYSREG */
+        uint16_t sysreg;        // op0:op1:CRn:CRm:op2 组成的16位编码（即指令位[20:5]）
+    };
+} disasm_operand_t;
+
 /* 反汇编指令结构 */
 typedef struct {
     uint32_t raw;               // 原始指令编码
@@ -210,6 +366,10 @@ typedef struct {
     bool is_acquire;            // 是否有获取语义（原子操作）
     bool is_release;            // 是否有释放语义（原子操作）
     
+    /* 显式操作数列表（由各解码函数按汇编语法顺序填写） */
+    uint8_t operand_count;
+    disasm_operand_t operands[DISASM_MAX_OPERANDS];
+    
 } disasm_inst_t;
 
 /* 位操作宏 */
@@ -217,6 +377,190 @@ typedef struct {
 #define BIT(val, pos)           (((val) >> (pos)) & 1)
 #define SIGN_EXTEND(val, bits)  (((int64_t)(val) << (64 - (bits))) >> (64 - (bits)))
 
+/* 指令类型集合操作 */
+static inline void inst_type_set_clear(inst_type_set_t *set) {
+    for (size_t i = 0; i < sizeof(set->bits) / sizeof(set->bits[0]); i++) {
+        set->bits[i] = 0;
+    }
+}
+
+static inline void inst_type_set_add(inst_type_set_t *set, inst_type_t type) {
+    if ((unsigned)type < INST_TYPE_COUNT) {
+        set->bits[type / 64] |= 1ULL << (type % 64);
+    }
+}
+
+static inline void inst_type_set_remove(inst_type_set_t *set, inst_type_t type) {
+    if ((unsigned)type < INST_TYPE_COUNT) {
+        set->bits[type / 64] &= ~(1ULL << (type % 64));
+    }
+}
+
+static inline bool inst_type_set_contains(const inst_type_set_t *set, inst_type_t type) {
+    return (unsigned)type < INST_TYPE_COUNT &&
+           ((set->bits[type / 64] >> (type % 64)) & 1) != 0;
+}
+
+/* 扩展集合操作 */
+static inline void arm64_ext_set_clear(arm64_ext_set_t *set) {
+    for (size_t i = 0; i < sizeof(set->bits) / sizeof(set->bits[0]); i++) {
+        set->bits[i] = 0;
+    }
+}
+
+static inline void arm64_ext_set_add(arm64_ext_set_t *set, arm64_ext_t ext) {
+    if ((unsigned)ext < ARM64_EXT_COUNT) {
+        set->bits[ext / 64] |= 1ULL << (ext % 64);
+    }
+}
+
+static inline void arm64_ext_set_remove(arm64_ext_set_t *set, arm64_ext_t ext) {
+    if ((unsigned)ext < ARM64_EXT_COUNT) {
+        set->bits[ext / 64] &= ~(1ULL << (ext % 64));
+    }
+}
+
+static inline bool arm64_ext_set_contains(const arm64_ext_set_t *set, arm64_ext_t ext) {
+    return (unsigned)ext < ARM64_EXT_COUNT &&
+           ((set->bits[ext / 64] >> (ext % 64)) & 1) != 0;
+}
+
+/* ========== 指令属性 ========== */
+
+/* 指令属性位（inst_prop_table 由 gen_inst_props.py 根据 isa_aarch64.json 生成） */
+#define INST_PROP_MEM_READ      (1u << 0)   // 读内存
+#define INST_PROP_MEM_WRITE     (1u << 1)   // 写内存
+#define INST_PROP_BRANCH        (1u << 2)   // 改变控制流
+#define INST_PROP_CONDITIONAL   (1u << 3)   // 条件分支
+#define INST_PROP_CALL          (1u << 4)   // 函数调用（写入LR）
+#define INST_PROP_RETURN        (1u << 5)   // 函数/异常返回
+#define INST_PROP_INDIRECT      (1u << 6)   // 分支目标来自寄存器
+#define INST_PROP_SETS_FLAGS    (1u << 7)   // 写NZCV标志位
+#define INST_PROP_READS_FLAGS   (1u << 8)   // 读NZCV标志位
+#define INST_PROP_BARRIER       (1u << 9)   // 内存/指令屏障
+#define INST_PROP_ATOMIC        (1u << 10)  // 单条指令完成的读-改-写原子操作
+#define INST_PROP_EXCLUSIVE     (1u << 11)  // 独占访问（LDXR/STXR系列）
+#define INST_PROP_ACQUIRE       (1u << 12)  // 获取语义
+#define INST_PROP_RELEASE       (1u << 13)  // 释放语义
+#define INST_PROP_PRIVILEGED    (1u << 14)  // 可能需要EL1及以上特权级
+#define INST_PROP_EXCEPTION     (1u << 15)  // 产生同步异常（SVC/HVC/SMC）
+#define INST_PROP_SYSTEM        (1u << 16)  // 系统指令
+#define INST_PROP_FP_SIMD       (1u << 17)  // 使用浮点/SIMD寄存器
+
+#define INST_PROP_MEM           (INST_PROP_MEM_READ | INST_PROP_MEM_WRITE)
+
+extern const uint32_t inst_prop_table[INST_TYPE_COUNT];
+extern const uint8_t inst_ext_table[INST_TYPE_COUNT];
+extern const char *const arm64_ext_names[ARM64_EXT_COUNT];
+extern const char *const inst_type_names[INST_TYPE_COUNT];
+extern const uint16_t arm64_ext_buckets[ARM64_EXT_BUCKETS + 1];
+extern const arm64_ext_pattern_t arm64_ext_patterns[ARM64_EXT_PATTERNS];
+extern const uint8_t arm64_ext_pattern_exts[ARM64_EXT_PATTERNS];
+
+/**
+ * 按指令类型查询属性位（O(1)，不含实例级信息）
+ */
+static inline uint32_t inst_type_props(inst_type_t type) {
+    return ((unsigned)type < INST_TYPE_COUNT) ? inst_prop_table[type] : 0;
+}
+
+/* 访问者回调每批最多收到的指令数量（批缓冲区位于栈上，独立环境中减小以限制栈用量） */
+#ifndef DISASM_VISIT_BATCH
+#ifdef ARM64_DISASM_FREESTANDING
+#define DISASM_VISIT_BATCH 4
+#else
+#define DISASM_VISIT_BATCH 32
+#endif
+#endif
+
+/**
+ * 访问者回调
+ * @param insts 本批反汇编结果（位于栈上缓冲区，仅在回调期间有效）
+ * @param count 本批指令数量（1 ~ DISASM_VISIT_BATCH）
+ * @param ctx 调用者上下文
+ * @return true继续扫描，false提前停止
+ */
+typedef bool (*disasm_visit_func_t)(const disasm_inst_t *insts, size_t count, void *ctx);
+
+/* 编码往返校验结果 */
+typedef enum {
+    ENCODE_ROUNDTRIP_EXACT,         // 重新编码得到完全相同的指令字
+    ENCODE_ROUNDTRIP_EQUIVALENT,    // 指令字只在架构规定忽略（或应为1）的字段上不同，重新解码结果相同
+    ENCODE_ROUNDTRIP_MISMATCH,      // 重新编码的结果与原指令不一致
+    ENCODE_ROUNDTRIP_UNSUPPORTED,   // 能解码但编码器不支持该形式
+    ENCODE_ROUNDTRIP_UNDECODED,     // 原指令无法解码
+    ENCODE_ROUNDTRIP_OVER_ACCEPT    // 重新解码结果相同，但不同的位不属于可忽略字段：解码器接受了不该接受的编码
+} encode_roundtrip_t;
+
+/* 单条指令重定位后最多占用的指令字数量（含64位字面量） */
+#define ARM64_RELOC_MAX_WORDS 5
+
+/* 代码重定位结果 */
+typedef enum {
+    ARM64_RELOC_OK,             // 全部重定位成功
+    ARM64_RELOC_NO_SPACE,       // 输出缓冲区不足
+    ARM64_RELOC_FAILED          // 某条指令无法重新编码
+} arm64_reloc_status_t;
+
+/* 批量重定位的单个位置 */
+typedef struct {
+    uint32_t raw;                           // 原指令字
+    uint64_t old_pc;                        // 原地址
+    uint64_t new_pc;                        // 新地址
+    uint8_t size;                           // 输出：words 中的指令字数量（0表示失败）
+    uint32_t words[ARM64_RELOC_MAX_WORDS];  // 输出：重定位后的指令序列
+} arm64_reloc_site_t;
+
+/* JIT代码校验：快速分类索引大小（按指令位[31:21]索引） */
+#define ARM64_VALIDATE_INDEX_SIZE       2048
+
+/* JIT代码校验策略标志 */
+#define ARM64_VALIDATE_ALLOW_INDIRECT       0x01    // 允许 BR/BLR/RET
+#define ARM64_VALIDATE_ALLOW_EXTERNAL_CALL  0x02    // 允许 BL 目标位于缓冲区外
+#define ARM64_VALIDATE_ALLOW_BRK            0x04    // 允许 BRK 断点
+
+/* JIT代码校验结果 */
+typedef enum {
+    ARM64_VALIDATE_OK,
+    ARM64_VALIDATE_UNDECODED,           // 无法识别的指令
+    ARM64_VALIDATE_FORBIDDEN,           // 系统调用、MSR、SYS、ERET等始终禁止的指令
+    ARM64_VALIDATE_TYPE_DENIED,         // 指令类型不在白名单中
+    ARM64_VALIDATE_BRANCH_TARGET,       // 直接分支目标超出缓冲区
+    ARM64_VALIDATE_INDIRECT_BRANCH,     // 策略不允许间接分支
+    ARM64_VALIDATE_RESERVED_REG         // 写入了保留寄存器
+} arm64_validate_result_t;
+
+/* JIT代码校验策略（修改 allowed 后需调用 arm64_validate_policy_compile） */
+typedef struct {
+    inst_type_set_t allowed;            // 允许的指令类型
+    uint32_t reserved_regs;             // 禁止写入的通用寄存器，bit n 为 Xn/Wn，bit 31 为 SP
+    uint32_t flags;                     // ARM64_VALIDATE_ALLOW_*
+    uint16_t fast_index[ARM64_VALIDATE_INDEX_SIZE]; // 内部：快速分类索引
+} arm64_validate_policy_t;
+
+/* JIT代码校验报告 */
+typedef struct {
+    arm64_validate_result_t result;
+    size_t index;                       // 第一条违规指令的下标
+    uint32_t raw;                       // 该指令的原始编码
+} arm64_validate_report_t;
+
+/* 批量往返校验统计 */
+typedef struct {
+    size_t total;                   // 校验的指令数量
+    size_t exact;
+    size_t equivalent;
+    size_t mismatch;
+    size_t unsupported;
+    size_t undecoded;
+    size_t over_accept;
+    size_t first_mismatch;          // 第一条不一致指令的下标（mismatch为0时无意义）
+    uint32_t first_mismatch_raw;    // 该指令的原始编码
+    uint32_t first_mismatch_encoded;// 重新编码得到的指令字
+    size_t first_over_accept;       // 第一条被过度接受的指令的下标（over_accept为0时无意义）
+    uint32_t first_over_accept_raw;
+} encode_verify_stats_t;
+
 /* 函数原型 */
 
 /**
@@ -230,25 +574,43 @@ bool disassemble_arm64(uint32_t raw_inst, uint64_t address, disasm_inst_t *inst)
 
 /**
  * 将反汇编指令格式化为字符串
+ * 直接写入 buffer，不使用 stdio；超出 buffer_size 时截断
  * @param inst 反汇编指令结构
  * @param buffer 输出缓冲区
  * @param buffer_size 缓冲区大小
  */
 void format_instruction(const disasm_inst_t *inst, char *buffer, size_t buffer_size);
 
+/**
+ * 只格式化操作数部分，与 format_instruction 中助记符之后的文本相同
+ * （没有操作数时为空串）
+ */
+void format_instruction_operands(const disasm_inst_t *inst, char *buffer, size_t buffer_size);
+
+/**
+ * 按指定的寄存器命名方式格式化操作数部分，其余与 format_instruction_operands 相同
+ * @param names DISASM_REGS_NUMERIC 时 x29/x30 不使用 fp/lr 别名（与 GNU objdump 一致）
+ */
+void format_instruction_operands_names(const disasm_inst_t *inst, disasm_reg_names_t names,
+                                       char *buffer, size_t buffer_size);
+
 /**
  * 获取寄存器名称
  * @param reg_num 寄存器编号
  * @param reg_type 寄存器类型
- * @param buffer 输出缓冲区
+ * @param buffer 输出缓冲区（至少16字节）
  */
 void get_register_name(uint8_t reg_num, reg_type_t reg_type, char *buffer);
 
+/* 各组解码入口只在对应指令组编译进库时提供 */
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
 /**
  * 解析加载/存储指令
  */
 bool decode_load_store(uint32_t inst, uint64_t addr, disasm_inst_t *result);
+#endif
 
+#if ARM64_DISASM_HAS_DATA_PROC
 /**
  * 解析数据处理指令（立即数）
  */
@@ -258,16 +620,24 @@ bool decode_data_proc_imm(uint32_t inst, uint64_t addr, disasm_inst_t *result);
  * 解析数据处理指令（寄存器）
  */
 bool decode_data_proc_reg(uint32_t inst, uint64_t addr, disasm_inst_t *result);
+#endif
 
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
 /**
  * 解析分支指令
  */
 bool decode_branch(uint32_t inst, uint64_t addr, disasm_inst_t *result);
+#endif
 
+#if ARM64_DISASM_HAS_FP_SIMD
 /**
  * 解析浮点/SIMD指令
  */
 bool decode_fp_simd(uint32_t inst, uint64_t addr, disasm_inst_t *result);
+#endif
+
+#ifndef ARM64_DISASM_FREESTANDING
+/* 以下打印函数依赖 stdio，独立环境（ARM64_DISASM_FREESTANDING）中不提供 */
 
 /**
  * 批量反汇编
@@ -277,6 +647,73 @@ bool decode_fp_simd(uint32_t inst, uint64_t addr, disasm_inst_t *result);
  */
 void disassemble_block(const uint32_t *code, size_t count, uint64_t start_addr);
 
+/**
+ * 批量反汇编字节缓冲区（任意对齐）
+ * @param bytes 指令字节
+ * @param byte_count 字节数（必须是4的倍数）
+ * @param start_addr 起始地址
+ * @param endian 指令字节序
+ */
+void disassemble_block_bytes(const void *bytes, size_t byte_count,
+                             uint64_t start_addr, arm64_endian_t endian);
+
+/**
+ * 从内存中反汇编指定范围（小端，任意对齐）
+ * @param start_addr 内存起始地址，同时作为指令地址
+ * @param byte_count 字节数（必须是4的倍数）
+ */
+void disassemble_from_memory(const void *start_addr, size_t byte_count);
+#endif /* ARM64_DISASM_FREESTANDING */
+
+/**
+ * 将字节缓冲区转换为主机字节序的指令字数组
+ * 输入可以任意对齐；大端输入使用向量化的字节交换
+ * @param bytes 指令字节
+ * @param byte_count 字节数（不足4字节的尾部被忽略）
+ * @param endian 指令字节序
+ * @param words 输出的指令字数组（至少 byte_count / 4 项）
+ * @return 转换的指令字数量
+ */
+size_t arm64_load_words(const void *bytes, size_t byte_count,
+                        arm64_endian_t endian, uint32_t *words);
+
+/**
+ * 批量反汇编字节缓冲区到结果数组
+ * 无法解码的指令字同样占用一项，类型为INST_TYPE_UNKNOWN
+ * @param bytes 指令字节（任意对齐）
+ * @param byte_count 字节数
+ * @param start_addr 起始地址
+ * @param endian 指令字节序
+ * @param out 输出的反汇编结果数组
+ * @param max_count 结果数组容量
+ * @return 写入的结果数量
+ */
+size_t disassemble_buffer(const void *bytes, size_t byte_count, uint64_t start_addr,
+                          arm64_endian_t endian, disasm_inst_t *out, size_t max_count);
+
+/**
+ * 流式反汇编：按批调用访问者回调，不需要输出数组
+ * 解码结果直接写入栈上批缓冲区，未被过滤选中的指令不占用缓冲区也不触发回调
+ * @param code 指令数组
+ * @param count 指令数量
+ * @param start_addr 起始地址
+ * @param filter 类型过滤集合，NULL表示全部（包括INST_TYPE_UNKNOWN）
+ * @param visit 访问者回调
+ * @param ctx 传给回调的上下文
+ * @return 已扫描的指令数量（回调返回false时提前结束）
+ */
+size_t disassemble_visit(const uint32_t *code, size_t count, uint64_t start_addr,
+                         const inst_type_set_t *filter,
+                         disasm_visit_func_t visit, void *ctx);
+
+/**
+ * 流式反汇编字节缓冲区（任意对齐）
+ * 参数含义同disassemble_visit，endian指定指令字节序
+ */
+size_t disassemble_visit_bytes(const void *bytes, size_t byte_count, uint64_t start_addr,
+                               arm64_endian_t endian, const inst_type_set_t *filter,
+                               disasm_visit_func_t visit, void *ctx);
+
 /**
  * 获取分支指令的目标地址
  * @param inst 反汇编指令结构
@@ -293,7 +730,7 @@ bool get_branch_target(const disasm_inst_t *inst, uint64_t *target);
 bool is_branch_instruction(const disasm_inst_t *inst);
 
 /**
- * 判断指令是否为加载/存储指令
+ * 判断指令是否为加载/存储指令（包括原子、独占和SIMD加载/存储）
  * @param inst 反汇编指令结构
  * @return true如果是加载/存储指令
  */
@@ -317,6 +754,206 @@ void get_used_registers(const disasm_inst_t *inst, uint8_t *regs,
  */
 bool get_immediate_value(const disasm_inst_t *inst, int64_t *value);
 
+/**
+ * 获取指令的属性位
+ * 在类型属性的基础上补充实例信息（标志位设置、获取/释放、FP/SIMD寄存器等）
+ * @param inst 反汇编指令结构
+ * @return INST_PROP_* 组合
+ */
+uint32_t get_inst_props(const disasm_inst_t *inst);
+
+/**
+ * 判断指令是否具有指定属性中的任意一个
+ * @param inst 反汇编指令结构
+ * @param mask INST_PROP_* 组合
+ */
+static inline bool inst_has_props(const disasm_inst_t *inst, uint32_t mask) {
+    return (get_inst_props(inst) & mask) != 0;
+}
+
+/**
+ * 获取指令所需的最低架构扩展
+ * 按编码查询（get_encoding_extension），编码模式未覆盖的已解码指令取其类型的扩展；
+ * 因此同一类型的不同形式可以不同（如 fadd h0 为 fp16，ldr q0 为 asimd），
+ * 未解码的指令（INST_TYPE_UNKNOWN）也按编码给出；HINT 空间的指令（bti、paciasp 等）
+ * 在不支持的 CPU 上按 NOP 执行，返回 ARM64_EXT_BASE
+ * @param inst 反汇编指令结构
+ * @return 扩展枚举，基础指令集返回 ARM64_EXT_BASE
+ */
+arm64_ext_t get_inst_extension(const disasm_inst_t *inst);
+
+/**
+ * 获取扩展名称
+ * @param ext 扩展枚举
+ * @return 小写扩展名，如 "lse"
+ */
+const char *get_extension_name(arm64_ext_t ext);
+
+/**
+ * 按编码获取所需的架构扩展，不需要先解码
+ * 使用 isa_aarch64.json 中各编码模式生成的分类表，解码器不支持的 SVE、点积等指令也能识别；
+ * 不属于任何已知扩展编码的字返回 ARM64_EXT_BASE；HINT 空间的指令返回其编码所属的扩展
+ * （如 paciasp 为 pauth），是否构成运行要求见 get_inst_extension
+ * @param raw 32位指令字
+ */
+arm64_ext_t get_encoding_extension(uint32_t raw);
+
+/**
+ * 按名称查找扩展（不区分大小写，如 "lse"、"sve2"）
+ * @return 找不到时返回 ARM64_EXT_COUNT
+ */
+arm64_ext_t find_extension(const char *name);
+
+/**
+ * 由扩展集合初始化目标配置（ARM64_EXT_BASE 总是包含在内）
+ */
+void arm64_target_init(arm64_target_t *target, const arm64_ext_set_t *exts);
+
+/**
+ * 解析目标配置，写法与 GCC/Clang 的 -march 相同：基线后接任意个 "+扩展" 或 "+no扩展"，
+ * 如 "armv8.2-a+dotprod+fp16"、"armv8.1-a+nolse"。基线为 armv8-a ~ armv8.9-a、
+ * armv9-a ~ armv9.4-a（按架构版本的必选扩展累加）或 "all"；扩展名为 get_extension_name
+ * 的名称，另接受 GCC 的常用别名（crc、rdma、rcpc、fp16fml、memtag、simd/fp、crypto 等）
+ * @return 名称无法识别时返回 false
+ */
+bool arm64_target_parse(arm64_target_t *target, const char *spec);
+
+/**
+ * 按目标配置反汇编单条指令：所需扩展（get_inst_extension）不在配置中的指令视为未定义，
+ * 返回 false，inst 与无法解码的指令相同（类型为 INST_TYPE_UNKNOWN）
+ * @param target arm64_target_init/arm64_target_parse 初始化的配置
+ */
+bool disassemble_arm64_target(const arm64_target_t *target, uint32_t raw_inst,
+                              uint64_t address, disasm_inst_t *inst);
+
+/**
+ * 获取指令类型名称
+ * @param type 指令类型
+ * @return 该类型的基本助记符，如 "ldr"；B.cond 为 "b"，无效类型为 "unknown"
+ */
+const char *get_inst_type_name(inst_type_t type);
+
+/**
+ * 判断指令是否为屏障指令（DMB/DSB/ISB）
+ */
+bool is_barrier_instruction(const disasm_inst_t *inst);
+
+/**
+ * 判断指令是否可能需要特权级执行
+ */
+bool is_privileged_instruction(const disasm_inst_t *inst);
+
+/**
+ * 判断指令是否为原子或独占内存访问
+ */
+bool is_atomic_instruction(const disasm_inst_t *inst);
+
+/**
+ * 将解码结果编码为32位指令字
+ * 使用解码器填写的字段（寄存器、imm、shift_amount、extend_type、cond、addr_mode等）；
+ * 逻辑立即数取自 OPERAND_IMM 操作数中的位掩码，MRS 的系统寄存器取自 OPERAND_SYSREG 操作数
+ * @param inst 反汇编指令结构（可以是修改过字段的解码结果）
+ * @param out 输出的指令字
+ * @return true成功，false该形式不支持或字段超出编码范围
+ */
+bool encode_arm64(const disasm_inst_t *inst, uint32_t *out);
+
+/**
+ * 单条指令往返校验：解码→编码→比较
+ * @param raw 原始指令编码
+ * @param address 指令地址
+ * @param encoded 输出重新编码的指令字（可为NULL）
+ * @return 校验结果
+ */
+encode_roundtrip_t encode_roundtrip(uint32_t raw, uint64_t address, uint32_t *encoded);
+
+/**
+ * 批量往返校验
+ * @param code 指令数组
+ * @param count 指令数量
+ * @param start_addr 起始地址
+ * @param stats 输出的统计结果
+ */
+void encode_verify_block(const uint32_t *code, size_t count, uint64_t start_addr,
+                         encode_verify_stats_t *stats);
+
+/**
+ * 快速判断指令字是否为PC相对指令（B/BL/B.cond/CBZ/CBNZ/TBZ/TBNZ/ADR/ADRP/LDR字面量）
+ * 只检查操作码位，不做完整解码
+ */
+bool arm64_is_pc_relative(uint32_t raw);
+
+/**
+ * 将单条指令从 old_pc 搬移到 new_pc
+ * PC相对指令按新地址重写，超出原编码范围时展开为等价序列（可能使用 x16 作为临时寄存器）：
+ *   B/BL        → ADRP+ADD+BR/BLR，或 LDR字面量+BR/BLR
+ *   B.cond/CBZ/TBZ 等 → 反条件分支跳过一段无条件跳转
+ *   ADR/ADRP    → ADRP+ADD，或从字面量加载地址
+ *   LDR字面量   → ADRP+LDR，或从字面量加载地址后再加载
+ * 其余指令原样复制
+ * @param raw 原指令字
+ * @param old_pc 原地址
+ * @param new_pc 新地址
+ * @param out 输出指令序列（至少 ARM64_RELOC_MAX_WORDS 项，可为NULL仅计算大小）
+ * @return 输出的指令字数量，失败返回0
+ */
+size_t arm64_relocate_inst(uint32_t raw, uint64_t old_pc, uint64_t new_pc, uint32_t *out);
+
+/**
+ * 重定位一段连续指令（如复制到跳板的函数序言）
+ * 每条指令的新地址随前面指令的展开顺延；目标位于被复制范围内的分支仍指向原地址
+ * @param code 原指令数组
+ * @param count 指令数量
+ * @param old_addr 原起始地址
+ * @param new_addr 新起始地址
+ * @param out 输出缓冲区
+ * @param capacity 输出缓冲区容量（指令字）
+ * @param out_count 输出的指令字数量（失败时为已写入的数量）
+ * @return 重定位结果
+ */
+arm64_reloc_status_t arm64_relocate_block(const uint32_t *code, size_t count,
+                                          uint64_t old_addr, uint64_t new_addr,
+                                          uint32_t *out, size_t capacity, size_t *out_count);
+
+/**
+ * 批量重定位相互独立的指令位置（插桩点等）
+ * @param sites 位置数组，结果写回各项的 size/words
+ * @param count 位置数量
+ * @return 所有位置输出的指令字总数
+ */
+size_t arm64_relocate_sites(arm64_reloc_site_t *sites, size_t count);
+
+/**
+ * 初始化默认校验策略：允许除系统寄存器访问和异常生成外的所有指令类型，
+ * 不保留寄存器，不允许间接分支和缓冲区外的调用
+ */
+void arm64_validate_policy_init(arm64_validate_policy_t *policy);
+
+/**
+ * 根据策略的白名单生成快速分类索引，修改 allowed 后调用
+ */
+void arm64_validate_policy_compile(arm64_validate_policy_t *policy);
+
+/**
+ * 单遍校验JIT输出：指令类型白名单、禁止的系统指令、直接分支目标在缓冲区内、
+ * 不写入保留寄存器；常见指令只按操作码位分类，不填写完整的解码结构
+ * @param code 指令数组
+ * @param count 指令数量
+ * @param policy 校验策略
+ * @param report 输出第一条违规指令（可为NULL）
+ * @return 校验结果，遇到第一条违规指令即返回
+ */
+arm64_validate_result_t arm64_validate(const uint32_t *code, size_t count,
+                                       const arm64_validate_policy_t *policy,
+                                       arm64_validate_report_t *report);
+
+/**
+ * 按快速分类表识别指令类型（不完整解码）
+ * @return true命中快速分类表，false需要完整解码
+ */
+bool arm64_fast_classify(uint32_t raw, inst_type_t *type);
+
+#ifndef ARM64_DISASM_FREESTANDING
 /**
  * 打印指令的详细信息
  * @param inst 反汇编指令结构
@@ -328,6 +965,10 @@ void print_instruction_details(const disasm_inst_t *inst);
  * @param inst 反汇编指令结构
  */
 void print_instruction(const disasm_inst_t *inst);
+#endif /* ARM64_DISASM_FREESTANDING */
 
-#endif /* ARM64_DISASM_H */
+#ifdef __cplusplus
+}
+#endif
 
+#endif /* ARM64_DISASM_H */
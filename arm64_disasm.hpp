@@ -0,0 +1,295 @@
+/**
+ * ARM64反汇编器 - C++ 接口（仅头文件，需要 C++20）
+ * - arm64::classify / arm64::branch_offset / arm64::decode：可在编译期求值，用于检查已知编码表
+ * - arm64::code_view：代码缓冲区视图，范围 for 迭代时按需解码
+ * - arm64::fields：按调用者需要的字段选择模板特化，不需要的解码和格式化在编译期去掉
+ * 完整解码直接使用 C 接口，instruction::c_inst() 返回的 disasm_inst_t 可传给任何 C 函数
+ */
+
+#ifndef ARM64_DISASM_HPP
+#define ARM64_DISASM_HPP
+
+#include "arm64_disasm.h"
+#include "arm64_fast_class.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace arm64 {
+
+/* ========== 字段选择 ========== */
+
+/* 调用者需要的字段（可组合），决定每条指令做多少工作 */
+enum class fields : unsigned {
+    type    = 1u << 0,  // 指令类型：快速分类表命中时不做完整解码
+    branch  = 1u << 1,  // 直接分支目标：只从编码计算
+    decoded = 1u << 2,  // 完整的 disasm_inst_t（寄存器、立即数、操作数列表）
+    text    = 1u << 3,  // 格式化文本（隐含 decoded）
+    all     = type | branch | decoded | text,
+};
+
+constexpr fields operator|(fields a, fields b) noexcept {
+    return static_cast<fields>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+}
+
+/* set 是否包含 f 中的全部字段 */
+constexpr bool has(fields set, fields f) noexcept {
+    return (static_cast<unsigned>(set) & static_cast<unsigned>(f)) == static_cast<unsigned>(f);
+}
+
+/* ========== 编译期分类 ========== */
+
+namespace detail {
+
+constexpr uint32_t bits(uint32_t raw, unsigned lo, unsigned hi) noexcept {
+    return (raw >> lo) & ((1u << (hi - lo + 1)) - 1);
+}
+
+constexpr int64_t sign_extend(uint32_t value, unsigned width) noexcept {
+    uint32_t sign = 1u << (width - 1);
+    return static_cast<int64_t>(value ^ sign) - static_cast<int64_t>(sign);
+}
+
+constexpr const fast_class_t *find_fast(uint32_t raw) noexcept {
+    for (const fast_class_t &entry : fast_class_table) {
+        if ((raw & entry.mask) == entry.value) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace detail
+
+/**
+ * 分类单条指令，可在编译期求值
+ * 先查快速分类表（与 arm64_fast_classify 相同，覆盖分支、常见数据处理和加载/存储）；
+ * 未命中时编译期返回 INST_TYPE_UNKNOWN，运行期回退到完整解码
+ */
+constexpr inst_type_t classify(uint32_t raw) noexcept {
+    if (const fast_class_t *entry = detail::find_fast(raw)) {
+        return static_cast<inst_type_t>(entry->type);
+    }
+    if (std::is_constant_evaluated()) {
+        return INST_TYPE_UNKNOWN;
+    }
+    disasm_inst_t inst;
+    return disassemble_arm64(raw, 0, &inst) ? inst.type : INST_TYPE_UNKNOWN;
+}
+
+/**
+ * 直接分支（B/BL/B.cond/CBZ/CBNZ/TBZ/TBNZ）相对本指令的字节偏移，可在编译期求值
+ * 间接分支和非分支指令返回 std::nullopt
+ */
+constexpr std::optional<int64_t> branch_offset(uint32_t raw) noexcept {
+    const fast_class_t *entry = detail::find_fast(raw);
+    if (!entry) {
+        return std::nullopt;
+    }
+    switch (entry->branch) {
+        case VB_IMM26: return detail::sign_extend(detail::bits(raw, 0, 25), 26) * 4;
+        case VB_IMM19: return detail::sign_extend(detail::bits(raw, 5, 23), 19) * 4;
+        case VB_IMM14: return detail::sign_extend(detail::bits(raw, 5, 18), 14) * 4;
+        default:       return std::nullopt;
+    }
+}
+
+/* ========== 解码结果 ========== */
+
+namespace detail {
+struct none {};
+}  // namespace detail
+
+/**
+ * 单条指令的解码结果，只保存 F 中需要的字段
+ * F 不含 decoded/text 时不调用完整解码，整个对象可在编译期构造
+ */
+template <fields F>
+class instruction {
+public:
+    static constexpr bool needs_full = has(F, fields::decoded) || has(F, fields::text);
+    static constexpr size_t text_capacity = 128;
+
+    constexpr instruction() noexcept = default;
+
+    constexpr instruction(uint32_t raw, uint64_t address) noexcept {
+        load(raw, address);
+    }
+
+    constexpr uint32_t raw() const noexcept { return raw_; }
+    constexpr uint64_t address() const noexcept { return address_; }
+
+    /* 是否识别（快速分类命中或完整解码成功） */
+    constexpr bool valid() const noexcept { return type_ != INST_TYPE_UNKNOWN; }
+
+    constexpr inst_type_t type() const noexcept
+        requires(has(F, fields::type) || needs_full) {
+        return type_;
+    }
+
+    /* 直接分支的目标地址 */
+    constexpr std::optional<uint64_t> branch_target() const noexcept
+        requires(has(F, fields::branch)) {
+        std::optional<int64_t> offset = branch_offset(raw_);
+        if (!offset) {
+            return std::nullopt;
+        }
+        return address_ + static_cast<uint64_t>(*offset);
+    }
+
+    /* 完整解码结构，可直接传给 C 接口 */
+    const disasm_inst_t &c_inst() const noexcept
+        requires(needs_full) {
+        return inst_;
+    }
+
+    const char *text() const noexcept
+        requires(has(F, fields::text)) {
+        return text_.data();
+    }
+
+    /* 就地重新解码（迭代器复用同一个对象，避免逐条复制） */
+    constexpr void load(uint32_t raw, uint64_t address) noexcept {
+        raw_ = raw;
+        address_ = address;
+        if constexpr (needs_full) {
+            disassemble_arm64(raw, address, &inst_);
+            type_ = inst_.type;
+            if constexpr (has(F, fields::text)) {
+                format_instruction(&inst_, text_.data(), text_.size());
+            }
+        } else if constexpr (has(F, fields::type)) {
+            type_ = classify(raw);
+        } else {
+            /* 只需要分支目标：valid() 表示是否为直接分支 */
+            type_ = branch_offset(raw) ? static_cast<inst_type_t>(detail::find_fast(raw)->type)
+                                       : INST_TYPE_UNKNOWN;
+        }
+    }
+
+private:
+    uint32_t raw_ = 0;
+    uint64_t address_ = 0;
+    inst_type_t type_ = INST_TYPE_UNKNOWN;
+    [[no_unique_address]] std::conditional_t<needs_full, disasm_inst_t, detail::none> inst_{};
+    [[no_unique_address]] std::conditional_t<has(F, fields::text),
+        std::array<char, text_capacity>, detail::none> text_{};
+};
+
+/**
+ * 解码单条指令
+ * F 不含 decoded/text 时可在编译期求值：
+ *   static_assert(arm64::decode<arm64::fields::type>(0xD65F03C0).type() == INST_TYPE_RET);
+ */
+template <fields F = fields::decoded>
+constexpr instruction<F> decode(uint32_t raw, uint64_t address = 0) noexcept {
+    return instruction<F>(raw, address);
+}
+
+/* ========== 代码缓冲区视图 ========== */
+
+/**
+ * 代码缓冲区的只读视图，迭代器每前进一步才解码下一条指令
+ * 迭代器内保存一个 instruction<F> 并就地更新，解引用返回其引用，不逐条复制；
+ * 迭代器为单遍（input_iterator），与 std::ranges 算法兼容
+ */
+template <fields F = fields::decoded>
+class code_view : public std::ranges::view_interface<code_view<F>> {
+public:
+    class iterator {
+    public:
+        using value_type = instruction<F>;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::input_iterator_tag;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr const instruction<F> &operator*() const noexcept {
+            return current_;
+        }
+
+        constexpr const instruction<F> *operator->() const noexcept {
+            return &**this;
+        }
+
+        constexpr iterator &operator++() noexcept {
+            index_++;
+            load();
+            return *this;
+        }
+
+        constexpr void operator++(int) noexcept {
+            ++*this;
+        }
+
+        constexpr bool operator==(std::default_sentinel_t) const noexcept {
+            return index_ >= view_->count_;
+        }
+
+        /* 当前指令在缓冲区中的序号 */
+        constexpr size_t index() const noexcept { return index_; }
+
+    private:
+        friend class code_view;
+
+        constexpr explicit iterator(const code_view *view) noexcept : view_(view) {
+            load();
+        }
+
+        /* 解码当前位置的指令（到达末尾时不做任何事） */
+        constexpr void load() noexcept {
+            if (index_ < view_->count_) {
+                current_.load(view_->word(index_), view_->base_ + index_ * 4);
+            }
+        }
+
+        const code_view *view_ = nullptr;
+        size_t index_ = 0;
+        instruction<F> current_{};
+    };
+
+    constexpr code_view() noexcept = default;
+
+    /* 主机字节序的指令字数组 */
+    constexpr code_view(std::span<const uint32_t> words, uint64_t base) noexcept
+        : words_(words.data()), count_(words.size()), base_(base) {}
+
+    /* 字节缓冲区，末尾不足4字节的部分忽略 */
+    constexpr code_view(std::span<const uint8_t> bytes, uint64_t base,
+                        arm64_endian_t endian = ARM64_ENDIAN_LITTLE) noexcept
+        : bytes_(bytes.data()), count_(bytes.size() / 4), base_(base), endian_(endian) {}
+
+    constexpr iterator begin() const noexcept { return iterator(this); }
+    constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+    constexpr size_t size() const noexcept { return count_; }
+    constexpr uint64_t base_address() const noexcept { return base_; }
+
+    /* 按序号取原始指令字 */
+    constexpr uint32_t word(size_t index) const noexcept {
+        if (words_) {
+            return words_[index];
+        }
+        const uint8_t *p = bytes_ + index * 4;
+        if (endian_ == ARM64_ENDIAN_BIG) {
+            return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+        }
+        return (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[1] << 8 | p[0];
+    }
+
+private:
+    const uint32_t *words_ = nullptr;
+    const uint8_t *bytes_ = nullptr;
+    size_t count_ = 0;
+    uint64_t base_ = 0;
+    arm64_endian_t endian_ = ARM64_ENDIAN_LITTLE;
+};
+
+}  // namespace arm64
+
+#endif /* ARM64_DISASM_HPP */
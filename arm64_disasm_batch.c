@@ -0,0 +1,262 @@
+/**
+ * ARM64反汇编器 - 字节缓冲区输入与批量解码
+ * 支持任意对齐的输入和大/小端指令字，字节交换使用向量化内核
+ */
+
+#include "arm64_disasm.h"
+#include "arm64_strbuf.h"
+
+/* 独立环境（内核、裸机）通常不允许使用向量寄存器，只使用标量路径 */
+#if defined(ARM64_DISASM_FREESTANDING)
+#elif defined(__SSSE3__)
+    #include <tmmintrin.h>
+    #define ARM64_BSWAP_SSSE3 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ARM64_BSWAP_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>
+    #define ARM64_BSWAP_NEON 1
+#endif
+
+/* 每批转换的指令字数量（栈上缓冲区） */
+#define BATCH_WORDS 64
+
+/* ========== 主机字节序 ========== */
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && \
+    (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define HOST_IS_BIG_ENDIAN 1
+#else
+    #define HOST_IS_BIG_ENDIAN 0
+#endif
+
+static inline uint32_t bswap32(uint32_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(v);
+#else
+    return (v >> 24) | ((v >> 8) & 0x0000FF00u) |
+           ((v << 8) & 0x00FF0000u) | (v << 24);
+#endif
+}
+
+/* ========== 字节交换内核 ========== */
+
+/**
+ * 复制并交换每个32位字的字节序
+ * 每次处理16字节，尾部使用标量路径
+ */
+static void copy_swap_words(const uint8_t *src, uint32_t *dst, size_t count) {
+    size_t i = 0;
+
+#if defined(ARM64_BSWAP_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                          11, 10, 9, 8, 15, 14, 13, 12);
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_shuffle_epi8(v, shuffle));
+    }
+#elif defined(ARM64_BSWAP_SSE2)
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i * 4));
+        /* 先交换16位内的字节，再交换32位内的两个半字 */
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        v = _mm_shufflelo_epi16(v, 0xB1);
+        v = _mm_shufflehi_epi16(v, 0xB1);
+        _mm_storeu_si128((__m128i *)(dst + i), v);
+    }
+#elif defined(ARM64_BSWAP_NEON)
+    for (; i + 4 <= count; i += 4) {
+        uint8x16_t v = vld1q_u8(src + i * 4);
+        vst1q_u32(dst + i, vreinterpretq_u32_u8(vrev32q_u8(v)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        uint32_t w;
+        ARM64_MEMCPY(&w, src + i * 4, sizeof(w));
+        dst[i] = bswap32(w);
+    }
+}
+
+/**
+ * 将字节缓冲区转换为主机字节序的指令字数组
+ */
+size_t arm64_load_words(const void *bytes, size_t byte_count,
+                        arm64_endian_t endian, uint32_t *words) {
+    if (!bytes || !words) {
+        return 0;
+    }
+
+    size_t count = byte_count / 4;
+    bool need_swap = (endian == ARM64_ENDIAN_BIG) != (HOST_IS_BIG_ENDIAN != 0);
+
+    if (need_swap) {
+        copy_swap_words((const uint8_t *)bytes, words, count);
+    } else {
+        /* 字节序一致时只需处理对齐问题 */
+        ARM64_MEMCPY(words, bytes, count * 4);
+    }
+
+    return count;
+}
+
+/* ========== 批量解码 ========== */
+
+/**
+ * 批量反汇编字节缓冲区到结果数组
+ */
+size_t disassemble_buffer(const void *bytes, size_t byte_count, uint64_t start_addr,
+                          arm64_endian_t endian, disasm_inst_t *out, size_t max_count) {
+    if (!bytes || !out) {
+        return 0;
+    }
+
+    const uint8_t *src = (const uint8_t *)bytes;
+    size_t total = byte_count / 4;
+    if (total > max_count) {
+        total = max_count;
+    }
+
+    uint32_t words[BATCH_WORDS];
+    size_t done = 0;
+
+    while (done < total) {
+        size_t n = total - done;
+        if (n > BATCH_WORDS) {
+            n = BATCH_WORDS;
+        }
+
+        arm64_load_words(src + done * 4, n * 4, endian, words);
+
+        for (size_t i = 0; i < n; i++) {
+            disassemble_arm64(words[i], start_addr + (done + i) * 4, &out[done + i]);
+        }
+        done += n;
+    }
+
+    return done;
+}
+
+/* ========== 流式访问者 ========== */
+
+/* 访问者扫描状态（位于调用者栈上） */
+typedef struct {
+    disasm_inst_t batch[DISASM_VISIT_BATCH];
+    size_t fill;
+    const inst_type_set_t *filter;
+    disasm_visit_func_t visit;
+    void *ctx;
+    bool stopped;
+} visit_state_t;
+
+/**
+ * 将已缓冲的指令交给回调
+ */
+static void visit_flush(visit_state_t *state) {
+    if (state->fill > 0 && !state->stopped) {
+        if (!state->visit(state->batch, state->fill, state->ctx)) {
+            state->stopped = true;
+        }
+    }
+    state->fill = 0;
+}
+
+/**
+ * 过滤前的预筛：快速分类表命中且类型不在过滤集合中的指令字不必完整解码。
+ * 快速表中的屏障指令解码器尚不支持，按未知指令输出，过滤集合包含 UNKNOWN 时仍需解码
+ */
+static bool prescreen_rejects(const inst_type_set_t *filter, uint32_t raw) {
+    inst_type_t type;
+    if (!arm64_fast_classify(raw, &type) || inst_type_set_contains(filter, type)) {
+        return false;
+    }
+    return !(inst_type_props(type) & INST_PROP_BARRIER) ||
+           !inst_type_set_contains(filter, INST_TYPE_UNKNOWN);
+}
+
+/**
+ * 解码一段指令字，直接写入批缓冲区的下一个空位
+ * 未被过滤选中的结果会被下一条指令覆盖，不产生额外复制
+ * @return 本段实际扫描的指令数量
+ */
+static size_t visit_words(visit_state_t *state, const uint32_t *words,
+                          size_t count, uint64_t start_addr) {
+    for (size_t i = 0; i < count; i++) {
+        if (state->filter && prescreen_rejects(state->filter, words[i])) {
+            continue;
+        }
+        disasm_inst_t *slot = &state->batch[state->fill];
+        disassemble_arm64(words[i], start_addr + i * 4, slot);
+        
+        if (state->filter && !inst_type_set_contains(state->filter, slot->type)) {
+            continue;
+        }
+        
+        if (++state->fill == DISASM_VISIT_BATCH) {
+            visit_flush(state);
+            if (state->stopped) {
+                return i + 1;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * 流式反汇编：按批调用访问者回调
+ */
+size_t disassemble_visit(const uint32_t *code, size_t count, uint64_t start_addr,
+                         const inst_type_set_t *filter,
+                         disasm_visit_func_t visit, void *ctx) {
+    if (!code || !visit) {
+        return 0;
+    }
+    
+    visit_state_t state;
+    state.fill = 0;
+    state.filter = filter;
+    state.visit = visit;
+    state.ctx = ctx;
+    state.stopped = false;
+    
+    size_t scanned = visit_words(&state, code, count, start_addr);
+    visit_flush(&state);
+    return scanned;
+}
+
+/**
+ * 流式反汇编字节缓冲区（任意对齐）
+ */
+size_t disassemble_visit_bytes(const void *bytes, size_t byte_count, uint64_t start_addr,
+                               arm64_endian_t endian, const inst_type_set_t *filter,
+                               disasm_visit_func_t visit, void *ctx) {
+    if (!bytes || !visit) {
+        return 0;
+    }
+    
+    visit_state_t state;
+    state.fill = 0;
+    state.filter = filter;
+    state.visit = visit;
+    state.ctx = ctx;
+    state.stopped = false;
+    
+    const uint8_t *src = (const uint8_t *)bytes;
+    size_t total = byte_count / 4;
+    uint32_t words[BATCH_WORDS];
+    size_t done = 0;
+    
+    while (done < total && !state.stopped) {
+        size_t n = total - done;
+        if (n > BATCH_WORDS) {
+            n = BATCH_WORDS;
+        }
+        
+        arm64_load_words(src + done * 4, n * 4, endian, words);
+        done += visit_words(&state, words, n, start_addr + done * 4);
+    }
+    
+    visit_flush(&state);
+    return done;
+}
@@ -5,11 +5,14 @@
 
 #include "arm64_disasm.h"
 #include "arm64_decode_table.h"
-#include <stdio.h>
-#include <string.h>
+
+/* 分支（ARM64_DISASM_NO_BRANCH）和系统指令（ARM64_DISASM_NO_SYSTEM）可分别去掉 */
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
 
 /* ========== 分支指令解码函数 ========== */
 
+#if ARM64_DISASM_HAS_BRANCH
+
 /**
  * 解析无条件分支（立即数）- B/BL
  * 编码：op|00101|imm26
@@ -30,6 +33,7 @@ static bool decode_uncond_branch_imm(uint32_t inst, uint64_t addr, disasm_inst_t
         result->type = INST_TYPE_BL;
     }
     
+    add_imm_operand(result, (int64_t)(addr + result->imm));
     return true;
 }
 
@@ -44,7 +48,8 @@ static bool decode_cond_branch_imm(uint32_t inst, uint64_t addr, disasm_inst_t *
     
     result->imm = SIGN_EXTEND(imm19, 19) << 2;
     result->has_imm = true;
-    result->type = INST_TYPE_B;
+    result->type = INST_TYPE_BCOND;
+    result->cond = cond;
     
     static const char *cond_names[] = {
         "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
@@ -52,11 +57,16 @@ static bool decode_cond_branch_imm(uint32_t inst, uint64_t addr, disasm_inst_t *
     };
     
     if (cond < 16) {
-        snprintf(result->mnemonic, sizeof(result->mnemonic), "b.%s", cond_names[cond]);
+        strbuf_t sb;
+        strbuf_init(&sb, result->mnemonic, sizeof(result->mnemonic));
+        strbuf_puts(&sb, "b.");
+        strbuf_puts(&sb, cond_names[cond]);
     } else {
         return false;
     }
     
+    /* 条件码体现在助记符中，显式操作数只有目标地址 */
+    add_imm_operand(result, (int64_t)(addr + result->imm));
     return true;
 }
 
@@ -85,6 +95,8 @@ static bool decode_compare_branch(uint32_t inst, uint64_t addr, disasm_inst_t *r
         result->type = INST_TYPE_CBNZ;
     }
     
+    add_reg_operand(result, rt, result->rd_type, OPERAND_ACCESS_READ);
+    add_imm_operand(result, (int64_t)(addr + result->imm));
     return true;
 }
 
@@ -117,6 +129,9 @@ static bool decode_test_branch(uint32_t inst, uint64_t addr, disasm_inst_t *resu
         result->type = INST_TYPE_TBNZ;
     }
     
+    add_reg_operand(result, rt, result->rd_type, OPERAND_ACCESS_READ);
+    add_imm_operand(result, bit_pos);
+    add_imm_operand(result, (int64_t)(addr + result->imm));
     return true;
 }
 
@@ -146,6 +161,7 @@ static bool decode_uncond_branch_reg(uint32_t inst, uint64_t addr, disasm_inst_t
             if (op3 == 0) {
                 SAFE_STRCPY(result->mnemonic, "br");
                 result->type = INST_TYPE_BR;
+                add_reg_operand(result, rn, REG_TYPE_X, OPERAND_ACCESS_READ);
                 return true;
             }
             break;
@@ -153,6 +169,7 @@ static bool decode_uncond_branch_reg(uint32_t inst, uint64_t addr, disasm_inst_t
             if (op3 == 0) {
                 SAFE_STRCPY(result->mnemonic, "blr");
                 result->type = INST_TYPE_BLR;
+                add_reg_operand(result, rn, REG_TYPE_X, OPERAND_ACCESS_READ);
                 return true;
             }
             break;
@@ -160,6 +177,7 @@ static bool decode_uncond_branch_reg(uint32_t inst, uint64_t addr, disasm_inst_t
             if (op3 == 0) {
                 SAFE_STRCPY(result->mnemonic, "ret");
                 result->type = INST_TYPE_RET;
+                add_reg_operand(result, rn, REG_TYPE_X, OPERAND_ACCESS_READ);
                 return true;
             }
             break;
@@ -182,6 +200,9 @@ static bool decode_uncond_branch_reg(uint32_t inst, uint64_t addr, disasm_inst_t
     return false;
 }
 
+#endif /* ARM64_DISASM_HAS_BRANCH */
+
+#if ARM64_DISASM_HAS_SYSTEM
 /**
  * 解析系统指令 - NOP/HINT/MRS等
  * 编码：1101010100|L|op0|op1|CRn|CRm|op2|Rt
@@ -218,39 +239,55 @@ static bool decode_system(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
         result->has_imm = false;
         SAFE_STRCPY(result->mnemonic, "mrs");
         result->type = INST_TYPE_MRS;
+        add_reg_operand(result, rt, REG_TYPE_X, OPERAND_ACCESS_WRITE);
+        add_sysreg_operand(result, (uint16_t)BITS(inst, 5, 20), OPERAND_ACCESS_READ);
         return true;
     }
     
     return false;
 }
+#endif /* ARM64_DISASM_HAS_SYSTEM */
 
 /* ========== 分支指令解码表 ========== */
 
-const decode_entry_t branch_decode_table[] = {
-    /* 无条件分支（立即数）- B/BL: bits[30:26] = 00101 */
-    DECODE_ENTRY(0x7C000000, 0x14000000, decode_uncond_branch_imm),
-    
-    /* 比较并分支 - CBZ/CBNZ: bits[30:25] = 011010 */
-    DECODE_ENTRY(0x7E000000, 0x34000000, decode_compare_branch),
-    
-    /* 测试位并分支 - TBZ/TBNZ: bits[30:25] = 011011 */
-    DECODE_ENTRY(0x7E000000, 0x36000000, decode_test_branch),
-    
-    /* 条件分支 - B.cond: bits[31:25] = 0101010, bit[4] = 0 */
-    DECODE_ENTRY(0xFF000010, 0x54000000, decode_cond_branch_imm),
-    
-    /* 无条件分支（寄存器）- BR/BLR/RET: bits[31:25] = 1101011 */
-    DECODE_ENTRY(0xFE000000, 0xD6000000, decode_uncond_branch_reg),
-    
-    /* 系统指令 - NOP/MRS等: bits[31:22] = 1101010100 */
-    DECODE_ENTRY(0xFFC00000, 0xD5000000, decode_system),
-};
+#if ARM64_DISASM_HAS_BRANCH
+#define BRANCH_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)              \
+    /* 无条件分支（立即数）- B/BL: bits[30:26] = 00101 */                               \
+    DECODE_ENTRY(0x7C000000, 0x14000000, decode_uncond_branch_imm)                      \
+                                                                                        \
+    /* 比较并分支 - CBZ/CBNZ: bits[30:25] = 011010 */                                   \
+    DECODE_ENTRY(0x7E000000, 0x34000000, decode_compare_branch)                         \
+                                                                                        \
+    /* 测试位并分支 - TBZ/TBNZ: bits[30:25] = 011011 */                                 \
+    DECODE_ENTRY(0x7E000000, 0x36000000, decode_test_branch)                            \
+                                                                                        \
+    /* 条件分支 - B.cond: bits[31:25] = 0101010, bit[4] = 0 */                          \
+    DECODE_ENTRY(0xFF000010, 0x54000000, decode_cond_branch_imm)                        \
+                                                                                        \
+    /* 无条件分支（寄存器）- BR/BLR/RET: bits[31:25] = 1101011 */                       \
+    DECODE_ENTRY(0xFE000000, 0xD6000000, decode_uncond_branch_reg)
+#else
+#define BRANCH_ENTRIES DECODE_NO_ENTRIES
+#endif
+
+#if ARM64_DISASM_HAS_SYSTEM
+#define SYSTEM_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)              \
+    /* 系统指令 - NOP/MRS等: bits[31:22] = 1101010100 */                                \
+    DECODE_ENTRY(0xFFC00000, 0xD5000000, decode_system)
+#else
+#define SYSTEM_ENTRIES DECODE_NO_ENTRIES
+#endif
 
-const size_t branch_decode_table_size = ARRAY_SIZE(branch_decode_table);
+#define BRANCH_DECODE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)       \
+    BRANCH_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)                  \
+    SYSTEM_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)
+
+DEFINE_DECODE_TABLE(branch_decode_table, BRANCH_DECODE_ENTRIES);
 
 /* ========== 主分支指令解析函数（表驱动） ========== */
 
 bool decode_branch(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    return decode_with_table(branch_decode_table, branch_decode_table_size,
-                            inst, addr, result);
+    return decode_with_table(&branch_decode_table, inst, addr, result);
 }
+
+#endif /* ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM */
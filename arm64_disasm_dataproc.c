@@ -5,10 +5,48 @@
 
 #include "arm64_disasm.h"
 #include "arm64_decode_table.h"
-#include <string.h>
+
+/* ARM64_DISASM_NO_DATA_PROC 时整个数据处理组不参与编译 */
+#if ARM64_DISASM_HAS_DATA_PROC
 
 /* ========== 数据处理（立即数）解码函数 ========== */
 
+/**
+ * 解码逻辑立即数的位掩码（DecodeBitMasks）
+ * @return 实际立即数值，保留编码返回0
+ */
+static uint64_t decode_bit_masks(uint8_t N, uint8_t imms, uint8_t immr, bool is_64bit) {
+    uint32_t combined = ((uint32_t)N << 6) | (~imms & 0x3F);
+    int len = -1;
+    
+    for (int i = 6; i >= 0; i--) {
+        if (combined & (1u << i)) {
+            len = i;
+            break;
+        }
+    }
+    if (len < 1 || (!is_64bit && N)) return 0;
+    
+    unsigned esize = 1u << len;
+    unsigned levels = esize - 1;
+    unsigned s = imms & levels;
+    unsigned r = immr & levels;
+    if (s == levels) return 0;
+    
+    /* s+1个连续的1，在元素内循环右移r位后复制到整个寄存器 */
+    uint64_t emask = (esize == 64) ? ~0ULL : ((1ULL << esize) - 1);
+    uint64_t welem = (1ULL << (s + 1)) - 1;
+    if (r != 0) {
+        welem = ((welem >> r) | (welem << (esize - r))) & emask;
+    }
+    
+    uint64_t mask = 0;
+    for (unsigned i = 0; i < 64; i += esize) {
+        mask |= welem << i;
+    }
+    return is_64bit ? mask : (mask & 0xFFFFFFFFULL);
+}
+
 /**
  * 解析PC相对地址 - ADR/ADRP
  * 编码：op|immlo|10000|immhi|Rd
@@ -37,6 +75,12 @@ static bool decode_pc_rel_addr(uint32_t inst, uint64_t addr, disasm_inst_t *resu
         result->type = INST_TYPE_ADRP;
     }
     
+    add_reg_operand(result, rd, REG_TYPE_X, OPERAND_ACCESS_WRITE);
+    if (op == 0) {
+        add_imm_operand(result, (int64_t)(addr + result->imm));
+    } else {
+        add_imm_operand(result, (int64_t)((addr & ~0xFFFULL) + result->imm));
+    }
     return true;
 }
 
@@ -71,13 +115,12 @@ static bool decode_add_sub_imm(uint32_t inst, uint64_t addr, disasm_inst_t *resu
         SAFE_STRCPY(result->mnemonic, S ? "adds" : "add");
         result->type = S ? INST_TYPE_ADDS : INST_TYPE_ADD;
         
-        /* MOV (to/from SP) */
-        if (!S && imm12 == 0 && shift == 0) {
+        /* MOV (to/from SP)：只有 Rd 或 Rn 是 SP 时才是别名，否则 objdump 仍显示 add #0x0 */
+        if (!S && imm12 == 0 && shift == 0 && (rd == 31 || rn == 31)) {
             SAFE_STRCPY(result->mnemonic, "mov");
             result->type = INST_TYPE_MOV;
             result->has_imm = false;
             result->rm = rn;
-            result->rm_type = result->rn_type;
         }
     } else {
         SAFE_STRCPY(result->mnemonic, S ? "subs" : "sub");
@@ -101,6 +144,22 @@ static bool decode_add_sub_imm(uint32_t inst, uint64_t addr, disasm_inst_t *resu
         if (rn == 31) result->rn_type = REG_TYPE_SP;
         if (rd == 31) result->rd_type = REG_TYPE_SP;
     }
+    /* MOV (to/from SP) 的源寄存器就是 Rn，31 同样是 SP */
+    if (result->type == INST_TYPE_MOV) {
+        result->rm_type = result->rn_type;
+    }
+    
+    /* 操作数按显示形式：mov 无立即数，cmp/cmn 无目标寄存器 */
+    if (!(S && rd == 31)) {
+        add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    }
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    if (result->type != INST_TYPE_MOV) {
+        add_imm_operand(result, imm12);
+        if (shift == 1) {
+            add_shift_operand(result, EXTEND_LSL, 12);
+        }
+    }
     
     return true;
 }
@@ -113,8 +172,7 @@ static bool decode_add_sub_imm(uint32_t inst, uint64_t addr, disasm_inst_t *resu
 static bool decode_logical_imm(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     uint8_t sf = BIT(inst, 31);
     uint8_t opc = BITS(inst, 29, 30);
-    /* N字段用于64位模式验证，暂不使用 */
-    /* uint8_t N = BIT(inst, 22); */
+    uint8_t N = BIT(inst, 22);
     uint8_t immr = BITS(inst, 16, 21);
     uint8_t imms = BITS(inst, 10, 15);
     uint8_t rn = BITS(inst, 5, 9);
@@ -158,6 +216,17 @@ static bool decode_logical_imm(uint32_t inst, uint64_t addr, disasm_inst_t *resu
             return false;
     }
     
+    /* 立即数操作数携带解码后的位掩码，而非原始 immr/imms 字段 */
+    if (!(opc == 0x03 && rd == 31)) {
+        /* 非 ands 形式的 Rd=31 表示 SP */
+        reg_type_t rd_type = (opc != 0x03 && rd == 31) ? REG_TYPE_SP : result->rd_type;
+        add_reg_operand(result, rd, rd_type, OPERAND_ACCESS_WRITE);
+    }
+    if (result->type != INST_TYPE_MOV) {
+        add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    }
+    add_imm_operand(result, (int64_t)decode_bit_masks(N, imms, immr, sf));
+    
     return true;
 }
 
@@ -199,6 +268,14 @@ static bool decode_move_wide_imm(uint32_t inst, uint64_t addr, disasm_inst_t *re
             return false;
     }
     
+    /* movk 只替换16位，目标寄存器同时被读取 */
+    add_reg_operand(result, rd, result->rd_type,
+                    opc == 0x03 ? (OPERAND_ACCESS_READ | OPERAND_ACCESS_WRITE) : OPERAND_ACCESS_WRITE);
+    add_imm_operand(result, imm16);
+    if (hw != 0) {
+        add_shift_operand(result, EXTEND_LSL, (uint8_t)(hw * 16));
+    }
+    
     return true;
 }
 
@@ -256,6 +333,18 @@ static bool decode_bitfield(uint32_t inst, uint64_t addr, disasm_inst_t *result)
             return false;
     }
     
+    /* bfm 保留目标寄存器中未插入的位 */
+    add_reg_operand(result, rd, result->rd_type,
+                    opc == 0x01 ? (OPERAND_ACCESS_READ | OPERAND_ACCESS_WRITE) : OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    if (strbuf_equal(result->mnemonic, "asr") || strbuf_equal(result->mnemonic, "lsr") ||
+        strbuf_equal(result->mnemonic, "lsl")) {
+        add_imm_operand(result, result->shift_amount);
+    } else {
+        add_imm_operand(result, immr);
+        add_imm_operand(result, imms);
+    }
+    
     return true;
 }
 
@@ -322,6 +411,18 @@ static bool decode_add_sub_shifted_reg(uint32_t inst, uint64_t addr, disasm_inst
         if (rd == 31) result->rd_type = REG_TYPE_SP;
     }
     
+    /* 操作数按显示形式：cmp/cmn 无目标寄存器，neg 无第一源寄存器 */
+    if (!(S && rd == 31)) {
+        add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    }
+    if (!(op == 1 && rn == 31 && !S)) {
+        add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    }
+    add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+    if (imm6 > 0) {
+        add_shift_operand(result, result->extend_type, imm6);
+    }
+    
     return true;
 }
 
@@ -403,6 +504,20 @@ static bool decode_logical_shifted_reg(uint32_t inst, uint64_t addr, disasm_inst
             return false;
     }
     
+    /* 操作数按显示形式：tst 无目标寄存器，mov/mvn 无第一源寄存器 */
+    bool is_tst = (op_code == 0x06 && rd == 31);
+    bool no_rn = (result->type == INST_TYPE_MOV) || (op_code == 0x03 && rn == 31);
+    if (!is_tst) {
+        add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    }
+    if (!no_rn) {
+        add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    }
+    add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+    if (imm6 > 0) {
+        add_shift_operand(result, result->extend_type, imm6);
+    }
+    
     return true;
 }
 
@@ -460,6 +575,9 @@ static bool decode_data_proc_2src(uint32_t inst, uint64_t addr, disasm_inst_t *r
             return false;
     }
     
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
     return true;
 }
 
@@ -516,6 +634,12 @@ static bool decode_data_proc_3src(uint32_t inst, uint64_t addr, disasm_inst_t *r
             return false;
     }
     
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+    if (ra != 31) {
+        add_reg_operand(result, ra, result->rd_type, OPERAND_ACCESS_READ);
+    }
     return true;
 }
 
@@ -609,6 +733,17 @@ static bool decode_cond_select(uint32_t inst, uint64_t addr, disasm_inst_t *resu
             return false;
     }
     
+    /* 操作数按显示形式：cset/csetm 只有Rd，cinc/cinv/cneg 省略Rm */
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    if (result->type != INST_TYPE_CSET && result->type != INST_TYPE_CSETM) {
+        add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+        if (result->type != INST_TYPE_CINC && result->type != INST_TYPE_CINV &&
+            result->type != INST_TYPE_CNEG) {
+            add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+        }
+    }
+    add_cond_operand(result, result->cond);
+    
     return true;
 }
 
@@ -672,6 +807,8 @@ static bool decode_data_proc_1src(uint32_t inst, uint64_t addr, disasm_inst_t *r
             return false;
     }
     
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
     return true;
 }
 
@@ -711,65 +848,69 @@ static bool decode_extract(uint32_t inst, uint64_t addr, disasm_inst_t *result)
         result->type = INST_TYPE_EXTR;
     }
     
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    if (rn != rm) {
+        add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+    }
+    add_imm_operand(result, imms);
     return true;
 }
 
 /* ========== 数据处理解码表 ========== */
 
 /* 数据处理（立即数）解码表 */
-const decode_entry_t data_proc_imm_decode_table[] = {
-    /* PC相对地址 - ADR/ADRP: bits[28:24] = 10000 */
-    DECODE_ENTRY(0x1F000000, 0x10000000, decode_pc_rel_addr),
-    
-    /* 加法/减法（立即数）: bits[28:24] = 1000x */
-    DECODE_ENTRY(0x1F000000, 0x11000000, decode_add_sub_imm),
-    
-    /* 逻辑运算（立即数）: bits[28:23] = 100100 */
-    DECODE_ENTRY(0x1F800000, 0x12000000, decode_logical_imm),
-    
-    /* 移动宽立即数: bits[28:23] = 100101 */
-    DECODE_ENTRY(0x1F800000, 0x12800000, decode_move_wide_imm),
-    
-    /* 位域操作: bits[28:23] = 100110 */
-    DECODE_ENTRY(0x1F800000, 0x13000000, decode_bitfield),
-    
-    /* EXTR提取: bits[30:23] = 00100111 */
-    DECODE_ENTRY(0x7FA00000, 0x13800000, decode_extract),
-};
+#define DATA_PROC_IMM_DECODE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT) \
+    /* PC相对地址 - ADR/ADRP: bits[28:24] = 10000 */                                    \
+    DECODE_ENTRY(0x1F000000, 0x10000000, decode_pc_rel_addr)                            \
+                                                                                        \
+    /* 加法/减法（立即数）: bits[28:24] = 1000x */                                      \
+    DECODE_ENTRY(0x1F000000, 0x11000000, decode_add_sub_imm)                            \
+                                                                                        \
+    /* 逻辑运算（立即数）: bits[28:23] = 100100 */                                      \
+    DECODE_ENTRY(0x1F800000, 0x12000000, decode_logical_imm)                            \
+                                                                                        \
+    /* 移动宽立即数: bits[28:23] = 100101 */                                            \
+    DECODE_ENTRY(0x1F800000, 0x12800000, decode_move_wide_imm)                          \
+                                                                                        \
+    /* 位域操作: bits[28:23] = 100110 */                                                \
+    DECODE_ENTRY(0x1F800000, 0x13000000, decode_bitfield)                               \
+                                                                                        \
+    /* EXTR提取: bits[30:23] = 00100111 */                                              \
+    DECODE_ENTRY(0x7FA00000, 0x13800000, decode_extract)
 
-const size_t data_proc_imm_decode_table_size = ARRAY_SIZE(data_proc_imm_decode_table);
+DEFINE_DECODE_TABLE(data_proc_imm_decode_table, DATA_PROC_IMM_DECODE_ENTRIES);
 
 /* 数据处理（寄存器）解码表 */
-const decode_entry_t data_proc_reg_decode_table[] = {
-    /* 逻辑运算（移位寄存器）: bits[28:24] = 01010 */
-    DECODE_ENTRY(0x1F000000, 0x0A000000, decode_logical_shifted_reg),
-    
-    /* 加法/减法（移位寄存器）: bits[28:24] = 01011 */
-    DECODE_ENTRY(0x1F200000, 0x0B000000, decode_add_sub_shifted_reg),
-    
-    /* 条件选择: bits[28:21] = 11010100 */
-    DECODE_ENTRY(0x1FE00000, 0x1A800000, decode_cond_select),
-    
-    /* 数据处理（1源寄存器）: bits[30] = 1, bits[28:21] = 11010110 */
-    DECODE_ENTRY(0x5FE00000, 0x5AC00000, decode_data_proc_1src),
-    
-    /* 数据处理（2源寄存器）: bits[30] = 0, bits[28:21] = 11010110 */
-    DECODE_ENTRY(0x5FE00000, 0x1AC00000, decode_data_proc_2src),
-    
-    /* 数据处理（3源寄存器）: bits[28:24] = 11011 */
-    DECODE_ENTRY(0x1F000000, 0x1B000000, decode_data_proc_3src),
-};
+#define DATA_PROC_REG_DECODE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT) \
+    /* 逻辑运算（移位寄存器）: bits[28:24] = 01010 */                                   \
+    DECODE_ENTRY(0x1F000000, 0x0A000000, decode_logical_shifted_reg)                    \
+                                                                                        \
+    /* 加法/减法（移位寄存器）: bits[28:24] = 01011 */                                  \
+    DECODE_ENTRY(0x1F200000, 0x0B000000, decode_add_sub_shifted_reg)                    \
+                                                                                        \
+    /* 条件选择: bits[28:21] = 11010100 */                                              \
+    DECODE_ENTRY(0x1FE00000, 0x1A800000, decode_cond_select)                            \
+                                                                                        \
+    /* 数据处理（1源寄存器）: bits[30] = 1, bits[28:21] = 11010110 */                   \
+    DECODE_ENTRY(0x5FE00000, 0x5AC00000, decode_data_proc_1src)                         \
+                                                                                        \
+    /* 数据处理（2源寄存器）: bits[30] = 0, bits[28:21] = 11010110 */                   \
+    DECODE_ENTRY(0x5FE00000, 0x1AC00000, decode_data_proc_2src)                         \
+                                                                                        \
+    /* 数据处理（3源寄存器）: bits[28:24] = 11011 */                                    \
+    DECODE_ENTRY(0x1F000000, 0x1B000000, decode_data_proc_3src)
 
-const size_t data_proc_reg_decode_table_size = ARRAY_SIZE(data_proc_reg_decode_table);
+DEFINE_DECODE_TABLE(data_proc_reg_decode_table, DATA_PROC_REG_DECODE_ENTRIES);
 
 /* ========== 主数据处理解析函数（表驱动） ========== */
 
 bool decode_data_proc_imm(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    return decode_with_table(data_proc_imm_decode_table, data_proc_imm_decode_table_size,
-                            inst, addr, result);
+    return decode_with_table(&data_proc_imm_decode_table, inst, addr, result);
 }
 
 bool decode_data_proc_reg(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    return decode_with_table(data_proc_reg_decode_table, data_proc_reg_decode_table_size,
-                            inst, addr, result);
+    return decode_with_table(&data_proc_reg_decode_table, inst, addr, result);
 }
+
+#endif /* ARM64_DISASM_HAS_DATA_PROC */
@@ -5,8 +5,9 @@
 
 #include "arm64_disasm.h"
 #include "arm64_decode_table.h"
-#include <string.h>
-#include <stdio.h>
+
+/* ARM64_DISASM_NO_FP_SIMD 时整个浮点/SIMD组不参与编译 */
+#if ARM64_DISASM_HAS_FP_SIMD
 
 /* ========== 浮点指令类型扩展 ========== */
 
@@ -46,6 +47,7 @@ static bool decode_fp_data_proc_1src(uint32_t inst, uint64_t addr, disasm_inst_t
     uint8_t rd = BITS(inst, 0, 4);
     
     if (M != 0 || S != 0) return false;
+    if (ftype == 2) return false;  /* ftype=10 保留 */
     
     result->rd = rd;
     result->rn = rn;
@@ -86,6 +88,8 @@ static bool decode_fp_data_proc_1src(uint32_t inst, uint64_t addr, disasm_inst_t
                 else if (opc == 1) result->rd_type = REG_TYPE_D;
                 else if (opc == 3) result->rd_type = REG_TYPE_H;
             }
+            add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+            add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
             return true;
         }
     }
@@ -110,6 +114,7 @@ static bool decode_fp_data_proc_2src(uint32_t inst, uint64_t addr, disasm_inst_t
     uint8_t rd = BITS(inst, 0, 4);
     
     if (M != 0 || S != 0) return false;
+    if (ftype == 2) return false;  /* ftype=10 保留 */
     
     result->rd = rd;
     result->rn = rn;
@@ -139,6 +144,9 @@ static bool decode_fp_data_proc_2src(uint32_t inst, uint64_t addr, disasm_inst_t
         if (fp_2src_ops[i].opcode == opcode) {
             SAFE_STRCPY(result->mnemonic, fp_2src_ops[i].name);
             result->type = fp_2src_ops[i].type;
+            add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+            add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+            add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
             return true;
         }
     }
@@ -165,6 +173,7 @@ static bool decode_fp_data_proc_3src(uint32_t inst, uint64_t addr, disasm_inst_t
     uint8_t rd = BITS(inst, 0, 4);
     
     if (M != 0 || S != 0) return false;
+    if (ftype == 2) return false;  /* ftype=10 保留 */
     
     result->rd = rd;
     result->rn = rn;
@@ -189,6 +198,10 @@ static bool decode_fp_data_proc_3src(uint32_t inst, uint64_t addr, disasm_inst_t
     if (op < 4) {
         SAFE_STRCPY(result->mnemonic, fp_3src_ops[op].name);
         result->type = fp_3src_ops[op].type;
+        add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+        add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+        add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+        add_reg_operand(result, ra, result->rd_type, OPERAND_ACCESS_READ);
         return true;
     }
     
@@ -212,6 +225,7 @@ static bool decode_fp_compare(uint32_t inst, uint64_t addr, disasm_inst_t *resul
     uint8_t opcode2 = BITS(inst, 0, 4);
     
     if (M != 0 || S != 0) return false;
+    if (ftype == 2) return false;  /* ftype=10 保留 */
     if (op != 0) return false;
     
     result->rn = rn;
@@ -247,6 +261,13 @@ static bool decode_fp_compare(uint32_t inst, uint64_t addr, disasm_inst_t *resul
             return false;
     }
     
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    if (result->has_imm) {
+        add_imm_operand(result, 0);
+    } else {
+        add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+    }
+    
     return true;
 }
 
@@ -268,6 +289,7 @@ static bool decode_fp_cond_compare(uint32_t inst, uint64_t addr, disasm_inst_t *
     uint8_t nzcv = BITS(inst, 0, 3);
     
     if (M != 0 || S != 0) return false;
+    if (ftype == 2) return false;  /* ftype=10 保留 */
     
     result->rn = rn;
     result->rm = rm;
@@ -280,6 +302,11 @@ static bool decode_fp_cond_compare(uint32_t inst, uint64_t addr, disasm_inst_t *
     
     SAFE_STRCPY(result->mnemonic, op ? "fccmpe" : "fccmp");
     
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+    add_imm_operand(result, nzcv);
+    add_cond_operand(result, cond);
+    
     return true;
 }
 
@@ -300,6 +327,7 @@ static bool decode_fp_cond_select(uint32_t inst, uint64_t addr, disasm_inst_t *r
     uint8_t rd = BITS(inst, 0, 4);
     
     if (M != 0 || S != 0) return false;
+    if (ftype == 2) return false;  /* ftype=10 保留 */
     
     result->rd = rd;
     result->rn = rn;
@@ -313,6 +341,11 @@ static bool decode_fp_cond_select(uint32_t inst, uint64_t addr, disasm_inst_t *r
     
     SAFE_STRCPY(result->mnemonic, "fcsel");
     
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+    add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
+    add_cond_operand(result, cond);
+    
     return true;
 }
 
@@ -333,6 +366,7 @@ static bool decode_fp_int_conv(uint32_t inst, uint64_t addr, disasm_inst_t *resu
     uint8_t rd = BITS(inst, 0, 4);
     
     if (S != 0) return false;
+    if (ftype == 2) return false;  /* ftype=10 保留（FMOV 高64位不支持） */
     
     result->rd = rd;
     result->rn = rn;
@@ -442,6 +476,8 @@ static bool decode_fp_int_conv(uint32_t inst, uint64_t addr, disasm_inst_t *resu
     }
     
     result->is_64bit = sf;
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
     return true;
 }
 
@@ -462,6 +498,7 @@ static bool decode_fp_imm(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     
     if (M != 0 || S != 0) return false;
     if (imm5 != 0) return false;  /* imm5必须为0 */
+    if (ftype == 2) return false;  /* ftype=10 保留 */
     
     result->rd = rd;
     result->imm = imm8;
@@ -471,6 +508,10 @@ static bool decode_fp_imm(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     
     SAFE_STRCPY(result->mnemonic, "fmov");
     
+    /* 立即数为8位浮点编码（abcdefgh） */
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_imm_operand(result, imm8);
+    
     return true;
 }
 
@@ -524,6 +565,10 @@ static bool decode_simd_scalar_dup(uint32_t inst, uint64_t addr, disasm_inst_t *
     
     SAFE_STRCPY(result->mnemonic, "dup");
     
+    add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rn, REG_TYPE_V, OPERAND_ACCESS_READ);
+    add_imm_operand(result, result->imm);
+    
     return true;
 }
 
@@ -581,6 +626,9 @@ static bool decode_simd_scalar_3same(uint32_t inst, uint64_t addr, disasm_inst_t
         if (simd_scalar_ops[i].op == op) {
             SAFE_STRCPY(result->mnemonic, simd_scalar_ops[i].name);
             result->type = INST_TYPE_ADD;
+            add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+            add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
+            add_reg_operand(result, rm, result->rm_type, OPERAND_ACCESS_READ);
             return true;
         }
     }
@@ -645,6 +693,8 @@ static bool decode_simd_scalar_2reg_misc(uint32_t inst, uint64_t addr, disasm_in
         if (scalar_2reg_ops[i].op == op) {
             SAFE_STRCPY(result->mnemonic, scalar_2reg_ops[i].name);
             result->type = INST_TYPE_MOV;
+            add_reg_operand(result, rd, result->rd_type, OPERAND_ACCESS_WRITE);
+            add_reg_operand(result, rn, result->rn_type, OPERAND_ACCESS_READ);
             return true;
         }
     }
@@ -654,42 +704,41 @@ static bool decode_simd_scalar_2reg_misc(uint32_t inst, uint64_t addr, disasm_in
 
 /* ========== 浮点/SIMD解码表 ========== */
 
-const decode_entry_t fp_simd_decode_table[] = {
-    /* 浮点比较: bits[28:24] = 11110, bits[21] = 1, bits[13:10] = 1000 */
-    DECODE_ENTRY(0x5F203C00, 0x1E202000, decode_fp_compare),
-    
-    /* 浮点条件比较: bits[28:24] = 11110, bits[21] = 1, bits[11:10] = 01 */
-    DECODE_ENTRY(0x5F200C00, 0x1E200400, decode_fp_cond_compare),
-    
-    /* 浮点条件选择: bits[28:24] = 11110, bits[21] = 1, bits[11:10] = 11 */
-    DECODE_ENTRY(0x5F200C00, 0x1E200C00, decode_fp_cond_select),
-    
-    /* 浮点数据处理（2源）: bits[28:24] = 11110, bits[21] = 1, bits[11:10] = 10 */
-    DECODE_ENTRY(0x5F200C00, 0x1E200800, decode_fp_data_proc_2src),
-    
-    /* 浮点数据处理（1源）: bits[28:24] = 11110, bits[21] = 1, bits[14:10] = 10000 */
-    DECODE_ENTRY(0x5F207C00, 0x1E204000, decode_fp_data_proc_1src),
-    
-    /* 浮点立即数: bits[28:24] = 11110, bits[21] = 1, bits[12:10] = 100 */
-    DECODE_ENTRY(0x5F201C00, 0x1E201000, decode_fp_imm),
-    
-    /* 浮点/整数转换: bits[28:24] = 11110, bits[21] = 1, bits[15:10] = 000000 */
-    DECODE_ENTRY(0x5F20FC00, 0x1E200000, decode_fp_int_conv),
-    
-    /* 浮点数据处理（3源）: bits[28:24] = 11111 */
-    DECODE_ENTRY(0x5F000000, 0x1F000000, decode_fp_data_proc_3src),
-    
-    /* SIMD标量复制 */
-    DECODE_ENTRY(0xFFE0FC00, 0x5E000400, decode_simd_scalar_dup),
-    
-    /* SIMD标量三寄存器（相同类型） */
-    DECODE_ENTRY(0xDF200400, 0x5E200400, decode_simd_scalar_3same),
-    
-    /* SIMD标量两寄存器杂项 */
-    DECODE_ENTRY(0xDF3E0C00, 0x5E200800, decode_simd_scalar_2reg_misc),
-};
-
-const size_t fp_simd_decode_table_size = ARRAY_SIZE(fp_simd_decode_table);
+#define FP_SIMD_DECODE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)      \
+    /* 浮点比较: bits[28:24] = 11110, bits[21] = 1, bits[13:10] = 1000 */               \
+    DECODE_ENTRY(0x5F203C00, 0x1E202000, decode_fp_compare)                             \
+                                                                                        \
+    /* 浮点条件比较: bits[28:24] = 11110, bits[21] = 1, bits[11:10] = 01 */             \
+    DECODE_ENTRY(0x5F200C00, 0x1E200400, decode_fp_cond_compare)                        \
+                                                                                        \
+    /* 浮点条件选择: bits[28:24] = 11110, bits[21] = 1, bits[11:10] = 11 */             \
+    DECODE_ENTRY(0x5F200C00, 0x1E200C00, decode_fp_cond_select)                         \
+                                                                                        \
+    /* 浮点数据处理（2源）: bits[28:24] = 11110, bits[21] = 1, bits[11:10] = 10 */      \
+    DECODE_ENTRY(0x5F200C00, 0x1E200800, decode_fp_data_proc_2src)                      \
+                                                                                        \
+    /* 浮点数据处理（1源）: bits[28:24] = 11110, bits[21] = 1, bits[14:10] = 10000 */   \
+    DECODE_ENTRY(0x5F207C00, 0x1E204000, decode_fp_data_proc_1src)                      \
+                                                                                        \
+    /* 浮点立即数: bits[28:24] = 11110, bits[21] = 1, bits[12:10] = 100 */              \
+    DECODE_ENTRY(0x5F201C00, 0x1E201000, decode_fp_imm)                                 \
+                                                                                        \
+    /* 浮点/整数转换: bits[28:24] = 11110, bits[21] = 1, bits[15:10] = 000000 */        \
+    DECODE_ENTRY(0x5F20FC00, 0x1E200000, decode_fp_int_conv)                            \
+                                                                                        \
+    /* 浮点数据处理（3源）: bits[28:24] = 11111 */                                      \
+    DECODE_ENTRY(0x5F000000, 0x1F000000, decode_fp_data_proc_3src)                      \
+                                                                                        \
+    /* SIMD标量复制 */                                                                  \
+    DECODE_ENTRY(0xFFE0FC00, 0x5E000400, decode_simd_scalar_dup)                        \
+                                                                                        \
+    /* SIMD标量三寄存器（相同类型） */                                                  \
+    DECODE_ENTRY(0xDF200400, 0x5E200400, decode_simd_scalar_3same)                      \
+                                                                                        \
+    /* SIMD标量两寄存器杂项 */                                                          \
+    DECODE_ENTRY(0xDF3E0C00, 0x5E200800, decode_simd_scalar_2reg_misc)
+
+DEFINE_DECODE_TABLE(fp_simd_decode_table, FP_SIMD_DECODE_ENTRIES);
 
 /* ========== 主浮点/SIMD解析函数（表驱动） ========== */
 
@@ -697,6 +746,7 @@ const size_t fp_simd_decode_table_size = ARRAY_SIZE(fp_simd_decode_table);
  * 解析浮点/SIMD指令
  */
 bool decode_fp_simd(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    return decode_with_table(fp_simd_decode_table, fp_simd_decode_table_size,
-                            inst, addr, result);
+    return decode_with_table(&fp_simd_decode_table, inst, addr, result);
 }
+
+#endif /* ARM64_DISASM_HAS_FP_SIMD */
@@ -5,116 +5,148 @@
 
 #include "arm64_disasm.h"
 #include "arm64_decode_table.h"
-#include <string.h>
-#include <stdio.h>
 
+/* 普通加载/存储（ARM64_DISASM_NO_LOAD_STORE）和原子操作（ARM64_DISASM_NO_ATOMICS）可分别去掉 */
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
+
+#if ARM64_DISASM_HAS_LOAD_STORE
 /* ========== 加载/存储解码辅助结构 ========== */
 
-/* 加载/存储指令信息表 */
+/* 单寄存器加载/存储信息 */
 typedef struct {
-    uint8_t size_opc;       /* (size << 2) | opc */
-    const char *mnemonic;
+    const char *mnemonic;           /* 无符号偏移、前/后索引、寄存器偏移形式 */
+    const char *unscaled_mnemonic;  /* 未缩放立即数形式 */
     inst_type_t type;
     reg_type_t reg_type;
     bool is_64bit;
+    bool is_load;
+    uint8_t scale;                  /* 访问大小的log2（字节），也是imm12/寄存器偏移的缩放位数 */
 } ls_info_t;
 
-/* 通用寄存器加载/存储信息表 */
-static const ls_info_t gpr_ls_info[] = {
-    { 0x00, "strb",  INST_TYPE_STRB,  REG_TYPE_W, false },
-    { 0x01, "ldrb",  INST_TYPE_LDRB,  REG_TYPE_W, false },
-    { 0x02, "ldrsb", INST_TYPE_LDRSB, REG_TYPE_X, true  },
-    { 0x03, "ldrsb", INST_TYPE_LDRSB, REG_TYPE_W, false },
-    { 0x04, "strh",  INST_TYPE_STRH,  REG_TYPE_W, false },
-    { 0x05, "ldrh",  INST_TYPE_LDRH,  REG_TYPE_W, false },
-    { 0x06, "ldrsh", INST_TYPE_LDRSH, REG_TYPE_X, true  },
-    { 0x07, "ldrsh", INST_TYPE_LDRSH, REG_TYPE_W, false },
-    { 0x08, "str",   INST_TYPE_STR,   REG_TYPE_W, false },
-    { 0x09, "ldr",   INST_TYPE_LDR,   REG_TYPE_W, false },
-    { 0x0A, "ldrsw", INST_TYPE_LDRSW, REG_TYPE_X, true  },
-    { 0x0C, "str",   INST_TYPE_STR,   REG_TYPE_X, true  },
-    { 0x0D, "ldr",   INST_TYPE_LDR,   REG_TYPE_X, true  },
+#define LS_INFO(mn, umn, type, reg, is64, load, scale) \
+    { (mn), (umn), INST_TYPE_##type, REG_TYPE_##reg, (is64), (load), (scale) }
+
+/*
+ * 按 [V][(size << 2) | opc] 直接索引，mnemonic 为 NULL 表示未分配的编码。
+ * 四种寻址形式共用此表：size/V/opc 的含义在各形式中相同。
+ */
+static const ls_info_t ls_info[2][16] = {
+    /* 通用寄存器 */
+    {
+        LS_INFO("strb",  "sturb",  STRB,  W, false, false, 0),
+        LS_INFO("ldrb",  "ldurb",  LDRB,  W, false, true,  0),
+        LS_INFO("ldrsb", "ldursb", LDRSB, X, true,  true,  0),
+        LS_INFO("ldrsb", "ldursb", LDRSB, W, false, true,  0),
+        LS_INFO("strh",  "sturh",  STRH,  W, false, false, 1),
+        LS_INFO("ldrh",  "ldurh",  LDRH,  W, false, true,  1),
+        LS_INFO("ldrsh", "ldursh", LDRSH, X, true,  true,  1),
+        LS_INFO("ldrsh", "ldursh", LDRSH, W, false, true,  1),
+        LS_INFO("str",   "stur",   STR,   W, false, false, 2),
+        LS_INFO("ldr",   "ldur",   LDR,   W, false, true,  2),
+        LS_INFO("ldrsw", "ldursw", LDRSW, X, true,  true,  2),
+        { NULL },
+        LS_INFO("str",   "stur",   STR,   X, true,  false, 3),
+        LS_INFO("ldr",   "ldur",   LDR,   X, true,  true,  3),
+        /* PRFM：Rt 字段为预取操作，没有前/后索引形式 */
+        LS_INFO("prfm",  "prfum",  PRFM,  X, false, false, 3),
+        { NULL },
+    },
+    /* SIMD/FP寄存器：size=0 时 opc 的高位选择128位Q寄存器 */
+    {
+        LS_INFO("str",   "stur",   STR,   B, false, false, 0),
+        LS_INFO("ldr",   "ldur",   LDR,   B, false, true,  0),
+        LS_INFO("str",   "stur",   STR,   Q, false, false, 4),
+        LS_INFO("ldr",   "ldur",   LDR,   Q, false, true,  4),
+        LS_INFO("str",   "stur",   STR,   H, false, false, 1),
+        LS_INFO("ldr",   "ldur",   LDR,   H, false, true,  1),
+        { NULL },
+        { NULL },
+        LS_INFO("str",   "stur",   STR,   S, false, false, 2),
+        LS_INFO("ldr",   "ldur",   LDR,   S, false, true,  2),
+        { NULL },
+        { NULL },
+        LS_INFO("str",   "stur",   STR,   D, false, false, 3),
+        LS_INFO("ldr",   "ldur",   LDR,   D, false, true,  3),
+        { NULL },
+        { NULL },
+    },
 };
 
-/* 查找GPR加载/存储信息 */
-static const ls_info_t* find_gpr_ls_info(uint8_t size_opc) {
-    for (size_t i = 0; i < ARRAY_SIZE(gpr_ls_info); i++) {
-        if (gpr_ls_info[i].size_opc == size_opc) {
-            return &gpr_ls_info[i];
-        }
+#undef LS_INFO
+
+/**
+ * 查找单寄存器加载/存储信息并填写助记符和寄存器类型
+ * @param unscaled 是否为未缩放立即数形式（ldur/stur/prfum）
+ * @return 未分配的编码返回NULL
+ */
+static inline const ls_info_t *apply_ls_info(uint32_t inst, bool unscaled, disasm_inst_t *result) {
+    const ls_info_t *info = &ls_info[BIT(inst, 26)][(BITS(inst, 30, 31) << 2) | BITS(inst, 22, 23)];
+    if (!info->mnemonic) {
+        return NULL;
+    }
+    SAFE_STRCPY(result->mnemonic, unscaled ? info->unscaled_mnemonic : info->mnemonic);
+    result->type = info->type;
+    result->rd_type = info->reg_type;
+    result->is_64bit = info->is_64bit;
+    return info;
+}
+
+/**
+ * 填写单寄存器加载/存储的操作数：Rt（PRFM为预取操作立即数）与内存操作数
+ */
+static void add_ls_operands(disasm_inst_t *result, const ls_info_t *info) {
+    if (info->type == INST_TYPE_PRFM) {
+        add_imm_operand(result, result->rd);
+        add_mem_operand(result, OPERAND_ACCESS_READ, (uint16_t)(8u << info->scale));
+        return;
     }
-    return NULL;
+    add_reg_operand(result, result->rd, result->rd_type,
+                    info->is_load ? OPERAND_ACCESS_WRITE : OPERAND_ACCESS_READ);
+    add_mem_operand(result, info->is_load ? OPERAND_ACCESS_READ : OPERAND_ACCESS_WRITE,
+                    (uint16_t)(8u << info->scale));
 }
 
 /* ========== 加载/存储解码函数 ========== */
 
 /**
  * 解析加载/存储寄存器（无符号偏移）
- * 编码：size|111|V|01|imm12|Rn|Rt
+ * 编码：size|111|V|01|opc|imm12|Rn|Rt
  * mask: 0x3B000000, value: 0x39000000
  */
 static bool decode_ls_unsigned_imm(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    uint8_t size = BITS(inst, 30, 31);
-    uint8_t V = BIT(inst, 26);
-    uint8_t opc = BITS(inst, 22, 23);
     uint16_t imm12 = BITS(inst, 10, 21);
     uint8_t rn = BITS(inst, 5, 9);
     uint8_t rt = BITS(inst, 0, 4);
     
+    const ls_info_t *info = apply_ls_info(inst, false, result);
+    if (!info) return false;
+    
     result->rn = rn;
     result->rd = rt;
     result->rn_type = (rn == 31) ? REG_TYPE_SP : REG_TYPE_X;
     result->addr_mode = ADDR_MODE_IMM_UNSIGNED;
     result->has_imm = true;
+    result->imm = (int64_t)imm12 << info->scale;
     
-    if (V == 0) {
-        /* 通用寄存器 */
-        uint8_t size_opc = (size << 2) | opc;
-        const ls_info_t *info = find_gpr_ls_info(size_opc);
-        if (!info) return false;
-        
-        result->imm = (int64_t)imm12 << size;
-        SAFE_STRCPY(result->mnemonic, info->mnemonic);
-        result->type = info->type;
-        result->rd_type = info->reg_type;
-        result->is_64bit = info->is_64bit;
-    } else {
-        /* SIMD/FP寄存器 */
-        result->imm = (int64_t)imm12 << size;
-        
-        static const reg_type_t simd_types[] = { REG_TYPE_B, REG_TYPE_H, REG_TYPE_S, REG_TYPE_D };
-        if (size > 3) return false;
-        result->rd_type = simd_types[size];
-        
-        if (opc == 0) {
-            SAFE_STRCPY(result->mnemonic, "str");
-            result->type = INST_TYPE_STR;
-        } else if (opc == 1) {
-            SAFE_STRCPY(result->mnemonic, "ldr");
-            result->type = INST_TYPE_LDR;
-        } else {
-            return false;
-        }
-    }
-    
+    add_ls_operands(result, info);
     return true;
 }
 
 /**
  * 解析加载/存储寄存器（寄存器偏移）
- * 编码：size|111|V|00|1|Rm|option|S|10|Rn|Rt
+ * 编码：size|111|V|00|opc|1|Rm|option|S|10|Rn|Rt
  * mask: 0x3B200C00, value: 0x38200800
  */
 static bool decode_ls_reg_offset(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    uint8_t size = BITS(inst, 30, 31);
-    uint8_t V = BIT(inst, 26);
-    uint8_t opc = BITS(inst, 22, 23);
     uint8_t rm = BITS(inst, 16, 20);
     uint8_t option = BITS(inst, 13, 15);
     uint8_t S = BIT(inst, 12);
     uint8_t rn = BITS(inst, 5, 9);
     uint8_t rt = BITS(inst, 0, 4);
     
+    const ls_info_t *info = apply_ls_info(inst, false, result);
+    if (!info) return false;
+    
     result->rn = rn;
     result->rd = rt;
     result->rm = rm;
@@ -122,60 +154,27 @@ static bool decode_ls_reg_offset(uint32_t inst, uint64_t addr, disasm_inst_t *re
     result->has_imm = false;
     
     result->extend_type = (extend_t)option;
-    result->shift_amount = S ? size : 0;
+    result->shift_amount = S ? info->scale : 0;
     
     result->rm_type = (option == EXTEND_UXTX || option == EXTEND_SXTX) ? REG_TYPE_X : REG_TYPE_W;
     result->addr_mode = (option == EXTEND_LSL || option == EXTEND_UXTX) ? 
                         ADDR_MODE_REG_OFFSET : ADDR_MODE_REG_EXTEND;
     
-    if (V == 0) {
-        uint8_t size_opc = (size << 2) | opc;
-        const ls_info_t *info = find_gpr_ls_info(size_opc);
-        if (!info) return false;
-        
-        SAFE_STRCPY(result->mnemonic, info->mnemonic);
-        result->type = info->type;
-        result->rd_type = info->reg_type;
-        result->is_64bit = info->is_64bit;
-    } else {
-        static const reg_type_t simd_types[] = { REG_TYPE_B, REG_TYPE_H, REG_TYPE_S, REG_TYPE_D };
-        if (size > 3) return false;
-        result->rd_type = simd_types[size];
-        
-        if (opc == 0) {
-            SAFE_STRCPY(result->mnemonic, "str");
-            result->type = INST_TYPE_STR;
-        } else if (opc == 1) {
-            SAFE_STRCPY(result->mnemonic, "ldr");
-            result->type = INST_TYPE_LDR;
-        } else {
-            return false;
-        }
-    }
-    
+    add_ls_operands(result, info);
     return true;
 }
 
 /**
  * 解析加载/存储（未缩放立即数/预索引/后索引）
- * 编码：size|111|V|00|0|imm9|idx|Rn|Rt
+ * 编码：size|111|V|00|opc|0|imm9|idx|Rn|Rt
  * mask: 0x3B200000, value: 0x38000000
  */
 static bool decode_ls_unscaled_imm(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    uint8_t size = BITS(inst, 30, 31);
-    uint8_t V = BIT(inst, 26);
-    uint8_t opc = BITS(inst, 22, 23);
     int16_t imm9 = BITS(inst, 12, 20);
     uint8_t idx = BITS(inst, 10, 11);
     uint8_t rn = BITS(inst, 5, 9);
     uint8_t rt = BITS(inst, 0, 4);
     
-    result->imm = SIGN_EXTEND(imm9, 9);
-    result->rn = rn;
-    result->rd = rt;
-    result->rn_type = (rn == 31) ? REG_TYPE_SP : REG_TYPE_X;
-    result->has_imm = true;
-    
     /* 寻址模式 */
     switch (idx) {
         case 0: result->addr_mode = ADDR_MODE_IMM_SIGNED; break;
@@ -184,60 +183,17 @@ static bool decode_ls_unscaled_imm(uint32_t inst, uint64_t addr, disasm_inst_t *
         case 3: result->addr_mode = ADDR_MODE_PRE_INDEX; break;
     }
     
-    if (V == 0) {
-        uint8_t size_opc = (size << 2) | opc;
-        
-        /* 使用静态表映射 */
-        static const struct {
-            uint8_t size_opc;
-            const char *base_name;
-            const char *unscaled_name;
-            inst_type_t type;
-            reg_type_t reg_type;
-            bool is_64bit;
-        } unscaled_info[] = {
-            { 0x00, "strb",  "sturb",  INST_TYPE_STRB,  REG_TYPE_W, false },
-            { 0x01, "ldrb",  "ldurb",  INST_TYPE_LDRB,  REG_TYPE_W, false },
-            { 0x02, "ldrsb", "ldursb", INST_TYPE_LDRSB, REG_TYPE_X, true  },
-            { 0x03, "ldrsb", "ldursb", INST_TYPE_LDRSB, REG_TYPE_W, false },
-            { 0x04, "strh",  "sturh",  INST_TYPE_STRH,  REG_TYPE_W, false },
-            { 0x05, "ldrh",  "ldurh",  INST_TYPE_LDRH,  REG_TYPE_W, false },
-            { 0x06, "ldrsh", "ldursh", INST_TYPE_LDRSH, REG_TYPE_X, true  },
-            { 0x07, "ldrsh", "ldursh", INST_TYPE_LDRSH, REG_TYPE_W, false },
-            { 0x08, "str",   "stur",   INST_TYPE_STR,   REG_TYPE_W, false },
-            { 0x09, "ldr",   "ldur",   INST_TYPE_LDR,   REG_TYPE_W, false },
-            { 0x0A, "ldrsw", "ldursw", INST_TYPE_LDRSW, REG_TYPE_X, true  },
-            { 0x0C, "str",   "stur",   INST_TYPE_STR,   REG_TYPE_X, true  },
-            { 0x0D, "ldr",   "ldur",   INST_TYPE_LDR,   REG_TYPE_X, true  },
-        };
-        
-        for (size_t i = 0; i < ARRAY_SIZE(unscaled_info); i++) {
-            if (unscaled_info[i].size_opc == size_opc) {
-                SAFE_STRCPY(result->mnemonic, 
-                           (idx == 0) ? unscaled_info[i].unscaled_name : unscaled_info[i].base_name);
-                result->type = unscaled_info[i].type;
-                result->rd_type = unscaled_info[i].reg_type;
-                result->is_64bit = unscaled_info[i].is_64bit;
-                return true;
-            }
-        }
-        return false;
-    } else {
-        static const reg_type_t simd_types[] = { REG_TYPE_B, REG_TYPE_H, REG_TYPE_S, REG_TYPE_D };
-        if (size > 3) return false;
-        result->rd_type = simd_types[size];
-        
-        if (opc == 0) {
-            SAFE_STRCPY(result->mnemonic, (idx == 0) ? "stur" : "str");
-            result->type = INST_TYPE_STR;
-        } else if (opc == 1) {
-            SAFE_STRCPY(result->mnemonic, (idx == 0) ? "ldur" : "ldr");
-            result->type = INST_TYPE_LDR;
-        } else {
-            return false;
-        }
-    }
+    const ls_info_t *info = apply_ls_info(inst, idx == 0, result);
+    if (!info) return false;
+    if (info->type == INST_TYPE_PRFM && idx != 0) return false;
     
+    result->imm = SIGN_EXTEND(imm9, 9);
+    result->rn = rn;
+    result->rd = rt;
+    result->rn_type = (rn == 31) ? REG_TYPE_SP : REG_TYPE_X;
+    result->has_imm = true;
+    
+    add_ls_operands(result, info);
     return true;
 }
 
@@ -306,11 +262,18 @@ static bool decode_ls_pair(uint32_t inst, uint64_t addr, disasm_inst_t *result)
         result->type = L ? INST_TYPE_LDP : INST_TYPE_STP;
     }
     
+    /* ldpsw 每个元素访问32位，其余按目标寄存器宽度 */
+    uint16_t elem_bits = (V == 0 && opc == 0x01) ? 32 : reg_type_width(result->rd_type);
+    uint8_t reg_access = L ? OPERAND_ACCESS_WRITE : OPERAND_ACCESS_READ;
+    add_reg_operand(result, rt, result->rd_type, reg_access);
+    add_reg_operand(result, rt2, result->rd_type, reg_access);
+    add_mem_operand(result, L ? OPERAND_ACCESS_READ : OPERAND_ACCESS_WRITE,
+                    (uint16_t)(elem_bits * 2));
     return true;
 }
 
 /**
- * 解析加载字面量（LDR literal）
+ * 解析加载字面量（LDR/LDRSW/PRFM literal）
  * 编码：opc|011|V|00|imm19|Rt
  * mask: 0x3B000000, value: 0x18000000
  */
@@ -335,7 +298,15 @@ static bool decode_load_literal(uint32_t inst, uint64_t addr, disasm_inst_t *res
             { REG_TYPE_X, true,  "ldrsw" },
         };
         
-        if (opc > 2) return false;
+        if (opc == 3) {
+            /* PRFM (literal)：Rt 字段为预取操作 */
+            SAFE_STRCPY(result->mnemonic, "prfm");
+            result->type = INST_TYPE_PRFM;
+            result->rd_type = REG_TYPE_X;
+            add_imm_operand(result, rt);
+            add_mem_operand(result, OPERAND_ACCESS_READ, 64);
+            return true;
+        }
         result->rd_type = gpr_literal[opc].type;
         result->is_64bit = gpr_literal[opc].is_64bit;
         SAFE_STRCPY(result->mnemonic, gpr_literal[opc].name);
@@ -346,9 +317,15 @@ static bool decode_load_literal(uint32_t inst, uint64_t addr, disasm_inst_t *res
         result->rd_type = simd_literal[opc];
     }
     
+    add_reg_operand(result, rt, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_mem_operand(result, OPERAND_ACCESS_READ,
+                    (V == 0 && opc == 2) ? 32 : reg_type_width(result->rd_type));
     return true;
 }
 
+#endif /* ARM64_DISASM_HAS_LOAD_STORE */
+
+#if ARM64_DISASM_HAS_ATOMICS
 /* ========== 原子操作指令 ========== */
 
 /**
@@ -367,6 +344,10 @@ static bool decode_load_store_exclusive(uint32_t inst, uint64_t addr, disasm_ins
     uint8_t rn = BITS(inst, 5, 9);
     uint8_t rt = BITS(inst, 0, 4);
     
+    /* 独占对只有32/64位；o2=1,o1=1 是 CAS 的编码空间，其余组合未分配 */
+    if (o2 == 0 && o1 == 1 && size < 2) return false;
+    if (o2 == 1 && o1 == 1) return false;
+    
     result->rd = rt;
     result->rn = rn;
     result->rm = rs;  /* 用于STXR的状态寄存器 */
@@ -448,7 +429,7 @@ static bool decode_load_store_exclusive(uint32_t inst, uint64_t addr, disasm_ins
     /* 根据size添加后缀 */
     if (size == 0) {
         /* 字节 */
-        size_t len = strlen(result->mnemonic);
+        size_t len = strbuf_strlen(result->mnemonic);
         if (len < sizeof(result->mnemonic) - 1) {
             result->mnemonic[len] = 'b';
             result->mnemonic[len + 1] = '\0';
@@ -456,7 +437,7 @@ static bool decode_load_store_exclusive(uint32_t inst, uint64_t addr, disasm_ins
         result->rd_type = REG_TYPE_W;
     } else if (size == 1) {
         /* 半字 */
-        size_t len = strlen(result->mnemonic);
+        size_t len = strbuf_strlen(result->mnemonic);
         if (len < sizeof(result->mnemonic) - 1) {
             result->mnemonic[len] = 'h';
             result->mnemonic[len + 1] = '\0';
@@ -464,6 +445,26 @@ static bool decode_load_store_exclusive(uint32_t inst, uint64_t addr, disasm_ins
         result->rd_type = REG_TYPE_W;
     }
     
+    /* 操作数：[Ws,] Rt[, Rt2], [Xn] */
+    bool is_pair = (o2 == 0 && o1 == 1);
+    uint16_t access_bits = (uint16_t)((8u << size) * (is_pair ? 2 : 1));
+    if (L == 1) {
+        add_reg_operand(result, rt, result->rd_type, OPERAND_ACCESS_WRITE);
+        if (is_pair) {
+            add_reg_operand(result, rt2, result->rd_type, OPERAND_ACCESS_WRITE);
+        }
+        add_mem_operand(result, OPERAND_ACCESS_READ, access_bits);
+    } else {
+        if (o2 == 0) {
+            add_reg_operand(result, rs, REG_TYPE_W, OPERAND_ACCESS_WRITE);
+        }
+        add_reg_operand(result, rt, result->rd_type, OPERAND_ACCESS_READ);
+        if (is_pair) {
+            add_reg_operand(result, rt2, result->rd_type, OPERAND_ACCESS_READ);
+        }
+        add_mem_operand(result, OPERAND_ACCESS_WRITE, access_bits);
+    }
+    
     return true;
 }
 
@@ -484,6 +485,8 @@ static bool decode_atomic_memory_ops(uint32_t inst, uint64_t addr, disasm_inst_t
     uint8_t rt = BITS(inst, 0, 4);
     
     if (V != 0) return false;  /* V必须为0 */
+    /* o3=1 时只有 opc=000 是 SWP，其余为 LDAPR（LRCPC）、RCW*（THE）、ST64B*（LS64）等 */
+    if (o3 && opc != 0) return false;
     
     result->rd = rt;
     result->rn = rn;
@@ -499,28 +502,30 @@ static bool decode_atomic_memory_ops(uint32_t inst, uint64_t addr, disasm_inst_t
     result->rm_type = result->rd_type;
     
     /* 构建助记符后缀 */
-    char suffix[4] = "";
+    const char *suffix = "";
     if (A && R) {
-        strcpy(suffix, "al");
+        suffix = "al";
     } else if (A) {
-        strcpy(suffix, "a");
+        suffix = "a";
     } else if (R) {
-        strcpy(suffix, "l");
+        suffix = "l";
     }
     
     /* 大小后缀 */
-    char size_suffix[2] = "";
+    const char *size_suffix = "";
     if (size == 0) {
-        strcpy(size_suffix, "b");
+        size_suffix = "b";
         result->rd_type = REG_TYPE_W;
         result->rm_type = REG_TYPE_W;
     } else if (size == 1) {
-        strcpy(size_suffix, "h");
+        size_suffix = "h";
         result->rd_type = REG_TYPE_W;
         result->rm_type = REG_TYPE_W;
     }
     
     /* 根据o3和opc确定操作 */
+    strbuf_t sb;
+    strbuf_init(&sb, result->mnemonic, sizeof(result->mnemonic));
     if (o3 == 0) {
         static const struct {
             const char *name;
@@ -536,29 +541,33 @@ static bool decode_atomic_memory_ops(uint32_t inst, uint64_t addr, disasm_inst_t
             { "ldumin", INST_TYPE_LDUMIN },  /* 111 */
         };
         
-        snprintf(result->mnemonic, sizeof(result->mnemonic), "%s%s%s",
-                atomic_ops[opc].name, suffix, size_suffix);
+        strbuf_puts(&sb, atomic_ops[opc].name);
         result->type = atomic_ops[opc].type;
     } else {
         /* o3 == 1: SWP */
-        snprintf(result->mnemonic, sizeof(result->mnemonic), "swp%s%s",
-                suffix, size_suffix);
+        strbuf_puts(&sb, "swp");
         result->type = INST_TYPE_SWP;
     }
+    strbuf_puts(&sb, suffix);
+    strbuf_puts(&sb, size_suffix);
     
+    /* 操作数：Rs（操作值）, Rt（旧值）, [Xn] */
+    add_reg_operand(result, rs, result->rm_type, OPERAND_ACCESS_READ);
+    add_reg_operand(result, rt, result->rd_type, OPERAND_ACCESS_WRITE);
+    add_mem_operand(result, OPERAND_ACCESS_READ | OPERAND_ACCESS_WRITE, (uint16_t)(8u << size));
     return true;
 }
 
 /**
  * 解析CAS指令 - 比较并交换 (ARMv8.1)
- * 编码：size|0010001|o1|1|Rs|o0|11111|Rn|Rt
+ * 编码：size|0010001|L|1|Rs|o0|11111|Rn|Rt
  * mask: 0x3FA07C00, value: 0x08A07C00
  */
 static bool decode_cas(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     uint8_t size = BITS(inst, 30, 31);
-    uint8_t o1 = BIT(inst, 22);
+    uint8_t L = BIT(inst, 22);       /* 获取语义 */
     uint8_t rs = BITS(inst, 16, 20);
-    uint8_t o0 = BIT(inst, 15);
+    uint8_t o0 = BIT(inst, 15);      /* 释放语义 */
     uint8_t rn = BITS(inst, 5, 9);
     uint8_t rt = BITS(inst, 0, 4);
     
@@ -568,8 +577,8 @@ static bool decode_cas(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     result->rn_type = (rn == 31) ? REG_TYPE_SP : REG_TYPE_X;
     result->has_imm = false;
     result->addr_mode = ADDR_MODE_IMM_UNSIGNED;
-    result->is_acquire = o0;
-    result->is_release = o1;
+    result->is_acquire = L;
+    result->is_release = o0;
     result->type = INST_TYPE_CAS;
     
     result->is_64bit = (size == 3);
@@ -577,64 +586,87 @@ static bool decode_cas(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
     result->rm_type = result->rd_type;
     
     /* 构建助记符 */
-    char suffix[4] = "";
-    if (o0 && o1) {
-        strcpy(suffix, "al");
+    const char *suffix = "";
+    if (L && o0) {
+        suffix = "al";
+    } else if (L) {
+        suffix = "a";
     } else if (o0) {
-        strcpy(suffix, "a");
-    } else if (o1) {
-        strcpy(suffix, "l");
+        suffix = "l";
     }
     
-    char size_suffix[2] = "";
+    const char *size_suffix = "";
     if (size == 0) {
-        strcpy(size_suffix, "b");
+        size_suffix = "b";
         result->rd_type = REG_TYPE_W;
         result->rm_type = REG_TYPE_W;
     } else if (size == 1) {
-        strcpy(size_suffix, "h");
+        size_suffix = "h";
         result->rd_type = REG_TYPE_W;
         result->rm_type = REG_TYPE_W;
     }
     
-    snprintf(result->mnemonic, sizeof(result->mnemonic), "cas%s%s", suffix, size_suffix);
+    strbuf_t sb;
+    strbuf_init(&sb, result->mnemonic, sizeof(result->mnemonic));
+    strbuf_puts(&sb, "cas");
+    strbuf_puts(&sb, suffix);
+    strbuf_puts(&sb, size_suffix);
     
+    /* 操作数：Rs（比较值，返回旧值）, Rt（新值）, [Xn] */
+    add_reg_operand(result, rs, result->rm_type, OPERAND_ACCESS_READ | OPERAND_ACCESS_WRITE);
+    add_reg_operand(result, rt, result->rd_type, OPERAND_ACCESS_READ);
+    add_mem_operand(result, OPERAND_ACCESS_READ | OPERAND_ACCESS_WRITE, (uint16_t)(8u << size));
     return true;
 }
 
+#endif /* ARM64_DISASM_HAS_ATOMICS */
+
 /* ========== 加载/存储解码表 ========== */
 
-const decode_entry_t load_store_decode_table[] = {
-    /* 独占加载/存储: bits[29:24] = 001000 */
-    DECODE_ENTRY(0x3F000000, 0x08000000, decode_load_store_exclusive),
-    
-    /* CAS指令: bits[29:23] = 0010001, bits[14:10] = 11111 */
-    DECODE_ENTRY(0x3FA07C00, 0x08A07C00, decode_cas),
-    
-    /* 原子内存操作: bits[29:27] = 111, bits[25:24] = 00, bit[21] = 1, bits[11:10] = 00 */
-    DECODE_ENTRY(0x3B200C00, 0x38200000, decode_atomic_memory_ops),
-    
-    /* 加载/存储对: bits[31:30]|101|V|... */
-    DECODE_ENTRY(0x3A000000, 0x28000000, decode_ls_pair),
-    
-    /* 加载字面量: bits[29:27] = 011, bits[25:24] = 00 */
-    DECODE_ENTRY(0x3B000000, 0x18000000, decode_load_literal),
-    
-    /* 无符号立即数偏移: bits[29:27] = 111, bits[25:24] = 01 */
-    DECODE_ENTRY(0x3B000000, 0x39000000, decode_ls_unsigned_imm),
-    
-    /* 寄存器偏移: bits[29:27] = 111, bits[25:24] = 00, bit[21] = 1, bits[11:10] = 10 */
-    DECODE_ENTRY(0x3B200C00, 0x38200800, decode_ls_reg_offset),
-    
-    /* 未缩放立即数/预索引/后索引: bits[29:27] = 111, bits[25:24] = 00, bit[21] = 0 */
-    DECODE_ENTRY(0x3B200000, 0x38000000, decode_ls_unscaled_imm),
-};
+#if ARM64_DISASM_HAS_ATOMICS
+#define ATOMICS_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)             \
+    /* CAS指令: bits[29:23] = 0010001, bits[14:10] = 11111（在独占加载/存储的编码空间内，须先匹配） */ \
+    DECODE_ENTRY_EXT(0x3FA07C00, 0x08A07C00, decode_cas, ARM64_EXT_LSE)                 \
+                                                                                        \
+    /* 独占加载/存储: bits[29:24] = 001000 */                                           \
+    DECODE_ENTRY(0x3F000000, 0x08000000, decode_load_store_exclusive)                   \
+                                                                                        \
+    /* 原子内存操作: bits[29:27] = 111, bits[25:24] = 00, bit[21] = 1, bits[11:10] = 00 */ \
+    DECODE_ENTRY_EXT(0x3B200C00, 0x38200000, decode_atomic_memory_ops, ARM64_EXT_LSE)
+#else
+#define ATOMICS_ENTRIES DECODE_NO_ENTRIES
+#endif
+
+#if ARM64_DISASM_HAS_LOAD_STORE
+#define LOAD_STORE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)          \
+    /* 加载/存储对: bits[31:30]|101|V|... */                                            \
+    DECODE_ENTRY(0x3A000000, 0x28000000, decode_ls_pair)                                \
+                                                                                        \
+    /* 加载字面量: bits[29:27] = 011, bits[25:24] = 00 */                               \
+    DECODE_ENTRY(0x3B000000, 0x18000000, decode_load_literal)                           \
+                                                                                        \
+    /* 无符号立即数偏移: bits[29:27] = 111, bits[25:24] = 01 */                         \
+    DECODE_ENTRY(0x3B000000, 0x39000000, decode_ls_unsigned_imm)                        \
+                                                                                        \
+    /* 寄存器偏移: bits[29:27] = 111, bits[25:24] = 00, bit[21] = 1, bits[11:10] = 10 */ \
+    DECODE_ENTRY(0x3B200C00, 0x38200800, decode_ls_reg_offset)                          \
+                                                                                        \
+    /* 未缩放立即数/预索引/后索引: bits[29:27] = 111, bits[25:24] = 00, bit[21] = 0 */  \
+    DECODE_ENTRY(0x3B200000, 0x38000000, decode_ls_unscaled_imm)
+#else
+#define LOAD_STORE_ENTRIES DECODE_NO_ENTRIES
+#endif
 
-const size_t load_store_decode_table_size = ARRAY_SIZE(load_store_decode_table);
+#define LOAD_STORE_DECODE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)   \
+    ATOMICS_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)                 \
+    LOAD_STORE_ENTRIES(DECODE_ENTRY, DECODE_ENTRY_NAMED, DECODE_ENTRY_EXT)
+
+DEFINE_DECODE_TABLE(load_store_decode_table, LOAD_STORE_DECODE_ENTRIES);
 
 /* ========== 主加载/存储解析函数（表驱动） ========== */
 
 bool decode_load_store(uint32_t inst, uint64_t addr, disasm_inst_t *result) {
-    return decode_with_table(load_store_decode_table, load_store_decode_table_size,
-                            inst, addr, result);
+    return decode_with_table(&load_store_decode_table, inst, addr, result);
 }
+
+#endif /* ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS */
@@ -0,0 +1,608 @@
+/**
+ * ARM64反汇编器 - CPython 扩展模块
+ * 接受任意支持缓冲区协议的对象（bytes、bytearray、mmap、numpy 数组），
+ * 释放 GIL 后批量解码（可多线程），结果为定长记录数组，通过缓冲区协议直接交给 numpy，
+ * 不为每条指令创建 Python 对象
+ *
+ *   import arm64_disasm, numpy as np
+ *   rec = np.asarray(arm64_disasm.decode(mm, address=0x400000, threads=0))
+ *   calls = rec[rec["type"] == arm64_disasm.TYPE_BL]
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "arm64_disasm.h"
+#include "arm64_timeline.h"
+#include <string.h>
+
+#ifndef _WIN32
+    #include <pthread.h>
+    #include <unistd.h>
+    #define ARM64_PY_THREADS 1
+#endif
+
+/* 每批转换的指令字数量（栈上缓冲区） */
+#define BATCH_WORDS 64
+
+/* 多线程时每个线程至少处理的指令数，太少时线程开销超过收益 */
+#define MIN_WORDS_PER_THREAD 65536
+
+#define MAX_THREADS 64
+
+/* ========== 记录格式 ========== */
+
+/* 记录标志位 */
+#define RECORD_VALID        0x01    // 解码成功
+#define RECORD_64BIT        0x02    // 64位操作
+#define RECORD_SET_FLAGS    0x04    // 设置标志位
+#define RECORD_HAS_IMM      0x08    // imm 有效
+#define RECORD_HAS_TARGET   0x10    // target 有效（直接分支、ADR/ADRP）
+
+/* 单条指令的定长记录（40字节，字段自然对齐，无填充） */
+typedef struct {
+    uint64_t address;       // 指令地址
+    uint64_t target;        // 分支/ADR/ADRP 目标地址
+    int64_t imm;            // 立即数
+    uint32_t props;         // INST_PROP_* 组合
+    uint32_t raw;           // 原始指令编码
+    uint16_t type;          // inst_type_t
+    uint8_t rd;
+    uint8_t rn;
+    uint8_t rm;
+    uint8_t cond;
+    uint8_t flags;          // RECORD_* 组合
+    uint8_t operand_count;
+} record_t;
+
+/* 与 record_t 对应的 PEP 3118 格式串（主机字节序），numpy 据此生成结构化 dtype */
+static const char record_format[] =
+    "T{=Q:address:=Q:target:=q:imm:=I:props:=I:raw:=H:type:"
+    "B:rd:B:rn:B:rm:B:cond:B:flags:B:operand_count:}";
+
+/* numpy.dtype 描述（字段名, 类型） */
+static const struct {
+    const char *name;
+    const char *type;
+} record_fields[] = {
+    { "address", "=u8" }, { "target", "=u8" }, { "imm", "=i8" },
+    { "props", "=u4" }, { "raw", "=u4" }, { "type", "=u2" },
+    { "rd", "u1" }, { "rn", "u1" }, { "rm", "u1" }, { "cond", "u1" },
+    { "flags", "u1" }, { "operand_count", "u1" },
+};
+
+_Static_assert(sizeof(record_t) == 40, "record_t layout must match record_format");
+
+/* ========== 解码内核（不持有 GIL） ========== */
+
+static void fill_record(const disasm_inst_t *inst, bool ok, record_t *rec) {
+    uint64_t target;
+
+    if (!ok) {
+        memset(rec, 0, sizeof(*rec));
+        rec->address = inst->address;
+        rec->raw = inst->raw;
+        rec->type = INST_TYPE_UNKNOWN;
+        return;
+    }
+
+    rec->address = inst->address;
+    rec->raw = inst->raw;
+    rec->type = (uint16_t)inst->type;
+    rec->rd = inst->rd;
+    rec->rn = inst->rn;
+    rec->rm = inst->rm;
+    rec->cond = inst->cond;
+    rec->imm = inst->imm;
+    rec->props = get_inst_props(inst);
+    rec->operand_count = inst->operand_count;
+    rec->flags = RECORD_VALID |
+                 (inst->is_64bit ? RECORD_64BIT : 0) |
+                 (inst->set_flags ? RECORD_SET_FLAGS : 0) |
+                 (inst->has_imm ? RECORD_HAS_IMM : 0);
+    if (get_branch_target(inst, &target)) {
+        rec->target = target;
+        rec->flags |= RECORD_HAS_TARGET;
+    } else {
+        rec->target = 0;
+    }
+}
+
+/* 一个线程的解码区间 */
+typedef struct {
+    const uint8_t *bytes;
+    size_t count;
+    uint64_t address;
+    arm64_endian_t endian;
+    record_t *out;
+    size_t decoded;         // 输出：成功解码的指令数
+} decode_job_t;
+
+static void *decode_job(void *arg) {
+    decode_job_t *job = (decode_job_t *)arg;
+    uint32_t words[BATCH_WORDS];
+    disasm_inst_t inst;
+    size_t decoded = 0;
+
+    ARM64_TIMELINE_BEGIN("decode", job->address, job->address + job->count * 4, 0, 0);
+    for (size_t done = 0; done < job->count; ) {
+        size_t n = job->count - done;
+        if (n > BATCH_WORDS) {
+            n = BATCH_WORDS;
+        }
+        arm64_load_words(job->bytes + done * 4, n * 4, job->endian, words);
+
+        for (size_t i = 0; i < n; i++) {
+            uint64_t addr = job->address + (done + i) * 4;
+            bool ok = disassemble_arm64(words[i], addr, &inst);
+            inst.raw = words[i];
+            inst.address = addr;
+            fill_record(&inst, ok, &job->out[done + i]);
+            decoded += ok;
+        }
+        done += n;
+    }
+    ARM64_TIMELINE_END("decode", job->address, job->address + job->count * 4,
+                       job->count * 4, job->count);
+
+    job->decoded = decoded;
+    return NULL;
+}
+
+/**
+ * 把 count 条指令分给最多 threads 个线程解码
+ * 线程创建失败时由当前线程处理剩余区间
+ * @return 成功解码的指令数
+ */
+static size_t decode_parallel(const uint8_t *bytes, size_t count, uint64_t address,
+                              arm64_endian_t endian, record_t *out, int threads) {
+    decode_job_t jobs[MAX_THREADS];
+
+    if (threads > MAX_THREADS) {
+        threads = MAX_THREADS;
+    }
+    if ((size_t)threads > count / MIN_WORDS_PER_THREAD) {
+        threads = (int)(count / MIN_WORDS_PER_THREAD);
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+
+    size_t per_thread = (count + (size_t)threads - 1) / (size_t)threads;
+    for (int t = 0; t < threads; t++) {
+        size_t start = (size_t)t * per_thread;
+        size_t n = start < count ? count - start : 0;
+        jobs[t].bytes = bytes + start * 4;
+        jobs[t].count = n < per_thread ? n : per_thread;
+        jobs[t].address = address + start * 4;
+        jobs[t].endian = endian;
+        jobs[t].out = out + start;
+        jobs[t].decoded = 0;
+    }
+
+#ifdef ARM64_PY_THREADS
+    pthread_t tids[MAX_THREADS];
+    bool started[MAX_THREADS] = { false };
+    for (int t = 1; t < threads; t++) {
+        started[t] = pthread_create(&tids[t], NULL, decode_job, &jobs[t]) == 0;
+    }
+    decode_job(&jobs[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) {
+            pthread_join(tids[t], NULL);
+        } else {
+            decode_job(&jobs[t]);
+        }
+    }
+#else
+    for (int t = 0; t < threads; t++) {
+        decode_job(&jobs[t]);
+    }
+#endif
+
+    size_t decoded = 0;
+    for (int t = 0; t < threads; t++) {
+        decoded += jobs[t].decoded;
+    }
+    return decoded;
+}
+
+static int cpu_count(void) {
+#ifdef ARM64_PY_THREADS
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#else
+    return 1;
+#endif
+}
+
+/* ========== Records 类型 ========== */
+
+/* 解码结果：连续的 record_t 数组，以一维结构化缓冲区导出 */
+typedef struct {
+    PyObject_HEAD
+    record_t *records;
+    Py_ssize_t count;
+    Py_ssize_t decoded;
+    Py_ssize_t shape[1];
+    Py_ssize_t strides[1];
+} records_object;
+
+static void records_dealloc(records_object *self) {
+    PyMem_RawFree(self->records);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int records_getbuffer(records_object *self, Py_buffer *view, int flags) {
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "Records is read-only");
+        view->obj = NULL;
+        return -1;
+    }
+    view->obj = (PyObject *)self;
+    Py_INCREF(self);
+    view->buf = self->records;
+    view->len = self->count * (Py_ssize_t)sizeof(record_t);
+    view->readonly = 1;
+    view->itemsize = sizeof(record_t);
+    view->format = (flags & PyBUF_FORMAT) ? (char *)record_format : NULL;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static Py_ssize_t records_length(records_object *self) {
+    return self->count;
+}
+
+static PyObject *records_get_decoded(records_object *self, void *closure) {
+    (void)closure;
+    return PyLong_FromSsize_t(self->decoded);
+}
+
+static PyBufferProcs records_as_buffer = {
+    .bf_getbuffer = (getbufferproc)records_getbuffer,
+};
+
+static PySequenceMethods records_as_sequence = {
+    .sq_length = (lenfunc)records_length,
+};
+
+static PyGetSetDef records_getset[] = {
+    { "decoded", (getter)records_get_decoded, NULL, "成功解码的指令数", NULL },
+    { NULL }
+};
+
+static PyTypeObject records_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "arm64_disasm.Records",
+    .tp_basicsize = sizeof(records_object),
+    .tp_dealloc = (destructor)records_dealloc,
+    .tp_as_sequence = &records_as_sequence,
+    .tp_as_buffer = &records_as_buffer,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "解码结果：record_t 数组，用 numpy.asarray() 取得结构化数组视图（不复制）",
+    .tp_getset = records_getset,
+};
+
+/* ========== 模块函数 ========== */
+
+static bool parse_endian(const char *name, arm64_endian_t *endian) {
+    if (strcmp(name, "little") == 0) {
+        *endian = ARM64_ENDIAN_LITTLE;
+    } else if (strcmp(name, "big") == 0) {
+        *endian = ARM64_ENDIAN_BIG;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "endian must be 'little' or 'big'");
+        return false;
+    }
+    return true;
+}
+
+PyDoc_STRVAR(decode_doc,
+"decode(code, address=0, endian='little', threads=1, out=None)\n"
+"\n"
+"批量解码 code（任意缓冲区协议对象，末尾不足4字节的部分忽略）。\n"
+"解码期间释放 GIL；threads>1 时分段多线程解码，threads=0 使用全部 CPU。\n"
+"未给出 out 时返回 Records；给出可写缓冲区 out 时直接写入并返回解码成功的指令数。");
+
+static PyObject *py_decode(PyObject *module, PyObject *args, PyObject *kwargs) {
+    static char *keywords[] = { "code", "address", "endian", "threads", "out", NULL };
+    Py_buffer code;
+    unsigned long long address = 0;
+    const char *endian_name = "little";
+    int threads = 1;
+    PyObject *out_obj = Py_None;
+    arm64_endian_t endian;
+    (void)module;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "y*|KsiO:decode", keywords,
+                                     &code, &address, &endian_name, &threads, &out_obj)) {
+        return NULL;
+    }
+    if (!parse_endian(endian_name, &endian)) {
+        PyBuffer_Release(&code);
+        return NULL;
+    }
+    if (threads <= 0) {
+        threads = cpu_count();
+    }
+
+    size_t count = (size_t)code.len / 4;
+    records_object *result = NULL;
+    Py_buffer out;
+    record_t *records;
+
+    if (out_obj != Py_None) {
+        if (PyObject_GetBuffer(out_obj, &out, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+            PyBuffer_Release(&code);
+            return NULL;
+        }
+        if ((size_t)out.len < count * sizeof(record_t)) {
+            PyErr_Format(PyExc_ValueError, "out needs %zu bytes, got %zd",
+                         count * sizeof(record_t), out.len);
+            PyBuffer_Release(&out);
+            PyBuffer_Release(&code);
+            return NULL;
+        }
+        records = (record_t *)out.buf;
+    } else {
+        result = PyObject_New(records_object, &records_type);
+        if (!result) {
+            PyBuffer_Release(&code);
+            return NULL;
+        }
+        result->records = PyMem_RawMalloc(count ? count * sizeof(record_t) : 1);
+        result->count = (Py_ssize_t)count;
+        result->shape[0] = (Py_ssize_t)count;
+        result->strides[0] = sizeof(record_t);
+        if (!result->records) {
+            Py_DECREF(result);
+            PyBuffer_Release(&code);
+            return PyErr_NoMemory();
+        }
+        records = result->records;
+    }
+
+    size_t decoded;
+    Py_BEGIN_ALLOW_THREADS
+    decoded = decode_parallel((const uint8_t *)code.buf, count, address, endian,
+                              records, threads);
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&code);
+    if (!result) {
+        PyBuffer_Release(&out);
+        return PyLong_FromSize_t(decoded);
+    }
+    result->decoded = (Py_ssize_t)decoded;
+    return (PyObject *)result;
+}
+
+PyDoc_STRVAR(format_doc,
+"format(raw, address=0)\n"
+"\n"
+"反汇编单条指令，返回 format_instruction 的文本；无法解码时返回 None。");
+
+static PyObject *py_format(PyObject *module, PyObject *args, PyObject *kwargs) {
+    static char *keywords[] = { "raw", "address", NULL };
+    unsigned int raw;
+    unsigned long long address = 0;
+    disasm_inst_t inst;
+    char text[128];
+    (void)module;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "I|K:format", keywords, &raw, &address)) {
+        return NULL;
+    }
+    if (!disassemble_arm64(raw, address, &inst)) {
+        Py_RETURN_NONE;
+    }
+    format_instruction(&inst, text, sizeof(text));
+    return PyUnicode_FromString(text);
+}
+
+PyDoc_STRVAR(timeline_start_doc,
+"timeline_start(events=0)\n"
+"\n"
+"开始记录阶段时间线；events 为每个线程缓冲区的事件数，0 使用默认值。");
+
+static PyObject *py_timeline_start(PyObject *module, PyObject *args, PyObject *kwargs) {
+    static char *keywords[] = { "events", NULL };
+    Py_ssize_t events = 0;
+    (void)module;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|n:timeline_start", keywords, &events)) {
+        return NULL;
+    }
+    if (events < 0) {
+        PyErr_SetString(PyExc_ValueError, "events must be >= 0");
+        return NULL;
+    }
+    if (!arm64_timeline_start((size_t)events)) {
+        return PyErr_NoMemory();
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(timeline_stop_doc,
+"timeline_stop()\n"
+"\n"
+"停止记录，返回 (已记录事件数, 丢弃事件数)。");
+
+static PyObject *py_timeline_stop(PyObject *module, PyObject *args) {
+    uint64_t recorded, dropped;
+    (void)module;
+    (void)args;
+
+    arm64_timeline_stop();
+    arm64_timeline_counts(&recorded, &dropped);
+    return Py_BuildValue("(KK)", (unsigned long long)recorded, (unsigned long long)dropped);
+}
+
+PyDoc_STRVAR(timeline_export_doc,
+"timeline_export(path, clear=True)\n"
+"\n"
+"把已记录的事件写成 Chrome trace-event JSON，返回写入的事件数；clear 为真时随后清空。");
+
+static PyObject *py_timeline_export(PyObject *module, PyObject *args, PyObject *kwargs) {
+    static char *keywords[] = { "path", "clear", NULL };
+    PyObject *path;
+    int clear = 1;
+    long written;
+    (void)module;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&|p:timeline_export", keywords,
+                                     PyUnicode_FSConverter, &path, &clear)) {
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    written = arm64_timeline_export(PyBytes_AS_STRING(path));
+    Py_END_ALLOW_THREADS
+    if (written < 0) {
+        PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+        Py_DECREF(path);
+        return NULL;
+    }
+    Py_DECREF(path);
+    if (clear) {
+        arm64_timeline_clear();
+    }
+    return PyLong_FromLong(written);
+}
+
+static PyMethodDef module_methods[] = {
+    { "decode", (PyCFunction)(void (*)(void))py_decode, METH_VARARGS | METH_KEYWORDS, decode_doc },
+    { "format", (PyCFunction)(void (*)(void))py_format, METH_VARARGS | METH_KEYWORDS, format_doc },
+    { "timeline_start", (PyCFunction)(void (*)(void))py_timeline_start,
+      METH_VARARGS | METH_KEYWORDS, timeline_start_doc },
+    { "timeline_stop", py_timeline_stop, METH_NOARGS, timeline_stop_doc },
+    { "timeline_export", (PyCFunction)(void (*)(void))py_timeline_export,
+      METH_VARARGS | METH_KEYWORDS, timeline_export_doc },
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef module_def = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "arm64_disasm",
+    .m_doc = "ARM64 反汇编器：批量解码为结构化记录数组",
+    .m_size = -1,
+    .m_methods = module_methods,
+};
+
+/* ========== 模块常量 ========== */
+
+static int add_constants(PyObject *module) {
+    static const struct {
+        const char *name;
+        long value;
+    } constants[] = {
+        { "RECORD_SIZE", (long)sizeof(record_t) },
+        { "FLAG_VALID", RECORD_VALID },
+        { "FLAG_64BIT", RECORD_64BIT },
+        { "FLAG_SET_FLAGS", RECORD_SET_FLAGS },
+        { "FLAG_HAS_IMM", RECORD_HAS_IMM },
+        { "FLAG_HAS_TARGET", RECORD_HAS_TARGET },
+        { "PROP_MEM_READ", INST_PROP_MEM_READ },
+        { "PROP_MEM_WRITE", INST_PROP_MEM_WRITE },
+        { "PROP_BRANCH", INST_PROP_BRANCH },
+        { "PROP_CONDITIONAL", INST_PROP_CONDITIONAL },
+        { "PROP_CALL", INST_PROP_CALL },
+        { "PROP_RETURN", INST_PROP_RETURN },
+        { "PROP_INDIRECT", INST_PROP_INDIRECT },
+        { "PROP_SETS_FLAGS", INST_PROP_SETS_FLAGS },
+        { "PROP_READS_FLAGS", INST_PROP_READS_FLAGS },
+        { "PROP_BARRIER", INST_PROP_BARRIER },
+        { "PROP_ATOMIC", INST_PROP_ATOMIC },
+        { "PROP_EXCLUSIVE", INST_PROP_EXCLUSIVE },
+        { "PROP_ACQUIRE", INST_PROP_ACQUIRE },
+        { "PROP_RELEASE", INST_PROP_RELEASE },
+        { "PROP_PRIVILEGED", INST_PROP_PRIVILEGED },
+        { "PROP_EXCEPTION", INST_PROP_EXCEPTION },
+        { "PROP_SYSTEM", INST_PROP_SYSTEM },
+        { "PROP_FP_SIMD", INST_PROP_FP_SIMD },
+    };
+
+    for (size_t i = 0; i < sizeof(constants) / sizeof(constants[0]); i++) {
+        if (PyModule_AddIntConstant(module, constants[i].name, constants[i].value) < 0) {
+            return -1;
+        }
+    }
+
+    /* TYPE_NAMES[type] 为类型名称；同时导出 TYPE_<名称大写>，多个类型同名时保留第一个 */
+    PyObject *names = PyTuple_New(INST_TYPE_COUNT);
+    if (!names) {
+        return -1;
+    }
+    for (int t = 0; t < INST_TYPE_COUNT; t++) {
+        const char *name = get_inst_type_name((inst_type_t)t);
+        PyObject *s = PyUnicode_FromString(name);
+        if (!s) {
+            Py_DECREF(names);
+            return -1;
+        }
+        PyTuple_SET_ITEM(names, t, s);
+
+        char attr[40] = "TYPE_";
+        size_t len = 5;
+        for (const char *p = name; *p && len < sizeof(attr) - 1; p++) {
+            attr[len++] = (*p >= 'a' && *p <= 'z') ? (char)(*p - 'a' + 'A') : *p;
+        }
+        attr[len] = '\0';
+        if (!PyObject_HasAttrString(module, attr) &&
+            PyModule_AddIntConstant(module, attr, t) < 0) {
+            Py_DECREF(names);
+            return -1;
+        }
+    }
+    if (PyModule_AddObject(module, "TYPE_NAMES", names) < 0) {
+        Py_DECREF(names);
+        return -1;
+    }
+
+    /* DTYPE：可直接传给 numpy.dtype() 的字段列表 */
+    size_t nfields = sizeof(record_fields) / sizeof(record_fields[0]);
+    PyObject *dtype = PyList_New((Py_ssize_t)nfields);
+    if (!dtype) {
+        return -1;
+    }
+    for (size_t i = 0; i < nfields; i++) {
+        PyObject *field = Py_BuildValue("(ss)", record_fields[i].name, record_fields[i].type);
+        if (!field) {
+            Py_DECREF(dtype);
+            return -1;
+        }
+        PyList_SET_ITEM(dtype, (Py_ssize_t)i, field);
+    }
+    if (PyModule_AddObject(module, "DTYPE", dtype) < 0) {
+        Py_DECREF(dtype);
+        return -1;
+    }
+    return 0;
+}
+
+PyMODINIT_FUNC PyInit_arm64_disasm(void) {
+    if (PyType_Ready(&records_type) < 0) {
+        return NULL;
+    }
+
+    PyObject *module = PyModule_Create(&module_def);
+    if (!module) {
+        return NULL;
+    }
+
+    Py_INCREF(&records_type);
+    if (PyModule_AddObject(module, "Records", (PyObject *)&records_type) < 0) {
+        Py_DECREF(&records_type);
+        Py_DECREF(module);
+        return NULL;
+    }
+    if (add_constants(module) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}
@@ -4,165 +4,210 @@
  */
 
 #include "arm64_disasm.h"
+#include "arm64_strbuf.h"
+#ifndef ARM64_DISASM_FREESTANDING
 #include <stdio.h>
-#include <string.h>
+#endif
 
 /* 寄存器名称表 */
-static const char *x_reg_names[] = {
+static const char *const x_reg_names[] = {
     "x0",  "x1",  "x2",  "x3",  "x4",  "x5",  "x6",  "x7",
     "x8",  "x9",  "x10", "x11", "x12", "x13", "x14", "x15",
     "x16", "x17", "x18", "x19", "x20", "x21", "x22", "x23",
     "x24", "x25", "x26", "x27", "x28", "fp",  "lr",  "xzr"
 };
 
-static const char *w_reg_names[] = {
+static const char *const w_reg_names[] = {
     "w0",  "w1",  "w2",  "w3",  "w4",  "w5",  "w6",  "w7",
     "w8",  "w9",  "w10", "w11", "w12", "w13", "w14", "w15",
     "w16", "w17", "w18", "w19", "w20", "w21", "w22", "w23",
     "w24", "w25", "w26", "w27", "w28", "w29", "w30", "wzr"
 };
 
+/* 标量SIMD/FP寄存器名前缀，按 reg_type_t 索引 */
+static const char fp_reg_prefix[] = {
+    [REG_TYPE_V] = 'v', [REG_TYPE_B] = 'b', [REG_TYPE_H] = 'h',
+    [REG_TYPE_S] = 's', [REG_TYPE_D] = 'd', [REG_TYPE_Q] = 'q'
+};
+
 /**
- * 获取寄存器名称（表驱动版本）
+ * 追加寄存器名称
  */
-void get_register_name(uint8_t reg_num, reg_type_t reg_type, char *buffer) {
-    if (reg_num > 31) {
-        sprintf(buffer, "?%d", reg_num);
+static void put_register(strbuf_t *sb, disasm_reg_names_t names, uint8_t reg_num,
+                         reg_type_t reg_type) {
+    if (reg_num > 31 || (unsigned)reg_type > REG_TYPE_Q) {
+        strbuf_putc(sb, '?');
+        strbuf_put_uint(sb, reg_num, 10, 1);
         return;
     }
     
     switch (reg_type) {
         case REG_TYPE_X:
-            strcpy(buffer, x_reg_names[reg_num]);
+            if (names == DISASM_REGS_NUMERIC && (reg_num == 29 || reg_num == 30)) {
+                strbuf_putc(sb, 'x');
+                strbuf_put_uint(sb, reg_num, 10, 1);
+            } else {
+                strbuf_puts(sb, x_reg_names[reg_num]);
+            }
             break;
         case REG_TYPE_W:
-            strcpy(buffer, w_reg_names[reg_num]);
+            strbuf_puts(sb, w_reg_names[reg_num]);
             break;
         case REG_TYPE_SP:
-            strcpy(buffer, "sp");
+            strbuf_puts(sb, "sp");
             break;
         case REG_TYPE_XZR:
-            strcpy(buffer, "xzr");
+            strbuf_puts(sb, "xzr");
             break;
         case REG_TYPE_WZR:
-            strcpy(buffer, "wzr");
-            break;
-        case REG_TYPE_V:
-            sprintf(buffer, "v%d", reg_num);
-            break;
-        case REG_TYPE_B:
-            sprintf(buffer, "b%d", reg_num);
-            break;
-        case REG_TYPE_H:
-            sprintf(buffer, "h%d", reg_num);
-            break;
-        case REG_TYPE_S:
-            sprintf(buffer, "s%d", reg_num);
-            break;
-        case REG_TYPE_D:
-            sprintf(buffer, "d%d", reg_num);
-            break;
-        case REG_TYPE_Q:
-            sprintf(buffer, "q%d", reg_num);
+            strbuf_puts(sb, "wzr");
             break;
         default:
-            sprintf(buffer, "?%d", reg_num);
+            strbuf_putc(sb, fp_reg_prefix[reg_type]);
+            strbuf_put_uint(sb, reg_num, 10, 1);
             break;
     }
 }
 
+/**
+ * 获取寄存器名称（表驱动版本）
+ */
+void get_register_name(uint8_t reg_num, reg_type_t reg_type, char *buffer) {
+    strbuf_t sb;
+    strbuf_init(&sb, buffer, 16);
+    put_register(&sb, DISASM_REGS_ALIAS, reg_num, reg_type);
+}
+
 /* 扩展类型名称表 */
-static const char *extend_names[] = {
+static const char *const extend_names[] = {
     "uxtb", "uxth", "uxtw", "uxtx",
     "sxtb", "sxth", "sxtw", "sxtx",
-    "lsl"
+    "lsl", "lsr", "asr", "ror"
 };
 
 /**
  * 获取扩展类型名称（表驱动版本）
  */
 static const char* get_extend_name(extend_t extend) {
-    if (extend <= EXTEND_LSL) {
+    if (extend <= EXTEND_ROR) {
         return extend_names[extend];
     }
     return "";
 }
 
-/**
- * 格式化寄存器操作数
- */
-static void format_register_operand(const disasm_inst_t *inst, char *buffer, size_t size, 
-                                     uint8_t reg_num, reg_type_t reg_type) {
-    char reg_name[16];
-    get_register_name(reg_num, reg_type, reg_name);
-    
-    // 现在完全由解码阶段决定寄存器类型（X/W vs SP/XZR/WZR），
-    // 这里不再根据指令类型进行启发式修改，避免将应为XZR/WZR的寄存器误打印为SP。
-    snprintf(buffer, size, "%s", reg_name);
+/* 条件码名称表 */
+static const char *const cond_names[] = {
+    "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
+    "hi", "ls", "ge", "lt", "gt", "le", "al", "nv"
+};
+
+/* 追加操作数分隔符 */
+static inline void put_sep(strbuf_t *sb) {
+    strbuf_puts(sb, ", ");
+}
+
+/* 追加 "#0x..." 形式的立即数 */
+static inline void put_imm_hex(strbuf_t *sb, uint64_t value) {
+    strbuf_putc(sb, '#');
+    strbuf_put_hex(sb, value);
+}
+
+/* 追加 "#..." 形式的十进制立即数 */
+static inline void put_imm_dec(strbuf_t *sb, int64_t value) {
+    strbuf_putc(sb, '#');
+    strbuf_put_dec(sb, value);
+}
+
+/* 追加以逗号分隔的寄存器列表的一项 */
+static inline void put_reg_sep(strbuf_t *sb, disasm_reg_names_t names, uint8_t reg_num,
+                               reg_type_t reg_type) {
+    put_sep(sb);
+    put_register(sb, names, reg_num, reg_type);
 }
 
+#if ARM64_DISASM_HAS_LOAD_STORE
 /**
  * 格式化内存操作数
  */
-static void format_memory_operand(const disasm_inst_t *inst, char *buffer, size_t size) {
-    char base_reg[16];
-    get_register_name(inst->rn, inst->rn_type, base_reg);
+static void format_memory_operand(const disasm_inst_t *inst, disasm_reg_names_t names,
+                                  strbuf_t *sb) {
+    if (inst->addr_mode == ADDR_MODE_LITERAL) {
+        strbuf_put_hex(sb, inst->address + inst->imm);
+        return;
+    }
     
+    strbuf_putc(sb, '[');
     // 如果基址寄存器是31，通常是SP
     if (inst->rn == 31) {
-        strcpy(base_reg, "sp");
+        strbuf_puts(sb, "sp");
+    } else {
+        put_register(sb, names, inst->rn, inst->rn_type);
     }
     
     switch (inst->addr_mode) {
         case ADDR_MODE_IMM_UNSIGNED:
         case ADDR_MODE_IMM_SIGNED:
-            if (inst->imm == 0) {
-                snprintf(buffer, size, "[%s]", base_reg);
-            } else {
-                snprintf(buffer, size, "[%s, #%lld]", base_reg, (long long)inst->imm);
+            if (inst->imm != 0) {
+                put_sep(sb);
+                put_imm_dec(sb, inst->imm);
             }
+            strbuf_putc(sb, ']');
             break;
             
         case ADDR_MODE_PRE_INDEX:
-            snprintf(buffer, size, "[%s, #%lld]!", base_reg, (long long)inst->imm);
+            put_sep(sb);
+            put_imm_dec(sb, inst->imm);
+            strbuf_puts(sb, "]!");
             break;
             
         case ADDR_MODE_POST_INDEX:
-            snprintf(buffer, size, "[%s], #%lld", base_reg, (long long)inst->imm);
+            strbuf_puts(sb, "], ");
+            put_imm_dec(sb, inst->imm);
             break;
             
-        case ADDR_MODE_REG_OFFSET: {
-            char offset_reg[16];
-            get_register_name(inst->rm, inst->rm_type, offset_reg);
-            snprintf(buffer, size, "[%s, %s]", base_reg, offset_reg);
+        case ADDR_MODE_REG_OFFSET:
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
+            strbuf_putc(sb, ']');
             break;
-        }
-            
-        case ADDR_MODE_REG_EXTEND: {
-            char offset_reg[16];
-            get_register_name(inst->rm, inst->rm_type, offset_reg);
-            const char *extend_name = get_extend_name(inst->extend_type);
             
+        case ADDR_MODE_REG_EXTEND:
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
+            put_sep(sb);
+            strbuf_puts(sb, get_extend_name(inst->extend_type));
             if (inst->shift_amount > 0) {
-                snprintf(buffer, size, "[%s, %s, %s #%d]", 
-                        base_reg, offset_reg, extend_name, inst->shift_amount);
-            } else {
-                snprintf(buffer, size, "[%s, %s, %s]", 
-                        base_reg, offset_reg, extend_name);
+                strbuf_puts(sb, " #");
+                strbuf_put_dec(sb, inst->shift_amount);
             }
-            break;
-        }
-            
-        case ADDR_MODE_LITERAL:
-            snprintf(buffer, size, "0x%llx", (unsigned long long)(inst->address + inst->imm));
+            strbuf_putc(sb, ']');
             break;
             
         default:
-            snprintf(buffer, size, "[%s]", base_reg);
+            strbuf_putc(sb, ']');
             break;
     }
 }
 
+/**
+ * 追加预取操作名（如 pldl1keep），未分配的操作以 "#imm" 形式输出
+ * prfop = type(2)|target(2)|policy(1)
+ */
+static void put_prefetch_op(strbuf_t *sb, uint8_t prfop) {
+    static const char *const types[] = { "pld", "pli", "pst" };
+    uint8_t type = prfop >> 3;
+    uint8_t target = (prfop >> 1) & 0x3;
+    
+    if (type > 2 || target > 2) {
+        put_imm_dec(sb, prfop);
+        return;
+    }
+    strbuf_puts(sb, types[type]);
+    strbuf_putc(sb, 'l');
+    strbuf_putc(sb, (char)('1' + target));
+    strbuf_puts(sb, (prfop & 1) ? "strm" : "keep");
+}
+#endif
+
+#if ARM64_DISASM_HAS_SYSTEM
 typedef struct {
     uint8_t op0;
     uint8_t op1;
@@ -218,16 +263,17 @@ static const char* get_system_reg_name(uint8_t op0, uint8_t op1,
     }
     return NULL;
 }
+#endif
 
 /**
- * 将反汇编指令格式化为字符串
+ * 追加指令的操作数部分
+ * 未编译进库的指令组不会产生对应类型，其格式化分支一并去掉
  */
-void format_instruction(const disasm_inst_t *inst, char *buffer, size_t buffer_size) {
-    char operands[256] = {0};
-    char reg_dst[16], reg_src1[16], reg_src2[16], reg_t2[16];
-    
+static void format_operands(const disasm_inst_t *inst, disasm_reg_names_t names,
+                            strbuf_t *sb) {
     // 根据指令类型格式化操作数
     switch (inst->type) {
+#if ARM64_DISASM_HAS_LOAD_STORE
         // 加载/存储指令
         case INST_TYPE_LDR:
         case INST_TYPE_LDRB:
@@ -237,212 +283,179 @@ void format_instruction(const disasm_inst_t *inst, char *buffer, size_t buffer_s
         case INST_TYPE_LDRSH:
         case INST_TYPE_STR:
         case INST_TYPE_STRB:
-        case INST_TYPE_STRH: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            char mem_operand[128];
-            format_memory_operand(inst, mem_operand, sizeof(mem_operand));
-            snprintf(operands, sizeof(operands), "%s, %s", reg_dst, mem_operand);
+        case INST_TYPE_STRH:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_sep(sb);
+            format_memory_operand(inst, names, sb);
+            break;
+        
+        // 预取指令：Rt 字段为预取操作
+        case INST_TYPE_PRFM:
+            put_prefetch_op(sb, inst->rd);
+            put_sep(sb);
+            format_memory_operand(inst, names, sb);
             break;
-        }
         
         // 加载/存储对指令
         case INST_TYPE_LDP:
-        case INST_TYPE_STP: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_t2, sizeof(reg_t2), inst->rt2, inst->rd_type);
-            char mem_operand[128];
-            format_memory_operand(inst, mem_operand, sizeof(mem_operand));
-            snprintf(operands, sizeof(operands), "%s, %s, %s", reg_dst, reg_t2, mem_operand);
+        case INST_TYPE_STP:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rt2, inst->rd_type);
+            put_sep(sb);
+            format_memory_operand(inst, names, sb);
             break;
-        }
+#endif
         
         // MOV立即数指令
         case INST_TYPE_MOVZ:
         case INST_TYPE_MOVN:
-        case INST_TYPE_MOVK: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
+        case INST_TYPE_MOVK:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_sep(sb);
+            put_imm_hex(sb, (uint64_t)inst->imm);
             if (inst->shift_amount > 0) {
-                snprintf(operands, sizeof(operands), "%s, #0x%llx, lsl #%d", 
-                        reg_dst, (unsigned long long)inst->imm, inst->shift_amount);
-            } else {
-                snprintf(operands, sizeof(operands), "%s, #0x%llx", 
-                        reg_dst, (unsigned long long)inst->imm);
+                strbuf_puts(sb, ", lsl #");
+                strbuf_put_dec(sb, inst->shift_amount);
             }
             break;
-        }
         
         // MOV寄存器指令
-        case INST_TYPE_MOV: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
+        case INST_TYPE_MOV:
+            put_register(sb, names, inst->rd, inst->rd_type);
             if (inst->has_imm) {
-                snprintf(operands, sizeof(operands), "%s, #0x%llx", 
-                        reg_dst, (unsigned long long)inst->imm);
+                put_sep(sb);
+                put_imm_hex(sb, (uint64_t)inst->imm);
             } else {
-                format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rm, inst->rm_type);
-                snprintf(operands, sizeof(operands), "%s, %s", reg_dst, reg_src1);
+                put_reg_sep(sb, names, inst->rm, inst->rm_type);
             }
             break;
-        }
         
         // 算术指令（带立即数）
         case INST_TYPE_ADD:
         case INST_TYPE_SUB:
         case INST_TYPE_ADDS:
-        case INST_TYPE_SUBS: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            
+        case INST_TYPE_SUBS:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
             if (inst->has_imm) {
+                put_sep(sb);
+                put_imm_hex(sb, (uint64_t)inst->imm);
                 if (inst->shift_amount > 0) {
-                    snprintf(operands, sizeof(operands), "%s, %s, #0x%llx, lsl #%d", 
-                            reg_dst, reg_src1, (unsigned long long)inst->imm, inst->shift_amount);
-                } else {
-                    snprintf(operands, sizeof(operands), "%s, %s, #0x%llx", 
-                            reg_dst, reg_src1, (unsigned long long)inst->imm);
+                    strbuf_puts(sb, ", lsl #");
+                    strbuf_put_dec(sb, inst->shift_amount);
                 }
             } else {
-                format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
+                put_reg_sep(sb, names, inst->rm, inst->rm_type);
                 if (inst->shift_amount > 0) {
-                    const char *shift_name = get_extend_name(inst->extend_type);
-                    snprintf(operands, sizeof(operands), "%s, %s, %s, %s #%d", 
-                            reg_dst, reg_src1, reg_src2, shift_name, inst->shift_amount);
-                } else {
-                    snprintf(operands, sizeof(operands), "%s, %s, %s", 
-                            reg_dst, reg_src1, reg_src2);
+                    put_sep(sb);
+                    strbuf_puts(sb, get_extend_name(inst->extend_type));
+                    strbuf_puts(sb, " #");
+                    strbuf_put_dec(sb, inst->shift_amount);
                 }
             }
             break;
-        }
         
         // 比较指令
         case INST_TYPE_CMP:
-        case INST_TYPE_CMN: {
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
+        case INST_TYPE_CMN:
+            put_register(sb, names, inst->rn, inst->rn_type);
             if (inst->has_imm) {
-                snprintf(operands, sizeof(operands), "%s, #0x%llx", 
-                        reg_src1, (unsigned long long)inst->imm);
+                put_sep(sb);
+                put_imm_hex(sb, (uint64_t)inst->imm);
             } else {
-                format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
-                snprintf(operands, sizeof(operands), "%s, %s", reg_src1, reg_src2);
+                put_reg_sep(sb, names, inst->rm, inst->rm_type);
             }
             break;
-        }
         
         // ADR/ADRP指令
         case INST_TYPE_ADR:
-        case INST_TYPE_ADRP: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            snprintf(operands, sizeof(operands), "%s, 0x%llx", 
-                    reg_dst, (unsigned long long)(inst->address + inst->imm));
+        case INST_TYPE_ADRP:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_sep(sb);
+            strbuf_put_hex(sb, inst->address + inst->imm);
             break;
-        }
         
+#if ARM64_DISASM_HAS_BRANCH
         // 分支指令
         case INST_TYPE_B:
-        case INST_TYPE_BL: {
-            snprintf(operands, sizeof(operands), "0x%llx", 
-                    (unsigned long long)(inst->address + inst->imm));
+        case INST_TYPE_BCOND:
+        case INST_TYPE_BL:
+            strbuf_put_hex(sb, inst->address + inst->imm);
             break;
-        }
         
         case INST_TYPE_BR:
         case INST_TYPE_BLR:
-        case INST_TYPE_RET: {
-            if (inst->type == INST_TYPE_RET && inst->rn == 30) {
-                // RET默认使用LR
-                operands[0] = '\0';
-            } else {
-                format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-                snprintf(operands, sizeof(operands), "%s", reg_src1);
+        case INST_TYPE_RET:
+            // RET默认使用LR，ERET/DRPS没有操作数
+            if (!(inst->type == INST_TYPE_RET && (inst->rn == 30 || inst->operand_count == 0))) {
+                put_register(sb, names, inst->rn, inst->rn_type);
             }
             break;
-        }
         
         case INST_TYPE_CBZ:
-        case INST_TYPE_CBNZ: {
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rd, inst->rd_type);
-            snprintf(operands, sizeof(operands), "%s, 0x%llx", 
-                    reg_src1, (unsigned long long)(inst->address + inst->imm));
+        case INST_TYPE_CBNZ:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_sep(sb);
+            strbuf_put_hex(sb, inst->address + inst->imm);
             break;
-        }
         
         case INST_TYPE_TBZ:
-        case INST_TYPE_TBNZ: {
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rd, inst->rd_type);
-            snprintf(operands, sizeof(operands), "%s, #%d, 0x%llx", 
-                    reg_src1, inst->shift_amount, (unsigned long long)(inst->address + inst->imm));
+        case INST_TYPE_TBNZ:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_sep(sb);
+            put_imm_dec(sb, inst->shift_amount);
+            put_sep(sb);
+            strbuf_put_hex(sb, inst->address + inst->imm);
             break;
-        }
+#endif
         
         // 逻辑指令
         case INST_TYPE_AND:
         case INST_TYPE_ORR:
-        case INST_TYPE_EOR: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            
+        case INST_TYPE_EOR:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
             if (inst->has_imm) {
-                snprintf(operands, sizeof(operands), "%s, %s, #0x%llx", 
-                        reg_dst, reg_src1, (unsigned long long)inst->imm);
+                put_sep(sb);
+                put_imm_hex(sb, (uint64_t)inst->imm);
             } else {
-                format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
-                snprintf(operands, sizeof(operands), "%s, %s, %s", 
-                        reg_dst, reg_src1, reg_src2);
+                put_reg_sep(sb, names, inst->rm, inst->rm_type);
             }
             break;
-        }
         
         // 移位指令
         case INST_TYPE_LSL:
         case INST_TYPE_LSR:
-        case INST_TYPE_ASR: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
+        case INST_TYPE_ASR:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
             if (inst->has_imm) {
-                // 检查助记符判断是否为位域操作指令
-                if (strcmp(inst->mnemonic, "ubfm") == 0 || 
-                    strcmp(inst->mnemonic, "sbfm") == 0 || 
-                    strcmp(inst->mnemonic, "bfm") == 0) {
-                    // 位域操作：显示immr和imms
-                    uint8_t immr = inst->shift_amount;
-                    uint8_t imms = inst->imm & 0x3F;
-                    snprintf(operands, sizeof(operands), "%s, %s, #%d, #%d", 
-                            reg_dst, reg_src1, immr, imms);
-                } else {
-                    // 普通移位：只显示移位量
-                    snprintf(operands, sizeof(operands), "%s, %s, #%d", 
-                            reg_dst, reg_src1, inst->shift_amount);
+                put_sep(sb);
+                put_imm_dec(sb, inst->shift_amount);
+                // 检查助记符判断是否为位域操作指令：显示immr和imms
+                if (strbuf_equal(inst->mnemonic, "ubfm") ||
+                    strbuf_equal(inst->mnemonic, "sbfm") ||
+                    strbuf_equal(inst->mnemonic, "bfm")) {
+                    put_sep(sb);
+                    put_imm_dec(sb, inst->imm & 0x3F);
                 }
             } else {
-                format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
-                snprintf(operands, sizeof(operands), "%s, %s, %s", 
-                        reg_dst, reg_src1, reg_src2);
+                put_reg_sep(sb, names, inst->rm, inst->rm_type);
             }
             break;
-        }
-        
-        // 乘法指令
-        case INST_TYPE_MUL: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
-            snprintf(operands, sizeof(operands), "%s, %s, %s", reg_dst, reg_src1, reg_src2);
-            break;
-        }
         
-        // 除法指令
+        // 乘法、除法指令
+        case INST_TYPE_MUL:
         case INST_TYPE_UDIV:
-        case INST_TYPE_SDIV: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
-            snprintf(operands, sizeof(operands), "%s, %s, %s", reg_dst, reg_src1, reg_src2);
+        case INST_TYPE_SDIV:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
             break;
-        }
 
+#if ARM64_DISASM_HAS_SYSTEM
         // MRS 系统寄存器读
         case INST_TYPE_MRS: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
             uint32_t raw = inst->raw;
             uint8_t op0 = BITS(raw, 19, 20);
             uint8_t op1 = BITS(raw, 16, 18);
@@ -450,61 +463,57 @@ void format_instruction(const disasm_inst_t *inst, char *buffer, size_t buffer_s
             uint8_t crm = BITS(raw, 8, 11);
             uint8_t op2 = BITS(raw, 5, 7);
             
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_sep(sb);
             const char *sys_name = get_system_reg_name(op0, op1, crn, crm, op2);
             if (sys_name) {
-                snprintf(operands, sizeof(operands), "%s, %s", reg_dst, sys_name);
+                strbuf_puts(sb, sys_name);
             } else {
                 // 回退到通用编码形式：S<op0>_<op1>_C<crn>_C<crm>_<op2>
-                snprintf(operands, sizeof(operands), "%s, S%u_%u_C%u_C%u_%u",
-                         reg_dst, op0, op1, crn, crm, op2);
+                strbuf_putc(sb, 'S');
+                strbuf_put_uint(sb, op0, 10, 1);
+                strbuf_putc(sb, '_');
+                strbuf_put_uint(sb, op1, 10, 1);
+                strbuf_puts(sb, "_C");
+                strbuf_put_uint(sb, crn, 10, 1);
+                strbuf_puts(sb, "_C");
+                strbuf_put_uint(sb, crm, 10, 1);
+                strbuf_putc(sb, '_');
+                strbuf_put_uint(sb, op2, 10, 1);
             }
             break;
         }
+#endif
         
         // 条件选择指令
         case INST_TYPE_CSEL:
         case INST_TYPE_CSINC:
         case INST_TYPE_CSINV:
-        case INST_TYPE_CSNEG: {
-            static const char *cond_names[] = {
-                "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
-                "hi", "ls", "ge", "lt", "gt", "le", "al", "nv"
-            };
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
-            snprintf(operands, sizeof(operands), "%s, %s, %s, %s",
-                    reg_dst, reg_src1, reg_src2, cond_names[inst->cond & 0xF]);
+        case INST_TYPE_CSNEG:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
+            put_sep(sb);
+            strbuf_puts(sb, cond_names[inst->cond & 0xF]);
             break;
-        }
         
         // 条件选择别名（单寄存器形式）
         case INST_TYPE_CSET:
-        case INST_TYPE_CSETM: {
-            static const char *cond_names[] = {
-                "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
-                "hi", "ls", "ge", "lt", "gt", "le", "al", "nv"
-            };
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            snprintf(operands, sizeof(operands), "%s, %s",
-                    reg_dst, cond_names[inst->cond & 0xF]);
+        case INST_TYPE_CSETM:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_sep(sb);
+            strbuf_puts(sb, cond_names[inst->cond & 0xF]);
             break;
-        }
         
         // 条件递增/取反/取负
         case INST_TYPE_CINC:
         case INST_TYPE_CINV:
-        case INST_TYPE_CNEG: {
-            static const char *cond_names[] = {
-                "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
-                "hi", "ls", "ge", "lt", "gt", "le", "al", "nv"
-            };
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            snprintf(operands, sizeof(operands), "%s, %s, %s",
-                    reg_dst, reg_src1, cond_names[inst->cond & 0xF]);
+        case INST_TYPE_CNEG:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
+            put_sep(sb);
+            strbuf_puts(sb, cond_names[inst->cond & 0xF]);
             break;
-        }
         
         // 位操作指令（1源）
         case INST_TYPE_CLZ:
@@ -512,62 +521,38 @@ void format_instruction(const disasm_inst_t *inst, char *buffer, size_t buffer_s
         case INST_TYPE_RBIT:
         case INST_TYPE_REV:
         case INST_TYPE_REV16:
-        case INST_TYPE_REV32: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            snprintf(operands, sizeof(operands), "%s, %s", reg_dst, reg_src1);
+        case INST_TYPE_REV32:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
             break;
-        }
         
         // EXTR/ROR指令
         case INST_TYPE_EXTR:
-        case INST_TYPE_ROR: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rn, inst->rn_type);
-            if (inst->type == INST_TYPE_ROR) {
-                snprintf(operands, sizeof(operands), "%s, %s, #%lld",
-                        reg_dst, reg_src1, (long long)inst->imm);
-            } else {
-                format_register_operand(inst, reg_src2, sizeof(reg_src2), inst->rm, inst->rm_type);
-                snprintf(operands, sizeof(operands), "%s, %s, %s, #%lld",
-                        reg_dst, reg_src1, reg_src2, (long long)inst->imm);
+        case INST_TYPE_ROR:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
+            if (inst->type != INST_TYPE_ROR) {
+                put_reg_sep(sb, names, inst->rm, inst->rm_type);
             }
+            put_sep(sb);
+            put_imm_dec(sb, inst->imm);
             break;
-        }
         
-        // 独占加载指令
+#if ARM64_DISASM_HAS_ATOMICS
+        // 独占加载、存储-释放指令
         case INST_TYPE_LDXR:
         case INST_TYPE_LDAXR:
-        case INST_TYPE_LDAR: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            char base_reg[16];
-            get_register_name(inst->rn, inst->rn_type, base_reg);
-            snprintf(operands, sizeof(operands), "%s, [%s]", reg_dst, base_reg);
+        case INST_TYPE_LDAR:
+        case INST_TYPE_STLR:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            strbuf_puts(sb, ", [");
+            put_register(sb, names, inst->rn, inst->rn_type);
+            strbuf_putc(sb, ']');
             break;
-        }
         
-        // 独占存储指令
+        // 独占存储、原子操作、CAS指令：状态/源寄存器在前
         case INST_TYPE_STXR:
-        case INST_TYPE_STLXR: {
-            char status_reg[16];
-            get_register_name(inst->rm, inst->rm_type, status_reg);
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            char base_reg[16];
-            get_register_name(inst->rn, inst->rn_type, base_reg);
-            snprintf(operands, sizeof(operands), "%s, %s, [%s]", status_reg, reg_dst, base_reg);
-            break;
-        }
-        
-        // 存储-释放指令
-        case INST_TYPE_STLR: {
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            char base_reg[16];
-            get_register_name(inst->rn, inst->rn_type, base_reg);
-            snprintf(operands, sizeof(operands), "%s, [%s]", reg_dst, base_reg);
-            break;
-        }
-        
-        // 原子操作指令
+        case INST_TYPE_STLXR:
         case INST_TYPE_LDADD:
         case INST_TYPE_LDCLR:
         case INST_TYPE_LDEOR:
@@ -576,139 +561,140 @@ void format_instruction(const disasm_inst_t *inst, char *buffer, size_t buffer_s
         case INST_TYPE_LDSMIN:
         case INST_TYPE_LDUMAX:
         case INST_TYPE_LDUMIN:
-        case INST_TYPE_SWP: {
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rm, inst->rm_type);
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            char base_reg[16];
-            get_register_name(inst->rn, inst->rn_type, base_reg);
-            snprintf(operands, sizeof(operands), "%s, %s, [%s]", reg_src1, reg_dst, base_reg);
+        case INST_TYPE_SWP:
+        case INST_TYPE_CAS:
+            put_register(sb, names, inst->rm, inst->rm_type);
+            put_reg_sep(sb, names, inst->rd, inst->rd_type);
+            strbuf_puts(sb, ", [");
+            put_register(sb, names, inst->rn, inst->rn_type);
+            strbuf_putc(sb, ']');
             break;
-        }
-        
-        // CAS指令
-        case INST_TYPE_CAS: {
-            format_register_operand(inst, reg_src1, sizeof(reg_src1), inst->rm, inst->rm_type);
-            format_register_operand(inst, reg_dst, sizeof(reg_dst), inst->rd, inst->rd_type);
-            char base_reg[16];
-            get_register_name(inst->rn, inst->rn_type, base_reg);
-            snprintf(operands, sizeof(operands), "%s, %s, [%s]", reg_src1, reg_dst, base_reg);
-            break;
-        }
+#endif
         
         case INST_TYPE_NOP:
-            operands[0] = '\0';
             break;
         
+#if ARM64_DISASM_HAS_FP_SIMD
         /* 浮点指令格式化 */
         case INST_TYPE_FMOV:
         case INST_TYPE_FABS:
         case INST_TYPE_FNEG:
         case INST_TYPE_FSQRT:
         case INST_TYPE_FCVT:
-        case INST_TYPE_FRINT: {
-            char fp_dst[16], fp_src[16];
-            get_register_name(inst->rd, inst->rd_type, fp_dst);
-            if (inst->has_imm && strcmp(inst->mnemonic, "fmov") == 0) {
+        case INST_TYPE_FRINT:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            if (inst->has_imm && strbuf_equal(inst->mnemonic, "fmov")) {
                 /* FMOV立即数 */
-                snprintf(operands, sizeof(operands), "%s, #%lld", fp_dst, (long long)inst->imm);
+                put_sep(sb);
+                put_imm_dec(sb, inst->imm);
             } else {
-                get_register_name(inst->rn, inst->rn_type, fp_src);
-                snprintf(operands, sizeof(operands), "%s, %s", fp_dst, fp_src);
+                put_reg_sep(sb, names, inst->rn, inst->rn_type);
             }
             break;
-        }
         
         case INST_TYPE_FADD:
         case INST_TYPE_FSUB:
         case INST_TYPE_FMUL:
         case INST_TYPE_FDIV:
         case INST_TYPE_FMAX:
-        case INST_TYPE_FMIN: {
-            char fp_dst[16], fp_src1[16], fp_src2[16];
-            get_register_name(inst->rd, inst->rd_type, fp_dst);
-            get_register_name(inst->rn, inst->rn_type, fp_src1);
-            get_register_name(inst->rm, inst->rm_type, fp_src2);
-            snprintf(operands, sizeof(operands), "%s, %s, %s", fp_dst, fp_src1, fp_src2);
+        case INST_TYPE_FMIN:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
             break;
-        }
         
         case INST_TYPE_FMADD:
         case INST_TYPE_FMSUB:
         case INST_TYPE_FNMADD:
-        case INST_TYPE_FNMSUB: {
-            char fp_dst[16], fp_src1[16], fp_src2[16], fp_src3[16];
-            get_register_name(inst->rd, inst->rd_type, fp_dst);
-            get_register_name(inst->rn, inst->rn_type, fp_src1);
-            get_register_name(inst->rm, inst->rm_type, fp_src2);
-            get_register_name(inst->ra, inst->rd_type, fp_src3);
-            snprintf(operands, sizeof(operands), "%s, %s, %s, %s", fp_dst, fp_src1, fp_src2, fp_src3);
+        case INST_TYPE_FNMSUB:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
+            put_reg_sep(sb, names, inst->ra, inst->rd_type);
             break;
-        }
         
         case INST_TYPE_FCMP:
-        case INST_TYPE_FCMPE: {
-            char fp_src1[16], fp_src2[16];
-            get_register_name(inst->rn, inst->rn_type, fp_src1);
+        case INST_TYPE_FCMPE:
+            put_register(sb, names, inst->rn, inst->rn_type);
             if (inst->has_imm) {
-                snprintf(operands, sizeof(operands), "%s, #0.0", fp_src1);
+                strbuf_puts(sb, ", #0.0");
             } else {
-                get_register_name(inst->rm, inst->rm_type, fp_src2);
-                snprintf(operands, sizeof(operands), "%s, %s", fp_src1, fp_src2);
+                put_reg_sep(sb, names, inst->rm, inst->rm_type);
             }
             break;
-        }
         
-        case INST_TYPE_FCCMP: {
-            static const char *cond_names[] = {
-                "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
-                "hi", "ls", "ge", "lt", "gt", "le", "al", "nv"
-            };
-            char fp_src1[16], fp_src2[16];
-            get_register_name(inst->rn, inst->rn_type, fp_src1);
-            get_register_name(inst->rm, inst->rm_type, fp_src2);
-            snprintf(operands, sizeof(operands), "%s, %s, #%lld, %s",
-                    fp_src1, fp_src2, (long long)inst->imm, cond_names[inst->cond & 0xF]);
+        case INST_TYPE_FCCMP:
+            put_register(sb, names, inst->rn, inst->rn_type);
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
+            put_sep(sb);
+            put_imm_dec(sb, inst->imm);
+            put_sep(sb);
+            strbuf_puts(sb, cond_names[inst->cond & 0xF]);
             break;
-        }
         
-        case INST_TYPE_FCSEL: {
-            static const char *cond_names[] = {
-                "eq", "ne", "cs", "cc", "mi", "pl", "vs", "vc",
-                "hi", "ls", "ge", "lt", "gt", "le", "al", "nv"
-            };
-            char fp_dst[16], fp_src1[16], fp_src2[16];
-            get_register_name(inst->rd, inst->rd_type, fp_dst);
-            get_register_name(inst->rn, inst->rn_type, fp_src1);
-            get_register_name(inst->rm, inst->rm_type, fp_src2);
-            snprintf(operands, sizeof(operands), "%s, %s, %s, %s",
-                    fp_dst, fp_src1, fp_src2, cond_names[inst->cond & 0xF]);
+        case INST_TYPE_FCSEL:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
+            put_reg_sep(sb, names, inst->rm, inst->rm_type);
+            put_sep(sb);
+            strbuf_puts(sb, cond_names[inst->cond & 0xF]);
             break;
-        }
         
         case INST_TYPE_FCVTZS:
         case INST_TYPE_FCVTZU:
         case INST_TYPE_SCVTF:
-        case INST_TYPE_UCVTF: {
-            char dst[16], src[16];
-            get_register_name(inst->rd, inst->rd_type, dst);
-            get_register_name(inst->rn, inst->rn_type, src);
-            snprintf(operands, sizeof(operands), "%s, %s", dst, src);
+        case INST_TYPE_UCVTF:
+            put_register(sb, names, inst->rd, inst->rd_type);
+            put_reg_sep(sb, names, inst->rn, inst->rn_type);
             break;
-        }
+#endif
             
         default:
-            snprintf(operands, sizeof(operands), "; raw=0x%08x", inst->raw);
+            strbuf_puts(sb, "; raw=0x");
+            strbuf_put_uint(sb, inst->raw, 16, 8);
             break;
     }
+}
+
+/**
+ * 将反汇编指令格式化为字符串
+ * 直接写入调用者的缓冲区，不使用中间缓冲区和 stdio
+ */
+void format_instruction(const disasm_inst_t *inst, char *buffer, size_t buffer_size) {
+    strbuf_t sb;
+    strbuf_init(&sb, buffer, buffer_size);
     
-    // 组合最终输出
-    if (operands[0] != '\0') {
-        snprintf(buffer, buffer_size, "%-8s %s", inst->mnemonic, operands);
-    } else {
-        snprintf(buffer, buffer_size, "%s", inst->mnemonic);
+    // 助记符左对齐到8列，后跟一个空格和操作数；没有操作数时只输出助记符
+    strbuf_puts(&sb, inst->mnemonic);
+    size_t mnemonic_len = sb.len;
+    strbuf_pad_to(&sb, 8);
+    strbuf_putc(&sb, ' ');
+    size_t operands_start = sb.len;
+    
+    format_operands(inst, DISASM_REGS_ALIAS, &sb);
+    if (sb.len == operands_start) {
+        strbuf_truncate(&sb, mnemonic_len);
     }
 }
 
+/**
+ * 只格式化操作数部分（不含助记符）
+ */
+void format_instruction_operands(const disasm_inst_t *inst, char *buffer, size_t buffer_size) {
+    format_instruction_operands_names(inst, DISASM_REGS_ALIAS, buffer, buffer_size);
+}
+
+/**
+ * 按指定的寄存器命名方式格式化操作数部分
+ */
+void format_instruction_operands_names(const disasm_inst_t *inst, disasm_reg_names_t names,
+                                       char *buffer, size_t buffer_size) {
+    strbuf_t sb;
+    strbuf_init(&sb, buffer, buffer_size);
+    format_operands(inst, names, &sb);
+}
+
+#ifndef ARM64_DISASM_FREESTANDING
 /**
  * 打印单条指令
  */
@@ -718,4 +704,4 @@ void print_instruction(const disasm_inst_t *inst) {
     printf("0x%016llx:  %08x  %s\n", 
            (unsigned long long)inst->address, inst->raw, buffer);
 }
-
+#endif
@@ -0,0 +1,179 @@
+/**
+ * ARM64反汇编服务守护进程
+ *
+ * 用法：
+ *   arm64_disasmd [-s 套接字] [-m 缓存MB] [-c 最大连接数] [-j 最大并发解码数] [-T 时间线]
+ *   arm64_disasmd [-s 套接字] --stats
+ *   arm64_disasmd [-s 套接字] --query 映像 [偏移 [长度 [地址]]]
+ */
+
+#define _GNU_SOURCE
+#include "arm64_service.h"
+#include "arm64_timeline.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static arm64_svc_server_t *g_server;
+
+static void on_signal(int sig) {
+    (void)sig;
+    if (g_server) {
+        arm64_svc_server_stop(g_server);
+    }
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "用法: %s [-s 套接字] [-m 缓存MB] [-c 最大连接数] [-j 最大并发解码数] [-T 时间线]\n"
+            "      %s [-s 套接字] --stats\n"
+            "      %s [-s 套接字] --query 映像 [偏移 [长度 [地址]]]\n"
+            "  -s  套接字路径（默认 %s）\n",
+            prog, prog, prog, arm64_svc_default_socket());
+}
+
+static int print_stats(const char *socket_path) {
+    int fd = arm64_svc_connect(socket_path);
+    if (fd < 0) {
+        perror(socket_path);
+        return 1;
+    }
+
+    arm64_svc_stats_t st;
+    arm64_svc_status_t status = arm64_svc_query_stats(fd, &st);
+    close(fd);
+    if (status != ARM64_SVC_OK) {
+        fprintf(stderr, "stats: %s\n", arm64_svc_status_name(status));
+        return 1;
+    }
+
+    double uptime = (double)st.uptime_ns * 1e-9;
+    printf("运行时间:     %.1f 秒\n", uptime);
+    printf("请求:         %llu (%.1f 次/秒), 错误 %llu, 拒绝连接 %llu\n",
+           (unsigned long long)st.requests, uptime > 0 ? (double)st.requests / uptime : 0.0,
+           (unsigned long long)st.errors, (unsigned long long)st.rejected);
+    printf("缓存:         命中 %llu, 未命中 %llu, 淘汰 %llu\n",
+           (unsigned long long)st.cache_hits, (unsigned long long)st.cache_misses,
+           (unsigned long long)st.evictions);
+    printf("缓存占用:     %llu 条目, %.1f / %.1f MB\n",
+           (unsigned long long)st.cached_entries, (double)st.cached_bytes / 1048576.0,
+           (double)st.cache_budget / 1048576.0);
+    printf("活动:         %llu 连接, %llu 解码\n",
+           (unsigned long long)st.active_clients, (unsigned long long)st.active_decodes);
+    printf("解码吞吐量:   %llu 条, %.2f M条/秒\n",
+           (unsigned long long)st.instructions_decoded,
+           st.decode_ns ? (double)st.instructions_decoded * 1e3 / (double)st.decode_ns : 0.0);
+    printf("请求延迟:     平均 %.1f us, p50 %.1f us, p99 %.1f us, 最大 %.1f us\n",
+           (double)st.latency_avg_ns * 1e-3, (double)st.latency_p50_ns * 1e-3,
+           (double)st.latency_p99_ns * 1e-3, (double)st.latency_max_ns * 1e-3);
+    return 0;
+}
+
+static int query(const char *socket_path, int argc, char *argv[]) {
+    if (argc < 1) {
+        return 2;
+    }
+
+    char path[ARM64_SVC_PATH_MAX];
+    if (!realpath(argv[0], path)) {
+        perror(argv[0]);
+        return 1;
+    }
+
+    arm64_svc_request_t req;
+    arm64_svc_request_init(&req, path, ARM64_SVC_KIND_TEXT);
+    req.offset = argc > 1 ? strtoull(argv[1], NULL, 0) : 0;
+    req.length = argc > 2 ? strtoull(argv[2], NULL, 0) : 0;
+    req.address = argc > 3 ? strtoull(argv[3], NULL, 0) : req.offset;
+
+    int fd = arm64_svc_connect(socket_path);
+    if (fd < 0) {
+        perror(socket_path);
+        return 1;
+    }
+
+    arm64_svc_result_t result;
+    arm64_svc_status_t status = arm64_svc_decode(fd, &req, &result);
+    close(fd);
+    if (status != ARM64_SVC_OK) {
+        fprintf(stderr, "%s: %s\n", path, arm64_svc_status_name(status));
+        return 1;
+    }
+
+    const char *lines = (const char *)result.data;
+    for (size_t i = 0; i < result.count; i++) {
+        printf("0x%llx:  %s\n", (unsigned long long)(req.address + i * 4),
+               lines + i * ARM64_SVC_TEXT_WIDTH);
+    }
+    arm64_svc_release(&result);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    arm64_svc_config_t config;
+    arm64_svc_config_init(&config);
+    const char *timeline_path = NULL;
+
+    int i = 1;
+    for (; i < argc; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "-s") == 0 && has_value) {
+            config.socket_path = argv[++i];
+        } else if (strcmp(arg, "-m") == 0 && has_value) {
+            config.cache_budget = (size_t)strtoull(argv[++i], NULL, 0) << 20;
+        } else if (strcmp(arg, "-c") == 0 && has_value) {
+            config.max_clients = (unsigned)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-j") == 0 && has_value) {
+            config.max_decodes = (unsigned)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-T") == 0 && has_value) {
+            timeline_path = argv[++i];
+        } else if (strcmp(arg, "--stats") == 0) {
+            return print_stats(config.socket_path);
+        } else if (strcmp(arg, "--query") == 0) {
+            int rc = query(config.socket_path, argc - i - 1, argv + i + 1);
+            if (rc == 2) {
+                usage(argv[0]);
+            }
+            return rc;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    /* 各请求的阶段事件记录在连接线程的缓冲区中，退出时统一导出 */
+    if (timeline_path && !arm64_timeline_start(0)) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+
+    g_server = arm64_svc_server_create(&config);
+    if (!g_server) {
+        perror(config.socket_path);
+        return 1;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    fprintf(stderr, "arm64_disasmd: 监听 %s, 缓存 %zu MB, 连接上限 %u, 解码并发 %u\n",
+            config.socket_path, config.cache_budget >> 20, config.max_clients,
+            config.max_decodes);
+    arm64_svc_server_run(g_server);
+    arm64_svc_server_destroy(g_server);
+    if (timeline_path) {
+        arm64_timeline_stop();
+        if (arm64_timeline_export(timeline_path) < 0) {
+            perror(timeline_path);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,337 @@
+/**
+ * ARM64反汇编器 - 最小 ELF64 读取
+ */
+
+#include "arm64_elf.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#define EM_AARCH64          183
+#define SHT_SYMTAB          2
+#define SHT_DYNSYM          11
+#define STT_SECTION         3
+#define STT_FILE            4
+#define STB_LOCAL           0
+#define SHN_UNDEF           0
+
+#define ELF64_EHDR_SIZE     64
+#define ELF64_SHDR_SIZE     64
+#define ELF64_SYM_SIZE      24
+
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    bool big;
+} reader_t;
+
+static uint64_t elf_read(const reader_t *r, size_t off, int bytes) {
+    uint64_t v = 0;
+    for (int i = 0; i < bytes; i++) {
+        uint64_t b = r->data[off + i];
+        v |= r->big ? b << ((bytes - 1 - i) * 8) : b << (i * 8);
+    }
+    return v;
+}
+
+/* 节头 */
+typedef struct {
+    uint32_t name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t addr;
+    uint64_t offset;
+    uint64_t size;
+    uint32_t link;
+} shdr_t;
+
+static bool read_shdr(const reader_t *r, size_t shoff, size_t index, shdr_t *sh) {
+    if (index > (r->size - shoff) / ELF64_SHDR_SIZE) {
+        return false;
+    }
+    size_t off = shoff + index * ELF64_SHDR_SIZE;
+    if (off + ELF64_SHDR_SIZE > r->size) {
+        return false;
+    }
+    sh->name = (uint32_t)elf_read(r, off, 4);
+    sh->type = (uint32_t)elf_read(r, off + 4, 4);
+    sh->flags = elf_read(r, off + 8, 8);
+    sh->addr = elf_read(r, off + 16, 8);
+    sh->offset = elf_read(r, off + 24, 8);
+    sh->size = elf_read(r, off + 32, 8);
+    sh->link = (uint32_t)elf_read(r, off + 40, 4);
+    return true;
+}
+
+static bool in_file(const reader_t *r, const shdr_t *sh) {
+    return sh->offset <= r->size && sh->size <= r->size - sh->offset;
+}
+
+/* 字符串表中的名称；越界时返回空串 */
+static const char *read_string(const reader_t *r, const shdr_t *strtab, uint32_t index) {
+    if (!in_file(r, strtab) || index >= strtab->size) {
+        return "";
+    }
+    const char *s = (const char *)r->data + strtab->offset + index;
+    return memchr(s, '\0', (size_t)(strtab->size - index)) ? s : "";
+}
+
+/* 映射符号名："$x"、"$d" 或后接 ".<名称>" 的形式；返回 'x'、'd'，其他名称返回0 */
+static char mapping_kind(const char *name) {
+    if (name[0] != '$' || (name[1] != 'x' && name[1] != 'd') ||
+        (name[2] != '\0' && name[2] != '.')) {
+        return 0;
+    }
+    return name[1];
+}
+
+static int compare_mappings(const void *a, const void *b) {
+    const arm64_elf_mapping_t *x = a, *y = b;
+    if (x->section != y->section) {
+        return x->section < y->section ? -1 : 1;
+    }
+    return x->address < y->address ? -1 : (x->address > y->address);
+}
+
+/*
+ * 收集符号：全局符号排在局部符号之前，同一地址优先使用全局符号（与 objdump 的选择一致）
+ */
+static bool read_symbols(const reader_t *r, size_t shoff, size_t shnum, arm64_elf_t *elf) {
+    shdr_t symtab = {0}, sh;
+    bool found = false;
+    for (size_t i = 0; i < shnum && read_shdr(r, shoff, i, &sh); i++) {
+        if (sh.type == SHT_SYMTAB || (sh.type == SHT_DYNSYM && !found)) {
+            symtab = sh;
+            found = true;
+        }
+    }
+    shdr_t strtab;
+    if (!found || !in_file(r, &symtab) || !read_shdr(r, shoff, symtab.link, &strtab)) {
+        return true;
+    }
+
+    size_t total = (size_t)(symtab.size / ELF64_SYM_SIZE);
+    size_t capacity = total ? total : 1;
+    arm64_elf_symbol_t *syms = arm64_alloc(elf->allocator, capacity * sizeof(*syms),
+                                           16);
+    if (!syms) {
+        return false;
+    }
+    /* 映射符号（总是局部符号）先计数，没有时不分配 */
+    size_t maps = 0;
+    for (size_t i = 1; i < total; i++) {
+        size_t off = (size_t)symtab.offset + i * ELF64_SYM_SIZE;
+        uint16_t shndx = (uint16_t)elf_read(r, off + 6, 2);
+        if (shndx != SHN_UNDEF && shndx < shnum &&
+            mapping_kind(read_string(r, &strtab, (uint32_t)elf_read(r, off, 4)))) {
+            maps++;
+        }
+    }
+    if (maps > 0) {
+        elf->mappings = arm64_alloc(elf->allocator, maps * sizeof(arm64_elf_mapping_t), 16);
+        if (!elf->mappings) {
+            arm64_free(elf->allocator, syms, capacity * sizeof(*syms));
+            return false;
+        }
+        elf->mapping_capacity = maps;
+    }
+
+    size_t n = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 1; i < total; i++) {
+            size_t off = (size_t)symtab.offset + i * ELF64_SYM_SIZE;
+            uint32_t name = (uint32_t)elf_read(r, off, 4);
+            uint8_t info = r->data[off + 4];
+            uint16_t shndx = (uint16_t)elf_read(r, off + 6, 2);
+            bool local = (info >> 4) == STB_LOCAL;
+            if (local != (pass == 1) || shndx == SHN_UNDEF ||
+                (info & 0xF) == STT_SECTION || (info & 0xF) == STT_FILE) {
+                continue;
+            }
+            const char *s = read_string(r, &strtab, name);
+            char kind = mapping_kind(s);
+            if (kind && shndx < shnum && elf->mapping_count < maps) {
+                elf->mappings[elf->mapping_count++] = (arm64_elf_mapping_t){
+                    elf_read(r, off + 8, 8), (size_t)shndx - 1, kind == 'd'
+                };
+            }
+            if (s[0] == '\0' || s[0] == '$') {
+                continue;
+            }
+            syms[n].name = s;
+            syms[n].address = elf_read(r, off + 8, 8);
+            syms[n].size = elf_read(r, off + 16, 8);
+            syms[n].section = shndx < shnum ? (size_t)shndx - 1 : SIZE_MAX;
+            syms[n].type = info & 0xF;
+            syms[n].global = !local;
+            n++;
+        }
+    }
+    if (elf->mapping_count > 1) {
+        qsort(elf->mappings, elf->mapping_count, sizeof(arm64_elf_mapping_t), compare_mappings);
+    }
+    elf->symbols = syms;
+    elf->symbol_count = n;
+    elf->symbol_capacity = capacity;
+    return true;
+}
+
+arm64_elf_status_t arm64_elf_parse(arm64_elf_t *elf, const void *data, size_t size) {
+    memset(elf, 0, sizeof(*elf));
+    const uint8_t *p = data;
+    if (size < ELF64_EHDR_SIZE || memcmp(p, "\177ELF", 4) != 0 || p[4] != 2) {
+        return ARM64_ELF_NOT_ELF64;
+    }
+    reader_t r = { p, size, p[5] == 2 };
+    elf->big = r.big;
+    if (elf_read(&r, 18, 2) != EM_AARCH64) {
+        return ARM64_ELF_NOT_AARCH64;
+    }
+    size_t shoff = (size_t)elf_read(&r, 40, 8);
+    size_t shnum = (size_t)elf_read(&r, 60, 2);
+    size_t shstrndx = (size_t)elf_read(&r, 62, 2);
+    shdr_t shstr;
+    if (shnum > 0 && (shoff > size || !read_shdr(&r, shoff, shstrndx, &shstr))) {
+        return ARM64_ELF_BAD_SECTIONS;
+    }
+
+    elf->allocator = arm64_default_allocator();
+    elf->section_capacity = shnum ? shnum : 1;
+    elf->sections = arm64_alloc(elf->allocator, elf->section_capacity * sizeof(arm64_elf_section_t),
+                                16);
+    if (!elf->sections) {
+        return ARM64_ELF_NO_MEMORY;
+    }
+    shdr_t sh;
+    for (size_t i = 1; i < shnum && read_shdr(&r, shoff, i, &sh); i++) {
+        elf->sections[elf->section_count++] = (arm64_elf_section_t){
+            read_string(&r, &shstr, sh.name), sh.type, sh.flags, sh.addr,
+            in_file(&r, &sh) ? p + sh.offset : NULL, sh.size
+        };
+    }
+    if (!read_symbols(&r, shoff, shnum, elf)) {
+        arm64_elf_free(elf);
+        return ARM64_ELF_NO_MEMORY;
+    }
+    return ARM64_ELF_OK;
+}
+
+void arm64_elf_free(arm64_elf_t *elf) {
+    arm64_free(elf->allocator, elf->sections, elf->section_capacity * sizeof(arm64_elf_section_t));
+    arm64_free(elf->allocator, elf->symbols, elf->symbol_capacity * sizeof(arm64_elf_symbol_t));
+    arm64_free(elf->allocator, elf->mappings,
+               elf->mapping_capacity * sizeof(arm64_elf_mapping_t));
+    memset(elf, 0, sizeof(*elf));
+}
+
+const char *arm64_elf_strerror(arm64_elf_status_t status) {
+    switch (status) {
+        case ARM64_ELF_OK:            return "成功";
+        case ARM64_ELF_NOT_ELF64:     return "不是 ELF64 文件";
+        case ARM64_ELF_NOT_AARCH64:   return "不是 AArch64 ELF";
+        case ARM64_ELF_BAD_SECTIONS:  return "节头表损坏";
+        case ARM64_ELF_NO_MEMORY:     return "内存不足";
+    }
+    return "未知错误";
+}
+
+/* ========== 文件映像 ========== */
+
+bool arm64_image_open(arm64_image_t *img, const char *path) {
+    memset(img, 0, sizeof(*img));
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    img->size = (size_t)st.st_size;
+    if (img->size > 0) {
+        void *p = mmap(NULL, img->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            img->data = p;
+            img->mapped = true;
+        }
+    }
+    close(fd);
+    if (img->mapped || img->size == 0) {
+        return true;
+    }
+#endif
+    /* 无法映射时整体读入 */
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    size_t capacity = size > 0 ? (size_t)size : 1;
+    uint8_t *buf = arm64_alloc(arm64_default_allocator(), capacity, 16);
+    if (!buf || (size > 0 && fread(buf, 1, (size_t)size, f) != (size_t)size)) {
+        arm64_free(arm64_default_allocator(), buf, capacity);
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+    img->data = buf;
+    img->size = (size_t)size;
+    return true;
+}
+
+void arm64_image_close(arm64_image_t *img) {
+#ifndef _WIN32
+    if (img->mapped) {
+        munmap((void *)img->data, img->size);
+        memset(img, 0, sizeof(*img));
+        return;
+    }
+#endif
+    arm64_free(arm64_default_allocator(), (void *)img->data, img->size > 0 ? img->size : 1);
+    memset(img, 0, sizeof(*img));
+}
+
+/* ========== 输入格式选项 ========== */
+
+void arm64_image_options_init(arm64_image_options_t *opts) {
+    opts->binary = false;
+    opts->vma = 0;
+    opts->endian = ARM64_ENDIAN_LITTLE;
+}
+
+int arm64_image_option(arm64_image_options_t *opts, int argc, char *argv[], int i) {
+    const char *arg = argv[i];
+    if (strcmp(arg, "-b") == 0 && i + 1 < argc && strcmp(argv[i + 1], "binary") == 0) {
+        opts->binary = true;
+        return 2;
+    }
+    if (strncmp(arg, "--adjust-vma=", 13) == 0) {
+        opts->vma = strtoull(arg + 13, NULL, 0);
+        return 1;
+    }
+    if (strcmp(arg, "-EB") == 0) {
+        opts->endian = ARM64_ENDIAN_BIG;
+        return 1;
+    }
+    if (strcmp(arg, "-EL") == 0) {
+        opts->endian = ARM64_ENDIAN_LITTLE;
+        return 1;
+    }
+    return 0;
+}
+
+#endif /* ARM64_DISASM_FREESTANDING */
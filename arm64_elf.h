@@ -0,0 +1,139 @@
+/**
+ * ARM64反汇编器 - 最小 ELF64 读取
+ * 只解析工具需要的部分：节头表（名称、地址、内容）和符号表，不解析程序头和重定位
+ * 节内容和名称直接指向调用者提供的文件映像，不复制
+ * 另外提供各命令行工具共用的文件映像打开和输入格式选项（-b binary、--adjust-vma、-EB/-EL）
+ */
+
+#ifndef ARM64_ELF_H
+#define ARM64_ELF_H
+
+#include "arm64_disasm.h"
+#include "arm64_alloc.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 节类型和标志（只列出用到的） */
+#define ARM64_ELF_SHT_PROGBITS      1
+#define ARM64_ELF_SHF_ALLOC         0x2
+#define ARM64_ELF_SHF_EXECINSTR     0x4
+
+/* 符号类型 */
+#define ARM64_ELF_STT_FUNC          2
+
+typedef enum {
+    ARM64_ELF_OK,
+    ARM64_ELF_NOT_ELF64,            // 不是 ELF64 文件
+    ARM64_ELF_NOT_AARCH64,          // e_machine 不是 EM_AARCH64
+    ARM64_ELF_BAD_SECTIONS,         // 节头表或节名字符串表损坏
+    ARM64_ELF_NO_MEMORY
+} arm64_elf_status_t;
+
+/* 节 */
+typedef struct {
+    const char *name;
+    uint32_t type;
+    uint64_t flags;
+    uint64_t address;
+    const uint8_t *data;            // 超出文件范围时为 NULL
+    uint64_t size;
+} arm64_elf_section_t;
+
+/* 符号 */
+typedef struct {
+    const char *name;
+    uint64_t address;
+    uint64_t size;
+    size_t section;                 // 所在节在 sections 中的下标；绝对、公共等特殊符号为 SIZE_MAX
+    uint8_t type;                   // STT_*
+    bool global;
+} arm64_elf_symbol_t;
+
+/* 映射符号（$x/$d）：节内从该地址起是指令还是数据（如字面量池） */
+typedef struct {
+    uint64_t address;
+    size_t section;                 // 所在节在 sections 中的下标
+    bool data;                      // $d 为 true，$x 为 false
+} arm64_elf_mapping_t;
+
+typedef struct {
+    bool big;                       // EI_DATA == ELFDATA2MSB
+    arm64_elf_section_t *sections;  // 按节头表顺序，不含索引0的空节
+    size_t section_count;
+    arm64_elf_symbol_t *symbols;    // 全局符号在前，其余按符号表顺序
+    size_t symbol_count;
+    arm64_elf_mapping_t *mappings;  // 映射符号，按节、地址排序
+    size_t mapping_count;
+    const arm64_allocator_t *allocator; // 节表和符号表的分配器（默认分配器）
+    size_t section_capacity;        // 内部：分配数量
+    size_t symbol_capacity;
+    size_t mapping_capacity;
+} arm64_elf_t;
+
+/**
+ * 解析 ELF64 映像
+ * 符号跳过未定义、节、文件符号和映射符号；映射符号（$x、$d 及带后缀的 $x.<名称> 等）
+ * 单独收集到 mappings；有 .symtab 时不使用 .dynsym
+ * @param data 文件内容，解析结果引用其中的数据，调用者保持有效直到 arm64_elf_free
+ */
+arm64_elf_status_t arm64_elf_parse(arm64_elf_t *elf, const void *data, size_t size);
+
+/**
+ * 释放解析结果（不释放文件内容）
+ */
+void arm64_elf_free(arm64_elf_t *elf);
+
+/**
+ * 错误描述
+ */
+const char *arm64_elf_strerror(arm64_elf_status_t status);
+
+/* ========== 文件映像 ========== */
+
+/* 只读文件映像：能映射时使用 mmap，否则整体读入 */
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    bool mapped;
+} arm64_image_t;
+
+/**
+ * 打开文件映像
+ * @return 失败时返回 false，errno 指明原因
+ */
+bool arm64_image_open(arm64_image_t *img, const char *path);
+
+/**
+ * 关闭文件映像
+ */
+void arm64_image_close(arm64_image_t *img);
+
+/* 输入格式选项：ELF（默认）或 -b binary 原始映像 */
+typedef struct {
+    bool binary;                    // -b binary
+    uint64_t vma;                   // --adjust-vma=地址：原始映像第一个字节的地址
+    arm64_endian_t endian;          // -EB/-EL：指令字节序（默认小端）
+} arm64_image_options_t;
+
+/**
+ * 初始化为默认值：ELF、地址0、小端
+ */
+void arm64_image_options_init(arm64_image_options_t *opts);
+
+/**
+ * 解析 argv[i] 处的一个输入格式选项
+ * @return 消耗的参数个数（-b binary 为2，其余为1）；不是输入格式选项时返回0
+ */
+int arm64_image_option(arm64_image_options_t *opts, int argc, char *argv[], int i);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_DISASM_FREESTANDING */
+
+#endif /* ARM64_ELF_H */
@@ -0,0 +1,1313 @@
+/**
+ * ARM64反汇编器 - 指令编码（表驱动版本）
+ * 将解码结果重新编码为32位指令字，覆盖所有解码器支持的形式
+ */
+
+#include "arm64_disasm.h"
+#include "arm64_decode_table.h"
+
+/* ========== 编码表结构 ========== */
+
+struct encode_entry;
+
+/* 编码函数类型：在 entry->base 的基础上填入可变字段 */
+typedef bool (*encode_func_t)(const disasm_inst_t *inst, const struct encode_entry *entry,
+                              uint32_t *out);
+
+/* 编码表条目 */
+typedef struct encode_entry {
+    inst_type_t type;       /* 指令类型（表按此字段升序排列） */
+    const char *mnemonic;   /* 助记符，NULL表示该类型的任意助记符 */
+    uint32_t base;          /* 固定位：操作码以及别名固定的寄存器字段 */
+    uint8_t flags;          /* ENC_F_* */
+    encode_func_t encoder;  /* 编码函数 */
+} encode_entry_t;
+
+/* 条目标志 */
+#define ENC_F_SIZE_SUFFIX   0x01    /* 助记符可带 b/h 大小后缀（ldxrb、ldarh等） */
+#define ENC_F_UNSCALED      0x02    /* ldur/stur 系列：只接受未缩放的有符号偏移 */
+#define ENC_F_INVERT_COND   0x04    /* 别名中的条件码为编码值取反（cset/cinc等） */
+#define ENC_F_RM_IS_RN      0x08    /* 别名中 Rm 与 Rn 相同（cinc/ror等） */
+#define ENC_F_SIGN_EXTEND   0x10    /* 有符号扩展的加载对（ldpsw） */
+
+/*
+ * 别名固定的寄存器字段（如 cmp 的 Rd=31、cset 的 Rn=Rm=31）直接写在 base 中。
+ * 这些字段全为1，编码函数再按位或入解码结果中的寄存器号不会改变它们。
+ */
+
+/* ========== 字段辅助函数 ========== */
+
+#define REG5(r)     ((uint32_t)(r) & 0x1F)
+
+static inline bool fits_signed(int64_t value, unsigned bits) {
+    int64_t limit = (int64_t)1 << (bits - 1);
+    return value >= -limit && value < limit;
+}
+
+static inline uint32_t sf_bit(const disasm_inst_t *inst) {
+    return inst->is_64bit ? (1u << 31) : 0;
+}
+
+static inline bool is_gpr_type(reg_type_t type) {
+    return type <= REG_TYPE_WZR;
+}
+
+static inline bool is_simd_scalar_type(reg_type_t type) {
+    return type >= REG_TYPE_B && type <= REG_TYPE_D;
+}
+
+/* 标量浮点寄存器类型对应的 ftype 字段，非浮点类型返回-1 */
+static int fp_type_bits(reg_type_t type) {
+    switch (type) {
+        case REG_TYPE_S: return 0;
+        case REG_TYPE_D: return 1;
+        case REG_TYPE_H: return 3;
+        default: return -1;
+    }
+}
+
+/* SIMD标量寄存器类型对应的 size 字段（B/H/S/D），其他类型返回-1 */
+static int simd_size_bits(reg_type_t type) {
+    return is_simd_scalar_type(type) ? (int)(type - REG_TYPE_B) : -1;
+}
+
+/**
+ * 根据助记符后缀确定访问大小（log2字节）
+ * ldxrb/ldaddb 等为0，ldxrh/ldaddh 等为1，其余按目标寄存器宽度
+ */
+static uint8_t size_from_mnemonic(const disasm_inst_t *inst) {
+    size_t len = strbuf_strlen(inst->mnemonic);
+    char last = len ? inst->mnemonic[len - 1] : '\0';
+
+    if (last == 'b') return 0;
+    if (last == 'h') return 1;
+    return (inst->rd_type == REG_TYPE_X) ? 3 : 2;
+}
+
+/**
+ * 编码PC相对偏移字段
+ * @param offset 字节偏移（必须4字节对齐）
+ * @param bits 字段宽度（按指令数计）
+ */
+static bool encode_branch_offset(int64_t offset, unsigned bits, uint32_t *field) {
+    if ((offset & 3) != 0 || !fits_signed(offset >> 2, bits)) {
+        return false;
+    }
+    *field = (uint32_t)(offset >> 2) & ((1u << bits) - 1);
+    return true;
+}
+
+/**
+ * 移位寄存器形式的 shift 字段
+ * 解码结果中 extend_type 为 EXTEND_LSL..EXTEND_ROR；未移位时也接受未设置的 extend_type
+ * @return shift 字段值，无效时返回-1
+ */
+static int shift_type_bits(const disasm_inst_t *inst, int max_shift) {
+    if (inst->extend_type >= EXTEND_LSL && inst->extend_type <= EXTEND_ROR) {
+        int shift = (int)(inst->extend_type - EXTEND_LSL);
+        return (shift <= max_shift) ? shift : -1;
+    }
+    return (inst->shift_amount == 0) ? 0 : -1;
+}
+
+/**
+ * 查找最后一个指定种类的操作数
+ */
+static const disasm_operand_t *find_operand(const disasm_inst_t *inst, operand_kind_t kind) {
+    for (int i = (int)inst->operand_count - 1; i >= 0; i--) {
+        if (inst->operands[i].kind == kind) {
+            return &inst->operands[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * 将位掩码编码为逻辑立即数字段 N:immr:imms（DecodeBitMasks 的逆运算）
+ * @return 不可表示的值返回false
+ */
+static bool encode_bit_masks(uint64_t value, bool is_64bit,
+                             uint8_t *n, uint8_t *immr, uint8_t *imms) {
+    if (!is_64bit) {
+        value &= 0xFFFFFFFFULL;
+        value |= value << 32;
+    }
+    if (value == 0 || value == ~0ULL) {
+        return false;
+    }
+
+    /* 找出最小的重复元素 */
+    unsigned esize = 64;
+    while (esize > 2) {
+        unsigned half = esize / 2;
+        uint64_t mask = (1ULL << half) - 1;
+        if ((value & mask) != ((value >> half) & mask)) {
+            break;
+        }
+        esize = half;
+    }
+
+    uint64_t emask = (esize == 64) ? ~0ULL : ((1ULL << esize) - 1);
+    uint64_t elem = value & emask;
+
+    unsigned ones = 0;
+    for (uint64_t v = elem; v; v &= v - 1) {
+        ones++;
+    }
+    uint64_t run = (ones == 64) ? ~0ULL : ((1ULL << ones) - 1);
+
+    /* 元素必须是循环右移 r 位的连续1 */
+    for (unsigned r = 0; r < esize; r++) {
+        uint64_t rotated = (r == 0) ? elem : (((elem << r) | (elem >> (esize - r))) & emask);
+        if (rotated == run) {
+            *n = (esize == 64) ? 1 : 0;
+            *immr = (uint8_t)r;
+            *imms = (uint8_t)(((~(esize - 1) << 1) & 0x3F) | (ones - 1));
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ========== 分支/系统指令编码 ========== */
+
+/**
+ * 无操作数或操作数固定的指令 - NOP/HINT/ERET/DRPS
+ */
+static bool enc_fixed(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    *out = entry->base;
+    return true;
+}
+
+/**
+ * B/BL：imm26
+ */
+static bool enc_uncond_branch_imm(const disasm_inst_t *inst, const encode_entry_t *entry,
+                                  uint32_t *out) {
+    uint32_t imm26;
+    if (!encode_branch_offset(inst->imm, 26, &imm26)) return false;
+    *out = entry->base | imm26;
+    return true;
+}
+
+/**
+ * B.cond：imm19|cond
+ */
+static bool enc_cond_branch_imm(const disasm_inst_t *inst, const encode_entry_t *entry,
+                                uint32_t *out) {
+    uint32_t imm19;
+    if (!encode_branch_offset(inst->imm, 19, &imm19)) return false;
+    *out = entry->base | (imm19 << 5) | (inst->cond & 0xF);
+    return true;
+}
+
+/**
+ * CBZ/CBNZ：sf|imm19|Rt
+ */
+static bool enc_compare_branch(const disasm_inst_t *inst, const encode_entry_t *entry,
+                               uint32_t *out) {
+    uint32_t imm19;
+    if (!encode_branch_offset(inst->imm, 19, &imm19)) return false;
+    *out = entry->base | sf_bit(inst) | (imm19 << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * TBZ/TBNZ：b5|b40|imm14|Rt，位号在 shift_amount 中
+ */
+static bool enc_test_branch(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    uint32_t imm14;
+    uint8_t bit = inst->shift_amount;
+    if (bit > 63 || !encode_branch_offset(inst->imm, 14, &imm14)) return false;
+    *out = entry->base | ((uint32_t)(bit >> 5) << 31) | ((uint32_t)(bit & 0x1F) << 19) |
+           (imm14 << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * BR/BLR/RET：Rn
+ */
+static bool enc_branch_reg(const disasm_inst_t *inst, const encode_entry_t *entry,
+                           uint32_t *out) {
+    *out = entry->base | (REG5(inst->rn) << 5);
+    return true;
+}
+
+/**
+ * MRS：系统寄存器编码 bits[20:5] 取自 OPERAND_SYSREG 操作数
+ */
+static bool enc_mrs(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    const disasm_operand_t *op = find_operand(inst, OPERAND_SYSREG);
+    if (!op) return false;
+    *out = entry->base | ((uint32_t)op->sysreg << 5) | REG5(inst->rd);
+    return true;
+}
+
+/* ========== 加载/存储编码 ========== */
+
+/* 单寄存器加载/存储的 size/V/opc，按（指令类型，目标寄存器类型）查找 */
+typedef struct {
+    inst_type_t type;
+    reg_type_t reg_type;
+    uint8_t size;
+    uint8_t V;
+    uint8_t opc;
+    uint8_t scale;          /* 偏移缩放位数（Q寄存器为4，其余等于size） */
+} ls_form_t;
+
+static const ls_form_t ls_forms[] = {
+    { INST_TYPE_STRB,  REG_TYPE_W, 0, 0, 0, 0 },
+    { INST_TYPE_LDRB,  REG_TYPE_W, 0, 0, 1, 0 },
+    { INST_TYPE_LDRSB, REG_TYPE_X, 0, 0, 2, 0 },
+    { INST_TYPE_LDRSB, REG_TYPE_W, 0, 0, 3, 0 },
+    { INST_TYPE_STRH,  REG_TYPE_W, 1, 0, 0, 1 },
+    { INST_TYPE_LDRH,  REG_TYPE_W, 1, 0, 1, 1 },
+    { INST_TYPE_LDRSH, REG_TYPE_X, 1, 0, 2, 1 },
+    { INST_TYPE_LDRSH, REG_TYPE_W, 1, 0, 3, 1 },
+    { INST_TYPE_STR,   REG_TYPE_W, 2, 0, 0, 2 },
+    { INST_TYPE_LDR,   REG_TYPE_W, 2, 0, 1, 2 },
+    { INST_TYPE_LDRSW, REG_TYPE_X, 2, 0, 2, 2 },
+    { INST_TYPE_STR,   REG_TYPE_X, 3, 0, 0, 3 },
+    { INST_TYPE_LDR,   REG_TYPE_X, 3, 0, 1, 3 },
+    { INST_TYPE_PRFM,  REG_TYPE_X, 3, 0, 2, 3 },
+    { INST_TYPE_STR,   REG_TYPE_B, 0, 1, 0, 0 },
+    { INST_TYPE_LDR,   REG_TYPE_B, 0, 1, 1, 0 },
+    { INST_TYPE_STR,   REG_TYPE_Q, 0, 1, 2, 4 },
+    { INST_TYPE_LDR,   REG_TYPE_Q, 0, 1, 3, 4 },
+    { INST_TYPE_STR,   REG_TYPE_H, 1, 1, 0, 1 },
+    { INST_TYPE_LDR,   REG_TYPE_H, 1, 1, 1, 1 },
+    { INST_TYPE_STR,   REG_TYPE_S, 2, 1, 0, 2 },
+    { INST_TYPE_LDR,   REG_TYPE_S, 2, 1, 1, 2 },
+    { INST_TYPE_STR,   REG_TYPE_D, 3, 1, 0, 3 },
+    { INST_TYPE_LDR,   REG_TYPE_D, 3, 1, 1, 3 },
+};
+
+static const ls_form_t *find_ls_form(inst_type_t type, reg_type_t reg_type) {
+    for (size_t i = 0; i < ARRAY_SIZE(ls_forms); i++) {
+        if (ls_forms[i].type == type && ls_forms[i].reg_type == reg_type) {
+            return &ls_forms[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * LDR (literal)：opc|011|V|00|imm19|Rt
+ */
+static bool enc_load_literal(const disasm_inst_t *inst, uint32_t *out) {
+    uint32_t opc, V = 0, imm19;
+
+    switch (inst->rd_type) {
+        case REG_TYPE_W: opc = 0; break;
+        case REG_TYPE_X: opc = (inst->type == INST_TYPE_LDRSW) ? 2 : 1; break;
+        case REG_TYPE_S: opc = 0; V = 1; break;
+        case REG_TYPE_D: opc = 1; V = 1; break;
+        case REG_TYPE_Q: opc = 2; V = 1; break;
+        default: return false;
+    }
+    if (inst->type == INST_TYPE_PRFM) {
+        /* PRFM (literal)：Rt 为预取操作 */
+        if (V) return false;
+        opc = 3;
+    }
+    if (inst->type == INST_TYPE_LDRSW && inst->rd_type != REG_TYPE_X) return false;
+    if (!encode_branch_offset(inst->imm, 19, &imm19)) return false;
+
+    *out = 0x18000000 | (opc << 30) | (V << 26) | (imm19 << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 单寄存器加载/存储：按寻址模式选择无符号偏移、寄存器偏移、未缩放/前后索引或字面量形式
+ */
+static bool enc_ls_single(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    bool unscaled = (entry->flags & ENC_F_UNSCALED) != 0;
+
+    if (inst->addr_mode == ADDR_MODE_LITERAL) {
+        if (unscaled || (inst->type != INST_TYPE_LDR && inst->type != INST_TYPE_LDRSW &&
+                         inst->type != INST_TYPE_PRFM)) {
+            return false;
+        }
+        return enc_load_literal(inst, out);
+    }
+
+    const ls_form_t *form = find_ls_form(inst->type, inst->rd_type);
+    if (!form) return false;
+
+    uint32_t word = ((uint32_t)form->size << 30) | ((uint32_t)form->V << 26) |
+                    ((uint32_t)form->opc << 22) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+
+    /* ldur/stur 只有未缩放形式，ldr/str 则没有 */
+    if (unscaled != (inst->addr_mode == ADDR_MODE_IMM_SIGNED)) {
+        return false;
+    }
+
+    switch (inst->addr_mode) {
+        case ADDR_MODE_IMM_UNSIGNED: {
+            int64_t scaled = inst->imm >> form->scale;
+            if (inst->imm < 0 || (scaled << form->scale) != inst->imm || scaled > 0xFFF) {
+                return false;
+            }
+            *out = 0x39000000 | word | ((uint32_t)scaled << 10);
+            return true;
+        }
+        case ADDR_MODE_IMM_SIGNED:
+        case ADDR_MODE_PRE_INDEX:
+        case ADDR_MODE_POST_INDEX: {
+            uint32_t idx = (inst->addr_mode == ADDR_MODE_PRE_INDEX) ? 3 :
+                           (inst->addr_mode == ADDR_MODE_POST_INDEX) ? 1 : 0;
+            if (!fits_signed(inst->imm, 9)) return false;
+            /* PRFM 没有前/后索引形式 */
+            if (idx != 0 && inst->type == INST_TYPE_PRFM) return false;
+            *out = 0x38000000 | word | (((uint32_t)inst->imm & 0x1FF) << 12) | (idx << 10);
+            return true;
+        }
+        case ADDR_MODE_REG_OFFSET:
+        case ADDR_MODE_REG_EXTEND: {
+            /* option 取 extend_type 的低3位（011 即 LSL），S 表示按访问大小缩放 */
+            uint32_t option = (uint32_t)inst->extend_type & 0x7;
+            if (!(option & 0x2)) return false;
+            uint32_t S = (inst->shift_amount != 0) ? 1 : 0;
+            if (S && inst->shift_amount != form->scale) return false;
+            *out = 0x38200800 | word | (REG5(inst->rm) << 16) | (option << 13) | (S << 12);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * LDP/STP/LDPSW：opc|101|V|idx|L|imm7|Rt2|Rn|Rt
+ */
+static bool enc_ls_pair(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    uint32_t opc, V = 0, scale;
+
+    if (entry->flags & ENC_F_SIGN_EXTEND) {
+        if (inst->rd_type != REG_TYPE_X) return false;
+        opc = 0;    /* opc=01 已在 base 中 */
+        scale = 2;
+    } else {
+        switch (inst->rd_type) {
+            case REG_TYPE_W: opc = 0; scale = 2; break;
+            case REG_TYPE_X: opc = 2; scale = 3; break;
+            case REG_TYPE_S: opc = 0; scale = 2; V = 1; break;
+            case REG_TYPE_D: opc = 1; scale = 3; V = 1; break;
+            case REG_TYPE_Q: opc = 2; scale = 4; V = 1; break;
+            default: return false;
+        }
+    }
+
+    uint32_t idx;
+    switch (inst->addr_mode) {
+        case ADDR_MODE_POST_INDEX: idx = 1; break;
+        case ADDR_MODE_IMM_SIGNED: idx = 2; break;
+        case ADDR_MODE_PRE_INDEX:  idx = 3; break;
+        default: return false;
+    }
+
+    int64_t scaled = inst->imm / ((int64_t)1 << scale);
+    if (scaled * ((int64_t)1 << scale) != inst->imm || !fits_signed(scaled, 7)) {
+        return false;
+    }
+
+    *out = entry->base | (opc << 30) | (V << 26) | (idx << 23) |
+           (((uint32_t)scaled & 0x7F) << 15) | (REG5(inst->rt2) << 10) |
+           (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 独占/获取-释放加载存储：size|001000|o2|L|o1|Rs|o0|Rt2|Rn|Rt
+ * 只填写该形式实际使用的 Rs/Rt2，未使用的字段在 base 中为11111
+ */
+static bool enc_ls_exclusive(const disasm_inst_t *inst, const encode_entry_t *entry,
+                             uint32_t *out) {
+    uint32_t base = entry->base;
+    bool o2 = BIT(base, 23), L = BIT(base, 22), o1 = BIT(base, 21);
+    uint32_t word = base | ((uint32_t)size_from_mnemonic(inst) << 30) |
+                    (REG5(inst->rn) << 5) | REG5(inst->rd);
+
+    if (!o2 && !L) {
+        word |= REG5(inst->rm) << 16;       /* 状态寄存器 Ws */
+    }
+    if (!o2 && o1) {
+        word |= REG5(inst->rt2) << 10;      /* 寄存器对 */
+    }
+    *out = word;
+    return true;
+}
+
+/**
+ * LSE原子操作：size|111|0|00|A|R|1|Rs|o3|opc|00|Rn|Rt
+ */
+static bool enc_atomic(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    *out = entry->base | ((uint32_t)size_from_mnemonic(inst) << 30) |
+           ((uint32_t)inst->is_acquire << 23) | ((uint32_t)inst->is_release << 22) |
+           (REG5(inst->rm) << 16) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * CAS：size|0010001|L|1|Rs|o0|11111|Rn|Rt
+ */
+static bool enc_cas(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    *out = entry->base | ((uint32_t)size_from_mnemonic(inst) << 30) |
+           ((uint32_t)inst->is_acquire << 22) | (REG5(inst->rm) << 16) |
+           ((uint32_t)inst->is_release << 15) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/* ========== 数据处理（立即数）编码 ========== */
+
+/**
+ * ADR/ADRP：op|immlo|10000|immhi|Rd
+ */
+static bool enc_pc_rel_addr(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    int64_t value = inst->imm;
+
+    if (inst->type == INST_TYPE_ADRP) {
+        if ((value & 0xFFF) != 0) return false;
+        value >>= 12;
+    }
+    if (!fits_signed(value, 21)) return false;
+
+    uint32_t imm21 = (uint32_t)value & 0x1FFFFF;
+    *out = entry->base | ((imm21 & 0x3) << 29) | ((imm21 >> 2) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 加法/减法（立即数）：sf|op|S|100010|sh|imm12|Rn|Rd
+ */
+static bool enc_add_sub_imm(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    if (!inst->has_imm || !is_gpr_type(inst->rd_type)) return false;
+    if (inst->imm < 0 || inst->imm > 0xFFF) return false;
+    if (inst->shift_amount != 0 && inst->shift_amount != 12) return false;
+
+    *out = entry->base | sf_bit(inst) | ((inst->shift_amount == 12) ? (1u << 22) : 0) |
+           ((uint32_t)inst->imm << 10) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * MOV (to/from SP)：add Rd, Rn, #0
+ * 与 orr 形式的 mov 区分：orr 形式的 Rn 固定为零寄存器
+ */
+static bool enc_mov_sp(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    if (inst->has_imm) return false;
+    if (inst->rn == 31 && inst->rn_type != REG_TYPE_SP && inst->rd_type != REG_TYPE_SP) {
+        return false;
+    }
+    *out = entry->base | sf_bit(inst) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 逻辑运算（立即数）：sf|opc|100100|N|immr|imms|Rn|Rd
+ * 立即数取自 OPERAND_IMM 操作数中的位掩码（inst->imm 不含 N 位）
+ */
+static bool enc_logical_imm(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    if (!inst->has_imm) return false;
+
+    const disasm_operand_t *op = find_operand(inst, OPERAND_IMM);
+    uint8_t n, immr, imms;
+    if (!op || !encode_bit_masks((uint64_t)op->imm, inst->is_64bit, &n, &immr, &imms)) {
+        return false;
+    }
+
+    *out = entry->base | sf_bit(inst) | ((uint32_t)n << 22) | ((uint32_t)immr << 16) |
+           ((uint32_t)imms << 10) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * MOVZ/MOVN/MOVK：sf|opc|100101|hw|imm16|Rd
+ */
+static bool enc_move_wide(const disasm_inst_t *inst, const encode_entry_t *entry,
+                          uint32_t *out) {
+    uint32_t hw = inst->shift_amount / 16;
+
+    if (inst->imm < 0 || inst->imm > 0xFFFF) return false;
+    if ((inst->shift_amount % 16) != 0 || hw > (inst->is_64bit ? 3u : 1u)) return false;
+
+    *out = entry->base | sf_bit(inst) | (hw << 21) | ((uint32_t)inst->imm << 5) |
+           REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 位域操作：sf|opc|100110|N|immr|imms|Rn|Rd，inst->imm 为 immr:imms
+ */
+static bool enc_bitfield(const disasm_inst_t *inst, const encode_entry_t *entry,
+                         uint32_t *out) {
+    if (!inst->has_imm) return false;
+
+    uint32_t immr = (uint32_t)(inst->imm >> 6) & 0x3F;
+    uint32_t imms = (uint32_t)inst->imm & 0x3F;
+    if (!inst->is_64bit && (immr > 31 || imms > 31)) return false;
+
+    *out = entry->base | sf_bit(inst) | (inst->is_64bit ? (1u << 22) : 0) |
+           (immr << 16) | (imms << 10) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * EXTR/ROR (immediate)：sf|00|100111|N|0|Rm|imms|Rn|Rd
+ */
+static bool enc_extract(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    if (!inst->has_imm) return false;
+    if (inst->imm < 0 || inst->imm >= (inst->is_64bit ? 64 : 32)) return false;
+
+    uint8_t rm = (entry->flags & ENC_F_RM_IS_RN) ? inst->rn : inst->rm;
+    *out = entry->base | sf_bit(inst) | (inst->is_64bit ? (1u << 22) : 0) |
+           (REG5(rm) << 16) | ((uint32_t)inst->imm << 10) |
+           (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/* ========== 数据处理（寄存器）编码 ========== */
+
+/**
+ * 逻辑运算（移位寄存器）：sf|opc|01010|shift|N|Rm|imm6|Rn|Rd
+ */
+static bool enc_logical_reg(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    if (inst->has_imm || !is_gpr_type(inst->rd_type)) return false;
+    /* orr 形式的 mov 的 Rn 为零寄存器，SP 表示 add 形式 */
+    if (inst->rn_type == REG_TYPE_SP || inst->rd_type == REG_TYPE_SP) return false;
+
+    int shift = shift_type_bits(inst, 3);
+    if (shift < 0 || inst->shift_amount >= (inst->is_64bit ? 64 : 32)) return false;
+
+    *out = entry->base | sf_bit(inst) | ((uint32_t)shift << 22) | (REG5(inst->rm) << 16) |
+           ((uint32_t)inst->shift_amount << 10) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 加法/减法（移位寄存器）：sf|op|S|01011|shift|0|Rm|imm6|Rn|Rd
+ */
+static bool enc_add_sub_reg(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    if (inst->has_imm || is_simd_scalar_type(inst->rd_type)) return false;
+
+    int shift = shift_type_bits(inst, 2);
+    if (shift < 0 || inst->shift_amount >= (inst->is_64bit ? 64 : 32)) return false;
+
+    *out = entry->base | sf_bit(inst) | ((uint32_t)shift << 22) | (REG5(inst->rm) << 16) |
+           ((uint32_t)inst->shift_amount << 10) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 数据处理（1源/2源寄存器）：sf|...|Rm|opcode|Rn|Rd
+ */
+static bool enc_data_proc_reg(const disasm_inst_t *inst, const encode_entry_t *entry,
+                              uint32_t *out) {
+    if (inst->has_imm) return false;
+
+    uint32_t base = entry->base;
+    /* 64位 REV 的 opcode 为000011，32位为000010（后者在64位下是 REV32） */
+    if (inst->type == INST_TYPE_REV && inst->is_64bit) {
+        base |= 1u << 10;
+    }
+    if (inst->type == INST_TYPE_REV32 && !inst->is_64bit) {
+        return false;
+    }
+
+    *out = base | sf_bit(inst) | (REG5(inst->rm) << 16) | (REG5(inst->rn) << 5) |
+           REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 数据处理（3源寄存器）：sf|00|11011|000|Rm|o0|Ra|Rn|Rd
+ */
+static bool enc_data_proc_3src(const disasm_inst_t *inst, const encode_entry_t *entry,
+                               uint32_t *out) {
+    *out = entry->base | sf_bit(inst) | (REG5(inst->rm) << 16) | (REG5(inst->ra) << 10) |
+           (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 条件选择：sf|op|0|11010100|Rm|cond|op2|Rn|Rd
+ */
+static bool enc_cond_select(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    uint32_t cond = inst->cond & 0xF;
+    uint8_t rm = (entry->flags & ENC_F_RM_IS_RN) ? inst->rn : inst->rm;
+
+    if (entry->flags & ENC_F_INVERT_COND) {
+        cond ^= 1;
+    }
+
+    *out = entry->base | sf_bit(inst) | (REG5(rm) << 16) | (cond << 12) |
+           (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/* ========== 浮点/SIMD编码 ========== */
+
+/**
+ * 浮点数据处理（1源）：0|0|0|11110|ftype|1|opcode|10000|Rn|Rd
+ * FCVT 的目标精度（opcode低2位）由 rd_type 决定
+ */
+static bool enc_fp_1src(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    int ftype = fp_type_bits(inst->rn_type);
+    int dtype = fp_type_bits(inst->rd_type);
+    if (inst->has_imm || ftype < 0 || dtype < 0) return false;
+
+    uint32_t word = entry->base | ((uint32_t)ftype << 22) | (REG5(inst->rn) << 5) |
+                    REG5(inst->rd);
+    if (inst->type == INST_TYPE_FCVT) {
+        word |= (uint32_t)dtype << 15;
+    } else if (dtype != ftype) {
+        return false;
+    }
+    *out = word;
+    return true;
+}
+
+/**
+ * 浮点数据处理（2源）/条件选择：ftype|Rm|...|Rn|Rd
+ */
+static bool enc_fp_2src(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    int ftype = fp_type_bits(inst->rd_type);
+    if (ftype < 0) return false;
+
+    *out = entry->base | ((uint32_t)ftype << 22) | (REG5(inst->rm) << 16) |
+           ((uint32_t)(inst->cond & 0xF) << 12) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 浮点数据处理（3源）：ftype|o1|Rm|o0|Ra|Rn|Rd
+ */
+static bool enc_fp_3src(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    int ftype = fp_type_bits(inst->rd_type);
+    if (ftype < 0) return false;
+
+    *out = entry->base | ((uint32_t)ftype << 22) | (REG5(inst->rm) << 16) |
+           (REG5(inst->ra) << 10) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * 浮点比较：ftype|Rm|00|1000|Rn|opcode2，与 #0.0 比较时 opcode2 的 bit3 置位
+ */
+static bool enc_fp_compare(const disasm_inst_t *inst, const encode_entry_t *entry,
+                           uint32_t *out) {
+    int ftype = fp_type_bits(inst->rn_type);
+    if (ftype < 0 || (inst->has_imm && inst->imm != 0)) return false;
+
+    *out = entry->base | ((uint32_t)ftype << 22) | (REG5(inst->rm) << 16) |
+           (REG5(inst->rn) << 5) | (inst->has_imm ? 0x08u : 0);
+    return true;
+}
+
+/**
+ * 浮点条件比较：ftype|Rm|cond|01|Rn|op|nzcv
+ */
+static bool enc_fp_cond_compare(const disasm_inst_t *inst, const encode_entry_t *entry,
+                                uint32_t *out) {
+    int ftype = fp_type_bits(inst->rn_type);
+    if (ftype < 0 || inst->imm < 0 || inst->imm > 0xF) return false;
+
+    *out = entry->base | ((uint32_t)ftype << 22) | (REG5(inst->rm) << 16) |
+           ((uint32_t)(inst->cond & 0xF) << 12) | (REG5(inst->rn) << 5) | (uint32_t)inst->imm;
+    return true;
+}
+
+/**
+ * 浮点/整数转换：sf|0|0|11110|ftype|1|rmode|opcode|000000|Rn|Rd
+ * 方向由寄存器类型决定：fmov 到通用寄存器时 opcode 为111，反之为110
+ */
+static bool enc_fp_int_conv(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    bool to_gpr = is_gpr_type(inst->rd_type);
+    reg_type_t gpr = to_gpr ? inst->rd_type : inst->rn_type;
+    reg_type_t fpr = to_gpr ? inst->rn_type : inst->rd_type;
+    int ftype = fp_type_bits(fpr);
+
+    if (inst->has_imm || !is_gpr_type(gpr) || ftype < 0) return false;
+
+    uint32_t base = entry->base;
+    if (inst->type == INST_TYPE_FMOV) {
+        if (to_gpr) base |= 1u << 16;
+    } else {
+        /* scvtf/ucvtf 从通用寄存器转换，其余转换到通用寄存器 */
+        bool from_int = (inst->type == INST_TYPE_SCVTF || inst->type == INST_TYPE_UCVTF);
+        if (from_int == to_gpr) return false;
+    }
+
+    *out = base | sf_bit(inst) | ((uint32_t)ftype << 22) | (REG5(inst->rn) << 5) |
+           REG5(inst->rd);
+    return true;
+}
+
+/**
+ * FMOV (immediate)：ftype|1|imm8|100|00000|Rd
+ */
+static bool enc_fp_imm(const disasm_inst_t *inst, const encode_entry_t *entry, uint32_t *out) {
+    int ftype = fp_type_bits(inst->rd_type);
+    if (!inst->has_imm || ftype < 0 || inst->imm < 0 || inst->imm > 0xFF) return false;
+
+    *out = entry->base | ((uint32_t)ftype << 22) | ((uint32_t)inst->imm << 13) |
+           REG5(inst->rd);
+    return true;
+}
+
+/**
+ * SIMD标量复制 DUP (element)：imm5 由元素大小和下标组成
+ */
+static bool enc_simd_scalar_dup(const disasm_inst_t *inst, const encode_entry_t *entry,
+                                uint32_t *out) {
+    int size = simd_size_bits(inst->rd_type);
+    if (size < 0 || inst->imm < 0 || inst->imm >= (16 >> size)) return false;
+
+    uint32_t imm5 = ((uint32_t)inst->imm << (size + 1)) | (1u << size);
+    *out = entry->base | (imm5 << 16) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * SIMD标量三寄存器/两寄存器杂项：size|...|Rm|opcode|Rn|Rd
+ */
+static bool enc_simd_scalar(const disasm_inst_t *inst, const encode_entry_t *entry,
+                            uint32_t *out) {
+    int size = simd_size_bits(inst->rd_type);
+    if (size < 0) return false;
+
+    *out = entry->base | ((uint32_t)size << 22) | (REG5(inst->rm) << 16) |
+           (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/**
+ * SIMD标量两寄存器杂项：不含 Rm 字段
+ */
+static bool enc_simd_scalar_2reg(const disasm_inst_t *inst, const encode_entry_t *entry,
+                                 uint32_t *out) {
+    int size = simd_size_bits(inst->rd_type);
+    if (size < 0) return false;
+
+    *out = entry->base | ((uint32_t)size << 22) | (REG5(inst->rn) << 5) | REG5(inst->rd);
+    return true;
+}
+
+/* ========== 编码表 ========== */
+
+/* 操作码构造宏：与对应解码函数注释中的编码格式一一对应 */
+#define ADD_SUB_IMM(op, S)      (0x11000000u | ((op) << 30) | ((S) << 29))
+#define ADD_SUB_REG(op, S)      (0x0B000000u | ((op) << 30) | ((S) << 29))
+#define LOGICAL_IMM(opc)        (0x12000000u | ((opc) << 29))
+#define LOGICAL_REG(opc, N)     (0x0A000000u | ((opc) << 29) | ((N) << 21))
+#define MOVE_WIDE(opc)          (0x12800000u | ((opc) << 29))
+#define BITFIELD(opc)           (0x13000000u | ((opc) << 29))
+#define DP_1SRC(opcode)         (0x5AC00000u | ((opcode) << 10))
+#define DP_2SRC(opcode)         (0x1AC00000u | ((opcode) << 10))
+#define DP_3SRC(o0)             (0x1B000000u | ((o0) << 15))
+#define COND_SEL(op, op2)       (0x1A800000u | ((op) << 30) | ((op2) << 10))
+#define LS_EXCL(o2, L, o1, o0)  (0x08000000u | ((o2) << 23) | ((L) << 22) | ((o1) << 21) | ((o0) << 15))
+#define ATOMIC(o3, opc)         (0x38200000u | ((o3) << 15) | ((opc) << 12))
+#define FP_1SRC(opcode)         (0x1E204000u | ((opcode) << 15))
+#define FP_2SRC(opcode)         (0x1E200800u | ((opcode) << 12))
+#define FP_3SRC(o1, o0)         (0x1F000000u | ((o1) << 21) | ((o0) << 15))
+#define FP_INT(rmode, opcode)   (0x1E200000u | ((rmode) << 19) | ((opcode) << 16))
+#define SIMD_3SAME(U, opcode)   (0x5E200400u | ((U) << 29) | ((opcode) << 11))
+#define SIMD_2MISC(U, opcode)   (0x5E200800u | ((U) << 29) | ((opcode) << 12))
+
+/* 别名固定的寄存器字段 */
+#define RD_ZR   0x0000001Fu
+#define RN_ZR   0x000003E0u
+#define RM_ZR   0x001F0000u
+#define RA_ZR   0x00007C00u
+#define RS_ZR   0x001F0000u     /* 独占加载存储的 Rs 字段 */
+#define RT2_ZR  0x00007C00u     /* 独占加载存储的 Rt2 字段 */
+
+#define ENC(type, mn, base, fn)             { (type), (mn), (base), 0, (fn) }
+#define ENC_FLAGS(type, mn, base, f, fn)    { (type), (mn), (base), (f), (fn) }
+
+/*
+ * 按 inst_type_t 升序排列（查找时二分定位类型，再按助记符和操作数形式逐条尝试）。
+ * 同一类型、同一助记符的多种形式（如 add 的立即数/寄存器/SIMD形式）由编码函数检查
+ * 操作数形式，不匹配时返回false继续尝试下一条。
+ */
+static const encode_entry_t encode_table[] = {
+    /* 加载/存储 */
+    ENC(INST_TYPE_LDR,   "ldr",    0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_LDR,   "ldur",   0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_LDRB,  "ldrb",   0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_LDRB,  "ldurb",  0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_LDRH,  "ldrh",   0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_LDRH,  "ldurh",  0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_LDRSW, "ldrsw",  0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_LDRSW, "ldursw", 0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_LDRSB, "ldrsb",  0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_LDRSB, "ldursb", 0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_LDRSH, "ldrsh",  0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_LDRSH, "ldursh", 0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_STR,   "str",    0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_STR,   "stur",   0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_STRB,  "strb",   0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_STRB,  "sturb",  0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_STRH,  "strh",   0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_STRH,  "sturh",  0, ENC_F_UNSCALED, enc_ls_single),
+    ENC(INST_TYPE_STP,   "stp",    0x28000000, enc_ls_pair),
+    ENC(INST_TYPE_LDP,   "ldp",    0x28400000, enc_ls_pair),
+    ENC_FLAGS(INST_TYPE_LDP,   "ldpsw",  0x68400000, ENC_F_SIGN_EXTEND, enc_ls_pair),
+
+    /* 移动 */
+    ENC(INST_TYPE_MOV,   "mov",    ADD_SUB_IMM(0, 0), enc_mov_sp),
+    ENC(INST_TYPE_MOV,   "mov",    LOGICAL_IMM(1) | RN_ZR, enc_logical_imm),
+    ENC(INST_TYPE_MOV,   "mov",    LOGICAL_REG(1, 0) | RN_ZR, enc_logical_reg),
+    ENC(INST_TYPE_MOV,   "dup",    0x5E000400, enc_simd_scalar_dup),
+    ENC(INST_TYPE_MOV,   "suqadd", SIMD_2MISC(0, 0x03), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "sqabs",  SIMD_2MISC(0, 0x07), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "cmgt",   SIMD_2MISC(0, 0x08), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "cmeq",   SIMD_2MISC(0, 0x09), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "cmlt",   SIMD_2MISC(0, 0x0A), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "abs",    SIMD_2MISC(0, 0x0B), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcmgt",  SIMD_2MISC(0, 0x0C), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcmeq",  SIMD_2MISC(0, 0x0D), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcmlt",  SIMD_2MISC(0, 0x0E), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcvtns", SIMD_2MISC(0, 0x1A), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcvtms", SIMD_2MISC(0, 0x1B), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcvtas", SIMD_2MISC(0, 0x1C), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "scvtf",  SIMD_2MISC(0, 0x1D), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "usqadd", SIMD_2MISC(1, 0x03), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "sqneg",  SIMD_2MISC(1, 0x07), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "cmge",   SIMD_2MISC(1, 0x08), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "cmle",   SIMD_2MISC(1, 0x09), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "neg",    SIMD_2MISC(1, 0x0B), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcmge",  SIMD_2MISC(1, 0x0C), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcmle",  SIMD_2MISC(1, 0x0D), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcvtpu", SIMD_2MISC(1, 0x1A), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "fcvtzu", SIMD_2MISC(1, 0x1B), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOV,   "ucvtf",  SIMD_2MISC(1, 0x1D), enc_simd_scalar_2reg),
+    ENC(INST_TYPE_MOVZ,  "movz",   MOVE_WIDE(2), enc_move_wide),
+    ENC(INST_TYPE_MOVN,  "movn",   MOVE_WIDE(0), enc_move_wide),
+    ENC(INST_TYPE_MOVK,  "movk",   MOVE_WIDE(3), enc_move_wide),
+
+    /* 算术（ADD 类型同时包含SIMD标量三寄存器运算） */
+    ENC(INST_TYPE_ADD,   "add",    ADD_SUB_IMM(0, 0), enc_add_sub_imm),
+    ENC(INST_TYPE_ADD,   "add",    ADD_SUB_REG(0, 0), enc_add_sub_reg),
+    ENC(INST_TYPE_ADD,   "add",    SIMD_3SAME(0, 0x10), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "sub",    SIMD_3SAME(1, 0x10), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fmulx",  SIMD_3SAME(0, 0x1B), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fcmeq",  SIMD_3SAME(0, 0x1C), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "frecps", SIMD_3SAME(0, 0x1F), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fcmge",  SIMD_3SAME(1, 0x1C), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "facge",  SIMD_3SAME(1, 0x1D), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "frsqrts", SIMD_3SAME(1, 0x1F), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fadd",   SIMD_3SAME(0, 0x1A), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fsub",   SIMD_3SAME(1, 0x1A), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fmax",   SIMD_3SAME(0, 0x1E), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fmin",   SIMD_3SAME(1, 0x1E), enc_simd_scalar),
+    ENC(INST_TYPE_ADD,   "fmul",   SIMD_3SAME(0, 0x1D), enc_simd_scalar),
+    ENC(INST_TYPE_SUB,   "sub",    ADD_SUB_IMM(1, 0), enc_add_sub_imm),
+    ENC(INST_TYPE_SUB,   "sub",    ADD_SUB_REG(1, 0), enc_add_sub_reg),
+    ENC(INST_TYPE_SUB,   "neg",    ADD_SUB_REG(1, 0) | RN_ZR, enc_add_sub_reg),
+    ENC(INST_TYPE_ADDS,  "adds",   ADD_SUB_IMM(0, 1), enc_add_sub_imm),
+    ENC(INST_TYPE_ADDS,  "adds",   ADD_SUB_REG(0, 1), enc_add_sub_reg),
+    ENC(INST_TYPE_SUBS,  "subs",   ADD_SUB_IMM(1, 1), enc_add_sub_imm),
+    ENC(INST_TYPE_SUBS,  "subs",   ADD_SUB_REG(1, 1), enc_add_sub_reg),
+    ENC(INST_TYPE_ADR,   "adr",    0x10000000, enc_pc_rel_addr),
+    ENC(INST_TYPE_ADRP,  "adrp",   0x90000000, enc_pc_rel_addr),
+
+    /* 分支 */
+    ENC(INST_TYPE_B,     "b",      0x14000000, enc_uncond_branch_imm),
+    ENC(INST_TYPE_BL,    "bl",     0x94000000, enc_uncond_branch_imm),
+    ENC(INST_TYPE_BR,    "br",     0xD61F0000, enc_branch_reg),
+    ENC(INST_TYPE_BLR,   "blr",    0xD63F0000, enc_branch_reg),
+    ENC(INST_TYPE_RET,   "ret",    0xD65F0000, enc_branch_reg),
+    ENC(INST_TYPE_RET,   "eret",   0xD69F03E0, enc_fixed),
+    ENC(INST_TYPE_RET,   "drps",   0xD6BF03E0, enc_fixed),
+    ENC(INST_TYPE_CBZ,   "cbz",    0x34000000, enc_compare_branch),
+    ENC(INST_TYPE_CBNZ,  "cbnz",   0x35000000, enc_compare_branch),
+    ENC(INST_TYPE_TBZ,   "tbz",    0x36000000, enc_test_branch),
+    ENC(INST_TYPE_TBNZ,  "tbnz",   0x37000000, enc_test_branch),
+
+    /* 逻辑（AND/ORR/EOR 类型同时包含 bic/orn/eon/tst/mvn 等形式） */
+    ENC(INST_TYPE_AND,   "and",    LOGICAL_IMM(0), enc_logical_imm),
+    ENC(INST_TYPE_AND,   "and",    LOGICAL_REG(0, 0), enc_logical_reg),
+    ENC(INST_TYPE_AND,   "bic",    LOGICAL_REG(0, 1), enc_logical_reg),
+    ENC(INST_TYPE_AND,   "ands",   LOGICAL_IMM(3), enc_logical_imm),
+    ENC(INST_TYPE_AND,   "ands",   LOGICAL_REG(3, 0), enc_logical_reg),
+    ENC(INST_TYPE_AND,   "tst",    LOGICAL_IMM(3) | RD_ZR, enc_logical_imm),
+    ENC(INST_TYPE_AND,   "tst",    LOGICAL_REG(3, 0) | RD_ZR, enc_logical_reg),
+    ENC(INST_TYPE_AND,   "bics",   LOGICAL_REG(3, 1), enc_logical_reg),
+    ENC(INST_TYPE_ORR,   "orr",    LOGICAL_IMM(1), enc_logical_imm),
+    ENC(INST_TYPE_ORR,   "orr",    LOGICAL_REG(1, 0), enc_logical_reg),
+    ENC(INST_TYPE_ORR,   "orn",    LOGICAL_REG(1, 1), enc_logical_reg),
+    ENC(INST_TYPE_ORR,   "mvn",    LOGICAL_REG(1, 1) | RN_ZR, enc_logical_reg),
+    ENC(INST_TYPE_EOR,   "eor",    LOGICAL_IMM(2), enc_logical_imm),
+    ENC(INST_TYPE_EOR,   "eor",    LOGICAL_REG(2, 0), enc_logical_reg),
+    ENC(INST_TYPE_EOR,   "eon",    LOGICAL_REG(2, 1), enc_logical_reg),
+
+    /* 移位与位域（LSL 类型同时包含 sbfm/bfm/ubfm） */
+    ENC(INST_TYPE_LSL,   "lsl",    BITFIELD(2), enc_bitfield),
+    ENC(INST_TYPE_LSL,   "lsl",    DP_2SRC(0x08), enc_data_proc_reg),
+    ENC(INST_TYPE_LSL,   "sbfm",   BITFIELD(0), enc_bitfield),
+    ENC(INST_TYPE_LSL,   "bfm",    BITFIELD(1), enc_bitfield),
+    ENC(INST_TYPE_LSL,   "ubfm",   BITFIELD(2), enc_bitfield),
+    ENC(INST_TYPE_LSR,   "lsr",    BITFIELD(2), enc_bitfield),
+    ENC(INST_TYPE_LSR,   "lsr",    DP_2SRC(0x09), enc_data_proc_reg),
+    ENC(INST_TYPE_ASR,   "asr",    BITFIELD(0), enc_bitfield),
+    ENC(INST_TYPE_ASR,   "asr",    DP_2SRC(0x0A), enc_data_proc_reg),
+    ENC_FLAGS(INST_TYPE_ROR, "ror", 0x13800000, ENC_F_RM_IS_RN, enc_extract),
+    ENC(INST_TYPE_ROR,   "ror",    DP_2SRC(0x0B), enc_data_proc_reg),
+
+    /* 比较 */
+    ENC(INST_TYPE_CMP,   "cmp",    ADD_SUB_IMM(1, 1) | RD_ZR, enc_add_sub_imm),
+    ENC(INST_TYPE_CMP,   "cmp",    ADD_SUB_REG(1, 1) | RD_ZR, enc_add_sub_reg),
+    ENC(INST_TYPE_CMN,   "cmn",    ADD_SUB_IMM(0, 1) | RD_ZR, enc_add_sub_imm),
+    ENC(INST_TYPE_CMN,   "cmn",    ADD_SUB_REG(0, 1) | RD_ZR, enc_add_sub_reg),
+
+    /* 乘除法 */
+    ENC(INST_TYPE_MUL,   "mul",    DP_3SRC(0) | RA_ZR, enc_data_proc_3src),
+    ENC(INST_TYPE_MADD,  "madd",   DP_3SRC(0), enc_data_proc_3src),
+    ENC(INST_TYPE_MSUB,  "msub",   DP_3SRC(1), enc_data_proc_3src),
+    ENC(INST_TYPE_MSUB,  "mneg",   DP_3SRC(1) | RA_ZR, enc_data_proc_3src),
+    ENC(INST_TYPE_SDIV,  "sdiv",   DP_2SRC(0x03), enc_data_proc_reg),
+    ENC(INST_TYPE_UDIV,  "udiv",   DP_2SRC(0x02), enc_data_proc_reg),
+
+    /* 条件选择 */
+    ENC(INST_TYPE_CSEL,  "csel",   COND_SEL(0, 0), enc_cond_select),
+    ENC(INST_TYPE_CSINC, "csinc",  COND_SEL(0, 1), enc_cond_select),
+    ENC(INST_TYPE_CSINV, "csinv",  COND_SEL(1, 0), enc_cond_select),
+    ENC(INST_TYPE_CSNEG, "csneg",  COND_SEL(1, 1), enc_cond_select),
+    ENC_FLAGS(INST_TYPE_CSET,  "cset",  COND_SEL(0, 1) | RM_ZR | RN_ZR, ENC_F_INVERT_COND, enc_cond_select),
+    ENC_FLAGS(INST_TYPE_CSETM, "csetm", COND_SEL(1, 0) | RM_ZR | RN_ZR, ENC_F_INVERT_COND, enc_cond_select),
+    ENC_FLAGS(INST_TYPE_CINC,  "cinc",  COND_SEL(0, 1), ENC_F_INVERT_COND | ENC_F_RM_IS_RN, enc_cond_select),
+    ENC_FLAGS(INST_TYPE_CINV,  "cinv",  COND_SEL(1, 0), ENC_F_INVERT_COND | ENC_F_RM_IS_RN, enc_cond_select),
+    ENC_FLAGS(INST_TYPE_CNEG,  "cneg",  COND_SEL(1, 1), ENC_F_INVERT_COND | ENC_F_RM_IS_RN, enc_cond_select),
+
+    /* 位操作 */
+    ENC(INST_TYPE_CLZ,   "clz",    DP_1SRC(0x04), enc_data_proc_reg),
+    ENC(INST_TYPE_CLS,   "cls",    DP_1SRC(0x05), enc_data_proc_reg),
+    ENC(INST_TYPE_RBIT,  "rbit",   DP_1SRC(0x00), enc_data_proc_reg),
+    ENC(INST_TYPE_REV,   "rev",    DP_1SRC(0x02), enc_data_proc_reg),
+    ENC(INST_TYPE_REV16, "rev16",  DP_1SRC(0x01), enc_data_proc_reg),
+    ENC(INST_TYPE_REV32, "rev32",  DP_1SRC(0x02), enc_data_proc_reg),
+    ENC(INST_TYPE_EXTR,  "extr",   0x13800000, enc_extract),
+
+    /* 独占与获取/释放 */
+    ENC_FLAGS(INST_TYPE_LDXR,  "ldxr",  LS_EXCL(0, 1, 0, 0) | RS_ZR | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_LDXR,  "ldxp",  LS_EXCL(0, 1, 1, 0) | RS_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_STXR,  "stxr",  LS_EXCL(0, 0, 0, 0) | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_STXR,  "stxp",  LS_EXCL(0, 0, 1, 0), ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_LDAXR, "ldaxr", LS_EXCL(0, 1, 0, 1) | RS_ZR | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_LDAXR, "ldaxp", LS_EXCL(0, 1, 1, 1) | RS_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_STLXR, "stlxr", LS_EXCL(0, 0, 0, 1) | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_STLXR, "stlxp", LS_EXCL(0, 0, 1, 1), ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_LDAR,  "ldar",  LS_EXCL(1, 1, 0, 1) | RS_ZR | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_LDAR,  "ldlar", LS_EXCL(1, 1, 0, 0) | RS_ZR | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_STLR,  "stlr",  LS_EXCL(1, 0, 0, 1) | RS_ZR | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+    ENC_FLAGS(INST_TYPE_STLR,  "stllr", LS_EXCL(1, 0, 0, 0) | RS_ZR | RT2_ZR, ENC_F_SIZE_SUFFIX, enc_ls_exclusive),
+
+    /* LSE原子操作：获取/释放语义取自 is_acquire/is_release，大小取自助记符后缀 */
+    ENC(INST_TYPE_LDADD,  NULL, ATOMIC(0, 0), enc_atomic),
+    ENC(INST_TYPE_LDCLR,  NULL, ATOMIC(0, 1), enc_atomic),
+    ENC(INST_TYPE_LDEOR,  NULL, ATOMIC(0, 2), enc_atomic),
+    ENC(INST_TYPE_LDSET,  NULL, ATOMIC(0, 3), enc_atomic),
+    ENC(INST_TYPE_LDSMAX, NULL, ATOMIC(0, 4), enc_atomic),
+    ENC(INST_TYPE_LDSMIN, NULL, ATOMIC(0, 5), enc_atomic),
+    ENC(INST_TYPE_LDUMAX, NULL, ATOMIC(0, 6), enc_atomic),
+    ENC(INST_TYPE_LDUMIN, NULL, ATOMIC(0, 7), enc_atomic),
+    ENC(INST_TYPE_SWP,    NULL, ATOMIC(1, 0), enc_atomic),
+    ENC(INST_TYPE_CAS,    NULL, 0x08A07C00, enc_cas),
+
+    /* 系统 */
+    ENC(INST_TYPE_NOP,   "nop",    0xD503201F, enc_fixed),
+    ENC(INST_TYPE_NOP,   "yield",  0xD503203F, enc_fixed),
+    ENC(INST_TYPE_NOP,   "wfe",    0xD503205F, enc_fixed),
+    ENC(INST_TYPE_NOP,   "wfi",    0xD503207F, enc_fixed),
+    ENC(INST_TYPE_NOP,   "sev",    0xD503209F, enc_fixed),
+    ENC(INST_TYPE_NOP,   "sevl",   0xD50320BF, enc_fixed),
+    ENC(INST_TYPE_MRS,   "mrs",    0xD5200000, enc_mrs),
+
+    /* 浮点 */
+    ENC(INST_TYPE_FMOV,  "fmov",   FP_1SRC(0x00), enc_fp_1src),
+    ENC(INST_TYPE_FMOV,  "fmov",   FP_INT(0, 6), enc_fp_int_conv),
+    ENC(INST_TYPE_FMOV,  "fmov",   0x1E201000, enc_fp_imm),
+    ENC(INST_TYPE_FADD,  "fadd",   FP_2SRC(0x02), enc_fp_2src),
+    ENC(INST_TYPE_FSUB,  "fsub",   FP_2SRC(0x03), enc_fp_2src),
+    ENC(INST_TYPE_FMUL,  "fmul",   FP_2SRC(0x00), enc_fp_2src),
+    ENC(INST_TYPE_FMUL,  "fnmul",  FP_2SRC(0x08), enc_fp_2src),
+    ENC(INST_TYPE_FDIV,  "fdiv",   FP_2SRC(0x01), enc_fp_2src),
+    ENC(INST_TYPE_FABS,  "fabs",   FP_1SRC(0x01), enc_fp_1src),
+    ENC(INST_TYPE_FNEG,  "fneg",   FP_1SRC(0x02), enc_fp_1src),
+    ENC(INST_TYPE_FSQRT, "fsqrt",  FP_1SRC(0x03), enc_fp_1src),
+    ENC(INST_TYPE_FMADD, "fmadd",  FP_3SRC(0, 0), enc_fp_3src),
+    ENC(INST_TYPE_FMSUB, "fmsub",  FP_3SRC(0, 1), enc_fp_3src),
+    ENC(INST_TYPE_FNMADD, "fnmadd", FP_3SRC(1, 0), enc_fp_3src),
+    ENC(INST_TYPE_FNMSUB, "fnmsub", FP_3SRC(1, 1), enc_fp_3src),
+    ENC(INST_TYPE_FCMP,  "fcmp",   0x1E202000, enc_fp_compare),
+    ENC(INST_TYPE_FCMPE, "fcmpe",  0x1E202010, enc_fp_compare),
+    ENC(INST_TYPE_FCCMP, "fccmp",  0x1E200400, enc_fp_cond_compare),
+    ENC(INST_TYPE_FCCMP, "fccmpe", 0x1E200410, enc_fp_cond_compare),
+    ENC(INST_TYPE_FCSEL, "fcsel",  0x1E200C00, enc_fp_2src),
+    ENC(INST_TYPE_FCVT,  "fcvt",   FP_1SRC(0x04), enc_fp_1src),
+    ENC(INST_TYPE_FCVTZS, "fcvtzs", FP_INT(3, 0), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZS, "fcvtns", FP_INT(0, 0), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZS, "fcvtps", FP_INT(1, 0), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZS, "fcvtms", FP_INT(2, 0), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZS, "fcvtas", FP_INT(0, 4), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZU, "fcvtzu", FP_INT(3, 1), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZU, "fcvtnu", FP_INT(0, 1), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZU, "fcvtpu", FP_INT(1, 1), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZU, "fcvtmu", FP_INT(2, 1), enc_fp_int_conv),
+    ENC(INST_TYPE_FCVTZU, "fcvtau", FP_INT(0, 5), enc_fp_int_conv),
+    ENC(INST_TYPE_SCVTF, "scvtf",  FP_INT(0, 2), enc_fp_int_conv),
+    ENC(INST_TYPE_UCVTF, "ucvtf",  FP_INT(0, 3), enc_fp_int_conv),
+    ENC(INST_TYPE_FRINT, "frintn", FP_1SRC(0x08), enc_fp_1src),
+    ENC(INST_TYPE_FRINT, "frintp", FP_1SRC(0x09), enc_fp_1src),
+    ENC(INST_TYPE_FRINT, "frintm", FP_1SRC(0x0A), enc_fp_1src),
+    ENC(INST_TYPE_FRINT, "frintz", FP_1SRC(0x0B), enc_fp_1src),
+    ENC(INST_TYPE_FRINT, "frinta", FP_1SRC(0x0C), enc_fp_1src),
+    ENC(INST_TYPE_FRINT, "frintx", FP_1SRC(0x0E), enc_fp_1src),
+    ENC(INST_TYPE_FRINT, "frinti", FP_1SRC(0x0F), enc_fp_1src),
+    ENC(INST_TYPE_FMAX,  "fmax",   FP_2SRC(0x04), enc_fp_2src),
+    ENC(INST_TYPE_FMAX,  "fmaxnm", FP_2SRC(0x06), enc_fp_2src),
+    ENC(INST_TYPE_FMIN,  "fmin",   FP_2SRC(0x05), enc_fp_2src),
+    ENC(INST_TYPE_FMIN,  "fminnm", FP_2SRC(0x07), enc_fp_2src),
+
+    /* 条件分支：条件码取自 inst->cond */
+    ENC(INST_TYPE_BCOND, NULL,     0x54000000, enc_cond_branch_imm),
+
+    /* 预取 */
+    ENC(INST_TYPE_PRFM,  "prfm",   0, enc_ls_single),
+    ENC_FLAGS(INST_TYPE_PRFM,  "prfum",  0, ENC_F_UNSCALED, enc_ls_single),
+};
+
+/* ========== 查找与编码 ========== */
+
+/**
+ * 检查助记符是否与条目匹配（允许 ENC_F_SIZE_SUFFIX 条目带 b/h 后缀）
+ */
+static bool mnemonic_matches(const encode_entry_t *entry, const char *mnemonic) {
+    if (!entry->mnemonic) {
+        return true;
+    }
+
+    if (!strbuf_has_prefix(mnemonic, entry->mnemonic)) {
+        return false;
+    }
+    size_t len = strbuf_strlen(entry->mnemonic);
+    if (mnemonic[len] == '\0') {
+        return true;
+    }
+    return (entry->flags & ENC_F_SIZE_SUFFIX) &&
+           (mnemonic[len] == 'b' || mnemonic[len] == 'h') && mnemonic[len + 1] == '\0';
+}
+
+/**
+ * 二分查找指定类型的第一个条目
+ */
+static size_t find_first_entry(inst_type_t type) {
+    size_t lo = 0, hi = ARRAY_SIZE(encode_table);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (encode_table[mid].type < type) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * 将解码结果编码为32位指令字
+ */
+bool encode_arm64(const disasm_inst_t *inst, uint32_t *out) {
+    if (!inst || !out) {
+        return false;
+    }
+
+    for (size_t i = find_first_entry(inst->type);
+         i < ARRAY_SIZE(encode_table) && encode_table[i].type == inst->type; i++) {
+        const encode_entry_t *entry = &encode_table[i];
+        uint32_t word;
+
+        if (mnemonic_matches(entry, inst->mnemonic) && entry->encoder(inst, entry, &word)) {
+            *out = word;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ========== 往返校验 ========== */
+
+/**
+ * 按种类比较两个操作数（联合体中未使用的字节不参与比较）
+ */
+static bool operand_equal(const disasm_operand_t *a, const disasm_operand_t *b) {
+    if (a->kind != b->kind || a->access != b->access || a->width != b->width) {
+        return false;
+    }
+
+    switch (a->kind) {
+        case OPERAND_REG:
+            return a->reg.num == b->reg.num && a->reg.type == b->reg.type;
+        case OPERAND_IMM:
+            return a->imm == b->imm;
+        case OPERAND_MEM:
+            return a->mem.base == b->mem.base && a->mem.base_type == b->mem.base_type &&
+                   a->mem.mode == b->mem.mode && a->mem.has_index == b->mem.has_index &&
+                   a->mem.writeback == b->mem.writeback && a->mem.disp == b->mem.disp &&
+                   (!a->mem.has_index ||
+                    (a->mem.index == b->mem.index && a->mem.index_type == b->mem.index_type &&
+                     a->mem.extend == b->mem.extend && a->mem.shift == b->mem.shift));
+        case OPERAND_SHIFT:
+            return a->shift.type == b->shift.type && a->shift.amount == b->shift.amount;
+        case OPERAND_COND:
+            return a->cond == b->cond;
+        case OPERAND_SYSREG:
+            return a->sysreg == b->sysreg;
+        default:
+            return true;
+    }
+}
+
+/* ========== 可忽略的字段 ========== */
+
+/*
+ * 架构规定被忽略或"应为1"（SBO）的字段：只在这些位上与规范编码不同的指令字是合法的非规范编码。
+ * 其余位不同而重新解码结果相同，说明解码器没有检查某个固定位（保留的 ftype、CAS 的 o1 等）
+ */
+static const struct {
+    uint32_t mask;
+    uint32_t value;
+    uint32_t ignored;
+} ignored_fields[] = {
+    /* 独占加载 LDXR/LDAXR：Rs、Rt2 应为1；独占存储的 Rs 是状态寄存器，只有 Rt2 */
+    { 0x3FE00000, 0x08400000, 0x001F7C00 },
+    { 0x3FE00000, 0x08000000, 0x00007C00 },
+    /* 独占加载对 LDXP/LDAXP（size=1x）：Rs 应为1 */
+    { 0xBFE00000, 0x88600000, 0x001F0000 },
+    /* LDAR/STLR/LDLAR/STLLR：Rs、Rt2 应为1 */
+    { 0x3FA00000, 0x08800000, 0x001F7C00 },
+    /* 字节访问的寄存器偏移寻址：移位量总是0，S 只决定是否写出 #0（Q 寄存器形式除外） */
+    { 0xFF200C00, 0x38200800, 0x00001000 },
+    { 0xFFA00C00, 0x3C200800, 0x00001000 },
+};
+
+/**
+ * 逻辑立即数中 immr 高于元素大小的位不参与旋转
+ */
+static uint32_t logical_imm_ignored(uint32_t raw) {
+    uint32_t pattern = (uint32_t)((BIT(raw, 22) << 6) | (~BITS(raw, 10, 15) & 0x3F));
+    if (pattern < 2) {
+        return 0;
+    }
+    uint32_t esize = 1;
+    while ((pattern >>= 1) != 0) {
+        esize <<= 1;
+    }
+    return (~(esize - 1) & 0x3F) << 16;
+}
+
+/**
+ * 原指令字中可以与规范编码不同的位
+ */
+static uint32_t ignorable_bits(uint32_t raw) {
+    if ((raw & 0x1F800000) == 0x12000000) {
+        return logical_imm_ignored(raw);
+    }
+    for (size_t i = 0; i < ARRAY_SIZE(ignored_fields); i++) {
+        if ((raw & ignored_fields[i].mask) == ignored_fields[i].value) {
+            return ignored_fields[i].ignored;
+        }
+    }
+    return 0;
+}
+
+/**
+ * 解码→编码→比较
+ */
+encode_roundtrip_t encode_roundtrip(uint32_t raw, uint64_t address, uint32_t *encoded) {
+    disasm_inst_t inst;
+    uint32_t word;
+
+    if (!disassemble_arm64(raw, address, &inst)) {
+        return ENCODE_ROUNDTRIP_UNDECODED;
+    }
+    if (!encode_arm64(&inst, &word)) {
+        return ENCODE_ROUNDTRIP_UNSUPPORTED;
+    }
+    if (encoded) {
+        *encoded = word;
+    }
+    if (word == raw) {
+        return ENCODE_ROUNDTRIP_EXACT;
+    }
+
+    /*
+     * 原编码不是规范编码时（含被忽略的位、逻辑立即数的 immr 高位等），
+     * 只要求重新解码后的类型、助记符和操作数列表一致
+     */
+    disasm_inst_t again;
+    if (!disassemble_arm64(word, address, &again) || again.type != inst.type ||
+        !strbuf_equal(again.mnemonic, inst.mnemonic) ||
+        again.operand_count != inst.operand_count) {
+        return ENCODE_ROUNDTRIP_MISMATCH;
+    }
+    for (uint8_t i = 0; i < inst.operand_count; i++) {
+        if (!operand_equal(&inst.operands[i], &again.operands[i])) {
+            return ENCODE_ROUNDTRIP_MISMATCH;
+        }
+    }
+    if ((raw ^ word) & ~ignorable_bits(raw)) {
+        return ENCODE_ROUNDTRIP_OVER_ACCEPT;
+    }
+    return ENCODE_ROUNDTRIP_EQUIVALENT;
+}
+
+/**
+ * 对一段指令逐条做往返校验并统计结果
+ */
+void encode_verify_block(const uint32_t *code, size_t count, uint64_t start_addr,
+                         encode_verify_stats_t *stats) {
+    if (!stats) {
+        return;
+    }
+    ARM64_MEMSET(stats, 0, sizeof(*stats));
+    if (!code) {
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t word = 0;
+        encode_roundtrip_t result = encode_roundtrip(code[i], start_addr + i * 4, &word);
+
+        stats->total++;
+        switch (result) {
+            case ENCODE_ROUNDTRIP_EXACT:       stats->exact++; break;
+            case ENCODE_ROUNDTRIP_EQUIVALENT:  stats->equivalent++; break;
+            case ENCODE_ROUNDTRIP_UNSUPPORTED: stats->unsupported++; break;
+            case ENCODE_ROUNDTRIP_UNDECODED:   stats->undecoded++; break;
+            case ENCODE_ROUNDTRIP_OVER_ACCEPT:
+                if (stats->over_accept++ == 0) {
+                    stats->first_over_accept = i;
+                    stats->first_over_accept_raw = code[i];
+                }
+                break;
+            case ENCODE_ROUNDTRIP_MISMATCH:
+                if (stats->mismatch++ == 0) {
+                    stats->first_mismatch = i;
+                    stats->first_mismatch_raw = code[i];
+                    stats->first_mismatch_encoded = word;
+                }
+                break;
+        }
+    }
+}
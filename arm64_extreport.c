@@ -0,0 +1,328 @@
+/**
+ * ARM64扩展使用报告工具：列出每个函数和整个映像所需的架构扩展
+ * 读取 AArch64 ELF（或 -b binary 原始映像），按符号把可执行段切分为函数，
+ * 逐条按编码确定所需扩展（get_inst_extension，解码器不支持的 SVE、点积等也能识别）
+ * 指定目标配置时列出配置之外的指令，存在这样的指令时退出码为1，可用于发布前检查
+ * 代码段中的字面量数据也按编码归类，偶尔会被误计为某个扩展的指令
+ *
+ * 用法：arm64_extreport [-t 目标配置] [-m 每函数最多列出的指令] [-a] [-b binary]
+ *                       [--adjust-vma=地址] [-EB|-EL] 文件...
+ */
+
+#include "arm64_elf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ========== 按函数统计 ========== */
+
+typedef struct {
+    const arm64_target_t *target;           // 非空时检查配置之外的指令
+    const char *target_name;
+    size_t max_insts;                       // 每个函数最多列出的配置外指令数
+    bool all;                               // 也列出只使用基础指令集的函数
+
+    /* 当前函数 */
+    uint64_t func[ARM64_EXT_COUNT];
+    uint64_t func_unknown;
+    uint64_t func_outside;
+    size_t listed;
+
+    /* 当前文件 */
+    uint64_t counts[ARM64_EXT_COUNT];       // 各扩展的指令数
+    uint64_t functions[ARM64_EXT_COUNT];    // 使用各扩展的函数数
+    uint64_t unknown;                       // 无法识别的字
+    uint64_t outside;                       // 配置之外的指令数
+    uint64_t outside_functions;
+    uint64_t insts;
+    uint64_t scanned;                       // 函数数
+} report_t;
+
+/* 未解码且编码不属于任何扩展的字（数据、保留编码）单独计数 */
+static bool is_unknown(const disasm_inst_t *inst) {
+    return inst->type == INST_TYPE_UNKNOWN && get_encoding_extension(inst->raw) == ARM64_EXT_BASE;
+}
+
+static bool outside_target(const report_t *r, arm64_ext_t ext) {
+    return r->target && !arm64_ext_set_contains(&r->target->exts, ext);
+}
+
+static bool count_insts(const disasm_inst_t *insts, size_t count, void *ctx) {
+    report_t *r = ctx;
+    for (size_t i = 0; i < count; i++) {
+        if (is_unknown(&insts[i])) {
+            r->func_unknown++;
+            continue;
+        }
+        arm64_ext_t ext = get_inst_extension(&insts[i]);
+        r->func[ext]++;
+        r->func_outside += outside_target(r, ext);
+    }
+    return true;
+}
+
+static bool list_outside(const disasm_inst_t *insts, size_t count, void *ctx) {
+    report_t *r = ctx;
+    for (size_t i = 0; i < count && r->listed < r->max_insts; i++) {
+        arm64_ext_t ext = get_inst_extension(&insts[i]);
+        if (is_unknown(&insts[i]) || !outside_target(r, ext)) {
+            continue;
+        }
+        char text[256];
+        if (insts[i].type != INST_TYPE_UNKNOWN) {
+            format_instruction(&insts[i], text, sizeof(text));
+        } else {
+            snprintf(text, sizeof(text), ".inst 0x%08x", insts[i].raw);
+        }
+        printf("    %8llx:  %08x  %-40s %s\n", (unsigned long long)insts[i].address,
+               insts[i].raw, text, get_extension_name(ext));
+        r->listed++;
+    }
+    return r->listed < r->max_insts;
+}
+
+/* 统计一个函数 [address, address + size) 并输出其使用的扩展 */
+static void analyze_function(report_t *r, const char *name, uint64_t address,
+                             const uint8_t *bytes, size_t size, arm64_endian_t endian) {
+    memset(r->func, 0, sizeof(r->func));
+    r->func_unknown = 0;
+    r->func_outside = 0;
+    size_t insts = disassemble_visit_bytes(bytes, size, address, endian, NULL,
+                                           count_insts, r);
+    r->insts += insts;
+    r->unknown += r->func_unknown;
+    r->scanned++;
+
+    bool beyond_base = false;
+    for (int e = 0; e < ARM64_EXT_COUNT; e++) {
+        r->counts[e] += r->func[e];
+        r->functions[e] += r->func[e] != 0;
+        beyond_base |= e != ARM64_EXT_BASE && r->func[e] != 0;
+    }
+    if (r->func_outside) {
+        r->outside += r->func_outside;
+        r->outside_functions++;
+    }
+    if (!beyond_base && !r->all) {
+        return;
+    }
+
+    printf("%s (0x%llx, %zu 条指令):", name, (unsigned long long)address, insts);
+    const char *sep = " ";
+    for (int e = 1; e < ARM64_EXT_COUNT; e++) {
+        if (r->func[e]) {
+            printf("%s%s %llu", sep, get_extension_name((arm64_ext_t)e),
+                   (unsigned long long)r->func[e]);
+            sep = ", ";
+        }
+    }
+    if (!beyond_base) {
+        printf(" base");
+    }
+    if (r->func_outside) {
+        printf("  不在 %s 中: %llu", r->target_name, (unsigned long long)r->func_outside);
+    }
+    printf("\n");
+
+    if (r->func_outside && r->max_insts > 0) {
+        r->listed = 0;
+        disassemble_visit_bytes(bytes, size, address, endian, NULL, list_outside, r);
+        if (r->func_outside > r->listed) {
+            printf("    ... 另有 %llu 条\n", (unsigned long long)(r->func_outside - r->listed));
+        }
+    }
+}
+
+/* 输出当前文件的汇总并清零 */
+static void print_summary(report_t *r) {
+    printf("\n所需扩展:");
+    for (int e = 1; e < ARM64_EXT_COUNT; e++) {
+        if (r->counts[e]) {
+            printf(" %s", get_extension_name((arm64_ext_t)e));
+        }
+    }
+    printf("\n");
+    for (int e = 0; e < ARM64_EXT_COUNT; e++) {
+        if (r->counts[e]) {
+            printf("  %-14s %10llu 条  %6llu 个函数%s\n", get_extension_name((arm64_ext_t)e),
+                   (unsigned long long)r->counts[e], (unsigned long long)r->functions[e],
+                   outside_target(r, (arm64_ext_t)e) ? "  (不在目标配置中)" : "");
+        }
+    }
+    printf("  %-14s %10llu 个字\n", "无法识别", (unsigned long long)r->unknown);
+    printf("合计: %llu 条指令, %llu 个函数\n", (unsigned long long)r->insts,
+           (unsigned long long)r->scanned);
+    if (r->target) {
+        printf("不在 %s 中: %llu 条指令, %llu 个函数\n", r->target_name,
+               (unsigned long long)r->outside, (unsigned long long)r->outside_functions);
+    }
+
+    memset(r->counts, 0, sizeof(r->counts));
+    memset(r->functions, 0, sizeof(r->functions));
+    r->unknown = r->insts = r->scanned = 0;
+    r->outside = r->outside_functions = 0;
+}
+
+/* 函数边界 */
+typedef struct {
+    uint64_t address;
+    const char *name;
+    size_t order;               // 符号表中的顺序，同一地址保留第一个
+} boundary_t;
+
+static int boundary_cmp(const void *x, const void *y) {
+    const boundary_t *a = x, *b = y;
+    if (a->address != b->address) {
+        return a->address < b->address ? -1 : 1;
+    }
+    return a->order < b->order ? -1 : (a->order > b->order);
+}
+
+/* 按符号把一段切分为函数；段起始处没有符号时以段名作为第一个函数 */
+static bool analyze_section(report_t *r, const arm64_elf_t *elf, size_t index,
+                            const char *name, uint64_t address, const uint8_t *bytes,
+                            size_t size, arm64_endian_t endian) {
+    size_t count = elf ? elf->symbol_count : 0;
+    const arm64_allocator_t *allocator = arm64_default_allocator();
+    boundary_t *b = arm64_alloc(allocator, (count + 1) * sizeof(*b), 16);
+    if (!b) {
+        return false;
+    }
+    size_t n = 0;
+    b[n++] = (boundary_t){ address, name, SIZE_MAX };
+    for (size_t i = 0; i < count; i++) {
+        const arm64_elf_symbol_t *sym = &elf->symbols[i];
+        if (sym->section == index && sym->address >= address &&
+            sym->address - address < size) {
+            b[n++] = (boundary_t){ sym->address, sym->name, i };
+        }
+    }
+    qsort(b, n, sizeof(*b), boundary_cmp);
+
+    size_t i = 0;
+    while (i < n) {
+        size_t next = i + 1;
+        while (next < n && b[next].address == b[i].address) {
+            next++;
+        }
+        uint64_t end = next < n ? b[next].address : address + size;
+        analyze_function(r, b[i].name, b[i].address, bytes + (b[i].address - address),
+                         (size_t)(end - b[i].address), endian);
+        i = next;
+    }
+    arm64_free(allocator, b, (count + 1) * sizeof(*b));
+    return true;
+}
+
+static int analyze_elf(report_t *r, const char *path, const arm64_image_t *img,
+                       arm64_endian_t endian) {
+    arm64_elf_t elf;
+    arm64_elf_status_t st = arm64_elf_parse(&elf, img->data, img->size);
+    if (st != ARM64_ELF_OK) {
+        fprintf(stderr, "%s: %s%s\n", path, arm64_elf_strerror(st),
+                st == ARM64_ELF_NOT_ELF64 ? "（原始映像请使用 -b binary）" : "");
+        return 1;
+    }
+    int status = 0;
+    for (size_t i = 0; i < elf.section_count; i++) {
+        const arm64_elf_section_t *sh = &elf.sections[i];
+        if (!(sh->flags & ARM64_ELF_SHF_EXECINSTR) || sh->size == 0) {
+            continue;
+        }
+        if (!sh->data) {
+            fprintf(stderr, "%s: 段 %s 超出文件范围\n", path, sh->name);
+            continue;
+        }
+        if (!analyze_section(r, &elf, i, sh->name, sh->address, sh->data,
+                             (size_t)sh->size, endian)) {
+            fprintf(stderr, "内存不足\n");
+            status = 1;
+            break;
+        }
+    }
+    arm64_elf_free(&elf);
+    return status;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "用法: %s [-t 目标配置] [-m 数量] [-a] [-b binary] [--adjust-vma=地址]"
+            " [-EB|-EL] 文件...\n"
+            "  -t  目标配置，写法同 -march，如 armv8.2-a+dotprod、armv8-a+nolse；\n"
+            "      列出配置之外的指令，存在时退出码为1\n"
+            "  -m  每个函数最多列出的配置外指令数（默认20，0只输出计数）\n"
+            "  -a  也列出只使用基础指令集的函数\n"
+            "  -b  输入格式，只支持 binary（原始指令映像，作为一个函数）\n"
+            "  --adjust-vma  原始映像第一个字节的地址（默认0）\n"
+            "  -EB/-EL  指令字节序（默认小端）\n"
+            "扩展:", prog);
+    for (int e = 0; e < ARM64_EXT_COUNT; e++) {
+        fprintf(stderr, "%s%s", e % 12 ? " " : "\n  ", get_extension_name((arm64_ext_t)e));
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char *argv[]) {
+    report_t r;
+    memset(&r, 0, sizeof(r));
+    r.max_insts = 20;
+    arm64_target_t target;
+    arm64_image_options_t input;
+    arm64_image_options_init(&input);
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        int used;
+        if (strcmp(arg, "-t") == 0 && has_value) {
+            r.target_name = argv[++i];
+            if (!arm64_target_parse(&target, r.target_name)) {
+                fprintf(stderr, "无法识别的目标配置: %s\n", r.target_name);
+                usage(argv[0]);
+                return 2;
+            }
+            r.target = &target;
+        } else if (strcmp(arg, "-m") == 0 && has_value) {
+            r.max_insts = (size_t)strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-a") == 0) {
+            r.all = true;
+        } else if ((used = arm64_image_option(&input, argc, argv, i)) > 0) {
+            i += used - 1;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (i >= argc) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    int status = 0;
+    for (; i < argc; i++) {
+        arm64_image_t img;
+        if (!arm64_image_open(&img, argv[i])) {
+            perror(argv[i]);
+            status = 1;
+            continue;
+        }
+        printf("%s:\n", argv[i]);
+        int rc = 0;
+        if (input.binary) {
+            analyze_function(&r, ".data", input.vma, img.data, img.size, input.endian);
+        } else {
+            rc = analyze_elf(&r, argv[i], &img, input.endian);
+        }
+        if (rc != 0) {
+            status = rc;
+        }
+        if (r.outside && status == 0) {
+            status = 1;
+        }
+        print_summary(&r);
+        arm64_image_close(&img);
+    }
+    return status;
+}
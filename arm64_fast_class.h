@@ -0,0 +1,221 @@
+/**
+ * ARM64反汇编器 - 快速分类表
+ * 常见指令的 mask/value 分类表，供 JIT 校验器（arm64_validate.c）和 C++ 接口
+ * （arm64_disasm.hpp 中的 constexpr 分类）共用；C++ 下表为 constexpr，可在编译期求值
+ */
+
+#ifndef ARM64_FAST_CLASS_H
+#define ARM64_FAST_CLASS_H
+
+#include "arm64_disasm.h"
+
+#ifdef __cplusplus
+#define ARM64_FAST_CLASS_CONST constexpr
+#else
+#define ARM64_FAST_CLASS_CONST const
+#endif
+
+/* ========== 快速分类表 ========== */
+
+/* 写寄存器规则（可组合） */
+#define VW_RD       0x01    /* 位[4:0]，31为零寄存器 */
+#define VW_RD_SP    0x02    /* 位[4:0]，31为SP */
+#define VW_RT2      0x04    /* 位[14:10]（加载对的第二目标寄存器），31为零寄存器 */
+#define VW_RN_WB    0x08    /* 基址寄存器回写 位[9:5]，31为SP */
+#define VW_LR       0x10    /* 链接寄存器 x30 */
+
+/* 分支种类 */
+#define VB_NONE     0
+#define VB_IMM26    1       /* B/BL */
+#define VB_IMM19    2       /* B.cond/CBZ/CBNZ */
+#define VB_IMM14    3       /* TBZ/TBNZ */
+#define VB_INDIRECT 4       /* BR/BLR/RET */
+
+/* 快速分类表条目：按 mask/value 匹配，给出与解码器一致的指令类型 */
+typedef struct {
+    uint32_t mask;
+    uint32_t value;
+    uint8_t type;           /* inst_type_t */
+    uint8_t writes;         /* VW_* */
+    uint8_t branch;         /* VB_* */
+} fast_class_t;
+
+#define FC(mask, value, type, writes, branch) \
+    { (mask), (value), (uint8_t)(type), (writes), (branch) }
+
+/*
+ * 单寄存器加载/存储的五种寻址形式：无符号偏移、未缩放、后索引、前索引、寄存器偏移
+ * base 为 size|111|V|00|opc 组成的固定位
+ */
+#define FC_LS(base, type, writes) \
+    FC(0xFFC00000, (base) | 0x01000000, type, (writes), VB_NONE), \
+    FC(0xFFE00C00, (base) | 0x00000000, type, (writes), VB_NONE), \
+    FC(0xFFE00C00, (base) | 0x00000400, type, (writes) | VW_RN_WB, VB_NONE), \
+    FC(0xFFE00C00, (base) | 0x00000C00, type, (writes) | VW_RN_WB, VB_NONE), \
+    FC(0xFFE00C00, (base) | 0x00200800, type, (writes), VB_NONE)
+
+/* 加载/存储对的三种索引形式：后索引、有符号偏移、前索引 */
+#define FC_PAIR(base, type, writes) \
+    FC(0xFFC00000, (base) | 0x00800000, type, (writes) | VW_RN_WB, VB_NONE), \
+    FC(0xFFC00000, (base) | 0x01000000, type, (writes), VB_NONE), \
+    FC(0xFFC00000, (base) | 0x01800000, type, (writes) | VW_RN_WB, VB_NONE)
+
+/*
+ * JIT常见指令的快速分类表，按优先级排列（别名在前）。
+ * 每个条目匹配的指令字必须能被解码器解码且类型相同（屏障指令除外，解码器尚不支持）；
+ * 未匹配的指令字回退到完整解码。
+ */
+/* 未编译进库的指令组不进入快速表，与完整解码的结果保持一致 */
+static ARM64_FAST_CLASS_CONST fast_class_t fast_class_table[] = {
+#if ARM64_DISASM_HAS_BRANCH
+    /* 分支 */
+    FC(0xFC000000, 0x14000000, INST_TYPE_B,     0,     VB_IMM26),
+    FC(0xFC000000, 0x94000000, INST_TYPE_BL,    VW_LR, VB_IMM26),
+    FC(0xFF000010, 0x54000000, INST_TYPE_BCOND, 0,     VB_IMM19),
+    FC(0x7F000000, 0x34000000, INST_TYPE_CBZ,   0,     VB_IMM19),
+    FC(0x7F000000, 0x35000000, INST_TYPE_CBNZ,  0,     VB_IMM19),
+    FC(0x7F000000, 0x36000000, INST_TYPE_TBZ,   0,     VB_IMM14),
+    FC(0x7F000000, 0x37000000, INST_TYPE_TBNZ,  0,     VB_IMM14),
+    FC(0xFFFFFC1F, 0xD61F0000, INST_TYPE_BR,    0,     VB_INDIRECT),
+    FC(0xFFFFFC1F, 0xD63F0000, INST_TYPE_BLR,   VW_LR, VB_INDIRECT),
+    FC(0xFFFFFC1F, 0xD65F0000, INST_TYPE_RET,   0,     VB_INDIRECT),
+#endif
+
+#if ARM64_DISASM_HAS_SYSTEM
+    /* 系统：NOP 和屏障 */
+    FC(0xFFFFFFFF, 0xD503201F, INST_TYPE_NOP,   0, VB_NONE),
+    FC(0xFFFFF0FF, 0xD503309F, INST_TYPE_DSB,   0, VB_NONE),
+    FC(0xFFFFF0FF, 0xD50330BF, INST_TYPE_DMB,   0, VB_NONE),
+    FC(0xFFFFF0FF, 0xD50330DF, INST_TYPE_ISB,   0, VB_NONE),
+#endif
+
+#if ARM64_DISASM_HAS_DATA_PROC
+    /* PC相对地址 */
+    FC(0x9F000000, 0x10000000, INST_TYPE_ADR,   VW_RD, VB_NONE),
+    FC(0x9F000000, 0x90000000, INST_TYPE_ADRP,  VW_RD, VB_NONE),
+
+    /* 加法/减法（立即数）：Rd 或 Rn 为 SP 的 add #0 为 mov，adds/subs 的 Rd=31 为 cmn/cmp */
+    FC(0x7FFFFC1F, 0x1100001F, INST_TYPE_MOV,   VW_RD_SP, VB_NONE),
+    FC(0x7FFFFFE0, 0x110003E0, INST_TYPE_MOV,   VW_RD_SP, VB_NONE),
+    FC(0x7F80001F, 0x3100001F, INST_TYPE_CMN,   0,        VB_NONE),
+    FC(0x7F80001F, 0x7100001F, INST_TYPE_CMP,   0,        VB_NONE),
+    FC(0x7F800000, 0x11000000, INST_TYPE_ADD,   VW_RD_SP, VB_NONE),
+    FC(0x7F800000, 0x31000000, INST_TYPE_ADDS,  VW_RD,    VB_NONE),
+    FC(0x7F800000, 0x51000000, INST_TYPE_SUB,   VW_RD_SP, VB_NONE),
+    FC(0x7F800000, 0x71000000, INST_TYPE_SUBS,  VW_RD,    VB_NONE),
+
+    /* 逻辑运算（立即数）：orr Rn=31 为 mov */
+    FC(0x7F8003E0, 0x320003E0, INST_TYPE_MOV,   VW_RD_SP, VB_NONE),
+    FC(0x7F800000, 0x12000000, INST_TYPE_AND,   VW_RD_SP, VB_NONE),
+    FC(0x7F800000, 0x32000000, INST_TYPE_ORR,   VW_RD_SP, VB_NONE),
+    FC(0x7F800000, 0x52000000, INST_TYPE_EOR,   VW_RD_SP, VB_NONE),
+    FC(0x7F800000, 0x72000000, INST_TYPE_AND,   VW_RD,    VB_NONE),
+
+    /* 移动宽立即数（32位形式只有 hw<2） */
+    FC(0xFF800000, 0x92800000, INST_TYPE_MOVN,  VW_RD, VB_NONE),
+    FC(0xFF800000, 0xD2800000, INST_TYPE_MOVZ,  VW_RD, VB_NONE),
+    FC(0xFF800000, 0xF2800000, INST_TYPE_MOVK,  VW_RD, VB_NONE),
+    FC(0xFFC00000, 0x12800000, INST_TYPE_MOVN,  VW_RD, VB_NONE),
+    FC(0xFFC00000, 0x52800000, INST_TYPE_MOVZ,  VW_RD, VB_NONE),
+    FC(0xFFC00000, 0x72800000, INST_TYPE_MOVK,  VW_RD, VB_NONE),
+
+    /* 逻辑运算（移位寄存器）：orr Rn=31 且无移位为 mov */
+    FC(0x7FE0FFE0, 0x2A0003E0, INST_TYPE_MOV,   VW_RD, VB_NONE),
+    FC(0x7F000000, 0x0A000000, INST_TYPE_AND,   VW_RD, VB_NONE),
+    FC(0x7F000000, 0x2A000000, INST_TYPE_ORR,   VW_RD, VB_NONE),
+    FC(0x7F000000, 0x4A000000, INST_TYPE_EOR,   VW_RD, VB_NONE),
+    FC(0x7F000000, 0x6A000000, INST_TYPE_AND,   VW_RD, VB_NONE),
+
+    /* 加法/减法（移位寄存器，shift 为 LSL/LSR 或 ASR） */
+    FC(0x7FA0001F, 0x2B00001F, INST_TYPE_CMN,   0,     VB_NONE),
+    FC(0x7FA0001F, 0x6B00001F, INST_TYPE_CMP,   0,     VB_NONE),
+    FC(0x7FA00000, 0x0B000000, INST_TYPE_ADD,   VW_RD, VB_NONE),
+    FC(0x7FA00000, 0x2B000000, INST_TYPE_ADDS,  VW_RD, VB_NONE),
+    FC(0x7FA00000, 0x4B000000, INST_TYPE_SUB,   VW_RD, VB_NONE),
+    FC(0x7FA00000, 0x6B000000, INST_TYPE_SUBS,  VW_RD, VB_NONE),
+    FC(0x7FE0001F, 0x2B80001F, INST_TYPE_CMN,   0,     VB_NONE),
+    FC(0x7FE0001F, 0x6B80001F, INST_TYPE_CMP,   0,     VB_NONE),
+    FC(0x7FE00000, 0x0B800000, INST_TYPE_ADD,   VW_RD, VB_NONE),
+    FC(0x7FE00000, 0x2B800000, INST_TYPE_ADDS,  VW_RD, VB_NONE),
+    FC(0x7FE00000, 0x4B800000, INST_TYPE_SUB,   VW_RD, VB_NONE),
+    FC(0x7FE00000, 0x6B800000, INST_TYPE_SUBS,  VW_RD, VB_NONE),
+
+    /* 乘法、除法、可变移位、条件选择 */
+    FC(0x7FE0FC00, 0x1B007C00, INST_TYPE_MUL,   VW_RD, VB_NONE),
+    FC(0x7FE08000, 0x1B000000, INST_TYPE_MADD,  VW_RD, VB_NONE),
+    FC(0x7FE08000, 0x1B008000, INST_TYPE_MSUB,  VW_RD, VB_NONE),
+    FC(0x7FE0FC00, 0x1AC00800, INST_TYPE_UDIV,  VW_RD, VB_NONE),
+    FC(0x7FE0FC00, 0x1AC00C00, INST_TYPE_SDIV,  VW_RD, VB_NONE),
+    FC(0x7FE0FC00, 0x1AC02000, INST_TYPE_LSL,   VW_RD, VB_NONE),
+    FC(0x7FE0FC00, 0x1AC02400, INST_TYPE_LSR,   VW_RD, VB_NONE),
+    FC(0x7FE0FC00, 0x1AC02800, INST_TYPE_ASR,   VW_RD, VB_NONE),
+    FC(0x7FE0FC00, 0x1AC02C00, INST_TYPE_ROR,   VW_RD, VB_NONE),
+    FC(0x7FE00C00, 0x1A800000, INST_TYPE_CSEL,  VW_RD, VB_NONE),
+    FC(0x7FFF0FE0, 0x1A9F07E0, INST_TYPE_CSET,  VW_RD, VB_NONE),
+    FC(0x7FFF0FE0, 0x5A9F03E0, INST_TYPE_CSETM, VW_RD, VB_NONE),
+#endif
+
+#if ARM64_DISASM_HAS_FP_SIMD
+    /* 标量浮点运算（单/双精度，不写通用寄存器） */
+    FC(0xFFA0FC00, 0x1E200800, INST_TYPE_FMUL,  0, VB_NONE),
+    FC(0xFFA0FC00, 0x1E201800, INST_TYPE_FDIV,  0, VB_NONE),
+    FC(0xFFA0FC00, 0x1E202800, INST_TYPE_FADD,  0, VB_NONE),
+    FC(0xFFA0FC00, 0x1E203800, INST_TYPE_FSUB,  0, VB_NONE),
+#endif
+
+#if ARM64_DISASM_HAS_LOAD_STORE
+    /* 单寄存器加载/存储（通用寄存器） */
+    FC_LS(0x38000000, INST_TYPE_STRB,  0),
+    FC_LS(0x38400000, INST_TYPE_LDRB,  VW_RD),
+    FC_LS(0x38800000, INST_TYPE_LDRSB, VW_RD),
+    FC_LS(0x38C00000, INST_TYPE_LDRSB, VW_RD),
+    FC_LS(0x78000000, INST_TYPE_STRH,  0),
+    FC_LS(0x78400000, INST_TYPE_LDRH,  VW_RD),
+    FC_LS(0x78800000, INST_TYPE_LDRSH, VW_RD),
+    FC_LS(0x78C00000, INST_TYPE_LDRSH, VW_RD),
+    FC_LS(0xB8000000, INST_TYPE_STR,   0),
+    FC_LS(0xB8400000, INST_TYPE_LDR,   VW_RD),
+    FC_LS(0xB8800000, INST_TYPE_LDRSW, VW_RD),
+    FC_LS(0xF8000000, INST_TYPE_STR,   0),
+    FC_LS(0xF8400000, INST_TYPE_LDR,   VW_RD),
+
+    /* 单寄存器加载/存储（SIMD/FP寄存器，只检查基址回写） */
+    FC_LS(0x3C000000, INST_TYPE_STR,   0),
+    FC_LS(0x3C400000, INST_TYPE_LDR,   0),
+    FC_LS(0x7C000000, INST_TYPE_STR,   0),
+    FC_LS(0x7C400000, INST_TYPE_LDR,   0),
+    FC_LS(0xBC000000, INST_TYPE_STR,   0),
+    FC_LS(0xBC400000, INST_TYPE_LDR,   0),
+    FC_LS(0xFC000000, INST_TYPE_STR,   0),
+    FC_LS(0xFC400000, INST_TYPE_LDR,   0),
+    FC_LS(0x3C800000, INST_TYPE_STR,   0),
+    FC_LS(0x3CC00000, INST_TYPE_LDR,   0),
+
+    /* 预取：无符号偏移、未缩放、寄存器偏移（没有前/后索引形式） */
+    FC(0xFFC00000, 0xF9800000, INST_TYPE_PRFM, 0, VB_NONE),
+    FC(0xFFE00C00, 0xF8800000, INST_TYPE_PRFM, 0, VB_NONE),
+    FC(0xFFE00C00, 0xF8A00800, INST_TYPE_PRFM, 0, VB_NONE),
+
+    /* 加载/存储对 */
+    FC_PAIR(0x28000000, INST_TYPE_STP, 0),
+    FC_PAIR(0x28400000, INST_TYPE_LDP, VW_RD | VW_RT2),
+    FC_PAIR(0x68400000, INST_TYPE_LDP, VW_RD | VW_RT2),
+    FC_PAIR(0xA8000000, INST_TYPE_STP, 0),
+    FC_PAIR(0xA8400000, INST_TYPE_LDP, VW_RD | VW_RT2),
+    FC_PAIR(0x2C000000, INST_TYPE_STP, 0),
+    FC_PAIR(0x2C400000, INST_TYPE_LDP, 0),
+    FC_PAIR(0x6C000000, INST_TYPE_STP, 0),
+    FC_PAIR(0x6C400000, INST_TYPE_LDP, 0),
+    FC_PAIR(0xAC000000, INST_TYPE_STP, 0),
+    FC_PAIR(0xAC400000, INST_TYPE_LDP, 0),
+
+    /* 字面量加载 */
+    FC(0xFF000000, 0x18000000, INST_TYPE_LDR,   VW_RD, VB_NONE),
+    FC(0xFF000000, 0x58000000, INST_TYPE_LDR,   VW_RD, VB_NONE),
+    FC(0xFF000000, 0x98000000, INST_TYPE_LDRSW, VW_RD, VB_NONE),
+    FC(0xBF000000, 0x1C000000, INST_TYPE_LDR,   0,     VB_NONE),
+    FC(0xFF000000, 0x9C000000, INST_TYPE_LDR,   0,     VB_NONE),
+#endif
+};
+
+#endif /* ARM64_FAST_CLASS_H */
@@ -0,0 +1,354 @@
+/**
+ * ARM64反汇编器 - 分块并行压缩输出
+ */
+
+#include "arm64_gzsink.h"
+#include "arm64_alloc.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <zlib.h>
+
+/* 暂存的已压缩块 */
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    size_t capacity;            // data 的分配大小
+    bool ready;
+} slot_t;
+
+struct arm64_gzsink {
+    const arm64_allocator_t *allocator;
+    FILE *out;
+    int level;
+    size_t window;
+    slot_t *slots;              // 序号 seq 存放在 slots[seq % window]
+    pthread_mutex_t lock;
+    pthread_cond_t cond;        // 写出进度推进时广播
+    uint64_t next;              // 下一个要写出的序号
+    uint64_t assigned;          // 已分配的序号数
+    bool writing;               // 有线程正在顺序写出
+    bool error;
+    arm64_gzsink_stats_t stats;
+};
+
+/* ========== 压缩 ========== */
+
+/*
+ * 把一块压缩为完整的 gzip 成员（windowBits + 16 由 zlib 生成 gzip 头和 CRC32/ISIZE 尾）
+ */
+static bool compress_member(const arm64_allocator_t *allocator, int level,
+                            const void *data, size_t size,
+                            uint8_t **member, size_t *member_size, size_t *capacity) {
+    if (size > UINT32_MAX) {
+        return false;
+    }
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (deflateInit2(&zs, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        return false;
+    }
+    size_t bound = deflateBound(&zs, (uLong)size);
+    uint8_t *buf = arm64_alloc(allocator, bound, 1);
+    bool ok = buf != NULL;
+    if (ok) {
+        zs.next_in = (Bytef *)data;
+        zs.avail_in = (uInt)size;
+        zs.next_out = buf;
+        zs.avail_out = (uInt)bound;
+        ok = deflate(&zs, Z_FINISH) == Z_STREAM_END;
+    }
+    deflateEnd(&zs);
+    if (!ok) {
+        arm64_free(allocator, buf, bound);
+        return false;
+    }
+    *member = buf;
+    *member_size = bound - zs.avail_out;
+    *capacity = bound;
+    return true;
+}
+
+/* ========== 有序写出 ========== */
+
+arm64_gzsink_t *arm64_gzsink_open(FILE *out, int level, size_t window) {
+    const arm64_allocator_t *allocator = arm64_default_allocator();
+    arm64_gzsink_t *sink = arm64_alloc(allocator, sizeof(*sink), 16);
+    if (!sink) {
+        return NULL;
+    }
+    memset(sink, 0, sizeof(*sink));
+    sink->allocator = allocator;
+    sink->out = out;
+    sink->level = level;
+    sink->window = window ? window : 64;
+    sink->slots = arm64_alloc(allocator, sink->window * sizeof(slot_t), 16);
+    if (!sink->slots) {
+        arm64_free(allocator, sink, sizeof(*sink));
+        return NULL;
+    }
+    memset(sink->slots, 0, sink->window * sizeof(slot_t));
+    pthread_mutex_init(&sink->lock, NULL);
+    pthread_cond_init(&sink->cond, NULL);
+    return sink;
+}
+
+uint64_t arm64_gzsink_reserve(arm64_gzsink_t *sink, uint64_t count) {
+    pthread_mutex_lock(&sink->lock);
+    uint64_t first = sink->assigned;
+    sink->assigned += count;
+    pthread_mutex_unlock(&sink->lock);
+    return first;
+}
+
+/* 依次写出已就绪的块；调用时持有锁，写文件时释放锁 */
+static void drain(arm64_gzsink_t *sink) {
+    sink->writing = true;
+    for (;;) {
+        slot_t *slot = &sink->slots[sink->next % sink->window];
+        if (!slot->ready) {
+            break;
+        }
+        uint8_t *data = slot->data;
+        size_t size = slot->size;
+        size_t capacity = slot->capacity;
+        slot->data = NULL;
+        slot->ready = false;
+        pthread_mutex_unlock(&sink->lock);
+        bool ok = size == 0 || fwrite(data, 1, size, sink->out) == size;
+        arm64_free(sink->allocator, data, capacity);
+        pthread_mutex_lock(&sink->lock);
+        if (!ok) {
+            sink->error = true;
+        }
+        if (size > 0) {
+            sink->stats.blocks++;
+            sink->stats.bytes_out += size;
+        }
+        sink->next++;
+        pthread_cond_broadcast(&sink->cond);
+    }
+    sink->writing = false;
+}
+
+bool arm64_gzsink_put(arm64_gzsink_t *sink, uint64_t seq, const void *data, size_t size) {
+    uint8_t *member = NULL;
+    size_t member_size = 0;
+    size_t capacity = 0;
+    bool ok = size == 0 || compress_member(sink->allocator, sink->level, data, size,
+                                           &member, &member_size, &capacity);
+
+    pthread_mutex_lock(&sink->lock);
+    if (!ok) {
+        sink->error = true;
+    }
+    /* 暂存区满：等待前面的块写出 */
+    while (!sink->error && seq >= sink->next + sink->window) {
+        pthread_cond_wait(&sink->cond, &sink->lock);
+    }
+    if (sink->error) {
+        /* 出错后不再写出，唤醒其他等待的线程让它们也返回 */
+        arm64_free(sink->allocator, member, capacity);
+        pthread_cond_broadcast(&sink->cond);
+        pthread_mutex_unlock(&sink->lock);
+        return false;
+    }
+    slot_t *slot = &sink->slots[seq % sink->window];
+    slot->data = member;
+    slot->size = member_size;
+    slot->capacity = capacity;
+    slot->ready = true;
+    sink->stats.bytes_in += size;
+    if (!sink->writing) {
+        drain(sink);
+    }
+    ok = !sink->error;
+    pthread_mutex_unlock(&sink->lock);
+    return ok;
+}
+
+bool arm64_gzsink_close(arm64_gzsink_t *sink, arm64_gzsink_stats_t *stats) {
+    pthread_mutex_lock(&sink->lock);
+    bool ok = !sink->error && sink->next == sink->assigned;
+    pthread_mutex_unlock(&sink->lock);
+
+    if (ok && sink->stats.blocks == 0) {
+        uint8_t *member;
+        size_t size, capacity;
+        ok = compress_member(sink->allocator, sink->level, "", 0, &member, &size, &capacity);
+        if (ok) {
+            ok = fwrite(member, 1, size, sink->out) == size;
+            sink->stats.blocks++;
+            sink->stats.bytes_out += size;
+            arm64_free(sink->allocator, member, capacity);
+        }
+    }
+    if (fflush(sink->out) != 0) {
+        ok = false;
+    }
+    if (stats) {
+        *stats = sink->stats;
+    }
+    const arm64_allocator_t *allocator = sink->allocator;
+    for (size_t i = 0; i < sink->window; i++) {
+        arm64_free(allocator, sink->slots[i].data, sink->slots[i].capacity);
+    }
+    pthread_mutex_destroy(&sink->lock);
+    pthread_cond_destroy(&sink->cond);
+    arm64_free(allocator, sink->slots, sink->window * sizeof(slot_t));
+    arm64_free(allocator, sink, sizeof(*sink));
+    return ok;
+}
+
+/* ========== 并行清单 ========== */
+
+/* 一块：段下标和段内范围；section 为 SIZE_MAX 时是文件头 */
+typedef struct {
+    size_t section;
+    size_t offset;
+    size_t size;
+} block_t;
+
+/* 工作线程把清单写入内存，凑满一块后压缩提交 */
+typedef struct {
+    const arm64_allocator_t *allocator;
+    char *data;
+    size_t len;
+    size_t cap;
+} membuf_t;
+
+static bool membuf_write(void *ctx, const void *data, size_t size) {
+    membuf_t *m = ctx;
+    if (m->len + size > m->cap) {
+        size_t cap = m->cap ? m->cap : (1u << 20);
+        while (cap < m->len + size) {
+            cap *= 2;
+        }
+        char *p = arm64_alloc(m->allocator, cap, 1);
+        if (!p) {
+            return false;
+        }
+        if (m->len > 0) {
+            memcpy(p, m->data, m->len);
+        }
+        arm64_free(m->allocator, m->data, m->cap);
+        m->data = p;
+        m->cap = cap;
+    }
+    memcpy(m->data + m->len, data, size);
+    m->len += size;
+    return true;
+}
+
+typedef struct {
+    arm64_gzsink_t *sink;
+    const arm64_listing_image_t *image;
+    const arm64_listing_symbol_t *symbols;
+    size_t symbol_count;
+    const block_t *blocks;
+    size_t block_count;
+    uint64_t first_seq;
+    size_t next_block;          // 原子领取
+    bool failed;
+} job_t;
+
+static void *listing_worker(void *arg) {
+    job_t *job = arg;
+    membuf_t mem = { job->sink->allocator, NULL, 0, 0 };
+    arm64_listing_t listing;
+    if (!arm64_listing_init_writer(&listing, membuf_write, &mem, job->symbols,
+                                   job->symbol_count)) {
+        __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+    }
+
+    for (;;) {
+        size_t b = __atomic_fetch_add(&job->next_block, 1, __ATOMIC_RELAXED);
+        if (b >= job->block_count) {
+            break;
+        }
+        /* 失败后仍然提交空块，保证序号连续 */
+        bool ok = listing.buf != NULL && !__atomic_load_n(&job->failed, __ATOMIC_RELAXED);
+        mem.len = 0;
+        if (ok) {
+            const block_t *blk = &job->blocks[b];
+            if (blk->section == SIZE_MAX) {
+                arm64_listing_file_header(&listing, job->image->path, job->image->format);
+            } else {
+                const arm64_listing_section_t *sec = &job->image->sections[blk->section];
+                if (blk->offset == 0) {
+                    arm64_listing_section_header(&listing, sec);
+                }
+                arm64_listing_range(&listing, sec, blk->offset, blk->size);
+            }
+            ok = arm64_listing_flush(&listing);
+        }
+        if (!arm64_gzsink_put(job->sink, job->first_seq + b, mem.data, ok ? mem.len : 0) ||
+            !ok) {
+            __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+        }
+    }
+
+    if (listing.buf) {
+        arm64_listing_free(&listing);
+    }
+    arm64_free(mem.allocator, mem.data, mem.cap);
+    return NULL;
+}
+
+bool arm64_gzsink_listing(arm64_gzsink_t *sink, const arm64_listing_image_t *image,
+                          const arm64_listing_symbol_t *symbols, size_t symbol_count,
+                          unsigned threads, size_t block_insts) {
+    size_t block_bytes = (block_insts ? block_insts : ARM64_GZSINK_BLOCK_INSTS) * 4;
+    if (threads == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = n > 0 ? (unsigned)n : 1;
+    }
+
+    /* 划分块：文件头，然后每段至少一块（空段也要输出段头） */
+    size_t count = 1;
+    for (size_t i = 0; i < image->section_count; i++) {
+        size_t size = image->sections[i].size;
+        count += size ? (size + block_bytes - 1) / block_bytes : 1;
+    }
+    const arm64_allocator_t *allocator = sink->allocator;
+    block_t *blocks = arm64_alloc(allocator, count * sizeof(block_t), 16);
+    pthread_t *tids = arm64_alloc(allocator, threads * sizeof(pthread_t), 16);
+    if (!blocks || !tids) {
+        arm64_free(allocator, blocks, count * sizeof(block_t));
+        arm64_free(allocator, tids, threads * sizeof(pthread_t));
+        return false;
+    }
+    size_t n = 0;
+    blocks[n++] = (block_t){ SIZE_MAX, 0, 0 };
+    for (size_t i = 0; i < image->section_count; i++) {
+        size_t size = image->sections[i].size;
+        size_t offset = 0;
+        do {
+            size_t len = size - offset < block_bytes ? size - offset : block_bytes;
+            blocks[n++] = (block_t){ i, offset, len };
+            offset += len;
+        } while (offset < size);
+    }
+
+    job_t job = { sink, image, symbols, symbol_count, blocks, n,
+                  arm64_gzsink_reserve(sink, n), 0, false };
+    unsigned workers = threads > n ? (unsigned)n : threads;
+    unsigned started = 0;
+    for (; started < workers; started++) {
+        if (pthread_create(&tids[started], NULL, listing_worker, &job) != 0) {
+            break;
+        }
+    }
+    /* 一个线程也没有启动时在当前线程完成 */
+    if (started == 0) {
+        listing_worker(&job);
+    }
+    for (unsigned t = 0; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+    arm64_free(allocator, blocks, count * sizeof(block_t));
+    arm64_free(allocator, tids, threads * sizeof(pthread_t));
+    return !job.failed;
+}
@@ -0,0 +1,80 @@
+/**
+ * ARM64反汇编器 - 分块并行压缩输出（需要 zlib 和 pthread）
+ * 输出分成互不依赖的块，每块压缩为一个完整的 gzip 成员，按块序号顺序拼接写出；
+ * 多成员 gzip 文件（RFC 1952）可以直接用 gzip -d、zcat、zlib 的 gzread 解压
+ *
+ * - 任意线程都可以提交块：压缩在提交线程中进行，写出由当前轮到的线程顺序完成
+ * - 已压缩但还不能写出的块最多 window 个，超出时提交线程等待（限制内存占用）
+ * - arm64_gzsink_listing 用工作线程直接解码、格式化并压缩映像的各块，吞吐量随核数增加
+ */
+
+#ifndef ARM64_GZSINK_H
+#define ARM64_GZSINK_H
+
+#include "arm64_listing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 并行清单中每块的默认指令数（约 2.5MB 文本） */
+#define ARM64_GZSINK_BLOCK_INSTS    65536
+
+/* 压缩输出（不透明） */
+typedef struct arm64_gzsink arm64_gzsink_t;
+
+/* 统计 */
+typedef struct {
+    uint64_t blocks;            // 已写出的块数（gzip 成员数）
+    uint64_t bytes_in;          // 压缩前的字节数
+    uint64_t bytes_out;         // 写出的字节数
+} arm64_gzsink_stats_t;
+
+/**
+ * 创建压缩输出
+ * @param out 输出文件（二进制模式）
+ * @param level zlib 压缩级别（0-9，-1 使用默认值6）
+ * @param window 最多暂存的已压缩块数，0 使用默认值64
+ * @return 内存不足时返回 NULL
+ */
+arm64_gzsink_t *arm64_gzsink_open(FILE *out, int level, size_t window);
+
+/**
+ * 分配 count 个连续的块序号，返回第一个
+ * 同一输出上依次生成多份内容（如多个文件）时，每份先分配自己的序号段
+ */
+uint64_t arm64_gzsink_reserve(arm64_gzsink_t *sink, uint64_t count);
+
+/**
+ * 压缩并提交一个块（线程安全）
+ * @param seq 由 arm64_gzsink_reserve 分配的序号；每个序号恰好提交一次，空块也要提交
+ * @param size 不超过 4GB
+ * @return 压缩或写出失败时返回 false（之后的提交都返回 false）
+ */
+bool arm64_gzsink_put(arm64_gzsink_t *sink, uint64_t seq, const void *data, size_t size);
+
+/**
+ * 写出剩余内容并释放
+ * 所有已分配的序号都必须已经提交；没有写出任何成员时写一个空成员，保证结果是合法的 gzip 文件
+ * @param stats 可为 NULL
+ * @return 此前所有压缩和写出都成功时返回 true
+ */
+bool arm64_gzsink_close(arm64_gzsink_t *sink, arm64_gzsink_stats_t *stats);
+
+/**
+ * 多线程生成映像的清单并写入压缩输出
+ * 文件头单独成块，各段按 block_insts 条指令分块；解压后的内容与单线程
+ * arm64_listing_image 的输出逐字节相同
+ * @param threads 工作线程数，0 使用在线 CPU 数
+ * @param block_insts 每块的指令数，0 使用 ARM64_GZSINK_BLOCK_INSTS
+ * @return 失败时返回 false
+ */
+bool arm64_gzsink_listing(arm64_gzsink_t *sink, const arm64_listing_image_t *image,
+                          const arm64_listing_symbol_t *symbols, size_t symbol_count,
+                          unsigned threads, size_t block_insts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_GZSINK_H */
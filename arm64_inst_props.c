@@ -0,0 +1,2679 @@
+/**
+ * ARM64反汇编器 - 指令属性表
+ * 此文件由 gen_inst_props.py 根据 isa_aarch64.json 生成，请勿手工修改
+ */
+
+#include "arm64_disasm.h"
+
+/* 按指令类型直接索引的属性位（INST_PROP_*） */
+const uint32_t inst_prop_table[INST_TYPE_COUNT] = {
+    [INST_TYPE_UNKNOWN] = 0,
+    [INST_TYPE_LDR]     = INST_PROP_MEM_READ,
+    [INST_TYPE_LDRB]    = INST_PROP_MEM_READ,
+    [INST_TYPE_LDRH]    = INST_PROP_MEM_READ,
+    [INST_TYPE_LDRSW]   = INST_PROP_MEM_READ,
+    [INST_TYPE_LDRSB]   = INST_PROP_MEM_READ,
+    [INST_TYPE_LDRSH]   = INST_PROP_MEM_READ,
+    [INST_TYPE_STR]     = INST_PROP_MEM_WRITE,
+    [INST_TYPE_STRB]    = INST_PROP_MEM_WRITE,
+    [INST_TYPE_STRH]    = INST_PROP_MEM_WRITE,
+    [INST_TYPE_STP]     = INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDP]     = INST_PROP_MEM_READ,
+    [INST_TYPE_MOV]     = 0,
+    [INST_TYPE_MOVZ]    = 0,
+    [INST_TYPE_MOVN]    = 0,
+    [INST_TYPE_MOVK]    = 0,
+    [INST_TYPE_ADD]     = 0,
+    [INST_TYPE_SUB]     = 0,
+    [INST_TYPE_ADDS]    = INST_PROP_SETS_FLAGS,
+    [INST_TYPE_SUBS]    = INST_PROP_SETS_FLAGS,
+    [INST_TYPE_ADR]     = 0,
+    [INST_TYPE_ADRP]    = 0,
+    [INST_TYPE_B]       = INST_PROP_BRANCH,
+    [INST_TYPE_BL]      = INST_PROP_BRANCH | INST_PROP_CALL,
+    [INST_TYPE_BR]      = INST_PROP_BRANCH | INST_PROP_INDIRECT,
+    [INST_TYPE_BLR]     = INST_PROP_BRANCH | INST_PROP_CALL | INST_PROP_INDIRECT,
+    [INST_TYPE_RET]     = INST_PROP_BRANCH | INST_PROP_INDIRECT | INST_PROP_RETURN,
+    [INST_TYPE_CBZ]     = INST_PROP_BRANCH | INST_PROP_CONDITIONAL,
+    [INST_TYPE_CBNZ]    = INST_PROP_BRANCH | INST_PROP_CONDITIONAL,
+    [INST_TYPE_TBZ]     = INST_PROP_BRANCH | INST_PROP_CONDITIONAL,
+    [INST_TYPE_TBNZ]    = INST_PROP_BRANCH | INST_PROP_CONDITIONAL,
+    [INST_TYPE_AND]     = 0,
+    [INST_TYPE_ORR]     = 0,
+    [INST_TYPE_EOR]     = 0,
+    [INST_TYPE_LSL]     = 0,
+    [INST_TYPE_LSR]     = 0,
+    [INST_TYPE_ASR]     = 0,
+    [INST_TYPE_ROR]     = 0,
+    [INST_TYPE_CMP]     = INST_PROP_SETS_FLAGS,
+    [INST_TYPE_CMN]     = INST_PROP_SETS_FLAGS,
+    [INST_TYPE_TST]     = INST_PROP_SETS_FLAGS,
+    [INST_TYPE_MUL]     = 0,
+    [INST_TYPE_MADD]    = 0,
+    [INST_TYPE_MSUB]    = 0,
+    [INST_TYPE_SDIV]    = 0,
+    [INST_TYPE_UDIV]    = 0,
+    [INST_TYPE_SMULL]   = 0,
+    [INST_TYPE_UMULL]   = 0,
+    [INST_TYPE_CSEL]    = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CSINC]   = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CSINV]   = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CSNEG]   = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CSET]    = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CSETM]   = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CINC]    = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CINV]    = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CNEG]    = INST_PROP_READS_FLAGS,
+    [INST_TYPE_CLZ]     = 0,
+    [INST_TYPE_CLS]     = 0,
+    [INST_TYPE_RBIT]    = 0,
+    [INST_TYPE_REV]     = 0,
+    [INST_TYPE_REV16]   = 0,
+    [INST_TYPE_REV32]   = 0,
+    [INST_TYPE_EXTR]    = 0,
+    [INST_TYPE_LDXR]    = INST_PROP_EXCLUSIVE | INST_PROP_MEM_READ,
+    [INST_TYPE_STXR]    = INST_PROP_EXCLUSIVE | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDAXR]   = INST_PROP_ACQUIRE | INST_PROP_EXCLUSIVE | INST_PROP_MEM_READ,
+    [INST_TYPE_STLXR]   = INST_PROP_EXCLUSIVE | INST_PROP_MEM_WRITE | INST_PROP_RELEASE,
+    [INST_TYPE_LDAR]    = INST_PROP_ACQUIRE | INST_PROP_MEM_READ,
+    [INST_TYPE_STLR]    = INST_PROP_MEM_WRITE | INST_PROP_RELEASE,
+    [INST_TYPE_LDADD]   = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDCLR]   = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDEOR]   = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDSET]   = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDSMAX]  = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDSMIN]  = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDUMAX]  = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_LDUMIN]  = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_SWP]     = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_CAS]     = INST_PROP_ATOMIC | INST_PROP_MEM_READ | INST_PROP_MEM_WRITE,
+    [INST_TYPE_NOP]     = 0,
+    [INST_TYPE_MRS]     = INST_PROP_SYSTEM,
+    [INST_TYPE_MSR]     = INST_PROP_PRIVILEGED | INST_PROP_SYSTEM,
+    [INST_TYPE_DMB]     = INST_PROP_BARRIER | INST_PROP_SYSTEM,
+    [INST_TYPE_DSB]     = INST_PROP_BARRIER | INST_PROP_SYSTEM,
+    [INST_TYPE_ISB]     = INST_PROP_BARRIER | INST_PROP_SYSTEM,
+    [INST_TYPE_SVC]     = INST_PROP_EXCEPTION | INST_PROP_SYSTEM,
+    [INST_TYPE_HVC]     = INST_PROP_EXCEPTION | INST_PROP_PRIVILEGED | INST_PROP_SYSTEM,
+    [INST_TYPE_SMC]     = INST_PROP_EXCEPTION | INST_PROP_PRIVILEGED | INST_PROP_SYSTEM,
+    [INST_TYPE_FMOV]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FADD]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FSUB]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FMUL]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FDIV]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FABS]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FNEG]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FSQRT]   = INST_PROP_FP_SIMD,
+    [INST_TYPE_FMADD]   = INST_PROP_FP_SIMD,
+    [INST_TYPE_FMSUB]   = INST_PROP_FP_SIMD,
+    [INST_TYPE_FNMADD]  = INST_PROP_FP_SIMD,
+    [INST_TYPE_FNMSUB]  = INST_PROP_FP_SIMD,
+    [INST_TYPE_FCMP]    = INST_PROP_FP_SIMD | INST_PROP_SETS_FLAGS,
+    [INST_TYPE_FCMPE]   = INST_PROP_FP_SIMD | INST_PROP_SETS_FLAGS,
+    [INST_TYPE_FCCMP]   = INST_PROP_FP_SIMD | INST_PROP_READS_FLAGS | INST_PROP_SETS_FLAGS,
+    [INST_TYPE_FCSEL]   = INST_PROP_FP_SIMD | INST_PROP_READS_FLAGS,
+    [INST_TYPE_FCVT]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FCVTZS]  = INST_PROP_FP_SIMD,
+    [INST_TYPE_FCVTZU]  = INST_PROP_FP_SIMD,
+    [INST_TYPE_SCVTF]   = INST_PROP_FP_SIMD,
+    [INST_TYPE_UCVTF]   = INST_PROP_FP_SIMD,
+    [INST_TYPE_FRINT]   = INST_PROP_FP_SIMD,
+    [INST_TYPE_FMAX]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_FMIN]    = INST_PROP_FP_SIMD,
+    [INST_TYPE_BCOND]   = INST_PROP_BRANCH | INST_PROP_CONDITIONAL | INST_PROP_READS_FLAGS,
+    [INST_TYPE_PRFM]    = INST_PROP_MEM_READ,
+};
+
+/* 按指令类型直接索引的最低扩展要求（arm64_ext_t） */
+const uint8_t inst_ext_table[INST_TYPE_COUNT] = {
+    [INST_TYPE_UNKNOWN] = ARM64_EXT_BASE,
+    [INST_TYPE_LDR]     = ARM64_EXT_BASE,
+    [INST_TYPE_LDRB]    = ARM64_EXT_BASE,
+    [INST_TYPE_LDRH]    = ARM64_EXT_BASE,
+    [INST_TYPE_LDRSW]   = ARM64_EXT_BASE,
+    [INST_TYPE_LDRSB]   = ARM64_EXT_BASE,
+    [INST_TYPE_LDRSH]   = ARM64_EXT_BASE,
+    [INST_TYPE_STR]     = ARM64_EXT_BASE,
+    [INST_TYPE_STRB]    = ARM64_EXT_BASE,
+    [INST_TYPE_STRH]    = ARM64_EXT_BASE,
+    [INST_TYPE_STP]     = ARM64_EXT_BASE,
+    [INST_TYPE_LDP]     = ARM64_EXT_BASE,
+    [INST_TYPE_MOV]     = ARM64_EXT_BASE,
+    [INST_TYPE_MOVZ]    = ARM64_EXT_BASE,
+    [INST_TYPE_MOVN]    = ARM64_EXT_BASE,
+    [INST_TYPE_MOVK]    = ARM64_EXT_BASE,
+    [INST_TYPE_ADD]     = ARM64_EXT_BASE,
+    [INST_TYPE_SUB]     = ARM64_EXT_BASE,
+    [INST_TYPE_ADDS]    = ARM64_EXT_BASE,
+    [INST_TYPE_SUBS]    = ARM64_EXT_BASE,
+    [INST_TYPE_ADR]     = ARM64_EXT_BASE,
+    [INST_TYPE_ADRP]    = ARM64_EXT_BASE,
+    [INST_TYPE_B]       = ARM64_EXT_BASE,
+    [INST_TYPE_BL]      = ARM64_EXT_BASE,
+    [INST_TYPE_BR]      = ARM64_EXT_BASE,
+    [INST_TYPE_BLR]     = ARM64_EXT_BASE,
+    [INST_TYPE_RET]     = ARM64_EXT_BASE,
+    [INST_TYPE_CBZ]     = ARM64_EXT_BASE,
+    [INST_TYPE_CBNZ]    = ARM64_EXT_BASE,
+    [INST_TYPE_TBZ]     = ARM64_EXT_BASE,
+    [INST_TYPE_TBNZ]    = ARM64_EXT_BASE,
+    [INST_TYPE_AND]     = ARM64_EXT_BASE,
+    [INST_TYPE_ORR]     = ARM64_EXT_BASE,
+    [INST_TYPE_EOR]     = ARM64_EXT_BASE,
+    [INST_TYPE_LSL]     = ARM64_EXT_BASE,
+    [INST_TYPE_LSR]     = ARM64_EXT_BASE,
+    [INST_TYPE_ASR]     = ARM64_EXT_BASE,
+    [INST_TYPE_ROR]     = ARM64_EXT_BASE,
+    [INST_TYPE_CMP]     = ARM64_EXT_BASE,
+    [INST_TYPE_CMN]     = ARM64_EXT_BASE,
+    [INST_TYPE_TST]     = ARM64_EXT_BASE,
+    [INST_TYPE_MUL]     = ARM64_EXT_BASE,
+    [INST_TYPE_MADD]    = ARM64_EXT_BASE,
+    [INST_TYPE_MSUB]    = ARM64_EXT_BASE,
+    [INST_TYPE_SDIV]    = ARM64_EXT_BASE,
+    [INST_TYPE_UDIV]    = ARM64_EXT_BASE,
+    [INST_TYPE_SMULL]   = ARM64_EXT_BASE,
+    [INST_TYPE_UMULL]   = ARM64_EXT_BASE,
+    [INST_TYPE_CSEL]    = ARM64_EXT_BASE,
+    [INST_TYPE_CSINC]   = ARM64_EXT_BASE,
+    [INST_TYPE_CSINV]   = ARM64_EXT_BASE,
+    [INST_TYPE_CSNEG]   = ARM64_EXT_BASE,
+    [INST_TYPE_CSET]    = ARM64_EXT_BASE,
+    [INST_TYPE_CSETM]   = ARM64_EXT_BASE,
+    [INST_TYPE_CINC]    = ARM64_EXT_BASE,
+    [INST_TYPE_CINV]    = ARM64_EXT_BASE,
+    [INST_TYPE_CNEG]    = ARM64_EXT_BASE,
+    [INST_TYPE_CLZ]     = ARM64_EXT_BASE,
+    [INST_TYPE_CLS]     = ARM64_EXT_BASE,
+    [INST_TYPE_RBIT]    = ARM64_EXT_BASE,
+    [INST_TYPE_REV]     = ARM64_EXT_BASE,
+    [INST_TYPE_REV16]   = ARM64_EXT_BASE,
+    [INST_TYPE_REV32]   = ARM64_EXT_BASE,
+    [INST_TYPE_EXTR]    = ARM64_EXT_BASE,
+    [INST_TYPE_LDXR]    = ARM64_EXT_BASE,
+    [INST_TYPE_STXR]    = ARM64_EXT_BASE,
+    [INST_TYPE_LDAXR]   = ARM64_EXT_BASE,
+    [INST_TYPE_STLXR]   = ARM64_EXT_BASE,
+    [INST_TYPE_LDAR]    = ARM64_EXT_BASE,
+    [INST_TYPE_STLR]    = ARM64_EXT_BASE,
+    [INST_TYPE_LDADD]   = ARM64_EXT_LSE,
+    [INST_TYPE_LDCLR]   = ARM64_EXT_LSE,
+    [INST_TYPE_LDEOR]   = ARM64_EXT_LSE,
+    [INST_TYPE_LDSET]   = ARM64_EXT_LSE,
+    [INST_TYPE_LDSMAX]  = ARM64_EXT_LSE,
+    [INST_TYPE_LDSMIN]  = ARM64_EXT_LSE,
+    [INST_TYPE_LDUMAX]  = ARM64_EXT_LSE,
+    [INST_TYPE_LDUMIN]  = ARM64_EXT_LSE,
+    [INST_TYPE_SWP]     = ARM64_EXT_LSE,
+    [INST_TYPE_CAS]     = ARM64_EXT_LSE,
+    [INST_TYPE_NOP]     = ARM64_EXT_BASE,
+    [INST_TYPE_MRS]     = ARM64_EXT_BASE,
+    [INST_TYPE_MSR]     = ARM64_EXT_BASE,
+    [INST_TYPE_DMB]     = ARM64_EXT_BASE,
+    [INST_TYPE_DSB]     = ARM64_EXT_BASE,
+    [INST_TYPE_ISB]     = ARM64_EXT_BASE,
+    [INST_TYPE_SVC]     = ARM64_EXT_BASE,
+    [INST_TYPE_HVC]     = ARM64_EXT_BASE,
+    [INST_TYPE_SMC]     = ARM64_EXT_BASE,
+    [INST_TYPE_FMOV]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FADD]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FSUB]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FMUL]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FDIV]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FABS]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FNEG]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FSQRT]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FMADD]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FMSUB]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FNMADD]  = ARM64_EXT_ASIMD,
+    [INST_TYPE_FNMSUB]  = ARM64_EXT_ASIMD,
+    [INST_TYPE_FCMP]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FCMPE]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FCCMP]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FCSEL]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FCVT]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FCVTZS]  = ARM64_EXT_ASIMD,
+    [INST_TYPE_FCVTZU]  = ARM64_EXT_ASIMD,
+    [INST_TYPE_SCVTF]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_UCVTF]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FRINT]   = ARM64_EXT_ASIMD,
+    [INST_TYPE_FMAX]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_FMIN]    = ARM64_EXT_ASIMD,
+    [INST_TYPE_BCOND]   = ARM64_EXT_BASE,
+    [INST_TYPE_PRFM]    = ARM64_EXT_BASE,
+};
+
+/* 扩展名称 */
+const char *const arm64_ext_names[ARM64_EXT_COUNT] = {
+    "base",
+    "brbe",
+    "bti",
+    "chk",
+    "clrbhb",
+    "cpa",
+    "crc32",
+    "cssc",
+    "d128",
+    "dgh",
+    "flagm",
+    "flagm2",
+    "gcs",
+    "hbc",
+    "ite",
+    "lor",
+    "lrcpc",
+    "lrcpc2",
+    "lrcpc3",
+    "ls64",
+    "ls64_accdata",
+    "ls64_v",
+    "lse",
+    "mops",
+    "mte",
+    "mte2",
+    "pauth",
+    "ras",
+    "rprfm",
+    "sb",
+    "spe",
+    "specres",
+    "specres2",
+    "sysinstr128",
+    "sysreg128",
+    "the",
+    "tme",
+    "trf",
+    "wfxt",
+    "asimd",
+    "aes",
+    "bf16",
+    "dotprod",
+    "faminmax",
+    "fcma",
+    "fhm",
+    "fp16",
+    "fp8",
+    "fp8dot2",
+    "fp8dot4",
+    "fp8fma",
+    "frintts",
+    "i8mm",
+    "jscvt",
+    "lut",
+    "rdm",
+    "sha1",
+    "sha256",
+    "sha3",
+    "sha512",
+    "sm3",
+    "sm4",
+    "sve",
+    "sve_bf16",
+    "sve_f32mm",
+    "sve_f64mm",
+    "sve_i8mm",
+    "sve2",
+    "sve2_aes",
+    "sve2_bitperm",
+    "sve2_sha3",
+    "sve2_sm4",
+    "sme",
+    "xs",
+};
+
+/* 指令类型名称（该类型的基本助记符，B.cond 为 "b"） */
+const char *const inst_type_names[INST_TYPE_COUNT] = {
+    [INST_TYPE_UNKNOWN] = "unknown",
+    [INST_TYPE_LDR]     = "ldr",
+    [INST_TYPE_LDRB]    = "ldrb",
+    [INST_TYPE_LDRH]    = "ldrh",
+    [INST_TYPE_LDRSW]   = "ldrsw",
+    [INST_TYPE_LDRSB]   = "ldrsb",
+    [INST_TYPE_LDRSH]   = "ldrsh",
+    [INST_TYPE_STR]     = "str",
+    [INST_TYPE_STRB]    = "strb",
+    [INST_TYPE_STRH]    = "strh",
+    [INST_TYPE_STP]     = "stp",
+    [INST_TYPE_LDP]     = "ldp",
+    [INST_TYPE_MOV]     = "mov",
+    [INST_TYPE_MOVZ]    = "movz",
+    [INST_TYPE_MOVN]    = "movn",
+    [INST_TYPE_MOVK]    = "movk",
+    [INST_TYPE_ADD]     = "add",
+    [INST_TYPE_SUB]     = "sub",
+    [INST_TYPE_ADDS]    = "adds",
+    [INST_TYPE_SUBS]    = "subs",
+    [INST_TYPE_ADR]     = "adr",
+    [INST_TYPE_ADRP]    = "adrp",
+    [INST_TYPE_B]       = "b",
+    [INST_TYPE_BL]      = "bl",
+    [INST_TYPE_BR]      = "br",
+    [INST_TYPE_BLR]     = "blr",
+    [INST_TYPE_RET]     = "ret",
+    [INST_TYPE_CBZ]     = "cbz",
+    [INST_TYPE_CBNZ]    = "cbnz",
+    [INST_TYPE_TBZ]     = "tbz",
+    [INST_TYPE_TBNZ]    = "tbnz",
+    [INST_TYPE_AND]     = "and",
+    [INST_TYPE_ORR]     = "orr",
+    [INST_TYPE_EOR]     = "eor",
+    [INST_TYPE_LSL]     = "lsl",
+    [INST_TYPE_LSR]     = "lsr",
+    [INST_TYPE_ASR]     = "asr",
+    [INST_TYPE_ROR]     = "ror",
+    [INST_TYPE_CMP]     = "cmp",
+    [INST_TYPE_CMN]     = "cmn",
+    [INST_TYPE_TST]     = "tst",
+    [INST_TYPE_MUL]     = "mul",
+    [INST_TYPE_MADD]    = "madd",
+    [INST_TYPE_MSUB]    = "msub",
+    [INST_TYPE_SDIV]    = "sdiv",
+    [INST_TYPE_UDIV]    = "udiv",
+    [INST_TYPE_SMULL]   = "smull",
+    [INST_TYPE_UMULL]   = "umull",
+    [INST_TYPE_CSEL]    = "csel",
+    [INST_TYPE_CSINC]   = "csinc",
+    [INST_TYPE_CSINV]   = "csinv",
+    [INST_TYPE_CSNEG]   = "csneg",
+    [INST_TYPE_CSET]    = "cset",
+    [INST_TYPE_CSETM]   = "csetm",
+    [INST_TYPE_CINC]    = "cinc",
+    [INST_TYPE_CINV]    = "cinv",
+    [INST_TYPE_CNEG]    = "cneg",
+    [INST_TYPE_CLZ]     = "clz",
+    [INST_TYPE_CLS]     = "cls",
+    [INST_TYPE_RBIT]    = "rbit",
+    [INST_TYPE_REV]     = "rev",
+    [INST_TYPE_REV16]   = "rev16",
+    [INST_TYPE_REV32]   = "rev32",
+    [INST_TYPE_EXTR]    = "extr",
+    [INST_TYPE_LDXR]    = "ldxr",
+    [INST_TYPE_STXR]    = "stxr",
+    [INST_TYPE_LDAXR]   = "ldaxr",
+    [INST_TYPE_STLXR]   = "stlxr",
+    [INST_TYPE_LDAR]    = "ldar",
+    [INST_TYPE_STLR]    = "stlr",
+    [INST_TYPE_LDADD]   = "ldadd",
+    [INST_TYPE_LDCLR]   = "ldclr",
+    [INST_TYPE_LDEOR]   = "ldeor",
+    [INST_TYPE_LDSET]   = "ldset",
+    [INST_TYPE_LDSMAX]  = "ldsmax",
+    [INST_TYPE_LDSMIN]  = "ldsmin",
+    [INST_TYPE_LDUMAX]  = "ldumax",
+    [INST_TYPE_LDUMIN]  = "ldumin",
+    [INST_TYPE_SWP]     = "swp",
+    [INST_TYPE_CAS]     = "cas",
+    [INST_TYPE_NOP]     = "nop",
+    [INST_TYPE_MRS]     = "mrs",
+    [INST_TYPE_MSR]     = "msr",
+    [INST_TYPE_DMB]     = "dmb",
+    [INST_TYPE_DSB]     = "dsb",
+    [INST_TYPE_ISB]     = "isb",
+    [INST_TYPE_SVC]     = "svc",
+    [INST_TYPE_HVC]     = "hvc",
+    [INST_TYPE_SMC]     = "smc",
+    [INST_TYPE_FMOV]    = "fmov",
+    [INST_TYPE_FADD]    = "fadd",
+    [INST_TYPE_FSUB]    = "fsub",
+    [INST_TYPE_FMUL]    = "fmul",
+    [INST_TYPE_FDIV]    = "fdiv",
+    [INST_TYPE_FABS]    = "fabs",
+    [INST_TYPE_FNEG]    = "fneg",
+    [INST_TYPE_FSQRT]   = "fsqrt",
+    [INST_TYPE_FMADD]   = "fmadd",
+    [INST_TYPE_FMSUB]   = "fmsub",
+    [INST_TYPE_FNMADD]  = "fnmadd",
+    [INST_TYPE_FNMSUB]  = "fnmsub",
+    [INST_TYPE_FCMP]    = "fcmp",
+    [INST_TYPE_FCMPE]   = "fcmpe",
+    [INST_TYPE_FCCMP]   = "fccmp",
+    [INST_TYPE_FCSEL]   = "fcsel",
+    [INST_TYPE_FCVT]    = "fcvt",
+    [INST_TYPE_FCVTZS]  = "fcvtzs",
+    [INST_TYPE_FCVTZU]  = "fcvtzu",
+    [INST_TYPE_SCVTF]   = "scvtf",
+    [INST_TYPE_UCVTF]   = "ucvtf",
+    [INST_TYPE_FRINT]   = "frintn",
+    [INST_TYPE_FMAX]    = "fmax",
+    [INST_TYPE_FMIN]    = "fmin",
+    [INST_TYPE_BCOND]   = "b",
+    [INST_TYPE_PRFM]    = "prfm",
+};
+
+/*
+ * 编码 -> 扩展分类表：桶 k 的条目为 arm64_ext_patterns[arm64_ext_buckets[k] ..
+ * arm64_ext_buckets[k + 1])，按固定位数从多到少排列，第一个匹配的条目决定扩展，
+ * 没有匹配时为基础指令集；匹配时扫描的 mask/value 与命中后才读取的扩展分开存放
+ */
+const uint16_t arm64_ext_buckets[ARM64_EXT_BUCKETS + 1] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 65, 109, 178, 222, 287, 333, 400, 448, 453, 501, 506, 552, 557, 608, 613,
+    666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666,
+    666, 666, 668, 668, 670, 671, 673, 674, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 683, 683, 690, 690, 704, 704, 718, 718, 727, 735, 746, 756, 772, 780, 800,
+    812, 840, 915, 931, 993, 1001, 1071, 1084, 1144, 1167, 1186, 1209, 1232, 1246, 1260, 1262,
+    1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1264, 1268,
+    1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268,
+    1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268,
+    1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268,
+    1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1285, 1290, 1307, 1312, 1329, 1334, 1347,
+    1352, 1352, 1352, 1352, 1352, 1352, 1352, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362,
+    1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1387, 1387, 1404, 1404, 1421, 1421, 1434,
+    1434, 1438, 1485, 1489, 1536, 1536, 1537, 1541, 1585, 1587, 1589, 1593, 1597, 1599, 1601, 1603,
+    1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605,
+    1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605,
+    1605, 1622, 1627, 1644, 1649, 1667, 1672, 1689, 1694, 1715, 1760, 1779, 1823, 1838, 1883, 1898,
+    1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943,
+    1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943,
+    1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943, 1943,
+    1943, 1945, 1947, 1949, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962,
+    1963, 1968, 2035, 2047, 2102, 2108, 2168, 2180, 2231, 2249, 2265, 2288, 2312, 2323, 2335, 2335,
+    2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+    2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+    2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+    2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+    2336, 2336, 2356, 2356, 2376, 2376, 2397, 2397, 2417, 2417, 2417, 2417, 2417, 2417, 2417, 2417,
+    2417, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419, 2419,
+    2419, 2422, 2423, 2426, 2427, 2430, 2431, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442,
+    2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443,
+    2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443,
+    2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443, 2443,
+    2443, 2502, 2510, 2569, 2577, 2639, 2672, 2731, 2762, 2820, 2861, 2918, 2951, 3003, 3015, 3067,
+    3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079, 3079,
+    3079, 3079, 3081, 3081, 3083, 3084, 3086, 3087, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089,
+    3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089, 3089,
+    3089, 3096, 3096, 3103, 3103, 3117, 3117, 3131, 3131, 3140, 3148, 3159, 3169, 3185, 3193, 3213,
+    3225, 3257, 3336, 3354, 3431, 3442, 3516, 3530, 3605, 3628, 3647, 3670, 3693, 3704, 3715, 3723,
+    3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+    3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728, 3728,
+    3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736,
+    3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736,
+    3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3736, 3737, 3742, 3743, 3748, 3749, 3754, 3755,
+    3760, 3760, 3760, 3760, 3760, 3760, 3760, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763, 3763,
+    3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3772, 3773, 3773, 3773, 3773, 3773,
+    3773, 3784, 3805, 3808, 3831, 3831, 3853, 3854, 3886, 3899, 3912, 3927, 3942, 3950, 3958, 3961,
+    3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961,
+    3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961, 3961,
+    3961, 3970, 3974, 3982, 3989, 4000, 4014, 4024, 4034, 4089, 4098, 4169, 4178, 4244, 4253, 4328,
+    4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337, 4337,
+    4337, 4338, 4339, 4339, 4339, 4340, 4341, 4341, 4341, 4342, 4343, 4343, 4343, 4344, 4345, 4345,
+    4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345, 4345,
+    4345, 4347, 4349, 4351, 4353, 4354, 4355, 4356, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364,
+    4365, 4374, 4443, 4456, 4526, 4532, 4597, 4610, 4675, 4694, 4710, 4733, 4757, 4769, 4781, 4782,
+    4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783,
+    4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783,
+    4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783,
+    4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783, 4783,
+    4783, 4783, 4803, 4803, 4823, 4823, 4844, 4844, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+    4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864, 4864,
+    4864, 4867, 4868, 4871, 4872, 4872, 4872, 4872, 4872, 4873, 4874, 4875, 4876, 4876, 4876, 4876,
+    4876, 4876, 4892, 4897, 4918, 4920, 4938, 4942, 4971, 4985, 4999, 5014, 5029, 5032, 5035, 5036,
+    5036, 5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045, 5046, 5047, 5048, 5049, 5050, 5051,
+    5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052, 5052,
+    5052, 5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067,
+    5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068, 5068,
+    5068, 5068, 5068, 5068, 5068, 5069, 5071, 5072, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074,
+    5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074,
+    5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074,
+    5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074,
+    5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5074, 5075, 5076, 5080,
+    5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080,
+    5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080,
+    5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080,
+    5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5080, 5083, 5083, 5086, 5086, 5087, 5087, 5087,
+    5087, 5088, 5088, 5088, 5088, 5088, 5088, 5098, 5098, 5098, 5098, 5098, 5100, 5100, 5100, 5100,
+    5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108, 5109, 5109, 5110, 5110, 5110, 5110, 5110,
+    5110, 5114, 5126, 5130, 5144, 5144, 5146, 5150, 5164, 5164, 5164, 5164, 5164, 5164, 5164, 5164,
+    5164, 5165, 5166, 5167, 5168, 5169, 5170, 5171, 5172, 5173, 5174, 5175, 5176, 5177, 5178, 5179,
+    5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180, 5180,
+    5180, 5181, 5182, 5183, 5184, 5185, 5186, 5187, 5188, 5189, 5190, 5191, 5192, 5193, 5194, 5195,
+    5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196,
+    5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196,
+    5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196, 5196,
+    5196, 5198, 5200, 5202, 5204, 5205, 5206, 5207, 5208, 5209, 5210, 5211, 5212, 5213, 5214, 5215,
+    5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216,
+    5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216,
+    5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216,
+    5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216,
+    5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216, 5216,
+    5216, 5216, 5233, 5233, 5250, 5250, 5268, 5268, 5285, 5285, 5285, 5285, 5285, 5285, 5285, 5285,
+    5285, 5286, 5286, 5286, 5286, 5286, 5286, 5287, 5287, 5287, 5287, 5287, 5287, 5287, 5287, 5287,
+    5287, 5290, 5291, 5294, 5295, 5295, 5295, 5295, 5295, 5296, 5297, 5298, 5299, 5299, 5299, 5299,
+    5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299, 5299,
+    5299, 5300, 5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314,
+    5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315, 5315,
+    5315, 5316, 5317, 5318, 5319, 5320, 5321, 5322, 5323, 5324, 5325, 5326, 5327, 5328, 5329, 5330,
+    5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331, 5331,
+    5331, 5331, 5331, 5331, 5331, 5332, 5334, 5335, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337,
+    5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337,
+    5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337, 5337,
+    5337, 5338, 5339, 5344, 5351, 5352, 5352, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354,
+    5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5354, 5355, 5356, 5356,
+    5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356, 5356,
+    5356, 5356, 5356, 5356, 5357, 5357, 5357, 5357, 5357, 5402, 5406, 5408, 5409, 5409, 5409, 5409,
+    5409, 5411, 5413, 5415, 5415, 5417, 5417, 5417, 5417, 5419, 5421, 5421, 5421, 5421, 5421, 5421,
+    5421, 5421, 5421, 5421, 5421, 5421, 5421, 5421, 5421, 5426, 5428, 5431, 5433, 5433, 5435, 5435,
+    5437, 5438, 5438, 5438, 5438, 5438, 5438, 5459, 5459, 5459, 5459, 5459, 5459, 5459, 5459, 5459,
+    5459, 5459, 5459, 5459, 5459, 5459, 5459, 5459, 5459, 5460, 5460, 5461, 5461, 5461, 5461, 5461,
+    5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461, 5461,
+    5461, 5462, 5463, 5464, 5465, 5466, 5467, 5468, 5469, 5470, 5471, 5472, 5473, 5474, 5475, 5476,
+    5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477, 5477,
+    5477, 5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488, 5489, 5490, 5491, 5492,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493, 5493,
+    5493, 5493, 5515, 5515, 5533, 5533, 5553, 5553, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571,
+    5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571, 5571,
+    5571, 5574, 5575, 5578, 5579, 5579, 5579, 5579, 5579, 5580, 5581, 5582, 5583, 5583, 5583, 5583,
+    5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583, 5583,
+    5583,
+};
+
+const arm64_ext_pattern_t arm64_ext_patterns[ARM64_EXT_PATTERNS] = {
+    { 0xFFFFE000, 0x04192000 }, { 0xFFFFE000, 0x04182000 }, { 0xFFFFE000, 0x04082000 },
+    { 0xFFFFE000, 0x040A2000 }, { 0xFFFFE000, 0x04092000 }, { 0xFFFFE000, 0x040B2000 },
+    { 0xFF3FE000, 0x0416A000 }, { 0xFF3FE000, 0x04000000 }, { 0xFF3FE000, 0x041A0000 },
+    { 0xFF3FE000, 0x041A2000 }, { 0xFF3FE000, 0x04108000 }, { 0xFF3FE000, 0x04188000 },
+    { 0xFF3FE000, 0x04008000 }, { 0xFF3FE000, 0x04048000 }, { 0xFF3FE000, 0x04148000 },
+    { 0xFF3FE000, 0x0418A000 }, { 0xFF3FE000, 0x0419A000 }, { 0xFF3FE000, 0x041BA000 },
+    { 0xFF3FE000, 0x041AA000 }, { 0xFF3FE000, 0x04190000 }, { 0xFF3FE000, 0x041CA000 },
+    { 0xFF3FE000, 0x041DA000 }, { 0xFF3FE000, 0x04138000 }, { 0xFF3FE000, 0x041B8000 },
+    { 0xFF3FE000, 0x04038000 }, { 0xFF3FE000, 0x04178000 }, { 0xFF3FE000, 0x04118000 },
+    { 0xFF3FE000, 0x04198000 }, { 0xFF3FE000, 0x04018000 }, { 0xFF3FE000, 0x04158000 },
+    { 0xFF3FE000, 0x04100000 }, { 0xFF3FE000, 0x0417A000 }, { 0xFF3FE000, 0x041EA000 },
+    { 0xFF3FE000, 0x04180000 }, { 0xFF3FE000, 0x040C0000 }, { 0xFF3FE000, 0x04002000 },
+    { 0xFF3FE000, 0x04140000 }, { 0xFF3FE000, 0x04160000 }, { 0xFF3FE000, 0x04080000 },
+    { 0xFF3FE000, 0x040A0000 }, { 0xFF3FE000, 0x04120000 }, { 0xFF3FE000, 0x04010000 },
+    { 0xFF3FE000, 0x04030000 }, { 0xFF3FE000, 0x0410A000 }, { 0xFF3FE000, 0x0412A000 },
+    { 0xFF3FE000, 0x040D0000 }, { 0xFF3FE000, 0x04012000 }, { 0xFF3FE000, 0x04150000 },
+    { 0xFF3FE000, 0x04170000 }, { 0xFF3FE000, 0x04090000 }, { 0xFF3FE000, 0x040B0000 },
+    { 0xFF3FE000, 0x04130000 }, { 0xFF3FE000, 0x0411A000 }, { 0xFF3FE000, 0x0413A000 },
+    { 0xFF3FE000, 0x04068000 }, { 0xFF3FE000, 0x040F8000 }, { 0xFF3FE000, 0x040C8000 },
+    { 0xFF3FE000, 0x04078000 }, { 0xFF3FE000, 0x040D8000 }, { 0xFF3EE000, 0x04102000 },
+    { 0xFF20E000, 0x0400C000 }, { 0xFF20E000, 0x04004000 }, { 0xFF20E000, 0x04006000 },
+    { 0xFF20E000, 0x0400E000 }, { 0x1E000000, 0x04000000 }, { 0xFFFFFC00, 0x0420BC00 },
+    { 0xFF3FFC00, 0x0420B800 }, { 0xFFF0FC00, 0x0420E000 }, { 0xFFF0FC00, 0x0430E400 },
+    { 0xFFF0FC00, 0x0430E000 }, { 0xFFF0FC00, 0x0420F800 }, { 0xFFF0FC00, 0x0430F800 },
+    { 0xFFF0FC00, 0x0420F000 }, { 0xFFF0FC00, 0x0430F000 }, { 0xFFF0FC00, 0x0420FC00 },
+    { 0xFFF0FC00, 0x0430FC00 }, { 0xFFF0FC00, 0x0420F400 }, { 0xFFF0FC00, 0x0430F400 },
+    { 0xFFE0FC00, 0x04203000 }, { 0xFFE0FC00, 0x04203C00 }, { 0xFFE0FC00, 0x04203800 },
+    { 0xFFE0FC00, 0x04206400 }, { 0xFFE0F800, 0x04205000 }, { 0xFF20FC00, 0x04200000 },
+    { 0xFFE0F000, 0x0420A000 }, { 0xFF20FC00, 0x04208000 }, { 0xFF20FC00, 0x04209000 },
+    { 0xFF20FC00, 0x0420B000 }, { 0xFF20FC00, 0x04204C00 }, { 0xFF20FC00, 0x04204400 },
+    { 0xFF20FC00, 0x04204800 }, { 0xFF20FC00, 0x04204000 }, { 0xFF20FC00, 0x04208C00 },
+    { 0xFF20FC00, 0x04209C00 }, { 0xFF20FC00, 0x04208400 }, { 0xFF20FC00, 0x04209400 },
+    { 0xFF20FC00, 0x04201000 }, { 0xFF20FC00, 0x04201800 }, { 0xFF20FC00, 0x04200400 },
+    { 0xFF20FC00, 0x04201400 }, { 0xFF20FC00, 0x04201C00 }, { 0xFF20FC00, 0x04206000 },
+    { 0xFF20FC00, 0x04206800 }, { 0xFF20FC00, 0x04207000 }, { 0xFF20FC00, 0x04207400 },
+    { 0xFF20FC00, 0x04206C00 }, { 0xFF20FC00, 0x04203400 }, { 0xFF20F000, 0x0420A000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFFFE000, 0x04592000 }, { 0xFFFFE000, 0x04582000 },
+    { 0xFFFFE000, 0x04482000 }, { 0xFFFFE000, 0x044A2000 }, { 0xFFFFE000, 0x04492000 },
+    { 0xFFFFE000, 0x044B2000 }, { 0xFFF0FC00, 0x0450C800 }, { 0xFFF0FC00, 0x0450C000 },
+    { 0xFFF0FC00, 0x0450CC00 }, { 0xFFF0FC00, 0x0450C400 }, { 0xFF3FE000, 0x0416A000 },
+    { 0xFF3FE000, 0x04000000 }, { 0xFF3FE000, 0x041A0000 }, { 0xFF3FE000, 0x041A2000 },
+    { 0xFF3FE000, 0x04108000 }, { 0xFF3FE000, 0x04188000 }, { 0xFF3FE000, 0x04008000 },
+    { 0xFF3FE000, 0x04048000 }, { 0xFF3FE000, 0x04148000 }, { 0xFF3FE000, 0x0418A000 },
+    { 0xFF3FE000, 0x0419A000 }, { 0xFF3FE000, 0x041BA000 }, { 0xFF3FE000, 0x041AA000 },
+    { 0xFF3FE000, 0x04190000 }, { 0xFF3FE000, 0x041CA000 }, { 0xFF3FE000, 0x041DA000 },
+    { 0xFF3FE000, 0x04138000 }, { 0xFF3FE000, 0x041B8000 }, { 0xFF3FE000, 0x04038000 },
+    { 0xFF3FE000, 0x04178000 }, { 0xFF3FE000, 0x04118000 }, { 0xFF3FE000, 0x04198000 },
+    { 0xFF3FE000, 0x04018000 }, { 0xFF3FE000, 0x04158000 }, { 0xFF3FE000, 0x04100000 },
+    { 0xFF3FE000, 0x0417A000 }, { 0xFF3FE000, 0x041EA000 }, { 0xFF3FE000, 0x04180000 },
+    { 0xFF3FE000, 0x040C0000 }, { 0xFF3FE000, 0x04002000 }, { 0xFF3FE000, 0x04140000 },
+    { 0xFF3FE000, 0x04160000 }, { 0xFF3FE000, 0x04080000 }, { 0xFF3FE000, 0x040A0000 },
+    { 0xFF3FE000, 0x04120000 }, { 0xFF3FE000, 0x04010000 }, { 0xFF3FE000, 0x04030000 },
+    { 0xFF3FE000, 0x0410A000 }, { 0xFF3FE000, 0x0412A000 }, { 0xFF3FE000, 0x040D0000 },
+    { 0xFF3FE000, 0x04012000 }, { 0xFF3FE000, 0x04150000 }, { 0xFF3FE000, 0x04170000 },
+    { 0xFF3FE000, 0x04090000 }, { 0xFF3FE000, 0x040B0000 }, { 0xFF3FE000, 0x04130000 },
+    { 0xFF3FE000, 0x0411A000 }, { 0xFF3FE000, 0x0413A000 }, { 0xFF3FE000, 0x04068000 },
+    { 0xFF3FE000, 0x040F8000 }, { 0xFF3FE000, 0x040C8000 }, { 0xFF3FE000, 0x04078000 },
+    { 0xFF3FE000, 0x040D8000 }, { 0xFF3EE000, 0x04102000 }, { 0xFF20E000, 0x0400C000 },
+    { 0xFF20E000, 0x04004000 }, { 0xFF20E000, 0x04006000 }, { 0xFF20E000, 0x0400E000 },
+    { 0x1E000000, 0x04000000 }, { 0xFF3FFC00, 0x0420B800 }, { 0xFFF0FC00, 0x0460E000 },
+    { 0xFFF0FC00, 0x0470E400 }, { 0xFFF0FC00, 0x0470C400 }, { 0xFFF0FC00, 0x0470E000 },
+    { 0xFFF0FC00, 0x0470C000 }, { 0xFFF0FC00, 0x0460F800 }, { 0xFFF0FC00, 0x0470F800 },
+    { 0xFFF0FC00, 0x0460F000 }, { 0xFFF0FC00, 0x0470F000 }, { 0xFFF0FC00, 0x0460FC00 },
+    { 0xFFF0FC00, 0x0470FC00 }, { 0xFFF0FC00, 0x0460F400 }, { 0xFFF0FC00, 0x0470F400 },
+    { 0xFFE0FC00, 0x04603000 }, { 0xFFE0FC00, 0x04603800 }, { 0xFFE0FC00, 0x04603C00 },
+    { 0xFFE0F800, 0x04605000 }, { 0xFF20FC00, 0x04200000 }, { 0xFFE0F000, 0x0460A000 },
+    { 0xFF20FC00, 0x04208000 }, { 0xFF20FC00, 0x04209000 }, { 0xFF20FC00, 0x0420B000 },
+    { 0xFF20FC00, 0x04204C00 }, { 0xFF20FC00, 0x04204400 }, { 0xFF20FC00, 0x04204800 },
+    { 0xFF20FC00, 0x04204000 }, { 0xFF20FC00, 0x04208C00 }, { 0xFF20FC00, 0x04209C00 },
+    { 0xFF20FC00, 0x04208400 }, { 0xFF20FC00, 0x04209400 }, { 0xFF20FC00, 0x04201000 },
+    { 0xFF20FC00, 0x04201800 }, { 0xFF20FC00, 0x04200400 }, { 0xFF20FC00, 0x04201400 },
+    { 0xFF20FC00, 0x04201C00 }, { 0xFF20FC00, 0x04206000 }, { 0xFF20FC00, 0x04206800 },
+    { 0xFF20FC00, 0x04207000 }, { 0xFF20FC00, 0x04207400 }, { 0xFF20FC00, 0x04206C00 },
+    { 0xFF20FC00, 0x04203400 }, { 0xFF20F000, 0x0420A000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFE000, 0x04992000 }, { 0xFFFFE000, 0x04982000 }, { 0xFFFFE000, 0x04882000 },
+    { 0xFFFFE000, 0x048A2000 }, { 0xFFFFE000, 0x04892000 }, { 0xFFFFE000, 0x048B2000 },
+    { 0xFF3FE000, 0x0416A000 }, { 0xFF3FE000, 0x04000000 }, { 0xFF3FE000, 0x041A0000 },
+    { 0xFF3FE000, 0x041A2000 }, { 0xFF3FE000, 0x04108000 }, { 0xFF3FE000, 0x04188000 },
+    { 0xFF3FE000, 0x04008000 }, { 0xFF3FE000, 0x04048000 }, { 0xFF3FE000, 0x04148000 },
+    { 0xFF3FE000, 0x0418A000 }, { 0xFF3FE000, 0x0419A000 }, { 0xFF3FE000, 0x041BA000 },
+    { 0xFF3FE000, 0x041AA000 }, { 0xFF3FE000, 0x04190000 }, { 0xFF3FE000, 0x041CA000 },
+    { 0xFF3FE000, 0x041DA000 }, { 0xFF3FE000, 0x04138000 }, { 0xFF3FE000, 0x041B8000 },
+    { 0xFF3FE000, 0x04038000 }, { 0xFF3FE000, 0x04178000 }, { 0xFF3FE000, 0x04118000 },
+    { 0xFF3FE000, 0x04198000 }, { 0xFF3FE000, 0x04018000 }, { 0xFF3FE000, 0x04158000 },
+    { 0xFF3FE000, 0x04100000 }, { 0xFF3FE000, 0x0417A000 }, { 0xFF3FE000, 0x041EA000 },
+    { 0xFF3FE000, 0x04180000 }, { 0xFF3FE000, 0x040C0000 }, { 0xFF3FE000, 0x04002000 },
+    { 0xFF3FE000, 0x04140000 }, { 0xFF3FE000, 0x04160000 }, { 0xFF3FE000, 0x04080000 },
+    { 0xFF3FE000, 0x040A0000 }, { 0xFF3FE000, 0x04120000 }, { 0xFF3FE000, 0x04010000 },
+    { 0xFF3FE000, 0x04030000 }, { 0xFF3FE000, 0x0410A000 }, { 0xFF3FE000, 0x0412A000 },
+    { 0xFF3FE000, 0x040D0000 }, { 0xFF3FE000, 0x04012000 }, { 0xFF3FE000, 0x04150000 },
+    { 0xFF3FE000, 0x04170000 }, { 0xFF3FE000, 0x04090000 }, { 0xFF3FE000, 0x040B0000 },
+    { 0xFF3FE000, 0x04130000 }, { 0xFF3FE000, 0x0411A000 }, { 0xFF3FE000, 0x0413A000 },
+    { 0xFF3FE000, 0x04068000 }, { 0xFF3FE000, 0x040F8000 }, { 0xFF3FE000, 0x040C8000 },
+    { 0xFF3FE000, 0x04078000 }, { 0xFF3FE000, 0x040D8000 }, { 0xFF3EE000, 0x04102000 },
+    { 0xFF20E000, 0x0400C000 }, { 0xFF20E000, 0x04004000 }, { 0xFF20E000, 0x04006000 },
+    { 0xFF20E000, 0x0400E000 }, { 0x1E000000, 0x04000000 }, { 0xFFFFF800, 0x04BF5000 },
+    { 0xFF3FFC00, 0x0420B800 }, { 0xFFF0FC00, 0x04A0E000 }, { 0xFFF0FC00, 0x04B0E400 },
+    { 0xFFF0FC00, 0x04B0C400 }, { 0xFFF0FC00, 0x04B0E000 }, { 0xFFF0FC00, 0x04B0C000 },
+    { 0xFFF0FC00, 0x04A0F800 }, { 0xFFF0FC00, 0x04B0F800 }, { 0xFFF0FC00, 0x04A0C800 },
+    { 0xFFF0FC00, 0x04A0F000 }, { 0xFFF0FC00, 0x04B0F000 }, { 0xFFF0FC00, 0x04A0C000 },
+    { 0xFFF0FC00, 0x04A0FC00 }, { 0xFFF0FC00, 0x04B0FC00 }, { 0xFFF0FC00, 0x04A0CC00 },
+    { 0xFFF0FC00, 0x04A0F400 }, { 0xFFF0FC00, 0x04B0F400 }, { 0xFFF0FC00, 0x04A0C400 },
+    { 0xFFE0FC00, 0x04A03000 }, { 0xFFE0FC00, 0x04A03C00 }, { 0xFF20FC00, 0x04200000 },
+    { 0xFF20FC00, 0x04208000 }, { 0xFF20FC00, 0x04209000 }, { 0xFF20FC00, 0x0420B000 },
+    { 0xFF20FC00, 0x04204C00 }, { 0xFF20FC00, 0x04204400 }, { 0xFF20FC00, 0x04204800 },
+    { 0xFF20FC00, 0x04204000 }, { 0xFF20FC00, 0x04208C00 }, { 0xFF20FC00, 0x04209C00 },
+    { 0xFF20FC00, 0x04208400 }, { 0xFF20FC00, 0x04209400 }, { 0xFF20FC00, 0x04201000 },
+    { 0xFF20FC00, 0x04201800 }, { 0xFF20FC00, 0x04200400 }, { 0xFF20FC00, 0x04201400 },
+    { 0xFF20FC00, 0x04201C00 }, { 0xFF20FC00, 0x04206000 }, { 0xFF20FC00, 0x04206800 },
+    { 0xFF20FC00, 0x04207000 }, { 0xFF20FC00, 0x04207400 }, { 0xFF20FC00, 0x04206C00 },
+    { 0xFF20FC00, 0x04203400 }, { 0xFF20F000, 0x0420A000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFE000, 0x04D92000 }, { 0xFFFFE000, 0x04D82000 }, { 0xFFFFE000, 0x04C82000 },
+    { 0xFFFFE000, 0x04CA2000 }, { 0xFFFFE000, 0x04D4A000 }, { 0xFFFFE000, 0x04C92000 },
+    { 0xFFFFE000, 0x04CB2000 }, { 0xFFFFE000, 0x04D5A000 }, { 0xFF3FE000, 0x0416A000 },
+    { 0xFF3FE000, 0x04000000 }, { 0xFF3FE000, 0x041A0000 }, { 0xFF3FE000, 0x041A2000 },
+    { 0xFF3FE000, 0x04108000 }, { 0xFF3FE000, 0x04188000 }, { 0xFF3FE000, 0x04008000 },
+    { 0xFF3FE000, 0x04048000 }, { 0xFF3FE000, 0x04148000 }, { 0xFF3FE000, 0x0418A000 },
+    { 0xFF3FE000, 0x0419A000 }, { 0xFF3FE000, 0x041BA000 }, { 0xFF3FE000, 0x041AA000 },
+    { 0xFF3FE000, 0x04190000 }, { 0xFF3FE000, 0x041CA000 }, { 0xFF3FE000, 0x041DA000 },
+    { 0xFF3FE000, 0x04138000 }, { 0xFF3FE000, 0x041B8000 }, { 0xFF3FE000, 0x04038000 },
+    { 0xFF3FE000, 0x04178000 }, { 0xFF3FE000, 0x04118000 }, { 0xFF3FE000, 0x04198000 },
+    { 0xFF3FE000, 0x04018000 }, { 0xFF3FE000, 0x04158000 }, { 0xFF3FE000, 0x04100000 },
+    { 0xFF3FE000, 0x0417A000 }, { 0xFF3FE000, 0x041EA000 }, { 0xFF3FE000, 0x04180000 },
+    { 0xFF3FE000, 0x040C0000 }, { 0xFF3FE000, 0x04002000 }, { 0xFF3FE000, 0x04140000 },
+    { 0xFF3FE000, 0x04160000 }, { 0xFF3FE000, 0x04080000 }, { 0xFF3FE000, 0x040A0000 },
+    { 0xFF3FE000, 0x04120000 }, { 0xFF3FE000, 0x04010000 }, { 0xFF3FE000, 0x04030000 },
+    { 0xFF3FE000, 0x0410A000 }, { 0xFF3FE000, 0x0412A000 }, { 0xFF3FE000, 0x040D0000 },
+    { 0xFF3FE000, 0x04012000 }, { 0xFF3FE000, 0x04150000 }, { 0xFF3FE000, 0x04170000 },
+    { 0xFF3FE000, 0x04090000 }, { 0xFF3FE000, 0x040B0000 }, { 0xFF3FE000, 0x04130000 },
+    { 0xFF3FE000, 0x0411A000 }, { 0xFF3FE000, 0x0413A000 }, { 0xFF3FE000, 0x04068000 },
+    { 0xFF3FE000, 0x040F8000 }, { 0xFF3FE000, 0x040C8000 }, { 0xFF3FE000, 0x04078000 },
+    { 0xFF3FE000, 0x040D8000 }, { 0xFF3EE000, 0x04102000 }, { 0xFF20E000, 0x0400C000 },
+    { 0xFF20E000, 0x04004000 }, { 0xFF20E000, 0x04006000 }, { 0xFF20E000, 0x0400E000 },
+    { 0x1E000000, 0x04000000 }, { 0xFF3FFC00, 0x0420B800 }, { 0xFFF0FC00, 0x04E0E000 },
+    { 0xFFF0FC00, 0x04F0E400 }, { 0xFFF0FC00, 0x04F0C400 }, { 0xFFF0FC00, 0x04F0E000 },
+    { 0xFFF0FC00, 0x04F0C000 }, { 0xFFF0FC00, 0x04E0F800 }, { 0xFFF0FC00, 0x04F0F800 },
+    { 0xFFF0FC00, 0x04E0C800 }, { 0xFFF0FC00, 0x04E0F000 }, { 0xFFF0FC00, 0x04F0F000 },
+    { 0xFFF0FC00, 0x04E0C000 }, { 0xFFF0FC00, 0x04E0FC00 }, { 0xFFF0FC00, 0x04F0FC00 },
+    { 0xFFF0FC00, 0x04E0CC00 }, { 0xFFF0FC00, 0x04E0F400 }, { 0xFFF0FC00, 0x04F0F400 },
+    { 0xFFF0FC00, 0x04E0C400 }, { 0xFFE0FC00, 0x04E03000 }, { 0xFFE0FC00, 0x04E04C00 },
+    { 0xFFE0FC00, 0x04E04400 }, { 0xFFE0FC00, 0x04E04800 }, { 0xFFE0FC00, 0x04E03C00 },
+    { 0xFF20FC00, 0x04200000 }, { 0xFF20FC00, 0x04208000 }, { 0xFF20FC00, 0x04209000 },
+    { 0xFF20FC00, 0x0420B000 }, { 0xFF20FC00, 0x04204C00 }, { 0xFF20FC00, 0x04204400 },
+    { 0xFF20FC00, 0x04204800 }, { 0xFF20FC00, 0x04204000 }, { 0xFF20FC00, 0x04208C00 },
+    { 0xFF20FC00, 0x04209C00 }, { 0xFF20FC00, 0x04208400 }, { 0xFF20FC00, 0x04209400 },
+    { 0xFF20FC00, 0x04201000 }, { 0xFF20FC00, 0x04201800 }, { 0xFF20FC00, 0x04200400 },
+    { 0xFF20FC00, 0x04201400 }, { 0xFF20FC00, 0x04201C00 }, { 0xFF20FC00, 0x04206000 },
+    { 0xFF20FC00, 0x04206800 }, { 0xFF20FC00, 0x04207000 }, { 0xFF20FC00, 0x04207400 },
+    { 0xFF20FC00, 0x04206C00 }, { 0xFF20FC00, 0x04203400 }, { 0xFF20F000, 0x0420A000 },
+    { 0x1E000000, 0x04000000 }, { 0xFF30FFE0, 0x05104000 }, { 0xFFFC0000, 0x05000000 },
+    { 0xFF30E000, 0x0510C000 }, { 0xFF308000, 0x05100000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFFE10, 0x05314000 }, { 0xFFFFFE10, 0x05304000 }, { 0xFFFFFC00, 0x05343800 },
+    { 0xFF3FFE10, 0x05344000 }, { 0xFF3FFC00, 0x05203800 }, { 0xFF3FFC00, 0x05243800 },
+    { 0xFF3FFC00, 0x05383800 }, { 0xFF3FFC00, 0x05313800 }, { 0xFF3FFC00, 0x05303800 },
+    { 0xFF3FFC00, 0x05333800 }, { 0xFF3FFC00, 0x05323800 }, { 0xFFFFE000, 0x052A8000 },
+    { 0xFFFFE000, 0x052B8000 }, { 0xFFFFE000, 0x05208000 }, { 0xFFFFE000, 0x05228000 },
+    { 0xFFFFE000, 0x05238000 }, { 0xFF30FE10, 0x05205000 }, { 0xFF30FE10, 0x05205400 },
+    { 0xFF30FE10, 0x05204800 }, { 0xFF30FE10, 0x05204C00 }, { 0xFF30FE10, 0x05204000 },
+    { 0xFF30FE10, 0x05204400 }, { 0xFF3FE000, 0x0530A000 }, { 0xFF3FE000, 0x05288000 },
+    { 0xFF3FE000, 0x0531A000 }, { 0xFF3FE000, 0x05298000 }, { 0xFF3FC200, 0x05208000 },
+    { 0xFF3FE000, 0x0528A000 }, { 0xFF3FE000, 0x0520A000 }, { 0xFF3FE000, 0x0521A000 },
+    { 0xFF3FE000, 0x05278000 }, { 0xFF3FE000, 0x05248000 }, { 0xFF3FE000, 0x05258000 },
+    { 0xFF3FE000, 0x052C8000 }, { 0xFF3FE000, 0x052D8000 }, { 0xFF20FC00, 0x05202000 },
+    { 0xFF20FC00, 0x05203000 }, { 0xFF20FC00, 0x05207000 }, { 0xFF20FC00, 0x05207400 },
+    { 0xFF20FC00, 0x05206800 }, { 0xFF20FC00, 0x05206C00 }, { 0xFF20FC00, 0x05206000 },
+    { 0xFF20FC00, 0x05206400 }, { 0xFF20FC00, 0x05202800 }, { 0xFF20FC00, 0x05202C00 },
+    { 0xFFE0E000, 0x05200000 }, { 0xFF20C000, 0x0520C000 }, { 0x1E000000, 0x04000000 },
+    { 0xFF30FFE0, 0x05104000 }, { 0xFFFC0000, 0x05400000 }, { 0xFF30E000, 0x0510C000 },
+    { 0xFF308000, 0x05100000 }, { 0x1E000000, 0x04000000 }, { 0xFFFFFC00, 0x05743800 },
+    { 0xFF3FFE10, 0x05344000 }, { 0xFF3FFC00, 0x05203800 }, { 0xFF3FFC00, 0x05243800 },
+    { 0xFF3FFC00, 0x05383800 }, { 0xFF3FFC00, 0x05313800 }, { 0xFF3FFC00, 0x05303800 },
+    { 0xFF3FFC00, 0x05333800 }, { 0xFF3FFC00, 0x05323800 }, { 0xFFFFE000, 0x056A8000 },
+    { 0xFFFFE000, 0x056B8000 }, { 0xFFFFE000, 0x05608000 }, { 0xFFFFE000, 0x05628000 },
+    { 0xFFFFE000, 0x05638000 }, { 0xFF30FE10, 0x05205000 }, { 0xFF30FE10, 0x05205400 },
+    { 0xFF30FE10, 0x05204800 }, { 0xFF30FE10, 0x05204C00 }, { 0xFF30FE10, 0x05204000 },
+    { 0xFF30FE10, 0x05204400 }, { 0xFF3FE000, 0x0530A000 }, { 0xFF3FE000, 0x05288000 },
+    { 0xFF3FE000, 0x0531A000 }, { 0xFF3FE000, 0x05298000 }, { 0xFF3FC200, 0x05208000 },
+    { 0xFF3FE000, 0x0528A000 }, { 0xFF3FE000, 0x0520A000 }, { 0xFF3FE000, 0x0521A000 },
+    { 0xFF3FE000, 0x05278000 }, { 0xFF3FE000, 0x05248000 }, { 0xFF3FE000, 0x05258000 },
+    { 0xFF3FE000, 0x052C8000 }, { 0xFF3FE000, 0x052D8000 }, { 0xFF20FC00, 0x05202000 },
+    { 0xFF20FC00, 0x05203000 }, { 0xFF20FC00, 0x05207000 }, { 0xFF20FC00, 0x05207400 },
+    { 0xFF20FC00, 0x05206800 }, { 0xFF20FC00, 0x05206C00 }, { 0xFF20FC00, 0x05206000 },
+    { 0xFF20FC00, 0x05206400 }, { 0xFF20FC00, 0x05202800 }, { 0xFF20FC00, 0x05202C00 },
+    { 0xFFE0E000, 0x05600000 }, { 0xFF20C000, 0x0520C000 }, { 0x1E000000, 0x04000000 },
+    { 0xFF30FFE0, 0x05104000 }, { 0xFFFC0000, 0x05800000 }, { 0xFF30E000, 0x0510C000 },
+    { 0xFF308000, 0x05100000 }, { 0x1E000000, 0x04000000 }, { 0xFFFFFC00, 0x05B43800 },
+    { 0xFF3FFE10, 0x05344000 }, { 0xFF3FFC00, 0x05203800 }, { 0xFF3FFC00, 0x05243800 },
+    { 0xFF3FFC00, 0x05383800 }, { 0xFF3FFC00, 0x05313800 }, { 0xFF3FFC00, 0x05303800 },
+    { 0xFF3FFC00, 0x05333800 }, { 0xFF3FFC00, 0x05323800 }, { 0xFFFFE000, 0x05AA8000 },
+    { 0xFFFFE000, 0x05AB8000 }, { 0xFFFFE000, 0x05A08000 }, { 0xFFFFE000, 0x05A28000 },
+    { 0xFFFFE000, 0x05A38000 }, { 0xFF30FE10, 0x05205000 }, { 0xFF30FE10, 0x05205400 },
+    { 0xFF30FE10, 0x05204800 }, { 0xFF30FE10, 0x05204C00 }, { 0xFF30FE10, 0x05204000 },
+    { 0xFF30FE10, 0x05204400 }, { 0xFF3FE000, 0x0530A000 }, { 0xFF3FE000, 0x05288000 },
+    { 0xFF3FE000, 0x0531A000 }, { 0xFF3FE000, 0x05298000 }, { 0xFF3FC200, 0x05208000 },
+    { 0xFF3FE000, 0x0528A000 }, { 0xFF3FE000, 0x0520A000 }, { 0xFF3FE000, 0x0521A000 },
+    { 0xFF3FE000, 0x05278000 }, { 0xFF3FE000, 0x05248000 }, { 0xFF3FE000, 0x05258000 },
+    { 0xFF3FE000, 0x052C8000 }, { 0xFFE0FC00, 0x05A01800 }, { 0xFFE0FC00, 0x05A01C00 },
+    { 0xFFE0FC00, 0x05A00800 }, { 0xFFE0FC00, 0x05A00C00 }, { 0xFFE0FC00, 0x05A00000 },
+    { 0xFFE0FC00, 0x05A00400 }, { 0xFF3FE000, 0x052D8000 }, { 0xFF20FC00, 0x05202000 },
+    { 0xFF20FC00, 0x05203000 }, { 0xFF20FC00, 0x05207000 }, { 0xFF20FC00, 0x05207400 },
+    { 0xFF20FC00, 0x05206800 }, { 0xFF20FC00, 0x05206C00 }, { 0xFF20FC00, 0x05206000 },
+    { 0xFF20FC00, 0x05206400 }, { 0xFF20FC00, 0x05202800 }, { 0xFF20FC00, 0x05202C00 },
+    { 0xFF20C000, 0x0520C000 }, { 0x1E000000, 0x04000000 }, { 0xFF30FFE0, 0x05104000 },
+    { 0xFFFC0000, 0x05C00000 }, { 0xFF30E000, 0x0510C000 }, { 0xFF308000, 0x05100000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFFFFC00, 0x05E03800 }, { 0xFFFFFC00, 0x05E43800 },
+    { 0xFFFFFC00, 0x05F43800 }, { 0xFF3FFE10, 0x05344000 }, { 0xFF3FFC00, 0x05203800 },
+    { 0xFF3FFC00, 0x05243800 }, { 0xFF3FFC00, 0x05383800 }, { 0xFF3FFC00, 0x05313800 },
+    { 0xFF3FFC00, 0x05303800 }, { 0xFF3FFC00, 0x05333800 }, { 0xFF3FFC00, 0x05323800 },
+    { 0xFFFFE000, 0x05F0A000 }, { 0xFFFFE000, 0x05EA8000 }, { 0xFFFFE000, 0x05F1A000 },
+    { 0xFFFFE000, 0x05EB8000 }, { 0xFFFFE000, 0x05E8A000 }, { 0xFFFFE000, 0x05E08000 },
+    { 0xFFFFE000, 0x05E0A000 }, { 0xFFFFE000, 0x05E28000 }, { 0xFFFFE000, 0x05E1A000 },
+    { 0xFFFFE000, 0x05E38000 }, { 0xFFFFE000, 0x05E68000 }, { 0xFF30FE10, 0x05205000 },
+    { 0xFF30FE10, 0x05205400 }, { 0xFF30FE10, 0x05204800 }, { 0xFF30FE10, 0x05204C00 },
+    { 0xFF30FE10, 0x05204000 }, { 0xFF30FE10, 0x05204400 }, { 0xFF3FE000, 0x0530A000 },
+    { 0xFF3FE000, 0x05288000 }, { 0xFF3FE000, 0x0531A000 }, { 0xFF3FE000, 0x05298000 },
+    { 0xFF3FC200, 0x05208000 }, { 0xFF3FE000, 0x0528A000 }, { 0xFF3FE000, 0x0520A000 },
+    { 0xFF3FE000, 0x0521A000 }, { 0xFF3FE000, 0x05278000 }, { 0xFF3FE000, 0x05248000 },
+    { 0xFF3FE000, 0x05258000 }, { 0xFF3FE000, 0x052C8000 }, { 0xFF3FE000, 0x052D8000 },
+    { 0xFF20FC00, 0x05202000 }, { 0xFF20FC00, 0x05203000 }, { 0xFF20FC00, 0x05207000 },
+    { 0xFF20FC00, 0x05207400 }, { 0xFF20FC00, 0x05206800 }, { 0xFF20FC00, 0x05206C00 },
+    { 0xFF20FC00, 0x05206000 }, { 0xFF20FC00, 0x05206400 }, { 0xFF20FC00, 0x05202800 },
+    { 0xFF20FC00, 0x05202C00 }, { 0xFF20C000, 0x0520C000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFE0FC00, 0x08207C00 }, { 0xFFE0FC00, 0x0820FC00 }, { 0xFFE0FC00, 0x08607C00 },
+    { 0xFFE0FC00, 0x0860FC00 }, { 0xFFFFFC00, 0x089F7C00 }, { 0xFFE0FC00, 0x08A07C00 },
+    { 0xFFE0FC00, 0x08A0FC00 }, { 0xFFFFFC00, 0x08DF7C00 }, { 0xFFE0FC00, 0x08E07C00 },
+    { 0xFFE0FC00, 0x08E0FC00 }, { 0xFFFFF000, 0x0C007000 }, { 0xFFFFF000, 0x0C00A000 },
+    { 0xFFFFF000, 0x0C006000 }, { 0xFFFFF000, 0x0C002000 }, { 0xFFFFF000, 0x0C008000 },
+    { 0xFFFFF000, 0x0C004000 }, { 0xFFFFF000, 0x0C000000 }, { 0xFFFFF000, 0x0C407000 },
+    { 0xFFFFF000, 0x0C40A000 }, { 0xFFFFF000, 0x0C406000 }, { 0xFFFFF000, 0x0C402000 },
+    { 0xFFFFF000, 0x0C408000 }, { 0xFFFFF000, 0x0C404000 }, { 0xFFFFF000, 0x0C400000 },
+    { 0xFFFFF000, 0x0C9F7000 }, { 0xFFFFF000, 0x0C9FA000 }, { 0xFFFFF000, 0x0C9F6000 },
+    { 0xFFFFF000, 0x0C9F2000 }, { 0xFFFFF000, 0x0C9F8000 }, { 0xFFFFF000, 0x0C9F4000 },
+    { 0xFFFFF000, 0x0C9F0000 }, { 0xFFE0F000, 0x0C807000 }, { 0xFFE0F000, 0x0C80A000 },
+    { 0xFFE0F000, 0x0C806000 }, { 0xFFE0F000, 0x0C802000 }, { 0xFFE0F000, 0x0C808000 },
+    { 0xFFE0F000, 0x0C804000 }, { 0xFFE0F000, 0x0C800000 }, { 0xFFFFF000, 0x0CDF7000 },
+    { 0xFFFFF000, 0x0CDFA000 }, { 0xFFFFF000, 0x0CDF6000 }, { 0xFFFFF000, 0x0CDF2000 },
+    { 0xFFFFF000, 0x0CDF8000 }, { 0xFFFFF000, 0x0CDF4000 }, { 0xFFFFF000, 0x0CDF0000 },
+    { 0xFFE0F000, 0x0CC07000 }, { 0xFFE0F000, 0x0CC0A000 }, { 0xFFE0F000, 0x0CC06000 },
+    { 0xFFE0F000, 0x0CC02000 }, { 0xFFE0F000, 0x0CC08000 }, { 0xFFE0F000, 0x0CC04000 },
+    { 0xFFE0F000, 0x0CC00000 }, { 0xBFFFFC00, 0x0D008400 }, { 0xBFFFFC00, 0x0D00A400 },
+    { 0xBFFFFC00, 0x0D018400 }, { 0xBFFFEC00, 0x0D008000 }, { 0xBFFFEC00, 0x0D00A000 },
+    { 0xBFFFE400, 0x0D004000 }, { 0xBFFFE400, 0x0D006000 }, { 0xBFFFE000, 0x0D000000 },
+    { 0xBFFFE000, 0x0D002000 }, { 0xBFFFFC00, 0x0D208400 }, { 0xBFFFFC00, 0x0D20A400 },
+    { 0xBFFFEC00, 0x0D208000 }, { 0xBFFFEC00, 0x0D20A000 }, { 0xBFFFE400, 0x0D204000 },
+    { 0xBFFFE400, 0x0D206000 }, { 0xBFFFE000, 0x0D200000 }, { 0xBFFFE000, 0x0D202000 },
+    { 0xBFFFFC00, 0x0D408400 }, { 0xBFFFFC00, 0x0D40A400 }, { 0xBFFFFC00, 0x0D418400 },
+    { 0xBFFFEC00, 0x0D408000 }, { 0xFFFFF000, 0x0D40C000 }, { 0xBFFFEC00, 0x0D40A000 },
+    { 0xFFFFF000, 0x0D40E000 }, { 0xBFFFE400, 0x0D404000 }, { 0xBFFFE400, 0x0D406000 },
+    { 0xBFFFE000, 0x0D400000 }, { 0xBFFFE000, 0x0D402000 }, { 0xBFFFFC00, 0x0D608400 },
+    { 0xBFFFFC00, 0x0D60A400 }, { 0xBFFFEC00, 0x0D608000 }, { 0xFFFFF000, 0x0D60C000 },
+    { 0xBFFFEC00, 0x0D60A000 }, { 0xFFFFF000, 0x0D60E000 }, { 0xBFFFE400, 0x0D604000 },
+    { 0xBFFFE400, 0x0D606000 }, { 0xBFFFE000, 0x0D600000 }, { 0xBFFFE000, 0x0D602000 },
+    { 0xBFFFFC00, 0x0D9F8400 }, { 0xBFFFFC00, 0x0D9FA400 }, { 0xBFFFEC00, 0x0D9F8000 },
+    { 0xBFFFEC00, 0x0D9FA000 }, { 0xBFFFE400, 0x0D9F4000 }, { 0xBFFFE400, 0x0D9F6000 },
+    { 0xBFFFE000, 0x0D9F0000 }, { 0xBFFFE000, 0x0D9F2000 }, { 0xBFE0FC00, 0x0D808400 },
+    { 0xBFE0FC00, 0x0D80A400 }, { 0xBFE0EC00, 0x0D808000 }, { 0xBFE0EC00, 0x0D80A000 },
+    { 0xBFE0E400, 0x0D804000 }, { 0xBFE0E400, 0x0D806000 }, { 0xBFE0E000, 0x0D800000 },
+    { 0xBFE0E000, 0x0D802000 }, { 0xBFFFFC00, 0x0DBF8400 }, { 0xBFFFEC00, 0x0DBF8000 },
+    { 0xBFFFE400, 0x0DBF4000 }, { 0xBFFFE000, 0x0DBF0000 }, { 0xBFE0FC00, 0x0DA08400 },
+    { 0xBFE0EC00, 0x0DA08000 }, { 0xBFE0E400, 0x0DA04000 }, { 0xBFE0E000, 0x0DA00000 },
+    { 0xBFFFFC00, 0x0DDF8400 }, { 0xBFFFFC00, 0x0DDFA400 }, { 0xBFFFEC00, 0x0DDF8000 },
+    { 0xFFFFF000, 0x0DDFC000 }, { 0xBFFFEC00, 0x0DDFA000 }, { 0xFFFFF000, 0x0DDFE000 },
+    { 0xBFFFE400, 0x0DDF4000 }, { 0xBFFFE400, 0x0DDF6000 }, { 0xBFFFE000, 0x0DDF0000 },
+    { 0xBFFFE000, 0x0DDF2000 }, { 0xBFE0FC00, 0x0DC08400 }, { 0xBFE0FC00, 0x0DC0A400 },
+    { 0xBFE0EC00, 0x0DC08000 }, { 0xFFE0F000, 0x0DC0C000 }, { 0xBFE0EC00, 0x0DC0A000 },
+    { 0xFFE0F000, 0x0DC0E000 }, { 0xBFE0E400, 0x0DC04000 }, { 0xBFE0E400, 0x0DC06000 },
+    { 0xBFE0E000, 0x0DC00000 }, { 0xBFE0E000, 0x0DC02000 }, { 0xBFFFFC00, 0x0DFF8400 },
+    { 0xBFFFEC00, 0x0DFF8000 }, { 0xFFFFF000, 0x0DFFC000 }, { 0xFFFFF000, 0x0DFFE000 },
+    { 0xBFFFE400, 0x0DFF4000 }, { 0xBFFFE000, 0x0DFF0000 }, { 0xBFE0FC00, 0x0DE08400 },
+    { 0xBFE0EC00, 0x0DE08000 }, { 0xFFE0F000, 0x0DE0C000 }, { 0xFFE0F000, 0x0DE0E000 },
+    { 0xBFE0E400, 0x0DE04000 }, { 0xBFE0E000, 0x0DE00000 }, { 0xFFFFFC00, 0x0E010C00 },
+    { 0xFFFFFC00, 0x0E020C00 }, { 0xFFFFFC00, 0x0E1B0C00 }, { 0xFFE7FC00, 0x0E040400 },
+    { 0xFFE7FC00, 0x0E043C00 }, { 0xFFE3FC00, 0x0E020400 }, { 0xFFE3FC00, 0x0E022C00 },
+    { 0xFFE3FC00, 0x0E023C00 }, { 0xFFE1FC00, 0x0E010400 }, { 0xFFE1FC00, 0x0E012C00 },
+    { 0xFFE1FC00, 0x0E013C00 }, { 0xFFE0FC00, 0x0E000000 }, { 0xFFE0FC00, 0x0E002000 },
+    { 0xFFE0FC00, 0x0E004000 }, { 0xFFE0FC00, 0x0E006000 }, { 0xFFE0FC00, 0x0E001000 },
+    { 0xFFE0FC00, 0x0E003000 }, { 0xFFE0FC00, 0x0E005000 }, { 0xFFE0FC00, 0x0E007000 },
+    { 0xFFE0FC00, 0x0E00F400 }, { 0xFFE0FC00, 0x0E00FC00 }, { 0xFFE0FC00, 0x0E00C400 },
+    { 0xFF20FC00, 0x0E002800 }, { 0xFF20FC00, 0x0E006800 }, { 0xFF20FC00, 0x0E001800 },
+    { 0xFF20FC00, 0x0E005800 }, { 0xFF20FC00, 0x0E003800 }, { 0xFF20FC00, 0x0E007800 },
+    { 0xFFFFFC00, 0x0E31B800 }, { 0xFFFFFC00, 0x0E21C800 }, { 0xFFFFFC00, 0x0E217800 },
+    { 0xFFFFFC00, 0x0E21B800 }, { 0xFFFFFC00, 0x0E216800 }, { 0xFFFFFC00, 0x0E21A800 },
+    { 0xFFFFFC00, 0x0E219800 }, { 0xFFFFFC00, 0x0E218800 }, { 0xFFFFFC00, 0x0E303800 },
+    { 0xFFFFFC00, 0x0E21D800 }, { 0xFFFFFC00, 0x0E30A800 }, { 0xFFFFFC00, 0x0E31A800 },
+    { 0xFFFFFC00, 0x0E30C800 }, { 0xFFFFFC00, 0x0E30F800 }, { 0xFFFFFC00, 0x0E21E800 },
+    { 0xFFFFFC00, 0x0E21F800 }, { 0xFF3FFC00, 0x0E20B800 }, { 0xFF3FFC00, 0x0E204800 },
+    { 0xFF3FFC00, 0x0E208800 }, { 0xFF3FFC00, 0x0E20A800 }, { 0xFF3FFC00, 0x0E205800 },
+    { 0xFF3FFC00, 0x0E201800 }, { 0xFF3FFC00, 0x0E200800 }, { 0xFF3FFC00, 0x0E206800 },
+    { 0xFF3FFC00, 0x0E202800 }, { 0xFF3FFC00, 0x0E207800 }, { 0xFF3FFC00, 0x0E214800 },
+    { 0xFF3FFC00, 0x0E203800 }, { 0xFF3FFC00, 0x0E212800 }, { 0xFFE0FC00, 0x0E201C00 },
+    { 0xFFE0FC00, 0x0E20D400 }, { 0xFFE0FC00, 0x0E20E400 }, { 0xFFE0FC00, 0x0E20F400 },
+    { 0xFFE0FC00, 0x0E20C400 }, { 0xFFE0FC00, 0x0E20CC00 }, { 0xFFE0FC00, 0x0E20DC00 },
+    { 0xFFE0FC00, 0x0E20FC00 }, { 0xFFE0FC00, 0x0E20E000 }, { 0xFFE0FC00, 0x0E20EC00 },
+    { 0xFF20FC00, 0x0E208400 }, { 0xFF20FC00, 0x0E204000 }, { 0xFF20FC00, 0x0E20BC00 },
+    { 0xFF20FC00, 0x0E203C00 }, { 0xFF20FC00, 0x0E203400 }, { 0xFF20FC00, 0x0E208C00 },
+    { 0xFF20FC00, 0x0E209400 }, { 0xFF20FC00, 0x0E209C00 }, { 0xFF20FC00, 0x0E207C00 },
+    { 0xFF20FC00, 0x0E205000 }, { 0xFF20FC00, 0x0E207400 }, { 0xFF20FC00, 0x0E207000 },
+    { 0xFF20FC00, 0x0E200000 }, { 0xFF20FC00, 0x0E201000 }, { 0xFF20FC00, 0x0E200400 },
+    { 0xFF20FC00, 0x0E202400 }, { 0xFF20FC00, 0x0E206400 }, { 0xFF20FC00, 0x0E20A400 },
+    { 0xFF20FC00, 0x0E206C00 }, { 0xFF20FC00, 0x0E20AC00 }, { 0xFF20FC00, 0x0E208000 },
+    { 0xFF20FC00, 0x0E20A000 }, { 0xFF20FC00, 0x0E20C000 }, { 0xFF20FC00, 0x0E200C00 },
+    { 0xFF20FC00, 0x0E209000 }, { 0xFF20FC00, 0x0E20B000 }, { 0xFF20FC00, 0x0E20B400 },
+    { 0xFF20FC00, 0x0E205C00 }, { 0xFF20FC00, 0x0E204C00 }, { 0xFF20FC00, 0x0E202C00 },
+    { 0xFF20FC00, 0x0E201400 }, { 0xFF20FC00, 0x0E205400 }, { 0xFF20FC00, 0x0E204400 },
+    { 0xFF20FC00, 0x0E202000 }, { 0xFF20FC00, 0x0E203000 }, { 0xFF20FC00, 0x0E206000 },
+    { 0xFFE0FC00, 0x0E401400 }, { 0xFFE0FC00, 0x0E402400 }, { 0xFFE0FC00, 0x0E403400 },
+    { 0xFFE0FC00, 0x0E400400 }, { 0xFFE0FC00, 0x0E400C00 }, { 0xFFE0FC00, 0x0E401C00 },
+    { 0xFFE0FC00, 0x0E403C00 }, { 0xFFE0FC00, 0x0E40F400 }, { 0xFFE0FC00, 0x0E40FC00 },
+    { 0xFFE0FC00, 0x0E40C400 }, { 0xFF20FC00, 0x0E002800 }, { 0xFF20FC00, 0x0E006800 },
+    { 0xFF20FC00, 0x0E001800 }, { 0xFF20FC00, 0x0E005800 }, { 0xFF20FC00, 0x0E003800 },
+    { 0xFF20FC00, 0x0E007800 }, { 0xFFFFFC00, 0x0E71B800 }, { 0xFFFFFC00, 0x0E617800 },
+    { 0xFFFFFC00, 0x0E616800 }, { 0xFFFFFC00, 0x0E703800 }, { 0xFFFFFC00, 0x0E70A800 },
+    { 0xFFFFFC00, 0x0E71A800 }, { 0xFFFFFC00, 0x0E79C800 }, { 0xFFFFFC00, 0x0E79B800 },
+    { 0xFFFFFC00, 0x0E79A800 }, { 0xFFFFFC00, 0x0E799800 }, { 0xFFFFFC00, 0x0E798800 },
+    { 0xFFFFFC00, 0x0E79D800 }, { 0xFF3FFC00, 0x0E20B800 }, { 0xFF3FFC00, 0x0E204800 },
+    { 0xFF3FFC00, 0x0E208800 }, { 0xFF3FFC00, 0x0E20A800 }, { 0xFF3FFC00, 0x0E205800 },
+    { 0xFF3FFC00, 0x0E201800 }, { 0xFF3FFC00, 0x0E200800 }, { 0xFF3FFC00, 0x0E206800 },
+    { 0xFF3FFC00, 0x0E202800 }, { 0xFF3FFC00, 0x0E207800 }, { 0xFF3FFC00, 0x0E214800 },
+    { 0xFF3FFC00, 0x0E203800 }, { 0xFF3FFC00, 0x0E212800 }, { 0xFFE0FC00, 0x0E601C00 },
+    { 0xFF20FC00, 0x0E208400 }, { 0xFF20FC00, 0x0E204000 }, { 0xFF20FC00, 0x0E20BC00 },
+    { 0xFF20FC00, 0x0E203C00 }, { 0xFF20FC00, 0x0E203400 }, { 0xFF20FC00, 0x0E208C00 },
+    { 0xFF20FC00, 0x0E209400 }, { 0xFF20FC00, 0x0E209C00 }, { 0xFF20FC00, 0x0E207C00 },
+    { 0xFF20FC00, 0x0E205000 }, { 0xFF20FC00, 0x0E207400 }, { 0xFF20FC00, 0x0E207000 },
+    { 0xFF20FC00, 0x0E200000 }, { 0xFF20FC00, 0x0E201000 }, { 0xFF20FC00, 0x0E200400 },
+    { 0xFF20FC00, 0x0E202400 }, { 0xFF20FC00, 0x0E206400 }, { 0xFF20FC00, 0x0E20A400 },
+    { 0xFF20FC00, 0x0E206C00 }, { 0xFF20FC00, 0x0E20AC00 }, { 0xFF20FC00, 0x0E208000 },
+    { 0xFF20FC00, 0x0E20A000 }, { 0xFF20FC00, 0x0E20C000 }, { 0xFF20FC00, 0x0E200C00 },
+    { 0xFF20FC00, 0x0E209000 }, { 0xFF20FC00, 0x0E20B000 }, { 0xFF20FC00, 0x0E20B400 },
+    { 0xFF20FC00, 0x0E205C00 }, { 0xFF20FC00, 0x0E204C00 }, { 0xFF20FC00, 0x0E202C00 },
+    { 0xFF20FC00, 0x0E201400 }, { 0xFF20FC00, 0x0E205400 }, { 0xFF20FC00, 0x0E204400 },
+    { 0xFF20FC00, 0x0E202000 }, { 0xFF20FC00, 0x0E203000 }, { 0xFF20FC00, 0x0E206000 },
+    { 0xFFE0FC00, 0x0E809400 }, { 0xFFE0FC00, 0x0E809C00 }, { 0xFF20FC00, 0x0E002800 },
+    { 0xFF20FC00, 0x0E006800 }, { 0xFF20FC00, 0x0E001800 }, { 0xFF20FC00, 0x0E005800 },
+    { 0xFF20FC00, 0x0E003800 }, { 0xFF20FC00, 0x0E007800 }, { 0xFFFFFC00, 0x0EA0F800 },
+    { 0xFFFFFC00, 0x0EA0D800 }, { 0xFFFFFC00, 0x0EA0C800 }, { 0xFFFFFC00, 0x0EA0E800 },
+    { 0xFFFFFC00, 0x0EA1A800 }, { 0xFFFFFC00, 0x0EA1B800 }, { 0xFFFFFC00, 0x0EA1D800 },
+    { 0xFFFFFC00, 0x0EA18800 }, { 0xFFFFFC00, 0x0EA19800 }, { 0xFFFFFC00, 0x0EA1C800 },
+    { 0xFFFFFC00, 0x0EA16800 }, { 0xFFFFFC00, 0x0EB0C800 }, { 0xFFFFFC00, 0x0EB0F800 },
+    { 0xFF3FFC00, 0x0E20B800 }, { 0xFF3FFC00, 0x0E204800 }, { 0xFF3FFC00, 0x0E208800 },
+    { 0xFF3FFC00, 0x0E20A800 }, { 0xFF3FFC00, 0x0E205800 }, { 0xFF3FFC00, 0x0E201800 },
+    { 0xFF3FFC00, 0x0E200800 }, { 0xFF3FFC00, 0x0E206800 }, { 0xFF3FFC00, 0x0E202800 },
+    { 0xFF3FFC00, 0x0E207800 }, { 0xFF3FFC00, 0x0E214800 }, { 0xFF3FFC00, 0x0E203800 },
+    { 0xFF3FFC00, 0x0E212800 }, { 0xFFE0FC00, 0x0EA0F400 }, { 0xFFE0FC00, 0x0EA0C400 },
+    { 0xFFE0FC00, 0x0EA0CC00 }, { 0xFFE0FC00, 0x0EA0FC00 }, { 0xFFE0FC00, 0x0EA0D400 },
+    { 0xFFE0FC00, 0x0EA01C00 }, { 0xFFE0FC00, 0x0EA0DC00 }, { 0xFFE0FC00, 0x0EA0EC00 },
+    { 0xFF20FC00, 0x0E208400 }, { 0xFF20FC00, 0x0E204000 }, { 0xFF20FC00, 0x0E20BC00 },
+    { 0xFF20FC00, 0x0E203C00 }, { 0xFF20FC00, 0x0E203400 }, { 0xFF20FC00, 0x0E208C00 },
+    { 0xFF20FC00, 0x0E209400 }, { 0xFF20FC00, 0x0E209C00 }, { 0xFF20FC00, 0x0E207C00 },
+    { 0xFF20FC00, 0x0E205000 }, { 0xFF20FC00, 0x0E207400 }, { 0xFF20FC00, 0x0E207000 },
+    { 0xFF20FC00, 0x0E200000 }, { 0xFF20FC00, 0x0E201000 }, { 0xFF20FC00, 0x0E200400 },
+    { 0xFF20FC00, 0x0E202400 }, { 0xFF20FC00, 0x0E206400 }, { 0xFF20FC00, 0x0E20A400 },
+    { 0xFF20FC00, 0x0E206C00 }, { 0xFF20FC00, 0x0E20AC00 }, { 0xFF20FC00, 0x0E208000 },
+    { 0xFF20FC00, 0x0E20A000 }, { 0xFF20FC00, 0x0E20C000 }, { 0xFF20FC00, 0x0E200C00 },
+    { 0xFF20FC00, 0x0E209000 }, { 0xFF20FC00, 0x0E20B000 }, { 0xFF20FC00, 0x0E20B400 },
+    { 0xFF20FC00, 0x0E205C00 }, { 0xFF20FC00, 0x0E204C00 }, { 0xFF20FC00, 0x0E202C00 },
+    { 0xFF20FC00, 0x0E201400 }, { 0xFF20FC00, 0x0E205400 }, { 0xFF20FC00, 0x0E204400 },
+    { 0xFF20FC00, 0x0E202000 }, { 0xFF20FC00, 0x0E203000 }, { 0xFF20FC00, 0x0E206000 },
+    { 0xFFE0FC00, 0x0EC01C00 }, { 0xFFE0FC00, 0x0EC03400 }, { 0xFFE0FC00, 0x0EC00400 },
+    { 0xFFE0FC00, 0x0EC00C00 }, { 0xFFE0FC00, 0x0EC03C00 }, { 0xFFE0FC00, 0x0EC01400 },
+    { 0xFFE0FC00, 0x0EC0FC00 }, { 0xFF20FC00, 0x0E002800 }, { 0xFF20FC00, 0x0E006800 },
+    { 0xFF20FC00, 0x0E001800 }, { 0xFF20FC00, 0x0E005800 }, { 0xFF20FC00, 0x0E003800 },
+    { 0xFF20FC00, 0x0E007800 }, { 0xFFFFFC00, 0x0EF8F800 }, { 0xFFFFFC00, 0x0EF8D800 },
+    { 0xFFFFFC00, 0x0EF8C800 }, { 0xFFFFFC00, 0x0EF8E800 }, { 0xFFFFFC00, 0x0EF9A800 },
+    { 0xFFFFFC00, 0x0EF9B800 }, { 0xFFFFFC00, 0x0EF9D800 }, { 0xFFFFFC00, 0x0EF98800 },
+    { 0xFFFFFC00, 0x0EF99800 }, { 0xFF3FFC00, 0x0E20B800 }, { 0xFF3FFC00, 0x0E204800 },
+    { 0xFF3FFC00, 0x0E208800 }, { 0xFF3FFC00, 0x0E20A800 }, { 0xFF3FFC00, 0x0E205800 },
+    { 0xFF3FFC00, 0x0E201800 }, { 0xFF3FFC00, 0x0E200800 }, { 0xFF3FFC00, 0x0E206800 },
+    { 0xFF3FFC00, 0x0E202800 }, { 0xFF3FFC00, 0x0E207800 }, { 0xFF3FFC00, 0x0E214800 },
+    { 0xFF3FFC00, 0x0E203800 }, { 0xFF3FFC00, 0x0E212800 }, { 0xFFE0FC00, 0x0EE01C00 },
+    { 0xFFE0FC00, 0x0EE0E000 }, { 0xFF20FC00, 0x0E208400 }, { 0xFF20FC00, 0x0E204000 },
+    { 0xFF20FC00, 0x0E20BC00 }, { 0xFF20FC00, 0x0E203C00 }, { 0xFF20FC00, 0x0E203400 },
+    { 0xFF20FC00, 0x0E208C00 }, { 0xFF20FC00, 0x0E209400 }, { 0xFF20FC00, 0x0E209C00 },
+    { 0xFF20FC00, 0x0E207C00 }, { 0xFF20FC00, 0x0E205000 }, { 0xFF20FC00, 0x0E207400 },
+    { 0xFF20FC00, 0x0E207000 }, { 0xFF20FC00, 0x0E200000 }, { 0xFF20FC00, 0x0E201000 },
+    { 0xFF20FC00, 0x0E200400 }, { 0xFF20FC00, 0x0E202400 }, { 0xFF20FC00, 0x0E206400 },
+    { 0xFF20FC00, 0x0E20A400 }, { 0xFF20FC00, 0x0E206C00 }, { 0xFF20FC00, 0x0E20AC00 },
+    { 0xFF20FC00, 0x0E208000 }, { 0xFF20FC00, 0x0E20A000 }, { 0xFF20FC00, 0x0E20C000 },
+    { 0xFF20FC00, 0x0E200C00 }, { 0xFF20FC00, 0x0E209000 }, { 0xFF20FC00, 0x0E20B000 },
+    { 0xFF20FC00, 0x0E20B400 }, { 0xFF20FC00, 0x0E205C00 }, { 0xFF20FC00, 0x0E204C00 },
+    { 0xFF20FC00, 0x0E202C00 }, { 0xFF20FC00, 0x0E201400 }, { 0xFF20FC00, 0x0E205400 },
+    { 0xFF20FC00, 0x0E204400 }, { 0xFF20FC00, 0x0E202000 }, { 0xFF20FC00, 0x0E203000 },
+    { 0xFF20FC00, 0x0E206000 }, { 0xFFF8FC00, 0x0F00F400 }, { 0xFFF8FC00, 0x0F00FC00 },
+    { 0xFF87FC00, 0x0F00A400 }, { 0xFF80FC00, 0x0F00FC00 }, { 0xFFF80C00, 0x0F000400 },
+    { 0xFF80FC00, 0x0F008C00 }, { 0xFF80FC00, 0x0F00E400 }, { 0xFF80FC00, 0x0F005400 },
+    { 0xFF80FC00, 0x0F008400 }, { 0xFF80FC00, 0x0F009C00 }, { 0xFF80FC00, 0x0F007400 },
+    { 0xFF80FC00, 0x0F009400 }, { 0xFF80FC00, 0x0F002400 }, { 0xFF80FC00, 0x0F003400 },
+    { 0xFF80FC00, 0x0F00A400 }, { 0xFF80FC00, 0x0F000400 }, { 0xFF80FC00, 0x0F001400 },
+    { 0xFFC0F400, 0x0F001000 }, { 0xFFC0F400, 0x0F005000 }, { 0xFFC0F400, 0x0F009000 },
+    { 0xFFC0F400, 0x0F000000 }, { 0xFFC0F400, 0x0F00F000 }, { 0xDFF80C00, 0x0F000400 },
+    { 0xFF87FC00, 0x0F00A400 }, { 0xFF80FC00, 0x0F00FC00 }, { 0xFF80FC00, 0x0F008C00 },
+    { 0xFF80FC00, 0x0F00E400 }, { 0xFF80FC00, 0x0F005400 }, { 0xFF80FC00, 0x0F008400 },
+    { 0xFF80FC00, 0x0F009C00 }, { 0xFF80FC00, 0x0F007400 }, { 0xFF80FC00, 0x0F009400 },
+    { 0xFF80FC00, 0x0F002400 }, { 0xFF80FC00, 0x0F003400 }, { 0xFF80FC00, 0x0F00A400 },
+    { 0xFF80FC00, 0x0F000400 }, { 0xFF80FC00, 0x0F001400 }, { 0xFFC0F400, 0x0F001000 },
+    { 0xFFC0F400, 0x0F005000 }, { 0xFFC0F400, 0x0F009000 }, { 0xFFC0F400, 0x0F000000 },
+    { 0xFFC0F400, 0x0F00F000 }, { 0xFF87FC00, 0x0F00A400 }, { 0xFF80FC00, 0x0F00FC00 },
+    { 0xFFC0F400, 0x0F408000 }, { 0xFF80FC00, 0x0F008C00 }, { 0xFF80FC00, 0x0F00E400 },
+    { 0xFF80FC00, 0x0F005400 }, { 0xFF80FC00, 0x0F008400 }, { 0xFFC0F400, 0x0F402000 },
+    { 0xFFC0F400, 0x0F406000 }, { 0xFFC0F400, 0x0F40A000 }, { 0xFFC0F400, 0x0F40C000 },
+    { 0xFFC0F400, 0x0F40B000 }, { 0xFFC0F400, 0x0F40D000 }, { 0xFF80FC00, 0x0F009C00 },
+    { 0xFF80FC00, 0x0F007400 }, { 0xFF80FC00, 0x0F009400 }, { 0xFF80FC00, 0x0F002400 },
+    { 0xFF80FC00, 0x0F003400 }, { 0xFF80FC00, 0x0F00A400 }, { 0xFF80FC00, 0x0F000400 },
+    { 0xFF80FC00, 0x0F001400 }, { 0xFFC0F400, 0x0F40F000 }, { 0xFFC0F400, 0x0F400000 },
+    { 0xFF87FC00, 0x0F00A400 }, { 0xFF80FC00, 0x0F00FC00 }, { 0xFFC0F400, 0x0F408000 },
+    { 0xFF80FC00, 0x0F008C00 }, { 0xFF80FC00, 0x0F00E400 }, { 0xFF80FC00, 0x0F005400 },
+    { 0xFF80FC00, 0x0F008400 }, { 0xFFC0F400, 0x0F402000 }, { 0xFFC0F400, 0x0F406000 },
+    { 0xFFC0F400, 0x0F40A000 }, { 0xFFC0F400, 0x0F40C000 }, { 0xFFC0F400, 0x0F40B000 },
+    { 0xFFC0F400, 0x0F40D000 }, { 0xFF80FC00, 0x0F009C00 }, { 0xFF80FC00, 0x0F007400 },
+    { 0xFF80FC00, 0x0F009400 }, { 0xFF80FC00, 0x0F002400 }, { 0xFF80FC00, 0x0F003400 },
+    { 0xFF80FC00, 0x0F00A400 }, { 0xFF80FC00, 0x0F000400 }, { 0xFF80FC00, 0x0F001400 },
+    { 0xFFC0F400, 0x0F40F000 }, { 0xFFC0F400, 0x0F400000 }, { 0xFFC0F400, 0x0F801000 },
+    { 0xFFC0F400, 0x0F805000 }, { 0xFFC0F400, 0x0F809000 }, { 0xFFC0F400, 0x0F808000 },
+    { 0xFFC0F400, 0x0F802000 }, { 0xFFC0F400, 0x0F806000 }, { 0xFFC0F400, 0x0F80A000 },
+    { 0xFFC0F400, 0x0F80C000 }, { 0xFFC0F400, 0x0F80B000 }, { 0xFFC0F400, 0x0F80D000 },
+    { 0xFFC0F400, 0x0F80E000 }, { 0xFFC0F400, 0x0F800000 }, { 0xFFC0F400, 0x0F804000 },
+    { 0xFFC0F400, 0x0F80F000 }, { 0xFFC0F400, 0x0F801000 }, { 0xFFC0F400, 0x0F805000 },
+    { 0xFFC0F400, 0x0F809000 }, { 0xFFC0F400, 0x0F808000 }, { 0xFFC0F400, 0x0F802000 },
+    { 0xFFC0F400, 0x0F806000 }, { 0xFFC0F400, 0x0F80A000 }, { 0xFFC0F400, 0x0F80C000 },
+    { 0xFFC0F400, 0x0F80B000 }, { 0xFFC0F400, 0x0F80D000 }, { 0xFFC0F400, 0x0F80E000 },
+    { 0xFFC0F400, 0x0F800000 }, { 0xFFC0F400, 0x0F804000 }, { 0xFFC0F400, 0x0F80F000 },
+    { 0xFFC0F400, 0x0FC0F400 }, { 0xFFC0F400, 0x0FC00000 }, { 0xFFC0F400, 0x0FC0F400 },
+    { 0xFFC0F400, 0x0FC00000 }, { 0xFFFC0000, 0x11C00000 }, { 0xFFFC0000, 0x11C80000 },
+    { 0xFFFC0000, 0x11C40000 }, { 0xFFFC0000, 0x11CC0000 }, { 0xFFE0FC00, 0x19000400 },
+    { 0xFFE0FC00, 0x1900C400 }, { 0xFFE0FC00, 0x19008400 }, { 0xFFE0FC00, 0x19002400 },
+    { 0xFFE0FC00, 0x1900E400 }, { 0xFFE0FC00, 0x1900A400 }, { 0xFFE0FC00, 0x19006400 },
+    { 0xFFE0FC00, 0x19003400 }, { 0xFFE0FC00, 0x1900F400 }, { 0xFFE0FC00, 0x1900B400 },
+    { 0xFFE0FC00, 0x19007400 }, { 0xFFE0FC00, 0x19004400 }, { 0xFFE0FC00, 0x19001400 },
+    { 0xFFE0FC00, 0x1900D400 }, { 0xFFE0FC00, 0x19009400 }, { 0xFFE0FC00, 0x19005400 },
+    { 0xFFE00C00, 0x19000000 }, { 0xFFE0FC00, 0x19200800 }, { 0xFFE0FC00, 0x19200C00 },
+    { 0xFFE0FC00, 0x19209000 }, { 0xFFE0FC00, 0x1920B000 }, { 0xFFE0FC00, 0x1920A000 },
+    { 0xFFE0FC00, 0x19400400 }, { 0xFFE0FC00, 0x1940C400 }, { 0xFFE0FC00, 0x19408400 },
+    { 0xFFE0FC00, 0x19402400 }, { 0xFFE0FC00, 0x1940E400 }, { 0xFFE0FC00, 0x1940A400 },
+    { 0xFFE0FC00, 0x19406400 }, { 0xFFE0FC00, 0x19403400 }, { 0xFFE0FC00, 0x1940F400 },
+    { 0xFFE0FC00, 0x1940B400 }, { 0xFFE0FC00, 0x19407400 }, { 0xFFE0FC00, 0x19404400 },
+    { 0xFFE0FC00, 0x19401400 }, { 0xFFE0FC00, 0x1940D400 }, { 0xFFE0FC00, 0x19409400 },
+    { 0xFFE0FC00, 0x19405400 }, { 0xFFE00C00, 0x19400000 }, { 0xFFE0FC00, 0x19600800 },
+    { 0xFFE0FC00, 0x19600C00 }, { 0xFFE0FC00, 0x19609000 }, { 0xFFE0FC00, 0x1960B000 },
+    { 0xFFE0FC00, 0x1960A000 }, { 0xFFE0FC00, 0x19800400 }, { 0xFFE0FC00, 0x1980C400 },
+    { 0xFFE0FC00, 0x19808400 }, { 0xFFE0FC00, 0x19802400 }, { 0xFFE0FC00, 0x1980E400 },
+    { 0xFFE0FC00, 0x1980A400 }, { 0xFFE0FC00, 0x19806400 }, { 0xFFE0FC00, 0x19803400 },
+    { 0xFFE0FC00, 0x1980F400 }, { 0xFFE0FC00, 0x1980B400 }, { 0xFFE0FC00, 0x19807400 },
+    { 0xFFE0FC00, 0x19804400 }, { 0xFFE0FC00, 0x19801400 }, { 0xFFE0FC00, 0x1980D400 },
+    { 0xFFE0FC00, 0x19809400 }, { 0xFFE0FC00, 0x19805400 }, { 0xFFE00C00, 0x19800000 },
+    { 0xFFE0FC00, 0x19A00800 }, { 0xFFE0FC00, 0x19A00C00 }, { 0xFFE0FC00, 0x19A09000 },
+    { 0xFFE0FC00, 0x19A0B000 }, { 0xFFE0FC00, 0x19A0A000 }, { 0xFFE0FC00, 0x19C08400 },
+    { 0xFFE0FC00, 0x19C04400 }, { 0xFFE0FC00, 0x19C00400 }, { 0xFFE0FC00, 0x19C0A400 },
+    { 0xFFE0FC00, 0x19C06400 }, { 0xFFE0FC00, 0x19C02400 }, { 0xFFE0FC00, 0x19C09400 },
+    { 0xFFE0FC00, 0x19C05400 }, { 0xFFE0FC00, 0x19C01400 }, { 0xFFE0FC00, 0x19C0B400 },
+    { 0xFFE0FC00, 0x19C07400 }, { 0xFFE0FC00, 0x19C03400 }, { 0xFFE00C00, 0x19C00000 },
+    { 0xFFE0FC00, 0x19E00800 }, { 0xFFE0FC00, 0x19E00C00 }, { 0xFFE0FC00, 0x19E09000 },
+    { 0xFFE0FC00, 0x19E0B000 }, { 0xFFE0FC00, 0x19E0A000 }, { 0xFFE0FC00, 0x1AC04000 },
+    { 0xFFE0FC00, 0x1AC04400 }, { 0xFFE0FC00, 0x1AC04800 }, { 0xFFE0FC00, 0x1AC05000 },
+    { 0xFFE0FC00, 0x1AC05400 }, { 0xFFE0FC00, 0x1AC05800 }, { 0xFFE0FC00, 0x1AC06000 },
+    { 0xFFE0FC00, 0x1AC06800 }, { 0xFFE0FC00, 0x1AC06400 }, { 0xFFE0FC00, 0x1AC06C00 },
+    { 0xFF000000, 0x1C000000 }, { 0xFF000000, 0x1C000000 }, { 0xFF000000, 0x1C000000 },
+    { 0xFF000000, 0x1C000000 }, { 0xFF000000, 0x1C000000 }, { 0xFF000000, 0x1C000000 },
+    { 0xFF000000, 0x1C000000 }, { 0xFF000000, 0x1C000000 }, { 0xFFE0FC00, 0x1D000400 },
+    { 0xFFE0FC00, 0x1D00C400 }, { 0xFFE0FC00, 0x1D008400 }, { 0xFFE0FC00, 0x1D002400 },
+    { 0xFFE0FC00, 0x1D00E400 }, { 0xFFE0FC00, 0x1D00A400 }, { 0xFFE0FC00, 0x1D006400 },
+    { 0xFFE0FC00, 0x1D003400 }, { 0xFFE0FC00, 0x1D00F400 }, { 0xFFE0FC00, 0x1D00B400 },
+    { 0xFFE0FC00, 0x1D007400 }, { 0xFFE0FC00, 0x1D004400 }, { 0xFFE0FC00, 0x1D001400 },
+    { 0xFFE0FC00, 0x1D00D400 }, { 0xFFE0FC00, 0x1D009400 }, { 0xFFE0FC00, 0x1D005400 },
+    { 0xFFE00C00, 0x1D000800 }, { 0xFFE0FC00, 0x1D400400 }, { 0xFFE0FC00, 0x1D40C400 },
+    { 0xFFE0FC00, 0x1D408400 }, { 0xFFE0FC00, 0x1D402400 }, { 0xFFE0FC00, 0x1D40E400 },
+    { 0xFFE0FC00, 0x1D40A400 }, { 0xFFE0FC00, 0x1D406400 }, { 0xFFE0FC00, 0x1D403400 },
+    { 0xFFE0FC00, 0x1D40F400 }, { 0xFFE0FC00, 0x1D40B400 }, { 0xFFE0FC00, 0x1D407400 },
+    { 0xFFE0FC00, 0x1D404400 }, { 0xFFE0FC00, 0x1D401400 }, { 0xFFE0FC00, 0x1D40D400 },
+    { 0xFFE0FC00, 0x1D409400 }, { 0xFFE0FC00, 0x1D405400 }, { 0xFFE00C00, 0x1D400800 },
+    { 0xFFE0FC00, 0x1D800400 }, { 0xFFE0FC00, 0x1D80C400 }, { 0xFFE0FC00, 0x1D808400 },
+    { 0xFFE0FC00, 0x1D802400 }, { 0xFFE0FC00, 0x1D80E400 }, { 0xFFE0FC00, 0x1D80A400 },
+    { 0xFFE0FC00, 0x1D806400 }, { 0xFFE0FC00, 0x1D803400 }, { 0xFFE0FC00, 0x1D80F400 },
+    { 0xFFE0FC00, 0x1D80B400 }, { 0xFFE0FC00, 0x1D807400 }, { 0xFFE0FC00, 0x1D804400 },
+    { 0xFFE0FC00, 0x1D801400 }, { 0xFFE0FC00, 0x1D80D400 }, { 0xFFE0FC00, 0x1D809400 },
+    { 0xFFE0FC00, 0x1D805400 }, { 0xFFE00C00, 0x1D800800 }, { 0xFFE0FC00, 0x1DC08400 },
+    { 0xFFE0FC00, 0x1DC04400 }, { 0xFFE0FC00, 0x1DC00400 }, { 0xFFE0FC00, 0x1DC0A400 },
+    { 0xFFE0FC00, 0x1DC06400 }, { 0xFFE0FC00, 0x1DC02400 }, { 0xFFE0FC00, 0x1DC09400 },
+    { 0xFFE0FC00, 0x1DC05400 }, { 0xFFE0FC00, 0x1DC01400 }, { 0xFFE0FC00, 0x1DC0B400 },
+    { 0xFFE0FC00, 0x1DC07400 }, { 0xFFE0FC00, 0x1DC03400 }, { 0xFFE00C00, 0x1DC00800 },
+    { 0xFFFF0000, 0x1E180000 }, { 0xFFFF0000, 0x1E190000 }, { 0xFFFF0000, 0x1E020000 },
+    { 0xFFFF0000, 0x1E030000 }, { 0xFFFFFC1F, 0x1E202008 }, { 0xFFFFFC1F, 0x1E202018 },
+    { 0xFFFFFC00, 0x1E20C000 }, { 0xFFE0FC1F, 0x1E202000 }, { 0xFFE0FC1F, 0x1E202010 },
+    { 0xFFFFFC00, 0x1E23C000 }, { 0xFFFFFC00, 0x1E22C000 }, { 0xFFFFFC00, 0x1E240000 },
+    { 0xFFFFFC00, 0x1E250000 }, { 0xFFFFFC00, 0x1E300000 }, { 0xFFFFFC00, 0x1E310000 },
+    { 0xFFFFFC00, 0x1E200000 }, { 0xFFFFFC00, 0x1E210000 }, { 0xFFFFFC00, 0x1E280000 },
+    { 0xFFFFFC00, 0x1E290000 }, { 0xFFFFFC00, 0x1E380000 }, { 0xFFFFFC00, 0x1E390000 },
+    { 0xFFFFFC00, 0x1E260000 }, { 0xFFFFFC00, 0x1E270000 }, { 0xFFFFFC00, 0x1E204000 },
+    { 0xFFFFFC00, 0x1E214000 }, { 0xFFFFFC00, 0x1E264000 }, { 0xFFFFFC00, 0x1E27C000 },
+    { 0xFFFFFC00, 0x1E254000 }, { 0xFFFFFC00, 0x1E244000 }, { 0xFFFFFC00, 0x1E24C000 },
+    { 0xFFFFFC00, 0x1E274000 }, { 0xFFFFFC00, 0x1E25C000 }, { 0xFFFFFC00, 0x1E220000 },
+    { 0xFFFFFC00, 0x1E230000 }, { 0xFFFFFC00, 0x1E28C000 }, { 0xFFFFFC00, 0x1E284000 },
+    { 0xFFFFFC00, 0x1E29C000 }, { 0xFFFFFC00, 0x1E294000 }, { 0xFFE01FE0, 0x1E201000 },
+    { 0xFFE0FC00, 0x1E202800 }, { 0xFFE0FC00, 0x1E201800 }, { 0xFFE0FC00, 0x1E204800 },
+    { 0xFFE0FC00, 0x1E206800 }, { 0xFFE0FC00, 0x1E205800 }, { 0xFFE0FC00, 0x1E207800 },
+    { 0xFFE0FC00, 0x1E200800 }, { 0xFFE0FC00, 0x1E208800 }, { 0xFFE0FC00, 0x1E203800 },
+    { 0xFFE00C10, 0x1E200400 }, { 0xFFE00C10, 0x1E200410 }, { 0xFFE00C00, 0x1E200C00 },
+    { 0xFFFF0000, 0x1E580000 }, { 0xFFFF0000, 0x1E590000 }, { 0xFFFF0000, 0x1E420000 },
+    { 0xFFFF0000, 0x1E430000 }, { 0xFFFFFC1F, 0x1E602008 }, { 0xFFFFFC1F, 0x1E602018 },
+    { 0xFFFFFC00, 0x1E60C000 }, { 0xFFE0FC1F, 0x1E602000 }, { 0xFFE0FC1F, 0x1E602010 },
+    { 0xFFFFFC00, 0x1E63C000 }, { 0xFFFFFC00, 0x1E624000 }, { 0xFFFFFC00, 0x1E640000 },
+    { 0xFFFFFC00, 0x1E650000 }, { 0xFFFFFC00, 0x1E700000 }, { 0xFFFFFC00, 0x1E710000 },
+    { 0xFFFFFC00, 0x1E600000 }, { 0xFFFFFC00, 0x1E610000 }, { 0xFFFFFC00, 0x1E680000 },
+    { 0xFFFFFC00, 0x1E690000 }, { 0xFFFFFC00, 0x1E780000 }, { 0xFFFFFC00, 0x1E790000 },
+    { 0xFFFFFC00, 0x1E604000 }, { 0xFFFFFC00, 0x1E614000 }, { 0xFFFFFC00, 0x1E664000 },
+    { 0xFFFFFC00, 0x1E67C000 }, { 0xFFFFFC00, 0x1E654000 }, { 0xFFFFFC00, 0x1E644000 },
+    { 0xFFFFFC00, 0x1E64C000 }, { 0xFFFFFC00, 0x1E674000 }, { 0xFFFFFC00, 0x1E65C000 },
+    { 0xFFFFFC00, 0x1E620000 }, { 0xFFFFFC00, 0x1E630000 }, { 0xFFFFFC00, 0x1E634000 },
+    { 0xFFFFFC00, 0x1E68C000 }, { 0xFFFFFC00, 0x1E684000 }, { 0xFFFFFC00, 0x1E69C000 },
+    { 0xFFFFFC00, 0x1E694000 }, { 0xFFFFFC00, 0x1E7E0000 }, { 0xFFE01FE0, 0x1E601000 },
+    { 0xFFE0FC00, 0x1E602800 }, { 0xFFE0FC00, 0x1E601800 }, { 0xFFE0FC00, 0x1E604800 },
+    { 0xFFE0FC00, 0x1E606800 }, { 0xFFE0FC00, 0x1E605800 }, { 0xFFE0FC00, 0x1E607800 },
+    { 0xFFE0FC00, 0x1E600800 }, { 0xFFE0FC00, 0x1E608800 }, { 0xFFE0FC00, 0x1E603800 },
+    { 0xFFE00C10, 0x1E600400 }, { 0xFFE00C10, 0x1E600410 }, { 0xFFE00C00, 0x1E600C00 },
+    { 0xFFFFFC00, 0x1EA1C000 }, { 0xFFFF0000, 0x1ED80000 }, { 0xFFFF0000, 0x1ED90000 },
+    { 0xFFFF0000, 0x1EC20000 }, { 0xFFFF0000, 0x1EC30000 }, { 0xFFFFFC1F, 0x1EE02008 },
+    { 0xFFFFFC1F, 0x1EE02018 }, { 0xFFFFFC00, 0x1EE24000 }, { 0xFFFFFC00, 0x1EE2C000 },
+    { 0xFFFFFC00, 0x1EE1C000 }, { 0xFFFFFC00, 0x1EE0C000 }, { 0xFFE0FC1F, 0x1EE02000 },
+    { 0xFFE0FC1F, 0x1EE02010 }, { 0xFFFFFC00, 0x1EE40000 }, { 0xFFFFFC00, 0x1EE50000 },
+    { 0xFFFFFC00, 0x1EF00000 }, { 0xFFFFFC00, 0x1EF10000 }, { 0xFFFFFC00, 0x1EE00000 },
+    { 0xFFFFFC00, 0x1EE10000 }, { 0xFFFFFC00, 0x1EE80000 }, { 0xFFFFFC00, 0x1EE90000 },
+    { 0xFFFFFC00, 0x1EF80000 }, { 0xFFFFFC00, 0x1EF90000 }, { 0xFFFFFC00, 0x1EE60000 },
+    { 0xFFFFFC00, 0x1EE70000 }, { 0xFFFFFC00, 0x1EE04000 }, { 0xFFFFFC00, 0x1EE14000 },
+    { 0xFFFFFC00, 0x1EE64000 }, { 0xFFFFFC00, 0x1EE7C000 }, { 0xFFFFFC00, 0x1EE54000 },
+    { 0xFFFFFC00, 0x1EE44000 }, { 0xFFFFFC00, 0x1EE4C000 }, { 0xFFFFFC00, 0x1EE74000 },
+    { 0xFFFFFC00, 0x1EE5C000 }, { 0xFFFFFC00, 0x1EE20000 }, { 0xFFFFFC00, 0x1EE30000 },
+    { 0xFFE01FE0, 0x1EE01000 }, { 0xFFE0FC00, 0x1EE02800 }, { 0xFFE0FC00, 0x1EE01800 },
+    { 0xFFE0FC00, 0x1EE04800 }, { 0xFFE0FC00, 0x1EE06800 }, { 0xFFE0FC00, 0x1EE05800 },
+    { 0xFFE0FC00, 0x1EE07800 }, { 0xFFE0FC00, 0x1EE00800 }, { 0xFFE0FC00, 0x1EE08800 },
+    { 0xFFE0FC00, 0x1EE03800 }, { 0xFFE00C10, 0x1EE00400 }, { 0xFFE00C10, 0x1EE00410 },
+    { 0xFFE00C00, 0x1EE00C00 }, { 0xFFE08000, 0x1F000000 }, { 0xFFE08000, 0x1F008000 },
+    { 0xFFE08000, 0x1F200000 }, { 0xFFE08000, 0x1F208000 }, { 0xFFC0F400, 0x1F403000 },
+    { 0xFFC0F400, 0x1F407000 }, { 0xFFE08000, 0x1F400000 }, { 0xFFE08000, 0x1F408000 },
+    { 0xFFC0F400, 0x1F403000 }, { 0xFFC0F400, 0x1F407000 }, { 0xFFE08000, 0x1F600000 },
+    { 0xFFE08000, 0x1F608000 }, { 0xFFC0F400, 0x1F803000 }, { 0xFFC0F400, 0x1F807000 },
+    { 0xFFC0F400, 0x1F803000 }, { 0xFFC0F400, 0x1F807000 }, { 0xFFE08000, 0x1FC00000 },
+    { 0xFFE08000, 0x1FC08000 }, { 0xFFE08000, 0x1FE00000 }, { 0xFFE08000, 0x1FE08000 },
+    { 0xFF20E010, 0x2400A000 }, { 0xFF20E010, 0x24002000 }, { 0xFF20E010, 0x24008010 },
+    { 0xFF20E010, 0x24004010 }, { 0xFF20E010, 0x24008000 }, { 0xFF20E010, 0x24004000 },
+    { 0xFF20E010, 0x24000010 }, { 0xFF20E010, 0x2400C010 }, { 0xFF20E010, 0x24000000 },
+    { 0xFF20E010, 0x2400C000 }, { 0xFF20E010, 0x24006010 }, { 0xFF20E010, 0x2400E000 },
+    { 0xFF20E010, 0x2400E010 }, { 0xFF20E010, 0x24006000 }, { 0xFF20E010, 0x2400A010 },
+    { 0xFF20E010, 0x24002010 }, { 0x1E000000, 0x04000000 }, { 0xFF202010, 0x24200010 },
+    { 0xFF202010, 0x24200000 }, { 0xFF202010, 0x24202000 }, { 0xFF202010, 0x24202010 },
+    { 0x1E000000, 0x04000000 }, { 0xFF20E010, 0x2400A000 }, { 0xFF20E010, 0x24002000 },
+    { 0xFF20E010, 0x24008010 }, { 0xFF20E010, 0x24004010 }, { 0xFF20E010, 0x24008000 },
+    { 0xFF20E010, 0x24004000 }, { 0xFF20E010, 0x24000010 }, { 0xFF20E010, 0x2400C010 },
+    { 0xFF20E010, 0x24000000 }, { 0xFF20E010, 0x2400C000 }, { 0xFF20E010, 0x24006010 },
+    { 0xFF20E010, 0x2400E000 }, { 0xFF20E010, 0x2400E010 }, { 0xFF20E010, 0x24006000 },
+    { 0xFF20E010, 0x2400A010 }, { 0xFF20E010, 0x24002010 }, { 0x1E000000, 0x04000000 },
+    { 0xFF202010, 0x24200010 }, { 0xFF202010, 0x24200000 }, { 0xFF202010, 0x24202000 },
+    { 0xFF202010, 0x24202010 }, { 0x1E000000, 0x04000000 }, { 0xFFF0C210, 0x24804000 },
+    { 0xFF20E010, 0x2400A000 }, { 0xFF20E010, 0x24002000 }, { 0xFF20E010, 0x24008010 },
+    { 0xFF20E010, 0x24004010 }, { 0xFF20E010, 0x24008000 }, { 0xFF20E010, 0x24004000 },
+    { 0xFF20E010, 0x24000010 }, { 0xFF20E010, 0x2400C010 }, { 0xFF20E010, 0x24000000 },
+    { 0xFF20E010, 0x2400C000 }, { 0xFF20E010, 0x24006010 }, { 0xFF20E010, 0x2400E000 },
+    { 0xFF20E010, 0x2400E010 }, { 0xFF20E010, 0x24006000 }, { 0xFF20E010, 0x2400A010 },
+    { 0xFF20E010, 0x24002010 }, { 0x1E000000, 0x04000000 }, { 0xFF202010, 0x24200010 },
+    { 0xFF202010, 0x24200000 }, { 0xFF202010, 0x24202000 }, { 0xFF202010, 0x24202010 },
+    { 0x1E000000, 0x04000000 }, { 0xFF20E010, 0x2400A000 }, { 0xFF20E010, 0x24002000 },
+    { 0xFF20E010, 0x24008010 }, { 0xFF20E010, 0x24004010 }, { 0xFF20E010, 0x24008000 },
+    { 0xFF20E010, 0x24004000 }, { 0xFF20E010, 0x24000010 }, { 0xFF20E010, 0x2400C010 },
+    { 0xFF20E010, 0x24000000 }, { 0xFF20E010, 0x2400C000 }, { 0xFF20E010, 0x24006010 },
+    { 0xFF20E010, 0x2400E000 }, { 0xFF20E010, 0x2400E010 }, { 0xFF20E010, 0x24006000 },
+    { 0xFF20E010, 0x2400A010 }, { 0xFF20E010, 0x24002010 }, { 0x1E000000, 0x04000000 },
+    { 0xFF202010, 0x24200010 }, { 0xFF202010, 0x24200000 }, { 0xFF202010, 0x24202000 },
+    { 0xFF202010, 0x24202010 }, { 0x1E000000, 0x04000000 }, { 0xFFFFFFF0, 0x2518E400 },
+    { 0xFFFFFFF0, 0x2519F000 }, { 0xFFFFFE10, 0x2518F000 }, { 0xFF3FFE10, 0x2519C400 },
+    { 0xFF3FFC10, 0x2518E000 }, { 0xFF3FFC10, 0x2519E000 }, { 0xFFFFC210, 0x25184000 },
+    { 0xFFFFC200, 0x25104000 }, { 0xFFF0C210, 0x25004000 }, { 0xFFF0C210, 0x25004010 },
+    { 0xFFF0C210, 0x2500C000 }, { 0xFFF0C210, 0x2500C010 }, { 0xFFF0C210, 0x25004200 },
+    { 0xFFF0C210, 0x25004210 }, { 0xFF20E010, 0x25008000 }, { 0xFF20E010, 0x25000010 },
+    { 0xFF20E010, 0x25000000 }, { 0xFF20E010, 0x25002010 }, { 0xFF20E010, 0x25002000 },
+    { 0xFF20E010, 0x25008010 }, { 0x1E000000, 0x04000000 }, { 0xFFFFFFFF, 0x252C9000 },
+    { 0xFFFFFE1F, 0x25289000 }, { 0xFF3FFFE0, 0x2538C000 }, { 0xFF3FFE00, 0x252D8800 },
+    { 0xFF3FFE00, 0x252D8000 }, { 0xFF3FFE00, 0x252C8800 }, { 0xFF3FFE00, 0x252C8000 },
+    { 0xFF3FFE00, 0x252A8800 }, { 0xFF3FFE00, 0x252A8C00 }, { 0xFF3FFE00, 0x252A8000 },
+    { 0xFF3FFE00, 0x25288800 }, { 0xFF3FFE00, 0x25288C00 }, { 0xFF3FFE00, 0x25288000 },
+    { 0xFF3FFE00, 0x252B8800 }, { 0xFF3FFE00, 0x252B8C00 }, { 0xFF3FFE00, 0x252B8000 },
+    { 0xFF3FFE00, 0x25298800 }, { 0xFF3FFE00, 0x25298C00 }, { 0xFF3FFE00, 0x25298000 },
+    { 0xFF3FC200, 0x25208000 }, { 0xFF3FE000, 0x2539C000 }, { 0xFF3FE000, 0x2530C000 },
+    { 0xFF3FE000, 0x2528C000 }, { 0xFF3FE000, 0x252AC000 }, { 0xFF3FE000, 0x2529C000 },
+    { 0xFF3FE000, 0x252BC000 }, { 0xFF3FC000, 0x2520C000 }, { 0xFF3FC000, 0x2538C000 },
+    { 0xFF3FC000, 0x2524C000 }, { 0xFF3FC000, 0x2526C000 }, { 0xFF3FC000, 0x2521C000 },
+    { 0xFF3FC000, 0x2523C000 }, { 0xFF3FC000, 0x2525C000 }, { 0xFF3FC000, 0x2527C000 },
+    { 0xFF20FC10, 0x25203010 }, { 0xFF20FC10, 0x25203000 }, { 0xFF20EC10, 0x25200000 },
+    { 0xFF20EC10, 0x25200010 }, { 0xFF20EC10, 0x25200810 }, { 0xFF20EC10, 0x25200800 },
+    { 0xFF20EC10, 0x25200410 }, { 0xFF20EC10, 0x25200C00 }, { 0xFF20EC10, 0x25200C10 },
+    { 0xFF20EC10, 0x25200400 }, { 0x1E000000, 0x04000000 }, { 0xFFFFFE10, 0x2558C000 },
+    { 0xFFFFC21F, 0x2550C000 }, { 0xFFFFFE10, 0x2558F000 }, { 0xFF3FFE10, 0x2519C400 },
+    { 0xFF3FFC10, 0x2518E000 }, { 0xFF3FFC10, 0x2519E000 }, { 0xFFFFC210, 0x25504000 },
+    { 0xFFFFC210, 0x25584000 }, { 0xFFF0C210, 0x25404000 }, { 0xFFF0C210, 0x2540C000 },
+    { 0xFFF0C210, 0x2540C010 }, { 0xFFF0C210, 0x25404200 }, { 0xFF20E010, 0x25008000 },
+    { 0xFF20E010, 0x25000010 }, { 0xFF20E010, 0x25000000 }, { 0xFF20E010, 0x25002010 },
+    { 0xFF20E010, 0x25002000 }, { 0xFF20E010, 0x25008010 }, { 0x1E000000, 0x04000000 },
+    { 0xFF3FFFE0, 0x2538C000 }, { 0xFF3FFE00, 0x252D8800 }, { 0xFF3FFE00, 0x252D8000 },
+    { 0xFF3FFE00, 0x252C8800 }, { 0xFF3FFE00, 0x252C8000 }, { 0xFF3FFE00, 0x252A8800 },
+    { 0xFF3FFE00, 0x252A8C00 }, { 0xFF3FFE00, 0x252A8000 }, { 0xFF3FFE00, 0x25288800 },
+    { 0xFF3FFE00, 0x25288C00 }, { 0xFF3FFE00, 0x25288000 }, { 0xFF3FFE00, 0x252B8800 },
+    { 0xFF3FFE00, 0x252B8C00 }, { 0xFF3FFE00, 0x252B8000 }, { 0xFF3FFE00, 0x25298800 },
+    { 0xFF3FFE00, 0x25298C00 }, { 0xFF3FFE00, 0x25298000 }, { 0xFF3FC200, 0x25208000 },
+    { 0xFF3FE000, 0x2539C000 }, { 0xFF3FE000, 0x2530C000 }, { 0xFF3FE000, 0x2528C000 },
+    { 0xFF3FE000, 0x252AC000 }, { 0xFF3FE000, 0x2529C000 }, { 0xFF3FE000, 0x252BC000 },
+    { 0xFF3FC000, 0x2520C000 }, { 0xFFF0C210, 0x25604010 }, { 0xFF3FC000, 0x2538C000 },
+    { 0xFF3FC000, 0x2524C000 }, { 0xFF3FC000, 0x2526C000 }, { 0xFF3FC000, 0x2521C000 },
+    { 0xFF3FC000, 0x2523C000 }, { 0xFF3FC000, 0x2525C000 }, { 0xFF3FC000, 0x2527C000 },
+    { 0xFF20FC10, 0x25203010 }, { 0xFF20FC10, 0x25203000 }, { 0xFF20EC10, 0x25200000 },
+    { 0xFF20EC10, 0x25200010 }, { 0xFF20EC10, 0x25200810 }, { 0xFF20EC10, 0x25200800 },
+    { 0xFF20EC10, 0x25200410 }, { 0xFF20EC10, 0x25200C00 }, { 0xFF20EC10, 0x25200C10 },
+    { 0xFF20EC10, 0x25200400 }, { 0x1E000000, 0x04000000 }, { 0xFF3FFE10, 0x2519C400 },
+    { 0xFF3FFC10, 0x2518E000 }, { 0xFF3FFC10, 0x2519E000 }, { 0xFFFFC200, 0x25904000 },
+    { 0xFFF0C210, 0x25804000 }, { 0xFFF0C210, 0x25804210 }, { 0xFFF0C210, 0x25804200 },
+    { 0xFFF0C210, 0x25804010 }, { 0xFF20E010, 0x25008000 }, { 0xFF20E010, 0x25000010 },
+    { 0xFF20E010, 0x25000000 }, { 0xFF20E010, 0x25002010 }, { 0xFF20E010, 0x25002000 },
+    { 0xFF20E010, 0x25008010 }, { 0x1E000000, 0x04000000 }, { 0xFF3FFFE0, 0x2538C000 },
+    { 0xFFA0FC1F, 0x25A02000 }, { 0xFFA0FC1F, 0x25A02010 }, { 0xFF3FFE00, 0x252D8800 },
+    { 0xFF3FFE00, 0x252D8000 }, { 0xFF3FFE00, 0x252C8800 }, { 0xFF3FFE00, 0x252C8000 },
+    { 0xFF3FFE00, 0x252A8800 }, { 0xFF3FFE00, 0x252A8C00 }, { 0xFF3FFE00, 0x252A8000 },
+    { 0xFF3FFE00, 0x25288800 }, { 0xFF3FFE00, 0x25288C00 }, { 0xFF3FFE00, 0x25288000 },
+    { 0xFF3FFE00, 0x252B8800 }, { 0xFF3FFE00, 0x252B8C00 }, { 0xFF3FFE00, 0x252B8000 },
+    { 0xFF3FFE00, 0x25298800 }, { 0xFF3FFE00, 0x25298C00 }, { 0xFF3FFE00, 0x25298000 },
+    { 0xFF3FC200, 0x25208000 }, { 0xFF3FE000, 0x2539C000 }, { 0xFF3FE000, 0x2530C000 },
+    { 0xFF3FE000, 0x2528C000 }, { 0xFF3FE000, 0x252AC000 }, { 0xFF3FE000, 0x2529C000 },
+    { 0xFF3FE000, 0x252BC000 }, { 0xFF3FC000, 0x2520C000 }, { 0xFF3FC000, 0x2538C000 },
+    { 0xFF3FC000, 0x2524C000 }, { 0xFF3FC000, 0x2526C000 }, { 0xFF3FC000, 0x2521C000 },
+    { 0xFF3FC000, 0x2523C000 }, { 0xFF3FC000, 0x2525C000 }, { 0xFF3FC000, 0x2527C000 },
+    { 0xFF20FC10, 0x25203010 }, { 0xFF20FC10, 0x25203000 }, { 0xFF20EC10, 0x25200000 },
+    { 0xFF20EC10, 0x25200010 }, { 0xFF20EC10, 0x25200810 }, { 0xFF20EC10, 0x25200800 },
+    { 0xFF20EC10, 0x25200410 }, { 0xFF20EC10, 0x25200C00 }, { 0xFF20EC10, 0x25200C10 },
+    { 0xFF20EC10, 0x25200400 }, { 0x1E000000, 0x04000000 }, { 0xFF3FFE10, 0x2519C400 },
+    { 0xFF3FFC10, 0x2518E000 }, { 0xFF3FFC10, 0x2519E000 }, { 0xFFFFC210, 0x25D04000 },
+    { 0xFFF0C210, 0x25C04000 }, { 0xFFF0C210, 0x25C04210 }, { 0xFFF0C210, 0x25C04200 },
+    { 0xFFF0C210, 0x25C04010 }, { 0xFF20E010, 0x25008000 }, { 0xFF20E010, 0x25000010 },
+    { 0xFF20E010, 0x25000000 }, { 0xFF20E010, 0x25002010 }, { 0xFF20E010, 0x25002000 },
+    { 0xFF20E010, 0x25008010 }, { 0x1E000000, 0x04000000 }, { 0xFF3FFFE0, 0x2538C000 },
+    { 0xFFA0FC1F, 0x25A02000 }, { 0xFFA0FC1F, 0x25A02010 }, { 0xFF3FFE00, 0x252D8800 },
+    { 0xFF3FFE00, 0x252D8000 }, { 0xFF3FFE00, 0x252C8800 }, { 0xFF3FFE00, 0x252C8000 },
+    { 0xFF3FFE00, 0x252A8800 }, { 0xFF3FFE00, 0x252A8C00 }, { 0xFF3FFE00, 0x252A8000 },
+    { 0xFF3FFE00, 0x25288800 }, { 0xFF3FFE00, 0x25288C00 }, { 0xFF3FFE00, 0x25288000 },
+    { 0xFF3FFE00, 0x252B8800 }, { 0xFF3FFE00, 0x252B8C00 }, { 0xFF3FFE00, 0x252B8000 },
+    { 0xFF3FFE00, 0x25298800 }, { 0xFF3FFE00, 0x25298C00 }, { 0xFF3FFE00, 0x25298000 },
+    { 0xFF3FC200, 0x25208000 }, { 0xFF3FE000, 0x2539C000 }, { 0xFF3FE000, 0x2530C000 },
+    { 0xFF3FE000, 0x2528C000 }, { 0xFF3FE000, 0x252AC000 }, { 0xFF3FE000, 0x2529C000 },
+    { 0xFF3FE000, 0x252BC000 }, { 0xFF3FC000, 0x2520C000 }, { 0xFF3FC000, 0x2538C000 },
+    { 0xFF3FC000, 0x2524C000 }, { 0xFF3FC000, 0x2526C000 }, { 0xFF3FC000, 0x2521C000 },
+    { 0xFF3FC000, 0x2523C000 }, { 0xFF3FC000, 0x2525C000 }, { 0xFF3FC000, 0x2527C000 },
+    { 0xFF20FC10, 0x25203010 }, { 0xFF20FC10, 0x25203000 }, { 0xFF20EC10, 0x25200000 },
+    { 0xFF20EC10, 0x25200010 }, { 0xFF20EC10, 0x25200810 }, { 0xFF20EC10, 0x25200800 },
+    { 0xFF20EC10, 0x25200410 }, { 0xFF20EC10, 0x25200C00 }, { 0xFF20EC10, 0x25200C10 },
+    { 0xFF20EC10, 0x25200400 }, { 0x1E000000, 0x04000000 }, { 0xFFC00000, 0x2C000000 },
+    { 0xFE400000, 0x2C000000 }, { 0xFFC00000, 0x2C000000 }, { 0xFE400000, 0x2C000000 },
+    { 0xFFC00000, 0x2C400000 }, { 0xFE400000, 0x2C400000 }, { 0xFFC00000, 0x2C400000 },
+    { 0xFE400000, 0x2C400000 }, { 0xFE400000, 0x2C000000 }, { 0xFE400000, 0x2C000000 },
+    { 0xFE400000, 0x2C400000 }, { 0xFE400000, 0x2C400000 }, { 0xFE400000, 0x2C000000 },
+    { 0xFE400000, 0x2C000000 }, { 0xFE400000, 0x2C400000 }, { 0xFE400000, 0x2C400000 },
+    { 0xFE400000, 0x2C000000 }, { 0xFE400000, 0x2C000000 }, { 0xFE400000, 0x2C400000 },
+    { 0xFE400000, 0x2C400000 }, { 0xFF20FC00, 0x2E008400 }, { 0xFF20FC00, 0x2E008C00 },
+    { 0xFFE0C400, 0x2E000000 }, { 0xFF20EC00, 0x2E00E400 }, { 0xFF20E400, 0x2E00C400 },
+    { 0xFFFFFC00, 0x2E21C800 }, { 0xFFFFFC00, 0x2E21B800 }, { 0xFFFFFC00, 0x2E21A800 },
+    { 0xFFFFFC00, 0x2E216800 }, { 0xFFFFFC00, 0x2E218800 }, { 0xFFFFFC00, 0x2E219800 },
+    { 0xFFFFFC00, 0x2E205800 }, { 0xFFFFFC00, 0x2E213800 }, { 0xFFFFFC00, 0x2E303800 },
+    { 0xFFFFFC00, 0x2E21D800 }, { 0xFFFFFC00, 0x2E30A800 }, { 0xFFFFFC00, 0x2E31A800 },
+    { 0xFFFFFC00, 0x2E217800 }, { 0xFFFFFC00, 0x2E21E800 }, { 0xFFFFFC00, 0x2E21F800 },
+    { 0xFF3FFC00, 0x2E204800 }, { 0xFF3FFC00, 0x2E209800 }, { 0xFF3FFC00, 0x2E208800 },
+    { 0xFF3FFC00, 0x2E20B800 }, { 0xFF3FFC00, 0x2E200800 }, { 0xFF3FFC00, 0x2E207800 },
+    { 0xFF3FFC00, 0x2E206800 }, { 0xFF3FFC00, 0x2E202800 }, { 0xFF3FFC00, 0x2E214800 },
+    { 0xFF3FFC00, 0x2E203800 }, { 0xFFE0FC00, 0x2E201C00 }, { 0xFFE0FC00, 0x2E20EC00 },
+    { 0xFFE0FC00, 0x2E20D400 }, { 0xFFE0FC00, 0x2E20E400 }, { 0xFFE0FC00, 0x2E20FC00 },
+    { 0xFFE0FC00, 0x2E20C400 }, { 0xFFE0FC00, 0x2E20F400 }, { 0xFFE0FC00, 0x2E20DC00 },
+    { 0xFFE0FC00, 0x2E209C00 }, { 0xFFE0FC00, 0x2E20CC00 }, { 0xFF20FC00, 0x2E208C00 },
+    { 0xFF20FC00, 0x2E203400 }, { 0xFF20FC00, 0x2E203C00 }, { 0xFF20FC00, 0x2E209400 },
+    { 0xFF20FC00, 0x2E204000 }, { 0xFF20FC00, 0x2E206000 }, { 0xFF20FC00, 0x2E20B400 },
+    { 0xFF20FC00, 0x2E208400 }, { 0xFF20FC00, 0x2E207C00 }, { 0xFF20FC00, 0x2E205000 },
+    { 0xFF20FC00, 0x2E207400 }, { 0xFF20FC00, 0x2E207000 }, { 0xFF20FC00, 0x2E200000 },
+    { 0xFF20FC00, 0x2E201000 }, { 0xFF20FC00, 0x2E200400 }, { 0xFF20FC00, 0x2E202400 },
+    { 0xFF20FC00, 0x2E206400 }, { 0xFF20FC00, 0x2E20A400 }, { 0xFF20FC00, 0x2E206C00 },
+    { 0xFF20FC00, 0x2E20AC00 }, { 0xFF20FC00, 0x2E208000 }, { 0xFF20FC00, 0x2E20A000 },
+    { 0xFF20FC00, 0x2E20C000 }, { 0xFF20FC00, 0x2E200C00 }, { 0xFF20FC00, 0x2E205C00 },
+    { 0xFF20FC00, 0x2E204C00 }, { 0xFF20FC00, 0x2E202C00 }, { 0xFF20FC00, 0x2E201400 },
+    { 0xFF20FC00, 0x2E205400 }, { 0xFF20FC00, 0x2E204400 }, { 0xFF20FC00, 0x2E202000 },
+    { 0xFF20FC00, 0x2E203000 }, { 0xFFE0FC00, 0x2E40FC00 }, { 0xFFE0FC00, 0x2E402C00 },
+    { 0xFFE0FC00, 0x2E401400 }, { 0xFFE0FC00, 0x2E402400 }, { 0xFFE0FC00, 0x2E403C00 },
+    { 0xFFE0FC00, 0x2E400400 }, { 0xFFE0FC00, 0x2E403400 }, { 0xFFE0FC00, 0x2E401C00 },
+    { 0xFF20FC00, 0x2E008400 }, { 0xFF20FC00, 0x2E008C00 }, { 0xFF20EC00, 0x2E00E400 },
+    { 0xFF20E400, 0x2E00C400 }, { 0xFFFFFC00, 0x2E616800 }, { 0xFFFFFC00, 0x2E605800 },
+    { 0xFFFFFC00, 0x2E613800 }, { 0xFFFFFC00, 0x2E703800 }, { 0xFFFFFC00, 0x2E70A800 },
+    { 0xFFFFFC00, 0x2E71A800 }, { 0xFFFFFC00, 0x2E79C800 }, { 0xFFFFFC00, 0x2E79B800 },
+    { 0xFFFFFC00, 0x2E79A800 }, { 0xFFFFFC00, 0x2E798800 }, { 0xFFFFFC00, 0x2E799800 },
+    { 0xFFFFFC00, 0x2E79D800 }, { 0xFFFFFC00, 0x2E617800 }, { 0xFF3FFC00, 0x2E204800 },
+    { 0xFF3FFC00, 0x2E209800 }, { 0xFF3FFC00, 0x2E208800 }, { 0xFF3FFC00, 0x2E20B800 },
+    { 0xFF3FFC00, 0x2E200800 }, { 0xFF3FFC00, 0x2E207800 }, { 0xFF3FFC00, 0x2E206800 },
+    { 0xFF3FFC00, 0x2E202800 }, { 0xFF3FFC00, 0x2E214800 }, { 0xFF3FFC00, 0x2E203800 },
+    { 0xFF20FC00, 0x2E208C00 }, { 0xFF20FC00, 0x2E203400 }, { 0xFF20FC00, 0x2E203C00 },
+    { 0xFF20FC00, 0x2E209400 }, { 0xFF20FC00, 0x2E204000 }, { 0xFF20FC00, 0x2E206000 },
+    { 0xFF20FC00, 0x2E20B400 }, { 0xFF20FC00, 0x2E208400 }, { 0xFF20FC00, 0x2E207C00 },
+    { 0xFF20FC00, 0x2E205000 }, { 0xFF20FC00, 0x2E207400 }, { 0xFF20FC00, 0x2E207000 },
+    { 0xFF20FC00, 0x2E200000 }, { 0xFF20FC00, 0x2E201000 }, { 0xFF20FC00, 0x2E200400 },
+    { 0xFF20FC00, 0x2E202400 }, { 0xFF20FC00, 0x2E206400 }, { 0xFF20FC00, 0x2E20A400 },
+    { 0xFF20FC00, 0x2E206C00 }, { 0xFF20FC00, 0x2E20AC00 }, { 0xFF20FC00, 0x2E208000 },
+    { 0xFF20FC00, 0x2E20A000 }, { 0xFF20FC00, 0x2E20C000 }, { 0xFF20FC00, 0x2E200C00 },
+    { 0xFF20FC00, 0x2E205C00 }, { 0xFF20FC00, 0x2E204C00 }, { 0xFF20FC00, 0x2E202C00 },
+    { 0xFF20FC00, 0x2E201400 }, { 0xFF20FC00, 0x2E205400 }, { 0xFF20FC00, 0x2E204400 },
+    { 0xFF20FC00, 0x2E202000 }, { 0xFF20FC00, 0x2E203000 }, { 0xFFE0FC00, 0x2E80D400 },
+    { 0xFFE0FC00, 0x2E809400 }, { 0xFF20FC00, 0x2E008400 }, { 0xFF20FC00, 0x2E008C00 },
+    { 0xFF20EC00, 0x2E00E400 }, { 0xFF20E400, 0x2E00C400 }, { 0xFFFFFC00, 0x2EA0C800 },
+    { 0xFFFFFC00, 0x2EA0D800 }, { 0xFFFFFC00, 0x2EA1A800 }, { 0xFFFFFC00, 0x2EA1B800 },
+    { 0xFFFFFC00, 0x2EA0F800 }, { 0xFFFFFC00, 0x2EA19800 }, { 0xFFFFFC00, 0x2EA1D800 },
+    { 0xFFFFFC00, 0x2EA1F800 }, { 0xFFFFFC00, 0x2EA13800 }, { 0xFFFFFC00, 0x2EA1C800 },
+    { 0xFFFFFC00, 0x2EA17800 }, { 0xFF3FFC00, 0x2E204800 }, { 0xFF3FFC00, 0x2E209800 },
+    { 0xFF3FFC00, 0x2E208800 }, { 0xFF3FFC00, 0x2E20B800 }, { 0xFF3FFC00, 0x2E200800 },
+    { 0xFF3FFC00, 0x2E207800 }, { 0xFF3FFC00, 0x2E206800 }, { 0xFF3FFC00, 0x2E202800 },
+    { 0xFF3FFC00, 0x2E214800 }, { 0xFF3FFC00, 0x2E203800 }, { 0xFFE0FC00, 0x2EA0EC00 },
+    { 0xFFE0FC00, 0x2EA0E400 }, { 0xFFE0FC00, 0x2EA0C400 }, { 0xFFE0FC00, 0x2EA0F400 },
+    { 0xFFE0FC00, 0x2EA0DC00 }, { 0xFFE0FC00, 0x2EA0CC00 }, { 0xFFE0FC00, 0x2EA0FC00 },
+    { 0xFF20FC00, 0x2E208C00 }, { 0xFF20FC00, 0x2E203400 }, { 0xFF20FC00, 0x2E203C00 },
+    { 0xFF20FC00, 0x2E209400 }, { 0xFF20FC00, 0x2E204000 }, { 0xFF20FC00, 0x2E206000 },
+    { 0xFF20FC00, 0x2E20B400 }, { 0xFF20FC00, 0x2E208400 }, { 0xFF20FC00, 0x2E207C00 },
+    { 0xFF20FC00, 0x2E205000 }, { 0xFF20FC00, 0x2E207400 }, { 0xFF20FC00, 0x2E207000 },
+    { 0xFF20FC00, 0x2E200000 }, { 0xFF20FC00, 0x2E201000 }, { 0xFF20FC00, 0x2E200400 },
+    { 0xFF20FC00, 0x2E202400 }, { 0xFF20FC00, 0x2E206400 }, { 0xFF20FC00, 0x2E20A400 },
+    { 0xFF20FC00, 0x2E206C00 }, { 0xFF20FC00, 0x2E20AC00 }, { 0xFF20FC00, 0x2E208000 },
+    { 0xFF20FC00, 0x2E20A000 }, { 0xFF20FC00, 0x2E20C000 }, { 0xFF20FC00, 0x2E200C00 },
+    { 0xFF20FC00, 0x2E205C00 }, { 0xFF20FC00, 0x2E204C00 }, { 0xFF20FC00, 0x2E202C00 },
+    { 0xFF20FC00, 0x2E201400 }, { 0xFF20FC00, 0x2E205400 }, { 0xFF20FC00, 0x2E204400 },
+    { 0xFF20FC00, 0x2E202000 }, { 0xFF20FC00, 0x2E203000 }, { 0xFFE0FC00, 0x2EC0FC00 },
+    { 0xFFE0FC00, 0x2EC01C00 }, { 0xFFE0FC00, 0x2EC01400 }, { 0xFFE0FC00, 0x2EC02C00 },
+    { 0xFFE0FC00, 0x2EC02400 }, { 0xFFE0FC00, 0x2EC00400 }, { 0xFFE0FC00, 0x2EC03400 },
+    { 0xFFE0FC00, 0x2EC03C00 }, { 0xFF20FC00, 0x2E008400 }, { 0xFF20FC00, 0x2E008C00 },
+    { 0xFF20EC00, 0x2E00E400 }, { 0xFF20E400, 0x2E00C400 }, { 0xFFFFFC00, 0x2EF8C800 },
+    { 0xFFFFFC00, 0x2EF8D800 }, { 0xFFFFFC00, 0x2EF9A800 }, { 0xFFFFFC00, 0x2EF9B800 },
+    { 0xFFFFFC00, 0x2EF8F800 }, { 0xFFFFFC00, 0x2EF99800 }, { 0xFFFFFC00, 0x2EF9D800 },
+    { 0xFFFFFC00, 0x2EF9F800 }, { 0xFFFFFC00, 0x2EE17800 }, { 0xFF3FFC00, 0x2E204800 },
+    { 0xFF3FFC00, 0x2E209800 }, { 0xFF3FFC00, 0x2E208800 }, { 0xFF3FFC00, 0x2E20B800 },
+    { 0xFF3FFC00, 0x2E200800 }, { 0xFF3FFC00, 0x2E207800 }, { 0xFF3FFC00, 0x2E206800 },
+    { 0xFF3FFC00, 0x2E202800 }, { 0xFF3FFC00, 0x2E214800 }, { 0xFF3FFC00, 0x2E203800 },
+    { 0xFF20FC00, 0x2E208C00 }, { 0xFF20FC00, 0x2E203400 }, { 0xFF20FC00, 0x2E203C00 },
+    { 0xFF20FC00, 0x2E209400 }, { 0xFF20FC00, 0x2E204000 }, { 0xFF20FC00, 0x2E206000 },
+    { 0xFF20FC00, 0x2E20B400 }, { 0xFF20FC00, 0x2E208400 }, { 0xFF20FC00, 0x2E207C00 },
+    { 0xFF20FC00, 0x2E205000 }, { 0xFF20FC00, 0x2E207400 }, { 0xFF20FC00, 0x2E207000 },
+    { 0xFF20FC00, 0x2E200000 }, { 0xFF20FC00, 0x2E201000 }, { 0xFF20FC00, 0x2E200400 },
+    { 0xFF20FC00, 0x2E202400 }, { 0xFF20FC00, 0x2E206400 }, { 0xFF20FC00, 0x2E20A400 },
+    { 0xFF20FC00, 0x2E206C00 }, { 0xFF20FC00, 0x2E20AC00 }, { 0xFF20FC00, 0x2E208000 },
+    { 0xFF20FC00, 0x2E20A000 }, { 0xFF20FC00, 0x2E20C000 }, { 0xFF20FC00, 0x2E200C00 },
+    { 0xFF20FC00, 0x2E205C00 }, { 0xFF20FC00, 0x2E204C00 }, { 0xFF20FC00, 0x2E202C00 },
+    { 0xFF20FC00, 0x2E201400 }, { 0xFF20FC00, 0x2E205400 }, { 0xFF20FC00, 0x2E204400 },
+    { 0xFF20FC00, 0x2E202000 }, { 0xFF20FC00, 0x2E203000 }, { 0xFF87FC00, 0x2F00A400 },
+    { 0xFFF80C00, 0x2F000400 }, { 0xFF80FC00, 0x2F00FC00 }, { 0xFF80FC00, 0x2F005400 },
+    { 0xFF80FC00, 0x2F009C00 }, { 0xFF80FC00, 0x2F006400 }, { 0xFF80FC00, 0x2F008400 },
+    { 0xFF80FC00, 0x2F004400 }, { 0xFF80FC00, 0x2F00E400 }, { 0xFF80FC00, 0x2F007400 },
+    { 0xFF80FC00, 0x2F002400 }, { 0xFF80FC00, 0x2F003400 }, { 0xFF80FC00, 0x2F00A400 },
+    { 0xFF80FC00, 0x2F000400 }, { 0xFF80FC00, 0x2F001400 }, { 0xFFC0F400, 0x2F009000 },
+    { 0xFFC0F400, 0x2F008000 }, { 0xDFF80C00, 0x0F000400 }, { 0xFF87FC00, 0x2F00A400 },
+    { 0xFF80FC00, 0x2F00FC00 }, { 0xFF80FC00, 0x2F005400 }, { 0xFF80FC00, 0x2F009C00 },
+    { 0xFF80FC00, 0x2F006400 }, { 0xFF80FC00, 0x2F008400 }, { 0xFF80FC00, 0x2F004400 },
+    { 0xFF80FC00, 0x2F00E400 }, { 0xFF80FC00, 0x2F007400 }, { 0xFF80FC00, 0x2F002400 },
+    { 0xFF80FC00, 0x2F003400 }, { 0xFF80FC00, 0x2F00A400 }, { 0xFF80FC00, 0x2F000400 },
+    { 0xFF80FC00, 0x2F001400 }, { 0xFFC0F400, 0x2F009000 }, { 0xFFC0F400, 0x2F008000 },
+    { 0xFF87FC00, 0x2F00A400 }, { 0xFF80FC00, 0x2F00FC00 }, { 0xFFC0F400, 0x2F400000 },
+    { 0xFFC0F400, 0x2F404000 }, { 0xFF80FC00, 0x2F005400 }, { 0xFF80FC00, 0x2F009C00 },
+    { 0xFF80FC00, 0x2F006400 }, { 0xFF80FC00, 0x2F008400 }, { 0xFF80FC00, 0x2F004400 },
+    { 0xFF80FC00, 0x2F00E400 }, { 0xFFC0F400, 0x2F402000 }, { 0xFFC0F400, 0x2F406000 },
+    { 0xFFC0F400, 0x2F40A000 }, { 0xFF80FC00, 0x2F007400 }, { 0xFF80FC00, 0x2F002400 },
+    { 0xFF80FC00, 0x2F003400 }, { 0xFF80FC00, 0x2F00A400 }, { 0xFF80FC00, 0x2F000400 },
+    { 0xFF80FC00, 0x2F001400 }, { 0xFFC0F400, 0x2F408000 }, { 0xFFC0F400, 0x2F40D000 },
+    { 0xFFC0F400, 0x2F40F000 }, { 0xFFC09400, 0x2F409000 }, { 0xFF87FC00, 0x2F00A400 },
+    { 0xFFE0FC00, 0x2F601C00 }, { 0xFF80FC00, 0x2F00FC00 }, { 0xFFC0F400, 0x2F400000 },
+    { 0xFFC0F400, 0x2F404000 }, { 0xFF80FC00, 0x2F005400 }, { 0xFF80FC00, 0x2F009C00 },
+    { 0xFF80FC00, 0x2F006400 }, { 0xFF80FC00, 0x2F008400 }, { 0xFF80FC00, 0x2F004400 },
+    { 0xFF80FC00, 0x2F00E400 }, { 0xFFC0F400, 0x2F402000 }, { 0xFFC0F400, 0x2F406000 },
+    { 0xFFC0F400, 0x2F40A000 }, { 0xFF80FC00, 0x2F007400 }, { 0xFF80FC00, 0x2F002400 },
+    { 0xFF80FC00, 0x2F003400 }, { 0xFF80FC00, 0x2F00A400 }, { 0xFF80FC00, 0x2F000400 },
+    { 0xFF80FC00, 0x2F001400 }, { 0xFFC0F400, 0x2F408000 }, { 0xFFC0F400, 0x2F40D000 },
+    { 0xFFC0F400, 0x2F40F000 }, { 0xFFC09400, 0x2F409000 }, { 0xFFC0F400, 0x2F809000 },
+    { 0xFFC0F400, 0x2F800000 }, { 0xFFC0F400, 0x2F804000 }, { 0xFFC0F400, 0x2F802000 },
+    { 0xFFC0F400, 0x2F806000 }, { 0xFFC0F400, 0x2F80A000 }, { 0xFFC0F400, 0x2F80E000 },
+    { 0xFFC0F400, 0x2F808000 }, { 0xFFC0F400, 0x2F80C000 }, { 0xFFC0F400, 0x2F80D000 },
+    { 0xFFC0F400, 0x2F80F000 }, { 0xFFE0FC00, 0x2FA01C00 }, { 0xFFC0F400, 0x2F809000 },
+    { 0xFFC0F400, 0x2F800000 }, { 0xFFC0F400, 0x2F804000 }, { 0xFFC0F400, 0x2F802000 },
+    { 0xFFC0F400, 0x2F806000 }, { 0xFFC0F400, 0x2F80A000 }, { 0xFFC0F400, 0x2F80E000 },
+    { 0xFFC0F400, 0x2F808000 }, { 0xFFC0F400, 0x2F80C000 }, { 0xFFC0F400, 0x2F80D000 },
+    { 0xFFC0F400, 0x2F80F000 }, { 0xFFE0FC00, 0x2FE01C00 }, { 0xFFE0FC1F, 0x3820001F },
+    { 0xFFE0FC1F, 0x3820101F }, { 0xFFE0FC1F, 0x3820201F }, { 0xFFE0FC1F, 0x3820301F },
+    { 0xFFE0FC1F, 0x3820401F }, { 0xFFE0FC1F, 0x3820501F }, { 0xFFE0FC1F, 0x3820601F },
+    { 0xFFE0FC1F, 0x3820701F }, { 0xFFE0FC00, 0x38200000 }, { 0xFFE0FC00, 0x38201000 },
+    { 0xFFE0FC00, 0x38202000 }, { 0xFFE0FC00, 0x38203000 }, { 0xFFE0FC00, 0x38204000 },
+    { 0xFFE0FC00, 0x38205000 }, { 0xFFE0FC00, 0x38206000 }, { 0xFFE0FC00, 0x38207000 },
+    { 0xFFE0FC00, 0x38208000 }, { 0xFFE0FC00, 0x38209000 }, { 0xFFE0FC00, 0x3820B000 },
+    { 0xFFE0FC00, 0x3820A000 }, { 0xFFE0FC1F, 0x3860001F }, { 0xFFE0FC1F, 0x3860101F },
+    { 0xFFE0FC1F, 0x3860201F }, { 0xFFE0FC1F, 0x3860301F }, { 0xFFE0FC1F, 0x3860401F },
+    { 0xFFE0FC1F, 0x3860501F }, { 0xFFE0FC1F, 0x3860601F }, { 0xFFE0FC1F, 0x3860701F },
+    { 0xFFE0FC00, 0x38600000 }, { 0xFFE0FC00, 0x38601000 }, { 0xFFE0FC00, 0x38602000 },
+    { 0xFFE0FC00, 0x38603000 }, { 0xFFE0FC00, 0x38604000 }, { 0xFFE0FC00, 0x38605000 },
+    { 0xFFE0FC00, 0x38606000 }, { 0xFFE0FC00, 0x38607000 }, { 0xFFE0FC00, 0x38608000 },
+    { 0xFFE0FC00, 0x38609000 }, { 0xFFE0FC00, 0x3860B000 }, { 0xFFE0FC00, 0x3860A000 },
+    { 0xFFFFFC00, 0x38BFC000 }, { 0xFFE0FC1F, 0x38A0001F }, { 0xFFE0FC1F, 0x38A0101F },
+    { 0xFFE0FC1F, 0x38A0201F }, { 0xFFE0FC1F, 0x38A0301F }, { 0xFFE0FC1F, 0x38A0401F },
+    { 0xFFE0FC1F, 0x38A0501F }, { 0xFFE0FC1F, 0x38A0601F }, { 0xFFE0FC1F, 0x38A0701F },
+    { 0xFFE0FC00, 0x38A00000 }, { 0xFFE0FC00, 0x38A01000 }, { 0xFFE0FC00, 0x38A02000 },
+    { 0xFFE0FC00, 0x38A03000 }, { 0xFFE0FC00, 0x38A04000 }, { 0xFFE0FC00, 0x38A05000 },
+    { 0xFFE0FC00, 0x38A06000 }, { 0xFFE0FC00, 0x38A07000 }, { 0xFFE0FC00, 0x38A08000 },
+    { 0xFFE0FC00, 0x38A09000 }, { 0xFFE0FC00, 0x38A0B000 }, { 0xFFE0FC00, 0x38A0A000 },
+    { 0xFFE0FC1F, 0x38E0001F }, { 0xFFE0FC1F, 0x38E0101F }, { 0xFFE0FC1F, 0x38E0201F },
+    { 0xFFE0FC1F, 0x38E0301F }, { 0xFFE0FC1F, 0x38E0401F }, { 0xFFE0FC1F, 0x38E0501F },
+    { 0xFFE0FC1F, 0x38E0601F }, { 0xFFE0FC1F, 0x38E0701F }, { 0xFFE0FC00, 0x38E00000 },
+    { 0xFFE0FC00, 0x38E01000 }, { 0xFFE0FC00, 0x38E02000 }, { 0xFFE0FC00, 0x38E03000 },
+    { 0xFFE0FC00, 0x38E04000 }, { 0xFFE0FC00, 0x38E05000 }, { 0xFFE0FC00, 0x38E06000 },
+    { 0xFFE0FC00, 0x38E07000 }, { 0xFFE0FC00, 0x38E08000 }, { 0xFFE0FC00, 0x38E09000 },
+    { 0xFFE0FC00, 0x38E0B000 }, { 0xFFE0FC00, 0x38E0A000 }, { 0xFFFFFC1F, 0x3A00480D },
+    { 0xFFFFFC1F, 0x3A00080D }, { 0xFFE00C00, 0x3C000C00 }, { 0xFFE00C00, 0x3C000400 },
+    { 0xFFE00C00, 0x3C000000 }, { 0xFFE00C00, 0x3C200800 }, { 0xFFE00C00, 0x3C400C00 },
+    { 0xFFE00C00, 0x3C400400 }, { 0xFFE00C00, 0x3C400000 }, { 0xFFE00C00, 0x3C600800 },
+    { 0xFFE00C00, 0x3C800C00 }, { 0xFFE00C00, 0x3C800400 }, { 0xFFE00C00, 0x3C800000 },
+    { 0xFFE00C00, 0x3CA00800 }, { 0xFFE00C00, 0x3CC00C00 }, { 0xFFE00C00, 0x3CC00400 },
+    { 0xFFE00C00, 0x3CC00000 }, { 0xFFE00C00, 0x3CE00800 }, { 0xFFC00000, 0x3D000000 },
+    { 0xFFC00000, 0x3D000000 }, { 0xFFC00000, 0x3D400000 }, { 0xFFC00000, 0x3D400000 },
+    { 0xFFC00000, 0x3D800000 }, { 0xFFC00000, 0x3D800000 }, { 0xFFC00000, 0x3DC00000 },
+    { 0xFFC00000, 0x3DC00000 }, { 0xFF3FE000, 0x4411A000 }, { 0xFF3FE000, 0x4404A000 },
+    { 0xFF3FE000, 0x44108000 }, { 0xFF3FE000, 0x44128000 }, { 0xFF3FE000, 0x44168000 },
+    { 0xFF3FE000, 0x4414A000 }, { 0xFF3FE000, 0x4416A000 }, { 0xFF3FE000, 0x4408A000 },
+    { 0xFF3FE000, 0x44188000 }, { 0xFF3FE000, 0x4409A000 }, { 0xFF3FE000, 0x440A8000 },
+    { 0xFF3FE000, 0x440E8000 }, { 0xFF3FE000, 0x44088000 }, { 0xFF3FE000, 0x440C8000 },
+    { 0xFF3FE000, 0x441A8000 }, { 0xFF3FE000, 0x441E8000 }, { 0xFF3FE000, 0x44148000 },
+    { 0xFF3FE000, 0x44028000 }, { 0xFF3FE000, 0x44068000 }, { 0xFF3FE000, 0x441C8000 },
+    { 0xFF3FE000, 0x4405A000 }, { 0xFF3FE000, 0x44118000 }, { 0xFF3FE000, 0x44138000 },
+    { 0xFF3FE000, 0x44178000 }, { 0xFF3FE000, 0x4415A000 }, { 0xFF3FE000, 0x4417A000 },
+    { 0xFF3FE000, 0x44198000 }, { 0xFF3FE000, 0x440B8000 }, { 0xFF3FE000, 0x440F8000 },
+    { 0xFF3FE000, 0x44098000 }, { 0xFF3FE000, 0x440D8000 }, { 0xFF3FE000, 0x441B8000 },
+    { 0xFF3FE000, 0x441F8000 }, { 0xFF3FE000, 0x44158000 }, { 0xFF3FE000, 0x44038000 },
+    { 0xFF3FE000, 0x44078000 }, { 0xFF3FE000, 0x441D8000 }, { 0xFF20FC00, 0x44000000 },
+    { 0xFF20FC00, 0x44000400 }, { 0xFF20FC00, 0x44004000 }, { 0xFF20FC00, 0x44004400 },
+    { 0xFF20FC00, 0x44005000 }, { 0xFF20FC00, 0x44005400 }, { 0xFF20FC00, 0x44006000 },
+    { 0xFF20FC00, 0x44000800 }, { 0xFF20FC00, 0x44006400 }, { 0xFF20FC00, 0x44006800 },
+    { 0xFF20FC00, 0x44000C00 }, { 0xFF20FC00, 0x44006C00 }, { 0xFF20FC00, 0x44007000 },
+    { 0xFF20FC00, 0x44007400 }, { 0xFF20FC00, 0x44004800 }, { 0xFF20FC00, 0x44004C00 },
+    { 0xFF20FC00, 0x44005800 }, { 0xFF20FC00, 0x44005C00 }, { 0xFF20F000, 0x44001000 },
+    { 0xFF20F000, 0x44002000 }, { 0xFF20F000, 0x44003000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFA0FC00, 0x44200800 }, { 0xFFA0FC00, 0x44200C00 }, { 0xFFA0FC00, 0x4420F800 },
+    { 0xFFA0FC00, 0x4420F000 }, { 0xFFA0FC00, 0x44201000 }, { 0xFFA0FC00, 0x44201400 },
+    { 0xFFA0FC00, 0x4420F400 }, { 0x1E000000, 0x04000000 }, { 0xFF3FE000, 0x4411A000 },
+    { 0xFF3FE000, 0x4404A000 }, { 0xFF3FE000, 0x44108000 }, { 0xFF3FE000, 0x44128000 },
+    { 0xFF3FE000, 0x44168000 }, { 0xFF3FE000, 0x4414A000 }, { 0xFF3FE000, 0x4416A000 },
+    { 0xFF3FE000, 0x4408A000 }, { 0xFF3FE000, 0x44188000 }, { 0xFF3FE000, 0x4409A000 },
+    { 0xFF3FE000, 0x440A8000 }, { 0xFF3FE000, 0x440E8000 }, { 0xFF3FE000, 0x44088000 },
+    { 0xFF3FE000, 0x440C8000 }, { 0xFF3FE000, 0x441A8000 }, { 0xFF3FE000, 0x441E8000 },
+    { 0xFF3FE000, 0x44148000 }, { 0xFF3FE000, 0x44028000 }, { 0xFF3FE000, 0x44068000 },
+    { 0xFF3FE000, 0x441C8000 }, { 0xFF3FE000, 0x4405A000 }, { 0xFF3FE000, 0x44118000 },
+    { 0xFF3FE000, 0x44138000 }, { 0xFF3FE000, 0x44178000 }, { 0xFF3FE000, 0x4415A000 },
+    { 0xFF3FE000, 0x4417A000 }, { 0xFF3FE000, 0x44198000 }, { 0xFF3FE000, 0x440B8000 },
+    { 0xFF3FE000, 0x440F8000 }, { 0xFF3FE000, 0x44098000 }, { 0xFF3FE000, 0x440D8000 },
+    { 0xFF3FE000, 0x441B8000 }, { 0xFF3FE000, 0x441F8000 }, { 0xFF3FE000, 0x44158000 },
+    { 0xFF3FE000, 0x44038000 }, { 0xFF3FE000, 0x44078000 }, { 0xFF3FE000, 0x441D8000 },
+    { 0xFF20FC00, 0x44000000 }, { 0xFF20FC00, 0x44000400 }, { 0xFF20FC00, 0x44004000 },
+    { 0xFF20FC00, 0x44004400 }, { 0xFF20FC00, 0x44005000 }, { 0xFF20FC00, 0x44005400 },
+    { 0xFF20FC00, 0x44006000 }, { 0xFF20FC00, 0x44000800 }, { 0xFF20FC00, 0x44006400 },
+    { 0xFF20FC00, 0x44006800 }, { 0xFF20FC00, 0x44000C00 }, { 0xFF20FC00, 0x44006C00 },
+    { 0xFF20FC00, 0x44007000 }, { 0xFF20FC00, 0x44007400 }, { 0xFF20FC00, 0x44004800 },
+    { 0xFF20FC00, 0x44004C00 }, { 0xFF20FC00, 0x44005800 }, { 0xFF20FC00, 0x44005C00 },
+    { 0xFF20F000, 0x44001000 }, { 0xFF20F000, 0x44002000 }, { 0xFF20F000, 0x44003000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFA0FC00, 0x44200800 }, { 0xFFA0FC00, 0x44200C00 },
+    { 0xFFA0FC00, 0x4420F800 }, { 0xFFA0FC00, 0x4420F000 }, { 0xFFA0FC00, 0x44201000 },
+    { 0xFFA0FC00, 0x44201400 }, { 0xFFA0FC00, 0x4420F400 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFE000, 0x4480A000 }, { 0xFFFFE000, 0x4481A000 }, { 0xFF3FE000, 0x4411A000 },
+    { 0xFFE0FC00, 0x44807800 }, { 0xFF3FE000, 0x4404A000 }, { 0xFF3FE000, 0x44108000 },
+    { 0xFF3FE000, 0x44128000 }, { 0xFF3FE000, 0x44168000 }, { 0xFF3FE000, 0x4414A000 },
+    { 0xFF3FE000, 0x4416A000 }, { 0xFF3FE000, 0x4408A000 }, { 0xFF3FE000, 0x44188000 },
+    { 0xFF3FE000, 0x4409A000 }, { 0xFF3FE000, 0x440A8000 }, { 0xFF3FE000, 0x440E8000 },
+    { 0xFF3FE000, 0x44088000 }, { 0xFF3FE000, 0x440C8000 }, { 0xFF3FE000, 0x441A8000 },
+    { 0xFF3FE000, 0x441E8000 }, { 0xFF3FE000, 0x44148000 }, { 0xFF3FE000, 0x44028000 },
+    { 0xFF3FE000, 0x44068000 }, { 0xFF3FE000, 0x441C8000 }, { 0xFF3FE000, 0x4405A000 },
+    { 0xFF3FE000, 0x44118000 }, { 0xFF3FE000, 0x44138000 }, { 0xFF3FE000, 0x44178000 },
+    { 0xFF3FE000, 0x4415A000 }, { 0xFF3FE000, 0x4417A000 }, { 0xFF3FE000, 0x44198000 },
+    { 0xFF3FE000, 0x440B8000 }, { 0xFF3FE000, 0x440F8000 }, { 0xFF3FE000, 0x44098000 },
+    { 0xFF3FE000, 0x440D8000 }, { 0xFF3FE000, 0x441B8000 }, { 0xFF3FE000, 0x441F8000 },
+    { 0xFF3FE000, 0x44158000 }, { 0xFF3FE000, 0x44038000 }, { 0xFF3FE000, 0x44078000 },
+    { 0xFF3FE000, 0x441D8000 }, { 0xFF20FC00, 0x44000000 }, { 0xFF20FC00, 0x44000400 },
+    { 0xFF20FC00, 0x44004000 }, { 0xFF20FC00, 0x44004400 }, { 0xFF20FC00, 0x44005000 },
+    { 0xFF20FC00, 0x44005400 }, { 0xFF20FC00, 0x44006000 }, { 0xFF20FC00, 0x44000800 },
+    { 0xFF20FC00, 0x44006400 }, { 0xFF20FC00, 0x44006800 }, { 0xFF20FC00, 0x44000C00 },
+    { 0xFF20FC00, 0x44006C00 }, { 0xFF20FC00, 0x44007000 }, { 0xFF20FC00, 0x44007400 },
+    { 0xFF20FC00, 0x44004800 }, { 0xFF20FC00, 0x44004C00 }, { 0xFF20FC00, 0x44005800 },
+    { 0xFF20FC00, 0x44005C00 }, { 0xFF20F000, 0x44001000 }, { 0xFF20F000, 0x44002000 },
+    { 0xFF20F000, 0x44003000 }, { 0x1E000000, 0x04000000 }, { 0xFFE0FC00, 0x44A00000 },
+    { 0xFFE0FC00, 0x44A00400 }, { 0xFFE0FC00, 0x44A01C00 }, { 0xFFE0FC00, 0x44A01800 },
+    { 0xFFE0FC00, 0x44A00800 }, { 0xFFE0FC00, 0x44A00C00 }, { 0xFFE0FC00, 0x44A0F800 },
+    { 0xFFE0FC00, 0x44A0F000 }, { 0xFFE0FC00, 0x44A01000 }, { 0xFFE0FC00, 0x44A01400 },
+    { 0xFFE0FC00, 0x44A0F400 }, { 0xFFE0F400, 0x44A08000 }, { 0xFFE0F400, 0x44A08400 },
+    { 0xFFE0F400, 0x44A0A000 }, { 0xFFE0F400, 0x44A0A400 }, { 0xFFE0F400, 0x44A0C000 },
+    { 0xFFE0F400, 0x44A0C400 }, { 0xFFE0F400, 0x44A02000 }, { 0xFFE0F400, 0x44A02400 },
+    { 0xFFE0F400, 0x44A03000 }, { 0xFFE0F400, 0x44A03400 }, { 0xFFE0F400, 0x44A0E000 },
+    { 0xFFE0F400, 0x44A0E400 }, { 0xFFE0F400, 0x44A09000 }, { 0xFFE0F400, 0x44A09400 },
+    { 0xFFE0F400, 0x44A0B000 }, { 0xFFE0F400, 0x44A0B400 }, { 0xFFE0F400, 0x44A0D000 },
+    { 0xFFE0F400, 0x44A0D400 }, { 0xFFE0F000, 0x44A04000 }, { 0xFFE0F000, 0x44A06000 },
+    { 0xFFE0F000, 0x44A07000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FE000, 0x4411A000 },
+    { 0xFF3FE000, 0x4404A000 }, { 0xFF3FE000, 0x44108000 }, { 0xFF3FE000, 0x44128000 },
+    { 0xFF3FE000, 0x44168000 }, { 0xFF3FE000, 0x4414A000 }, { 0xFF3FE000, 0x4416A000 },
+    { 0xFF3FE000, 0x4408A000 }, { 0xFF3FE000, 0x44188000 }, { 0xFF3FE000, 0x4409A000 },
+    { 0xFF3FE000, 0x440A8000 }, { 0xFF3FE000, 0x440E8000 }, { 0xFF3FE000, 0x44088000 },
+    { 0xFF3FE000, 0x440C8000 }, { 0xFF3FE000, 0x441A8000 }, { 0xFF3FE000, 0x441E8000 },
+    { 0xFF3FE000, 0x44148000 }, { 0xFF3FE000, 0x44028000 }, { 0xFF3FE000, 0x44068000 },
+    { 0xFF3FE000, 0x441C8000 }, { 0xFF3FE000, 0x4405A000 }, { 0xFF3FE000, 0x44118000 },
+    { 0xFF3FE000, 0x44138000 }, { 0xFF3FE000, 0x44178000 }, { 0xFF3FE000, 0x4415A000 },
+    { 0xFF3FE000, 0x4417A000 }, { 0xFF3FE000, 0x44198000 }, { 0xFF3FE000, 0x440B8000 },
+    { 0xFF3FE000, 0x440F8000 }, { 0xFF3FE000, 0x44098000 }, { 0xFF3FE000, 0x440D8000 },
+    { 0xFF3FE000, 0x441B8000 }, { 0xFF3FE000, 0x441F8000 }, { 0xFF3FE000, 0x44158000 },
+    { 0xFF3FE000, 0x44038000 }, { 0xFF3FE000, 0x44078000 }, { 0xFF3FE000, 0x441D8000 },
+    { 0xFF20FC00, 0x44000000 }, { 0xFF20FC00, 0x44000400 }, { 0xFF20FC00, 0x44004000 },
+    { 0xFF20FC00, 0x44004400 }, { 0xFF20FC00, 0x44005000 }, { 0xFF20FC00, 0x44005400 },
+    { 0xFF20FC00, 0x44006000 }, { 0xFF20FC00, 0x44000800 }, { 0xFF20FC00, 0x44006400 },
+    { 0xFF20FC00, 0x44006800 }, { 0xFF20FC00, 0x44000C00 }, { 0xFF20FC00, 0x44006C00 },
+    { 0xFF20FC00, 0x44007000 }, { 0xFF20FC00, 0x44007400 }, { 0xFF20FC00, 0x44004800 },
+    { 0xFF20FC00, 0x44004C00 }, { 0xFF20FC00, 0x44005800 }, { 0xFF20FC00, 0x44005C00 },
+    { 0xFF20F000, 0x44001000 }, { 0xFF20F000, 0x44002000 }, { 0xFF20F000, 0x44003000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFE0FC00, 0x44E00000 }, { 0xFFE0FC00, 0x44E00400 },
+    { 0xFFE0FC00, 0x44E00800 }, { 0xFFE0FC00, 0x44E00C00 }, { 0xFFE0FC00, 0x44E0F800 },
+    { 0xFFE0FC00, 0x44E0F000 }, { 0xFFE0FC00, 0x44E01000 }, { 0xFFE0FC00, 0x44E01400 },
+    { 0xFFE0FC00, 0x44E0F400 }, { 0xFFE0F400, 0x44E08000 }, { 0xFFE0F400, 0x44E08400 },
+    { 0xFFE0F400, 0x44E0A000 }, { 0xFFE0F400, 0x44E0A400 }, { 0xFFE0F400, 0x44E0C000 },
+    { 0xFFE0F400, 0x44E0C400 }, { 0xFFE0F400, 0x44E02000 }, { 0xFFE0F400, 0x44E02400 },
+    { 0xFFE0F400, 0x44E03000 }, { 0xFFE0F400, 0x44E03400 }, { 0xFFE0F400, 0x44E0E000 },
+    { 0xFFE0F400, 0x44E0E400 }, { 0xFFE0F400, 0x44E09000 }, { 0xFFE0F400, 0x44E09400 },
+    { 0xFFE0F400, 0x44E0B000 }, { 0xFFE0F400, 0x44E0B400 }, { 0xFFE0F400, 0x44E0D000 },
+    { 0xFFE0F400, 0x44E0D400 }, { 0xFFE0F000, 0x44E04000 }, { 0xFFE0F000, 0x44E06000 },
+    { 0xFFE0F000, 0x44E07000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FF800, 0x4500D800 },
+    { 0xFF3FF800, 0x4501D800 }, { 0xFFE0FC00, 0x45009800 }, { 0xFFA0FC00, 0x4500D000 },
+    { 0xFFA0FC00, 0x4500D400 }, { 0xFFA0FC00, 0x4500A000 }, { 0xFFA0FC00, 0x4500A400 },
+    { 0xFFA0FC00, 0x4500A800 }, { 0xFFA0FC00, 0x4500AC00 }, { 0xFF20FC00, 0x45006800 },
+    { 0xFF20FC00, 0x45006C00 }, { 0xFF20FC00, 0x4500F800 }, { 0xFF20FC00, 0x4500C000 },
+    { 0xFF20FC00, 0x4500C400 }, { 0xFF20FC00, 0x45003000 }, { 0xFF20FC00, 0x45003400 },
+    { 0xFF20FC00, 0x45000000 }, { 0xFF20FC00, 0x45008000 }, { 0xFF20FC00, 0x45000400 },
+    { 0xFF20FC00, 0x45004000 }, { 0xFF20FC00, 0x45004400 }, { 0xFF20FC00, 0x4500D000 },
+    { 0xFF20FC00, 0x4500D400 }, { 0xFF20FC00, 0x4500F400 }, { 0xFF20FC00, 0x45007000 },
+    { 0xFF20FC00, 0x45007400 }, { 0xFF20FC00, 0x45006000 }, { 0xFF20FC00, 0x45006400 },
+    { 0xFF20FC00, 0x4500F000 }, { 0xFF20FC00, 0x4500E800 }, { 0xFF20FC00, 0x4500E000 },
+    { 0xFF20FC00, 0x45001000 }, { 0xFF20FC00, 0x45008800 }, { 0xFF20FC00, 0x45001400 },
+    { 0xFF20FC00, 0x45008C00 }, { 0xFF20FC00, 0x45005000 }, { 0xFF20FC00, 0x45005400 },
+    { 0xFF20FC00, 0x4500FC00 }, { 0xFF20FC00, 0x4500C800 }, { 0xFF20FC00, 0x4500CC00 },
+    { 0xFF20FC00, 0x45003800 }, { 0xFF20FC00, 0x45003C00 }, { 0xFF20FC00, 0x45000800 },
+    { 0xFF20FC00, 0x45000C00 }, { 0xFF20FC00, 0x45004800 }, { 0xFF20FC00, 0x45004C00 },
+    { 0xFF20FC00, 0x45007800 }, { 0xFF20FC00, 0x45007C00 }, { 0xFF20FC00, 0x4500EC00 },
+    { 0xFF20FC00, 0x4500E400 }, { 0xFF20FC00, 0x45001800 }, { 0xFF20FC00, 0x45001C00 },
+    { 0xFF20FC00, 0x45005800 }, { 0xFF20FC00, 0x45005C00 }, { 0xFF20FC00, 0x4500B400 },
+    { 0xFF20FC00, 0x4500B000 }, { 0xFF20FC00, 0x4500B800 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFFFE0, 0x4520E400 }, { 0xFFFFFFE0, 0x4520E000 }, { 0xFFFFFC00, 0x4522E400 },
+    { 0xFFFFFC00, 0x4522E000 }, { 0xFFFFFC00, 0x4523E000 }, { 0xFFA7FC00, 0x45204000 },
+    { 0xFFA7FC00, 0x45204400 }, { 0xFFA7FC00, 0x45205000 }, { 0xFFA7FC00, 0x45205400 },
+    { 0xFFA7FC00, 0x45204800 }, { 0xFFA7FC00, 0x45204C00 }, { 0xFFE0FC00, 0x4520A000 },
+    { 0xFFE0FC00, 0x4520F400 }, { 0xFFE0FC00, 0x4520F000 }, { 0xFFA0FC00, 0x45201800 },
+    { 0xFFA0FC00, 0x45201C00 }, { 0xFFA0FC00, 0x45201000 }, { 0xFFA0FC00, 0x45201400 },
+    { 0xFFA0FC00, 0x45202800 }, { 0xFFA0FC00, 0x45202C00 }, { 0xFFA0FC00, 0x45200800 },
+    { 0xFFA0FC00, 0x45200C00 }, { 0xFFA0FC00, 0x45202000 }, { 0xFFA0FC00, 0x45202400 },
+    { 0xFFA0FC00, 0x45200000 }, { 0xFFA0FC00, 0x45203800 }, { 0xFFA0FC00, 0x45203C00 },
+    { 0xFFA0FC00, 0x45203000 }, { 0xFFA0FC00, 0x45203400 }, { 0xFF20FC00, 0x45206000 },
+    { 0xFF20FC00, 0x45206400 }, { 0xFF20FC00, 0x45206800 }, { 0xFF20FC00, 0x45206C00 },
+    { 0xFF20FC00, 0x45207800 }, { 0xFF20FC00, 0x45207C00 }, { 0xFF20FC00, 0x45207000 },
+    { 0xFF20FC00, 0x45207400 }, { 0xFF20E010, 0x45208000 }, { 0xFF20E010, 0x45208010 },
+    { 0xFF20E000, 0x4520C000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FF800, 0x4500D800 },
+    { 0xFF3FF800, 0x4501D800 }, { 0xFFA0FC00, 0x4500D000 }, { 0xFFA0FC00, 0x4500D400 },
+    { 0xFFA0FC00, 0x4500A000 }, { 0xFFA0FC00, 0x4500A400 }, { 0xFFA0FC00, 0x4500A800 },
+    { 0xFFA0FC00, 0x4500AC00 }, { 0xFF20FC00, 0x45006800 }, { 0xFF20FC00, 0x45006C00 },
+    { 0xFF20FC00, 0x4500F800 }, { 0xFF20FC00, 0x4500C000 }, { 0xFF20FC00, 0x4500C400 },
+    { 0xFF20FC00, 0x45003000 }, { 0xFF20FC00, 0x45003400 }, { 0xFF20FC00, 0x45000000 },
+    { 0xFF20FC00, 0x45008000 }, { 0xFF20FC00, 0x45000400 }, { 0xFF20FC00, 0x45004000 },
+    { 0xFF20FC00, 0x45004400 }, { 0xFF20FC00, 0x4500D000 }, { 0xFF20FC00, 0x4500D400 },
+    { 0xFF20FC00, 0x4500F400 }, { 0xFF20FC00, 0x45007000 }, { 0xFF20FC00, 0x45007400 },
+    { 0xFF20FC00, 0x45006000 }, { 0xFF20FC00, 0x45006400 }, { 0xFF20FC00, 0x4500F000 },
+    { 0xFF20FC00, 0x4500E800 }, { 0xFF20FC00, 0x4500E000 }, { 0xFF20FC00, 0x45001000 },
+    { 0xFF20FC00, 0x45008800 }, { 0xFF20FC00, 0x45001400 }, { 0xFF20FC00, 0x45008C00 },
+    { 0xFF20FC00, 0x45005000 }, { 0xFF20FC00, 0x45005400 }, { 0xFF20FC00, 0x4500FC00 },
+    { 0xFF20FC00, 0x4500C800 }, { 0xFF20FC00, 0x4500CC00 }, { 0xFF20FC00, 0x45003800 },
+    { 0xFF20FC00, 0x45003C00 }, { 0xFF20FC00, 0x45000800 }, { 0xFF20FC00, 0x45000C00 },
+    { 0xFF20FC00, 0x45004800 }, { 0xFF20FC00, 0x45004C00 }, { 0xFF20FC00, 0x45007800 },
+    { 0xFF20FC00, 0x45007C00 }, { 0xFF20FC00, 0x4500EC00 }, { 0xFF20FC00, 0x4500E400 },
+    { 0xFF20FC00, 0x45001800 }, { 0xFF20FC00, 0x45001C00 }, { 0xFF20FC00, 0x45005800 },
+    { 0xFF20FC00, 0x45005C00 }, { 0xFF20FC00, 0x4500B400 }, { 0xFF20FC00, 0x4500B000 },
+    { 0xFF20FC00, 0x4500B800 }, { 0x1E000000, 0x04000000 }, { 0xFFA7FC00, 0x45204000 },
+    { 0xFFA7FC00, 0x45204400 }, { 0xFFA7FC00, 0x45205000 }, { 0xFFA7FC00, 0x45205400 },
+    { 0xFFA7FC00, 0x45204800 }, { 0xFFA7FC00, 0x45204C00 }, { 0xFFA0FC00, 0x45201800 },
+    { 0xFFA0FC00, 0x45201C00 }, { 0xFFA0FC00, 0x45201000 }, { 0xFFA0FC00, 0x45201400 },
+    { 0xFFA0FC00, 0x45202800 }, { 0xFFA0FC00, 0x45202C00 }, { 0xFFA0FC00, 0x45200800 },
+    { 0xFFA0FC00, 0x45200C00 }, { 0xFFA0FC00, 0x45202000 }, { 0xFFA0FC00, 0x45202400 },
+    { 0xFFA0FC00, 0x45200000 }, { 0xFFA0FC00, 0x45203800 }, { 0xFFA0FC00, 0x45203C00 },
+    { 0xFFA0FC00, 0x45203000 }, { 0xFFA0FC00, 0x45203400 }, { 0xFF20FC00, 0x45206000 },
+    { 0xFF20FC00, 0x45206400 }, { 0xFF20FC00, 0x45206800 }, { 0xFF20FC00, 0x45206C00 },
+    { 0xFF20FC00, 0x45207800 }, { 0xFF20FC00, 0x45207C00 }, { 0xFF20FC00, 0x45207000 },
+    { 0xFF20FC00, 0x45207400 }, { 0xFF20E010, 0x45208000 }, { 0xFF20E010, 0x45208010 },
+    { 0xFF20E000, 0x4520C000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FF800, 0x4500D800 },
+    { 0xFF3FF800, 0x4501D800 }, { 0xFFE0FC00, 0x45809800 }, { 0xFF20FC00, 0x45006800 },
+    { 0xFF20FC00, 0x45006C00 }, { 0xFF20FC00, 0x4500F800 }, { 0xFF20FC00, 0x4500C000 },
+    { 0xFF20FC00, 0x4500C400 }, { 0xFF20FC00, 0x45003000 }, { 0xFF20FC00, 0x45003400 },
+    { 0xFF20FC00, 0x45000000 }, { 0xFF20FC00, 0x45008000 }, { 0xFF20FC00, 0x45000400 },
+    { 0xFF20FC00, 0x45004000 }, { 0xFF20FC00, 0x45004400 }, { 0xFF20FC00, 0x4500D000 },
+    { 0xFF20FC00, 0x4500D400 }, { 0xFF20FC00, 0x4500F400 }, { 0xFF20FC00, 0x45007000 },
+    { 0xFF20FC00, 0x45007400 }, { 0xFF20FC00, 0x45006000 }, { 0xFF20FC00, 0x45006400 },
+    { 0xFF20FC00, 0x4500F000 }, { 0xFF20FC00, 0x4500E800 }, { 0xFF20FC00, 0x4500E000 },
+    { 0xFF20FC00, 0x45001000 }, { 0xFF20FC00, 0x45008800 }, { 0xFF20FC00, 0x45001400 },
+    { 0xFF20FC00, 0x45008C00 }, { 0xFF20FC00, 0x45005000 }, { 0xFF20FC00, 0x45005400 },
+    { 0xFF20FC00, 0x4500FC00 }, { 0xFF20FC00, 0x4500C800 }, { 0xFF20FC00, 0x4500CC00 },
+    { 0xFF20FC00, 0x45003800 }, { 0xFF20FC00, 0x45003C00 }, { 0xFF20FC00, 0x45000800 },
+    { 0xFF20FC00, 0x45000C00 }, { 0xFF20FC00, 0x45004800 }, { 0xFF20FC00, 0x45004C00 },
+    { 0xFF20FC00, 0x45007800 }, { 0xFF20FC00, 0x45007C00 }, { 0xFF20FC00, 0x4500EC00 },
+    { 0xFF20FC00, 0x4500E400 }, { 0xFF20FC00, 0x45001800 }, { 0xFF20FC00, 0x45001C00 },
+    { 0xFF20FC00, 0x45005800 }, { 0xFF20FC00, 0x45005C00 }, { 0xFF20FC00, 0x4500B400 },
+    { 0xFF20FC00, 0x4500B000 }, { 0xFF20FC00, 0x4500B800 }, { 0x1E000000, 0x04000000 },
+    { 0xFF20FC00, 0x45206000 }, { 0xFF20FC00, 0x45206400 }, { 0xFF20FC00, 0x45206800 },
+    { 0xFF20FC00, 0x45206C00 }, { 0xFF20FC00, 0x45207800 }, { 0xFF20FC00, 0x45207C00 },
+    { 0xFF20FC00, 0x45207000 }, { 0xFF20FC00, 0x45207400 }, { 0xFF20E010, 0x45208000 },
+    { 0xFF20E010, 0x45208010 }, { 0xFF20E000, 0x4520C000 }, { 0x1E000000, 0x04000000 },
+    { 0xFF3FF800, 0x4500D800 }, { 0xFF3FF800, 0x4501D800 }, { 0xFFE0FC00, 0x45C09800 },
+    { 0xFF20FC00, 0x45006800 }, { 0xFF20FC00, 0x45006C00 }, { 0xFF20FC00, 0x4500F800 },
+    { 0xFF20FC00, 0x4500C000 }, { 0xFF20FC00, 0x4500C400 }, { 0xFF20FC00, 0x45003000 },
+    { 0xFF20FC00, 0x45003400 }, { 0xFF20FC00, 0x45000000 }, { 0xFF20FC00, 0x45008000 },
+    { 0xFF20FC00, 0x45000400 }, { 0xFF20FC00, 0x45004000 }, { 0xFF20FC00, 0x45004400 },
+    { 0xFF20FC00, 0x4500D000 }, { 0xFF20FC00, 0x4500D400 }, { 0xFF20FC00, 0x4500F400 },
+    { 0xFF20FC00, 0x45007000 }, { 0xFF20FC00, 0x45007400 }, { 0xFF20FC00, 0x45006000 },
+    { 0xFF20FC00, 0x45006400 }, { 0xFF20FC00, 0x4500F000 }, { 0xFF20FC00, 0x4500E800 },
+    { 0xFF20FC00, 0x4500E000 }, { 0xFF20FC00, 0x45001000 }, { 0xFF20FC00, 0x45008800 },
+    { 0xFF20FC00, 0x45001400 }, { 0xFF20FC00, 0x45008C00 }, { 0xFF20FC00, 0x45005000 },
+    { 0xFF20FC00, 0x45005400 }, { 0xFF20FC00, 0x4500FC00 }, { 0xFF20FC00, 0x4500C800 },
+    { 0xFF20FC00, 0x4500CC00 }, { 0xFF20FC00, 0x45003800 }, { 0xFF20FC00, 0x45003C00 },
+    { 0xFF20FC00, 0x45000800 }, { 0xFF20FC00, 0x45000C00 }, { 0xFF20FC00, 0x45004800 },
+    { 0xFF20FC00, 0x45004C00 }, { 0xFF20FC00, 0x45007800 }, { 0xFF20FC00, 0x45007C00 },
+    { 0xFF20FC00, 0x4500EC00 }, { 0xFF20FC00, 0x4500E400 }, { 0xFF20FC00, 0x45001800 },
+    { 0xFF20FC00, 0x45001C00 }, { 0xFF20FC00, 0x45005800 }, { 0xFF20FC00, 0x45005C00 },
+    { 0xFF20FC00, 0x4500B400 }, { 0xFF20FC00, 0x4500B000 }, { 0xFF20FC00, 0x4500B800 },
+    { 0x1E000000, 0x04000000 }, { 0xFF20FC00, 0x45206000 }, { 0xFF20FC00, 0x45206400 },
+    { 0xFF20FC00, 0x45206800 }, { 0xFF20FC00, 0x45206C00 }, { 0xFF20FC00, 0x45207800 },
+    { 0xFF20FC00, 0x45207C00 }, { 0xFF20FC00, 0x45207000 }, { 0xFF20FC00, 0x45207400 },
+    { 0xFF20E010, 0x45208000 }, { 0xFF20E010, 0x45208010 }, { 0xFF20E000, 0x4520C000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFE0FC00, 0x48207C00 }, { 0xFFE0FC00, 0x4820FC00 },
+    { 0xFFE0FC00, 0x48607C00 }, { 0xFFE0FC00, 0x4860FC00 }, { 0xFFFFFC00, 0x489F7C00 },
+    { 0xFFE0FC00, 0x48A07C00 }, { 0xFFE0FC00, 0x48A0FC00 }, { 0xFFFFFC00, 0x48DF7C00 },
+    { 0xFFE0FC00, 0x48E07C00 }, { 0xFFE0FC00, 0x48E0FC00 }, { 0xFFFFF000, 0x4C007000 },
+    { 0xFFFFF000, 0x4C00A000 }, { 0xFFFFF000, 0x4C006000 }, { 0xFFFFF000, 0x4C002000 },
+    { 0xFFFFF000, 0x4C008000 }, { 0xFFFFF000, 0x4C004000 }, { 0xFFFFF000, 0x4C000000 },
+    { 0xFFFFF000, 0x4C407000 }, { 0xFFFFF000, 0x4C40A000 }, { 0xFFFFF000, 0x4C406000 },
+    { 0xFFFFF000, 0x4C402000 }, { 0xFFFFF000, 0x4C408000 }, { 0xFFFFF000, 0x4C404000 },
+    { 0xFFFFF000, 0x4C400000 }, { 0xFFFFF000, 0x4C9F7000 }, { 0xFFFFF000, 0x4C9FA000 },
+    { 0xFFFFF000, 0x4C9F6000 }, { 0xFFFFF000, 0x4C9F2000 }, { 0xFFFFF000, 0x4C9F8000 },
+    { 0xFFFFF000, 0x4C9F4000 }, { 0xFFFFF000, 0x4C9F0000 }, { 0xFFE0F000, 0x4C807000 },
+    { 0xFFE0F000, 0x4C80A000 }, { 0xFFE0F000, 0x4C806000 }, { 0xFFE0F000, 0x4C802000 },
+    { 0xFFE0F000, 0x4C808000 }, { 0xFFE0F000, 0x4C804000 }, { 0xFFE0F000, 0x4C800000 },
+    { 0xFFFFF000, 0x4CDF7000 }, { 0xFFFFF000, 0x4CDFA000 }, { 0xFFFFF000, 0x4CDF6000 },
+    { 0xFFFFF000, 0x4CDF2000 }, { 0xFFFFF000, 0x4CDF8000 }, { 0xFFFFF000, 0x4CDF4000 },
+    { 0xFFFFF000, 0x4CDF0000 }, { 0xFFE0F000, 0x4CC07000 }, { 0xFFE0F000, 0x4CC0A000 },
+    { 0xFFE0F000, 0x4CC06000 }, { 0xFFE0F000, 0x4CC02000 }, { 0xFFE0F000, 0x4CC08000 },
+    { 0xFFE0F000, 0x4CC04000 }, { 0xFFE0F000, 0x4CC00000 }, { 0xBFFFFC00, 0x0D008400 },
+    { 0xBFFFFC00, 0x0D00A400 }, { 0xBFFFFC00, 0x0D018400 }, { 0xBFFFEC00, 0x0D008000 },
+    { 0xBFFFEC00, 0x0D00A000 }, { 0xBFFFE400, 0x0D004000 }, { 0xBFFFE400, 0x0D006000 },
+    { 0xBFFFE000, 0x0D000000 }, { 0xBFFFE000, 0x0D002000 }, { 0xBFFFFC00, 0x0D208400 },
+    { 0xBFFFFC00, 0x0D20A400 }, { 0xBFFFEC00, 0x0D208000 }, { 0xBFFFEC00, 0x0D20A000 },
+    { 0xBFFFE400, 0x0D204000 }, { 0xBFFFE400, 0x0D206000 }, { 0xBFFFE000, 0x0D200000 },
+    { 0xBFFFE000, 0x0D202000 }, { 0xBFFFFC00, 0x0D408400 }, { 0xBFFFFC00, 0x0D40A400 },
+    { 0xBFFFFC00, 0x0D418400 }, { 0xBFFFEC00, 0x0D408000 }, { 0xFFFFF000, 0x4D40C000 },
+    { 0xBFFFEC00, 0x0D40A000 }, { 0xFFFFF000, 0x4D40E000 }, { 0xBFFFE400, 0x0D404000 },
+    { 0xBFFFE400, 0x0D406000 }, { 0xBFFFE000, 0x0D400000 }, { 0xBFFFE000, 0x0D402000 },
+    { 0xBFFFFC00, 0x0D608400 }, { 0xBFFFFC00, 0x0D60A400 }, { 0xBFFFEC00, 0x0D608000 },
+    { 0xFFFFF000, 0x4D60C000 }, { 0xBFFFEC00, 0x0D60A000 }, { 0xFFFFF000, 0x4D60E000 },
+    { 0xBFFFE400, 0x0D604000 }, { 0xBFFFE400, 0x0D606000 }, { 0xBFFFE000, 0x0D600000 },
+    { 0xBFFFE000, 0x0D602000 }, { 0xBFFFFC00, 0x0D9F8400 }, { 0xBFFFFC00, 0x0D9FA400 },
+    { 0xBFFFEC00, 0x0D9F8000 }, { 0xBFFFEC00, 0x0D9FA000 }, { 0xBFFFE400, 0x0D9F4000 },
+    { 0xBFFFE400, 0x0D9F6000 }, { 0xBFFFE000, 0x0D9F0000 }, { 0xBFFFE000, 0x0D9F2000 },
+    { 0xBFE0FC00, 0x0D808400 }, { 0xBFE0FC00, 0x0D80A400 }, { 0xBFE0EC00, 0x0D808000 },
+    { 0xBFE0EC00, 0x0D80A000 }, { 0xBFE0E400, 0x0D804000 }, { 0xBFE0E400, 0x0D806000 },
+    { 0xBFE0E000, 0x0D800000 }, { 0xBFE0E000, 0x0D802000 }, { 0xBFFFFC00, 0x0DBF8400 },
+    { 0xBFFFEC00, 0x0DBF8000 }, { 0xBFFFE400, 0x0DBF4000 }, { 0xBFFFE000, 0x0DBF0000 },
+    { 0xBFE0FC00, 0x0DA08400 }, { 0xBFE0EC00, 0x0DA08000 }, { 0xBFE0E400, 0x0DA04000 },
+    { 0xBFE0E000, 0x0DA00000 }, { 0xBFFFFC00, 0x0DDF8400 }, { 0xBFFFFC00, 0x0DDFA400 },
+    { 0xBFFFEC00, 0x0DDF8000 }, { 0xFFFFF000, 0x4DDFC000 }, { 0xBFFFEC00, 0x0DDFA000 },
+    { 0xFFFFF000, 0x4DDFE000 }, { 0xBFFFE400, 0x0DDF4000 }, { 0xBFFFE400, 0x0DDF6000 },
+    { 0xBFFFE000, 0x0DDF0000 }, { 0xBFFFE000, 0x0DDF2000 }, { 0xBFE0FC00, 0x0DC08400 },
+    { 0xBFE0FC00, 0x0DC0A400 }, { 0xBFE0EC00, 0x0DC08000 }, { 0xFFE0F000, 0x4DC0C000 },
+    { 0xBFE0EC00, 0x0DC0A000 }, { 0xFFE0F000, 0x4DC0E000 }, { 0xBFE0E400, 0x0DC04000 },
+    { 0xBFE0E400, 0x0DC06000 }, { 0xBFE0E000, 0x0DC00000 }, { 0xBFE0E000, 0x0DC02000 },
+    { 0xBFFFFC00, 0x0DFF8400 }, { 0xBFFFEC00, 0x0DFF8000 }, { 0xFFFFF000, 0x4DFFC000 },
+    { 0xFFFFF000, 0x4DFFE000 }, { 0xBFFFE400, 0x0DFF4000 }, { 0xBFFFE000, 0x0DFF0000 },
+    { 0xBFE0FC00, 0x0DE08400 }, { 0xBFE0EC00, 0x0DE08000 }, { 0xFFE0F000, 0x4DE0C000 },
+    { 0xFFE0F000, 0x4DE0E000 }, { 0xBFE0E400, 0x0DE04000 }, { 0xBFE0E000, 0x0DE00000 },
+    { 0xFFFFFC00, 0x4E010C00 }, { 0xFFFFFC00, 0x4E020C00 }, { 0xFFFFFC00, 0x4E1B0C00 },
+    { 0xFFEFFC00, 0x4E080400 }, { 0xFFEFFC00, 0x4E081C00 }, { 0xFFEFFC00, 0x4E083C00 },
+    { 0xFFE7FC00, 0x4E040400 }, { 0xFFE7FC00, 0x4E041C00 }, { 0xFFE7FC00, 0x4E042C00 },
+    { 0xFFE3FC00, 0x4E020400 }, { 0xFFE3FC00, 0x4E021C00 }, { 0xFFE3FC00, 0x4E022C00 },
+    { 0xFFE1FC00, 0x4E010400 }, { 0xFFE1FC00, 0x4E011C00 }, { 0xFFE1FC00, 0x4E012C00 },
+    { 0xFFE0FC00, 0x4E000000 }, { 0xFFE0FC00, 0x4E002000 }, { 0xFFE0FC00, 0x4E004000 },
+    { 0xFFE0FC00, 0x4E006000 }, { 0xFFE0FC00, 0x4E001000 }, { 0xFFE0FC00, 0x4E003000 },
+    { 0xFFE0FC00, 0x4E005000 }, { 0xFFE0FC00, 0x4E007000 }, { 0xFFE0FC00, 0x4E00F400 },
+    { 0xFFE0FC00, 0x4E00FC00 }, { 0xFFE0FC00, 0x4E00C400 }, { 0xFF20FC00, 0x4E002800 },
+    { 0xFF20FC00, 0x4E006800 }, { 0xFF20FC00, 0x4E001800 }, { 0xFF20FC00, 0x4E005800 },
+    { 0xFF20FC00, 0x4E003800 }, { 0xFF20FC00, 0x4E007800 }, { 0xFFFFFC00, 0x4E31B800 },
+    { 0xFFFFFC00, 0x4E21C800 }, { 0xFFFFFC00, 0x4E217800 }, { 0xFFFFFC00, 0x4E21B800 },
+    { 0xFFFFFC00, 0x4E216800 }, { 0xFFFFFC00, 0x4E21A800 }, { 0xFFFFFC00, 0x4E219800 },
+    { 0xFFFFFC00, 0x4E218800 }, { 0xFFFFFC00, 0x4E303800 }, { 0xFFFFFC00, 0x4E21D800 },
+    { 0xFFFFFC00, 0x4E30A800 }, { 0xFFFFFC00, 0x4E31A800 }, { 0xFFFFFC00, 0x4E285800 },
+    { 0xFFFFFC00, 0x4E284800 }, { 0xFFFFFC00, 0x4E287800 }, { 0xFFFFFC00, 0x4E286800 },
+    { 0xFFFFFC00, 0x4E30C800 }, { 0xFFFFFC00, 0x4E30F800 }, { 0xFFFFFC00, 0x4E21E800 },
+    { 0xFFFFFC00, 0x4E21F800 }, { 0xFF3FFC00, 0x4E20B800 }, { 0xFF3FFC00, 0x4E204800 },
+    { 0xFF3FFC00, 0x4E208800 }, { 0xFF3FFC00, 0x4E20A800 }, { 0xFF3FFC00, 0x4E205800 },
+    { 0xFF3FFC00, 0x4E201800 }, { 0xFF3FFC00, 0x4E200800 }, { 0xFF3FFC00, 0x4E206800 },
+    { 0xFF3FFC00, 0x4E202800 }, { 0xFF3FFC00, 0x4E207800 }, { 0xFF3FFC00, 0x4E214800 },
+    { 0xFF3FFC00, 0x4E203800 }, { 0xFF3FFC00, 0x4E212800 }, { 0xFFE0FC00, 0x4E201C00 },
+    { 0xFFE0FC00, 0x4E20D400 }, { 0xFFE0FC00, 0x4E20E400 }, { 0xFFE0FC00, 0x4E20F400 },
+    { 0xFFE0FC00, 0x4E20C400 }, { 0xFFE0FC00, 0x4E20CC00 }, { 0xFFE0FC00, 0x4E20DC00 },
+    { 0xFFE0FC00, 0x4E20FC00 }, { 0xFFE0FC00, 0x4E20E000 }, { 0xFFE0FC00, 0x4E20EC00 },
+    { 0xFF20FC00, 0x4E208400 }, { 0xFF20FC00, 0x4E204000 }, { 0xFF20FC00, 0x4E20BC00 },
+    { 0xFF20FC00, 0x4E203C00 }, { 0xFF20FC00, 0x4E203400 }, { 0xFF20FC00, 0x4E208C00 },
+    { 0xFF20FC00, 0x4E209400 }, { 0xFF20FC00, 0x4E209C00 }, { 0xFF20FC00, 0x4E207C00 },
+    { 0xFF20FC00, 0x4E205000 }, { 0xFF20FC00, 0x4E207400 }, { 0xFF20FC00, 0x4E207000 },
+    { 0xFF20FC00, 0x4E200000 }, { 0xFF20FC00, 0x4E201000 }, { 0xFF20FC00, 0x4E200400 },
+    { 0xFF20FC00, 0x4E202400 }, { 0xFF20FC00, 0x4E206400 }, { 0xFF20FC00, 0x4E20A400 },
+    { 0xFF20FC00, 0x4E206C00 }, { 0xFF20FC00, 0x4E20AC00 }, { 0xFF20FC00, 0x4E208000 },
+    { 0xFF20FC00, 0x4E20A000 }, { 0xFF20FC00, 0x4E20C000 }, { 0xFF20FC00, 0x4E200C00 },
+    { 0xFF20FC00, 0x4E209000 }, { 0xFF20FC00, 0x4E20B000 }, { 0xFF20FC00, 0x4E20B400 },
+    { 0xFF20FC00, 0x4E205C00 }, { 0xFF20FC00, 0x4E204C00 }, { 0xFF20FC00, 0x4E202C00 },
+    { 0xFF20FC00, 0x4E201400 }, { 0xFF20FC00, 0x4E205400 }, { 0xFF20FC00, 0x4E204400 },
+    { 0xFF20FC00, 0x4E202000 }, { 0xFF20FC00, 0x4E203000 }, { 0xFF20FC00, 0x4E206000 },
+    { 0xFFE0FC00, 0x4E401400 }, { 0xFFE0FC00, 0x4E402400 }, { 0xFFE0FC00, 0x4E403400 },
+    { 0xFFE0FC00, 0x4E400400 }, { 0xFFE0FC00, 0x4E400C00 }, { 0xFFE0FC00, 0x4E401C00 },
+    { 0xFFE0FC00, 0x4E403C00 }, { 0xFFE0FC00, 0x4E40F400 }, { 0xFFE0FC00, 0x4E40FC00 },
+    { 0xFFE0FC00, 0x4E40C400 }, { 0xFFE0BC00, 0x4E402000 }, { 0xFF20FC00, 0x4E002800 },
+    { 0xFF20FC00, 0x4E006800 }, { 0xFF20FC00, 0x4E001800 }, { 0xFF20FC00, 0x4E005800 },
+    { 0xFF20FC00, 0x4E003800 }, { 0xFF20FC00, 0x4E007800 }, { 0xFFE09C00, 0x4E401000 },
+    { 0xFFFFFC00, 0x4E71B800 }, { 0xFFFFFC00, 0x4E61C800 }, { 0xFFFFFC00, 0x4E617800 },
+    { 0xFFFFFC00, 0x4E61B800 }, { 0xFFFFFC00, 0x4E616800 }, { 0xFFFFFC00, 0x4E61A800 },
+    { 0xFFFFFC00, 0x4E619800 }, { 0xFFFFFC00, 0x4E618800 }, { 0xFFFFFC00, 0x4E703800 },
+    { 0xFFFFFC00, 0x4E61D800 }, { 0xFFFFFC00, 0x4E70A800 }, { 0xFFFFFC00, 0x4E71A800 },
+    { 0xFFFFFC00, 0x4E79C800 }, { 0xFFFFFC00, 0x4E79B800 }, { 0xFFFFFC00, 0x4E79A800 },
+    { 0xFFFFFC00, 0x4E799800 }, { 0xFFFFFC00, 0x4E798800 }, { 0xFFFFFC00, 0x4E79D800 },
+    { 0xFFFFFC00, 0x4E61E800 }, { 0xFFFFFC00, 0x4E61F800 }, { 0xFF3FFC00, 0x4E20B800 },
+    { 0xFF3FFC00, 0x4E204800 }, { 0xFF3FFC00, 0x4E208800 }, { 0xFF3FFC00, 0x4E20A800 },
+    { 0xFF3FFC00, 0x4E205800 }, { 0xFF3FFC00, 0x4E201800 }, { 0xFF3FFC00, 0x4E200800 },
+    { 0xFF3FFC00, 0x4E206800 }, { 0xFF3FFC00, 0x4E202800 }, { 0xFF3FFC00, 0x4E207800 },
+    { 0xFF3FFC00, 0x4E214800 }, { 0xFF3FFC00, 0x4E203800 }, { 0xFF3FFC00, 0x4E212800 },
+    { 0xFFE0FC00, 0x4E601C00 }, { 0xFFE0FC00, 0x4E60D400 }, { 0xFFE0FC00, 0x4E60E400 },
+    { 0xFFE0FC00, 0x4E60F400 }, { 0xFFE0FC00, 0x4E60C400 }, { 0xFFE0FC00, 0x4E60CC00 },
+    { 0xFFE0FC00, 0x4E60DC00 }, { 0xFFE0FC00, 0x4E60FC00 }, { 0xFF20FC00, 0x4E208400 },
+    { 0xFF20FC00, 0x4E204000 }, { 0xFF20FC00, 0x4E20BC00 }, { 0xFF20FC00, 0x4E203C00 },
+    { 0xFF20FC00, 0x4E203400 }, { 0xFF20FC00, 0x4E208C00 }, { 0xFF20FC00, 0x4E209400 },
+    { 0xFF20FC00, 0x4E209C00 }, { 0xFF20FC00, 0x4E207C00 }, { 0xFF20FC00, 0x4E205000 },
+    { 0xFF20FC00, 0x4E207400 }, { 0xFF20FC00, 0x4E207000 }, { 0xFF20FC00, 0x4E200000 },
+    { 0xFF20FC00, 0x4E201000 }, { 0xFF20FC00, 0x4E200400 }, { 0xFF20FC00, 0x4E202400 },
+    { 0xFF20FC00, 0x4E206400 }, { 0xFF20FC00, 0x4E20A400 }, { 0xFF20FC00, 0x4E206C00 },
+    { 0xFF20FC00, 0x4E20AC00 }, { 0xFF20FC00, 0x4E208000 }, { 0xFF20FC00, 0x4E20A000 },
+    { 0xFF20FC00, 0x4E20C000 }, { 0xFF20FC00, 0x4E200C00 }, { 0xFF20FC00, 0x4E209000 },
+    { 0xFF20FC00, 0x4E20B000 }, { 0xFF20FC00, 0x4E20B400 }, { 0xFF20FC00, 0x4E205C00 },
+    { 0xFF20FC00, 0x4E204C00 }, { 0xFF20FC00, 0x4E202C00 }, { 0xFF20FC00, 0x4E201400 },
+    { 0xFF20FC00, 0x4E205400 }, { 0xFF20FC00, 0x4E204400 }, { 0xFF20FC00, 0x4E202000 },
+    { 0xFF20FC00, 0x4E203000 }, { 0xFF20FC00, 0x4E206000 }, { 0xFFE0FC00, 0x4E809400 },
+    { 0xFFE0FC00, 0x4E80A400 }, { 0xFFE0FC00, 0x4E809C00 }, { 0xFFE0FC00, 0x4E80AC00 },
+    { 0xFF20FC00, 0x4E002800 }, { 0xFF20FC00, 0x4E006800 }, { 0xFF20FC00, 0x4E001800 },
+    { 0xFF20FC00, 0x4E005800 }, { 0xFF20FC00, 0x4E003800 }, { 0xFF20FC00, 0x4E007800 },
+    { 0xFFE09C00, 0x4E801000 }, { 0xFFFFFC00, 0x4EB1B800 }, { 0xFFFFFC00, 0x4EA0F800 },
+    { 0xFFFFFC00, 0x4EA0D800 }, { 0xFFFFFC00, 0x4EA0C800 }, { 0xFFFFFC00, 0x4EA0E800 },
+    { 0xFFFFFC00, 0x4EA1A800 }, { 0xFFFFFC00, 0x4EA1B800 }, { 0xFFFFFC00, 0x4EA1D800 },
+    { 0xFFFFFC00, 0x4EA18800 }, { 0xFFFFFC00, 0x4EA19800 }, { 0xFFFFFC00, 0x4EB03800 },
+    { 0xFFFFFC00, 0x4EB0A800 }, { 0xFFFFFC00, 0x4EB1A800 }, { 0xFFFFFC00, 0x4EA1C800 },
+    { 0xFFFFFC00, 0x4EA16800 }, { 0xFFFFFC00, 0x4EB0C800 }, { 0xFFFFFC00, 0x4EB0F800 },
+    { 0xFF3FFC00, 0x4E20B800 }, { 0xFF3FFC00, 0x4E204800 }, { 0xFF3FFC00, 0x4E208800 },
+    { 0xFF3FFC00, 0x4E20A800 }, { 0xFF3FFC00, 0x4E205800 }, { 0xFF3FFC00, 0x4E201800 },
+    { 0xFF3FFC00, 0x4E200800 }, { 0xFF3FFC00, 0x4E206800 }, { 0xFF3FFC00, 0x4E202800 },
+    { 0xFF3FFC00, 0x4E207800 }, { 0xFF3FFC00, 0x4E214800 }, { 0xFF3FFC00, 0x4E203800 },
+    { 0xFF3FFC00, 0x4E212800 }, { 0xFFE0FC00, 0x4EA0F400 }, { 0xFFE0FC00, 0x4EA0C400 },
+    { 0xFFE0FC00, 0x4EA0CC00 }, { 0xFFE0FC00, 0x4EA0FC00 }, { 0xFFE0FC00, 0x4EA0D400 },
+    { 0xFFE0FC00, 0x4EA01C00 }, { 0xFFE0FC00, 0x4EA0DC00 }, { 0xFFE0FC00, 0x4EA0EC00 },
+    { 0xFF20FC00, 0x4E208400 }, { 0xFF20FC00, 0x4E204000 }, { 0xFF20FC00, 0x4E20BC00 },
+    { 0xFF20FC00, 0x4E203C00 }, { 0xFF20FC00, 0x4E203400 }, { 0xFF20FC00, 0x4E208C00 },
+    { 0xFF20FC00, 0x4E209400 }, { 0xFF20FC00, 0x4E209C00 }, { 0xFF20FC00, 0x4E207C00 },
+    { 0xFF20FC00, 0x4E205000 }, { 0xFF20FC00, 0x4E207400 }, { 0xFF20FC00, 0x4E207000 },
+    { 0xFF20FC00, 0x4E200000 }, { 0xFF20FC00, 0x4E201000 }, { 0xFF20FC00, 0x4E200400 },
+    { 0xFF20FC00, 0x4E202400 }, { 0xFF20FC00, 0x4E206400 }, { 0xFF20FC00, 0x4E20A400 },
+    { 0xFF20FC00, 0x4E206C00 }, { 0xFF20FC00, 0x4E20AC00 }, { 0xFF20FC00, 0x4E208000 },
+    { 0xFF20FC00, 0x4E20A000 }, { 0xFF20FC00, 0x4E20C000 }, { 0xFF20FC00, 0x4E200C00 },
+    { 0xFF20FC00, 0x4E209000 }, { 0xFF20FC00, 0x4E20B000 }, { 0xFF20FC00, 0x4E20B400 },
+    { 0xFF20FC00, 0x4E205C00 }, { 0xFF20FC00, 0x4E204C00 }, { 0xFF20FC00, 0x4E202C00 },
+    { 0xFF20FC00, 0x4E201400 }, { 0xFF20FC00, 0x4E205400 }, { 0xFF20FC00, 0x4E204400 },
+    { 0xFF20FC00, 0x4E202000 }, { 0xFF20FC00, 0x4E203000 }, { 0xFF20FC00, 0x4E206000 },
+    { 0xFFE0FC00, 0x4EC01C00 }, { 0xFFE0FC00, 0x4EC03400 }, { 0xFFE0FC00, 0x4EC00400 },
+    { 0xFFE0FC00, 0x4EC00C00 }, { 0xFFE0FC00, 0x4EC03C00 }, { 0xFFE0FC00, 0x4EC01400 },
+    { 0xFFE0FC00, 0x4EC0FC00 }, { 0xFF20FC00, 0x4E002800 }, { 0xFF20FC00, 0x4E006800 },
+    { 0xFF20FC00, 0x4E001800 }, { 0xFF20FC00, 0x4E005800 }, { 0xFF20FC00, 0x4E003800 },
+    { 0xFF20FC00, 0x4E007800 }, { 0xFFE08C00, 0x4EC00000 }, { 0xFFFFFC00, 0x4EE0F800 },
+    { 0xFFFFFC00, 0x4EE0D800 }, { 0xFFFFFC00, 0x4EE0C800 }, { 0xFFFFFC00, 0x4EE0E800 },
+    { 0xFFFFFC00, 0x4EE1A800 }, { 0xFFFFFC00, 0x4EE1B800 }, { 0xFFFFFC00, 0x4EE1D800 },
+    { 0xFFFFFC00, 0x4EE18800 }, { 0xFFFFFC00, 0x4EE19800 }, { 0xFFFFFC00, 0x4EF8F800 },
+    { 0xFFFFFC00, 0x4EF8D800 }, { 0xFFFFFC00, 0x4EF8C800 }, { 0xFFFFFC00, 0x4EF8E800 },
+    { 0xFFFFFC00, 0x4EF9A800 }, { 0xFFFFFC00, 0x4EF9B800 }, { 0xFFFFFC00, 0x4EF9D800 },
+    { 0xFFFFFC00, 0x4EF98800 }, { 0xFFFFFC00, 0x4EF99800 }, { 0xFF3FFC00, 0x4E20B800 },
+    { 0xFF3FFC00, 0x4E204800 }, { 0xFF3FFC00, 0x4E208800 }, { 0xFF3FFC00, 0x4E20A800 },
+    { 0xFF3FFC00, 0x4E205800 }, { 0xFF3FFC00, 0x4E201800 }, { 0xFF3FFC00, 0x4E200800 },
+    { 0xFF3FFC00, 0x4E206800 }, { 0xFF3FFC00, 0x4E202800 }, { 0xFF3FFC00, 0x4E207800 },
+    { 0xFF3FFC00, 0x4E214800 }, { 0xFF3FFC00, 0x4E203800 }, { 0xFF3FFC00, 0x4E212800 },
+    { 0xFFE0FC00, 0x4EE0F400 }, { 0xFFE0FC00, 0x4EE0C400 }, { 0xFFE0FC00, 0x4EE0CC00 },
+    { 0xFFE0FC00, 0x4EE0FC00 }, { 0xFFE0FC00, 0x4EE0D400 }, { 0xFFE0FC00, 0x4EE01C00 },
+    { 0xFFE0FC00, 0x4EE0E000 }, { 0xFFE0FC00, 0x4EE0DC00 }, { 0xFF20FC00, 0x4E208400 },
+    { 0xFF20FC00, 0x4E204000 }, { 0xFF20FC00, 0x4E20BC00 }, { 0xFF20FC00, 0x4E203C00 },
+    { 0xFF20FC00, 0x4E203400 }, { 0xFF20FC00, 0x4E208C00 }, { 0xFF20FC00, 0x4E209400 },
+    { 0xFF20FC00, 0x4E209C00 }, { 0xFF20FC00, 0x4E207C00 }, { 0xFF20FC00, 0x4E205000 },
+    { 0xFF20FC00, 0x4E207400 }, { 0xFF20FC00, 0x4E207000 }, { 0xFF20FC00, 0x4E200000 },
+    { 0xFF20FC00, 0x4E201000 }, { 0xFF20FC00, 0x4E200400 }, { 0xFF20FC00, 0x4E202400 },
+    { 0xFF20FC00, 0x4E206400 }, { 0xFF20FC00, 0x4E20A400 }, { 0xFF20FC00, 0x4E206C00 },
+    { 0xFF20FC00, 0x4E20AC00 }, { 0xFF20FC00, 0x4E208000 }, { 0xFF20FC00, 0x4E20A000 },
+    { 0xFF20FC00, 0x4E20C000 }, { 0xFF20FC00, 0x4E200C00 }, { 0xFF20FC00, 0x4E209000 },
+    { 0xFF20FC00, 0x4E20B000 }, { 0xFF20FC00, 0x4E20B400 }, { 0xFF20FC00, 0x4E205C00 },
+    { 0xFF20FC00, 0x4E204C00 }, { 0xFF20FC00, 0x4E202C00 }, { 0xFF20FC00, 0x4E201400 },
+    { 0xFF20FC00, 0x4E205400 }, { 0xFF20FC00, 0x4E204400 }, { 0xFF20FC00, 0x4E202000 },
+    { 0xFF20FC00, 0x4E203000 }, { 0xFF20FC00, 0x4E206000 }, { 0xFFF8FC00, 0x4F00F400 },
+    { 0xFFF8FC00, 0x4F00FC00 }, { 0xFF87FC00, 0x4F00A400 }, { 0xFF80FC00, 0x4F00FC00 },
+    { 0xFFF80C00, 0x4F000400 }, { 0xFF80FC00, 0x4F008C00 }, { 0xFF80FC00, 0x4F00E400 },
+    { 0xFF80FC00, 0x4F005400 }, { 0xFF80FC00, 0x4F008400 }, { 0xFF80FC00, 0x4F009C00 },
+    { 0xFF80FC00, 0x4F007400 }, { 0xFF80FC00, 0x4F009400 }, { 0xFF80FC00, 0x4F002400 },
+    { 0xFF80FC00, 0x4F003400 }, { 0xFF80FC00, 0x4F00A400 }, { 0xFF80FC00, 0x4F000400 },
+    { 0xFF80FC00, 0x4F001400 }, { 0xFFC0F400, 0x4F001000 }, { 0xFFC0F400, 0x4F005000 },
+    { 0xFFC0F400, 0x4F009000 }, { 0xFFC0F400, 0x4F000000 }, { 0xFFC0F400, 0x4F00F000 },
+    { 0xDFF80C00, 0x4F000400 }, { 0xFF87FC00, 0x4F00A400 }, { 0xFF80FC00, 0x4F00FC00 },
+    { 0xFF80FC00, 0x4F008C00 }, { 0xFF80FC00, 0x4F00E400 }, { 0xFF80FC00, 0x4F005400 },
+    { 0xFF80FC00, 0x4F008400 }, { 0xFF80FC00, 0x4F009C00 }, { 0xFF80FC00, 0x4F007400 },
+    { 0xFF80FC00, 0x4F009400 }, { 0xFF80FC00, 0x4F002400 }, { 0xFF80FC00, 0x4F003400 },
+    { 0xFF80FC00, 0x4F00A400 }, { 0xFF80FC00, 0x4F000400 }, { 0xFF80FC00, 0x4F001400 },
+    { 0xFFC0F400, 0x4F001000 }, { 0xFFC0F400, 0x4F005000 }, { 0xFFC0F400, 0x4F009000 },
+    { 0xFFC0F400, 0x4F000000 }, { 0xFFC0F400, 0x4F00F000 }, { 0xFF87FC00, 0x4F00A400 },
+    { 0xFF80FC00, 0x4F00FC00 }, { 0xFFC0F400, 0x4F408000 }, { 0xFF80FC00, 0x4F008C00 },
+    { 0xFF80FC00, 0x4F00E400 }, { 0xFF80FC00, 0x4F005400 }, { 0xFF80FC00, 0x4F008400 },
+    { 0xFFC0F400, 0x4F402000 }, { 0xFFC0F400, 0x4F406000 }, { 0xFFC0F400, 0x4F40A000 },
+    { 0xFFC0F400, 0x4F40C000 }, { 0xFFC0F400, 0x4F40B000 }, { 0xFFC0F400, 0x4F40D000 },
+    { 0xFF80FC00, 0x4F009C00 }, { 0xFF80FC00, 0x4F007400 }, { 0xFF80FC00, 0x4F009400 },
+    { 0xFF80FC00, 0x4F002400 }, { 0xFF80FC00, 0x4F003400 }, { 0xFF80FC00, 0x4F00A400 },
+    { 0xFF80FC00, 0x4F000400 }, { 0xFF80FC00, 0x4F001400 }, { 0xFFC0F400, 0x4F40F000 },
+    { 0xFFC0F400, 0x4F400000 }, { 0xFF87FC00, 0x4F00A400 }, { 0xFF80FC00, 0x4F00FC00 },
+    { 0xFFC0F400, 0x4F408000 }, { 0xFF80FC00, 0x4F008C00 }, { 0xFF80FC00, 0x4F00E400 },
+    { 0xFF80FC00, 0x4F005400 }, { 0xFF80FC00, 0x4F008400 }, { 0xFFC0F400, 0x4F402000 },
+    { 0xFFC0F400, 0x4F406000 }, { 0xFFC0F400, 0x4F40A000 }, { 0xFFC0F400, 0x4F40C000 },
+    { 0xFFC0F400, 0x4F40B000 }, { 0xFFC0F400, 0x4F40D000 }, { 0xFF80FC00, 0x4F009C00 },
+    { 0xFF80FC00, 0x4F007400 }, { 0xFF80FC00, 0x4F009400 }, { 0xFF80FC00, 0x4F002400 },
+    { 0xFF80FC00, 0x4F003400 }, { 0xFF80FC00, 0x4F00A400 }, { 0xFF80FC00, 0x4F000400 },
+    { 0xFF80FC00, 0x4F001400 }, { 0xFFC0F400, 0x4F40F000 }, { 0xFFC0F400, 0x4F400000 },
+    { 0xFFC0F400, 0x4F808000 }, { 0xFFC0F400, 0x4F802000 }, { 0xFFC0F400, 0x4F806000 },
+    { 0xFFC0F400, 0x4F80A000 }, { 0xFFC0F400, 0x4F80C000 }, { 0xFFC0F400, 0x4F80B000 },
+    { 0xFFC0F400, 0x4F80D000 }, { 0xFFC0F400, 0x4F80E000 }, { 0xFFC0F400, 0x4F800000 },
+    { 0xFFC0F400, 0x4F804000 }, { 0xFFC0F400, 0x4F80F000 }, { 0xFFC0F400, 0x4F808000 },
+    { 0xFFC0F400, 0x4F802000 }, { 0xFFC0F400, 0x4F806000 }, { 0xFFC0F400, 0x4F80A000 },
+    { 0xFFC0F400, 0x4F80C000 }, { 0xFFC0F400, 0x4F80B000 }, { 0xFFC0F400, 0x4F80D000 },
+    { 0xFFC0F400, 0x4F80E000 }, { 0xFFC0F400, 0x4F800000 }, { 0xFFC0F400, 0x4F804000 },
+    { 0xFFC0F400, 0x4F80F000 }, { 0xFFE0F400, 0x4FC01000 }, { 0xFFE0F400, 0x4FC05000 },
+    { 0xFFE0F400, 0x4FC09000 }, { 0xFFC0F400, 0x4FC01000 }, { 0xFFC0F400, 0x4FC05000 },
+    { 0xFFC0F400, 0x4FC09000 }, { 0xFFC0F400, 0x4FC0F400 }, { 0xFFC0F400, 0x4FC00000 },
+    { 0xFFC0F400, 0x4FC01000 }, { 0xFFC0F400, 0x4FC05000 }, { 0xFFC0F400, 0x4FC09000 },
+    { 0xFFC0F400, 0x4FC0F400 }, { 0xFFC0F400, 0x4FC00000 }, { 0xFF000010, 0x54000010 },
+    { 0xFF000010, 0x54000010 }, { 0xFF000010, 0x54000010 }, { 0xFF000010, 0x54000010 },
+    { 0xFF000010, 0x54000010 }, { 0xFF000010, 0x54000010 }, { 0xFF000010, 0x54000010 },
+    { 0xFF000010, 0x54000010 }, { 0xFFE00C00, 0x59000000 }, { 0xFFE0FC00, 0x59200800 },
+    { 0xFFE0FC00, 0x59200C00 }, { 0xFFE0FC00, 0x59209000 }, { 0xFFE0FC00, 0x5920B000 },
+    { 0xFFE0FC00, 0x5920A000 }, { 0xFFE00C00, 0x59400000 }, { 0xFFE0FC00, 0x59600800 },
+    { 0xFFE0FC00, 0x59600C00 }, { 0xFFE0FC00, 0x59609000 }, { 0xFFE0FC00, 0x5960B000 },
+    { 0xFFE0FC00, 0x5960A000 }, { 0xFFE00C00, 0x59800000 }, { 0xFFE0FC00, 0x59A00800 },
+    { 0xFFE0FC00, 0x59A00C00 }, { 0xFFE0FC00, 0x59A09000 }, { 0xFFE0FC00, 0x59A0B000 },
+    { 0xFFE0FC00, 0x59A0A000 }, { 0xFFE00C00, 0x59C00000 }, { 0xFFE0FC00, 0x59E00800 },
+    { 0xFFE0FC00, 0x59E00C00 }, { 0xFFE0FC00, 0x59E09000 }, { 0xFFE0FC00, 0x59E0B000 },
+    { 0xFFE0FC00, 0x59E0A000 }, { 0xFFFFFC00, 0x5AC02000 }, { 0xFFFFFC00, 0x5AC01C00 },
+    { 0xFFFFFC00, 0x5AC01800 }, { 0xFF000000, 0x5C000000 }, { 0xFF000000, 0x5C000000 },
+    { 0xFF000000, 0x5C000000 }, { 0xFF000000, 0x5C000000 }, { 0xFF000000, 0x5C000000 },
+    { 0xFF000000, 0x5C000000 }, { 0xFF000000, 0x5C000000 }, { 0xFF000000, 0x5C000000 },
+    { 0xFFE00C00, 0x5D000800 }, { 0xFFE00C00, 0x5D400800 }, { 0xFFEFFC00, 0x5E080400 },
+    { 0xFFE7FC00, 0x5E040400 }, { 0xFFE3FC00, 0x5E020400 }, { 0xFFE1FC00, 0x5E010400 },
+    { 0xFFE0FC00, 0x5E000000 }, { 0xFFE0FC00, 0x5E002000 }, { 0xFFE0FC00, 0x5E001000 },
+    { 0xFFE0FC00, 0x5E003000 }, { 0xFFE0FC00, 0x5E004000 }, { 0xFFE0FC00, 0x5E005000 },
+    { 0xFFE0FC00, 0x5E006000 }, { 0xFFFFFC00, 0x5E21C800 }, { 0xFFFFFC00, 0x5E21B800 },
+    { 0xFFFFFC00, 0x5E21A800 }, { 0xFFFFFC00, 0x5E21D800 }, { 0xFFFFFC00, 0x5E214800 },
+    { 0xFFFFFC00, 0x5E30D800 }, { 0xFFFFFC00, 0x5E30C800 }, { 0xFFFFFC00, 0x5E30F800 },
+    { 0xFFFFFC00, 0x5E280800 }, { 0xFFFFFC00, 0x5E281800 }, { 0xFFFFFC00, 0x5E282800 },
+    { 0xFF3FFC00, 0x5E31B800 }, { 0xFF3FFC00, 0x5E207800 }, { 0xFF3FFC00, 0x5E203800 },
+    { 0xFFE0FC00, 0x5E20E400 }, { 0xFFE0FC00, 0x5E20DC00 }, { 0xFFE0FC00, 0x5E20FC00 },
+    { 0xFFE0FC00, 0x5E205C00 }, { 0xFFE0FC00, 0x5E204C00 }, { 0xFFE0FC00, 0x5E202C00 },
+    { 0xFF20FC00, 0x5E200C00 }, { 0xFFE0FC00, 0x5E402400 }, { 0xFFE0FC00, 0x5E401C00 },
+    { 0xFFE0FC00, 0x5E403C00 }, { 0xFFFFFC00, 0x5E61C800 }, { 0xFFFFFC00, 0x5E61B800 },
+    { 0xFFFFFC00, 0x5E61A800 }, { 0xFFFFFC00, 0x5E61D800 }, { 0xFFFFFC00, 0x5E614800 },
+    { 0xFFFFFC00, 0x5E79C800 }, { 0xFFFFFC00, 0x5E79B800 }, { 0xFFFFFC00, 0x5E79A800 },
+    { 0xFFFFFC00, 0x5E79D800 }, { 0xFF3FFC00, 0x5E31B800 }, { 0xFF3FFC00, 0x5E207800 },
+    { 0xFF3FFC00, 0x5E203800 }, { 0xFFE0FC00, 0x5E60E400 }, { 0xFFE0FC00, 0x5E60DC00 },
+    { 0xFFE0FC00, 0x5E60FC00 }, { 0xFFE0FC00, 0x5E609000 }, { 0xFFE0FC00, 0x5E60B000 },
+    { 0xFFE0FC00, 0x5E60B400 }, { 0xFFE0FC00, 0x5E60D000 }, { 0xFFE0FC00, 0x5E605C00 },
+    { 0xFFE0FC00, 0x5E604C00 }, { 0xFFE0FC00, 0x5E602C00 }, { 0xFF20FC00, 0x5E200C00 },
+    { 0xFFFFFC00, 0x5EA0D800 }, { 0xFFFFFC00, 0x5EA0C800 }, { 0xFFFFFC00, 0x5EA0E800 },
+    { 0xFFFFFC00, 0x5EA1A800 }, { 0xFFFFFC00, 0x5EA1B800 }, { 0xFFFFFC00, 0x5EA1D800 },
+    { 0xFFFFFC00, 0x5EA1F800 }, { 0xFFFFFC00, 0x5EA14800 }, { 0xFFFFFC00, 0x5EB0C800 },
+    { 0xFFFFFC00, 0x5EB0F800 }, { 0xFF3FFC00, 0x5E31B800 }, { 0xFF3FFC00, 0x5E207800 },
+    { 0xFF3FFC00, 0x5E203800 }, { 0xFFE0FC00, 0x5EA0FC00 }, { 0xFFE0FC00, 0x5EA09000 },
+    { 0xFFE0FC00, 0x5EA0B000 }, { 0xFFE0FC00, 0x5EA0B400 }, { 0xFFE0FC00, 0x5EA0D000 },
+    { 0xFFE0FC00, 0x5EA05C00 }, { 0xFFE0FC00, 0x5EA04C00 }, { 0xFFE0FC00, 0x5EA02C00 },
+    { 0xFF20FC00, 0x5E200C00 }, { 0xFFE0FC00, 0x5EC03C00 }, { 0xFFFFFC00, 0x5EE0B800 },
+    { 0xFFFFFC00, 0x5EE09800 }, { 0xFFFFFC00, 0x5EE08800 }, { 0xFFFFFC00, 0x5EE0A800 },
+    { 0xFFFFFC00, 0x5EE0D800 }, { 0xFFFFFC00, 0x5EE0C800 }, { 0xFFFFFC00, 0x5EE0E800 },
+    { 0xFFFFFC00, 0x5EE1A800 }, { 0xFFFFFC00, 0x5EE1B800 }, { 0xFFFFFC00, 0x5EE1D800 },
+    { 0xFFFFFC00, 0x5EE1F800 }, { 0xFFFFFC00, 0x5EF8D800 }, { 0xFFFFFC00, 0x5EF8C800 },
+    { 0xFFFFFC00, 0x5EF8E800 }, { 0xFFFFFC00, 0x5EF9A800 }, { 0xFFFFFC00, 0x5EF9B800 },
+    { 0xFFFFFC00, 0x5EF9D800 }, { 0xFFFFFC00, 0x5EF9F800 }, { 0xFF3FFC00, 0x5E31B800 },
+    { 0xFF3FFC00, 0x5E207800 }, { 0xFF3FFC00, 0x5E203800 }, { 0xFFE0FC00, 0x5EE08400 },
+    { 0xFFE0FC00, 0x5EE03C00 }, { 0xFFE0FC00, 0x5EE03400 }, { 0xFFE0FC00, 0x5EE08C00 },
+    { 0xFFE0FC00, 0x5EE0FC00 }, { 0xFFE0FC00, 0x5EE05C00 }, { 0xFFE0FC00, 0x5EE04C00 },
+    { 0xFFE0FC00, 0x5EE02C00 }, { 0xFFE0FC00, 0x5EE05400 }, { 0xFFE0FC00, 0x5EE04400 },
+    { 0xFF20FC00, 0x5E200C00 }, { 0xFF80FC00, 0x5F00FC00 }, { 0xFF80FC00, 0x5F00E400 },
+    { 0xFF80FC00, 0x5F005400 }, { 0xFF80FC00, 0x5F009C00 }, { 0xFF80FC00, 0x5F007400 },
+    { 0xFF80FC00, 0x5F009400 }, { 0xFF80FC00, 0x5F002400 }, { 0xFF80FC00, 0x5F003400 },
+    { 0xFF80FC00, 0x5F000400 }, { 0xFF80FC00, 0x5F001400 }, { 0xFFC0F400, 0x5F001000 },
+    { 0xFFC0F400, 0x5F005000 }, { 0xFFC0F400, 0x5F009000 }, { 0xFF80FC00, 0x5F00FC00 },
+    { 0xFF80FC00, 0x5F00E400 }, { 0xFF80FC00, 0x5F005400 }, { 0xFF80FC00, 0x5F009C00 },
+    { 0xFF80FC00, 0x5F007400 }, { 0xFF80FC00, 0x5F009400 }, { 0xFF80FC00, 0x5F002400 },
+    { 0xFF80FC00, 0x5F003400 }, { 0xFF80FC00, 0x5F000400 }, { 0xFF80FC00, 0x5F001400 },
+    { 0xFFC0F400, 0x5F001000 }, { 0xFFC0F400, 0x5F005000 }, { 0xFFC0F400, 0x5F009000 },
+    { 0xFF80FC00, 0x5F00FC00 }, { 0xFF80FC00, 0x5F00E400 }, { 0xFF80FC00, 0x5F005400 },
+    { 0xFFC0F400, 0x5F403000 }, { 0xFFC0F400, 0x5F407000 }, { 0xFFC0F400, 0x5F40C000 },
+    { 0xFFC0F400, 0x5F40B000 }, { 0xFFC0F400, 0x5F40D000 }, { 0xFF80FC00, 0x5F009C00 },
+    { 0xFF80FC00, 0x5F007400 }, { 0xFF80FC00, 0x5F009400 }, { 0xFF80FC00, 0x5F002400 },
+    { 0xFF80FC00, 0x5F003400 }, { 0xFF80FC00, 0x5F000400 }, { 0xFF80FC00, 0x5F001400 },
+    { 0xFF80FC00, 0x5F00FC00 }, { 0xFF80FC00, 0x5F00E400 }, { 0xFF80FC00, 0x5F005400 },
+    { 0xFFC0F400, 0x5F403000 }, { 0xFFC0F400, 0x5F407000 }, { 0xFFC0F400, 0x5F40C000 },
+    { 0xFFC0F400, 0x5F40B000 }, { 0xFFC0F400, 0x5F40D000 }, { 0xFF80FC00, 0x5F009C00 },
+    { 0xFF80FC00, 0x5F007400 }, { 0xFF80FC00, 0x5F009400 }, { 0xFF80FC00, 0x5F002400 },
+    { 0xFF80FC00, 0x5F003400 }, { 0xFF80FC00, 0x5F000400 }, { 0xFF80FC00, 0x5F001400 },
+    { 0xFFC0F400, 0x5F801000 }, { 0xFFC0F400, 0x5F805000 }, { 0xFFC0F400, 0x5F809000 },
+    { 0xFFC0F400, 0x5F803000 }, { 0xFFC0F400, 0x5F807000 }, { 0xFFC0F400, 0x5F80C000 },
+    { 0xFFC0F400, 0x5F80B000 }, { 0xFFC0F400, 0x5F80D000 }, { 0xFFC0F400, 0x5F801000 },
+    { 0xFFC0F400, 0x5F805000 }, { 0xFFC0F400, 0x5F809000 }, { 0xFFC0F400, 0x5F803000 },
+    { 0xFFC0F400, 0x5F807000 }, { 0xFFC0F400, 0x5F80C000 }, { 0xFFC0F400, 0x5F80B000 },
+    { 0xFFC0F400, 0x5F80D000 }, { 0xFFE0F400, 0x5FC01000 }, { 0xFFE0F400, 0x5FC05000 },
+    { 0xFFE0F400, 0x5FC09000 }, { 0xFFFFE000, 0x640AA000 }, { 0xFF3FE000, 0x64108000 },
+    { 0xFF3FE000, 0x64148000 }, { 0xFF3FE000, 0x64168000 }, { 0xFF3FE000, 0x64158000 },
+    { 0xFF3FE000, 0x64178000 }, { 0xFF3EE000, 0x64008000 }, { 0xFF208000, 0x64000000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFA0FC00, 0x64200000 }, { 0xFFA0FC00, 0x64200400 },
+    { 0xFFA0FC00, 0x64202000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FE000, 0x64108000 },
+    { 0xFF3FE000, 0x64148000 }, { 0xFF3FE000, 0x64168000 }, { 0xFF3FE000, 0x64158000 },
+    { 0xFF3FE000, 0x64178000 }, { 0xFF3EE000, 0x64008000 }, { 0xFF208000, 0x64000000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFE0FC00, 0x64608000 }, { 0xFFE0FC00, 0x64604000 },
+    { 0xFFE0FC00, 0x6460E400 }, { 0xFFA0FC00, 0x64200000 }, { 0xFFA0FC00, 0x64200400 },
+    { 0xFFA0FC00, 0x64202000 }, { 0x1E000000, 0x04000000 }, { 0xFFFFE000, 0x648AA000 },
+    { 0xFFFFE000, 0x6489A000 }, { 0xFFFFE000, 0x6488A000 }, { 0xFF3FE000, 0x64108000 },
+    { 0xFF3FE000, 0x64148000 }, { 0xFF3FE000, 0x64168000 }, { 0xFF3FE000, 0x64158000 },
+    { 0xFF3FE000, 0x64178000 }, { 0xFF3EE000, 0x64008000 }, { 0xFF208000, 0x64000000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFE0FC00, 0x64A00000 }, { 0xFFE0FC00, 0x64A00400 },
+    { 0xFFE0FC00, 0x64A02000 }, { 0xFFE0FC00, 0x64A0E400 }, { 0xFFE0FC00, 0x64A08000 },
+    { 0xFFE0FC00, 0x64A08400 }, { 0xFFE0FC00, 0x64A0A000 }, { 0xFFE0FC00, 0x64A0A400 },
+    { 0xFFE0F400, 0x64A04000 }, { 0xFFE0F400, 0x64A04400 }, { 0xFFE0F400, 0x64A06000 },
+    { 0xFFE0F400, 0x64A06400 }, { 0xFFE0F000, 0x64A01000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFE000, 0x64CBA000 }, { 0xFFFFE000, 0x64CAA000 }, { 0xFF3FE000, 0x64108000 },
+    { 0xFF3FE000, 0x64148000 }, { 0xFF3FE000, 0x64168000 }, { 0xFF3FE000, 0x64158000 },
+    { 0xFF3FE000, 0x64178000 }, { 0xFF3EE000, 0x64008000 }, { 0xFF208000, 0x64000000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFE0FC00, 0x64E00000 }, { 0xFFE0FC00, 0x64E00400 },
+    { 0xFFE0FC00, 0x64E02000 }, { 0xFFE0FC00, 0x64E08000 }, { 0xFFE0FC00, 0x64E08400 },
+    { 0xFFE0FC00, 0x64E0E400 }, { 0xFFE0F400, 0x64E04000 }, { 0xFFE0F400, 0x64E04400 },
+    { 0xFFE0F000, 0x64E01000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FE3C0, 0x65188000 },
+    { 0xFF3FE3C0, 0x651E8000 }, { 0xFF3FE3C0, 0x651C8000 }, { 0xFF3FE3C0, 0x651F8000 },
+    { 0xFF3FE3C0, 0x651D8000 }, { 0xFF3FE3C0, 0x651A8000 }, { 0xFF3FE3C0, 0x65198000 },
+    { 0xFF3FE3C0, 0x651B8000 }, { 0xFF3FFC00, 0x650E3000 }, { 0xFF3FFC00, 0x650F3000 },
+    { 0xFFFFE000, 0x650AA000 }, { 0xFF3FE010, 0x65122000 }, { 0xFF3FE010, 0x65102000 },
+    { 0xFF3FE010, 0x65102010 }, { 0xFF3FE010, 0x65112010 }, { 0xFF3FE010, 0x65112000 },
+    { 0xFF3FE010, 0x65132000 }, { 0xFF3FE000, 0x65088000 }, { 0xFF3FE000, 0x65008000 },
+    { 0xFF3FE000, 0x650D8000 }, { 0xFF3FE000, 0x650C8000 }, { 0xFF3FE000, 0x65068000 },
+    { 0xFF3FE000, 0x65048000 }, { 0xFF3FE000, 0x65078000 }, { 0xFF3FE000, 0x65058000 },
+    { 0xFF3FE000, 0x65028000 }, { 0xFF3FE000, 0x650A8000 }, { 0xFF3FE000, 0x650CA000 },
+    { 0xFF3FE000, 0x6504A000 }, { 0xFF3FE000, 0x6507A000 }, { 0xFF3FE000, 0x6502A000 },
+    { 0xFF3FE000, 0x6500A000 }, { 0xFF3FE000, 0x6501A000 }, { 0xFF3FE000, 0x6506A000 },
+    { 0xFF3FE000, 0x6503A000 }, { 0xFF3FE000, 0x65098000 }, { 0xFF3FE000, 0x650DA000 },
+    { 0xFF3FE000, 0x65018000 }, { 0xFF3FE000, 0x65038000 }, { 0xFF38FC00, 0x65108000 },
+    { 0xFFF9E000, 0x6518A000 }, { 0xFF20FC00, 0x65000000 }, { 0xFF20FC00, 0x65000800 },
+    { 0xFF20FC00, 0x65001800 }, { 0xFF20FC00, 0x65001C00 }, { 0xFF20FC00, 0x65000400 },
+    { 0xFF20FC00, 0x65000C00 }, { 0xFF20E010, 0x6500C010 }, { 0xFF20E010, 0x6500E010 },
+    { 0xFF20E010, 0x65006000 }, { 0xFF20E010, 0x65004000 }, { 0xFF20E010, 0x65004010 },
+    { 0xFF20E010, 0x65006010 }, { 0xFF20E010, 0x6500C000 }, { 0x1E000000, 0x04000000 },
+    { 0xFF20E000, 0x65208000 }, { 0xFF20E000, 0x65200000 }, { 0xFF20E000, 0x65202000 },
+    { 0xFF20E000, 0x6520A000 }, { 0xFF20E000, 0x6520C000 }, { 0xFF20E000, 0x65204000 },
+    { 0xFF20E000, 0x65206000 }, { 0xFF20E000, 0x6520E000 }, { 0x1E000000, 0x04000000 },
+    { 0xFF3FE3C0, 0x65188000 }, { 0xFF3FE3C0, 0x651E8000 }, { 0xFF3FE3C0, 0x651C8000 },
+    { 0xFF3FE3C0, 0x651F8000 }, { 0xFF3FE3C0, 0x651D8000 }, { 0xFF3FE3C0, 0x651A8000 },
+    { 0xFF3FE3C0, 0x65198000 }, { 0xFF3FE3C0, 0x651B8000 }, { 0xFF3FFC00, 0x650E3000 },
+    { 0xFF3FFC00, 0x650F3000 }, { 0xFFFFE000, 0x65582000 }, { 0xFFFFE000, 0x65402000 },
+    { 0xFFFFE000, 0x655AA000 }, { 0xFFFFE000, 0x655CA000 }, { 0xFFFFE000, 0x655EA000 },
+    { 0xFFFFE000, 0x655BA000 }, { 0xFFFFE000, 0x655DA000 }, { 0xFFFFE000, 0x655FA000 },
+    { 0xFFFFE000, 0x65442000 }, { 0xFFFFE000, 0x65462000 }, { 0xFFFFE000, 0x65452000 },
+    { 0xFFFFE000, 0x65472000 }, { 0xFFFFE000, 0x6552A000 }, { 0xFFFFE000, 0x6554A000 },
+    { 0xFFFFE000, 0x6556A000 }, { 0xFFFFE000, 0x6553A000 }, { 0xFFFFE000, 0x6555A000 },
+    { 0xFFFFE000, 0x6557A000 }, { 0xFF3FE010, 0x65122000 }, { 0xFF3FE010, 0x65102000 },
+    { 0xFF3FE010, 0x65102010 }, { 0xFF3FE010, 0x65112010 }, { 0xFF3FE010, 0x65112000 },
+    { 0xFF3FE010, 0x65132000 }, { 0xFF3FE000, 0x65088000 }, { 0xFF3FE000, 0x65008000 },
+    { 0xFF3FE000, 0x650D8000 }, { 0xFF3FE000, 0x650C8000 }, { 0xFF3FE000, 0x65068000 },
+    { 0xFF3FE000, 0x65048000 }, { 0xFF3FE000, 0x65078000 }, { 0xFF3FE000, 0x65058000 },
+    { 0xFF3FE000, 0x65028000 }, { 0xFF3FE000, 0x650A8000 }, { 0xFF3FE000, 0x650CA000 },
+    { 0xFF3FE000, 0x6504A000 }, { 0xFF3FE000, 0x6507A000 }, { 0xFF3FE000, 0x6502A000 },
+    { 0xFF3FE000, 0x6500A000 }, { 0xFF3FE000, 0x6501A000 }, { 0xFF3FE000, 0x6506A000 },
+    { 0xFF3FE000, 0x6503A000 }, { 0xFF3FE000, 0x65098000 }, { 0xFF3FE000, 0x650DA000 },
+    { 0xFF3FE000, 0x65018000 }, { 0xFF3FE000, 0x65038000 }, { 0xFF38FC00, 0x65108000 },
+    { 0xFF20FC00, 0x65000000 }, { 0xFF20FC00, 0x65000800 }, { 0xFF20FC00, 0x65001800 },
+    { 0xFF20FC00, 0x65001C00 }, { 0xFF20FC00, 0x65000400 }, { 0xFF20FC00, 0x65000C00 },
+    { 0xFF20E010, 0x6500C010 }, { 0xFF20E010, 0x6500E010 }, { 0xFF20E010, 0x65006000 },
+    { 0xFF20E010, 0x65004000 }, { 0xFF20E010, 0x65004010 }, { 0xFF20E010, 0x65006010 },
+    { 0xFF20E010, 0x6500C000 }, { 0x1E000000, 0x04000000 }, { 0xFF20E000, 0x65208000 },
+    { 0xFF20E000, 0x65200000 }, { 0xFF20E000, 0x65202000 }, { 0xFF20E000, 0x6520A000 },
+    { 0xFF20E000, 0x6520C000 }, { 0xFF20E000, 0x65204000 }, { 0xFF20E000, 0x65206000 },
+    { 0xFF20E000, 0x6520E000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FE3C0, 0x65188000 },
+    { 0xFF3FE3C0, 0x651E8000 }, { 0xFF3FE3C0, 0x651C8000 }, { 0xFF3FE3C0, 0x651F8000 },
+    { 0xFF3FE3C0, 0x651D8000 }, { 0xFF3FE3C0, 0x651A8000 }, { 0xFF3FE3C0, 0x65198000 },
+    { 0xFF3FE3C0, 0x651B8000 }, { 0xFF3FFC00, 0x650E3000 }, { 0xFF3FFC00, 0x650F3000 },
+    { 0xFFFFE000, 0x65982000 }, { 0xFFFFE000, 0x65802000 }, { 0xFFFFE000, 0x6589A000 },
+    { 0xFFFFE000, 0x6588A000 }, { 0xFFFFE000, 0x659CA000 }, { 0xFFFFE000, 0x659DA000 },
+    { 0xFFFFE000, 0x65842000 }, { 0xFFFFE000, 0x65862000 }, { 0xFFFFE000, 0x65852000 },
+    { 0xFFFFE000, 0x65872000 }, { 0xFFFFE000, 0x6594A000 }, { 0xFFFFE000, 0x6595A000 },
+    { 0xFFFFE000, 0x658AA000 }, { 0xFF3FE010, 0x65122000 }, { 0xFF3FE010, 0x65102000 },
+    { 0xFF3FE010, 0x65102010 }, { 0xFF3FE010, 0x65112010 }, { 0xFF3FE010, 0x65112000 },
+    { 0xFF3FE010, 0x65132000 }, { 0xFF3FE000, 0x65088000 }, { 0xFF3FE000, 0x65008000 },
+    { 0xFF3FE000, 0x650D8000 }, { 0xFF3FE000, 0x650C8000 }, { 0xFF3FE000, 0x65068000 },
+    { 0xFF3FE000, 0x65048000 }, { 0xFF3FE000, 0x65078000 }, { 0xFF3FE000, 0x65058000 },
+    { 0xFF3FE000, 0x65028000 }, { 0xFF3FE000, 0x650A8000 }, { 0xFF3FE000, 0x650CA000 },
+    { 0xFF3FE000, 0x6504A000 }, { 0xFF3FE000, 0x6507A000 }, { 0xFF3FE000, 0x6502A000 },
+    { 0xFF3FE000, 0x6500A000 }, { 0xFF3FE000, 0x6501A000 }, { 0xFF3FE000, 0x6506A000 },
+    { 0xFF3FE000, 0x6503A000 }, { 0xFF3FE000, 0x65098000 }, { 0xFF3FE000, 0x650DA000 },
+    { 0xFF3FE000, 0x65018000 }, { 0xFF3FE000, 0x65038000 }, { 0xFF38FC00, 0x65108000 },
+    { 0xFF20FC00, 0x65000000 }, { 0xFF20FC00, 0x65000800 }, { 0xFF20FC00, 0x65001800 },
+    { 0xFF20FC00, 0x65001C00 }, { 0xFF20FC00, 0x65000400 }, { 0xFF20FC00, 0x65000C00 },
+    { 0xFF20E010, 0x6500C010 }, { 0xFF20E010, 0x6500E010 }, { 0xFF20E010, 0x65006000 },
+    { 0xFF20E010, 0x65004000 }, { 0xFF20E010, 0x65004010 }, { 0xFF20E010, 0x65006010 },
+    { 0xFF20E010, 0x6500C000 }, { 0x1E000000, 0x04000000 }, { 0xFF20E000, 0x65208000 },
+    { 0xFF20E000, 0x65200000 }, { 0xFF20E000, 0x65202000 }, { 0xFF20E000, 0x6520A000 },
+    { 0xFF20E000, 0x6520C000 }, { 0xFF20E000, 0x65204000 }, { 0xFF20E000, 0x65206000 },
+    { 0xFF20E000, 0x6520E000 }, { 0x1E000000, 0x04000000 }, { 0xFF3FE3C0, 0x65188000 },
+    { 0xFF3FE3C0, 0x651E8000 }, { 0xFF3FE3C0, 0x651C8000 }, { 0xFF3FE3C0, 0x651F8000 },
+    { 0xFF3FE3C0, 0x651D8000 }, { 0xFF3FE3C0, 0x651A8000 }, { 0xFF3FE3C0, 0x65198000 },
+    { 0xFF3FE3C0, 0x651B8000 }, { 0xFF3FFC00, 0x650E3000 }, { 0xFF3FFC00, 0x650F3000 },
+    { 0xFFFFE000, 0x65D82000 }, { 0xFFFFE000, 0x65C02000 }, { 0xFFFFE000, 0x65C9A000 },
+    { 0xFFFFE000, 0x65CBA000 }, { 0xFFFFE000, 0x65C8A000 }, { 0xFFFFE000, 0x65CAA000 },
+    { 0xFFFFE000, 0x65DCA000 }, { 0xFFFFE000, 0x65D8A000 }, { 0xFFFFE000, 0x65DEA000 },
+    { 0xFFFFE000, 0x65DDA000 }, { 0xFFFFE000, 0x65D9A000 }, { 0xFFFFE000, 0x65DFA000 },
+    { 0xFFFFE000, 0x65C42000 }, { 0xFFFFE000, 0x65C62000 }, { 0xFFFFE000, 0x65C52000 },
+    { 0xFFFFE000, 0x65C72000 }, { 0xFFFFE000, 0x65D0A000 }, { 0xFFFFE000, 0x65D4A000 },
+    { 0xFFFFE000, 0x65D6A000 }, { 0xFFFFE000, 0x65D1A000 }, { 0xFFFFE000, 0x65D5A000 },
+    { 0xFFFFE000, 0x65D7A000 }, { 0xFF3FE010, 0x65122000 }, { 0xFF3FE010, 0x65102000 },
+    { 0xFF3FE010, 0x65102010 }, { 0xFF3FE010, 0x65112010 }, { 0xFF3FE010, 0x65112000 },
+    { 0xFF3FE010, 0x65132000 }, { 0xFF3FE000, 0x65088000 }, { 0xFF3FE000, 0x65008000 },
+    { 0xFF3FE000, 0x650D8000 }, { 0xFF3FE000, 0x650C8000 }, { 0xFF3FE000, 0x65068000 },
+    { 0xFF3FE000, 0x65048000 }, { 0xFF3FE000, 0x65078000 }, { 0xFF3FE000, 0x65058000 },
+    { 0xFF3FE000, 0x65028000 }, { 0xFF3FE000, 0x650A8000 }, { 0xFF3FE000, 0x650CA000 },
+    { 0xFF3FE000, 0x6504A000 }, { 0xFF3FE000, 0x6507A000 }, { 0xFF3FE000, 0x6502A000 },
+    { 0xFF3FE000, 0x6500A000 }, { 0xFF3FE000, 0x6501A000 }, { 0xFF3FE000, 0x6506A000 },
+    { 0xFF3FE000, 0x6503A000 }, { 0xFF3FE000, 0x65098000 }, { 0xFF3FE000, 0x650DA000 },
+    { 0xFF3FE000, 0x65018000 }, { 0xFF3FE000, 0x65038000 }, { 0xFF38FC00, 0x65108000 },
+    { 0xFF20FC00, 0x65000000 }, { 0xFF20FC00, 0x65000800 }, { 0xFF20FC00, 0x65001800 },
+    { 0xFF20FC00, 0x65001C00 }, { 0xFF20FC00, 0x65000400 }, { 0xFF20FC00, 0x65000C00 },
+    { 0xFF20E010, 0x6500C010 }, { 0xFF20E010, 0x6500E010 }, { 0xFF20E010, 0x65006000 },
+    { 0xFF20E010, 0x65004000 }, { 0xFF20E010, 0x65004010 }, { 0xFF20E010, 0x65006010 },
+    { 0xFF20E010, 0x6500C000 }, { 0x1E000000, 0x04000000 }, { 0xFF20E000, 0x65208000 },
+    { 0xFF20E000, 0x65200000 }, { 0xFF20E000, 0x65202000 }, { 0xFF20E000, 0x6520A000 },
+    { 0xFF20E000, 0x6520C000 }, { 0xFF20E000, 0x65204000 }, { 0xFF20E000, 0x65206000 },
+    { 0xFF20E000, 0x6520E000 }, { 0x1E000000, 0x04000000 }, { 0xFE400000, 0x68000000 },
+    { 0xFE400000, 0x68000000 }, { 0xFE400000, 0x68000000 }, { 0xFE400000, 0x68000000 },
+    { 0xFE400000, 0x68000000 }, { 0xFE400000, 0x68000000 }, { 0xFE400000, 0x68000000 },
+    { 0xFE400000, 0x68000000 }, { 0xFFC00000, 0x6C000000 }, { 0xFE400000, 0x6C000000 },
+    { 0xFFC00000, 0x6C000000 }, { 0xFE400000, 0x6C000000 }, { 0xFFC00000, 0x6C400000 },
+    { 0xFE400000, 0x6C400000 }, { 0xFFC00000, 0x6C400000 }, { 0xFE400000, 0x6C400000 },
+    { 0xFE400000, 0x6C000000 }, { 0xFE400000, 0x6C000000 }, { 0xFE400000, 0x6C400000 },
+    { 0xFE400000, 0x6C400000 }, { 0xFE400000, 0x6C000000 }, { 0xFE400000, 0x6C000000 },
+    { 0xFE400000, 0x6C400000 }, { 0xFE400000, 0x6C400000 }, { 0xFE400000, 0x6C000000 },
+    { 0xFE400000, 0x6C000000 }, { 0xFE400000, 0x6C400000 }, { 0xFE400000, 0x6C400000 },
+    { 0xFFEFBC00, 0x6E080400 }, { 0xFFE79C00, 0x6E040400 }, { 0xFFE38C00, 0x6E020400 },
+    { 0xFF20FC00, 0x6E008400 }, { 0xFF20FC00, 0x6E008C00 }, { 0xFFE18400, 0x6E010400 },
+    { 0xFF20EC00, 0x6E00E400 }, { 0xFFE08400, 0x6E000000 }, { 0xFF20E400, 0x6E00C400 },
+    { 0xFFFFFC00, 0x6E21C800 }, { 0xFFFFFC00, 0x6E21B800 }, { 0xFFFFFC00, 0x6E21A800 },
+    { 0xFFFFFC00, 0x6E216800 }, { 0xFFFFFC00, 0x6E30C800 }, { 0xFFFFFC00, 0x6E30F800 },
+    { 0xFFFFFC00, 0x6E218800 }, { 0xFFFFFC00, 0x6E219800 }, { 0xFFFFFC00, 0x6E205800 },
+    { 0xFFFFFC00, 0x6E213800 }, { 0xFFFFFC00, 0x6E303800 }, { 0xFFFFFC00, 0x6E21D800 },
+    { 0xFFFFFC00, 0x6E30A800 }, { 0xFFFFFC00, 0x6E31A800 }, { 0xFFFFFC00, 0x6E217800 },
+    { 0xFFFFFC00, 0x6E21E800 }, { 0xFFFFFC00, 0x6E21F800 }, { 0xFF3FFC00, 0x6E204800 },
+    { 0xFF3FFC00, 0x6E209800 }, { 0xFF3FFC00, 0x6E208800 }, { 0xFF3FFC00, 0x6E20B800 },
+    { 0xFF3FFC00, 0x6E200800 }, { 0xFF3FFC00, 0x6E207800 }, { 0xFF3FFC00, 0x6E206800 },
+    { 0xFF3FFC00, 0x6E202800 }, { 0xFF3FFC00, 0x6E214800 }, { 0xFF3FFC00, 0x6E203800 },
+    { 0xFFE0FC00, 0x6E201C00 }, { 0xFFE0FC00, 0x6E20EC00 }, { 0xFFE0FC00, 0x6E20D400 },
+    { 0xFFE0FC00, 0x6E20E400 }, { 0xFFE0FC00, 0x6E20FC00 }, { 0xFFE0FC00, 0x6E20C400 },
+    { 0xFFE0FC00, 0x6E20F400 }, { 0xFFE0FC00, 0x6E20DC00 }, { 0xFFE0FC00, 0x6E209C00 },
+    { 0xFFE0FC00, 0x6E20CC00 }, { 0xFF20FC00, 0x6E208C00 }, { 0xFF20FC00, 0x6E203400 },
+    { 0xFF20FC00, 0x6E203C00 }, { 0xFF20FC00, 0x6E209400 }, { 0xFF20FC00, 0x6E204000 },
+    { 0xFF20FC00, 0x6E206000 }, { 0xFF20FC00, 0x6E20B400 }, { 0xFF20FC00, 0x6E208400 },
+    { 0xFF20FC00, 0x6E207C00 }, { 0xFF20FC00, 0x6E205000 }, { 0xFF20FC00, 0x6E207400 },
+    { 0xFF20FC00, 0x6E207000 }, { 0xFF20FC00, 0x6E200000 }, { 0xFF20FC00, 0x6E201000 },
+    { 0xFF20FC00, 0x6E200400 }, { 0xFF20FC00, 0x6E202400 }, { 0xFF20FC00, 0x6E206400 },
+    { 0xFF20FC00, 0x6E20A400 }, { 0xFF20FC00, 0x6E206C00 }, { 0xFF20FC00, 0x6E20AC00 },
+    { 0xFF20FC00, 0x6E208000 }, { 0xFF20FC00, 0x6E20A000 }, { 0xFF20FC00, 0x6E20C000 },
+    { 0xFF20FC00, 0x6E200C00 }, { 0xFF20FC00, 0x6E205C00 }, { 0xFF20FC00, 0x6E204C00 },
+    { 0xFF20FC00, 0x6E202C00 }, { 0xFF20FC00, 0x6E201400 }, { 0xFF20FC00, 0x6E205400 },
+    { 0xFF20FC00, 0x6E204400 }, { 0xFF20FC00, 0x6E202000 }, { 0xFF20FC00, 0x6E203000 },
+    { 0xFFE0FC00, 0x6E40FC00 }, { 0xFFE0FC00, 0x6E40EC00 }, { 0xFFE0FC00, 0x6E402C00 },
+    { 0xFFE0FC00, 0x6E401400 }, { 0xFFE0FC00, 0x6E402400 }, { 0xFFE0FC00, 0x6E403C00 },
+    { 0xFFE0FC00, 0x6E400400 }, { 0xFFE0FC00, 0x6E403400 }, { 0xFFE0FC00, 0x6E401C00 },
+    { 0xFF20FC00, 0x6E008400 }, { 0xFF20FC00, 0x6E008C00 }, { 0xFF20EC00, 0x6E00E400 },
+    { 0xFF20E400, 0x6E00C400 }, { 0xFFFFFC00, 0x6E61C800 }, { 0xFFFFFC00, 0x6E61B800 },
+    { 0xFFFFFC00, 0x6E61A800 }, { 0xFFFFFC00, 0x6E616800 }, { 0xFFFFFC00, 0x6E618800 },
+    { 0xFFFFFC00, 0x6E619800 }, { 0xFFFFFC00, 0x6E605800 }, { 0xFFFFFC00, 0x6E613800 },
+    { 0xFFFFFC00, 0x6E703800 }, { 0xFFFFFC00, 0x6E61D800 }, { 0xFFFFFC00, 0x6E70A800 },
+    { 0xFFFFFC00, 0x6E71A800 }, { 0xFFFFFC00, 0x6E79C800 }, { 0xFFFFFC00, 0x6E79B800 },
+    { 0xFFFFFC00, 0x6E79A800 }, { 0xFFFFFC00, 0x6E798800 }, { 0xFFFFFC00, 0x6E799800 },
+    { 0xFFFFFC00, 0x6E79D800 }, { 0xFFFFFC00, 0x6E617800 }, { 0xFFFFFC00, 0x6E61E800 },
+    { 0xFFFFFC00, 0x6E61F800 }, { 0xFF3FFC00, 0x6E204800 }, { 0xFF3FFC00, 0x6E209800 },
+    { 0xFF3FFC00, 0x6E208800 }, { 0xFF3FFC00, 0x6E20B800 }, { 0xFF3FFC00, 0x6E200800 },
+    { 0xFF3FFC00, 0x6E207800 }, { 0xFF3FFC00, 0x6E206800 }, { 0xFF3FFC00, 0x6E202800 },
+    { 0xFF3FFC00, 0x6E214800 }, { 0xFF3FFC00, 0x6E203800 }, { 0xFFE0FC00, 0x6E60EC00 },
+    { 0xFFE0FC00, 0x6E60D400 }, { 0xFFE0FC00, 0x6E60E400 }, { 0xFFE0FC00, 0x6E60FC00 },
+    { 0xFFE0FC00, 0x6E60C400 }, { 0xFFE0FC00, 0x6E60F400 }, { 0xFFE0FC00, 0x6E60DC00 },
+    { 0xFF20FC00, 0x6E208C00 }, { 0xFF20FC00, 0x6E203400 }, { 0xFF20FC00, 0x6E203C00 },
+    { 0xFF20FC00, 0x6E209400 }, { 0xFF20FC00, 0x6E204000 }, { 0xFF20FC00, 0x6E206000 },
+    { 0xFF20FC00, 0x6E20B400 }, { 0xFF20FC00, 0x6E208400 }, { 0xFF20FC00, 0x6E207C00 },
+    { 0xFF20FC00, 0x6E205000 }, { 0xFF20FC00, 0x6E207400 }, { 0xFF20FC00, 0x6E207000 },
+    { 0xFF20FC00, 0x6E200000 }, { 0xFF20FC00, 0x6E201000 }, { 0xFF20FC00, 0x6E200400 },
+    { 0xFF20FC00, 0x6E202400 }, { 0xFF20FC00, 0x6E206400 }, { 0xFF20FC00, 0x6E20A400 },
+    { 0xFF20FC00, 0x6E206C00 }, { 0xFF20FC00, 0x6E20AC00 }, { 0xFF20FC00, 0x6E208000 },
+    { 0xFF20FC00, 0x6E20A000 }, { 0xFF20FC00, 0x6E20C000 }, { 0xFF20FC00, 0x6E200C00 },
+    { 0xFF20FC00, 0x6E205C00 }, { 0xFF20FC00, 0x6E204C00 }, { 0xFF20FC00, 0x6E202C00 },
+    { 0xFF20FC00, 0x6E201400 }, { 0xFF20FC00, 0x6E205400 }, { 0xFF20FC00, 0x6E204400 },
+    { 0xFF20FC00, 0x6E202000 }, { 0xFF20FC00, 0x6E203000 }, { 0xFFE0FC00, 0x6E809400 },
+    { 0xFFE0FC00, 0x6E80A400 }, { 0xFF20FC00, 0x6E008400 }, { 0xFF20FC00, 0x6E008C00 },
+    { 0xFF20EC00, 0x6E00E400 }, { 0xFF20E400, 0x6E00C400 }, { 0xFFFFFC00, 0x6EA0C800 },
+    { 0xFFFFFC00, 0x6EA0D800 }, { 0xFFFFFC00, 0x6EA1A800 }, { 0xFFFFFC00, 0x6EA1B800 },
+    { 0xFFFFFC00, 0x6EB0C800 }, { 0xFFFFFC00, 0x6EB0F800 }, { 0xFFFFFC00, 0x6EA0F800 },
+    { 0xFFFFFC00, 0x6EA19800 }, { 0xFFFFFC00, 0x6EA1D800 }, { 0xFFFFFC00, 0x6EA1F800 },
+    { 0xFFFFFC00, 0x6EA13800 }, { 0xFFFFFC00, 0x6EB03800 }, { 0xFFFFFC00, 0x6EB0A800 },
+    { 0xFFFFFC00, 0x6EB1A800 }, { 0xFFFFFC00, 0x6EA1C800 }, { 0xFFFFFC00, 0x6EA17800 },
+    { 0xFF3FFC00, 0x6E204800 }, { 0xFF3FFC00, 0x6E209800 }, { 0xFF3FFC00, 0x6E208800 },
+    { 0xFF3FFC00, 0x6E20B800 }, { 0xFF3FFC00, 0x6E200800 }, { 0xFF3FFC00, 0x6E207800 },
+    { 0xFF3FFC00, 0x6E206800 }, { 0xFF3FFC00, 0x6E202800 }, { 0xFF3FFC00, 0x6E214800 },
+    { 0xFF3FFC00, 0x6E203800 }, { 0xFFE0FC00, 0x6EA0EC00 }, { 0xFFE0FC00, 0x6EA0E400 },
+    { 0xFFE0FC00, 0x6EA0C400 }, { 0xFFE0FC00, 0x6EA0F400 }, { 0xFFE0FC00, 0x6EA0DC00 },
+    { 0xFFE0FC00, 0x6EA0CC00 }, { 0xFFE0FC00, 0x6EA0FC00 }, { 0xFF20FC00, 0x6E208C00 },
+    { 0xFF20FC00, 0x6E203400 }, { 0xFF20FC00, 0x6E203C00 }, { 0xFF20FC00, 0x6E209400 },
+    { 0xFF20FC00, 0x6E204000 }, { 0xFF20FC00, 0x6E206000 }, { 0xFF20FC00, 0x6E20B400 },
+    { 0xFF20FC00, 0x6E208400 }, { 0xFF20FC00, 0x6E207C00 }, { 0xFF20FC00, 0x6E205000 },
+    { 0xFF20FC00, 0x6E207400 }, { 0xFF20FC00, 0x6E207000 }, { 0xFF20FC00, 0x6E200000 },
+    { 0xFF20FC00, 0x6E201000 }, { 0xFF20FC00, 0x6E200400 }, { 0xFF20FC00, 0x6E202400 },
+    { 0xFF20FC00, 0x6E206400 }, { 0xFF20FC00, 0x6E20A400 }, { 0xFF20FC00, 0x6E206C00 },
+    { 0xFF20FC00, 0x6E20AC00 }, { 0xFF20FC00, 0x6E208000 }, { 0xFF20FC00, 0x6E20A000 },
+    { 0xFF20FC00, 0x6E20C000 }, { 0xFF20FC00, 0x6E200C00 }, { 0xFF20FC00, 0x6E205C00 },
+    { 0xFF20FC00, 0x6E204C00 }, { 0xFF20FC00, 0x6E202C00 }, { 0xFF20FC00, 0x6E201400 },
+    { 0xFF20FC00, 0x6E205400 }, { 0xFF20FC00, 0x6E204400 }, { 0xFF20FC00, 0x6E202000 },
+    { 0xFF20FC00, 0x6E203000 }, { 0xFFE0FC00, 0x6EC0D400 }, { 0xFFE0FC00, 0x6EC0FC00 },
+    { 0xFFE0FC00, 0x6EC01C00 }, { 0xFFE0FC00, 0x6EC01400 }, { 0xFFE0FC00, 0x6EC02C00 },
+    { 0xFFE0FC00, 0x6EC02400 }, { 0xFFE0FC00, 0x6EC00400 }, { 0xFFE0FC00, 0x6EC03400 },
+    { 0xFFE0FC00, 0x6EC03C00 }, { 0xFF20FC00, 0x6E008400 }, { 0xFF20FC00, 0x6E008C00 },
+    { 0xFF20EC00, 0x6E00E400 }, { 0xFF20E400, 0x6E00C400 }, { 0xFFFFFC00, 0x6EE0C800 },
+    { 0xFFFFFC00, 0x6EE0D800 }, { 0xFFFFFC00, 0x6EE1A800 }, { 0xFFFFFC00, 0x6EE1B800 },
+    { 0xFFFFFC00, 0x6EE0F800 }, { 0xFFFFFC00, 0x6EE19800 }, { 0xFFFFFC00, 0x6EE1D800 },
+    { 0xFFFFFC00, 0x6EE1F800 }, { 0xFFFFFC00, 0x6EF8C800 }, { 0xFFFFFC00, 0x6EF8D800 },
+    { 0xFFFFFC00, 0x6EF9A800 }, { 0xFFFFFC00, 0x6EF9B800 }, { 0xFFFFFC00, 0x6EF8F800 },
+    { 0xFFFFFC00, 0x6EF99800 }, { 0xFFFFFC00, 0x6EF9D800 }, { 0xFFFFFC00, 0x6EF9F800 },
+    { 0xFFFFFC00, 0x6EE17800 }, { 0xFF3FFC00, 0x6E204800 }, { 0xFF3FFC00, 0x6E209800 },
+    { 0xFF3FFC00, 0x6E208800 }, { 0xFF3FFC00, 0x6E20B800 }, { 0xFF3FFC00, 0x6E200800 },
+    { 0xFF3FFC00, 0x6E207800 }, { 0xFF3FFC00, 0x6E206800 }, { 0xFF3FFC00, 0x6E202800 },
+    { 0xFF3FFC00, 0x6E214800 }, { 0xFF3FFC00, 0x6E203800 }, { 0xFFE0FC00, 0x6EE0EC00 },
+    { 0xFFE0FC00, 0x6EE0E400 }, { 0xFFE0FC00, 0x6EE0C400 }, { 0xFFE0FC00, 0x6EE0F400 },
+    { 0xFFE0FC00, 0x6EE0DC00 }, { 0xFFE0FC00, 0x6EE0FC00 }, { 0xFF20FC00, 0x6E208C00 },
+    { 0xFF20FC00, 0x6E203400 }, { 0xFF20FC00, 0x6E203C00 }, { 0xFF20FC00, 0x6E209400 },
+    { 0xFF20FC00, 0x6E204000 }, { 0xFF20FC00, 0x6E206000 }, { 0xFF20FC00, 0x6E20B400 },
+    { 0xFF20FC00, 0x6E208400 }, { 0xFF20FC00, 0x6E207C00 }, { 0xFF20FC00, 0x6E205000 },
+    { 0xFF20FC00, 0x6E207400 }, { 0xFF20FC00, 0x6E207000 }, { 0xFF20FC00, 0x6E200000 },
+    { 0xFF20FC00, 0x6E201000 }, { 0xFF20FC00, 0x6E200400 }, { 0xFF20FC00, 0x6E202400 },
+    { 0xFF20FC00, 0x6E206400 }, { 0xFF20FC00, 0x6E20A400 }, { 0xFF20FC00, 0x6E206C00 },
+    { 0xFF20FC00, 0x6E20AC00 }, { 0xFF20FC00, 0x6E208000 }, { 0xFF20FC00, 0x6E20A000 },
+    { 0xFF20FC00, 0x6E20C000 }, { 0xFF20FC00, 0x6E200C00 }, { 0xFF20FC00, 0x6E205C00 },
+    { 0xFF20FC00, 0x6E204C00 }, { 0xFF20FC00, 0x6E202C00 }, { 0xFF20FC00, 0x6E201400 },
+    { 0xFF20FC00, 0x6E205400 }, { 0xFF20FC00, 0x6E204400 }, { 0xFF20FC00, 0x6E202000 },
+    { 0xFF20FC00, 0x6E203000 }, { 0xFFF8FC00, 0x6F00F400 }, { 0xFF87FC00, 0x6F00A400 },
+    { 0xFFF80C00, 0x6F000400 }, { 0xFF80FC00, 0x6F00FC00 }, { 0xFF80FC00, 0x6F005400 },
+    { 0xFF80FC00, 0x6F009C00 }, { 0xFF80FC00, 0x6F006400 }, { 0xFF80FC00, 0x6F008400 },
+    { 0xFF80FC00, 0x6F004400 }, { 0xFF80FC00, 0x6F00E400 }, { 0xFF80FC00, 0x6F007400 },
+    { 0xFF80FC00, 0x6F002400 }, { 0xFF80FC00, 0x6F003400 }, { 0xFF80FC00, 0x6F00A400 },
+    { 0xFF80FC00, 0x6F000400 }, { 0xFF80FC00, 0x6F001400 }, { 0xFFC0F400, 0x6F009000 },
+    { 0xFFC0F400, 0x6F008000 }, { 0xDFF80C00, 0x4F000400 }, { 0xFF87FC00, 0x6F00A400 },
+    { 0xFF80FC00, 0x6F00FC00 }, { 0xFF80FC00, 0x6F005400 }, { 0xFF80FC00, 0x6F009C00 },
+    { 0xFF80FC00, 0x6F006400 }, { 0xFF80FC00, 0x6F008400 }, { 0xFF80FC00, 0x6F004400 },
+    { 0xFF80FC00, 0x6F00E400 }, { 0xFF80FC00, 0x6F007400 }, { 0xFF80FC00, 0x6F002400 },
+    { 0xFF80FC00, 0x6F003400 }, { 0xFF80FC00, 0x6F00A400 }, { 0xFF80FC00, 0x6F000400 },
+    { 0xFF80FC00, 0x6F001400 }, { 0xFFC0F400, 0x6F009000 }, { 0xFFC0F400, 0x6F008000 },
+    { 0xFF87FC00, 0x6F00A400 }, { 0xFF80FC00, 0x6F00FC00 }, { 0xFFC0F400, 0x6F400000 },
+    { 0xFFC0F400, 0x6F404000 }, { 0xFF80FC00, 0x6F005400 }, { 0xFF80FC00, 0x6F009C00 },
+    { 0xFF80FC00, 0x6F006400 }, { 0xFF80FC00, 0x6F008400 }, { 0xFF80FC00, 0x6F004400 },
+    { 0xFF80FC00, 0x6F00E400 }, { 0xFFC0F400, 0x6F402000 }, { 0xFFC0F400, 0x6F406000 },
+    { 0xFFC0F400, 0x6F40A000 }, { 0xFF80FC00, 0x6F007400 }, { 0xFF80FC00, 0x6F002400 },
+    { 0xFF80FC00, 0x6F003400 }, { 0xFF80FC00, 0x6F00A400 }, { 0xFF80FC00, 0x6F000400 },
+    { 0xFF80FC00, 0x6F001400 }, { 0xFFC0F400, 0x6F408000 }, { 0xFFC0F400, 0x6F40D000 },
+    { 0xFFC0F400, 0x6F40F000 }, { 0xFFC09400, 0x6F409000 }, { 0xFF87FC00, 0x6F00A400 },
+    { 0xFFE0FC00, 0x6F601C00 }, { 0xFF80FC00, 0x6F00FC00 }, { 0xFFC0F400, 0x6F400000 },
+    { 0xFFC0F400, 0x6F404000 }, { 0xFF80FC00, 0x6F005400 }, { 0xFF80FC00, 0x6F009C00 },
+    { 0xFF80FC00, 0x6F006400 }, { 0xFF80FC00, 0x6F008400 }, { 0xFF80FC00, 0x6F004400 },
+    { 0xFF80FC00, 0x6F00E400 }, { 0xFFC0F400, 0x6F402000 }, { 0xFFC0F400, 0x6F406000 },
+    { 0xFFC0F400, 0x6F40A000 }, { 0xFF80FC00, 0x6F007400 }, { 0xFF80FC00, 0x6F002400 },
+    { 0xFF80FC00, 0x6F003400 }, { 0xFF80FC00, 0x6F00A400 }, { 0xFF80FC00, 0x6F000400 },
+    { 0xFF80FC00, 0x6F001400 }, { 0xFFC0F400, 0x6F408000 }, { 0xFFC0F400, 0x6F40D000 },
+    { 0xFFC0F400, 0x6F40F000 }, { 0xFFC09400, 0x6F409000 }, { 0xFFC0F400, 0x6F809000 },
+    { 0xFFC0F400, 0x6F800000 }, { 0xFFC0F400, 0x6F804000 }, { 0xFFC0F400, 0x6F802000 },
+    { 0xFFC0F400, 0x6F806000 }, { 0xFFC0F400, 0x6F80A000 }, { 0xFFC0F400, 0x6F80E000 },
+    { 0xFFC0F400, 0x6F808000 }, { 0xFFC0F400, 0x6F80C000 }, { 0xFFC0F400, 0x6F80D000 },
+    { 0xFFC0F400, 0x6F80F000 }, { 0xFFE09400, 0x6F809000 }, { 0xFFE0FC00, 0x6FA01C00 },
+    { 0xFFC0F400, 0x6F809000 }, { 0xFFC0F400, 0x6F800000 }, { 0xFFC0F400, 0x6F804000 },
+    { 0xFFC0F400, 0x6F802000 }, { 0xFFC0F400, 0x6F806000 }, { 0xFFC0F400, 0x6F80A000 },
+    { 0xFFC0F400, 0x6F80E000 }, { 0xFFC0F400, 0x6F808000 }, { 0xFFC0F400, 0x6F80C000 },
+    { 0xFFC0F400, 0x6F80D000 }, { 0xFFC0F400, 0x6F80F000 }, { 0xFFE0F400, 0x6FC09000 },
+    { 0xFFE0FC00, 0x6FE01C00 }, { 0xFFE0FC1F, 0x7820001F }, { 0xFFE0FC1F, 0x7820101F },
+    { 0xFFE0FC1F, 0x7820201F }, { 0xFFE0FC1F, 0x7820301F }, { 0xFFE0FC1F, 0x7820401F },
+    { 0xFFE0FC1F, 0x7820501F }, { 0xFFE0FC1F, 0x7820601F }, { 0xFFE0FC1F, 0x7820701F },
+    { 0xFFE0FC00, 0x78200000 }, { 0xFFE0FC00, 0x78201000 }, { 0xFFE0FC00, 0x78202000 },
+    { 0xFFE0FC00, 0x78203000 }, { 0xFFE0FC00, 0x78204000 }, { 0xFFE0FC00, 0x78205000 },
+    { 0xFFE0FC00, 0x78206000 }, { 0xFFE0FC00, 0x78207000 }, { 0xFFE0FC00, 0x78208000 },
+    { 0xFFE0FC00, 0x78209000 }, { 0xFFE0FC00, 0x7820B000 }, { 0xFFE0FC00, 0x7820A000 },
+    { 0xFFE0FC1F, 0x7860001F }, { 0xFFE0FC1F, 0x7860101F }, { 0xFFE0FC1F, 0x7860201F },
+    { 0xFFE0FC1F, 0x7860301F }, { 0xFFE0FC1F, 0x7860401F }, { 0xFFE0FC1F, 0x7860501F },
+    { 0xFFE0FC1F, 0x7860601F }, { 0xFFE0FC1F, 0x7860701F }, { 0xFFE0FC00, 0x78600000 },
+    { 0xFFE0FC00, 0x78601000 }, { 0xFFE0FC00, 0x78602000 }, { 0xFFE0FC00, 0x78603000 },
+    { 0xFFE0FC00, 0x78604000 }, { 0xFFE0FC00, 0x78605000 }, { 0xFFE0FC00, 0x78606000 },
+    { 0xFFE0FC00, 0x78607000 }, { 0xFFE0FC00, 0x78608000 }, { 0xFFE0FC00, 0x78609000 },
+    { 0xFFE0FC00, 0x7860B000 }, { 0xFFE0FC00, 0x7860A000 }, { 0xFFFFFC00, 0x78BFC000 },
+    { 0xFFE0FC1F, 0x78A0001F }, { 0xFFE0FC1F, 0x78A0101F }, { 0xFFE0FC1F, 0x78A0201F },
+    { 0xFFE0FC1F, 0x78A0301F }, { 0xFFE0FC1F, 0x78A0401F }, { 0xFFE0FC1F, 0x78A0501F },
+    { 0xFFE0FC1F, 0x78A0601F }, { 0xFFE0FC1F, 0x78A0701F }, { 0xFFE0FC00, 0x78A00000 },
+    { 0xFFE0FC00, 0x78A01000 }, { 0xFFE0FC00, 0x78A02000 }, { 0xFFE0FC00, 0x78A03000 },
+    { 0xFFE0FC00, 0x78A04000 }, { 0xFFE0FC00, 0x78A05000 }, { 0xFFE0FC00, 0x78A06000 },
+    { 0xFFE0FC00, 0x78A07000 }, { 0xFFE0FC00, 0x78A08000 }, { 0xFFE0FC00, 0x78A09000 },
+    { 0xFFE0FC00, 0x78A0B000 }, { 0xFFE0FC00, 0x78A0A000 }, { 0xFFE0FC1F, 0x78E0001F },
+    { 0xFFE0FC1F, 0x78E0101F }, { 0xFFE0FC1F, 0x78E0201F }, { 0xFFE0FC1F, 0x78E0301F },
+    { 0xFFE0FC1F, 0x78E0401F }, { 0xFFE0FC1F, 0x78E0501F }, { 0xFFE0FC1F, 0x78E0601F },
+    { 0xFFE0FC1F, 0x78E0701F }, { 0xFFE0FC00, 0x78E00000 }, { 0xFFE0FC00, 0x78E01000 },
+    { 0xFFE0FC00, 0x78E02000 }, { 0xFFE0FC00, 0x78E03000 }, { 0xFFE0FC00, 0x78E04000 },
+    { 0xFFE0FC00, 0x78E05000 }, { 0xFFE0FC00, 0x78E06000 }, { 0xFFE0FC00, 0x78E07000 },
+    { 0xFFE0FC00, 0x78E08000 }, { 0xFFE0FC00, 0x78E09000 }, { 0xFFE0FC00, 0x78E0B000 },
+    { 0xFFE0FC00, 0x78E0A000 }, { 0xFFE00C00, 0x7C000C00 }, { 0xFFE00C00, 0x7C000400 },
+    { 0xFFE00C00, 0x7C000000 }, { 0xFFE00C00, 0x7C200800 }, { 0xFFE00C00, 0x7C400C00 },
+    { 0xFFE00C00, 0x7C400400 }, { 0xFFE00C00, 0x7C400000 }, { 0xFFE00C00, 0x7C600800 },
+    { 0xFFC00000, 0x7D000000 }, { 0xFFC00000, 0x7D000000 }, { 0xFFC00000, 0x7D400000 },
+    { 0xFFC00000, 0x7D400000 }, { 0xFFFFFC00, 0x7E30D800 }, { 0xFFFFFC00, 0x7E21C800 },
+    { 0xFFFFFC00, 0x7E21B800 }, { 0xFFFFFC00, 0x7E21A800 }, { 0xFFFFFC00, 0x7E30C800 },
+    { 0xFFFFFC00, 0x7E30F800 }, { 0xFFFFFC00, 0x7E21D800 }, { 0xFFFFFC00, 0x7E214800 },
+    { 0xFF3FFC00, 0x7E207800 }, { 0xFF3FFC00, 0x7E203800 }, { 0xFFE0FC00, 0x7E20EC00 },
+    { 0xFFE0FC00, 0x7E20E400 }, { 0xFFE0FC00, 0x7E205C00 }, { 0xFFE0FC00, 0x7E204C00 },
+    { 0xFF20FC00, 0x7E200C00 }, { 0xFF20FC00, 0x7E202C00 }, { 0xFFE0FC00, 0x7E40EC00 },
+    { 0xFFE0FC00, 0x7E402C00 }, { 0xFFE0FC00, 0x7E402400 }, { 0xFFE0FC00, 0x7E408400 },
+    { 0xFFE0FC00, 0x7E408C00 }, { 0xFFFFFC00, 0x7E70D800 }, { 0xFFFFFC00, 0x7E61C800 },
+    { 0xFFFFFC00, 0x7E61B800 }, { 0xFFFFFC00, 0x7E61A800 }, { 0xFFFFFC00, 0x7E616800 },
+    { 0xFFFFFC00, 0x7E70C800 }, { 0xFFFFFC00, 0x7E70F800 }, { 0xFFFFFC00, 0x7E61D800 },
+    { 0xFFFFFC00, 0x7E614800 }, { 0xFFFFFC00, 0x7E79C800 }, { 0xFFFFFC00, 0x7E79B800 },
+    { 0xFFFFFC00, 0x7E79A800 }, { 0xFFFFFC00, 0x7E79D800 }, { 0xFF3FFC00, 0x7E207800 },
+    { 0xFF3FFC00, 0x7E203800 }, { 0xFFE0FC00, 0x7E60E400 }, { 0xFFE0FC00, 0x7E60B400 },
+    { 0xFFE0FC00, 0x7E605C00 }, { 0xFFE0FC00, 0x7E604C00 }, { 0xFF20FC00, 0x7E200C00 },
+    { 0xFF20FC00, 0x7E202C00 }, { 0xFFE0FC00, 0x7E808400 }, { 0xFFE0FC00, 0x7E808C00 },
+    { 0xFFFFFC00, 0x7EA0C800 }, { 0xFFFFFC00, 0x7EA0D800 }, { 0xFFFFFC00, 0x7EA1A800 },
+    { 0xFFFFFC00, 0x7EA1B800 }, { 0xFFFFFC00, 0x7EB0C800 }, { 0xFFFFFC00, 0x7EB0F800 },
+    { 0xFFFFFC00, 0x7EA1D800 }, { 0xFFFFFC00, 0x7EA14800 }, { 0xFF3FFC00, 0x7E207800 },
+    { 0xFF3FFC00, 0x7E203800 }, { 0xFFE0FC00, 0x7EA0D400 }, { 0xFFE0FC00, 0x7EA0EC00 },
+    { 0xFFE0FC00, 0x7EA0E400 }, { 0xFFE0FC00, 0x7EA0B400 }, { 0xFFE0FC00, 0x7EA05C00 },
+    { 0xFFE0FC00, 0x7EA04C00 }, { 0xFF20FC00, 0x7E200C00 }, { 0xFF20FC00, 0x7E202C00 },
+    { 0xFFE0FC00, 0x7EC0EC00 }, { 0xFFE0FC00, 0x7EC01400 }, { 0xFFE0FC00, 0x7EC02C00 },
+    { 0xFFE0FC00, 0x7EC02400 }, { 0xFFFFFC00, 0x7EE08800 }, { 0xFFFFFC00, 0x7EE09800 },
+    { 0xFFFFFC00, 0x7EE0C800 }, { 0xFFFFFC00, 0x7EE0D800 }, { 0xFFFFFC00, 0x7EE1A800 },
+    { 0xFFFFFC00, 0x7EE1B800 }, { 0xFFFFFC00, 0x7EF0C800 }, { 0xFFFFFC00, 0x7EF0F800 },
+    { 0xFFFFFC00, 0x7EE1D800 }, { 0xFFFFFC00, 0x7EE0B800 }, { 0xFFFFFC00, 0x7EF8C800 },
+    { 0xFFFFFC00, 0x7EF8D800 }, { 0xFFFFFC00, 0x7EF9A800 }, { 0xFFFFFC00, 0x7EF9B800 },
+    { 0xFFFFFC00, 0x7EF9D800 }, { 0xFF3FFC00, 0x7E207800 }, { 0xFF3FFC00, 0x7E203800 },
+    { 0xFFE0FC00, 0x7EE08C00 }, { 0xFFE0FC00, 0x7EE03400 }, { 0xFFE0FC00, 0x7EE03C00 },
+    { 0xFFE0FC00, 0x7EE0D400 }, { 0xFFE0FC00, 0x7EE0E400 }, { 0xFFE0FC00, 0x7EE08400 },
+    { 0xFFE0FC00, 0x7EE05C00 }, { 0xFFE0FC00, 0x7EE04C00 }, { 0xFFE0FC00, 0x7EE05400 },
+    { 0xFFE0FC00, 0x7EE04400 }, { 0xFF20FC00, 0x7E200C00 }, { 0xFF20FC00, 0x7E202C00 },
+    { 0xFF80FC00, 0x7F00FC00 }, { 0xFF80FC00, 0x7F005400 }, { 0xFF80FC00, 0x7F009C00 },
+    { 0xFF80FC00, 0x7F006400 }, { 0xFF80FC00, 0x7F008400 }, { 0xFF80FC00, 0x7F004400 },
+    { 0xFF80FC00, 0x7F00E400 }, { 0xFF80FC00, 0x7F007400 }, { 0xFF80FC00, 0x7F009400 },
+    { 0xFF80FC00, 0x7F002400 }, { 0xFF80FC00, 0x7F003400 }, { 0xFF80FC00, 0x7F000400 },
+    { 0xFF80FC00, 0x7F001400 }, { 0xFFC0F400, 0x7F009000 }, { 0xFF80FC00, 0x7F00FC00 },
+    { 0xFF80FC00, 0x7F005400 }, { 0xFF80FC00, 0x7F009C00 }, { 0xFF80FC00, 0x7F006400 },
+    { 0xFF80FC00, 0x7F008400 }, { 0xFF80FC00, 0x7F004400 }, { 0xFF80FC00, 0x7F00E400 },
+    { 0xFF80FC00, 0x7F007400 }, { 0xFF80FC00, 0x7F009400 }, { 0xFF80FC00, 0x7F002400 },
+    { 0xFF80FC00, 0x7F003400 }, { 0xFF80FC00, 0x7F000400 }, { 0xFF80FC00, 0x7F001400 },
+    { 0xFFC0F400, 0x7F009000 }, { 0xFF80FC00, 0x7F00FC00 }, { 0xFF80FC00, 0x7F005400 },
+    { 0xFF80FC00, 0x7F009C00 }, { 0xFF80FC00, 0x7F006400 }, { 0xFF80FC00, 0x7F008400 },
+    { 0xFF80FC00, 0x7F004400 }, { 0xFF80FC00, 0x7F00E400 }, { 0xFF80FC00, 0x7F007400 },
+    { 0xFF80FC00, 0x7F009400 }, { 0xFF80FC00, 0x7F002400 }, { 0xFF80FC00, 0x7F003400 },
+    { 0xFF80FC00, 0x7F000400 }, { 0xFF80FC00, 0x7F001400 }, { 0xFFC0F400, 0x7F40D000 },
+    { 0xFFC0F400, 0x7F40F000 }, { 0xFF80FC00, 0x7F00FC00 }, { 0xFF80FC00, 0x7F005400 },
+    { 0xFF80FC00, 0x7F009C00 }, { 0xFF80FC00, 0x7F006400 }, { 0xFF80FC00, 0x7F008400 },
+    { 0xFF80FC00, 0x7F004400 }, { 0xFF80FC00, 0x7F00E400 }, { 0xFF80FC00, 0x7F007400 },
+    { 0xFF80FC00, 0x7F009400 }, { 0xFF80FC00, 0x7F002400 }, { 0xFF80FC00, 0x7F003400 },
+    { 0xFF80FC00, 0x7F000400 }, { 0xFF80FC00, 0x7F001400 }, { 0xFFC0F400, 0x7F40D000 },
+    { 0xFFC0F400, 0x7F40F000 }, { 0xFFC0F400, 0x7F809000 }, { 0xFFC0F400, 0x7F80D000 },
+    { 0xFFC0F400, 0x7F80F000 }, { 0xFFC0F400, 0x7F809000 }, { 0xFFC0F400, 0x7F80D000 },
+    { 0xFFC0F400, 0x7F80F000 }, { 0xFFE0F400, 0x7FC09000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0xFFFFFC00, 0x889F7C00 }, { 0xFFE0FC00, 0x88A07C00 },
+    { 0xFFE0FC00, 0x88A0FC00 }, { 0xFFFFFC00, 0x88DF7C00 }, { 0xFFE0FC00, 0x88E07C00 },
+    { 0xFFE0FC00, 0x88E0FC00 }, { 0xFFC0C000, 0x91800000 }, { 0xFFC0C000, 0x91800000 },
+    { 0xFFFC0000, 0x91C00000 }, { 0xFFFC0000, 0x91C80000 }, { 0xFFFC0000, 0x91C40000 },
+    { 0xFFFC0000, 0x91CC0000 }, { 0xFFE0FC00, 0x99001800 }, { 0xFFE0FC00, 0x99000800 },
+    { 0xFFE00C00, 0x99000000 }, { 0xFFE0FC00, 0x99401800 }, { 0xFFE0FC00, 0x99400800 },
+    { 0xFFE00C00, 0x99400000 }, { 0xFFE00C00, 0x99800000 }, { 0xFFE0E000, 0x9A002000 },
+    { 0xFFE0FC00, 0x9AC04C00 }, { 0xFFE0FC00, 0x9AC05C00 }, { 0xFFE0FC00, 0x9AC06000 },
+    { 0xFFE0FC00, 0x9AC06800 }, { 0xFFE0FC00, 0x9AC06400 }, { 0xFFE0FC00, 0x9AC06C00 },
+    { 0xFFE0FC00, 0x9AC01400 }, { 0xFFE0FC00, 0x9AC01000 }, { 0xFFE0FC00, 0x9AC00000 },
+    { 0xFFE0FC00, 0x9AC03000 }, { 0xFFE08000, 0x9B600000 }, { 0xFFE08000, 0x9B608000 },
+    { 0xFF000000, 0x9C000000 }, { 0xFF000000, 0x9C000000 }, { 0xFF000000, 0x9C000000 },
+    { 0xFF000000, 0x9C000000 }, { 0xFF000000, 0x9C000000 }, { 0xFF000000, 0x9C000000 },
+    { 0xFF000000, 0x9C000000 }, { 0xFF000000, 0x9C000000 }, { 0xFFE00C00, 0x9D000800 },
+    { 0xFFE00C00, 0x9D400800 }, { 0xFFFF0000, 0x9E180000 }, { 0xFFFF0000, 0x9E190000 },
+    { 0xFFFF0000, 0x9E020000 }, { 0xFFFF0000, 0x9E030000 }, { 0xFFFFFC00, 0x9E240000 },
+    { 0xFFFFFC00, 0x9E250000 }, { 0xFFFFFC00, 0x9E300000 }, { 0xFFFFFC00, 0x9E310000 },
+    { 0xFFFFFC00, 0x9E200000 }, { 0xFFFFFC00, 0x9E210000 }, { 0xFFFFFC00, 0x9E280000 },
+    { 0xFFFFFC00, 0x9E290000 }, { 0xFFFFFC00, 0x9E380000 }, { 0xFFFFFC00, 0x9E390000 },
+    { 0xFFFFFC00, 0x9E220000 }, { 0xFFFFFC00, 0x9E230000 }, { 0xFFFF0000, 0x9E580000 },
+    { 0xFFFF0000, 0x9E590000 }, { 0xFFFF0000, 0x9E420000 }, { 0xFFFF0000, 0x9E430000 },
+    { 0xFFFFFC00, 0x9E640000 }, { 0xFFFFFC00, 0x9E650000 }, { 0xFFFFFC00, 0x9E700000 },
+    { 0xFFFFFC00, 0x9E710000 }, { 0xFFFFFC00, 0x9E600000 }, { 0xFFFFFC00, 0x9E610000 },
+    { 0xFFFFFC00, 0x9E680000 }, { 0xFFFFFC00, 0x9E690000 }, { 0xFFFFFC00, 0x9E780000 },
+    { 0xFFFFFC00, 0x9E790000 }, { 0xFFFFFC00, 0x9E660000 }, { 0xFFFFFC00, 0x9E670000 },
+    { 0xFFFFFC00, 0x9E620000 }, { 0xFFFFFC00, 0x9E630000 }, { 0xFFFFFC00, 0x9EAE0000 },
+    { 0xFFFFFC00, 0x9EAF0000 }, { 0xFFFF0000, 0x9ED80000 }, { 0xFFFF0000, 0x9ED90000 },
+    { 0xFFFF0000, 0x9EC20000 }, { 0xFFFF0000, 0x9EC30000 }, { 0xFFFFFC00, 0x9EE40000 },
+    { 0xFFFFFC00, 0x9EE50000 }, { 0xFFFFFC00, 0x9EF00000 }, { 0xFFFFFC00, 0x9EF10000 },
+    { 0xFFFFFC00, 0x9EE00000 }, { 0xFFFFFC00, 0x9EE10000 }, { 0xFFFFFC00, 0x9EE80000 },
+    { 0xFFFFFC00, 0x9EE90000 }, { 0xFFFFFC00, 0x9EF80000 }, { 0xFFFFFC00, 0x9EF90000 },
+    { 0xFFFFFC00, 0x9EE60000 }, { 0xFFFFFC00, 0x9EE70000 }, { 0xFFFFFC00, 0x9EE20000 },
+    { 0xFFFFFC00, 0x9EE30000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFC00000, 0xAC000000 }, { 0xFE400000, 0xAC000000 }, { 0xFFC00000, 0xAC000000 },
+    { 0xFE400000, 0xAC000000 }, { 0xFFC00000, 0xAC400000 }, { 0xFE400000, 0xAC400000 },
+    { 0xFFC00000, 0xAC400000 }, { 0xFE400000, 0xAC400000 }, { 0xFE400000, 0xAC000000 },
+    { 0xFE400000, 0xAC000000 }, { 0xFE400000, 0xAC400000 }, { 0xFE400000, 0xAC400000 },
+    { 0xFE400000, 0xAC000000 }, { 0xFE400000, 0xAC000000 }, { 0xFE400000, 0xAC400000 },
+    { 0xFE400000, 0xAC400000 }, { 0xFE400000, 0xAC000000 }, { 0xFE400000, 0xAC000000 },
+    { 0xFE400000, 0xAC400000 }, { 0xFE400000, 0xAC400000 }, { 0xFFE0FC1F, 0xB820001F },
+    { 0xFFE0FC1F, 0xB820101F }, { 0xFFE0FC1F, 0xB820201F }, { 0xFFE0FC1F, 0xB820301F },
+    { 0xFFE0FC1F, 0xB820401F }, { 0xFFE0FC1F, 0xB820501F }, { 0xFFE0FC1F, 0xB820601F },
+    { 0xFFE0FC1F, 0xB820701F }, { 0xFFE0FC00, 0xB8200000 }, { 0xFFE0FC00, 0xB8201000 },
+    { 0xFFE0FC00, 0xB8202000 }, { 0xFFE0FC00, 0xB8203000 }, { 0xFFE0FC00, 0xB8204000 },
+    { 0xFFE0FC00, 0xB8205000 }, { 0xFFE0FC00, 0xB8206000 }, { 0xFFE0FC00, 0xB8207000 },
+    { 0xFFE0FC00, 0xB8208000 }, { 0xFFE0FC1F, 0xB860001F }, { 0xFFE0FC1F, 0xB860101F },
+    { 0xFFE0FC1F, 0xB860201F }, { 0xFFE0FC1F, 0xB860301F }, { 0xFFE0FC1F, 0xB860401F },
+    { 0xFFE0FC1F, 0xB860501F }, { 0xFFE0FC1F, 0xB860601F }, { 0xFFE0FC1F, 0xB860701F },
+    { 0xFFE0FC00, 0xB8600000 }, { 0xFFE0FC00, 0xB8601000 }, { 0xFFE0FC00, 0xB8602000 },
+    { 0xFFE0FC00, 0xB8603000 }, { 0xFFE0FC00, 0xB8604000 }, { 0xFFE0FC00, 0xB8605000 },
+    { 0xFFE0FC00, 0xB8606000 }, { 0xFFE0FC00, 0xB8607000 }, { 0xFFE0FC00, 0xB8608000 },
+    { 0xFFFFFC00, 0xB8BFC000 }, { 0xFFE0FC1F, 0xB8A0001F }, { 0xFFE0FC1F, 0xB8A0101F },
+    { 0xFFE0FC1F, 0xB8A0201F }, { 0xFFE0FC1F, 0xB8A0301F }, { 0xFFE0FC1F, 0xB8A0401F },
+    { 0xFFE0FC1F, 0xB8A0501F }, { 0xFFE0FC1F, 0xB8A0601F }, { 0xFFE0FC1F, 0xB8A0701F },
+    { 0xFFE0FC00, 0xB8A00000 }, { 0xFFE0FC00, 0xB8A01000 }, { 0xFFE0FC00, 0xB8A02000 },
+    { 0xFFE0FC00, 0xB8A03000 }, { 0xFFE0FC00, 0xB8A04000 }, { 0xFFE0FC00, 0xB8A05000 },
+    { 0xFFE0FC00, 0xB8A06000 }, { 0xFFE0FC00, 0xB8A07000 }, { 0xFFE0FC00, 0xB8A08000 },
+    { 0xFFE0FC1F, 0xB8E0001F }, { 0xFFE0FC1F, 0xB8E0101F }, { 0xFFE0FC1F, 0xB8E0201F },
+    { 0xFFE0FC1F, 0xB8E0301F }, { 0xFFE0FC1F, 0xB8E0401F }, { 0xFFE0FC1F, 0xB8E0501F },
+    { 0xFFE0FC1F, 0xB8E0601F }, { 0xFFE0FC1F, 0xB8E0701F }, { 0xFFE0FC00, 0xB8E00000 },
+    { 0xFFE0FC00, 0xB8E01000 }, { 0xFFE0FC00, 0xB8E02000 }, { 0xFFE0FC00, 0xB8E03000 },
+    { 0xFFE0FC00, 0xB8E04000 }, { 0xFFE0FC00, 0xB8E05000 }, { 0xFFE0FC00, 0xB8E06000 },
+    { 0xFFE0FC00, 0xB8E07000 }, { 0xFFE0FC00, 0xB8E08000 }, { 0xFFE07C10, 0xBA000400 },
+    { 0xFFE0FC1F, 0xBAC0001F }, { 0xFFE00C00, 0xBC000C00 }, { 0xFFE00C00, 0xBC000400 },
+    { 0xFFE00C00, 0xBC000000 }, { 0xFFE00C00, 0xBC200800 }, { 0xFFE00C00, 0xBC400C00 },
+    { 0xFFE00C00, 0xBC400400 }, { 0xFFE00C00, 0xBC400000 }, { 0xFFE00C00, 0xBC600800 },
+    { 0xFFC00000, 0xBD000000 }, { 0xFFC00000, 0xBD000000 }, { 0xFFC00000, 0xBD400000 },
+    { 0xFFC00000, 0xBD400000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFFC00, 0xC89F7C00 }, { 0xFFE0FC00, 0xC8A07C00 }, { 0xFFE0FC00, 0xC8A0FC00 },
+    { 0xFFFFFC00, 0xC8DF7C00 }, { 0xFFE0FC00, 0xC8E07C00 }, { 0xFFE0FC00, 0xC8E0FC00 },
+    { 0xFFE08000, 0xCE000000 }, { 0xFFE08000, 0xCE200000 }, { 0xFFE0CC00, 0xCE408000 },
+    { 0xFFE0CC00, 0xCE408400 }, { 0xFFE0CC00, 0xCE408800 }, { 0xFFE0CC00, 0xCE408C00 },
+    { 0xFFE08000, 0xCE400000 }, { 0xFFE0FC00, 0xCE608C00 }, { 0xFFE0FC00, 0xCE608000 },
+    { 0xFFE0FC00, 0xCE608400 }, { 0xFFE0FC00, 0xCE608800 }, { 0xFFE0FC00, 0xCE60C000 },
+    { 0xFFE0FC00, 0xCE60C400 }, { 0xFFE0FC00, 0xCE60C800 }, { 0xFFE00000, 0xCE800000 },
+    { 0xFFFFFC00, 0xCEC08000 }, { 0xFFFFFC00, 0xCEC08400 }, { 0xFFC0C000, 0xD1800000 },
+    { 0xFFC0C000, 0xD1800000 }, { 0xFFE0001F, 0xD4600000 }, { 0xFFFFFFFF, 0xD503251F },
+    { 0xFFFFFFFF, 0xD50322DF }, { 0xFFFFFFFF, 0xD50320DF }, { 0xFFFFFFFF, 0xD500401F },
+    { 0xFFFFFFFF, 0xD500405F }, { 0xFFFFFFFF, 0xD500403F }, { 0xFFFFFFFF, 0xD503227F },
+    { 0xFFFFFFFF, 0xD50877BF }, { 0xFFFFFFFF, 0xD50877DF }, { 0xFFFFFFFF, 0xD508779F },
+    { 0xFFFFFFFF, 0xD503219F }, { 0xFFFFFFFF, 0xD50323BF }, { 0xFFFFFFFF, 0xD503239F },
+    { 0xFFFFFFFF, 0xD50321DF }, { 0xFFFFFFFF, 0xD50323FF }, { 0xFFFFFFFF, 0xD50323DF },
+    { 0xFFFFFFFF, 0xD503211F }, { 0xFFFFFFFF, 0xD503233F }, { 0xFFFFFFFF, 0xD503231F },
+    { 0xFFFFFFFF, 0xD503215F }, { 0xFFFFFFFF, 0xD503237F }, { 0xFFFFFFFF, 0xD503235F },
+    { 0xFFFFFFFF, 0xD50320FF }, { 0xFFFFFFFF, 0xD503221F }, { 0xFFFFFFFF, 0xD50330FF },
+    { 0xFFFFFFFF, 0xD503223F }, { 0xFFFFFFFF, 0xD503307F }, { 0xFFFFFFFF, 0xD503225F },
+    { 0xFFFFF9FF, 0xD503417F }, { 0xFFFFF9FF, 0xD503407F }, { 0xFFFFFF1F, 0xD509721F },
+    { 0xFFFFFF1F, 0xD503241F }, { 0xFFFFFFE0, 0xD50877A0 }, { 0xFFFFFFE0, 0xD50877C0 },
+    { 0xFFFFFFE0, 0xD50B7700 }, { 0xFFFFFFE0, 0xD5087780 }, { 0xFFFFFFE0, 0xD50B7740 },
+    { 0xFFFFFFE0, 0xD50B72E0 }, { 0xFFFFFFE0, 0xD50B7380 }, { 0xFFFFFFE0, 0xD50B73E0 },
+    { 0xFFFFFFE0, 0xD50B73A0 }, { 0xFFFFFFE0, 0xD50B73C0 }, { 0xFFFFFFE0, 0xD5031000 },
+    { 0xFFFFFFE0, 0xD5031020 }, { 0xFFFFFF00, 0xD5097200 }, { 0xFFFFFFE0, 0xD52B7720 },
+    { 0xFFFFFFE0, 0xD52B7760 }, { 0xFFFFFFE0, 0xD5233060 }, { 0xFFFFFFE0, 0xD5233160 },
+    { 0xFFF80000, 0xD5480000 }, { 0xFFF00000, 0xD5500000 }, { 0xFFF00000, 0xD5700000 },
+    { 0xFFFFFC1F, 0xD61F081F }, { 0xFFFFFC1F, 0xD61F0C1F }, { 0xFFFFFC1F, 0xD63F081F },
+    { 0xFFFFFC1F, 0xD63F0C1F }, { 0xFFFFFFFF, 0xD65F0BFF }, { 0xFFFFFFFF, 0xD65F0FFF },
+    { 0xFFFFFFFF, 0xD69F0BFF }, { 0xFFFFFFFF, 0xD69F0FFF }, { 0xFFFFFC00, 0xD71F0800 },
+    { 0xFFFFFC00, 0xD71F0C00 }, { 0xFFFFFC00, 0xD73F0800 }, { 0xFFFFFC00, 0xD73F0C00 },
+    { 0xFFFFFC00, 0xD91F0C00 }, { 0xFFFFFC00, 0xD91F1C00 }, { 0xFFE0FC00, 0xD9001800 },
+    { 0xFFE0FC00, 0xD9000800 }, { 0xFFE00C00, 0xD9000000 }, { 0xFFFFFC00, 0xD9200000 },
+    { 0xFFE00000, 0xD9200000 }, { 0xFFE0FC00, 0xD9401800 }, { 0xFFE0FC00, 0xD9400800 },
+    { 0xFFE00C00, 0xD9400000 }, { 0xFFE00C00, 0xD9600000 }, { 0xFFE00000, 0xD9600000 },
+    { 0xFFFFFC00, 0xD9A00000 }, { 0xFFE00000, 0xD9A00000 }, { 0xFFFFFC00, 0xD9E00000 },
+    { 0xFFE00000, 0xD9E00000 }, { 0xFFE0E000, 0xDA002000 }, { 0xFFFFFFE0, 0xDAC13BE0 },
+    { 0xFFFFFFE0, 0xDAC13FE0 }, { 0xFFFFFFE0, 0xDAC133E0 }, { 0xFFFFFFE0, 0xDAC137E0 },
+    { 0xFFFFFFE0, 0xDAC12BE0 }, { 0xFFFFFFE0, 0xDAC12FE0 }, { 0xFFFFFFE0, 0xDAC123E0 },
+    { 0xFFFFFFE0, 0xDAC127E0 }, { 0xFFFFFFE0, 0xDAC147E0 }, { 0xFFFFFFE0, 0xDAC143E0 },
+    { 0xFFFFFC00, 0xDAC02000 }, { 0xFFFFFC00, 0xDAC01C00 }, { 0xFFFFFC00, 0xDAC01800 },
+    { 0xFFFFFC00, 0xDAC11800 }, { 0xFFFFFC00, 0xDAC11C00 }, { 0xFFFFFC00, 0xDAC11000 },
+    { 0xFFFFFC00, 0xDAC11400 }, { 0xFFFFFC00, 0xDAC10800 }, { 0xFFFFFC00, 0xDAC10C00 },
+    { 0xFFFFFC00, 0xDAC10000 }, { 0xFFFFFC00, 0xDAC10400 }, { 0xFFE00C00, 0xDD000800 },
+    { 0xFFE00C00, 0xDD400800 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 },
+    { 0x9E000000, 0x80000000 }, { 0x9E000000, 0x80000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 }, { 0x1E000000, 0x04000000 },
+    { 0xFFFFFC00, 0xF83FD000 }, { 0xFFFFFC00, 0xF83F9000 }, { 0xFFE0FC1F, 0xF820001F },
+    { 0xFFE0FC1F, 0xF820101F }, { 0xFFE0FC1F, 0xF820201F }, { 0xFFE0FC1F, 0xF820301F },
+    { 0xFFE0FC1F, 0xF820401F }, { 0xFFE0FC1F, 0xF820501F }, { 0xFFE0FC1F, 0xF820601F },
+    { 0xFFE0FC1F, 0xF820701F }, { 0xFFE0FC00, 0xF820A000 }, { 0xFFE0FC00, 0xF820B000 },
+    { 0xFFE0FC00, 0xF8200000 }, { 0xFFE0FC00, 0xF8201000 }, { 0xFFE0FC00, 0xF8202000 },
+    { 0xFFE0FC00, 0xF8203000 }, { 0xFFE0FC00, 0xF8204000 }, { 0xFFE0FC00, 0xF8205000 },
+    { 0xFFE0FC00, 0xF8206000 }, { 0xFFE0FC00, 0xF8207000 }, { 0xFFE0FC00, 0xF8208000 },
+    { 0xFFA00400, 0xF8200400 }, { 0xFFE0FC1F, 0xF860001F }, { 0xFFE0FC1F, 0xF860101F },
+    { 0xFFE0FC1F, 0xF860201F }, { 0xFFE0FC1F, 0xF860301F }, { 0xFFE0FC1F, 0xF860401F },
+    { 0xFFE0FC1F, 0xF860501F }, { 0xFFE0FC1F, 0xF860601F }, { 0xFFE0FC1F, 0xF860701F },
+    { 0xFFE0FC00, 0xF8600000 }, { 0xFFE0FC00, 0xF8601000 }, { 0xFFE0FC00, 0xF8602000 },
+    { 0xFFE0FC00, 0xF8603000 }, { 0xFFE0FC00, 0xF8604000 }, { 0xFFE0FC00, 0xF8605000 },
+    { 0xFFE0FC00, 0xF8606000 }, { 0xFFE0FC00, 0xF8607000 }, { 0xFFE0FC00, 0xF8608000 },
+    { 0xFFA00400, 0xF8200400 }, { 0xFFFFFC00, 0xF8BFC000 }, { 0xFFE0FC1F, 0xF8A0001F },
+    { 0xFFE0FC1F, 0xF8A0101F }, { 0xFFE0FC1F, 0xF8A0201F }, { 0xFFE0FC1F, 0xF8A0301F },
+    { 0xFFE0FC1F, 0xF8A0401F }, { 0xFFE0FC1F, 0xF8A0501F }, { 0xFFE0FC1F, 0xF8A0601F },
+    { 0xFFE0FC1F, 0xF8A0701F }, { 0xFFE0FC00, 0xF8A00000 }, { 0xFFE0FC00, 0xF8A01000 },
+    { 0xFFE0FC00, 0xF8A02000 }, { 0xFFE0FC00, 0xF8A03000 }, { 0xFFE0FC00, 0xF8A04000 },
+    { 0xFFE0FC00, 0xF8A05000 }, { 0xFFE0FC00, 0xF8A06000 }, { 0xFFE0FC00, 0xF8A07000 },
+    { 0xFFE0FC00, 0xF8A08000 }, { 0xFFE04C18, 0xF8A04818 }, { 0xFFA00400, 0xF8A00400 },
+    { 0xFFE0FC1F, 0xF8E0001F }, { 0xFFE0FC1F, 0xF8E0101F }, { 0xFFE0FC1F, 0xF8E0201F },
+    { 0xFFE0FC1F, 0xF8E0301F }, { 0xFFE0FC1F, 0xF8E0401F }, { 0xFFE0FC1F, 0xF8E0501F },
+    { 0xFFE0FC1F, 0xF8E0601F }, { 0xFFE0FC1F, 0xF8E0701F }, { 0xFFE0FC00, 0xF8E00000 },
+    { 0xFFE0FC00, 0xF8E01000 }, { 0xFFE0FC00, 0xF8E02000 }, { 0xFFE0FC00, 0xF8E03000 },
+    { 0xFFE0FC00, 0xF8E04000 }, { 0xFFE0FC00, 0xF8E05000 }, { 0xFFE0FC00, 0xF8E06000 },
+    { 0xFFE0FC00, 0xF8E07000 }, { 0xFFE0FC00, 0xF8E08000 }, { 0xFFA00400, 0xF8A00400 },
+    { 0xFFE00C00, 0xFC000C00 }, { 0xFFE00C00, 0xFC000400 }, { 0xFFE00C00, 0xFC000000 },
+    { 0xFFE00C00, 0xFC200800 }, { 0xFFE00C00, 0xFC400C00 }, { 0xFFE00C00, 0xFC400400 },
+    { 0xFFE00C00, 0xFC400000 }, { 0xFFE00C00, 0xFC600800 }, { 0xFFC00000, 0xFD000000 },
+    { 0xFFC00000, 0xFD000000 }, { 0xFFC00000, 0xFD400000 }, { 0xFFC00000, 0xFD400000 },
+};
+
+/* 各模式的扩展（arm64_ext_t） */
+const uint8_t arm64_ext_pattern_exts[ARM64_EXT_PATTERNS] = {
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 67, 67, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 67, 67, 67, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67,
+    67, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67,
+    67, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 67, 67, 67, 67, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 67, 67, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 67, 67, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 67, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 67, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 65, 65, 65, 65, 65, 65, 67, 62, 62, 62, 62,
+    62, 62, 62, 62, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 67, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 62, 62, 22, 22, 22, 22, 15, 22,
+    22, 15, 22, 22, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    18, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 18, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47, 49, 50, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 51, 51, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 45, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 46, 46, 46, 46, 46, 46, 46, 47, 48, 50, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 46, 46, 46, 46, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 42, 52, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 41, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 43, 45, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 43, 46, 46, 46, 46, 46, 50, 39, 39,
+    39, 39, 39, 39, 46, 46, 46, 46, 46, 46, 46, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 49, 52, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 46, 46, 46, 49, 52, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 41, 48, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 41, 48, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 42, 45, 45, 52, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 42, 45, 45, 52, 41, 50, 41, 50, 7, 7, 7, 7, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 17, 35, 8, 8, 8, 8, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 17, 35, 8, 8, 8, 8, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 17, 35, 8, 8, 8, 8, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 17, 35, 8, 8, 8, 8, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 39, 39, 39, 39, 39, 39,
+    39, 39, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 18, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 18, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 18, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 18, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 51, 51, 51, 51, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 41, 51, 51, 51, 51, 53, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 46, 46, 46, 46, 46, 46, 39, 39, 39, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 55, 55, 39, 44, 44,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47, 51, 51, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 45, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 41, 46, 46, 46, 46,
+    46, 46, 46, 55, 55, 44, 44, 39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 46, 46, 47, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 42, 55, 55, 44, 44, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 47, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 43, 45, 47,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 41, 43, 46, 46, 46, 46, 46, 47, 55, 55, 44, 44, 46, 46, 46, 46,
+    46, 46, 46, 46, 47, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 50, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 46, 50, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 50, 55, 55, 44, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 50, 55, 55, 44, 39, 39, 39, 39, 39, 39, 42, 45, 45, 55, 55, 39, 39, 39, 39, 39,
+    39, 39, 42, 45, 45, 55, 55, 39, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 35, 35, 35, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 35, 35, 35,
+    16, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 35, 35, 35, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 35, 35, 35, 10, 10, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 62, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 62, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 62, 67, 67, 67, 67, 67, 67, 67, 62, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 62, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    62, 67, 67, 67, 67, 67, 67, 67, 62, 67, 67, 62, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 62, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 62, 62,
+    62, 66, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 62, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 62, 62, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 62, 62, 62, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 62, 67, 67, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 69, 69, 69, 62, 68, 68, 68, 68, 71, 67, 67, 67, 67, 67, 67, 67,
+    70, 71, 62, 62, 62, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 69, 69, 69, 62, 67, 67, 67, 67, 67, 67, 62, 62, 62, 62,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 62, 67,
+    67, 66, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 69,
+    69, 69, 62, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 62, 67, 67, 66, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 69, 69, 69, 62, 67, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 67, 62, 22, 22, 22, 22, 15, 22, 22, 15, 22, 22, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 18, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 18, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 47, 49, 50, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 40, 40, 40, 40, 46, 46, 51, 51, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 45, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    46, 46, 46, 46, 46, 46, 46, 47, 48, 50, 54, 39, 39, 39, 39, 39, 39, 54, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 46, 46, 51, 51, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 42,
+    52, 52, 52, 39, 39, 39, 39, 39, 39, 54, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    41, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 43, 45,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 43, 46, 46, 46, 46, 46, 50, 39, 39, 39, 39, 39,
+    39, 54, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 46, 46, 46, 46, 46, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 43, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46,
+    46, 49, 52, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 49, 52, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 41, 48, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 41, 48, 39, 39, 39,
+    39, 39, 39, 39, 42, 45, 45, 52, 39, 39, 39, 39, 39, 39, 39, 42, 45, 45, 52, 39, 39, 39, 39, 39,
+    39, 41, 50, 39, 39, 39, 41, 50, 13, 13, 13, 13, 13, 13, 13, 13, 17, 35, 8, 8, 8, 8, 17, 35,
+    8, 8, 8, 8, 17, 35, 8, 8, 8, 8, 17, 35, 8, 8, 8, 8, 7, 7, 7, 39, 39, 39, 39, 39,
+    39, 39, 39, 18, 18, 39, 39, 39, 39, 56, 56, 56, 56, 57, 57, 57, 39, 39, 39, 39, 39, 46, 46, 46,
+    56, 56, 57, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 39, 39, 39, 39, 39, 46, 46, 46,
+    46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46,
+    46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 46, 46, 46, 46, 46, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 67, 67, 67, 67, 67, 67, 62, 67, 62, 62, 62, 62, 62, 67, 67, 67, 67, 67, 62, 67, 62, 63, 63,
+    63, 62, 62, 62, 62, 63, 67, 67, 67, 67, 67, 67, 67, 62, 67, 62, 62, 62, 62, 64, 67, 67, 67, 67,
+    67, 67, 67, 67, 67, 62, 67, 67, 67, 67, 67, 67, 67, 62, 67, 62, 62, 62, 62, 63, 63, 65, 63, 63,
+    67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 67, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    63, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 24, 24, 24, 24, 24, 24, 24,
+    24, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    55, 55, 39, 44, 39, 44, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47, 51, 51, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 45, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 41, 41, 46, 46, 46, 46, 46, 46, 46, 55, 55, 44, 44, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 46, 46, 46, 46, 46, 46, 47, 51, 51, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 42, 52, 55, 55, 44, 44, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 47, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 43, 45, 47, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 41, 43, 46, 46, 46, 46, 46, 47, 55, 55,
+    44, 44, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 46, 46, 46, 46, 47, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 43, 47, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 50, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 46, 50, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 50, 55, 55, 44, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 50, 55, 55, 44, 39, 39, 39, 39, 39, 39, 42, 45, 45, 55, 55, 44, 39, 39, 39, 39, 39, 39, 39,
+    42, 45, 45, 55, 55, 39, 39, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    35, 35, 35, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 35, 35, 35, 16,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 35, 35, 35, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 35, 35, 35, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 55,
+    55, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 55, 55,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 46, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 55, 55, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 55, 55, 39, 55, 55, 39, 55, 55, 39, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 62, 15, 22, 22, 15, 22, 22, 24, 24, 7, 7, 7, 7, 18, 18, 17, 18, 18, 17, 17, 5,
+    6, 6, 7, 7, 7, 7, 24, 24, 24, 26, 5, 5, 39, 39, 39, 39, 39, 39, 39, 39, 18, 18, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 62, 62, 62, 62,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 16, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 10, 24, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+    62, 62, 62, 15, 22, 22, 15, 22, 22, 58, 58, 60, 60, 60, 60, 60, 58, 59, 59, 59, 60, 60, 61, 58,
+    59, 61, 24, 24, 36, 3, 4, 9, 10, 11, 11, 12, 12, 12, 12, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 27, 29, 30, 36, 37, 72, 72, 1, 2, 12, 12, 12, 12, 12, 14, 31, 31, 31, 32, 38,
+    38, 1, 12, 12, 36, 36, 8, 34, 34, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 12, 12, 18,
+    18, 17, 25, 24, 18, 18, 17, 24, 24, 25, 24, 25, 24, 5, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    7, 7, 7, 26, 26, 26, 26, 26, 26, 26, 26, 18, 18, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+    72, 72, 72, 72, 72, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 19, 19, 22,
+    22, 22, 22, 22, 22, 22, 22, 20, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 26, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 26, 16, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 28, 26, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 26, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+};
@@ -0,0 +1,101 @@
+/**
+ * ARM64反汇编器 - 指令扩展特性枚举
+ * 此文件由 gen_inst_props.py 根据 isa_aarch64.json 生成，请勿手工修改
+ */
+
+#ifndef ARM64_INST_PROPS_H
+#define ARM64_INST_PROPS_H
+
+#include <stdint.h>
+
+/* 指令所需的架构扩展（ARM64_EXT_BASE 表示 ARMv8.0 基础指令集） */
+typedef enum {
+    ARM64_EXT_BASE,  /* 基础指令集 */
+    ARM64_EXT_BRBE,
+    ARM64_EXT_BTI,
+    ARM64_EXT_CHK,
+    ARM64_EXT_CLRBHB,
+    ARM64_EXT_CPA,
+    ARM64_EXT_CRC32,
+    ARM64_EXT_CSSC,
+    ARM64_EXT_D128,
+    ARM64_EXT_DGH,
+    ARM64_EXT_FLAGM,
+    ARM64_EXT_FLAGM2,
+    ARM64_EXT_GCS,
+    ARM64_EXT_HBC,
+    ARM64_EXT_ITE,
+    ARM64_EXT_LOR,
+    ARM64_EXT_LRCPC,
+    ARM64_EXT_LRCPC2,
+    ARM64_EXT_LRCPC3,
+    ARM64_EXT_LS64,
+    ARM64_EXT_LS64_ACCDATA,
+    ARM64_EXT_LS64_V,
+    ARM64_EXT_LSE,
+    ARM64_EXT_MOPS,
+    ARM64_EXT_MTE,
+    ARM64_EXT_MTE2,
+    ARM64_EXT_PAUTH,
+    ARM64_EXT_RAS,
+    ARM64_EXT_RPRFM,
+    ARM64_EXT_SB,
+    ARM64_EXT_SPE,
+    ARM64_EXT_SPECRES,
+    ARM64_EXT_SPECRES2,
+    ARM64_EXT_SYSINSTR128,
+    ARM64_EXT_SYSREG128,
+    ARM64_EXT_THE,
+    ARM64_EXT_TME,
+    ARM64_EXT_TRF,
+    ARM64_EXT_WFXT,
+    ARM64_EXT_ASIMD,
+    ARM64_EXT_AES,
+    ARM64_EXT_BF16,
+    ARM64_EXT_DOTPROD,
+    ARM64_EXT_FAMINMAX,
+    ARM64_EXT_FCMA,
+    ARM64_EXT_FHM,
+    ARM64_EXT_FP16,
+    ARM64_EXT_FP8,
+    ARM64_EXT_FP8DOT2,
+    ARM64_EXT_FP8DOT4,
+    ARM64_EXT_FP8FMA,
+    ARM64_EXT_FRINTTS,
+    ARM64_EXT_I8MM,
+    ARM64_EXT_JSCVT,
+    ARM64_EXT_LUT,
+    ARM64_EXT_RDM,
+    ARM64_EXT_SHA1,
+    ARM64_EXT_SHA256,
+    ARM64_EXT_SHA3,
+    ARM64_EXT_SHA512,
+    ARM64_EXT_SM3,
+    ARM64_EXT_SM4,
+    ARM64_EXT_SVE,
+    ARM64_EXT_SVE_BF16,
+    ARM64_EXT_SVE_F32MM,
+    ARM64_EXT_SVE_F64MM,
+    ARM64_EXT_SVE_I8MM,
+    ARM64_EXT_SVE2,
+    ARM64_EXT_SVE2_AES,
+    ARM64_EXT_SVE2_BITPERM,
+    ARM64_EXT_SVE2_SHA3,
+    ARM64_EXT_SVE2_SM4,
+    ARM64_EXT_SME,
+    ARM64_EXT_XS,
+    ARM64_EXT_COUNT
+} arm64_ext_t;
+
+/* 编码 -> 扩展分类表的分桶：桶号为 bits[31:21] */
+#define ARM64_EXT_BUCKET_SHIFT  21
+#define ARM64_EXT_BUCKETS       2048
+#define ARM64_EXT_PATTERNS      5583
+
+/* 一个编码模式：(raw & mask) == value */
+typedef struct {
+    uint32_t mask;
+    uint32_t value;
+} arm64_ext_pattern_t;
+
+#endif /* ARM64_INST_PROPS_H */
@@ -0,0 +1,433 @@
+/**
+ * ARM64反汇编器 - objdump 格式清单
+ */
+
+#include "arm64_listing.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#include <stdlib.h>
+#include <string.h>
+
+/* 操作数文本的最大长度（与 format_instruction 的调用者一致） */
+#define OPERANDS_MAX    256
+
+/* 一行中除操作数和符号名以外的最大长度："地址:\t编码 \t助记符\t" + " <" + 目标 + ">\n" */
+#define LINE_FIXED_MAX  (16 + 2 + 8 + 2 + 16 + 1 + 2 + 16 + 4 + 1)
+
+static const char hex_digits[] = "0123456789abcdef";
+
+static char *put_hex(char *p, uint64_t value, int digits) {
+    for (int i = digits - 1; i >= 0; i--) {
+        p[i] = hex_digits[value & 0xF];
+        value >>= 4;
+    }
+    return p + digits;
+}
+
+/* 不补零的十六进制（objdump 的 %lx） */
+static char *put_hex_min(char *p, uint64_t value) {
+    int digits = 1;
+    while (digits < 16 && (value >> (digits * 4)) != 0) {
+        digits++;
+    }
+    return put_hex(p, value, digits);
+}
+
+/* ========== 缓冲区 ========== */
+
+bool arm64_listing_flush(arm64_listing_t *listing) {
+    if (listing->len > 0) {
+        if (!listing->write(listing->write_ctx, listing->buf, listing->len)) {
+            listing->error = true;
+        }
+        listing->bytes_written += listing->len;
+        listing->len = 0;
+    }
+    return !listing->error;
+}
+
+/* 保证缓冲区还能写入 n 字节（n 不超过缓冲区大小） */
+static inline char *reserve(arm64_listing_t *listing, size_t n) {
+    if (listing->len + n > ARM64_LISTING_BUFFER_SIZE) {
+        arm64_listing_flush(listing);
+    }
+    return listing->buf + listing->len;
+}
+
+static inline void commit(arm64_listing_t *listing, const char *end) {
+    listing->len = (size_t)(end - listing->buf);
+}
+
+/* 追加任意长度的文本（符号名等） */
+static void put_text(arm64_listing_t *listing, const char *s, size_t n) {
+    if (n > ARM64_LISTING_BUFFER_SIZE / 2) {
+        arm64_listing_flush(listing);
+        if (!listing->write(listing->write_ctx, s, n)) {
+            listing->error = true;
+        }
+        listing->bytes_written += n;
+        return;
+    }
+    char *p = reserve(listing, n);
+    memcpy(p, s, n);
+    commit(listing, p + n);
+}
+
+static void put_str(arm64_listing_t *listing, const char *s) {
+    put_text(listing, s, strlen(s));
+}
+
+/* ========== 符号 ========== */
+
+static int compare_symbols(const void *a, const void *b) {
+    const arm64_listing_symbol_t *x = a, *y = b;
+    if (x->address != y->address) {
+        return x->address < y->address ? -1 : 1;
+    }
+    /* 同一地址按原始顺序（复制时暂存在名称之前的下标里）保留第一个 */
+    return x->name < y->name ? -1 : (x->name > y->name);
+}
+
+static bool file_write(void *ctx, const void *data, size_t size) {
+    return fwrite(data, 1, size, (FILE *)ctx) == size;
+}
+
+bool arm64_listing_init(arm64_listing_t *listing, FILE *out,
+                        const arm64_listing_symbol_t *symbols, size_t symbol_count) {
+    return arm64_listing_init_writer(listing, file_write, out, symbols, symbol_count);
+}
+
+bool arm64_listing_init_writer(arm64_listing_t *listing, arm64_listing_write_t write,
+                               void *write_ctx, const arm64_listing_symbol_t *symbols,
+                               size_t symbol_count) {
+    memset(listing, 0, sizeof(*listing));
+    listing->allocator = arm64_default_allocator();
+    listing->write = write;
+    listing->write_ctx = write_ctx;
+    listing->buf = arm64_alloc(listing->allocator, ARM64_LISTING_BUFFER_SIZE, 64);
+    listing->batch = arm64_alloc(listing->allocator, ARM64_LISTING_BATCH * sizeof(disasm_inst_t),
+                                 16);
+    if (symbol_count > 0) {
+        listing->symbols = arm64_alloc(listing->allocator,
+                                       symbol_count * sizeof(arm64_listing_symbol_t),
+                                       16);
+        listing->symbol_capacity = symbol_count;
+    }
+    if (!listing->buf || !listing->batch || (symbol_count > 0 && !listing->symbols)) {
+        arm64_listing_free(listing);
+        return false;
+    }
+
+    /*
+     * qsort 不稳定：排序时用下标代替名称作为次键，排序后再换回名称
+     */
+    for (size_t i = 0; i < symbol_count; i++) {
+        listing->symbols[i].address = symbols[i].address;
+        listing->symbols[i].name = (const char *)(uintptr_t)i;
+    }
+    qsort(listing->symbols, symbol_count, sizeof(arm64_listing_symbol_t), compare_symbols);
+    size_t n = 0;
+    for (size_t i = 0; i < symbol_count; i++) {
+        if (n > 0 && listing->symbols[n - 1].address == listing->symbols[i].address) {
+            continue;
+        }
+        listing->symbols[n].address = listing->symbols[i].address;
+        listing->symbols[n].name = symbols[(uintptr_t)listing->symbols[i].name].name;
+        n++;
+    }
+    listing->symbol_count = n;
+    return true;
+}
+
+void arm64_listing_free(arm64_listing_t *listing) {
+    arm64_free(listing->allocator, listing->buf, ARM64_LISTING_BUFFER_SIZE);
+    arm64_free(listing->allocator, listing->batch, ARM64_LISTING_BATCH * sizeof(disasm_inst_t));
+    arm64_free(listing->allocator, listing->symbols,
+               listing->symbol_capacity * sizeof(arm64_listing_symbol_t));
+    listing->buf = NULL;
+    listing->batch = NULL;
+    listing->symbols = NULL;
+    listing->symbol_count = 0;
+    listing->symbol_capacity = 0;
+    listing->len = 0;
+}
+
+/* 第一个地址不小于 address 的符号下标 */
+static size_t lower_bound(const arm64_listing_t *listing, uint64_t address) {
+    size_t lo = 0, hi = listing->symbol_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (listing->symbols[mid].address < address) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* ========== 输出 ========== */
+
+void arm64_listing_file_header(arm64_listing_t *listing, const char *path,
+                               const char *format) {
+    put_str(listing, "\n");
+    put_str(listing, path);
+    put_str(listing, ":     file format ");
+    put_str(listing, format);
+    put_str(listing, "\n\n");
+}
+
+/* 函数头："\n<16位地址> <名称>:\n" */
+static void put_label(arm64_listing_t *listing, uint64_t address, const char *name) {
+    char *p = reserve(listing, 1 + 16 + 2);
+    *p++ = '\n';
+    p = put_hex(p, address, 16);
+    *p++ = ' ';
+    *p++ = '<';
+    commit(listing, p);
+    put_str(listing, name);
+    put_str(listing, ">:\n");
+}
+
+/*
+ * 地址列去掉的前导字符数（objdump 的 skip_addr_chars）：
+ * 按段末地址的前导零个数减一向下取到4的倍数，段内所有行使用同一宽度
+ */
+static int address_skip(uint64_t start, uint64_t end) {
+    int zeros = 0;
+    while (zeros < 16 && ((end >> (60 - zeros * 4)) & 0xF) == 0) {
+        zeros++;
+    }
+    if (zeros == 16 && start != 0) {
+        zeros = 0;
+    }
+    return zeros ? (zeros - 1) & ~3 : 0;
+}
+
+/* 指令的 PC 相对目标（分支、ADR/ADRP、字面量加载和预取） */
+static bool pc_relative_target(const disasm_inst_t *inst, uint64_t *target) {
+    if (get_branch_target(inst, target)) {
+        return true;
+    }
+    if (inst->addr_mode == ADDR_MODE_LITERAL && inst->type != INST_TYPE_UNKNOWN) {
+        *target = inst->address + inst->imm;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * 目标注释 " <符号>" 或 " <符号+0x偏移>"：使用不大于目标的最近符号，
+ * 没有时若目标在当前段内使用段名，否则不注释
+ */
+static void put_annotation(arm64_listing_t *listing, uint64_t target,
+                           const char *section, uint64_t start, uint64_t end) {
+    size_t i = lower_bound(listing, target + 1);
+    const char *name;
+    uint64_t base;
+    if (i > 0) {
+        name = listing->symbols[i - 1].name;
+        base = listing->symbols[i - 1].address;
+    } else if (target >= start && target < end) {
+        name = section;
+        base = start;
+    } else {
+        return;
+    }
+    char *p = reserve(listing, 2);
+    *p++ = ' ';
+    *p++ = '<';
+    commit(listing, p);
+    put_str(listing, name);
+    p = reserve(listing, 3 + 16 + 2);
+    if (target != base) {
+        *p++ = '+';
+        *p++ = '0';
+        *p++ = 'x';
+        p = put_hex_min(p, target - base);
+    }
+    *p++ = '>';
+    commit(listing, p);
+}
+
+/* 行首 "地址:\t编码 \t"：地址的前导零（不含最后一位）替换为空格 */
+static char *put_prefix(char *p, const disasm_inst_t *inst, int skip) {
+    char *addr = p;
+    p = put_hex(p, inst->address, 16);
+    memmove(addr, addr + skip, (size_t)(16 - skip));
+    p -= skip;
+    for (char *s = addr; s < p - 1 && *s == '0'; s++) {
+        *s = ' ';
+    }
+    *p++ = ':';
+    *p++ = '\t';
+    p = put_hex(p, inst->raw, 8);
+    *p++ = ' ';
+    *p++ = '\t';
+    return p;
+}
+
+/* 按数据输出一个指令字：".word\t0x<编码>" */
+static void put_word(arm64_listing_t *listing, const disasm_inst_t *inst, int skip) {
+    char *p = put_prefix(reserve(listing, LINE_FIXED_MAX), inst, skip);
+    memcpy(p, ".word\t0x", 8);
+    p = put_hex(p + 8, inst->raw, 8);
+    *p++ = '\n';
+    commit(listing, p);
+}
+
+/* 输出一条指令行 */
+static void put_inst(arm64_listing_t *listing, const disasm_inst_t *inst, int skip,
+                     const char *section, uint64_t start, uint64_t end) {
+    if (inst->type == INST_TYPE_UNKNOWN) {
+        put_word(listing, inst, skip);
+        listing->unknown++;
+        return;
+    }
+
+    char *p = put_prefix(reserve(listing, LINE_FIXED_MAX + OPERANDS_MAX), inst, skip);
+
+    size_t mlen = strlen(inst->mnemonic);
+    memcpy(p, inst->mnemonic, mlen);
+    p += mlen;
+    *p = '\t';
+    format_instruction_operands_names(inst, DISASM_REGS_NUMERIC, p + 1, OPERANDS_MAX);
+    size_t olen = strlen(p + 1);
+    if (olen == 0) {
+        *p++ = '\n';
+        commit(listing, p);
+        return;
+    }
+    char *ops = p + 1;
+    p = ops + olen;
+
+    /* PC 相对目标总在操作数末尾："0x<目标>" 改为 "<目标> <符号+偏移>" */
+    uint64_t target;
+    if (pc_relative_target(inst, &target)) {
+        char *q = p;
+        while (q > ops && ((q[-1] >= '0' && q[-1] <= '9') || (q[-1] >= 'a' && q[-1] <= 'f'))) {
+            q--;
+        }
+        if (q - ops >= 2 && q[-2] == '0' && q[-1] == 'x' && q < p) {
+            p = put_hex_min(q - 2, target);
+            commit(listing, p);
+            put_annotation(listing, target, section, start, end);
+            p = reserve(listing, 1);
+            *p++ = '\n';
+            commit(listing, p);
+            return;
+        }
+    }
+    *p++ = '\n';
+    commit(listing, p);
+}
+
+void arm64_listing_section_header(arm64_listing_t *listing,
+                                  const arm64_listing_section_t *section) {
+    put_str(listing, "\nDisassembly of section ");
+    put_str(listing, section->name);
+    put_str(listing, ":\n");
+
+    size_t i = lower_bound(listing, section->address);
+    bool named = i < listing->symbol_count && listing->symbols[i].address == section->address;
+    put_label(listing, section->address, named ? listing->symbols[i].name : section->name);
+}
+
+/* 第一个地址大于 address 的映射符号下标 */
+static size_t mapping_after(const arm64_listing_section_t *section, uint64_t address) {
+    size_t lo = 0, hi = section->mapping_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (section->mappings[mid].address <= address) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+size_t arm64_listing_range(arm64_listing_t *listing, const arm64_listing_section_t *section,
+                           size_t offset, size_t size) {
+    uint64_t start = section->address;
+    uint64_t end = start + section->size;
+    int skip = address_skip(start, end);
+    uint64_t address = start + offset;
+
+    /* 段起始处的函数头已由段头输出 */
+    size_t next = lower_bound(listing, address);
+    if (offset == 0 && next < listing->symbol_count && listing->symbols[next].address == address) {
+        next++;
+    }
+    uint64_t next_addr = next < listing->symbol_count ? listing->symbols[next].address : UINT64_MAX;
+
+    /* 范围起点所在的映射区间（与 objdump 相同，第一个映射符号之前按指令输出） */
+    size_t map = mapping_after(section, address);
+    bool data = map > 0 && section->mappings[map - 1].data;
+    uint64_t map_addr = map < section->mapping_count ? section->mappings[map].address : UINT64_MAX;
+
+    const uint8_t *p = (const uint8_t *)section->bytes + offset;
+    size_t count = size / 4;
+    size_t done = 0;
+    while (done < count) {
+        size_t n = count - done;
+        if (n > ARM64_LISTING_BATCH) {
+            n = ARM64_LISTING_BATCH;
+        }
+        uint64_t pc = address + done * 4;
+        n = disassemble_buffer(p + done * 4, n * 4, pc, section->endian, listing->batch, n);
+        for (size_t i = 0; i < n; i++) {
+            const disasm_inst_t *inst = &listing->batch[i];
+            /* 跳过落在指令中间（未对齐）的符号 */
+            while (next_addr < inst->address) {
+                next++;
+                next_addr = next < listing->symbol_count ?
+                            listing->symbols[next].address : UINT64_MAX;
+            }
+            if (next_addr == inst->address) {
+                put_label(listing, next_addr, listing->symbols[next].name);
+                next++;
+                next_addr = next < listing->symbol_count ?
+                            listing->symbols[next].address : UINT64_MAX;
+            }
+            while (map_addr <= inst->address) {
+                data = section->mappings[map].data;
+                map++;
+                map_addr = map < section->mapping_count ?
+                           section->mappings[map].address : UINT64_MAX;
+            }
+            if (data) {
+                put_word(listing, inst, skip);
+                listing->data++;
+            } else {
+                put_inst(listing, inst, skip, section->name, start, end);
+            }
+        }
+        if (n == 0) {
+            break;
+        }
+        done += n;
+    }
+    listing->insts += done;
+    return done;
+}
+
+size_t arm64_listing_section(arm64_listing_t *listing, const char *name, uint64_t address,
+                             const void *bytes, size_t size, arm64_endian_t endian) {
+    arm64_listing_section_t section = { name, address, bytes, size, endian };
+    arm64_listing_section_header(listing, &section);
+    return arm64_listing_range(listing, &section, 0, size);
+}
+
+uint64_t arm64_listing_image(arm64_listing_t *listing, const arm64_listing_image_t *image) {
+    uint64_t n = 0;
+    arm64_listing_file_header(listing, image->path, image->format);
+    for (size_t i = 0; i < image->section_count; i++) {
+        arm64_listing_section_header(listing, &image->sections[i]);
+        n += arm64_listing_range(listing, &image->sections[i], 0, image->sections[i].size);
+    }
+    return n;
+}
+
+#endif /* ARM64_DISASM_FREESTANDING */
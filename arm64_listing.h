@@ -0,0 +1,158 @@
+/**
+ * ARM64反汇编器 - objdump 格式清单
+ * 按 GNU objdump -d 的 AArch64 清单布局输出：文件头、"Disassembly of section" 段头、
+ * 函数头 "<地址> <符号>:"、指令行 "地址:\t编码 \t助记符\t操作数"，
+ * PC 相对目标附加 "<符号+偏移>" 注释，无法解码的指令字和映射符号 $d 之后的数据
+ * （字面量池等）输出为 ".word\t0x..."
+ *
+ * 助记符和操作数文本来自本库的格式化函数，寄存器按 objdump 的写法命名（x29/x30，
+ * 见 DISASM_REGS_NUMERIC）
+ * 输出先写入内部缓冲区（不经过 printf），缓冲区满时整块写出
+ */
+
+#ifndef ARM64_LISTING_H
+#define ARM64_LISTING_H
+
+#include "arm64_disasm.h"
+#include "arm64_alloc.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 输出缓冲区大小 */
+#define ARM64_LISTING_BUFFER_SIZE   (1u << 20)
+
+/* 每次批量解码的指令数 */
+#define ARM64_LISTING_BATCH         256
+
+/* 符号（函数头和目标注释） */
+typedef struct {
+    uint64_t address;
+    const char *name;           // 由调用者保持有效直到清单释放
+} arm64_listing_symbol_t;
+
+/* 输出函数：写出 size 字节，失败时返回 false */
+typedef bool (*arm64_listing_write_t)(void *ctx, const void *data, size_t size);
+
+/* 映射符号：从 address 起是数据（$d）还是指令（$x） */
+typedef struct {
+    uint64_t address;
+    bool data;
+} arm64_listing_mapping_t;
+
+/* 要反汇编的段 */
+typedef struct {
+    const char *name;           // 段名（如 ".text"）
+    uint64_t address;           // 段的第一个字节的地址
+    const void *bytes;          // 段内容（任意对齐，不足4字节的尾部忽略）
+    size_t size;
+    arm64_endian_t endian;
+    const arm64_listing_mapping_t *mappings;    // 段内的映射符号，按地址排序；第一个之前为指令
+    size_t mapping_count;                       // 为0时整段都是指令
+} arm64_listing_section_t;
+
+/* 整个映像：文件头和依次输出的各段 */
+typedef struct {
+    const char *path;                   // 文件头中的路径
+    const char *format;                 // 文件头中的 BFD 格式名
+    const arm64_listing_section_t *sections;
+    size_t section_count;
+} arm64_listing_image_t;
+
+/* 清单写入器 */
+typedef struct {
+    const arm64_allocator_t *allocator; // 缓冲区和符号表的分配器（默认分配器）
+    arm64_listing_write_t write;
+    void *write_ctx;
+    char *buf;
+    size_t len;
+    arm64_listing_symbol_t *symbols;    // 按地址排序，同一地址只保留第一个
+    size_t symbol_count;
+    size_t symbol_capacity;             // symbols 的分配数量
+    disasm_inst_t *batch;
+    bool error;                         // 写出失败
+    uint64_t insts;                     // 已输出的指令行数（含 .word）
+    uint64_t unknown;                   // 无法解码的指令字数
+    uint64_t data;                      // 映射符号标为数据的字数
+    uint64_t bytes_written;
+} arm64_listing_t;
+
+/**
+ * 初始化写入器
+ * @param out 输出文件
+ * @param symbols 符号表（任意顺序，内部复制并排序；名称不复制）
+ * @return 内存不足时返回 false
+ */
+bool arm64_listing_init(arm64_listing_t *listing, FILE *out,
+                        const arm64_listing_symbol_t *symbols, size_t symbol_count);
+
+/**
+ * 使用输出函数初始化写入器（写入内存、压缩输出等），其余同 arm64_listing_init
+ */
+bool arm64_listing_init_writer(arm64_listing_t *listing, arm64_listing_write_t write,
+                               void *write_ctx, const arm64_listing_symbol_t *symbols,
+                               size_t symbol_count);
+
+/**
+ * 释放写入器（不写出缓冲区，需要时先调用 arm64_listing_flush）
+ */
+void arm64_listing_free(arm64_listing_t *listing);
+
+/**
+ * 输出文件头："\n<路径>:     file format <格式>\n\n"
+ * @param format BFD 格式名，如 "elf64-littleaarch64"、"binary"
+ */
+void arm64_listing_file_header(arm64_listing_t *listing, const char *path,
+                               const char *format);
+
+/**
+ * 反汇编一个段并输出
+ * 段起始处和每个符号地址处输出函数头；段起始处没有符号时使用段名
+ * @param name 段名（如 ".text"）
+ * @param address 段的第一个字节的地址
+ * @param bytes 段内容（任意对齐，不足4字节的尾部忽略）
+ * @return 输出的指令行数
+ */
+size_t arm64_listing_section(arm64_listing_t *listing, const char *name, uint64_t address,
+                             const void *bytes, size_t size, arm64_endian_t endian);
+
+/**
+ * 分块输出段：段头（"Disassembly of section" 和段起始处的函数头）和段内的一段
+ * 依次输出段头和覆盖整个段的各段范围，结果与 arm64_listing_section 相同；
+ * 各范围互不依赖，可以由不同线程的写入器分别生成后按顺序拼接
+ */
+void arm64_listing_section_header(arm64_listing_t *listing,
+                                  const arm64_listing_section_t *section);
+
+/**
+ * @param offset 范围在段内的字节偏移（4的倍数）
+ * @param size 范围的字节数
+ * @return 输出的指令行数
+ */
+size_t arm64_listing_range(arm64_listing_t *listing, const arm64_listing_section_t *section,
+                           size_t offset, size_t size);
+
+/**
+ * 输出整个映像（文件头和各段）
+ * @return 输出的指令行数
+ */
+uint64_t arm64_listing_image(arm64_listing_t *listing, const arm64_listing_image_t *image);
+
+/**
+ * 写出缓冲区中的内容
+ * @return 此前所有写出都成功时返回 true
+ */
+bool arm64_listing_flush(arm64_listing_t *listing);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_DISASM_FREESTANDING */
+
+#endif /* ARM64_LISTING_H */
@@ -0,0 +1,244 @@
+/**
+ * ARM64 objdump 兼容反汇编工具
+ * 读取 AArch64 ELF（或 -b binary 原始映像），按 GNU objdump -d 的清单布局输出，
+ * 可以替换流水线中的 objdump 而不修改解析脚本；寄存器名与 objdump 相同（x29/x30），
+ * 映射符号 $d 标出的数据（字面量池等）输出为 .word
+ *
+ * 用法：arm64_objdump [-d|-D] [-j 段]... [-b binary] [--adjust-vma=地址] [-EB|-EL]
+ *                     [--gzip] [--threads=N] [--gzip-level=N] 文件...
+ * --gzip 输出多成员 gzip：各块由工作线程并行反汇编、格式化和压缩（需要 zlib）
+ */
+
+#include "arm64_elf.h"
+#include "arm64_listing.h"
+#ifdef ARM64_DISASM_HAVE_GZIP
+    #include "arm64_gzsink.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ========== 段选择 ========== */
+
+/* 段是否在 -j 列表中（列表为空时全部选中） */
+static bool section_selected(const char *name, const char **only, int only_count) {
+    if (only_count == 0) {
+        return true;
+    }
+    for (int i = 0; i < only_count; i++) {
+        if (strcmp(name, only[i]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ========== 输出 ========== */
+
+typedef struct {
+    FILE *out;
+#ifdef ARM64_DISASM_HAVE_GZIP
+    arm64_gzsink_t *sink;       // --gzip 时非空
+    unsigned threads;
+#endif
+} output_t;
+
+static bool emit(const output_t *o, const arm64_listing_image_t *image,
+                 const arm64_listing_symbol_t *syms, size_t sym_count) {
+#ifdef ARM64_DISASM_HAVE_GZIP
+    if (o->sink) {
+        return arm64_gzsink_listing(o->sink, image, syms, sym_count, o->threads, 0);
+    }
+#endif
+    arm64_listing_t listing;
+    if (!arm64_listing_init(&listing, o->out, syms, sym_count)) {
+        return false;
+    }
+    arm64_listing_image(&listing, image);
+    bool ok = arm64_listing_flush(&listing);
+    arm64_listing_free(&listing);
+    return ok;
+}
+
+static int dump_elf(const char *path, const arm64_image_t *img, bool all,
+                    const char **only, int only_count, arm64_endian_t endian,
+                    const output_t *o) {
+    arm64_elf_t elf;
+    arm64_elf_status_t st = arm64_elf_parse(&elf, img->data, img->size);
+    if (st != ARM64_ELF_OK) {
+        fprintf(stderr, "%s: %s%s\n", path, arm64_elf_strerror(st),
+                st == ARM64_ELF_NOT_ELF64 ? "（原始映像请使用 -b binary）" : "");
+        return 1;
+    }
+
+    /* AArch64 的指令总是小端存放（大端 ELF 只影响数据），除非用 -EB 指定 */
+    arm64_listing_section_t *sections =
+        malloc((elf.section_count ? elf.section_count : 1) * sizeof(*sections));
+    arm64_listing_symbol_t *syms =
+        malloc((elf.symbol_count ? elf.symbol_count : 1) * sizeof(*syms));
+    arm64_listing_mapping_t *maps =
+        malloc((elf.mapping_count ? elf.mapping_count : 1) * sizeof(*maps));
+    if (!sections || !syms || !maps) {
+        fprintf(stderr, "内存不足\n");
+        free(sections);
+        free(syms);
+        free(maps);
+        arm64_elf_free(&elf);
+        return 1;
+    }
+    /* 映射符号已按节、地址排序：每节取连续的一段，$d 之后的字面量池等输出为 .word */
+    for (size_t i = 0; i < elf.mapping_count; i++) {
+        maps[i] = (arm64_listing_mapping_t){ elf.mappings[i].address, elf.mappings[i].data };
+    }
+    size_t map = 0;
+    size_t count = 0;
+    for (size_t i = 0; i < elf.section_count; i++) {
+        const arm64_elf_section_t *sh = &elf.sections[i];
+        bool code = all ? (sh->type == ARM64_ELF_SHT_PROGBITS &&
+                           (sh->flags & ARM64_ELF_SHF_ALLOC)) :
+                          (sh->flags & ARM64_ELF_SHF_EXECINSTR) != 0;
+        if (!code || sh->size == 0 || !section_selected(sh->name, only, only_count)) {
+            continue;
+        }
+        if (!sh->data) {
+            fprintf(stderr, "%s: 段 %s 超出文件范围\n", path, sh->name);
+            continue;
+        }
+        while (map < elf.mapping_count && elf.mappings[map].section < i) {
+            map++;
+        }
+        size_t map_end = map;
+        while (map_end < elf.mapping_count && elf.mappings[map_end].section == i) {
+            map_end++;
+        }
+        sections[count++] = (arm64_listing_section_t){
+            sh->name, sh->address, sh->data, (size_t)sh->size, endian,
+            &maps[map], map_end - map
+        };
+    }
+    for (size_t i = 0; i < elf.symbol_count; i++) {
+        syms[i] = (arm64_listing_symbol_t){ elf.symbols[i].address, elf.symbols[i].name };
+    }
+
+    arm64_listing_image_t image = {
+        path, elf.big ? "elf64-bigaarch64" : "elf64-littleaarch64", sections, count
+    };
+    bool ok = emit(o, &image, syms, elf.symbol_count);
+    free(maps);
+    free(syms);
+    free(sections);
+    arm64_elf_free(&elf);
+    if (!ok) {
+        fprintf(stderr, "%s: 输出失败\n", path);
+    }
+    return ok ? 0 : 1;
+}
+
+/* 原始映像：objdump -b binary 把整个文件作为 .data 段 */
+static int dump_binary(const char *path, const arm64_image_t *img, uint64_t vma,
+                       arm64_endian_t endian, const output_t *o) {
+    arm64_listing_section_t section = { ".data", vma, img->data, img->size, endian };
+    arm64_listing_image_t image = { path, "binary", &section, 1 };
+    if (!emit(o, &image, NULL, 0)) {
+        fprintf(stderr, "%s: 输出失败\n", path);
+        return 1;
+    }
+    return 0;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "用法: %s [-d|-D] [-j 段]... [-b binary] [--adjust-vma=地址] [-EB|-EL]"
+#ifdef ARM64_DISASM_HAVE_GZIP
+            " [--gzip] [--threads=N]"
+#endif
+            " 文件...\n"
+            "  -d  反汇编可执行段（默认）\n"
+            "  -D  反汇编所有已分配的数据段\n"
+            "  -j  只输出指定的段（可重复）\n"
+            "  -b  输入格式，只支持 binary（原始指令映像，作为 .data 段）\n"
+            "  --adjust-vma  原始映像第一个字节的地址（默认0）\n"
+            "  -EB/-EL  指令字节序（默认小端）\n"
+#ifdef ARM64_DISASM_HAVE_GZIP
+            "  --gzip  输出多成员 gzip（各块并行反汇编和压缩，可用 zcat 解压）\n"
+            "  --threads  --gzip 的工作线程数（默认为在线 CPU 数）\n"
+            "  --gzip-level  压缩级别 1-9（默认6）\n"
+#endif
+            , prog);
+}
+
+int main(int argc, char *argv[]) {
+    bool all = false;
+    arm64_image_options_t input;
+    arm64_image_options_init(&input);
+    const char **only = calloc((size_t)argc, sizeof(char *));
+    int only_count = 0;
+    output_t o = { stdout };
+#ifdef ARM64_DISASM_HAVE_GZIP
+    bool gzip = false;
+    int level = -1;
+#endif
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        int used;
+        if (strcmp(arg, "-d") == 0) {
+            all = false;
+        } else if (strcmp(arg, "-D") == 0) {
+            all = true;
+        } else if (strcmp(arg, "-j") == 0 && has_value) {
+            only[only_count++] = argv[++i];
+        } else if ((used = arm64_image_option(&input, argc, argv, i)) > 0) {
+            i += used - 1;
+#ifdef ARM64_DISASM_HAVE_GZIP
+        } else if (strcmp(arg, "--gzip") == 0) {
+            gzip = true;
+        } else if (strncmp(arg, "--threads=", 10) == 0) {
+            o.threads = (unsigned)strtoul(arg + 10, NULL, 0);
+        } else if (strncmp(arg, "--gzip-level=", 13) == 0) {
+            level = atoi(arg + 13);
+#endif
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (i >= argc) {
+        usage(argv[0]);
+        return 2;
+    }
+
+#ifdef ARM64_DISASM_HAVE_GZIP
+    if (gzip && !(o.sink = arm64_gzsink_open(stdout, level, 0))) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+#endif
+
+    int status = 0;
+    for (; i < argc; i++) {
+        arm64_image_t img;
+        if (!arm64_image_open(&img, argv[i])) {
+            perror(argv[i]);
+            status = 1;
+            continue;
+        }
+        int rc = input.binary ? dump_binary(argv[i], &img, input.vma, input.endian, &o) :
+                                dump_elf(argv[i], &img, all, only, only_count, input.endian, &o);
+        if (rc != 0) {
+            status = rc;
+        }
+        arm64_image_close(&img);
+    }
+#ifdef ARM64_DISASM_HAVE_GZIP
+    if (o.sink && !arm64_gzsink_close(o.sink, NULL)) {
+        fprintf(stderr, "压缩输出失败\n");
+        status = 1;
+    }
+#endif
+    free(only);
+    return status;
+}
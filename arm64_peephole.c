@@ -0,0 +1,477 @@
+/**
+ * ARM64反汇编器 - 窥孔分析
+ * 不依赖 libc，独立环境库中同样可用
+ */
+
+#include "arm64_peephole.h"
+
+/* 每条指令只计算一次、供各规则共用的信息 */
+typedef struct {
+    uint32_t props;             // INST_PROP_*
+    uint32_t writes;            // 写入的通用寄存器（位31为 SP）
+} inst_info_t;
+
+typedef void (*rule_step_t)(arm64_peephole_t *peep, const disasm_inst_t *inst,
+                            const inst_info_t *info);
+
+/* ========== 公共判断 ========== */
+
+/* ADD/SUB（立即数，不设置标志）：sf op 0 100010 sh imm12 Rn Rd */
+static inline bool is_add_sub_imm(uint32_t raw) {
+    return (raw & 0x3F800000) == 0x11000000;
+}
+
+static inline bool is_plain_load(const disasm_inst_t *inst) {
+    return inst->type >= INST_TYPE_LDR && inst->type <= INST_TYPE_LDRSH;
+}
+
+/* 指令写入的通用寄存器；XZR/WZR 不计，回写基址和 BL/BLR 的 X30 计入 */
+static uint32_t written_regs(const disasm_inst_t *inst) {
+    uint32_t regs = 0;
+
+    for (uint8_t i = 0; i < inst->operand_count; i++) {
+        const disasm_operand_t *op = &inst->operands[i];
+        if (op->kind == OPERAND_REG && (op->access & OPERAND_ACCESS_WRITE)) {
+            if (op->reg.type == REG_TYPE_SP) {
+                regs |= 1u << 31;
+            } else if ((op->reg.type == REG_TYPE_X || op->reg.type == REG_TYPE_W) &&
+                       op->reg.num != 31) {
+                regs |= 1u << op->reg.num;
+            }
+        } else if (op->kind == OPERAND_MEM && op->mem.writeback) {
+            regs |= 1u << op->mem.base;
+        }
+    }
+    if (inst->type == INST_TYPE_BL || inst->type == INST_TYPE_BLR) {
+        regs |= 1u << 30;
+    }
+    return regs;
+}
+
+/* 地址计算用到的通用寄存器（字面量寻址不用寄存器） */
+static uint32_t address_regs(const disasm_operand_t *mem) {
+    if (mem->mem.mode == ADDR_MODE_LITERAL) {
+        return 0;
+    }
+    uint32_t regs = 1u << (mem->mem.base_type == REG_TYPE_SP ? 31 : mem->mem.base);
+    if (mem->mem.has_index) {
+        regs |= 1u << mem->mem.index;
+    }
+    return regs;
+}
+
+static const disasm_operand_t *mem_operand(const disasm_inst_t *inst) {
+    for (uint8_t i = 0; i < inst->operand_count; i++) {
+        if (inst->operands[i].kind == OPERAND_MEM) {
+            return &inst->operands[i];
+        }
+    }
+    return NULL;
+}
+
+static bool same_address(const disasm_operand_t *a, const disasm_operand_t *b) {
+    return a->width == b->width &&
+           a->mem.mode == b->mem.mode &&
+           a->mem.disp == b->mem.disp &&
+           a->mem.base == b->mem.base &&
+           a->mem.base_type == b->mem.base_type &&
+           a->mem.has_index == b->mem.has_index &&
+           (!a->mem.has_index ||
+            (a->mem.index == b->mem.index && a->mem.index_type == b->mem.index_type &&
+             a->mem.extend == b->mem.extend && a->mem.shift == b->mem.shift));
+}
+
+/* 寄存器在读写集合中的位置：通用寄存器（SP 为位31）或浮点/SIMD 寄存器；零寄存器不计 */
+static inline bool reg_slot(uint8_t type, uint8_t num, bool *fp, uint32_t *bit) {
+    *fp = type >= REG_TYPE_V;
+    if (type == REG_TYPE_SP) {
+        num = 31;
+    } else if (type == REG_TYPE_XZR || type == REG_TYPE_WZR ||
+               (!*fp && num == 31)) {
+        return false;
+    }
+    *bit = 1u << num;
+    return true;
+}
+
+/* 指令读写的全部寄存器（显式操作数和地址寄存器），以及写入的浮点/SIMD 寄存器 */
+static void touched_regs(const disasm_inst_t *inst, uint32_t *gpr, uint32_t *fp,
+                         uint32_t *fp_written) {
+    *gpr = *fp = *fp_written = 0;
+    for (uint8_t i = 0; i < inst->operand_count; i++) {
+        const disasm_operand_t *op = &inst->operands[i];
+        bool is_fp;
+        uint32_t bit;
+        if (op->kind == OPERAND_REG && reg_slot(op->reg.type, op->reg.num, &is_fp, &bit)) {
+            *(is_fp ? fp : gpr) |= bit;
+            if (is_fp && (op->access & OPERAND_ACCESS_WRITE)) {
+                *fp_written |= bit;
+            }
+        } else if (op->kind == OPERAND_MEM && op->mem.mode != ADDR_MODE_LITERAL) {
+            *gpr |= address_regs(op);
+        }
+    }
+}
+
+/* 可以与相邻访问合并为 LDP/STP/LDPSW 的单寄存器访问：立即数偏移，至少32位 */
+static bool pair_candidate(const disasm_inst_t *inst, arm64_peep_pair_t *c) {
+    if ((inst->type != INST_TYPE_LDR && inst->type != INST_TYPE_LDRSW &&
+         inst->type != INST_TYPE_STR) || inst->operand_count != 2) {
+        return false;
+    }
+    const disasm_operand_t *r = &inst->operands[0];
+    const disasm_operand_t *m = &inst->operands[1];
+    if (r->kind != OPERAND_REG || m->kind != OPERAND_MEM || m->width < 32 ||
+        (m->mem.mode != ADDR_MODE_IMM_UNSIGNED && m->mem.mode != ADDR_MODE_IMM_SIGNED)) {
+        return false;
+    }
+    c->mem = *m;
+    c->address = inst->address;
+    c->type = (uint8_t)inst->type;
+    c->reg = r->reg.num;
+    c->reg_width = (uint8_t)(r->width > 255 ? 255 : r->width);
+    c->fp = r->reg.type >= REG_TYPE_V;
+    c->touched_gpr = c->touched_fp = 0;
+    return true;
+}
+
+/* 两次访问能否合并：同类型、同大小、同基址，偏移相邻且较小的偏移在 imm7 范围内 */
+static bool pair_mergeable(const arm64_peep_pair_t *a, const arm64_peep_pair_t *b) {
+    if (a->type != b->type || a->fp != b->fp || a->reg_width != b->reg_width ||
+        a->mem.width != b->mem.width || a->mem.mem.base != b->mem.mem.base ||
+        a->mem.mem.base_type != b->mem.mem.base_type) {
+        return false;
+    }
+    int64_t size = a->mem.width / 8;
+    int64_t lo = a->mem.mem.disp < b->mem.mem.disp ? a->mem.mem.disp : b->mem.mem.disp;
+    int64_t hi = a->mem.mem.disp < b->mem.mem.disp ? b->mem.mem.disp : a->mem.mem.disp;
+    if (hi - lo != size || lo % size != 0 || lo < -64 * size || lo > 63 * size) {
+        return false;
+    }
+    if (a->type == INST_TYPE_STR) {
+        return true;
+    }
+    /* 加载合并到第一条的位置：两个目标不同，第二个目标在中间没有被读写 */
+    uint32_t bit = 1u << (b->reg & 31);
+    return a->reg != b->reg && !((b->fp ? a->touched_fp : a->touched_gpr) & bit);
+}
+
+static void report(arm64_peephole_t *peep, arm64_peep_rule_t rule, uint64_t address,
+                   uint32_t raw, uint64_t related) {
+    peep->counts[rule]++;
+    if (peep->report) {
+        arm64_peep_site_t site = { rule, address, raw, related };
+        peep->report(peep->report_ctx, &site);
+    }
+}
+
+/* ========== 规则 ========== */
+
+/* mov xN, xN：ORR 形式的64位自身拷贝（mov wN, wN 会清零高32位，不算） */
+static void rule_mov_self(arm64_peephole_t *peep, const disasm_inst_t *inst,
+                          const inst_info_t *info) {
+    (void)info;
+    if (inst->type != INST_TYPE_MOV || inst->operand_count != 2 ||
+        is_add_sub_imm(inst->raw)) {
+        return;
+    }
+    const disasm_operand_t *d = &inst->operands[0];
+    const disasm_operand_t *s = &inst->operands[1];
+    if (d->kind == OPERAND_REG && s->kind == OPERAND_REG &&
+        d->reg.type == REG_TYPE_X && s->reg.type == REG_TYPE_X &&
+        d->reg.num == s->reg.num) {
+        report(peep, ARM64_PEEP_MOV_SELF, inst->address, inst->raw, 0);
+    }
+}
+
+/*
+ * 标志定义-使用：记住最近一条设置标志的指令；再次设置标志（不先读取）、
+ * 调用或返回（AAPCS64 不保留也不返回 NZCV）时它的标志是死的。
+ * 读取标志、无法识别或系统指令时保守地认为标志被使用
+ */
+static void rule_dead_flags(arm64_peephole_t *peep, const disasm_inst_t *inst,
+                            const inst_info_t *info) {
+    uint32_t props = info->props;
+    if ((props & INST_PROP_READS_FLAGS) || inst->type == INST_TYPE_UNKNOWN ||
+        (props & (INST_PROP_SYSTEM | INST_PROP_EXCEPTION))) {
+        peep->flags_pending = false;
+    } else if (peep->flags_pending &&
+               (props & (INST_PROP_SETS_FLAGS | INST_PROP_CALL | INST_PROP_RETURN))) {
+        report(peep, ARM64_PEEP_DEAD_FLAGS, peep->flags_address, peep->flags_raw,
+               inst->address);
+        peep->flags_pending = false;
+    }
+    if (props & INST_PROP_SETS_FLAGS) {
+        peep->flags_pending = true;
+        peep->flags_address = inst->address;
+        peep->flags_raw = inst->raw;
+    }
+}
+
+/*
+ * 重复加载：与窗口内同宽度、同类型、同地址表达式的前一次加载比较。
+ * 任何写内存、屏障、独占/获取语义或无法识别的指令清空记录；
+ * 改写地址寄存器的指令（包括加载自身）使相应记录失效
+ */
+static void rule_redundant_load(arm64_peephole_t *peep, const disasm_inst_t *inst,
+                                const inst_info_t *info) {
+    uint32_t props = info->props;
+    if ((props & (INST_PROP_MEM_WRITE | INST_PROP_BARRIER | INST_PROP_EXCLUSIVE |
+                  INST_PROP_ACQUIRE | INST_PROP_SYSTEM | INST_PROP_EXCEPTION)) ||
+        inst->type == INST_TYPE_UNKNOWN) {
+        peep->load_count = 0;
+        return;
+    }
+
+    const disasm_operand_t *mem = is_plain_load(inst) ? mem_operand(inst) : NULL;
+    if (mem && !mem->mem.writeback) {
+        for (uint8_t i = 0; i < peep->load_count; i++) {
+            const arm64_peep_load_t *prev = &peep->loads[i];
+            if (prev->type == inst->type && peep->insts - prev->seq <= ARM64_PEEPHOLE_LOAD_WINDOW &&
+                same_address(&prev->mem, mem)) {
+                report(peep, ARM64_PEEP_REDUNDANT_LOAD, inst->address, inst->raw,
+                       prev->address);
+                break;
+            }
+        }
+    }
+
+    /* 淘汰过期记录和地址寄存器被改写的记录 */
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < peep->load_count; i++) {
+        const arm64_peep_load_t *prev = &peep->loads[i];
+        if (peep->insts - prev->seq < ARM64_PEEPHOLE_LOAD_WINDOW &&
+            !(address_regs(&prev->mem) & info->writes)) {
+            peep->loads[kept++] = *prev;
+        }
+    }
+    peep->load_count = kept;
+
+    if (mem && !mem->mem.writeback && !(address_regs(mem) & info->writes)) {
+        if (peep->load_count == ARM64_PEEPHOLE_LOADS) {
+            for (uint8_t i = 1; i < ARM64_PEEPHOLE_LOADS; i++) {
+                peep->loads[i - 1] = peep->loads[i];
+            }
+            peep->load_count--;
+        }
+        arm64_peep_load_t *slot = &peep->loads[peep->load_count++];
+        slot->mem = *mem;
+        slot->address = inst->address;
+        slot->seq = peep->insts;
+        slot->type = (uint8_t)inst->type;
+    }
+}
+
+/*
+ * add/sub Xd, Xn, #0：不涉及 SP 的拷贝应写成 mov（ORR 形式可以被重命名阶段消除），
+ * Xd == Xn 时可以删除。Xn 来自 ADRP 时是 :lo12: 重定位的结果，不报告
+ */
+static void rule_add_zero(arm64_peephole_t *peep, const disasm_inst_t *inst,
+                          const inst_info_t *info) {
+    (void)info;
+    uint32_t raw = inst->raw;
+    if (!is_add_sub_imm(raw) || BITS(raw, 10, 21) != 0) {
+        return;
+    }
+    uint32_t rd = BITS(raw, 0, 4), rn = BITS(raw, 5, 9);
+    if (rd == 31 || rn == 31 || (peep->adrp_regs & (1u << rn))) {
+        return;
+    }
+    report(peep, ARM64_PEEP_ADD_ZERO, inst->address, raw, 0);
+}
+
+/* 跳到下一条指令的直接分支（不含 BL：调用有副作用） */
+static void rule_branch_next(arm64_peephole_t *peep, const disasm_inst_t *inst,
+                             const inst_info_t *info) {
+    (void)info;
+    switch (inst->type) {
+        case INST_TYPE_B:
+        case INST_TYPE_BCOND:
+        case INST_TYPE_CBZ:
+        case INST_TYPE_CBNZ:
+        case INST_TYPE_TBZ:
+        case INST_TYPE_TBNZ:
+            break;
+        default:
+            return;
+    }
+    uint64_t target;
+    if (get_branch_target(inst, &target) && target == inst->address + 4) {
+        report(peep, ARM64_PEEP_BRANCH_NEXT, inst->address, inst->raw, target);
+    }
+}
+
+/*
+ * LDP/STP 配对：记录窗口内的 LDR/STR，后来的访问与其中之一可合并时报告。
+ * 加载合并到第一条的位置：中间不能有存储，第二个目标不能被中间的指令读写；
+ * 存储合并到第二条的位置：中间不能有内存访问，第一条的源寄存器不能被改写；
+ * 两者的基址都不能被改写
+ */
+static void rule_ldst_pair(arm64_peephole_t *peep, const disasm_inst_t *inst,
+                           const inst_info_t *info) {
+    uint32_t props = info->props;
+    if ((props & (INST_PROP_BARRIER | INST_PROP_EXCLUSIVE | INST_PROP_ACQUIRE |
+                  INST_PROP_RELEASE | INST_PROP_SYSTEM | INST_PROP_EXCEPTION)) ||
+        inst->type == INST_TYPE_UNKNOWN) {
+        peep->pair_count = 0;
+        return;
+    }
+
+    arm64_peep_pair_t cur;
+    bool candidate = pair_candidate(inst, &cur);
+    bool merged = false;
+    uint32_t gpr = 0, fp = 0, fp_written = 0;
+    if (peep->pair_count) {
+        touched_regs(inst, &gpr, &fp, &fp_written);
+    }
+
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < peep->pair_count; i++) {
+        arm64_peep_pair_t prev = peep->pairs[i];
+        if (candidate && !merged && pair_mergeable(&prev, &cur)) {
+            report(peep, ARM64_PEEP_LDST_PAIR, inst->address, inst->raw, prev.address);
+            merged = true;
+            continue;
+        }
+        /* 当前指令成为之后配对的中间指令 */
+        bool store = prev.type == INST_TYPE_STR;
+        uint32_t bit = 1u << (prev.reg & 31);
+        if (peep->insts - prev.seq >= ARM64_PEEPHOLE_PAIR_WINDOW ||
+            (address_regs(&prev.mem) & info->writes) ||
+            (props & (store ? INST_PROP_MEM : INST_PROP_MEM_WRITE)) ||
+            (store && ((prev.fp ? fp_written : info->writes) & bit))) {
+            continue;
+        }
+        prev.touched_gpr |= gpr;
+        prev.touched_fp |= fp;
+        peep->pairs[kept++] = prev;
+    }
+    peep->pair_count = kept;
+
+    /* 改写自己基址的加载（ldr x1, [x1, #8]）之后的访问地址已不同 */
+    if (candidate && !merged && !(address_regs(&cur.mem) & info->writes)) {
+        if (peep->pair_count == ARM64_PEEPHOLE_PAIRS) {
+            for (uint8_t i = 1; i < ARM64_PEEPHOLE_PAIRS; i++) {
+                peep->pairs[i - 1] = peep->pairs[i];
+            }
+            peep->pair_count--;
+        }
+        cur.seq = peep->insts;
+        peep->pairs[peep->pair_count++] = cur;
+    }
+}
+
+/* 规则表：按 arm64_peep_rule_t 顺序 */
+static const struct {
+    const char *name;
+    const char *desc;
+    rule_step_t step;
+} rules[ARM64_PEEP_RULE_COUNT] = {
+    { "mov-self",       "mov xN, xN 自身拷贝",              rule_mov_self },
+    { "dead-flags",     "设置的标志未被读取",               rule_dead_flags },
+    { "redundant-load", "重复加载同一地址",                 rule_redundant_load },
+    { "add-zero",       "add/sub #0 代替 mov 或可删除",     rule_add_zero },
+    { "branch-next",    "分支到下一条指令",                 rule_branch_next },
+    { "ldst-pair",      "可合并为 LDP/STP 的相邻访问",      rule_ldst_pair },
+};
+
+/* ========== 驱动 ========== */
+
+void arm64_peephole_init(arm64_peephole_t *peep, uint32_t rules_mask,
+                         arm64_peep_report_t report_fn, void *ctx) {
+    *peep = (arm64_peephole_t){0};
+    peep->rules = rules_mask & ARM64_PEEP_ALL;
+    peep->report = report_fn;
+    peep->report_ctx = ctx;
+}
+
+void arm64_peephole_block_end(arm64_peephole_t *peep) {
+    peep->adrp_regs = 0;
+    peep->flags_pending = false;
+    peep->load_count = 0;
+    peep->pair_count = 0;
+}
+
+void arm64_peephole_set_leaders(arm64_peephole_t *peep, const uint64_t *leaders, size_t count) {
+    peep->leaders = leaders;
+    peep->leader_count = leaders ? count : 0;
+    peep->next_leader = 0;
+}
+
+void arm64_peephole_feed(arm64_peephole_t *peep, const disasm_inst_t *insts, size_t count) {
+    bool track_regs = (peep->rules & ((1u << ARM64_PEEP_REDUNDANT_LOAD) |
+                                      (1u << ARM64_PEEP_ADD_ZERO) |
+                                      (1u << ARM64_PEEP_LDST_PAIR))) != 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const disasm_inst_t *inst = &insts[i];
+
+        /* 分支目标处开始新的基本块：其他路径进入时块内状态不成立 */
+        while (peep->next_leader < peep->leader_count &&
+               peep->leaders[peep->next_leader] < inst->address) {
+            peep->next_leader++;
+        }
+        if (peep->next_leader < peep->leader_count &&
+            peep->leaders[peep->next_leader] == inst->address) {
+            arm64_peephole_block_end(peep);
+        }
+
+        inst_info_t info;
+        info.props = get_inst_props(inst);
+        /* 写入集合只在有寄存器相关状态或可能新增状态时计算 */
+        info.writes = track_regs && (peep->load_count || peep->adrp_regs || peep->pair_count ||
+                                     is_plain_load(inst) || inst->type == INST_TYPE_STR ||
+                                     inst->type == INST_TYPE_ADRP) ?
+                      written_regs(inst) : 0;
+
+        for (int r = 0; r < ARM64_PEEP_RULE_COUNT; r++) {
+            if (peep->rules & (1u << r)) {
+                rules[r].step(peep, inst, &info);
+            }
+        }
+
+        peep->adrp_regs &= ~info.writes;
+        if (inst->type == INST_TYPE_ADRP && inst->rd != 31) {
+            peep->adrp_regs |= 1u << inst->rd;
+        }
+        peep->insts++;
+
+        if (info.props & INST_PROP_BRANCH) {
+            arm64_peephole_block_end(peep);
+        }
+    }
+}
+
+static bool scan_visit(const disasm_inst_t *insts, size_t count, void *ctx) {
+    arm64_peephole_feed(ctx, insts, count);
+    return true;
+}
+
+size_t arm64_peephole_scan(arm64_peephole_t *peep, const void *bytes, size_t size,
+                           uint64_t address, arm64_endian_t endian) {
+    size_t n = disassemble_visit_bytes(bytes, size, address, endian, NULL, scan_visit, peep);
+    arm64_peephole_block_end(peep);
+    return n;
+}
+
+const char *arm64_peephole_rule_name(arm64_peep_rule_t rule) {
+    return (unsigned)rule < ARM64_PEEP_RULE_COUNT ? rules[rule].name : "?";
+}
+
+const char *arm64_peephole_rule_desc(arm64_peep_rule_t rule) {
+    return (unsigned)rule < ARM64_PEEP_RULE_COUNT ? rules[rule].desc : "";
+}
+
+arm64_peep_rule_t arm64_peephole_rule_find(const char *name) {
+    for (int r = 0; r < ARM64_PEEP_RULE_COUNT; r++) {
+        const char *a = rules[r].name, *b = name;
+        while (*a && *a == *b) {
+            a++;
+            b++;
+        }
+        if (*a == '\0' && *b == '\0') {
+            return (arm64_peep_rule_t)r;
+        }
+    }
+    return ARM64_PEEP_RULE_COUNT;
+}
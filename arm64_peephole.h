@@ -0,0 +1,158 @@
+/**
+ * ARM64反汇编器 - 窥孔分析：查找编译器输出中错过的优化
+ * 在基本块内按规则表逐条检查已解码的指令，规则使用寄存器写入和 NZCV 标志的定义-使用信息：
+ *   mov-self        mov xN, xN（64位自身拷贝，不改变任何状态）
+ *   dead-flags      设置标志的指令（adds/subs/cmp/fcmp...）的标志在被读取之前就被覆盖，
+ *                   或者在函数调用/返回处失效
+ *   redundant-load  同一基本块内相隔不远的两次加载读取同一地址，中间没有存储、屏障，
+ *                   地址寄存器也没有被改写
+ *   add-zero        add/sub Xd, Xn, #0（不是 SP 拷贝，也不是 ADRP 之后的 :lo12: 低位）
+ *   branch-next     目标为下一条指令的 b/b.cond/cbz/tbz
+ *   ldst-pair       同一基址、同样大小、偏移相邻且在 LDP/STP 立即数范围内的两次
+ *                   LDR/STR（或 LDRSW），中间没有依赖，可以合并为一条 LDP/STP/LDPSW
+ *
+ * 基本块在每条分支指令（含调用和返回）之后结束，也在 arm64_peephole_set_leaders
+ * 给出的块首（分支目标）之前结束；调用者在函数边界处调用 arm64_peephole_block_end。
+ * 分析是单遍流式的，状态大小固定，不分配内存
+ *
+ * 结果是提示而不是证明：volatile/设备内存的重复加载、间接跳转（跳转表）进入的块中间
+ * 等情况需要人工确认
+ */
+
+#ifndef ARM64_PEEPHOLE_H
+#define ARM64_PEEPHOLE_H
+
+#include "arm64_disasm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 规则 */
+typedef enum {
+    ARM64_PEEP_MOV_SELF,
+    ARM64_PEEP_DEAD_FLAGS,
+    ARM64_PEEP_REDUNDANT_LOAD,
+    ARM64_PEEP_ADD_ZERO,
+    ARM64_PEEP_BRANCH_NEXT,
+    ARM64_PEEP_LDST_PAIR,
+    ARM64_PEEP_RULE_COUNT
+} arm64_peep_rule_t;
+
+/* 全部规则的掩码（1u << ARM64_PEEP_*） */
+#define ARM64_PEEP_ALL              ((1u << ARM64_PEEP_RULE_COUNT) - 1)
+
+/* 最多跟踪的最近加载数，以及两次加载之间最多相隔的指令数 */
+#define ARM64_PEEPHOLE_LOADS        4
+#define ARM64_PEEPHOLE_LOAD_WINDOW  8
+
+/* 最多跟踪的待配对访问数，以及两次访问之间最多相隔的指令数 */
+#define ARM64_PEEPHOLE_PAIRS        4
+#define ARM64_PEEPHOLE_PAIR_WINDOW  4
+
+/* 一处发现 */
+typedef struct {
+    arm64_peep_rule_t rule;
+    uint64_t address;           // 可以删除或改写的指令
+    uint32_t raw;
+    uint64_t related;           // dead-flags: 覆盖标志的指令；redundant-load: 前一次加载；
+                                // branch-next: 分支目标；ldst-pair: 配对的前一次访问；其余为0
+} arm64_peep_site_t;
+
+/* 报告回调 */
+typedef void (*arm64_peep_report_t)(void *ctx, const arm64_peep_site_t *site);
+
+/* 最近的一次加载 */
+typedef struct {
+    disasm_operand_t mem;       // 内存操作数
+    uint64_t address;
+    uint64_t seq;               // 指令序号
+    uint8_t type;               // inst_type_t
+} arm64_peep_load_t;
+
+/* 等待配对的一次 LDR/STR */
+typedef struct {
+    disasm_operand_t mem;       // 内存操作数（立即数偏移，无回写）
+    uint64_t address;
+    uint64_t seq;
+    uint8_t type;               // inst_type_t
+    uint8_t reg;                // 数据寄存器编号
+    uint8_t reg_width;          // 数据寄存器位宽
+    bool fp;                    // 数据寄存器是浮点/SIMD 寄存器
+    uint32_t touched_gpr;       // 之后的指令读写过的通用寄存器
+    uint32_t touched_fp;        // 之后的指令读写过的浮点/SIMD 寄存器
+} arm64_peep_pair_t;
+
+/* 分析器 */
+typedef struct {
+    uint32_t rules;                         // 启用的规则
+    arm64_peep_report_t report;
+    void *report_ctx;
+    uint64_t counts[ARM64_PEEP_RULE_COUNT]; // 各规则的发现数
+    uint64_t insts;                         // 已分析的指令数
+
+    /* 块内状态 */
+    uint32_t adrp_regs;                     // 当前值来自 ADRP 的通用寄存器
+    bool flags_pending;                     // 有尚未被读取的标志定义
+    uint64_t flags_address;
+    uint32_t flags_raw;
+    arm64_peep_load_t loads[ARM64_PEEPHOLE_LOADS];
+    uint8_t load_count;
+    arm64_peep_pair_t pairs[ARM64_PEEPHOLE_PAIRS];
+    uint8_t pair_count;
+
+    /* 块首：分支目标，按地址升序（由调用者保持有效） */
+    const uint64_t *leaders;
+    size_t leader_count;
+    size_t next_leader;                     // 第一个地址不小于当前指令的块首
+} arm64_peephole_t;
+
+/**
+ * 初始化分析器
+ * @param rules 启用的规则掩码，如 ARM64_PEEP_ALL
+ * @param report 每处发现调用一次，可为 NULL（只计数）
+ */
+void arm64_peephole_init(arm64_peephole_t *peep, uint32_t rules,
+                         arm64_peep_report_t report, void *ctx);
+
+/**
+ * 设置块首地址：分析到这些地址的指令之前先结束当前基本块，
+ * 使跨越标号（循环头、前向分支的目标）的规则不再成立
+ * @param leaders 按地址升序的块首，调用者保持有效直到下次设置；NULL 表示没有
+ */
+void arm64_peephole_set_leaders(arm64_peephole_t *peep, const uint64_t *leaders, size_t count);
+
+/**
+ * 按地址顺序分析一批连续的指令（可以分多次调用）
+ */
+void arm64_peephole_feed(arm64_peephole_t *peep, const disasm_inst_t *insts, size_t count);
+
+/**
+ * 结束当前基本块（函数边界、不连续的地址等），丢弃块内状态
+ */
+void arm64_peephole_block_end(arm64_peephole_t *peep);
+
+/**
+ * 流式解码并分析一段代码，结束时调用 arm64_peephole_block_end
+ * @return 分析的指令数
+ */
+size_t arm64_peephole_scan(arm64_peephole_t *peep, const void *bytes, size_t size,
+                           uint64_t address, arm64_endian_t endian);
+
+/**
+ * 规则名称（如 "dead-flags"）和说明
+ */
+const char *arm64_peephole_rule_name(arm64_peep_rule_t rule);
+const char *arm64_peephole_rule_desc(arm64_peep_rule_t rule);
+
+/**
+ * 按名称查找规则
+ * @return 找不到时返回 ARM64_PEEP_RULE_COUNT
+ */
+arm64_peep_rule_t arm64_peephole_rule_find(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_PEEPHOLE_H */
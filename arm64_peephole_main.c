@@ -0,0 +1,617 @@
+/**
+ * ARM64窥孔分析工具：在编译器输出中查找错过的优化
+ * 读取 AArch64 ELF（或 -b binary 原始映像），逐个函数流式解码和分析可执行段，
+ * 输出每个函数的各规则计数和发现位置，最后输出合计
+ * 每处发现按所在的循环深度（每层估计10次迭代）或剖析数据中的执行计数加权，
+ * 每个文件之后列出权重最高的函数
+ *
+ * 用法：arm64_peephole [-r 规则[,规则...]] [-m 每函数最多列出的位置] [-p 剖析数据]
+ *                      [-t 热点函数数] [-b binary] [--adjust-vma=地址] [-EB|-EL] 文件...
+ */
+
+#include "arm64_elf.h"
+#include "arm64_peephole.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ========== 剖析数据 ========== */
+
+/* 地址的执行计数（按地址排序，同一地址已合并） */
+typedef struct {
+    uint64_t address;
+    uint64_t count;
+} sample_t;
+
+typedef struct {
+    sample_t *samples;
+    size_t count;
+} profile_t;
+
+static int sample_cmp(const void *x, const void *y) {
+    const sample_t *a = x, *b = y;
+    return a->address < b->address ? -1 : (a->address > b->address);
+}
+
+/*
+ * 读取剖析数据：每行 "地址 [计数]"，地址为十六进制（可带 0x），计数缺省为1；
+ * 因此 perf script -F ip 或 arm64_trace 文本轨迹的每个样本可以直接使用。# 开头的行被忽略
+ */
+static bool profile_load(profile_t *prof, const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return false;
+    }
+    size_t cap = 4096;
+    prof->samples = malloc(cap * sizeof(sample_t));
+    prof->count = 0;
+    char line[256];
+    bool ok = prof->samples != NULL;
+    while (ok && fgets(line, sizeof(line), f)) {
+        char *p = line + strspn(line, " \t");
+        char *end;
+        if (*p == '#' || *p == '\n' || *p == '\0') {
+            continue;
+        }
+        uint64_t address = strtoull(p, &end, 16);
+        if (end == p) {
+            continue;
+        }
+        uint64_t count = strtoull(end, &p, 10);
+        if (p == end) {
+            count = 1;
+        }
+        if (prof->count == cap) {
+            sample_t *grown = realloc(prof->samples, cap * 2 * sizeof(sample_t));
+            if (!grown) {
+                ok = false;
+                break;
+            }
+            prof->samples = grown;
+            cap *= 2;
+        }
+        prof->samples[prof->count++] = (sample_t){ address, count };
+    }
+    fclose(f);
+    if (!ok) {
+        free(prof->samples);
+        return false;
+    }
+
+    qsort(prof->samples, prof->count, sizeof(sample_t), sample_cmp);
+    size_t n = 0;
+    for (size_t i = 0; i < prof->count; i++) {
+        if (n > 0 && prof->samples[n - 1].address == prof->samples[i].address) {
+            prof->samples[n - 1].count += prof->samples[i].count;
+        } else {
+            prof->samples[n++] = prof->samples[i];
+        }
+    }
+    prof->count = n;
+    return true;
+}
+
+static uint64_t profile_count(const profile_t *prof, uint64_t address) {
+    size_t lo = 0, hi = prof->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (prof->samples[mid].address < address) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo < prof->count && prof->samples[lo].address == address ?
+           prof->samples[lo].count : 0;
+}
+
+/* ========== 块首与循环深度 ========== */
+
+/*
+ * 函数内的直接分支：目标是基本块的块首；目标不在分支之后的是回边，
+ * [target, branch] 视为一个循环
+ */
+typedef struct {
+    uint64_t target;
+    uint64_t branch;
+} branch_edge_t;
+
+typedef struct {
+    uint64_t start;
+    uint64_t end;
+    branch_edge_t *edges;
+    size_t count;
+    size_t cap;
+    uint64_t *leaders;              // 去重后按地址升序的分支目标
+    size_t leader_count;
+    bool failed;
+} edges_t;
+
+static bool collect_edges(const disasm_inst_t *insts, size_t count, void *ctx) {
+    edges_t *e = ctx;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t target;
+        if (!get_branch_target(&insts[i], &target) || target < e->start || target >= e->end) {
+            continue;
+        }
+        if (e->count == e->cap) {
+            size_t cap = e->cap ? e->cap * 2 : 16;
+            branch_edge_t *grown = realloc(e->edges, cap * sizeof(branch_edge_t));
+            if (!grown) {
+                e->failed = true;
+                return false;
+            }
+            e->edges = grown;
+            e->cap = cap;
+        }
+        e->edges[e->count++] = (branch_edge_t){ target, insts[i].address };
+    }
+    return true;
+}
+
+static int address_cmp(const void *x, const void *y) {
+    uint64_t a = *(const uint64_t *)x, b = *(const uint64_t *)y;
+    return a < b ? -1 : a > b;
+}
+
+/* 由分支边生成块首表；leaders 与 edges 同容量 */
+static bool build_leaders(edges_t *e) {
+    e->leader_count = 0;
+    if (e->count == 0) {
+        return true;
+    }
+    uint64_t *leaders = realloc(e->leaders, e->cap * sizeof(uint64_t));
+    if (!leaders) {
+        e->failed = true;
+        return false;
+    }
+    e->leaders = leaders;
+    for (size_t i = 0; i < e->count; i++) {
+        leaders[i] = e->edges[i].target;
+    }
+    qsort(leaders, e->count, sizeof(uint64_t), address_cmp);
+    size_t n = 1;
+    for (size_t i = 1; i < e->count; i++) {
+        if (leaders[i] != leaders[n - 1]) {
+            leaders[n++] = leaders[i];
+        }
+    }
+    e->leader_count = n;
+    return true;
+}
+
+/* 包含 address 的循环数（嵌套深度） */
+static unsigned loop_depth(const edges_t *e, uint64_t address) {
+    unsigned depth = 0;
+    for (size_t i = 0; i < e->count; i++) {
+        const branch_edge_t *edge = &e->edges[i];
+        depth += edge->target <= edge->branch &&
+                 edge->target <= address && address <= edge->branch;
+    }
+    return depth;
+}
+
+/* 没有剖析数据时的静态权重：每层循环按10次迭代估计 */
+#define MAX_WEIGHT_DEPTH    6
+
+static uint64_t depth_weight(unsigned depth) {
+    uint64_t w = 1;
+    for (unsigned d = 0; d < depth && d < MAX_WEIGHT_DEPTH; d++) {
+        w *= 10;
+    }
+    return w;
+}
+
+/* ========== 按函数分析 ========== */
+
+/* 有发现的函数（用于按权重排序） */
+typedef struct {
+    const char *name;
+    uint64_t address;
+    uint64_t sites;
+    uint64_t weight;
+} hot_function_t;
+
+typedef struct {
+    arm64_peephole_t peep;
+    size_t max_sites;               // 每个函数最多列出的位置数
+    const profile_t *profile;       // 非空时按执行计数加权，否则按循环深度
+    arm64_peep_site_t *sites;       // 当前函数的全部发现位置
+    size_t site_count;
+    size_t site_cap;
+    bool failed;                    // 内存不足
+    edges_t edges;                  // 当前函数的分支边和块首
+    uint64_t weights[ARM64_PEEP_RULE_COUNT];
+    hot_function_t *hot;            // 当前文件中有发现的函数
+    size_t hot_count;
+    size_t hot_cap;
+    uint64_t functions;             // 有发现的函数数
+    uint64_t scanned;               // 分析过的函数数
+} analysis_t;
+
+static void on_site(void *ctx, const arm64_peep_site_t *site) {
+    analysis_t *a = ctx;
+    if (a->site_count == a->site_cap) {
+        size_t cap = a->site_cap ? a->site_cap * 2 : 64;
+        arm64_peep_site_t *grown = realloc(a->sites, cap * sizeof(*grown));
+        if (!grown) {
+            a->failed = true;
+            return;
+        }
+        a->sites = grown;
+        a->site_cap = cap;
+    }
+    a->sites[a->site_count++] = *site;
+}
+
+static int site_cmp(const void *x, const void *y) {
+    const arm64_peep_site_t *a = x, *b = y;
+    if (a->address != b->address) {
+        return a->address < b->address ? -1 : 1;
+    }
+    return (int)a->rule - (int)b->rule;
+}
+
+static bool has_related(arm64_peep_rule_t rule) {
+    return rule != ARM64_PEEP_MOV_SELF && rule != ARM64_PEEP_ADD_ZERO;
+}
+
+/*
+ * 一处发现的权重。剖析样本落在哪条指令上有偶然性，同一基本块内的两条相关指令
+ * （标志定义和覆盖、两次加载、配对的两次访问）取较大的计数
+ */
+static uint64_t site_weight(const analysis_t *a, const arm64_peep_site_t *s) {
+    if (!a->profile) {
+        return depth_weight(loop_depth(&a->edges, s->address));
+    }
+    uint64_t w = profile_count(a->profile, s->address);
+    if (has_related(s->rule) && s->rule != ARM64_PEEP_BRANCH_NEXT) {
+        uint64_t r = profile_count(a->profile, s->related);
+        w = r > w ? r : w;
+    }
+    return w;
+}
+
+static void print_site(const analysis_t *a, const arm64_peep_site_t *s, unsigned depth,
+                       uint64_t weight) {
+    disasm_inst_t inst;
+    char text[256];
+    if (disassemble_arm64(s->raw, s->address, &inst)) {
+        format_instruction(&inst, text, sizeof(text));
+    } else {
+        snprintf(text, sizeof(text), ".word 0x%08x", s->raw);
+    }
+    printf("    %8llx:  %08x  %-32s %s", (unsigned long long)s->address, s->raw, text,
+           arm64_peephole_rule_name(s->rule));
+    if (has_related(s->rule)) {
+        printf(" -> 0x%llx", (unsigned long long)s->related);
+    }
+    if (a->profile) {
+        printf("  计数 %llu", (unsigned long long)weight);
+    } else if (depth > 0) {
+        printf("  循环深度 %u", depth);
+    }
+    printf("\n");
+}
+
+static void add_hot(analysis_t *a, const char *name, uint64_t address, uint64_t sites,
+                    uint64_t weight) {
+    if (a->hot_count == a->hot_cap) {
+        size_t cap = a->hot_cap ? a->hot_cap * 2 : 64;
+        hot_function_t *grown = realloc(a->hot, cap * sizeof(*grown));
+        if (!grown) {
+            a->failed = true;
+            return;
+        }
+        a->hot = grown;
+        a->hot_cap = cap;
+    }
+    a->hot[a->hot_count++] = (hot_function_t){ name, address, sites, weight };
+}
+
+/* 分析一个函数 [address, address + size) 并输出其发现 */
+static void analyze_function(analysis_t *a, const char *name, uint64_t address,
+                             const uint8_t *bytes, size_t size, arm64_endian_t endian) {
+    uint64_t before[ARM64_PEEP_RULE_COUNT];
+    memcpy(before, a->peep.counts, sizeof(before));
+
+    /* 先收集函数内的直接分支：目标作为块首，回边用于循环深度 */
+    inst_type_set_t branches;
+    inst_type_set_clear(&branches);
+    inst_type_set_add(&branches, INST_TYPE_B);
+    inst_type_set_add(&branches, INST_TYPE_BCOND);
+    inst_type_set_add(&branches, INST_TYPE_CBZ);
+    inst_type_set_add(&branches, INST_TYPE_CBNZ);
+    inst_type_set_add(&branches, INST_TYPE_TBZ);
+    inst_type_set_add(&branches, INST_TYPE_TBNZ);
+    a->edges.start = address;
+    a->edges.end = address + size;
+    a->edges.count = 0;
+    disassemble_visit_bytes(bytes, size, address, endian, &branches, collect_edges, &a->edges);
+    build_leaders(&a->edges);
+    if (a->edges.failed) {
+        a->failed = true;
+    }
+
+    a->site_count = 0;
+    arm64_peephole_set_leaders(&a->peep, a->edges.leaders, a->edges.leader_count);
+    size_t insts = arm64_peephole_scan(&a->peep, bytes, size, address, endian);
+    arm64_peephole_set_leaders(&a->peep, NULL, 0);
+    a->scanned++;
+    if (a->site_count == 0) {
+        return;
+    }
+    a->functions++;
+
+    qsort(a->sites, a->site_count, sizeof(*a->sites), site_cmp);
+    uint64_t weight = 0;
+    for (size_t i = 0; i < a->site_count; i++) {
+        const arm64_peep_site_t *s = &a->sites[i];
+        uint64_t w = site_weight(a, s);
+        a->weights[s->rule] += w;
+        weight += w;
+    }
+
+    printf("%s (0x%llx, %zu 条指令, 权重 %llu):", name, (unsigned long long)address, insts,
+           (unsigned long long)weight);
+    const char *sep = " ";
+    for (int r = 0; r < ARM64_PEEP_RULE_COUNT; r++) {
+        uint64_t n = a->peep.counts[r] - before[r];
+        if (n) {
+            printf("%s%s %llu", sep, arm64_peephole_rule_name((arm64_peep_rule_t)r),
+                   (unsigned long long)n);
+            sep = ", ";
+        }
+    }
+    printf("\n");
+
+    size_t shown = a->site_count < a->max_sites ? a->site_count : a->max_sites;
+    for (size_t i = 0; i < shown; i++) {
+        const arm64_peep_site_t *s = &a->sites[i];
+        unsigned depth = a->profile ? 0 : loop_depth(&a->edges, s->address);
+        print_site(a, s, depth, site_weight(a, s));
+    }
+    if (a->site_count > shown && a->max_sites > 0) {
+        printf("    ... 另有 %zu 处\n", a->site_count - shown);
+    }
+    add_hot(a, name, address, a->site_count, weight);
+}
+
+static int hot_cmp(const void *x, const void *y) {
+    const hot_function_t *a = x, *b = y;
+    if (a->weight != b->weight) {
+        return a->weight > b->weight ? -1 : 1;
+    }
+    return a->address < b->address ? -1 : (a->address > b->address);
+}
+
+/* 输出当前文件中权重最高的函数（名称指向映像，须在关闭映像前输出） */
+static void print_hot(analysis_t *a, size_t top) {
+    if (a->hot_count == 0 || top == 0) {
+        a->hot_count = 0;
+        return;
+    }
+    qsort(a->hot, a->hot_count, sizeof(*a->hot), hot_cmp);
+    size_t n = a->hot_count < top ? a->hot_count : top;
+    printf("\n权重最高的函数（%s）:\n", a->profile ? "按剖析计数" : "按循环深度");
+    for (size_t i = 0; i < n; i++) {
+        printf("  %12llu  %6llu 处  %s\n", (unsigned long long)a->hot[i].weight,
+               (unsigned long long)a->hot[i].sites, a->hot[i].name);
+    }
+    a->hot_count = 0;
+}
+
+/* 函数边界 */
+typedef struct {
+    uint64_t address;
+    const char *name;
+    size_t order;               // 符号表中的顺序，同一地址保留第一个
+} boundary_t;
+
+static int boundary_cmp(const void *x, const void *y) {
+    const boundary_t *a = x, *b = y;
+    if (a->address != b->address) {
+        return a->address < b->address ? -1 : 1;
+    }
+    return a->order < b->order ? -1 : (a->order > b->order);
+}
+
+/* 按符号把一段切分为函数；段起始处没有符号时以段名作为第一个函数 */
+static bool analyze_section(analysis_t *a, const arm64_elf_t *elf, size_t index,
+                            const char *name, uint64_t address, const uint8_t *bytes,
+                            size_t size, arm64_endian_t endian) {
+    size_t count = elf ? elf->symbol_count : 0;
+    boundary_t *b = malloc((count + 1) * sizeof(*b));
+    if (!b) {
+        return false;
+    }
+    size_t n = 0;
+    b[n++] = (boundary_t){ address, name, SIZE_MAX };
+    for (size_t i = 0; i < count; i++) {
+        const arm64_elf_symbol_t *sym = &elf->symbols[i];
+        if (sym->section == index && sym->address >= address &&
+            sym->address - address < size) {
+            b[n++] = (boundary_t){ sym->address, sym->name, i };
+        }
+    }
+    qsort(b, n, sizeof(*b), boundary_cmp);
+
+    /* 排序后同一地址的第一个是符号表中最靠前的符号（段名排在最后） */
+    size_t i = 0;
+    while (i < n) {
+        size_t next = i + 1;
+        while (next < n && b[next].address == b[i].address) {
+            next++;
+        }
+        uint64_t end = next < n ? b[next].address : address + size;
+        analyze_function(a, b[i].name, b[i].address, bytes + (b[i].address - address),
+                         (size_t)(end - b[i].address), endian);
+        i = next;
+    }
+    free(b);
+    return true;
+}
+
+static int analyze_elf(analysis_t *a, const char *path, const arm64_image_t *img,
+                       arm64_endian_t endian) {
+    arm64_elf_t elf;
+    arm64_elf_status_t st = arm64_elf_parse(&elf, img->data, img->size);
+    if (st != ARM64_ELF_OK) {
+        fprintf(stderr, "%s: %s%s\n", path, arm64_elf_strerror(st),
+                st == ARM64_ELF_NOT_ELF64 ? "（原始映像请使用 -b binary）" : "");
+        return 1;
+    }
+    /* AArch64 的指令总是小端存放（大端 ELF 只影响数据），除非用 -EB 指定 */
+    int status = 0;
+    for (size_t i = 0; i < elf.section_count; i++) {
+        const arm64_elf_section_t *sh = &elf.sections[i];
+        if (!(sh->flags & ARM64_ELF_SHF_EXECINSTR) || sh->size == 0) {
+            continue;
+        }
+        if (!sh->data) {
+            fprintf(stderr, "%s: 段 %s 超出文件范围\n", path, sh->name);
+            continue;
+        }
+        if (!analyze_section(a, &elf, i, sh->name, sh->address, sh->data,
+                             (size_t)sh->size, endian)) {
+            fprintf(stderr, "内存不足\n");
+            status = 1;
+            break;
+        }
+    }
+    arm64_elf_free(&elf);
+    return status;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "用法: %s [-r 规则[,规则...]] [-m 数量] [-p 剖析数据] [-t 数量] [-b binary]"
+            " [--adjust-vma=地址] [-EB|-EL] 文件...\n"
+            "  -r  只使用指定的规则（默认全部）\n"
+            "  -m  每个函数最多列出的位置数（默认20，0只输出计数）\n"
+            "  -p  剖析数据：每行 \"十六进制地址 [计数]\"，按执行计数加权（默认按循环深度）\n"
+            "  -t  每个文件之后列出的权重最高的函数数（默认10，0不列出）\n"
+            "  -b  输入格式，只支持 binary（原始指令映像，作为一个函数）\n"
+            "  --adjust-vma  原始映像第一个字节的地址（默认0）\n"
+            "  -EB/-EL  指令字节序（默认小端）\n"
+            "规则:\n", prog);
+    for (int r = 0; r < ARM64_PEEP_RULE_COUNT; r++) {
+        fprintf(stderr, "  %-16s %s\n", arm64_peephole_rule_name((arm64_peep_rule_t)r),
+                arm64_peephole_rule_desc((arm64_peep_rule_t)r));
+    }
+}
+
+/* 解析逗号分隔的规则列表 */
+static bool parse_rules(const char *list, uint32_t *mask) {
+    char name[32];
+    *mask = 0;
+    while (*list) {
+        size_t len = strcspn(list, ",");
+        if (len == 0 || len >= sizeof(name)) {
+            return false;
+        }
+        memcpy(name, list, len);
+        name[len] = '\0';
+        arm64_peep_rule_t r = arm64_peephole_rule_find(name);
+        if (r == ARM64_PEEP_RULE_COUNT) {
+            return false;
+        }
+        *mask |= 1u << r;
+        list += len + (list[len] == ',');
+    }
+    return *mask != 0;
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t rules = ARM64_PEEP_ALL;
+    size_t max_sites = 20;
+    size_t top = 10;
+    const char *profile_path = NULL;
+    arm64_image_options_t input;
+    arm64_image_options_init(&input);
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        int used;
+        if (strcmp(arg, "-r") == 0 && has_value) {
+            if (!parse_rules(argv[++i], &rules)) {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (strcmp(arg, "-m") == 0 && has_value) {
+            max_sites = (size_t)strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-p") == 0 && has_value) {
+            profile_path = argv[++i];
+        } else if (strcmp(arg, "-t") == 0 && has_value) {
+            top = (size_t)strtoull(argv[++i], NULL, 0);
+        } else if ((used = arm64_image_option(&input, argc, argv, i)) > 0) {
+            i += used - 1;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (i >= argc) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    profile_t profile = { NULL, 0 };
+    if (profile_path && !profile_load(&profile, profile_path)) {
+        perror(profile_path);
+        return 1;
+    }
+
+    analysis_t a;
+    memset(&a, 0, sizeof(a));
+    arm64_peephole_init(&a.peep, rules, on_site, &a);
+    a.max_sites = max_sites;
+    a.profile = profile_path ? &profile : NULL;
+
+    int status = 0;
+    for (; i < argc; i++) {
+        arm64_image_t img;
+        if (!arm64_image_open(&img, argv[i])) {
+            perror(argv[i]);
+            status = 1;
+            continue;
+        }
+        printf("%s:\n", argv[i]);
+        int rc = 0;
+        if (input.binary) {
+            analyze_function(&a, ".data", input.vma, img.data, img.size, input.endian);
+        } else {
+            rc = analyze_elf(&a, argv[i], &img, input.endian);
+        }
+        if (rc != 0) {
+            status = rc;
+        }
+        print_hot(&a, top);
+        arm64_image_close(&img);
+    }
+    if (a.failed) {
+        fprintf(stderr, "内存不足，部分发现未记录\n");
+        status = 1;
+    }
+
+    printf("\n合计: %llu 条指令, %llu 个函数, %llu 个函数有发现\n",
+           (unsigned long long)a.peep.insts, (unsigned long long)a.scanned,
+           (unsigned long long)a.functions);
+    for (int r = 0; r < ARM64_PEEP_RULE_COUNT; r++) {
+        if (rules & (1u << r)) {
+            printf("  %-16s %10llu  权重 %12llu  %s\n",
+                   arm64_peephole_rule_name((arm64_peep_rule_t)r),
+                   (unsigned long long)a.peep.counts[r], (unsigned long long)a.weights[r],
+                   arm64_peephole_rule_desc((arm64_peep_rule_t)r));
+        }
+    }
+    free(a.sites);
+    free(a.edges.edges);
+    free(a.edges.leaders);
+    free(a.hot);
+    free(profile.samples);
+    return status;
+}
@@ -0,0 +1,327 @@
+/**
+ * ARM64反汇编器 - 代码重定位
+ * 将指令序列搬移到新地址（跳板、插桩），重写PC相对指令；
+ * 超出原编码范围时展开为等价的指令序列
+ */
+
+#include "arm64_disasm.h"
+#include "arm64_strbuf.h"
+
+/* 展开序列使用的临时寄存器：IP0（过程调用间临时寄存器，链接器veneer同样使用） */
+#define RELOC_SCRATCH_REG   16
+
+/* ========== 指令字构造 ========== */
+
+static inline bool branch_in_range(int64_t offset, unsigned bits) {
+    int64_t limit = (int64_t)1 << (bits + 1);   /* imm 以4字节为单位 */
+    return (offset & 3) == 0 && offset >= -limit && offset < limit;
+}
+
+static inline int64_t page_delta(uint64_t pc, uint64_t target) {
+    return (int64_t)((target >> 12) - (pc >> 12));
+}
+
+static inline bool page_in_range(uint64_t pc, uint64_t target) {
+    int64_t pages = page_delta(pc, target);
+    return pages >= -(1LL << 20) && pages < (1LL << 20);
+}
+
+static inline uint32_t a64_b(int64_t offset) {
+    return 0x14000000 | ((uint32_t)(offset >> 2) & 0x03FFFFFF);
+}
+
+static inline uint32_t a64_branch_reg(uint8_t rn, bool link) {
+    return (link ? 0xD63F0000 : 0xD61F0000) | ((uint32_t)rn << 5);
+}
+
+static inline uint32_t a64_adr(uint8_t rd, int64_t offset) {
+    uint32_t imm21 = (uint32_t)offset & 0x1FFFFF;
+    return 0x10000000 | ((imm21 & 3) << 29) | ((imm21 >> 2) << 5) | rd;
+}
+
+static inline uint32_t a64_adrp(uint8_t rd, uint64_t pc, uint64_t target) {
+    return a64_adr(rd, page_delta(pc, target)) | 0x80000000;
+}
+
+static inline uint32_t a64_add_imm(uint8_t rd, uint8_t rn, uint32_t imm12) {
+    return 0x91000000 | (imm12 << 10) | ((uint32_t)rn << 5) | rd;
+}
+
+static inline uint32_t a64_nop(void) {
+    return 0xD503201F;
+}
+
+static inline uint32_t a64_ldr_literal_x(uint8_t rt, int64_t offset) {
+    return 0x58000000 | (((uint32_t)(offset >> 2) & 0x7FFFF) << 5) | rt;
+}
+
+/**
+ * 写入64位字面量（小端，两个指令字）
+ */
+static inline void emit_quad(uint32_t *w, uint64_t value) {
+    w[0] = (uint32_t)value;
+    w[1] = (uint32_t)(value >> 32);
+}
+
+/* ========== 展开序列 ========== */
+
+/**
+ * 无条件跳转到 target
+ * B/BL（±128MB）→ ADRP+ADD+BR/BLR（±4GB）→ LDR字面量+BR/BLR（任意地址）
+ * @return 写入的指令字数量
+ */
+static size_t emit_jump(uint32_t *w, uint64_t pc, uint64_t target, bool link) {
+    int64_t offset = (int64_t)(target - pc);
+
+    if (branch_in_range(offset, 26)) {
+        w[0] = a64_b(offset) | (link ? 0x80000000 : 0);
+        return 1;
+    }
+    if (page_in_range(pc, target)) {
+        w[0] = a64_adrp(RELOC_SCRATCH_REG, pc, target);
+        w[1] = a64_add_imm(RELOC_SCRATCH_REG, RELOC_SCRATCH_REG, (uint32_t)(target & 0xFFF));
+        w[2] = a64_branch_reg(RELOC_SCRATCH_REG, link);
+        return 3;
+    }
+    if (!link) {
+        /* ldr x16, #8; br x16; .quad target */
+        w[0] = a64_ldr_literal_x(RELOC_SCRATCH_REG, 8);
+        w[1] = a64_branch_reg(RELOC_SCRATCH_REG, false);
+        emit_quad(&w[2], target);
+        return 4;
+    }
+    /* ldr x16, #12; blr x16; b #12（返回后跳过字面量）; .quad target */
+    w[0] = a64_ldr_literal_x(RELOC_SCRATCH_REG, 12);
+    w[1] = a64_branch_reg(RELOC_SCRATCH_REG, true);
+    w[2] = a64_b(12);
+    emit_quad(&w[3], target);
+    return 5;
+}
+
+/**
+ * 重新编码修改了PC相对偏移的指令
+ */
+static bool reencode(const disasm_inst_t *inst, int64_t imm, uint32_t *word) {
+    disasm_inst_t patched = *inst;
+    patched.imm = imm;
+    return encode_arm64(&patched, word);
+}
+
+/**
+ * 条件分支 B.cond/CBZ/CBNZ/TBZ/TBNZ
+ * 超出范围时展开为：反条件分支跳过 + 无条件跳转
+ */
+static size_t relocate_cond_branch(const disasm_inst_t *inst, uint64_t target, uint64_t pc,
+                                   uint32_t *w) {
+    /* b.al/b.nv 实际为无条件分支 */
+    if (inst->type == INST_TYPE_BCOND && inst->cond >= 0xE) {
+        return emit_jump(w, pc, target, false);
+    }
+
+    int64_t offset = (int64_t)(target - pc);
+    unsigned bits = (inst->type == INST_TYPE_TBZ || inst->type == INST_TYPE_TBNZ) ? 14 : 19;
+    if (branch_in_range(offset, bits)) {
+        return reencode(inst, offset, &w[0]) ? 1 : 0;
+    }
+
+    size_t n = emit_jump(&w[1], pc + 4, target, false);
+    if (!reencode(inst, (int64_t)(n + 1) * 4, &w[0])) {
+        return 0;
+    }
+    /* 取反条件：B.cond 翻转 cond[0]，CBZ/CBNZ、TBZ/TBNZ 翻转 op（bit 24） */
+    w[0] ^= (inst->type == INST_TYPE_BCOND) ? 1u : (1u << 24);
+    return n + 1;
+}
+
+/**
+ * ADR/ADRP：超出范围时改用 ADRP+ADD 或从字面量加载绝对地址
+ */
+static size_t relocate_pc_rel_addr(const disasm_inst_t *inst, uint64_t target, uint64_t pc,
+                                   uint32_t *w) {
+    uint8_t rd = inst->rd;
+
+    if (inst->type == INST_TYPE_ADR) {
+        int64_t offset = (int64_t)(target - pc);
+        if (offset >= -(1LL << 20) && offset < (1LL << 20)) {
+            return reencode(inst, offset, &w[0]) ? 1 : 0;
+        }
+        if (page_in_range(pc, target)) {
+            w[0] = a64_adrp(rd, pc, target);
+            w[1] = a64_add_imm(rd, rd, (uint32_t)(target & 0xFFF));
+            return 2;
+        }
+    } else if (page_in_range(pc, target)) {
+        return reencode(inst, page_delta(pc, target) * 4096, &w[0]) ? 1 : 0;
+    }
+
+    /* ldr xd, #8; b #12; .quad target */
+    w[0] = a64_ldr_literal_x(rd, 8);
+    w[1] = a64_b(12);
+    emit_quad(&w[2], target);
+    return 4;
+}
+
+/**
+ * LDR (literal) 转换为基址寄存器形式时使用的无符号偏移指令模板
+ * @param scale 输出访问大小的log2
+ */
+static uint32_t literal_to_uimm_template(const disasm_inst_t *inst, unsigned *scale) {
+    switch (inst->rd_type) {
+        case REG_TYPE_W: *scale = 2; return 0xB9400000;
+        case REG_TYPE_X:
+            if (inst->type == INST_TYPE_LDRSW) {
+                *scale = 2;
+                return 0xB9800000;
+            }
+            *scale = 3;
+            return 0xF9400000;
+        case REG_TYPE_S: *scale = 2; return 0xBD400000;
+        case REG_TYPE_D: *scale = 3; return 0xFD400000;
+        case REG_TYPE_Q: *scale = 4; return 0x3DC00000;
+        default: return 0;
+    }
+}
+
+/**
+ * LDR/LDRSW/PRFM (literal)
+ * 超出±1MB时改用 ADRP+LDR（±4GB）或从字面量加载绝对地址后再加载；
+ * 通用寄存器加载用目标寄存器保存地址，SIMD加载和 Rt=31 时使用 x16。
+ * PRFM 只是提示，超出范围时替换为 NOP
+ */
+static size_t relocate_load_literal(const disasm_inst_t *inst, uint64_t target, uint64_t pc,
+                                    uint32_t *w) {
+    int64_t offset = (int64_t)(target - pc);
+    if (branch_in_range(offset, 19)) {
+        return reencode(inst, offset, &w[0]) ? 1 : 0;
+    }
+    if (inst->type == INST_TYPE_PRFM) {
+        w[0] = a64_nop();
+        return 1;
+    }
+
+    unsigned scale = 0;
+    uint32_t load = literal_to_uimm_template(inst, &scale);
+    if (!load) {
+        return 0;
+    }
+
+    bool gpr = (inst->rd_type == REG_TYPE_W || inst->rd_type == REG_TYPE_X);
+    uint8_t base = (gpr && inst->rd != 31) ? inst->rd : RELOC_SCRATCH_REG;
+    load |= ((uint32_t)base << 5) | inst->rd;
+
+    if (page_in_range(pc, target)) {
+        uint32_t lo12 = (uint32_t)(target & 0xFFF);
+        w[0] = a64_adrp(base, pc, target);
+        if ((lo12 & ((1u << scale) - 1)) == 0) {
+            w[1] = load | ((lo12 >> scale) << 10);
+            return 2;
+        }
+        w[1] = a64_add_imm(base, base, lo12);
+        w[2] = load;
+        return 3;
+    }
+
+    /* ldr xa, #12; ldr rt, [xa]; b #12; .quad target */
+    w[0] = a64_ldr_literal_x(base, 12);
+    w[1] = load;
+    w[2] = a64_b(12);
+    emit_quad(&w[3], target);
+    return 5;
+}
+
+/* ========== 公共接口 ========== */
+
+/**
+ * 快速判断指令字是否为PC相对指令（不完整解码）
+ */
+bool arm64_is_pc_relative(uint32_t raw) {
+    return (raw & 0x7C000000) == 0x14000000 ||     /* B/BL */
+           (raw & 0xFF000010) == 0x54000000 ||     /* B.cond */
+           (raw & 0x7C000000) == 0x34000000 ||     /* CBZ/CBNZ/TBZ/TBNZ */
+           (raw & 0x1F000000) == 0x10000000 ||     /* ADR/ADRP */
+           (raw & 0x3B000000) == 0x18000000;       /* LDR/PRFM (literal) */
+}
+
+/**
+ * 将单条指令从 old_pc 重定位到 new_pc
+ */
+size_t arm64_relocate_inst(uint32_t raw, uint64_t old_pc, uint64_t new_pc, uint32_t *out) {
+    uint32_t w[ARM64_RELOC_MAX_WORDS];
+    size_t n = 0;
+    disasm_inst_t inst;
+    uint64_t target;
+
+    if (!arm64_is_pc_relative(raw) || !disassemble_arm64(raw, old_pc, &inst)) {
+        /* 与位置无关的指令原样复制 */
+        w[n++] = raw;
+    } else if (inst.addr_mode == ADDR_MODE_LITERAL) {
+        n = relocate_load_literal(&inst, old_pc + inst.imm, new_pc, w);
+    } else if (!get_branch_target(&inst, &target)) {
+        w[n++] = raw;
+    } else {
+        switch (inst.type) {
+            case INST_TYPE_B:
+            case INST_TYPE_BL:
+                n = emit_jump(w, new_pc, target, inst.type == INST_TYPE_BL);
+                break;
+            case INST_TYPE_ADR:
+            case INST_TYPE_ADRP:
+                n = relocate_pc_rel_addr(&inst, target, new_pc, w);
+                break;
+            default:
+                n = relocate_cond_branch(&inst, target, new_pc, w);
+                break;
+        }
+    }
+
+    if (n && out) {
+        ARM64_MEMCPY(out, w, n * sizeof(uint32_t));
+    }
+    return n;
+}
+
+/**
+ * 重定位一段连续指令
+ */
+arm64_reloc_status_t arm64_relocate_block(const uint32_t *code, size_t count,
+                                          uint64_t old_addr, uint64_t new_addr,
+                                          uint32_t *out, size_t capacity, size_t *out_count) {
+    size_t used = 0;
+    arm64_reloc_status_t status = ARM64_RELOC_OK;
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t w[ARM64_RELOC_MAX_WORDS];
+        size_t n = arm64_relocate_inst(code[i], old_addr + i * 4, new_addr + used * 4, w);
+
+        if (n == 0) {
+            status = ARM64_RELOC_FAILED;
+            break;
+        }
+        if (used + n > capacity) {
+            status = ARM64_RELOC_NO_SPACE;
+            break;
+        }
+        ARM64_MEMCPY(&out[used], w, n * sizeof(uint32_t));
+        used += n;
+    }
+
+    if (out_count) {
+        *out_count = used;
+    }
+    return status;
+}
+
+/**
+ * 批量重定位独立的指令位置
+ */
+size_t arm64_relocate_sites(arm64_reloc_site_t *sites, size_t count) {
+    size_t total = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        arm64_reloc_site_t *site = &sites[i];
+        site->size = (uint8_t)arm64_relocate_inst(site->raw, site->old_pc, site->new_pc,
+                                                  site->words);
+        total += site->size;
+    }
+    return total;
+}
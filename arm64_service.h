@@ -0,0 +1,208 @@
+/**
+ * ARM64反汇编器 - 本地反汇编服务（Linux）
+ * 守护进程 arm64_disasmd 监听 Unix 域套接字，按映像内容哈希缓存解码结果；
+ * 每个映像对应一个按整个映像布局的稀疏 memfd，只按块解码请求覆盖的范围；
+ * memfd 已密封（客户端只能只读映射），随应答通过 SCM_RIGHTS 传给客户端，客户端映射后零复制读取
+ *
+ * 协议：SOCK_SEQPACKET，每个请求/应答是一条消息
+ *   请求 arm64_svc_request_t → 应答 arm64_svc_response_t（DECODE 附带 memfd，STATS 附带 arm64_svc_stats_t）
+ *   DECODE 请求通过 SCM_RIGHTS 附带客户端以自己的权限打开的映像描述符，守护进程不按路径打开文件，
+ *   不会替客户端读取它本来无权读取的文件；只接受与守护进程同一用户（或 root）的连接
+ */
+
+#ifndef ARM64_SERVICE_H
+#define ARM64_SERVICE_H
+
+#include "arm64_disasm.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARM64_SVC_MAGIC         0x41364453u     // "SD6A"
+#define ARM64_SVC_VERSION       2
+#define ARM64_SVC_PATH_MAX      4096
+
+/* 默认套接字文件名（所在目录见 arm64_svc_default_socket）和资源限制 */
+#define ARM64_SVC_SOCKET_NAME           "arm64_disasmd.sock"
+#define ARM64_SVC_DEFAULT_BUDGET        (256u << 20)    // 缓存内存预算（已解码块的字节数）
+#define ARM64_SVC_DEFAULT_MAX_CLIENTS   32              // 同时连接的客户端
+#define ARM64_SVC_DEFAULT_MAX_DECODES   4               // 同时进行解码的请求
+
+/* 文本输出的每行宽度（NUL 填充，行定长便于按下标访问） */
+#define ARM64_SVC_TEXT_WIDTH    64
+
+/* 请求类型 */
+typedef enum {
+    ARM64_SVC_OP_DECODE = 1,    // 解码映像的一段
+    ARM64_SVC_OP_STATS = 2      // 延迟/吞吐量自报告
+} arm64_svc_op_t;
+
+/* 输出种类 */
+typedef enum {
+    ARM64_SVC_KIND_INST = 1,    // disasm_inst_t 数组，可直接传给 C 接口
+    ARM64_SVC_KIND_TEXT = 2     // 每条指令 ARM64_SVC_TEXT_WIDTH 字节的 format_instruction 文本
+} arm64_svc_kind_t;
+
+/* 应答状态 */
+typedef enum {
+    ARM64_SVC_OK = 0,
+    ARM64_SVC_BUSY,             // 超过并发连接上限
+    ARM64_SVC_BAD_REQUEST,      // 请求格式、版本或参数错误
+    ARM64_SVC_IO_ERROR,         // 映像无法打开/映射，或套接字错误
+    ARM64_SVC_NO_MEMORY,        // memfd 或内存分配失败
+    ARM64_SVC_RANGE,            // 偏移量超出映像或未按4字节对齐
+    ARM64_SVC_DENIED            // 连接方不是同一用户，或映像描述符不可读（如 O_PATH）
+} arm64_svc_status_t;
+
+/* 请求 */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t op;                // arm64_svc_op_t
+    uint32_t kind;              // arm64_svc_kind_t
+    uint32_t endian;            // arm64_endian_t
+    uint64_t offset;            // 映像内的字节偏移（4字节对齐）
+    uint64_t length;            // 字节数，0 表示到映像末尾
+    uint64_t address;           // offset 处指令的虚拟地址
+    char path[ARM64_SVC_PATH_MAX];  // 客户端打开的映像路径（服务端只使用随请求传来的描述符）
+} arm64_svc_request_t;
+
+/* 应答 */
+typedef struct {
+    uint32_t magic;
+    uint32_t status;            // arm64_svc_status_t
+    uint32_t kind;
+    uint32_t item_size;         // 每条指令的字节数
+    uint64_t count;             // 指令数量
+    uint64_t data_offset;       // 所请求范围在 memfd 中的字节偏移
+    uint64_t data_size;         // 所请求范围的字节数
+    uint64_t image_hash;        // 映像内容哈希
+    uint8_t cache_hit;          // 所请求范围是否已全部缓存（本请求没有解码）
+} arm64_svc_response_t;
+
+/* 自报告统计 */
+typedef struct {
+    uint64_t uptime_ns;
+    uint64_t requests;          // 全部请求（含 STATS）
+    uint64_t cache_hits;        // 请求的范围已全部解码
+    uint64_t cache_misses;      // 请求的范围中有需要解码的块
+    uint64_t evictions;         // 因内存预算被淘汰的条目
+    uint64_t rejected;          // 因并发上限或连接方身份被拒绝的连接
+    uint64_t errors;
+    uint64_t cached_entries;
+    uint64_t cached_bytes;
+    uint64_t cache_budget;
+    uint64_t active_clients;
+    uint64_t active_decodes;
+    uint64_t instructions_decoded;  // 按需解码的指令总数
+    uint64_t decode_ns;             // 解码耗时总计（吞吐量 = instructions_decoded / decode_ns）
+    uint64_t latency_avg_ns;        // DECODE 请求从收到到应答发出的延迟
+    uint64_t latency_p50_ns;        // 百分位按2的幂分桶估计（桶上界）
+    uint64_t latency_p99_ns;
+    uint64_t latency_max_ns;
+} arm64_svc_stats_t;
+
+/* ========== 客户端 ========== */
+
+/* 解码结果：memfd 的只读映射 */
+typedef struct {
+    const void *data;           // 所请求范围的起点
+    size_t size;                // 字节数
+    size_t count;               // 指令数量
+    uint32_t kind;
+    uint32_t item_size;
+    bool cache_hit;
+    void *map;                  // 内部：映射起点（按页对齐）
+    size_t map_size;
+} arm64_svc_result_t;
+
+/**
+ * 默认套接字路径：$XDG_RUNTIME_DIR/arm64_disasmd.sock，
+ * 未设置时为 /tmp/arm64_disasmd-<uid>/arm64_disasmd.sock（目录由服务端以 0700 创建）
+ */
+const char *arm64_svc_default_socket(void);
+
+/**
+ * 连接守护进程
+ * @return 套接字描述符，失败返回-1
+ */
+int arm64_svc_connect(const char *socket_path);
+
+/**
+ * 初始化解码请求
+ */
+void arm64_svc_request_init(arm64_svc_request_t *req, const char *path, arm64_svc_kind_t kind);
+
+/**
+ * 以本进程的权限打开 req->path，随请求发送其描述符并映射结果；成功后用 arm64_svc_release 释放
+ * 映像无法打开时不发送请求，返回 ARM64_SVC_IO_ERROR
+ */
+arm64_svc_status_t arm64_svc_decode(int fd, const arm64_svc_request_t *req,
+                                    arm64_svc_result_t *result);
+
+/**
+ * 解除结果映射（守护进程淘汰缓存不影响已映射的结果）
+ */
+void arm64_svc_release(arm64_svc_result_t *result);
+
+/**
+ * 查询守护进程的统计信息
+ */
+arm64_svc_status_t arm64_svc_query_stats(int fd, arm64_svc_stats_t *stats);
+
+/**
+ * 状态码的名称
+ */
+const char *arm64_svc_status_name(arm64_svc_status_t status);
+
+/* ========== 服务端 ========== */
+
+typedef struct {
+    const char *socket_path;
+    size_t cache_budget;        // 缓存内存预算（字节）
+    unsigned max_clients;       // 同时连接的客户端上限
+    unsigned max_decodes;       // 同时解码的请求上限
+} arm64_svc_config_t;
+
+typedef struct arm64_svc_server arm64_svc_server_t;
+
+/**
+ * 以默认值初始化配置
+ */
+void arm64_svc_config_init(arm64_svc_config_t *config);
+
+/**
+ * 创建套接字并开始监听
+ * 套接字权限为 0600；所在目录不存在时以 0700 创建，目录属于其他用户（root 除外）
+ * 或可被他人写入且没有粘滞位时失败；已存在的同名套接字被替换，同名的其他文件不删除（失败）
+ * @return 服务端对象，失败返回 NULL（errno 指明原因）
+ */
+arm64_svc_server_t *arm64_svc_server_create(const arm64_svc_config_t *config);
+
+/**
+ * 接受连接直到 arm64_svc_server_stop，返回前等待所有连接结束
+ * 每个连接一个线程，连接内的请求按顺序处理
+ */
+void arm64_svc_server_run(arm64_svc_server_t *server);
+
+/**
+ * 请求停止（可在信号处理函数或其他线程中调用）
+ */
+void arm64_svc_server_stop(arm64_svc_server_t *server);
+
+/**
+ * 关闭套接字、删除套接字文件并释放缓存
+ */
+void arm64_svc_server_destroy(arm64_svc_server_t *server);
+
+/**
+ * 读取统计信息（与 STATS 请求的结果相同）
+ */
+void arm64_svc_server_stats(arm64_svc_server_t *server, arm64_svc_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_SERVICE_H */
@@ -0,0 +1,228 @@
+/**
+ * ARM64反汇编器 - 本地反汇编服务客户端
+ */
+
+#define _GNU_SOURCE
+#include "arm64_service.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+const char *arm64_svc_status_name(arm64_svc_status_t status) {
+    switch (status) {
+        case ARM64_SVC_OK:          return "ok";
+        case ARM64_SVC_BUSY:        return "busy";
+        case ARM64_SVC_BAD_REQUEST: return "bad request";
+        case ARM64_SVC_IO_ERROR:    return "i/o error";
+        case ARM64_SVC_NO_MEMORY:   return "no memory";
+        case ARM64_SVC_RANGE:       return "range";
+        case ARM64_SVC_DENIED:      return "denied";
+        default:                    return "unknown";
+    }
+}
+
+static char default_socket[sizeof(((struct sockaddr_un *)0)->sun_path)];
+static pthread_once_t default_socket_once = PTHREAD_ONCE_INIT;
+
+static void init_default_socket(void) {
+    /* XDG_RUNTIME_DIR 只属于当前用户（0700）；没有时使用按 uid 区分的私有目录，不直接放在 /tmp */
+    const char *dir = getenv("XDG_RUNTIME_DIR");
+    if (dir && dir[0] == '/' &&
+        strlen(dir) + 1 + strlen(ARM64_SVC_SOCKET_NAME) < sizeof(default_socket)) {
+        snprintf(default_socket, sizeof(default_socket), "%s/%s", dir, ARM64_SVC_SOCKET_NAME);
+    } else {
+        snprintf(default_socket, sizeof(default_socket), "/tmp/arm64_disasmd-%u/%s",
+                 (unsigned)geteuid(), ARM64_SVC_SOCKET_NAME);
+    }
+}
+
+const char *arm64_svc_default_socket(void) {
+    pthread_once(&default_socket_once, init_default_socket);
+    return default_socket;
+}
+
+int arm64_svc_connect(const char *socket_path) {
+    struct sockaddr_un addr;
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        return -1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socket_path);
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void arm64_svc_request_init(arm64_svc_request_t *req, const char *path, arm64_svc_kind_t kind) {
+    memset(req, 0, sizeof(*req));
+    req->magic = ARM64_SVC_MAGIC;
+    req->version = ARM64_SVC_VERSION;
+    req->op = ARM64_SVC_OP_DECODE;
+    req->kind = kind;
+    req->endian = ARM64_ENDIAN_LITTLE;
+    if (path) {
+        strncpy(req->path, path, sizeof(req->path) - 1);
+    }
+}
+
+/**
+ * 接收一条应答消息，可附带一个文件描述符和额外数据
+ * @param payload 应答头之后的数据（可为 NULL）
+ * @param memfd 输出：随消息传来的描述符，没有时为-1
+ */
+static arm64_svc_status_t recv_response(int fd, arm64_svc_response_t *resp,
+                                        void *payload, size_t payload_size, int *memfd) {
+    char control[CMSG_SPACE(sizeof(int))];
+    struct iovec iov[2] = {
+        { resp, sizeof(*resp) },
+        { payload, payload_size },
+    };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = payload ? 2 : 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    *memfd = -1;
+    /* 服务端拒绝连接时若请求尚未读出就关闭套接字，本端先收到一次 ECONNRESET，
+       之前发出的 BUSY 回复仍在接收队列中，再读一次即可取到 */
+    ssize_t n;
+    bool reset = false;
+    for (;;) {
+        n = recvmsg(fd, &msg, MSG_CMSG_CLOEXEC);
+        if (n >= 0 || (errno != EINTR && (errno != ECONNRESET || reset))) {
+            break;
+        }
+        reset = reset || errno == ECONNRESET;
+    }
+
+    for (struct cmsghdr *c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c)) {
+        if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_RIGHTS) {
+            memcpy(memfd, CMSG_DATA(c), sizeof(int));
+        }
+    }
+
+    if (n < (ssize_t)sizeof(*resp) || resp->magic != ARM64_SVC_MAGIC) {
+        return ARM64_SVC_IO_ERROR;
+    }
+    return (arm64_svc_status_t)resp->status;
+}
+
+/* 发送一条请求；image_fd 非负时通过 SCM_RIGHTS 附带映像描述符 */
+static bool send_request(int fd, const arm64_svc_request_t *req, int image_fd) {
+    char control[CMSG_SPACE(sizeof(int))];
+    struct iovec iov = { (void *)req, sizeof(*req) };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    if (image_fd >= 0) {
+        memset(control, 0, sizeof(control));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+        c->cmsg_level = SOL_SOCKET;
+        c->cmsg_type = SCM_RIGHTS;
+        c->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(c), &image_fd, sizeof(int));
+    }
+
+    ssize_t n;
+    do {
+        n = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    } while (n < 0 && errno == EINTR);
+    return n == (ssize_t)sizeof(*req);
+}
+
+arm64_svc_status_t arm64_svc_decode(int fd, const arm64_svc_request_t *req,
+                                    arm64_svc_result_t *result) {
+    arm64_svc_response_t resp;
+    int memfd;
+
+    memset(result, 0, sizeof(*result));
+    /* 映像由客户端以自己的权限打开，服务端只读取传过去的描述符 */
+    if (memchr(req->path, '\0', sizeof(req->path)) == NULL) {
+        return ARM64_SVC_BAD_REQUEST;
+    }
+    int image_fd = open(req->path, O_RDONLY | O_CLOEXEC);
+    if (image_fd < 0) {
+        return ARM64_SVC_IO_ERROR;
+    }
+    /* 发送失败时服务端可能已回复 BUSY 并关闭连接，应答仍在接收队列中 */
+    bool sent = send_request(fd, req, image_fd);
+    close(image_fd);
+    arm64_svc_status_t status = recv_response(fd, &resp, NULL, 0, &memfd);
+    if (!sent && status == ARM64_SVC_OK) {
+        status = ARM64_SVC_IO_ERROR;
+    }
+    if (status != ARM64_SVC_OK || resp.count == 0) {
+        if (memfd >= 0) {
+            close(memfd);
+        }
+        return status;
+    }
+    if (memfd < 0) {
+        return ARM64_SVC_IO_ERROR;
+    }
+
+    /* mmap 的偏移量必须按页对齐 */
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t map_offset = resp.data_offset & ~(uint64_t)(page - 1);
+    size_t map_size = resp.data_offset + resp.data_size - map_offset;
+    void *map = mmap(NULL, map_size, PROT_READ, MAP_SHARED, memfd, (off_t)map_offset);
+    close(memfd);
+    if (map == MAP_FAILED) {
+        return ARM64_SVC_NO_MEMORY;
+    }
+
+    result->map = map;
+    result->map_size = map_size;
+    result->data = (const uint8_t *)map + (resp.data_offset - map_offset);
+    result->size = resp.data_size;
+    result->count = resp.count;
+    result->kind = resp.kind;
+    result->item_size = resp.item_size;
+    result->cache_hit = resp.cache_hit != 0;
+    return ARM64_SVC_OK;
+}
+
+void arm64_svc_release(arm64_svc_result_t *result) {
+    if (result->map) {
+        munmap(result->map, result->map_size);
+    }
+    memset(result, 0, sizeof(*result));
+}
+
+arm64_svc_status_t arm64_svc_query_stats(int fd, arm64_svc_stats_t *stats) {
+    arm64_svc_request_t req;
+    arm64_svc_response_t resp;
+    int memfd;
+
+    arm64_svc_request_init(&req, NULL, ARM64_SVC_KIND_INST);
+    req.op = ARM64_SVC_OP_STATS;
+    memset(stats, 0, sizeof(*stats));
+    bool sent = send_request(fd, &req, -1);
+    arm64_svc_status_t status = recv_response(fd, &resp, stats, sizeof(*stats), &memfd);
+    if (memfd >= 0) {
+        close(memfd);
+    }
+    return !sent && status == ARM64_SVC_OK ? ARM64_SVC_IO_ERROR : status;
+}
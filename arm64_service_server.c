@@ -0,0 +1,1013 @@
+/**
+ * ARM64反汇编器 - 本地反汇编服务端
+ * 缓存条目以（映像内容哈希, 输出种类, 字节序, 映像基址）为键，对应一个按整个映像布局的稀疏 memfd；
+ * 解码按块（CHUNK_WORDS 条指令）按需进行，只解码请求范围覆盖的块，内存预算只计已解码的块。
+ * 同一块的并发请求只解码一次，其余请求等待结果。条目按 LRU 顺序在超出内存预算时淘汰，
+ * 淘汰只关闭服务端的 memfd，客户端已收到的描述符和映射不受影响
+ * 映像只通过客户端传来的描述符读取，服务端不按请求中的路径打开文件
+ */
+
+#define _GNU_SOURCE
+#include "arm64_service.h"
+#include "arm64_alloc.h"
+#include "arm64_timeline.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+/* 每批转换的指令字数量（栈上缓冲区） */
+#define BATCH_WORDS 64
+
+/* 按需解码的块大小（指令数）：一次小范围请求最多多解码一块 */
+#define CHUNK_WORDS 1024
+
+/* 延迟直方图：第 i 桶统计 [2^i, 2^(i+1)) 纳秒 */
+#define LATENCY_BUCKETS 64
+
+/* ========== 缓存条目 ========== */
+
+typedef enum {
+    ENTRY_PENDING,      // 正在创建 memfd
+    ENTRY_READY,
+    ENTRY_FAILED
+} entry_state_t;
+
+/* 块状态 */
+enum {
+    CHUNK_EMPTY,
+    CHUNK_DECODING,     // 已由某个请求认领，正在解码
+    CHUNK_READY
+};
+
+typedef struct cache_entry {
+    struct cache_entry *prev;   // LRU 链表，表头为最近使用
+    struct cache_entry *next;
+    bool linked;
+
+    /* 键 */
+    uint64_t hash;
+    uint32_t kind;
+    uint32_t endian;
+    uint64_t base;
+
+    /* 映像文件标识：标识相同时不重新计算内容哈希 */
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    struct timespec mtime;
+
+    entry_state_t state;
+    arm64_svc_status_t error;
+    unsigned refs;              // 正在使用（发送或等待）的请求数
+    int memfd;
+    uint8_t *map;               // memfd 的可写映射（密封前建立，只有服务端可写）
+    size_t map_size;
+    uint8_t *chunks;            // 每块的状态
+    size_t chunk_count;
+    uint64_t count;
+    size_t bytes;               // 已解码块占用的字节数（计入预算）
+} cache_entry_t;
+
+/* 客户端连接 */
+typedef struct conn {
+    struct conn *next;
+    arm64_svc_server_t *server;
+    int fd;
+} conn_t;
+
+struct arm64_svc_server {
+    const arm64_allocator_t *allocator;     // 服务端、连接、缓存条目的分配器
+    arm64_svc_config_t config;
+    char socket_path[sizeof(((struct sockaddr_un *)0)->sun_path)];
+    int listen_fd;
+    uid_t uid;                  // 允许连接的用户（服务端的有效用户，另外总是允许 root）
+    atomic_bool stopping;
+    struct timespec start;
+
+    pthread_mutex_t lock;       // 保护以下全部字段
+    pthread_cond_t cond;        // 条目状态、解码槽位、连接数变化
+    cache_entry_t *lru_head;
+    cache_entry_t *lru_tail;
+    size_t cached_bytes;
+    size_t cached_entries;
+    conn_t *conns;
+    unsigned active_clients;
+    unsigned active_decodes;
+
+    arm64_svc_stats_t stats;
+    uint64_t latency_hist[LATENCY_BUCKETS];
+    uint64_t latency_count;
+    uint64_t latency_total;
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static size_t item_size(uint32_t kind) {
+    return kind == ARM64_SVC_KIND_TEXT ? ARM64_SVC_TEXT_WIDTH : sizeof(disasm_inst_t);
+}
+
+/* ========== LRU 链表（持有 lock） ========== */
+
+static void lru_unlink(arm64_svc_server_t *s, cache_entry_t *e) {
+    if (!e->linked) {
+        return;
+    }
+    if (e->prev) {
+        e->prev->next = e->next;
+    } else {
+        s->lru_head = e->next;
+    }
+    if (e->next) {
+        e->next->prev = e->prev;
+    } else {
+        s->lru_tail = e->prev;
+    }
+    e->prev = e->next = NULL;
+    e->linked = false;
+    s->cached_bytes -= e->bytes;
+    s->cached_entries--;
+}
+
+static void lru_push_front(arm64_svc_server_t *s, cache_entry_t *e) {
+    e->prev = NULL;
+    e->next = s->lru_head;
+    if (s->lru_head) {
+        s->lru_head->prev = e;
+    } else {
+        s->lru_tail = e;
+    }
+    s->lru_head = e;
+    e->linked = true;
+    s->cached_bytes += e->bytes;
+    s->cached_entries++;
+}
+
+static void entry_free(arm64_svc_server_t *s, cache_entry_t *e) {
+    if (e->map) {
+        munmap(e->map, e->map_size);
+    }
+    if (e->memfd >= 0) {
+        close(e->memfd);
+    }
+    arm64_free(s->allocator, e->chunks, e->chunk_count);
+    arm64_free(s->allocator, e, sizeof(*e));
+}
+
+/* 释放一个引用；已从链表移除且无人使用的条目随即释放 */
+static void entry_put(arm64_svc_server_t *s, cache_entry_t *e) {
+    if (--e->refs == 0 && !e->linked) {
+        entry_free(s, e);
+    }
+}
+
+/* 已解码的块计入条目和缓存的内存占用 */
+static void entry_add_bytes(arm64_svc_server_t *s, cache_entry_t *e, size_t bytes) {
+    e->bytes += bytes;
+    if (e->linked) {
+        s->cached_bytes += bytes;
+    }
+}
+
+/* 从最久未使用的条目开始淘汰，直到缓存不超过预算；正在使用的条目跳过 */
+static void evict_over_budget(arm64_svc_server_t *s) {
+    cache_entry_t *e = s->lru_tail;
+    while (e && s->cached_bytes > s->config.cache_budget) {
+        cache_entry_t *prev = e->prev;
+        if (e->state == ENTRY_READY && e->refs == 0) {
+            lru_unlink(s, e);
+            entry_free(s, e);
+            s->stats.evictions++;
+        }
+        e = prev;
+    }
+}
+
+/* 按文件标识查找已知的内容哈希 */
+static bool find_known_hash(arm64_svc_server_t *s, const struct stat *st, uint64_t *hash) {
+    for (cache_entry_t *e = s->lru_head; e; e = e->next) {
+        if (e->dev == st->st_dev && e->ino == st->st_ino && e->size == st->st_size &&
+            e->mtime.tv_sec == st->st_mtim.tv_sec && e->mtime.tv_nsec == st->st_mtim.tv_nsec) {
+            *hash = e->hash;
+            return true;
+        }
+    }
+    return false;
+}
+
+static cache_entry_t *find_entry(arm64_svc_server_t *s, uint64_t hash, uint32_t kind,
+                                 uint32_t endian, uint64_t base) {
+    for (cache_entry_t *e = s->lru_head; e; e = e->next) {
+        if (e->hash == hash && e->kind == kind && e->endian == endian && e->base == base) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/* ========== 映像哈希与解码（不持有 lock） ========== */
+
+/* 64位 FNV-1a，按8字节分组混合 */
+static uint64_t hash_image(const uint8_t *data, size_t size) {
+    uint64_t h = 0xCBF29CE484222325ull ^ (uint64_t)size;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t w;
+        memcpy(&w, data + i, sizeof(w));
+        h = (h ^ w) * 0x100000001B3ull;
+        h ^= h >> 29;
+    }
+    for (; i < size; i++) {
+        h = (h ^ data[i]) * 0x100000001B3ull;
+    }
+    return h;
+}
+
+/**
+ * 创建按整个映像布局的 memfd（稀疏，未解码的块不占内存）并保留服务端的可写映射，
+ * 然后加密封：不可改变大小，之后建立的映射只能只读（已有的可写映射不受影响）
+ * 只读取 e 的键和 count；结果由调用者在持有 lock 时写回条目
+ */
+static arm64_svc_status_t create_memfd(const cache_entry_t *e, int *memfd_out, uint8_t **map_out,
+                                       size_t *map_size_out) {
+    size_t bytes = e->count * item_size(e->kind);
+
+    int fd = memfd_create("arm64_disasm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+        return ARM64_SVC_NO_MEMORY;
+    }
+    if (ftruncate(fd, (off_t)bytes) != 0) {
+        close(fd);
+        return ARM64_SVC_NO_MEMORY;
+    }
+    void *map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return ARM64_SVC_NO_MEMORY;
+    }
+    if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_FUTURE_WRITE | F_SEAL_SEAL) != 0) {
+        munmap(map, bytes);
+        close(fd);
+        return ARM64_SVC_NO_MEMORY;
+    }
+    *memfd_out = fd;
+    *map_out = map;
+    *map_size_out = bytes;
+    return ARM64_SVC_OK;
+}
+
+/* 块 chunk 覆盖的指令范围 [first, first + n) */
+static size_t chunk_words(const cache_entry_t *e, size_t chunk, size_t *first) {
+    *first = chunk * CHUNK_WORDS;
+    size_t n = e->count - *first;
+    return n < CHUNK_WORDS ? n : CHUNK_WORDS;
+}
+
+/**
+ * 解码一块到条目的映射中（不持有 lock；调用者已认领该块）
+ * @return 块占用的字节数
+ */
+static size_t decode_chunk(const uint8_t *image, const cache_entry_t *e, size_t chunk) {
+    size_t first;
+    size_t count = chunk_words(e, chunk, &first);
+    size_t size = item_size(e->kind);
+    uint64_t base = e->base + first * 4;
+    image += first * 4;
+
+    if (e->kind == ARM64_SVC_KIND_INST) {
+        disassemble_buffer(image, count * 4, base, (arm64_endian_t)e->endian,
+                           (disasm_inst_t *)(e->map + first * size), count);
+    } else {
+        /* memfd 初始为全零，每行格式化后其余部分即为 NUL 填充 */
+        char *lines = (char *)e->map + first * size;
+        uint32_t words[BATCH_WORDS];
+        disasm_inst_t inst;
+        for (size_t done = 0; done < count; ) {
+            size_t n = count - done;
+            if (n > BATCH_WORDS) {
+                n = BATCH_WORDS;
+            }
+            arm64_load_words(image + done * 4, n * 4, (arm64_endian_t)e->endian, words);
+            for (size_t i = 0; i < n; i++) {
+                disassemble_arm64(words[i], base + (done + i) * 4, &inst);
+                format_instruction(&inst, lines + (done + i) * ARM64_SVC_TEXT_WIDTH,
+                                   ARM64_SVC_TEXT_WIDTH);
+            }
+            done += n;
+        }
+    }
+    return count * size;
+}
+
+/* ========== 请求处理 ========== */
+
+/* 客户端传来的映像：按需映射（描述符由 handle_request 关闭） */
+typedef struct {
+    int fd;
+    struct stat st;
+    const uint8_t *data;
+} image_t;
+
+static bool image_map(image_t *img) {
+    if (!img->data) {
+        void *p = mmap(NULL, (size_t)img->st.st_size, PROT_READ, MAP_PRIVATE, img->fd, 0);
+        if (p == MAP_FAILED) {
+            return false;
+        }
+        img->data = p;
+    }
+    return true;
+}
+
+static void image_unmap(image_t *img) {
+    if (img->data) {
+        munmap((void *)img->data, (size_t)img->st.st_size);
+    }
+}
+
+/**
+ * 获取（必要时创建）缓存条目，返回时持有一个引用；不解码
+ */
+static arm64_svc_status_t acquire_entry(arm64_svc_server_t *s, const arm64_svc_request_t *req,
+                                        image_t *img, uint64_t base, cache_entry_t **out) {
+    uint64_t hash;
+    bool known;
+
+    pthread_mutex_lock(&s->lock);
+    known = find_known_hash(s, &img->st, &hash);
+    pthread_mutex_unlock(&s->lock);
+
+    if (!known) {
+        if (!image_map(img)) {
+            return ARM64_SVC_IO_ERROR;
+        }
+        ARM64_TIMELINE_BEGIN("hash", 0, 0, 0, 0);
+        hash = hash_image(img->data, (size_t)img->st.st_size);
+        ARM64_TIMELINE_END("hash", 0, 0, (uint64_t)img->st.st_size, 0);
+    }
+
+    pthread_mutex_lock(&s->lock);
+    cache_entry_t *e = find_entry(s, hash, req->kind, req->endian, base);
+    if (e) {
+        /* 已有条目或正在由其他请求创建：等待完成 */
+        e->refs++;
+        while (e->state == ENTRY_PENDING) {
+            pthread_cond_wait(&s->cond, &s->lock);
+        }
+        if (e->state == ENTRY_FAILED) {
+            arm64_svc_status_t error = e->error;
+            entry_put(s, e);
+            pthread_mutex_unlock(&s->lock);
+            return error;
+        }
+        if (e->linked) {
+            lru_unlink(s, e);
+            lru_push_front(s, e);
+        }
+        pthread_mutex_unlock(&s->lock);
+        *out = e;
+        return ARM64_SVC_OK;
+    }
+
+    uint64_t count = (uint64_t)img->st.st_size / 4;
+    size_t chunk_count = (size_t)((count + CHUNK_WORDS - 1) / CHUNK_WORDS);
+    e = arm64_alloc(s->allocator, sizeof(*e), 16);
+    uint8_t *chunks = e ? arm64_alloc(s->allocator, chunk_count, 1) : NULL;
+    if (!chunks) {
+        arm64_free(s->allocator, e, sizeof(*e));
+        pthread_mutex_unlock(&s->lock);
+        return ARM64_SVC_NO_MEMORY;
+    }
+    memset(e, 0, sizeof(*e));
+    memset(chunks, CHUNK_EMPTY, chunk_count);
+    e->hash = hash;
+    e->kind = req->kind;
+    e->endian = req->endian;
+    e->base = base;
+    e->dev = img->st.st_dev;
+    e->ino = img->st.st_ino;
+    e->size = img->st.st_size;
+    e->mtime = img->st.st_mtim;
+    e->state = ENTRY_PENDING;
+    e->refs = 1;
+    e->memfd = -1;
+    e->chunks = chunks;
+    e->chunk_count = chunk_count;
+    e->count = count;
+    lru_push_front(s, e);
+    pthread_mutex_unlock(&s->lock);
+
+    int memfd = -1;
+    uint8_t *map = NULL;
+    size_t map_size = 0;
+    arm64_svc_status_t status = create_memfd(e, &memfd, &map, &map_size);
+
+    pthread_mutex_lock(&s->lock);
+    if (status == ARM64_SVC_OK) {
+        e->memfd = memfd;
+        e->map = map;
+        e->map_size = map_size;
+        e->state = ENTRY_READY;
+    } else {
+        lru_unlink(s, e);
+        e->state = ENTRY_FAILED;
+        e->error = status;
+    }
+    pthread_cond_broadcast(&s->cond);
+    if (status != ARM64_SVC_OK) {
+        entry_put(s, e);
+        pthread_mutex_unlock(&s->lock);
+        return status;
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    *out = e;
+    return ARM64_SVC_OK;
+}
+
+/**
+ * 确保指令 [first, first + count) 所在的块都已解码（调用者持有条目的引用）
+ * 逐块认领尚未解码的块并解码；其他请求正在解码的块等待其完成
+ * @param decoded 返回本请求解码的指令数（0 表示完全命中缓存）
+ */
+static arm64_svc_status_t fill_range(arm64_svc_server_t *s, cache_entry_t *e, image_t *img,
+                                     uint64_t first, uint64_t count, uint64_t *decoded) {
+    size_t lo = (size_t)(first / CHUNK_WORDS);
+    size_t hi = (size_t)((first + count - 1) / CHUNK_WORDS);
+    arm64_svc_status_t status = ARM64_SVC_OK;
+
+    *decoded = 0;
+    pthread_mutex_lock(&s->lock);
+    for (size_t c = lo; c <= hi && status == ARM64_SVC_OK; ) {
+        if (e->chunks[c] == CHUNK_READY) {
+            c++;
+            continue;
+        }
+        if (e->chunks[c] == CHUNK_DECODING) {
+            pthread_cond_wait(&s->cond, &s->lock);
+            continue;
+        }
+
+        /* 认领该块；限制同时解码的请求数量 */
+        e->chunks[c] = CHUNK_DECODING;
+        while (s->active_decodes >= s->config.max_decodes) {
+            pthread_cond_wait(&s->cond, &s->lock);
+        }
+        s->active_decodes++;
+        pthread_mutex_unlock(&s->lock);
+
+        size_t start;
+        size_t words = chunk_words(e, c, &start);
+        size_t bytes = 0;
+        uint64_t t0 = now_ns();
+        if (image_map(img)) {
+            ARM64_TIMELINE_BEGIN("decode", e->base + start * 4, e->base + (start + words) * 4, 0, 0);
+            bytes = decode_chunk(img->data, e, c);
+            ARM64_TIMELINE_END("decode", e->base + start * 4, e->base + (start + words) * 4,
+                               words * 4, words);
+        } else {
+            status = ARM64_SVC_IO_ERROR;
+        }
+        uint64_t elapsed = now_ns() - t0;
+
+        pthread_mutex_lock(&s->lock);
+        s->active_decodes--;
+        if (status == ARM64_SVC_OK) {
+            e->chunks[c] = CHUNK_READY;
+            entry_add_bytes(s, e, bytes);
+            s->stats.instructions_decoded += words;
+            s->stats.decode_ns += elapsed;
+            *decoded += words;
+        } else {
+            /* 退回该块，等待它的请求会重新认领 */
+            e->chunks[c] = CHUNK_EMPTY;
+        }
+        pthread_cond_broadcast(&s->cond);
+    }
+    if (status == ARM64_SVC_OK) {
+        if (*decoded == 0) {
+            s->stats.cache_hits++;
+        } else {
+            s->stats.cache_misses++;
+            evict_over_budget(s);
+        }
+    }
+    pthread_mutex_unlock(&s->lock);
+    return status;
+}
+
+static void release_entry(arm64_svc_server_t *s, cache_entry_t *e) {
+    pthread_mutex_lock(&s->lock);
+    entry_put(s, e);
+    /* 单个请求解码的块超过预算时在发送完成后淘汰 */
+    evict_over_budget(s);
+    pthread_mutex_unlock(&s->lock);
+}
+
+static bool send_response(int fd, const arm64_svc_response_t *resp,
+                          const void *payload, size_t payload_size, int memfd) {
+    char control[CMSG_SPACE(sizeof(int))];
+    struct iovec iov[2] = {
+        { (void *)resp, sizeof(*resp) },
+        { (void *)payload, payload_size },
+    };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = payload ? 2 : 1;
+
+    if (memfd >= 0) {
+        memset(control, 0, sizeof(control));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+        c->cmsg_level = SOL_SOCKET;
+        c->cmsg_type = SCM_RIGHTS;
+        c->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(c), &memfd, sizeof(int));
+    }
+
+    ssize_t n;
+    do {
+        n = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    } while (n < 0 && errno == EINTR);
+    return n >= 0;
+}
+
+static arm64_svc_status_t handle_decode(arm64_svc_server_t *s, int fd,
+                                        const arm64_svc_request_t *req, int image_fd,
+                                        arm64_svc_response_t *resp) {
+    if ((req->kind != ARM64_SVC_KIND_INST && req->kind != ARM64_SVC_KIND_TEXT) ||
+        (req->endian != ARM64_ENDIAN_LITTLE && req->endian != ARM64_ENDIAN_BIG) ||
+        image_fd < 0) {
+        return ARM64_SVC_BAD_REQUEST;
+    }
+    if (req->offset % 4 != 0) {
+        return ARM64_SVC_RANGE;
+    }
+
+    /* O_PATH 描述符不需要读权限就能打开，不能凭它读取映像或命中别人缓存的条目 */
+    int flags = fcntl(image_fd, F_GETFL);
+    if (flags < 0 || (flags & O_PATH) || (flags & O_ACCMODE) == O_WRONLY) {
+        return ARM64_SVC_DENIED;
+    }
+    image_t img = { .fd = image_fd };
+    if (fstat(img.fd, &img.st) != 0 || !S_ISREG(img.st.st_mode)) {
+        return ARM64_SVC_IO_ERROR;
+    }
+
+    uint64_t size = (uint64_t)img.st.st_size;
+    if (req->offset > size) {
+        return ARM64_SVC_RANGE;
+    }
+    uint64_t length = size - req->offset;
+    if (req->length != 0 && req->length < length) {
+        length = req->length;
+    }
+
+    resp->kind = req->kind;
+    resp->item_size = (uint32_t)item_size(req->kind);
+    if (size / 4 == 0 || length / 4 == 0) {
+        /* 空范围：不需要解码，也不附带 memfd */
+        return send_response(fd, resp, NULL, 0, -1) ? ARM64_SVC_OK : ARM64_SVC_IO_ERROR;
+    }
+
+    cache_entry_t *e = NULL;
+    uint64_t decoded = 0;
+    arm64_svc_status_t status = acquire_entry(s, req, &img, req->address - req->offset, &e);
+    if (status == ARM64_SVC_OK) {
+        status = fill_range(s, e, &img, req->offset / 4, length / 4, &decoded);
+        if (status != ARM64_SVC_OK) {
+            release_entry(s, e);
+        }
+    }
+    image_unmap(&img);
+    if (status != ARM64_SVC_OK) {
+        return status;
+    }
+
+    resp->count = length / 4;
+    resp->data_offset = req->offset / 4 * resp->item_size;
+    resp->data_size = resp->count * resp->item_size;
+    resp->image_hash = e->hash;
+    resp->cache_hit = decoded == 0;
+    ARM64_TIMELINE_BEGIN("send", req->address, req->address + length, 0, 0);
+    status = send_response(fd, resp, NULL, 0, e->memfd) ? ARM64_SVC_OK : ARM64_SVC_IO_ERROR;
+    ARM64_TIMELINE_END("send", req->address, req->address + length, resp->data_size, 0);
+    release_entry(s, e);
+    return status;
+}
+
+static void record_latency(arm64_svc_server_t *s, uint64_t ns) {
+    int bucket = 63 - __builtin_clzll(ns | 1);
+    s->latency_hist[bucket]++;
+    s->latency_count++;
+    s->latency_total += ns;
+    if (ns > s->stats.latency_max_ns) {
+        s->stats.latency_max_ns = ns;
+    }
+}
+
+/**
+ * 处理一个请求；出错时发送只含状态的应答
+ * @param image_fd 随请求传来的映像描述符（没有时为-1），由调用者关闭
+ * @return 连接是否可以继续使用
+ */
+static bool handle_request(arm64_svc_server_t *s, int fd, const arm64_svc_request_t *req,
+                           ssize_t len, int image_fd) {
+    uint64_t t0 = now_ns();
+    arm64_svc_response_t resp;
+    arm64_svc_status_t status;
+
+    memset(&resp, 0, sizeof(resp));
+    resp.magic = ARM64_SVC_MAGIC;
+
+    pthread_mutex_lock(&s->lock);
+    s->stats.requests++;
+    pthread_mutex_unlock(&s->lock);
+
+    if (len != (ssize_t)sizeof(*req) || req->magic != ARM64_SVC_MAGIC ||
+        req->version != ARM64_SVC_VERSION) {
+        status = ARM64_SVC_BAD_REQUEST;
+    } else if (req->op == ARM64_SVC_OP_STATS) {
+        arm64_svc_stats_t stats;
+        arm64_svc_server_stats(s, &stats);
+        return send_response(fd, &resp, &stats, sizeof(stats), -1);
+    } else if (req->op == ARM64_SVC_OP_DECODE) {
+        ARM64_TIMELINE_BEGIN("request", 0, 0, 0, 0);
+        status = handle_decode(s, fd, req, image_fd, &resp);
+        ARM64_TIMELINE_END("request", 0, 0, 0, resp.count);
+        if (status == ARM64_SVC_OK) {
+            pthread_mutex_lock(&s->lock);
+            record_latency(s, now_ns() - t0);
+            pthread_mutex_unlock(&s->lock);
+            return true;
+        }
+    } else {
+        status = ARM64_SVC_BAD_REQUEST;
+    }
+
+    pthread_mutex_lock(&s->lock);
+    s->stats.errors++;
+    pthread_mutex_unlock(&s->lock);
+    resp.status = status;
+    return send_response(fd, &resp, NULL, 0, -1);
+}
+
+/* ========== 连接 ========== */
+
+/**
+ * 接收一条请求及随附的描述符
+ * 附带多个描述符（控制数据被截断）时全部关闭并清除 magic，按错误请求回复
+ * @param image_fd 输出：随请求传来的描述符，没有时为-1
+ */
+static ssize_t recv_request(int fd, arm64_svc_request_t *req, int *image_fd) {
+    char control[CMSG_SPACE(sizeof(int))];
+    struct iovec iov = { req, sizeof(*req) };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    *image_fd = -1;
+    ssize_t n = recvmsg(fd, &msg, MSG_CMSG_CLOEXEC);
+    if (n < 0) {
+        return n;
+    }
+    bool extra = (msg.msg_flags & MSG_CTRUNC) != 0;
+    for (struct cmsghdr *c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c)) {
+        if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        size_t count = (c->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (size_t i = 0; i < count; i++) {
+            int received;
+            memcpy(&received, CMSG_DATA(c) + i * sizeof(int), sizeof(int));
+            if (*image_fd < 0) {
+                *image_fd = received;
+            } else {
+                close(received);
+                extra = true;
+            }
+        }
+    }
+    if (extra) {
+        if (*image_fd >= 0) {
+            close(*image_fd);
+            *image_fd = -1;
+        }
+        req->magic = 0;
+    }
+    return n;
+}
+
+static void *conn_thread(void *arg) {
+    conn_t *c = (conn_t *)arg;
+    arm64_svc_server_t *s = c->server;
+    /* active_clients 归零后服务端可能随即被销毁，之后不能再访问 s */
+    const arm64_allocator_t *allocator = s->allocator;
+    arm64_svc_request_t *req = arm64_alloc(allocator, sizeof(*req), 16);
+
+    while (req) {
+        int image_fd;
+        ssize_t n = recv_request(c->fd, req, &image_fd);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        bool keep = n > 0 && handle_request(s, c->fd, req, n, image_fd);
+        if (image_fd >= 0) {
+            close(image_fd);
+        }
+        if (!keep) {
+            break;
+        }
+    }
+    arm64_free(allocator, req, sizeof(*req));
+
+    pthread_mutex_lock(&s->lock);
+    for (conn_t **p = &s->conns; *p; p = &(*p)->next) {
+        if (*p == c) {
+            *p = c->next;
+            break;
+        }
+    }
+    s->active_clients--;
+    pthread_cond_broadcast(&s->cond);
+    pthread_mutex_unlock(&s->lock);
+
+    close(c->fd);
+    arm64_free(allocator, c, sizeof(*c));
+    return NULL;
+}
+
+/* 超过连接上限（BUSY）或连接方不是允许的用户（DENIED）：回复状态后关闭 */
+static void reject_conn(arm64_svc_server_t *s, int fd, arm64_svc_status_t status) {
+    arm64_svc_response_t resp;
+    memset(&resp, 0, sizeof(resp));
+    resp.magic = ARM64_SVC_MAGIC;
+    resp.status = status;
+
+    /* 先计数再回复：客户端收到 BUSY 后查询的统计已包含本次拒绝 */
+    pthread_mutex_lock(&s->lock);
+    s->stats.rejected++;
+    pthread_mutex_unlock(&s->lock);
+
+    send_response(fd, &resp, NULL, 0, -1);
+    close(fd);
+}
+
+/* 连接方（connect 时的有效用户）必须与服务端相同或为 root */
+static bool peer_allowed(const arm64_svc_server_t *s, int fd) {
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0 || len != sizeof(cred)) {
+        return false;
+    }
+    return cred.uid == s->uid || cred.uid == 0;
+}
+
+/**
+ * 准备套接字所在目录：不存在时以 0700 创建；
+ * 属于其他用户（root 除外）或可被他人写入且没有粘滞位的目录中，套接字可能被替换，拒绝使用
+ */
+static bool prepare_socket_dir(const char *socket_path) {
+    char dir[sizeof(((struct sockaddr_un *)0)->sun_path)];
+    const char *slash = strrchr(socket_path, '/');
+    if (!slash) {
+        strcpy(dir, ".");
+    } else if (slash == socket_path) {
+        strcpy(dir, "/");
+    } else {
+        memcpy(dir, socket_path, (size_t)(slash - socket_path));
+        dir[slash - socket_path] = '\0';
+    }
+
+    if (mkdir(dir, 0700) != 0 && errno != EEXIST) {
+        return false;
+    }
+    struct stat st;
+    if (lstat(dir, &st) != 0) {
+        return false;
+    }
+    if (!S_ISDIR(st.st_mode) || (st.st_uid != geteuid() && st.st_uid != 0) ||
+        ((st.st_mode & (S_IWGRP | S_IWOTH)) && !(st.st_mode & S_ISVTX))) {
+        errno = EACCES;
+        return false;
+    }
+    return true;
+}
+
+/* 删除已存在的同名套接字（上次运行留下的）；同名的其他文件不删除 */
+static bool remove_stale_socket(const char *socket_path) {
+    struct stat st;
+    if (lstat(socket_path, &st) != 0) {
+        return errno == ENOENT;
+    }
+    if (!S_ISSOCK(st.st_mode)) {
+        errno = EEXIST;
+        return false;
+    }
+    return unlink(socket_path) == 0;
+}
+
+/* ========== 服务端接口 ========== */
+
+void arm64_svc_config_init(arm64_svc_config_t *config) {
+    config->socket_path = arm64_svc_default_socket();
+    config->cache_budget = ARM64_SVC_DEFAULT_BUDGET;
+    config->max_clients = ARM64_SVC_DEFAULT_MAX_CLIENTS;
+    config->max_decodes = ARM64_SVC_DEFAULT_MAX_DECODES;
+}
+
+arm64_svc_server_t *arm64_svc_server_create(const arm64_svc_config_t *config) {
+    if (!config || !config->socket_path || config->max_clients == 0 || config->max_decodes == 0) {
+        return NULL;
+    }
+
+    const arm64_allocator_t *allocator = arm64_default_allocator();
+    if (strlen(config->socket_path) >= sizeof(((arm64_svc_server_t *)0)->socket_path)) {
+        return NULL;
+    }
+    arm64_svc_server_t *s = arm64_alloc(allocator, sizeof(*s), 16);
+    if (!s) {
+        return NULL;
+    }
+    memset(s, 0, sizeof(*s));
+    s->allocator = allocator;
+    s->uid = geteuid();
+    s->config = *config;
+    strcpy(s->socket_path, config->socket_path);
+    s->config.socket_path = s->socket_path;
+    atomic_init(&s->stopping, false);
+    clock_gettime(CLOCK_MONOTONIC, &s->start);
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->cond, NULL);
+
+    s->listen_fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (s->listen_fd < 0) {
+        arm64_svc_server_destroy(s);
+        return NULL;
+    }
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, s->socket_path);
+    /* bind 按 umask 设置套接字文件的权限：只允许本用户连接（0600）；umask 是进程级的，只在 bind 期间修改 */
+    bool bound = false;
+    if (prepare_socket_dir(s->socket_path) && remove_stale_socket(s->socket_path)) {
+        mode_t old_mask = umask(0177);
+        bound = bind(s->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) == 0;
+        umask(old_mask);
+    }
+    if (!bound || listen(s->listen_fd, 64) != 0) {
+        int saved = errno;
+        close(s->listen_fd);
+        s->listen_fd = -1;
+        if (bound) {
+            unlink(s->socket_path);
+        }
+        arm64_svc_server_destroy(s);
+        errno = saved;
+        return NULL;
+    }
+    return s;
+}
+
+void arm64_svc_server_run(arm64_svc_server_t *s) {
+    while (!atomic_load(&s->stopping)) {
+        int fd = accept4(s->listen_fd, NULL, NULL, SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            break;
+        }
+
+        pthread_mutex_lock(&s->lock);
+        bool full = s->active_clients >= s->config.max_clients;
+        pthread_mutex_unlock(&s->lock);
+        if (full || atomic_load(&s->stopping)) {
+            reject_conn(s, fd, ARM64_SVC_BUSY);
+            continue;
+        }
+        if (!peer_allowed(s, fd)) {
+            reject_conn(s, fd, ARM64_SVC_DENIED);
+            continue;
+        }
+
+        conn_t *c = arm64_alloc(s->allocator, sizeof(*c), 16);
+        pthread_t tid;
+        pthread_attr_t attr;
+        if (!c) {
+            close(fd);
+            continue;
+        }
+        c->server = s;
+        c->fd = fd;
+
+        pthread_mutex_lock(&s->lock);
+        c->next = s->conns;
+        s->conns = c;
+        s->active_clients++;
+        pthread_mutex_unlock(&s->lock);
+
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        if (pthread_create(&tid, &attr, conn_thread, c) != 0) {
+            pthread_mutex_lock(&s->lock);
+            s->conns = c->next;
+            s->active_clients--;
+            pthread_mutex_unlock(&s->lock);
+            close(fd);
+            arm64_free(s->allocator, c, sizeof(*c));
+        }
+        pthread_attr_destroy(&attr);
+    }
+
+    /* 关闭所有连接的读端，使连接线程的 recv 返回，然后等待它们结束 */
+    pthread_mutex_lock(&s->lock);
+    for (conn_t *c = s->conns; c; c = c->next) {
+        shutdown(c->fd, SHUT_RDWR);
+    }
+    while (s->active_clients > 0) {
+        pthread_cond_wait(&s->cond, &s->lock);
+    }
+    pthread_mutex_unlock(&s->lock);
+}
+
+void arm64_svc_server_stop(arm64_svc_server_t *s) {
+    atomic_store(&s->stopping, true);
+    /* 唤醒阻塞在 accept 中的线程（shutdown 是异步信号安全的） */
+    shutdown(s->listen_fd, SHUT_RDWR);
+}
+
+void arm64_svc_server_destroy(arm64_svc_server_t *s) {
+    if (!s) {
+        return;
+    }
+    if (s->listen_fd >= 0) {
+        close(s->listen_fd);
+        unlink(s->socket_path);
+    }
+    while (s->lru_head) {
+        cache_entry_t *e = s->lru_head;
+        lru_unlink(s, e);
+        entry_free(s, e);
+    }
+    pthread_cond_destroy(&s->cond);
+    pthread_mutex_destroy(&s->lock);
+    arm64_free(s->allocator, s, sizeof(*s));
+}
+
+/* 由直方图估计百分位：返回累计数达到 p 的桶的上界 */
+static uint64_t latency_percentile(const arm64_svc_server_t *s, double p) {
+    uint64_t want = (uint64_t)((double)s->latency_count * p + 0.5);
+    uint64_t seen = 0;
+    if (want == 0) {
+        want = 1;
+    }
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += s->latency_hist[i];
+        if (seen >= want) {
+            uint64_t upper = i >= 63 ? UINT64_MAX : (2ull << i);
+            return upper < s->stats.latency_max_ns ? upper : s->stats.latency_max_ns;
+        }
+    }
+    return 0;
+}
+
+void arm64_svc_server_stats(arm64_svc_server_t *s, arm64_svc_stats_t *stats) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    pthread_mutex_lock(&s->lock);
+    *stats = s->stats;
+    stats->uptime_ns = (uint64_t)(now.tv_sec - s->start.tv_sec) * 1000000000u +
+                       (uint64_t)(now.tv_nsec - s->start.tv_nsec);
+    stats->cached_entries = s->cached_entries;
+    stats->cached_bytes = s->cached_bytes;
+    stats->cache_budget = s->config.cache_budget;
+    stats->active_clients = s->active_clients;
+    stats->active_decodes = s->active_decodes;
+    if (s->latency_count > 0) {
+        stats->latency_avg_ns = s->latency_total / s->latency_count;
+        stats->latency_p50_ns = latency_percentile(s, 0.50);
+        stats->latency_p99_ns = latency_percentile(s, 0.99);
+    }
+    pthread_mutex_unlock(&s->lock);
+}
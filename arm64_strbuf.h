@@ -0,0 +1,154 @@
+/**
+ * ARM64反汇编器 - 字符串构建器
+ * 直接写入调用者提供的缓冲区，不依赖 stdio/string.h，可用于独立环境（内核、裸机）
+ * 超出容量时截断并保证以'\0'结尾，len 记录完整长度（与 snprintf 的返回值语义相同）
+ */
+
+#ifndef ARM64_STRBUF_H
+#define ARM64_STRBUF_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * 内存复制/清零：独立环境下使用编译器内建函数，不包含 string.h
+ * （GCC/Clang 要求独立环境提供 memcpy/memset 符号，内核和常见裸机运行时都满足）
+ */
+#if defined(ARM64_DISASM_FREESTANDING)
+    #define ARM64_MEMCPY(dst, src, n)   __builtin_memcpy((dst), (src), (n))
+    #define ARM64_MEMSET(dst, c, n)     __builtin_memset((dst), (c), (n))
+#else
+    #include <string.h>
+    #define ARM64_MEMCPY(dst, src, n)   memcpy((dst), (src), (n))
+    #define ARM64_MEMSET(dst, c, n)     memset((dst), (c), (n))
+#endif
+
+/* 字符串构建器 */
+typedef struct {
+    char *buf;      // 输出缓冲区
+    size_t size;    // 缓冲区容量（含结尾'\0'）
+    size_t len;     // 已追加的字符数（可能大于容量）
+} strbuf_t;
+
+/**
+ * 初始化构建器并清空缓冲区
+ */
+static inline void strbuf_init(strbuf_t *sb, char *buf, size_t size) {
+    sb->buf = buf;
+    sb->size = size;
+    sb->len = 0;
+    if (size > 0) {
+        buf[0] = '\0';
+    }
+}
+
+/**
+ * 回退到指定长度
+ */
+static inline void strbuf_truncate(strbuf_t *sb, size_t len) {
+    if (len < sb->len) {
+        sb->len = len;
+        if (sb->size > 0) {
+            sb->buf[len < sb->size ? len : sb->size - 1] = '\0';
+        }
+    }
+}
+
+static inline void strbuf_putc(strbuf_t *sb, char c) {
+    if (sb->len + 1 < sb->size) {
+        sb->buf[sb->len] = c;
+        sb->buf[sb->len + 1] = '\0';
+    }
+    sb->len++;
+}
+
+static inline void strbuf_puts(strbuf_t *sb, const char *s) {
+    while (*s) {
+        strbuf_putc(sb, *s++);
+    }
+}
+
+/**
+ * 追加无符号整数
+ * @param base 10 或 16（小写十六进制，不带前缀）
+ * @param min_digits 最少位数，不足时补0
+ */
+static inline void strbuf_put_uint(strbuf_t *sb, uint64_t value, unsigned base,
+                                   unsigned min_digits) {
+    static const char digits[] = "0123456789abcdef";
+    char tmp[20];
+    unsigned n = 0;
+
+    do {
+        tmp[n++] = digits[value % base];
+        value /= base;
+    } while (value != 0);
+    while (n < min_digits && n < sizeof(tmp)) {
+        tmp[n++] = '0';
+    }
+    while (n > 0) {
+        strbuf_putc(sb, tmp[--n]);
+    }
+}
+
+static inline void strbuf_put_dec(strbuf_t *sb, int64_t value) {
+    if (value < 0) {
+        strbuf_putc(sb, '-');
+        strbuf_put_uint(sb, 0 - (uint64_t)value, 10, 1);
+    } else {
+        strbuf_put_uint(sb, (uint64_t)value, 10, 1);
+    }
+}
+
+/* 追加 "0x" 前缀的十六进制数 */
+static inline void strbuf_put_hex(strbuf_t *sb, uint64_t value) {
+    strbuf_puts(sb, "0x");
+    strbuf_put_uint(sb, value, 16, 1);
+}
+
+/* 用空格填充到指定列 */
+static inline void strbuf_pad_to(strbuf_t *sb, size_t column) {
+    while (sb->len < column) {
+        strbuf_putc(sb, ' ');
+    }
+}
+
+/* ========== 字符串辅助函数 ========== */
+
+static inline size_t strbuf_strlen(const char *s) {
+    size_t n = 0;
+    while (s[n]) {
+        n++;
+    }
+    return n;
+}
+
+static inline bool strbuf_equal(const char *a, const char *b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/* s 是否以 prefix 开头 */
+static inline bool strbuf_has_prefix(const char *s, const char *prefix) {
+    while (*prefix) {
+        if (*s++ != *prefix++) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 安全复制字符串（截断并保证以'\0'结尾）
+ */
+static inline void strbuf_copy(char *dst, size_t size, const char *src) {
+    strbuf_t sb;
+    strbuf_init(&sb, dst, size);
+    strbuf_puts(&sb, src);
+}
+
+#endif /* ARM64_STRBUF_H */
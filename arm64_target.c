@@ -0,0 +1,208 @@
+/**
+ * ARM64反汇编器 - 目标配置
+ * 解析 -march 风格的配置字符串（基线 + 扩展修饰），得到按配置解码使用的扩展集合
+ * 只使用调用者的缓冲区，不依赖 libc，独立环境库中同样可用
+ */
+
+#include "arm64_disasm.h"
+
+/* ========== 名称比较 ========== */
+
+/* 不区分大小写、'-' 与 '_' 视为相同，比较 name[0..len) 与以 '\0' 结尾的 ref */
+static bool name_equal(const char *name, size_t len, const char *ref) {
+    size_t i = 0;
+    for (; i < len && ref[i] != '\0'; i++) {
+        char a = name[i], b = ref[i];
+        if (a >= 'A' && a <= 'Z') a = (char)(a - 'A' + 'a');
+        if (b >= 'A' && b <= 'Z') b = (char)(b - 'A' + 'a');
+        if (a == '-') a = '_';
+        if (b == '-') b = '_';
+        if (a != b) {
+            return false;
+        }
+    }
+    return i == len && ref[i] == '\0';
+}
+
+static size_t name_length(const char *s) {
+    size_t n = 0;
+    while (s[n] != '\0') {
+        n++;
+    }
+    return n;
+}
+
+static arm64_ext_t find_extension_n(const char *name, size_t len) {
+    for (int e = 0; e < ARM64_EXT_COUNT; e++) {
+        if (name_equal(name, len, arm64_ext_names[e])) {
+            return (arm64_ext_t)e;
+        }
+    }
+    return ARM64_EXT_COUNT;
+}
+
+/**
+ * 按名称查找扩展
+ */
+arm64_ext_t find_extension(const char *name) {
+    return name ? find_extension_n(name, name_length(name)) : ARM64_EXT_COUNT;
+}
+
+/* ========== 基线与别名 ========== */
+
+#define EXT_END ARM64_EXT_COUNT
+
+/*
+ * 架构基线：在 base（以及 also）基线之上增加 exts 中的扩展。只列出有指令编码的必选扩展；
+ * FP/AdvSIMD 与 GCC 的 -march 一样默认包含，可用 +nosimd 去掉
+ */
+typedef struct {
+    const char *name;
+    int base;                   // 继承的基线下标，-1 表示无
+    int also;                   // armv9.x 同时继承对应的 armv8.x
+    arm64_ext_t exts[8];
+} baseline_t;
+
+static const baseline_t baselines[] = {
+    /*  0 */ { "armv8-a",   -1, -1, { ARM64_EXT_ASIMD, EXT_END } },
+    /*  1 */ { "armv8.1-a",  0, -1, { ARM64_EXT_CRC32, ARM64_EXT_LSE, ARM64_EXT_LOR,
+                                      ARM64_EXT_RDM, EXT_END } },
+    /*  2 */ { "armv8.2-a",  1, -1, { ARM64_EXT_RAS, EXT_END } },
+    /*  3 */ { "armv8.3-a",  2, -1, { ARM64_EXT_PAUTH, ARM64_EXT_FCMA, ARM64_EXT_JSCVT,
+                                      ARM64_EXT_LRCPC, EXT_END } },
+    /*  4 */ { "armv8.4-a",  3, -1, { ARM64_EXT_FLAGM, ARM64_EXT_LRCPC2, ARM64_EXT_DOTPROD,
+                                      ARM64_EXT_TRF, EXT_END } },
+    /*  5 */ { "armv8.5-a",  4, -1, { ARM64_EXT_SB, ARM64_EXT_FLAGM2, ARM64_EXT_FRINTTS,
+                                      ARM64_EXT_BTI, ARM64_EXT_SPECRES, EXT_END } },
+    /*  6 */ { "armv8.6-a",  5, -1, { ARM64_EXT_BF16, ARM64_EXT_I8MM, EXT_END } },
+    /*  7 */ { "armv8.7-a",  6, -1, { ARM64_EXT_WFXT, ARM64_EXT_XS, EXT_END } },
+    /*  8 */ { "armv8.8-a",  7, -1, { ARM64_EXT_MOPS, ARM64_EXT_HBC, EXT_END } },
+    /*  9 */ { "armv8.9-a",  8, -1, { ARM64_EXT_CSSC, ARM64_EXT_CLRBHB, ARM64_EXT_SPECRES2,
+                                      ARM64_EXT_RPRFM, EXT_END } },
+    /* 10 */ { "armv9-a",    5, -1, { ARM64_EXT_SVE, ARM64_EXT_SVE2, EXT_END } },
+    /* 11 */ { "armv9.1-a", 10,  6, { EXT_END } },
+    /* 12 */ { "armv9.2-a", 11,  7, { EXT_END } },
+    /* 13 */ { "armv9.3-a", 12,  8, { EXT_END } },
+    /* 14 */ { "armv9.4-a", 13,  9, { EXT_END } },
+};
+
+#define BASELINE_COUNT  (sizeof(baselines) / sizeof(baselines[0]))
+
+/* GCC/Clang 扩展修饰名到扩展的映射（与扩展名相同的不必列出） */
+typedef struct {
+    const char *name;
+    arm64_ext_t exts[4];
+} alias_t;
+
+static const alias_t aliases[] = {
+    { "crc",      { ARM64_EXT_CRC32, EXT_END } },
+    { "rdma",     { ARM64_EXT_RDM, EXT_END } },
+    { "rcpc",     { ARM64_EXT_LRCPC, EXT_END } },
+    { "rcpc2",    { ARM64_EXT_LRCPC2, EXT_END } },
+    { "rcpc3",    { ARM64_EXT_LRCPC3, EXT_END } },
+    { "fp16fml",  { ARM64_EXT_FHM, EXT_END } },
+    { "memtag",   { ARM64_EXT_MTE, ARM64_EXT_MTE2, EXT_END } },
+    { "predres",  { ARM64_EXT_SPECRES, EXT_END } },
+    { "predres2", { ARM64_EXT_SPECRES2, EXT_END } },
+    { "f32mm",    { ARM64_EXT_SVE_F32MM, EXT_END } },
+    { "f64mm",    { ARM64_EXT_SVE_F64MM, EXT_END } },
+    { "simd",     { ARM64_EXT_ASIMD, EXT_END } },
+    { "fp",       { ARM64_EXT_ASIMD, EXT_END } },
+    { "neon",     { ARM64_EXT_ASIMD, EXT_END } },
+    { "sha2",     { ARM64_EXT_SHA1, ARM64_EXT_SHA256, EXT_END } },
+    { "crypto",   { ARM64_EXT_AES, ARM64_EXT_SHA1, ARM64_EXT_SHA256, EXT_END } },
+};
+
+static void add_baseline(arm64_ext_set_t *set, int index) {
+    while (index >= 0) {
+        const baseline_t *b = &baselines[index];
+        for (size_t i = 0; b->exts[i] != EXT_END; i++) {
+            arm64_ext_set_add(set, b->exts[i]);
+        }
+        if (b->also >= 0) {
+            add_baseline(set, b->also);
+        }
+        index = b->base;
+    }
+}
+
+/* 一个修饰名的扩展列表；找不到时返回 false */
+static bool modifier_exts(const char *name, size_t len, arm64_ext_t exts[4]) {
+    arm64_ext_t ext = find_extension_n(name, len);
+    if (ext != ARM64_EXT_COUNT) {
+        exts[0] = ext;
+        exts[1] = EXT_END;
+        return true;
+    }
+    for (size_t i = 0; i < sizeof(aliases) / sizeof(aliases[0]); i++) {
+        if (name_equal(name, len, aliases[i].name)) {
+            for (size_t j = 0; j < 4; j++) {
+                exts[j] = aliases[i].exts[j];
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 解析目标配置
+ */
+bool arm64_target_parse(arm64_target_t *target, const char *spec) {
+    if (!target || !spec) {
+        return false;
+    }
+    arm64_ext_set_t set;
+    arm64_ext_set_clear(&set);
+
+    size_t len = 0;
+    while (spec[len] != '\0' && spec[len] != '+') {
+        len++;
+    }
+    if (name_equal(spec, len, "all")) {
+        for (int e = 0; e < ARM64_EXT_COUNT; e++) {
+            arm64_ext_set_add(&set, (arm64_ext_t)e);
+        }
+    } else {
+        size_t i = 0;
+        while (i < BASELINE_COUNT && !name_equal(spec, len, baselines[i].name)) {
+            i++;
+        }
+        if (i == BASELINE_COUNT) {
+            return false;
+        }
+        add_baseline(&set, (int)i);
+    }
+
+    /* 修饰按顺序生效："+no扩展" 去掉，其余加入 */
+    const char *p = spec + len;
+    while (*p == '+') {
+        p++;
+        len = 0;
+        while (p[len] != '\0' && p[len] != '+') {
+            len++;
+        }
+        arm64_ext_t exts[4];
+        bool remove = false;
+        if (!modifier_exts(p, len, exts)) {
+            if (len <= 2 || !name_equal(p, 2, "no") || !modifier_exts(p + 2, len - 2, exts)) {
+                return false;
+            }
+            remove = true;
+        }
+        for (size_t j = 0; j < 4 && exts[j] != EXT_END; j++) {
+            if (remove) {
+                arm64_ext_set_remove(&set, exts[j]);
+            } else {
+                arm64_ext_set_add(&set, exts[j]);
+            }
+        }
+        p += len;
+    }
+    if (*p != '\0') {
+        return false;
+    }
+
+    arm64_target_init(target, &set);
+    return true;
+}
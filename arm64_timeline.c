@@ -0,0 +1,298 @@
+/**
+ * ARM64反汇编器 - 阶段时间线（每线程缓冲区 + Chrome trace-event 导出）
+ */
+
+#include "arm64_timeline.h"
+#include "arm64_alloc.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #define TL_THREAD_LOCAL __declspec(thread)
+#else
+    #include <pthread.h>
+    #include <time.h>
+    #include <unistd.h>
+    #if defined(__linux__)
+        #include <sys/syscall.h>
+    #endif
+    #define TL_THREAD_LOCAL _Thread_local
+#endif
+
+/* ========== 原子操作 ========== */
+
+typedef struct buffer buffer_t;
+
+#if defined(_MSC_VER)
+static inline size_t load_acquire(const size_t *p) {
+    return *(const volatile size_t *)p;
+}
+static inline void store_release(size_t *p, size_t v) {
+    *(volatile size_t *)p = v;
+}
+static inline buffer_t *load_head(buffer_t **p) {
+    return *(buffer_t *volatile *)p;
+}
+static inline bool cas_int(long *p, long old, long desired) {
+    return InterlockedCompareExchange((volatile LONG *)p, desired, old) == old;
+}
+static inline bool cas_head(buffer_t **p, buffer_t *old, buffer_t *desired) {
+    return InterlockedCompareExchangePointer((PVOID volatile *)p, desired, old) == old;
+}
+static inline void release_int(long *p) {
+    InterlockedExchange((volatile LONG *)p, 0);
+}
+#else
+static inline size_t load_acquire(const size_t *p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+static inline void store_release(size_t *p, size_t v) {
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+static inline buffer_t *load_head(buffer_t **p) {
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+static inline bool cas_int(long *p, long old, long desired) {
+    return __atomic_compare_exchange_n(p, &old, desired, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+static inline bool cas_head(buffer_t **p, buffer_t *old, buffer_t *desired) {
+    return __atomic_compare_exchange_n(p, &old, desired, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+static inline void release_int(long *p) {
+    __atomic_store_n(p, 0, __ATOMIC_RELEASE);
+}
+#endif
+
+/* ========== 缓冲区 ========== */
+
+typedef struct {
+    uint64_t ts;                // 纳秒（单调时钟）
+    uint64_t start;
+    uint64_t end;
+    uint64_t bytes;
+    uint64_t insts;
+    const char *name;
+    uint32_t tid;
+    char phase;
+} event_t;
+
+/*
+ * 缓冲区只有持有它的线程写入；线程退出后释放持有权，新线程可以接着使用（已有事件保留）
+ * 链表只增不减，导出时遍历
+ */
+struct buffer {
+    buffer_t *next;
+    size_t capacity;
+    size_t count;               // 写入者以 release 语义更新，导出时以 acquire 读取
+    uint64_t dropped;
+    long owned;
+    event_t events[];
+};
+
+volatile bool arm64_timeline_active = false;
+
+static buffer_t *buffers = NULL;
+static size_t buffer_events = ARM64_TIMELINE_DEFAULT_EVENTS;
+
+static TL_THREAD_LOCAL buffer_t *tls_buffer = NULL;
+static TL_THREAD_LOCAL uint32_t tls_tid = 0;
+
+static uint64_t now_ns(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER freq, counter;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static uint32_t current_tid(void) {
+#if defined(_WIN32)
+    return (uint32_t)GetCurrentThreadId();
+#elif defined(__linux__)
+    return (uint32_t)syscall(SYS_gettid);
+#else
+    static uint32_t next_tid = 0;
+    return __atomic_add_fetch(&next_tid, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+static uint32_t current_pid(void) {
+#if defined(_WIN32)
+    return (uint32_t)GetCurrentProcessId();
+#else
+    return (uint32_t)getpid();
+#endif
+}
+
+#if !defined(_WIN32)
+/* 线程退出时释放缓冲区的持有权 */
+static pthread_key_t owner_key;
+static pthread_once_t owner_once = PTHREAD_ONCE_INIT;
+
+static void release_owner(void *arg) {
+    release_int(&((buffer_t *)arg)->owned);
+}
+
+static void create_owner_key(void) {
+    pthread_key_create(&owner_key, release_owner);
+}
+#endif
+
+/* 为当前线程取得缓冲区：优先复用已退出线程的缓冲区，否则新建并挂到链表头 */
+static buffer_t *acquire_buffer(void) {
+    buffer_t *b;
+    for (b = load_head(&buffers); b; b = b->next) {
+        if (cas_int(&b->owned, 0, 1)) {
+            break;
+        }
+    }
+    if (!b) {
+        size_t capacity = buffer_events;
+        b = arm64_alloc(arm64_default_allocator(), sizeof(buffer_t) + capacity * sizeof(event_t),
+                        16);
+        if (!b) {
+            return NULL;
+        }
+        b->capacity = capacity;
+        b->count = 0;
+        b->dropped = 0;
+        b->owned = 1;
+        do {
+            b->next = load_head(&buffers);
+        } while (!cas_head(&buffers, b->next, b));
+    }
+#if !defined(_WIN32)
+    pthread_once(&owner_once, create_owner_key);
+    pthread_setspecific(owner_key, b);
+#endif
+    tls_buffer = b;
+    tls_tid = current_tid();
+    return b;
+}
+
+/* ========== 记录 ========== */
+
+void arm64_timeline_record(char phase, const char *name, uint64_t start, uint64_t end,
+                           uint64_t bytes, uint64_t insts) {
+    buffer_t *b = tls_buffer ? tls_buffer : acquire_buffer();
+    if (!b) {
+        return;
+    }
+    size_t n = b->count;
+    if (n >= b->capacity) {
+        b->dropped++;
+        return;
+    }
+    event_t *e = &b->events[n];
+    e->ts = now_ns();
+    e->start = start;
+    e->end = end;
+    e->bytes = bytes;
+    e->insts = insts;
+    e->name = name;
+    e->tid = tls_tid;
+    e->phase = phase;
+    store_release(&b->count, n + 1);
+}
+
+bool arm64_timeline_start(size_t events_per_thread) {
+    buffer_events = events_per_thread ? events_per_thread : ARM64_TIMELINE_DEFAULT_EVENTS;
+    /* 预先取得当前线程的缓冲区，以便报告内存不足 */
+    if (!tls_buffer && !acquire_buffer()) {
+        return false;
+    }
+    arm64_timeline_active = true;
+    return true;
+}
+
+void arm64_timeline_stop(void) {
+    arm64_timeline_active = false;
+}
+
+void arm64_timeline_clear(void) {
+    for (buffer_t *b = load_head(&buffers); b; b = b->next) {
+        store_release(&b->count, 0);
+        b->dropped = 0;
+    }
+}
+
+void arm64_timeline_counts(uint64_t *recorded, uint64_t *dropped) {
+    uint64_t r = 0, d = 0;
+    for (buffer_t *b = load_head(&buffers); b; b = b->next) {
+        r += load_acquire(&b->count);
+        d += b->dropped;
+    }
+    if (recorded) {
+        *recorded = r;
+    }
+    if (dropped) {
+        *dropped = d;
+    }
+}
+
+/* ========== 导出 ========== */
+
+static void write_event(FILE *f, const event_t *e, uint32_t pid, bool first) {
+    fprintf(f, "%s\n{\"name\":\"%s\",\"cat\":\"arm64\",\"ph\":\"%c\",\"ts\":%llu.%03u,"
+            "\"pid\":%u,\"tid\":%u",
+            first ? "" : ",", e->name, e->phase, (unsigned long long)(e->ts / 1000),
+            (unsigned)(e->ts % 1000), pid, e->tid);
+    if (e->start || e->end || e->bytes || e->insts) {
+        /* 地址可能超过 JSON 数值的精确范围，以十六进制字符串输出 */
+        const char *sep = "";
+        fputs(",\"args\":{", f);
+        if (e->start || e->end) {
+            fprintf(f, "\"start\":\"0x%llx\",\"end\":\"0x%llx\"",
+                    (unsigned long long)e->start, (unsigned long long)e->end);
+            sep = ",";
+        }
+        if (e->bytes) {
+            fprintf(f, "%s\"bytes\":%llu", sep, (unsigned long long)e->bytes);
+            sep = ",";
+        }
+        if (e->insts) {
+            fprintf(f, "%s\"insts\":%llu", sep, (unsigned long long)e->insts);
+        }
+        fputc('}', f);
+    }
+    fputc('}', f);
+}
+
+long arm64_timeline_export(const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        return -1;
+    }
+
+    uint32_t pid = current_pid();
+    uint64_t dropped = 0;
+    long written = 0;
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", f);
+    for (buffer_t *b = load_head(&buffers); b; b = b->next) {
+        size_t n = load_acquire(&b->count);
+        for (size_t i = 0; i < n; i++) {
+            write_event(f, &b->events[i], pid, written == 0);
+            written++;
+        }
+        dropped += b->dropped;
+    }
+    fprintf(f, "\n],\"otherData\":{\"dropped_events\":%llu}}\n", (unsigned long long)dropped);
+
+    if (fclose(f) != 0) {
+        return -1;
+    }
+    return written;
+}
+
+#endif /* ARM64_DISASM_FREESTANDING */
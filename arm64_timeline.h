@@ -0,0 +1,99 @@
+/**
+ * ARM64反汇编器 - 阶段时间线
+ * 记录各阶段（加载、解码、分析、输出）和各分段的开始/结束事件，结束时导出为
+ * Chrome trace-event JSON（chrome://tracing、Perfetto 可直接打开）
+ *
+ * - 每个线程写自己的缓冲区，记录时不加锁；缓冲区满时丢弃并计数
+ * - 未启用时每个记录点只有一次可预测的分支（读取 arm64_timeline_active）
+ * - 事件名必须是静态字符串（只保存指针）
+ * 独立环境（ARM64_DISASM_FREESTANDING）中记录宏为空操作
+ */
+
+#ifndef ARM64_TIMELINE_H
+#define ARM64_TIMELINE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define ARM64_TIMELINE_UNLIKELY(x) __builtin_expect(!!(x), 0)
+#else
+    #define ARM64_TIMELINE_UNLIKELY(x) (x)
+#endif
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+/* 每个线程缓冲区的默认事件数 */
+#define ARM64_TIMELINE_DEFAULT_EVENTS 65536
+
+/* 是否正在记录（由 arm64_timeline_start/stop 设置） */
+extern volatile bool arm64_timeline_active;
+
+/**
+ * 开始记录
+ * @param events_per_thread 每个线程缓冲区的事件数，0 使用默认值；已有的缓冲区保留原容量
+ * @return 内存不足时返回 false
+ */
+bool arm64_timeline_start(size_t events_per_thread);
+
+/**
+ * 停止记录（已记录的事件保留到 arm64_timeline_clear）
+ */
+void arm64_timeline_stop(void);
+
+/**
+ * 清空所有线程缓冲区中的事件；调用时不能有线程正在记录
+ */
+void arm64_timeline_clear(void);
+
+/**
+ * 导出为 Chrome trace-event JSON
+ * @return 写入的事件数，无法写文件时返回 -1
+ */
+long arm64_timeline_export(const char *path);
+
+/**
+ * 已记录和因缓冲区满而丢弃的事件数
+ */
+void arm64_timeline_counts(uint64_t *recorded, uint64_t *dropped);
+
+/**
+ * 记录一个事件（通常通过下面的宏调用）
+ * @param phase 'B' 开始，'E' 结束
+ * @param start/end 分段范围 [start, end)（地址或偏移），都为0时不输出
+ * @param bytes/insts 处理的字节数和指令数，为0时不输出
+ */
+void arm64_timeline_record(char phase, const char *name, uint64_t start, uint64_t end,
+                           uint64_t bytes, uint64_t insts);
+
+#define ARM64_TIMELINE_BEGIN(name, start, end, bytes, insts)                            \
+    do {                                                                                \
+        if (ARM64_TIMELINE_UNLIKELY(arm64_timeline_active)) {                           \
+            arm64_timeline_record('B', (name), (start), (end), (bytes), (insts));       \
+        }                                                                               \
+    } while (0)
+
+#define ARM64_TIMELINE_END(name, start, end, bytes, insts)                              \
+    do {                                                                                \
+        if (ARM64_TIMELINE_UNLIKELY(arm64_timeline_active)) {                           \
+            arm64_timeline_record('E', (name), (start), (end), (bytes), (insts));       \
+        }                                                                               \
+    } while (0)
+
+#else
+
+#define ARM64_TIMELINE_BEGIN(name, start, end, bytes, insts) ((void)0)
+#define ARM64_TIMELINE_END(name, start, end, bytes, insts)   ((void)0)
+
+#endif /* ARM64_DISASM_FREESTANDING */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_TIMELINE_H */
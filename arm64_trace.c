@@ -0,0 +1,171 @@
+/**
+ * ARM64反汇编器 - 执行轨迹注释的地址缓存
+ */
+
+#include "arm64_trace.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#include <string.h>
+
+/* 查找 ARM64_TRACE_EMPTY 本身时返回的结果（该值未对齐，必然在映像外） */
+static const arm64_trace_entry_t empty_entry = {
+    ARM64_TRACE_EMPTY, 0, INST_TYPE_UNKNOWN, ARM64_TRACE_OUTSIDE, 0, ""
+};
+
+static void clear_slots(arm64_trace_entry_t *slots, size_t capacity) {
+    for (size_t i = 0; i < capacity; i++) {
+        memset(&slots[i], 0, sizeof(slots[i]));
+        slots[i].pc = ARM64_TRACE_EMPTY;
+        slots[i].type = INST_TYPE_UNKNOWN;
+        slots[i].flags = ARM64_TRACE_OUTSIDE;
+    }
+}
+
+static bool alloc_slots(arm64_trace_cache_t *cache, size_t capacity) {
+    unsigned bits = 0;
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    capacity = (size_t)1 << bits;
+
+    arm64_trace_entry_t *slots = arm64_alloc(cache->allocator, capacity * sizeof(*slots), 64);
+    if (!slots) {
+        return false;
+    }
+    clear_slots(slots, capacity);
+    cache->slots = slots;
+    cache->capacity = capacity;
+    cache->shift = 64 - bits;
+    return true;
+}
+
+bool arm64_trace_cache_init(arm64_trace_cache_t *cache, size_t capacity,
+                            const void *image, size_t image_size, uint64_t base,
+                            arm64_endian_t endian) {
+    return arm64_trace_cache_init_alloc(cache, capacity, image, image_size, base, endian, NULL);
+}
+
+bool arm64_trace_cache_init_alloc(arm64_trace_cache_t *cache, size_t capacity,
+                                  const void *image, size_t image_size, uint64_t base,
+                                  arm64_endian_t endian, const arm64_allocator_t *allocator) {
+    memset(cache, 0, sizeof(*cache));
+    cache->allocator = allocator ? allocator : arm64_default_allocator();
+    cache->image = (const uint8_t *)image;
+    cache->image_size = image_size;
+    cache->base = base;
+    cache->endian = endian;
+    /* 只有一个槽位时 shift 为64，移位未定义；保持至少2个槽位 */
+    return alloc_slots(cache, capacity < 2 ? 2 : capacity);
+}
+
+void arm64_trace_cache_free(arm64_trace_cache_t *cache) {
+    arm64_free(cache->allocator, cache->slots, cache->capacity * sizeof(*cache->slots));
+    cache->slots = NULL;
+    cache->capacity = 0;
+    cache->count = 0;
+}
+
+/* 槽位数加倍并重新插入全部条目 */
+static bool grow(arm64_trace_cache_t *cache) {
+    arm64_trace_entry_t *old = cache->slots;
+    size_t old_capacity = cache->capacity;
+
+    if (!alloc_slots(cache, old_capacity * 2)) {
+        return false;
+    }
+    size_t mask = cache->capacity - 1;
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old[i].pc != ARM64_TRACE_EMPTY) {
+            size_t slot = arm64_trace_slot(cache, old[i].pc);
+            while (cache->slots[slot].pc != ARM64_TRACE_EMPTY) {
+                slot = (slot + 1) & mask;
+            }
+            cache->slots[slot] = old[i];
+        }
+    }
+    arm64_free(cache->allocator, old, old_capacity * sizeof(*old));
+    cache->grows++;
+    return true;
+}
+
+/* 从映像读取并解码 pc 处的指令 */
+static void fill_entry(const arm64_trace_cache_t *cache, uint64_t pc, arm64_trace_entry_t *e) {
+    disasm_inst_t inst;
+    uint64_t offset = pc - cache->base;
+
+    memset(e, 0, sizeof(*e));
+    e->pc = pc;
+    e->type = INST_TYPE_UNKNOWN;
+    if (pc < cache->base || (pc & 3) != 0 || offset > cache->image_size ||
+        cache->image_size - offset < 4) {
+        e->flags = ARM64_TRACE_OUTSIDE;
+        return;
+    }
+
+    arm64_load_words(cache->image + offset, 4, cache->endian, &e->raw);
+    if (disassemble_arm64(e->raw, pc, &inst)) {
+        e->flags = ARM64_TRACE_VALID;
+        e->type = (uint16_t)inst.type;
+    }
+    format_instruction(&inst, e->text, sizeof(e->text));
+    e->text_len = (uint8_t)strlen(e->text);
+}
+
+const arm64_trace_entry_t *arm64_trace_lookup_slow(arm64_trace_cache_t *cache, uint64_t pc) {
+    if (pc == ARM64_TRACE_EMPTY) {
+        return &empty_entry;
+    }
+
+    size_t mask = cache->capacity - 1;
+    size_t home = arm64_trace_slot(cache, pc);
+    size_t slot = (home + 1) & mask;
+    uint64_t probes = 1;
+
+    if (cache->slots[home].pc == pc) {
+        cache->probes += probes;
+        return &cache->slots[home];
+    }
+
+    /* 首个探测位置被其他 PC 占用时沿探测链查找，否则直接插入首个探测位置 */
+    if (cache->slots[home].pc != ARM64_TRACE_EMPTY) {
+        while (cache->slots[slot].pc != ARM64_TRACE_EMPTY) {
+            probes++;
+            if (cache->slots[slot].pc == pc) {
+                /*
+                 * 与首个探测位置交换：线性探测链中首位到 slot 之间没有空槽位，
+                 * 被换出的条目仍在其自身的探测链上，因此不破坏查找
+                 */
+                arm64_trace_entry_t tmp = cache->slots[home];
+                cache->slots[home] = cache->slots[slot];
+                cache->slots[slot] = tmp;
+                cache->probes += probes;
+                return &cache->slots[home];
+            }
+            slot = (slot + 1) & mask;
+        }
+        probes++;
+    } else {
+        slot = home;
+    }
+    cache->probes += probes;
+    cache->misses++;
+
+    /* 装载率超过3/4时扩容，之后重新定位空槽位 */
+    if ((cache->count + 1) * 4 > cache->capacity * 3) {
+        if (!grow(cache)) {
+            return NULL;
+        }
+        mask = cache->capacity - 1;
+        slot = arm64_trace_slot(cache, pc);
+        while (cache->slots[slot].pc != ARM64_TRACE_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    fill_entry(cache, pc, &cache->slots[slot]);
+    cache->count++;
+    return &cache->slots[slot];
+}
+
+#endif /* ARM64_DISASM_FREESTANDING */
@@ -0,0 +1,111 @@
+/**
+ * ARM64反汇编器 - 执行轨迹注释
+ * 以 PC 为键的开放寻址缓存（线性探测），保存每个地址已解码和格式化的结果；
+ * 未命中时从映像中读取指令字解码。查找命中链中非首位的条目时与首位交换，
+ * 热点地址很快停留在各自的首个探测位置，稳定状态下每次查找只需一次探测
+ */
+
+#ifndef ARM64_TRACE_H
+#define ARM64_TRACE_H
+
+#include "arm64_disasm.h"
+#include "arm64_alloc.h"
+
+#ifndef ARM64_DISASM_FREESTANDING
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 条目中格式化文本的容量（超出部分截断） */
+#define ARM64_TRACE_TEXT_SIZE   48
+
+/* 空槽位的键（合法 PC 按4字节对齐，不会等于此值） */
+#define ARM64_TRACE_EMPTY       UINT64_MAX
+
+/* 条目标志 */
+#define ARM64_TRACE_VALID       0x01    // 解码成功
+#define ARM64_TRACE_OUTSIDE     0x02    // PC 不在映像范围内或未按4字节对齐
+
+/* 缓存条目（64字节，一个缓存行） */
+typedef struct {
+    uint64_t pc;
+    uint32_t raw;
+    uint16_t type;                      // inst_type_t
+    uint8_t flags;                      // ARM64_TRACE_* 组合
+    uint8_t text_len;
+    char text[ARM64_TRACE_TEXT_SIZE];   // format_instruction 的结果
+} arm64_trace_entry_t;
+
+/* 地址缓存 */
+typedef struct {
+    arm64_trace_entry_t *slots;
+    size_t capacity;                    // 槽位数（2的幂）
+    unsigned shift;                     // 64 - log2(capacity)
+    size_t count;
+    const uint8_t *image;
+    size_t image_size;
+    uint64_t base;                      // 映像第一个字节的地址
+    arm64_endian_t endian;
+    const arm64_allocator_t *allocator; // 槽位数组的来源
+    uint64_t lookups;
+    uint64_t misses;                    // 需要解码的查找
+    uint64_t probes;                    // 慢路径中的探测次数
+    uint64_t grows;
+} arm64_trace_cache_t;
+
+/**
+ * 初始化缓存
+ * @param capacity 初始槽位数（向上取为2的幂，装载率超过3/4时加倍）
+ * @param image 映像数据（由调用者保持有效，通常为文件映射）
+ * @param base 映像第一个字节对应的地址
+ * @return 成功返回true，内存不足返回false
+ */
+bool arm64_trace_cache_init(arm64_trace_cache_t *cache, size_t capacity,
+                            const void *image, size_t image_size, uint64_t base,
+                            arm64_endian_t endian);
+
+/**
+ * 使用指定分配器初始化缓存（如区域分配器或大页分配器），NULL 使用默认分配器
+ * 槽位数组按缓存行对齐分配，扩容时整体重新分配
+ */
+bool arm64_trace_cache_init_alloc(arm64_trace_cache_t *cache, size_t capacity,
+                                  const void *image, size_t image_size, uint64_t base,
+                                  arm64_endian_t endian, const arm64_allocator_t *allocator);
+
+/**
+ * 释放缓存
+ */
+void arm64_trace_cache_free(arm64_trace_cache_t *cache);
+
+/**
+ * 查找未命中首个探测位置时的慢路径（线性探测、解码插入）
+ */
+const arm64_trace_entry_t *arm64_trace_lookup_slow(arm64_trace_cache_t *cache, uint64_t pc);
+
+/* PC 的首个探测位置 */
+static inline size_t arm64_trace_slot(const arm64_trace_cache_t *cache, uint64_t pc) {
+    return (size_t)(((pc >> 2) * 0x9E3779B97F4A7C15ull) >> cache->shift);
+}
+
+/**
+ * 查找 PC 对应的条目，未缓存时解码并插入
+ * 内存不足无法扩容时返回 NULL
+ */
+static inline const arm64_trace_entry_t *arm64_trace_lookup(arm64_trace_cache_t *cache,
+                                                           uint64_t pc) {
+    const arm64_trace_entry_t *e = &cache->slots[arm64_trace_slot(cache, pc)];
+    cache->lookups++;
+    if (e->pc == pc) {
+        return e;
+    }
+    return arm64_trace_lookup_slow(cache, pc);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARM64_DISASM_FREESTANDING */
+
+#endif /* ARM64_TRACE_H */
@@ -0,0 +1,306 @@
+/**
+ * ARM64执行轨迹注释工具
+ * 读取地址轨迹（二进制 64 位小端 PC 序列，或每行一个十六进制地址的文本），
+ * 为每个 PC 输出反汇编结果；同一地址只解码一次
+ *
+ * 用法：arm64_trace [-b 映像基址] [-E] [-f bin|text] [-c 初始缓存槽位] [-s] [-T 时间线] 映像 [轨迹|-]
+ */
+
+#include "arm64_elf.h"
+#include "arm64_trace.h"
+#include "arm64_timeline.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* 输入/输出缓冲区大小 */
+#define IO_BUFFER_SIZE (1u << 20)
+
+/* 一行输出的最大长度："0x" + 16位地址 + 2 + 8位编码 + 2 + 文本 + 换行 */
+#define MAX_LINE (2 + 16 + 2 + 8 + 2 + ARM64_TRACE_TEXT_SIZE + 1)
+
+/* ========== 输出 ========== */
+
+typedef struct {
+    char *buf;
+    size_t len;
+    FILE *out;
+} writer_t;
+
+static void writer_flush(writer_t *w) {
+    ARM64_TIMELINE_BEGIN("write", 0, 0, w->len, 0);
+    fwrite(w->buf, 1, w->len, w->out);
+    ARM64_TIMELINE_END("write", 0, 0, w->len, 0);
+    w->len = 0;
+}
+
+static const char hex_digits[] = "0123456789abcdef";
+
+static char *put_hex(char *p, uint64_t value, int digits) {
+    for (int i = digits - 1; i >= 0; i--) {
+        p[i] = hex_digits[value & 0xF];
+        value >>= 4;
+    }
+    return p + digits;
+}
+
+/* 输出一行："0x<pc>  <编码>  <文本>" */
+static void write_entry(writer_t *w, uint64_t pc, const arm64_trace_entry_t *e) {
+    if (w->len + MAX_LINE > IO_BUFFER_SIZE) {
+        writer_flush(w);
+    }
+    char *p = w->buf + w->len;
+    *p++ = '0';
+    *p++ = 'x';
+    p = put_hex(p, pc, 16);
+    *p++ = ' ';
+    *p++ = ' ';
+    if (e && !(e->flags & ARM64_TRACE_OUTSIDE)) {
+        p = put_hex(p, e->raw, 8);
+        *p++ = ' ';
+        *p++ = ' ';
+        memcpy(p, e->text, e->text_len);
+        p += e->text_len;
+    } else {
+        static const char outside[] = "<outside image>";
+        memcpy(p, outside, sizeof(outside) - 1);
+        p += sizeof(outside) - 1;
+    }
+    *p++ = '\n';
+    w->len = (size_t)(p - w->buf);
+}
+
+/* ========== 轨迹输入 ========== */
+
+/* 解析一行中的第一个十六进制数（可带 0x 前缀，前导空白忽略）；没有数字时返回 false */
+static bool parse_hex(const char *p, const char *end, uint64_t *value) {
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+    if (end - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        p += 2;
+    }
+    uint64_t v = 0;
+    const char *start = p;
+    for (; p < end; p++) {
+        unsigned d;
+        if (*p >= '0' && *p <= '9') {
+            d = (unsigned)(*p - '0');
+        } else if (*p >= 'a' && *p <= 'f') {
+            d = (unsigned)(*p - 'a' + 10);
+        } else if (*p >= 'A' && *p <= 'F') {
+            d = (unsigned)(*p - 'A' + 10);
+        } else {
+            break;
+        }
+        v = (v << 4) | d;
+    }
+    *value = v;
+    return p > start;
+}
+
+static uint64_t trace_binary(FILE *in, arm64_trace_cache_t *cache, writer_t *w) {
+    uint8_t *buf = malloc(IO_BUFFER_SIZE);
+    size_t carry = 0;
+    uint64_t n = 0;
+    uint64_t offset = 0;            // 当前分段在轨迹输入中的偏移
+
+    for (;;) {
+        ARM64_TIMELINE_BEGIN("read", offset, 0, 0, 0);
+        size_t got = fread(buf + carry, 1, IO_BUFFER_SIZE - carry, in);
+        ARM64_TIMELINE_END("read", offset, offset + got, got, 0);
+        offset += got;
+        size_t avail = carry + got;
+        size_t i = 0;
+        uint64_t first = n;
+        ARM64_TIMELINE_BEGIN("annotate", 0, 0, avail, 0);
+        for (; i + 8 <= avail; i += 8) {
+            const uint8_t *b = buf + i;
+            uint64_t pc = (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 |
+                          (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 |
+                          (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+            write_entry(w, pc, arm64_trace_lookup(cache, pc));
+            n++;
+        }
+        ARM64_TIMELINE_END("annotate", 0, 0, i, n - first);
+        carry = avail - i;
+        memmove(buf, buf + i, carry);
+        if (got == 0) {
+            break;
+        }
+    }
+    free(buf);
+    return n;
+}
+
+static uint64_t trace_text(FILE *in, arm64_trace_cache_t *cache, writer_t *w) {
+    char *buf = malloc(IO_BUFFER_SIZE);
+    size_t carry = 0;
+    uint64_t n = 0;
+    uint64_t offset = 0;
+
+    for (;;) {
+        ARM64_TIMELINE_BEGIN("read", offset, 0, 0, 0);
+        size_t got = fread(buf + carry, 1, IO_BUFFER_SIZE - carry, in);
+        ARM64_TIMELINE_END("read", offset, offset + got, got, 0);
+        offset += got;
+        size_t avail = carry + got;
+        char *line = buf;
+        char *end = buf + avail;
+        uint64_t first = n;
+        ARM64_TIMELINE_BEGIN("annotate", 0, 0, avail, 0);
+        for (;;) {
+            char *nl = memchr(line, '\n', (size_t)(end - line));
+            if (!nl) {
+                /* 输入结束时最后一行可以没有换行；行长超过缓冲区时丢弃 */
+                if (got == 0 || line == buf) {
+                    nl = end;
+                } else {
+                    break;
+                }
+            }
+            uint64_t pc;
+            if (line < nl && line[0] != '#' && parse_hex(line, nl, &pc)) {
+                write_entry(w, pc, arm64_trace_lookup(cache, pc));
+                n++;
+            }
+            line = nl < end ? nl + 1 : end;
+            if (line >= end) {
+                break;
+            }
+        }
+        ARM64_TIMELINE_END("annotate", 0, 0, (uint64_t)(line - buf), n - first);
+        carry = (size_t)(end - line);
+        memmove(buf, line, carry);
+        if (got == 0) {
+            break;
+        }
+    }
+    free(buf);
+    return n;
+}
+
+/* ========== 主程序 ========== */
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "用法: %s [-b 映像基址] [-E] [-f bin|text] [-c 初始缓存槽位] [-s] [-T 时间线] 映像 [轨迹|-]\n"
+            "  -b  映像第一个字节的地址（默认0）\n"
+            "  -E  映像中的指令为大端\n"
+            "  -f  轨迹格式：bin 为64位小端PC序列，text 为每行一个十六进制地址（默认按扩展名 .txt 判断）\n"
+            "  -c  初始缓存槽位数（默认65536，装载率超过3/4时加倍）\n"
+            "  -s  结束时向标准错误输出缓存统计\n"
+            "  -T  记录各阶段的时间线，结束时写成 Chrome trace-event JSON\n",
+            prog);
+}
+
+int main(int argc, char *argv[]) {
+    uint64_t base = 0;
+    arm64_endian_t endian = ARM64_ENDIAN_LITTLE;
+    const char *format = NULL;
+    size_t capacity = 65536;
+    bool stats = false;
+    const char *timeline_path = NULL;
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "-b") == 0 && has_value) {
+            base = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-E") == 0) {
+            endian = ARM64_ENDIAN_BIG;
+        } else if (strcmp(arg, "-f") == 0 && has_value) {
+            format = argv[++i];
+        } else if (strcmp(arg, "-c") == 0 && has_value) {
+            capacity = (size_t)strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-s") == 0) {
+            stats = true;
+        } else if (strcmp(arg, "-T") == 0 && has_value) {
+            timeline_path = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (i >= argc || argc - i > 2) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    const char *image_path = argv[i];
+    const char *trace_path = i + 1 < argc ? argv[i + 1] : "-";
+    if (!format) {
+        size_t len = strlen(trace_path);
+        format = (len > 4 && strcmp(trace_path + len - 4, ".txt") == 0) ? "text" : "bin";
+    }
+    bool text = strcmp(format, "text") == 0;
+    if (!text && strcmp(format, "bin") != 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    if (timeline_path && !arm64_timeline_start(0)) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+
+    arm64_image_t img;
+    ARM64_TIMELINE_BEGIN("load_image", 0, 0, 0, 0);
+    if (!arm64_image_open(&img, image_path)) {
+        perror(image_path);
+        return 1;
+    }
+    ARM64_TIMELINE_END("load_image", base, base + img.size, img.size, 0);
+    FILE *in = strcmp(trace_path, "-") == 0 ? stdin : fopen(trace_path, text ? "r" : "rb");
+    if (!in) {
+        perror(trace_path);
+        arm64_image_close(&img);
+        return 1;
+    }
+
+    arm64_trace_cache_t cache;
+    writer_t w = { malloc(IO_BUFFER_SIZE), 0, stdout };
+    if (!w.buf || !arm64_trace_cache_init(&cache, capacity, img.data, img.size, base, endian)) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+
+    clock_t start = clock();
+    uint64_t n = text ? trace_text(in, &cache, &w) : trace_binary(in, &cache, &w);
+    writer_flush(&w);
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if (stats) {
+        fprintf(stderr,
+                "轨迹: %llu 条, %.3f 秒 (%.1f ns/条)\n"
+                "缓存: %zu 个地址 / %zu 槽位, 扩容 %llu 次\n"
+                "查找: 未命中 %llu (%.4f%%), 慢路径探测 %llu\n",
+                (unsigned long long)n, elapsed, n ? elapsed * 1e9 / (double)n : 0.0,
+                cache.count, cache.capacity, (unsigned long long)cache.grows,
+                (unsigned long long)cache.misses,
+                cache.lookups ? 100.0 * (double)cache.misses / (double)cache.lookups : 0.0,
+                (unsigned long long)cache.probes);
+    }
+
+    if (timeline_path) {
+        uint64_t dropped;
+        arm64_timeline_stop();
+        arm64_timeline_counts(NULL, &dropped);
+        if (arm64_timeline_export(timeline_path) < 0) {
+            perror(timeline_path);
+        } else if (dropped) {
+            fprintf(stderr, "时间线: 缓冲区已满，丢弃 %llu 个事件\n", (unsigned long long)dropped);
+        }
+    }
+
+    arm64_trace_cache_free(&cache);
+    free(w.buf);
+    if (in != stdin) {
+        fclose(in);
+    }
+    arm64_image_close(&img);
+    return 0;
+}
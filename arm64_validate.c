@@ -0,0 +1,426 @@
+/**
+ * ARM64反汇编器 - JIT代码校验
+ * 单遍检查代码缓冲区是否符合策略：指令类型白名单、禁止的系统指令、
+ * 直接分支目标范围、保留寄存器写入
+ */
+
+#include "arm64_disasm.h"
+#include "arm64_decode_table.h"
+#include "arm64_fast_class.h"
+
+/* ========== 快速分类索引 ========== */
+
+/*
+ * fast_index 项的编码：
+ *   最高位为0：整个索引范围只匹配一个（或策略下等价的一组）允许的条目，
+ *             低8位为写寄存器规则，位[10:8]为分支种类
+ *   FAST_SCAN | n：需要从第 n 个条目开始按顺序扫描分类表
+ *   FAST_SLOW：没有候选条目，直接完整解码
+ */
+#define FAST_SCAN       0x8000
+#define FAST_SLOW       0xFFFF
+#define FAST_PACK(entry) ((uint16_t)((entry)->writes | ((entry)->branch << 8)))
+
+typedef char fast_class_table_fits[(ARRAY_SIZE(fast_class_table) < 0x7FFF) ? 1 : -1];
+
+/* ========== 禁止的指令 ========== */
+
+/* 特权/系统状态相关的指令，与类型白名单无关，始终拒绝 */
+static const struct {
+    uint32_t mask;
+    uint32_t value;
+} forbidden_table[] = {
+    { 0xFF000000, 0xD4000000 },     /* 异常生成：SVC/HVC/SMC/BRK/HLT/DCPS */
+    { 0xFFF00000, 0xD5100000 },     /* MSR (register) */
+    { 0xFFF8F01F, 0xD500401F },     /* MSR (immediate)：PSTATE */
+    { 0xFFD80000, 0xD5080000 },     /* SYS/SYSL：缓存/TLB维护等 */
+    { 0xFFDFFFFF, 0xD69F03E0 },     /* ERET/DRPS */
+};
+
+static bool is_forbidden(uint32_t raw) {
+    for (size_t i = 0; i < ARRAY_SIZE(forbidden_table); i++) {
+        if ((raw & forbidden_table[i].mask) == forbidden_table[i].value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* BRK 没有对应的指令类型，由 ARM64_VALIDATE_ALLOW_BRK 单独控制 */
+static inline bool is_brk(uint32_t raw) {
+    return (raw & 0xFFE0001F) == 0xD4200000;
+}
+
+/* ========== 策略 ========== */
+
+/**
+ * 两个条目在策略下是否等价（允许与否、写寄存器规则、分支种类都相同）
+ */
+static bool fast_class_equivalent(const arm64_validate_policy_t *policy,
+                                  const fast_class_t *a, const fast_class_t *b) {
+    return a->writes == b->writes && a->branch == b->branch &&
+           inst_type_set_contains(&policy->allowed, (inst_type_t)a->type) ==
+           inst_type_set_contains(&policy->allowed, (inst_type_t)b->type);
+}
+
+/**
+ * 索引范围（指令位[31:21]相同的所有指令字）是否可能包含禁止的指令
+ */
+static bool key_may_be_forbidden(uint32_t top) {
+    for (size_t i = 0; i < ARRAY_SIZE(forbidden_table); i++) {
+        if ((top & forbidden_table[i].mask & 0xFFE00000) ==
+            (forbidden_table[i].value & 0xFFE00000)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 生成按指令位[31:21]索引的快速分类索引
+ * 某个索引下第一个不依赖低21位的候选条目之前，所有候选在策略下都与它等价且类型被允许时，
+ * 该索引直接给出写寄存器规则和分支种类；否则记录第一个候选，校验时从它开始扫描
+ */
+void arm64_validate_policy_compile(arm64_validate_policy_t *policy) {
+    for (uint32_t key = 0; key < ARM64_VALIDATE_INDEX_SIZE; key++) {
+        uint32_t top = key << 21;
+        const fast_class_t *first = NULL;
+        uint16_t slot = FAST_SLOW;
+
+        for (size_t i = 0; i < ARRAY_SIZE(fast_class_table); i++) {
+            const fast_class_t *entry = &fast_class_table[i];
+            if ((top & entry->mask & 0xFFE00000) != (entry->value & 0xFFE00000)) {
+                continue;
+            }
+            if (!first) {
+                first = entry;
+                slot = (uint16_t)(FAST_SCAN | i);
+                if (key_may_be_forbidden(top) ||
+                    !inst_type_set_contains(&policy->allowed, (inst_type_t)entry->type)) {
+                    break;
+                }
+            }
+            if (!fast_class_equivalent(policy, entry, first)) {
+                break;
+            }
+            if ((entry->mask & 0x001FFFFF) == 0) {
+                slot = FAST_PACK(first);
+                break;
+            }
+        }
+        policy->fast_index[key] = slot;
+    }
+}
+
+/**
+ * 初始化默认策略：允许除系统寄存器访问外的所有已知类型，不保留寄存器，不允许间接分支
+ */
+void arm64_validate_policy_init(arm64_validate_policy_t *policy) {
+    ARM64_MEMSET(policy, 0, sizeof(*policy));
+    for (int type = INST_TYPE_UNKNOWN + 1; type < INST_TYPE_COUNT; type++) {
+        inst_type_set_add(&policy->allowed, (inst_type_t)type);
+    }
+    inst_type_set_remove(&policy->allowed, INST_TYPE_MRS);
+    inst_type_set_remove(&policy->allowed, INST_TYPE_MSR);
+    inst_type_set_remove(&policy->allowed, INST_TYPE_SVC);
+    inst_type_set_remove(&policy->allowed, INST_TYPE_HVC);
+    inst_type_set_remove(&policy->allowed, INST_TYPE_SMC);
+    arm64_validate_policy_compile(policy);
+}
+
+/* ========== 校验 ========== */
+
+/* 各分支种类的偏移字段：先左移 lsh 再算术右移 rsh 得到带符号的指令偏移 */
+static const struct {
+    uint8_t lsh;
+    uint8_t rsh;
+    uint8_t direct;
+} branch_field[8] = {
+    [VB_IMM26] = { 6, 6, 1 },
+    [VB_IMM19] = { 8, 13, 1 },
+    [VB_IMM14] = { 13, 18, 1 },
+};
+
+/* 由布尔值生成全1/全0掩码 */
+#define MASK_IF(cond)   (0u - (uint32_t)((cond) != 0))
+
+/**
+ * 按写寄存器规则计算被写入的通用寄存器集合（bit 31 为 SP）
+ * 不含条件分支，避免混合指令流中的分支预测失败
+ */
+static inline uint32_t fast_written_regs(uint32_t raw, uint8_t writes) {
+    uint32_t rd = 1u << (raw & 0x1F);
+    uint32_t rt2 = (1u << ((raw >> 10) & 0x1F)) & 0x7FFFFFFF;
+    uint32_t rn = 1u << ((raw >> 5) & 0x1F);
+
+    return (rd & ((MASK_IF(writes & VW_RD) & 0x7FFFFFFF) | MASK_IF(writes & VW_RD_SP))) |
+           (rt2 & MASK_IF(writes & VW_RT2)) |
+           (rn & MASK_IF(writes & VW_RN_WB)) |
+           ((uint32_t)(writes & VW_LR) << 26);
+}
+
+/**
+ * 分支目标下标（相对于缓冲区起始，按指令计）；非直接分支返回指令自身的下标
+ */
+static inline int64_t fast_branch_target(uint32_t raw, uint8_t branch, size_t index) {
+    int32_t offset = (int32_t)(raw << branch_field[branch].lsh) >> branch_field[branch].rsh;
+    return (int64_t)index + (offset & (int32_t)MASK_IF(branch_field[branch].direct));
+}
+
+/**
+ * 完整解码路径：从操作数列表提取写入的通用寄存器
+ */
+static uint32_t decoded_written_regs(const disasm_inst_t *inst) {
+    uint32_t regs = 0;
+
+    for (uint8_t i = 0; i < inst->operand_count; i++) {
+        const disasm_operand_t *op = &inst->operands[i];
+        if (op->kind == OPERAND_REG && (op->access & OPERAND_ACCESS_WRITE)) {
+            if (op->reg.type == REG_TYPE_SP) {
+                regs |= 1u << 31;
+            } else if ((op->reg.type == REG_TYPE_X || op->reg.type == REG_TYPE_W) &&
+                       op->reg.num != 31) {
+                regs |= 1u << op->reg.num;
+            }
+        } else if (op->kind == OPERAND_MEM && op->mem.writeback) {
+            regs |= 1u << op->mem.base;
+        }
+    }
+    if (inst->type == INST_TYPE_BL || inst->type == INST_TYPE_BLR) {
+        regs |= 1u << 30;
+    }
+    return regs;
+}
+
+static inline arm64_validate_result_t fail(arm64_validate_report_t *report,
+                                           arm64_validate_result_t result,
+                                           size_t index, uint32_t raw) {
+    if (report) {
+        report->result = result;
+        report->index = index;
+        report->raw = raw;
+    }
+    return result;
+}
+
+/**
+ * 校验分支：间接分支按策略放行，直接分支目标必须在缓冲区内
+ */
+static inline bool branch_allowed(uint32_t flags, uint8_t branch, bool is_call,
+                                  int64_t target, size_t count) {
+    if (branch == VB_INDIRECT) {
+        return (flags & ARM64_VALIDATE_ALLOW_INDIRECT) != 0;
+    }
+    if (is_call && (flags & ARM64_VALIDATE_ALLOW_EXTERNAL_CALL)) {
+        return true;
+    }
+    return target >= 0 && target < (int64_t)count;
+}
+
+/**
+ * 从第 start 个条目开始按顺序扫描快速分类表
+ */
+static const fast_class_t *fast_classify_from(uint32_t raw, size_t start) {
+    for (size_t i = start; i < ARRAY_SIZE(fast_class_table); i++) {
+        if ((raw & fast_class_table[i].mask) == fast_class_table[i].value) {
+            return &fast_class_table[i];
+        }
+    }
+    return NULL;
+}
+
+/* ========== 快速分类的候选范围 ========== */
+
+/*
+ * 每个索引（指令位[31:21]）下可能匹配的条目都在 [first, end) 之内，arm64_fast_classify
+ * 只扫描这一段。首次调用时生成；生成期间（或没有原子操作的编译器上）扫描整个表
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define FAST_RANGES 1
+#endif
+
+#if FAST_RANGES
+static uint16_t fast_range_first[ARM64_VALIDATE_INDEX_SIZE];
+static uint16_t fast_range_end[ARM64_VALIDATE_INDEX_SIZE];
+static int fast_range_state;        /* 0：未生成，1：生成中，2：可用 */
+
+static void build_fast_ranges(void) {
+    for (uint32_t key = 0; key < ARM64_VALIDATE_INDEX_SIZE; key++) {
+        uint32_t top = key << 21;
+        uint16_t first = 0, end = 0;
+        for (size_t i = 0; i < ARRAY_SIZE(fast_class_table); i++) {
+            const fast_class_t *entry = &fast_class_table[i];
+            if ((top & entry->mask & 0xFFE00000) == (entry->value & 0xFFE00000)) {
+                if (end == 0) {
+                    first = (uint16_t)i;
+                }
+                end = (uint16_t)(i + 1);
+            }
+        }
+        fast_range_first[key] = first;
+        fast_range_end[key] = end;
+    }
+}
+#endif
+
+/**
+ * 在候选范围内按顺序扫描快速分类表
+ */
+static const fast_class_t *fast_classify_indexed(uint32_t raw) {
+#if FAST_RANGES
+    int state = __atomic_load_n(&fast_range_state, __ATOMIC_ACQUIRE);
+    if (state == 0) {
+        int expected = 0;
+        if (__atomic_compare_exchange_n(&fast_range_state, &expected, 1, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            build_fast_ranges();
+            __atomic_store_n(&fast_range_state, 2, __ATOMIC_RELEASE);
+            state = 2;
+        }
+    }
+    if (state == 2) {
+        uint32_t key = raw >> 21;
+        for (size_t i = fast_range_first[key]; i < fast_range_end[key]; i++) {
+            if ((raw & fast_class_table[i].mask) == fast_class_table[i].value) {
+                return &fast_class_table[i];
+            }
+        }
+        return NULL;
+    }
+#endif
+    return fast_classify_from(raw, 0);
+}
+
+/**
+ * 按快速分类结果检查写寄存器和分支
+ */
+static inline arm64_validate_result_t validate_fast(uint32_t raw, uint8_t writes, uint8_t branch,
+                                                    size_t index, size_t count,
+                                                    const arm64_validate_policy_t *policy) {
+    if (fast_written_regs(raw, writes) & policy->reserved_regs) {
+        return ARM64_VALIDATE_RESERVED_REG;
+    }
+    if (branch != VB_NONE &&
+        !branch_allowed(policy->flags, branch, branch == VB_IMM26 && (writes & VW_LR),
+                        fast_branch_target(raw, branch, index), count)) {
+        return branch == VB_INDIRECT ? ARM64_VALIDATE_INDIRECT_BRANCH
+                                     : ARM64_VALIDATE_BRANCH_TARGET;
+    }
+    return ARM64_VALIDATE_OK;
+}
+
+/**
+ * 完整解码一条指令并按策略检查
+ */
+static arm64_validate_result_t validate_decoded(uint32_t raw, size_t index, size_t count,
+                                                const arm64_validate_policy_t *policy) {
+    disasm_inst_t inst;
+
+    /* 以缓冲区起始为地址0解码，分支目标即为字节偏移 */
+    if (!disassemble_arm64(raw, (uint64_t)index * 4, &inst)) {
+        return ARM64_VALIDATE_UNDECODED;
+    }
+    if (!inst_type_set_contains(&policy->allowed, inst.type)) {
+        return ARM64_VALIDATE_TYPE_DENIED;
+    }
+    if (decoded_written_regs(&inst) & policy->reserved_regs) {
+        return ARM64_VALIDATE_RESERVED_REG;
+    }
+
+    uint64_t target;
+    if (inst.type == INST_TYPE_BR || inst.type == INST_TYPE_BLR || inst.type == INST_TYPE_RET) {
+        if (!branch_allowed(policy->flags, VB_INDIRECT, false, 0, count)) {
+            return ARM64_VALIDATE_INDIRECT_BRANCH;
+        }
+    } else if (inst.type != INST_TYPE_ADR && inst.type != INST_TYPE_ADRP &&
+               get_branch_target(&inst, &target)) {
+        if (!branch_allowed(policy->flags, VB_IMM26, inst.type == INST_TYPE_BL,
+                            (int64_t)target / 4, count)) {
+            return ARM64_VALIDATE_BRANCH_TARGET;
+        }
+    }
+    return ARM64_VALIDATE_OK;
+}
+
+/**
+ * 快速索引未直接命中时的检查：禁止指令、扫描分类表、完整解码
+ */
+static arm64_validate_result_t validate_slow(uint32_t raw, uint16_t slot, size_t index,
+                                             size_t count, const arm64_validate_policy_t *policy) {
+    const fast_class_t *entry = NULL;
+
+    if (is_forbidden(raw)) {
+        return ((policy->flags & ARM64_VALIDATE_ALLOW_BRK) && is_brk(raw))
+               ? ARM64_VALIDATE_OK : ARM64_VALIDATE_FORBIDDEN;
+    }
+    if (slot != FAST_SLOW) {
+        entry = fast_classify_from(raw, slot & ~FAST_SCAN);
+    }
+    if (!entry) {
+        return validate_decoded(raw, index, count, policy);
+    }
+    if (!inst_type_set_contains(&policy->allowed, (inst_type_t)entry->type)) {
+        return ARM64_VALIDATE_TYPE_DENIED;
+    }
+    return validate_fast(raw, entry->writes, entry->branch, index, count, policy);
+}
+
+/**
+ * 按策略校验代码缓冲区
+ */
+arm64_validate_result_t arm64_validate(const uint32_t *code, size_t count,
+                                       const arm64_validate_policy_t *policy,
+                                       arm64_validate_report_t *report) {
+    if (report) {
+        report->result = ARM64_VALIDATE_OK;
+        report->index = 0;
+        report->raw = 0;
+    }
+    if (!policy || (!code && count)) {
+        return fail(report, ARM64_VALIDATE_UNDECODED, 0, 0);
+    }
+
+    bool allow_indirect = (policy->flags & ARM64_VALIDATE_ALLOW_INDIRECT) != 0;
+    bool allow_external = (policy->flags & ARM64_VALIDATE_ALLOW_EXTERNAL_CALL) != 0;
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t raw = code[i];
+        uint16_t slot = policy->fast_index[raw >> 21];
+        arm64_validate_result_t result;
+
+        if (!(slot & FAST_SCAN)) {
+            /* 直接命中：先无分支地判断是否违规，违规时再确定原因 */
+            uint8_t writes = (uint8_t)slot;
+            uint8_t branch = (uint8_t)(slot >> 8);
+            uint64_t target = (uint64_t)fast_branch_target(raw, branch, i);
+            bool external = (branch == VB_IMM26) & ((writes & VW_LR) != 0) & allow_external;
+            bool bad = ((fast_written_regs(raw, writes) & policy->reserved_regs) != 0) |
+                       ((target >= count) & !external) |
+                       ((branch == VB_INDIRECT) & !allow_indirect);
+            if (!bad) {
+                continue;
+            }
+            result = validate_fast(raw, writes, branch, i, count, policy);
+        } else {
+            result = validate_slow(raw, slot, i, count, policy);
+        }
+        if (result != ARM64_VALIDATE_OK) {
+            return fail(report, result, i, raw);
+        }
+    }
+    return ARM64_VALIDATE_OK;
+}
+
+/**
+ * 快速分类单条指令（不完整解码）
+ */
+bool arm64_fast_classify(uint32_t raw, inst_type_t *type) {
+    const fast_class_t *entry = fast_classify_indexed(raw);
+    if (!entry) {
+        return false;
+    }
+    if (type) {
+        *type = (inst_type_t)entry->type;
+    }
+    return true;
+}
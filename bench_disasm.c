@@ -0,0 +1,1148 @@
+/**
+ * ARM64反汇编器性能测试
+ * 报告当前指令组配置（CMake 选项 ARM64_DISASM_GROUP_*）下的库大小和解码速度，
+ * 以及 Capstone 兼容接口相对直接调用的开销、不同分配器下的分配统计；
+ * Linux 上用 perf_event_open 统计各阶段的周期、指令、分支失误和 L1 缓存未命中
+ * （容器中计数器常不可用，此时只报告耗时）
+ *
+ * 用法：bench_disasm [迭代次数]
+ */
+
+#include "arm64_disasm.h"
+#include "arm64_capstone.h"
+#include "arm64_trace.h"
+#include "arm64_alloc.h"
+#include "arm64_listing.h"
+#include "arm64_peephole.h"
+#ifdef ARM64_DISASM_HAVE_GZIP
+    #include "arm64_gzsink.h"
+    #include <zlib.h>
+#endif
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#if !defined(_WIN32)
+    #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+    #include <errno.h>
+    #include <unistd.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <linux/perf_event.h>
+    #define HAVE_PERF_EVENT 1
+#endif
+
+#ifndef ARM64_DISASM_LIBRARY_PATH
+#define ARM64_DISASM_LIBRARY_PATH ""
+#endif
+
+/* 各基准循环的校验和写入此处，防止编译器把循环整体优化掉 */
+static volatile uint64_t bench_sink;
+
+/* 典型函数的指令组成：函数序言/尾声、地址计算、循环、少量原子和浮点运算 */
+static const uint32_t mixed_corpus[] = {
+    0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+    0x910003FD,  // mov x29, sp
+    0xF9400421,  // ldr x1, [x1, #8]
+    0xB9400000,  // ldr w0, [x0]
+    0x90000000,  // adrp x0, <label>
+    0x91000420,  // add x0, x1, #1
+    0x8B000020,  // add x0, x1, x0
+    0xEB00003F,  // cmp x1, x0
+    0x54000040,  // b.eq <label+8>
+    0xD2800020,  // movz x0, #1
+    0xAA0003E0,  // mov x0, x0
+    0x9B007C20,  // mul x0, x1, x0
+    0x1A9F07E0,  // cset w0, ne
+    0xB4000040,  // cbz x0, <label+8>
+    0x94000000,  // bl <label>
+    0xF9000000,  // str x0, [x0]
+    0xF8606820,  // ldr x0, [x1, x0]
+    0x885F7C20,  // ldxr w0, [x1]
+    0xB8200020,  // ldadd w0, w0, [x1]
+    0x1E622820,  // fadd d0, d1, d2
+    0x1E620820,  // fmul d0, d1, d2
+    0xD503201F,  // nop
+    0xD53B4200,  // mrs x0, NZCV
+    0xA8C17BFD,  // ldp x29, x30, [sp], #16
+    0xD65F03C0,  // ret
+};
+
+#define MIXED_COUNT (sizeof(mixed_corpus) / sizeof(mixed_corpus[0]))
+#define RANDOM_COUNT 4096
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static long file_size(const char *path) {
+    struct stat st;
+    if (path[0] == '\0' || stat(path, &st) != 0) {
+        return -1;
+    }
+    return (long)st.st_size;
+}
+
+/**
+ * 反汇编并格式化整个语料若干遍，返回每条指令的平均纳秒数
+ * @param decoded 输出：单遍中成功解码的指令数
+ */
+static double bench_corpus(const uint32_t *corpus, size_t count, int iterations,
+                           size_t *decoded) {
+    disasm_inst_t inst;
+    char buffer[128];
+    size_t ok = 0;
+    uint64_t checksum = 0;
+
+    double start = now_seconds();
+    for (int it = 0; it < iterations; it++) {
+        for (size_t i = 0; i < count; i++) {
+            if (disassemble_arm64(corpus[i], 0x400000 + i * 4, &inst)) {
+                format_instruction(&inst, buffer, sizeof(buffer));
+                checksum += (uint8_t)buffer[0];
+                if (it == 0) {
+                    ok++;
+                }
+            }
+        }
+    }
+    double elapsed = now_seconds() - start;
+
+    bench_sink = checksum;
+    *decoded = ok;
+    return elapsed * 1e9 / ((double)count * iterations);
+}
+
+static void report(const char *name, const uint32_t *corpus, size_t count, int iterations) {
+    size_t decoded;
+    double ns = bench_corpus(corpus, count, iterations, &decoded);
+    printf("  %-8s %6zu 条  已解码 %5.1f%%  %7.1f ns/条  %7.2f M条/秒\n",
+           name, count, 100.0 * (double)decoded / (double)count, ns, 1e3 / ns);
+}
+
+/**
+ * 通过 Capstone 兼容接口（cs_disasm_iter）反汇编整个语料若干遍，返回每条指令的平均纳秒数
+ * 语料按小端字节序给出；遇到未分配编码时跳过4字节继续
+ */
+static double bench_capstone(const uint32_t *corpus, size_t count, int iterations, bool detail) {
+    csh handle;
+    if (cs_open(CS_ARCH_ARM64, CS_MODE_LITTLE_ENDIAN, &handle) != CS_ERR_OK) {
+        return 0.0;
+    }
+    cs_option(handle, CS_OPT_DETAIL, detail ? CS_OPT_ON : CS_OPT_OFF);
+    cs_insn *insn = cs_malloc(handle);
+    uint64_t checksum = 0;
+
+    double start = now_seconds();
+    for (int it = 0; it < iterations; it++) {
+        const uint8_t *code = (const uint8_t *)corpus;
+        size_t size = count * 4;
+        uint64_t address = 0x400000;
+        while (size >= 4) {
+            if (cs_disasm_iter(handle, &code, &size, &address, insn)) {
+                checksum += (uint8_t)insn->mnemonic[0];
+            } else {
+                code += 4;
+                size -= 4;
+                address += 4;
+            }
+        }
+    }
+    double elapsed = now_seconds() - start;
+
+    bench_sink = checksum;
+    cs_free(insn, 1);
+    cs_close(&handle);
+    return elapsed * 1e9 / ((double)count * iterations);
+}
+
+static void report_capstone(const char *name, const uint32_t *corpus, size_t count,
+                            int iterations) {
+    size_t decoded;
+    double direct = bench_corpus(corpus, count, iterations, &decoded);
+    double shim = bench_capstone(corpus, count, iterations, false);
+    double shim_detail = bench_capstone(corpus, count, iterations, true);
+    printf("  %-8s 直接 %7.1f ns/条  cs_disasm_iter %7.1f ns/条 (%+.0f%%)  含细节 %7.1f ns/条 (%+.0f%%)\n",
+           name, direct, shim, 100.0 * (shim - direct) / direct,
+           shim_detail, 100.0 * (shim_detail - direct) / direct);
+}
+
+/**
+ * 模拟执行轨迹：语料作为映像，按循环访问其中的地址，比较缓存查找与每次重新解码格式化
+ * 轨迹中每个地址出现 iterations 次，稳定状态下每次查找只探测一次
+ */
+static void report_trace(const char *name, const uint32_t *corpus, size_t count,
+                         int iterations) {
+    arm64_trace_cache_t cache;
+    if (!arm64_trace_cache_init(&cache, 1024, corpus, count * 4, 0x400000,
+                                ARM64_ENDIAN_LITTLE)) {
+        return;
+    }
+    uint64_t checksum = 0;
+
+    /* 首遍每个地址都未命中（解码并插入），与之后全部命中的各遍分开计时 */
+    double start = now_seconds();
+    for (size_t i = 0; i < count; i++) {
+        checksum += (uint8_t)arm64_trace_lookup(&cache, 0x400000 + i * 4)->text[0];
+    }
+    double cold = (now_seconds() - start) * 1e9 / (double)count;
+
+    start = now_seconds();
+    for (int it = 0; it < iterations; it++) {
+        for (size_t i = 0; i < count; i++) {
+            checksum += (uint8_t)arm64_trace_lookup(&cache, 0x400000 + i * 4)->text[0];
+        }
+    }
+    double warm = (now_seconds() - start) * 1e9 / ((double)count * iterations);
+
+    bench_sink = checksum;
+    size_t decoded;
+    double direct = bench_corpus(corpus, count, iterations, &decoded);
+    printf("  %-8s 首遍 %7.1f ns/条  缓存查找 %6.1f ns/条  重新解码 %7.1f ns/条  "
+           "未命中 %llu  慢路径探测 %llu\n",
+           name, cold, warm, direct, (unsigned long long)cache.misses,
+           (unsigned long long)cache.probes);
+    arm64_trace_cache_free(&cache);
+}
+
+/* 窥孔分析：与只做流式解码相比的额外开销 */
+static bool visit_nothing(const disasm_inst_t *insts, size_t count, void *ctx) {
+    *(uint64_t *)ctx += insts[count - 1].raw;
+    return true;
+}
+
+static void report_peephole(const char *name, const uint32_t *corpus, size_t count,
+                            int iterations) {
+    uint64_t checksum = 0;
+    double start = now_seconds();
+    for (int it = 0; it < iterations; it++) {
+        disassemble_visit(corpus, count, 0x400000, NULL, visit_nothing, &checksum);
+    }
+    double decode = (now_seconds() - start) * 1e9 / ((double)count * iterations);
+
+    arm64_peephole_t peep;
+    arm64_peephole_init(&peep, ARM64_PEEP_ALL, NULL, NULL);
+    start = now_seconds();
+    for (int it = 0; it < iterations; it++) {
+        arm64_peephole_scan(&peep, corpus, count * 4, 0x400000, ARM64_ENDIAN_LITTLE);
+    }
+    double scan = (now_seconds() - start) * 1e9 / ((double)count * iterations);
+
+    bench_sink = checksum;
+    uint64_t found = 0;
+    for (int r = 0; r < ARM64_PEEP_RULE_COUNT; r++) {
+        found += peep.counts[r];
+    }
+    printf("  %-8s 流式解码 %6.1f ns/条  解码+全部规则 %6.1f ns/条  发现 %llu 处/遍\n",
+           name, decode, scan, (unsigned long long)(found / (uint64_t)iterations));
+}
+
+/* 按目标配置解码：只解码不格式化，target 为 NULL 时使用 disassemble_arm64 */
+static double bench_target(const uint32_t *corpus, size_t count, int iterations,
+                           const arm64_target_t *target, size_t *decoded) {
+    disasm_inst_t inst;
+    size_t ok = 0;
+    uint64_t checksum = 0;
+
+    double start = now_seconds();
+    for (int it = 0; it < iterations; it++) {
+        for (size_t i = 0; i < count; i++) {
+            bool hit = target ? disassemble_arm64_target(target, corpus[i], 0x400000 + i * 4, &inst)
+                              : disassemble_arm64(corpus[i], 0x400000 + i * 4, &inst);
+            if (hit) {
+                checksum += inst.type;
+                ok += it == 0;
+            }
+        }
+    }
+    double elapsed = now_seconds() - start;
+
+    bench_sink = checksum;
+    *decoded = ok;
+    return elapsed * 1e9 / ((double)count * iterations);
+}
+
+static void report_target(const char *name, const uint32_t *corpus, size_t count,
+                          int iterations) {
+    static const char *specs[] = { "all", "armv8-a", "armv8-a+nosimd" };
+    size_t decoded;
+    double plain = bench_target(corpus, count, iterations, NULL, &decoded);
+    printf("  %-8s 不限配置 %6.1f ns/条 (%5.1f%%)", name, plain,
+           100.0 * (double)decoded / (double)count);
+    for (size_t i = 0; i < sizeof(specs) / sizeof(specs[0]); i++) {
+        arm64_target_t target;
+        arm64_target_parse(&target, specs[i]);
+        double ns = bench_target(corpus, count, iterations, &target, &decoded);
+        printf("  %s %6.1f ns/条 (%5.1f%%)", specs[i], ns, 100.0 * (double)decoded / (double)count);
+    }
+    printf("\n");
+}
+
+/* 统计经过的分配，实际分配交给 malloc 分配器 */
+typedef struct {
+    arm64_allocator_t allocator;
+    const arm64_allocator_t *inner;
+    arm64_alloc_stats_t stats;
+} counting_allocator_t;
+
+static void *counting_alloc(void *ctx, size_t size, size_t align) {
+    counting_allocator_t *c = (counting_allocator_t *)ctx;
+    void *p = arm64_alloc(c->inner, size, align);
+    if (p) {
+        c->stats.allocs++;
+        c->stats.system_allocs++;
+        c->stats.bytes_requested += size;
+        c->stats.bytes_in_use += size;
+        c->stats.system_bytes += size;
+        if (c->stats.bytes_in_use > c->stats.peak_bytes) {
+            c->stats.peak_bytes = c->stats.bytes_in_use;
+            c->stats.system_peak = c->stats.system_bytes;
+        }
+    }
+    return p;
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+    counting_allocator_t *c = (counting_allocator_t *)ctx;
+    c->stats.frees++;
+    c->stats.bytes_in_use -= size;
+    c->stats.system_bytes -= size;
+    arm64_free(c->inner, ptr, size);
+}
+
+#define SESSION_WORDS   65536
+#define SESSION_CHUNK   256
+#define SESSIONS        4
+
+/**
+ * 一次分析会话：对同一映像建立执行轨迹缓存（从2个槽位开始扩容）并遍历两遍，
+ * 再以 SESSION_CHUNK 条为单位 cs_disasm/cs_free 整个映像
+ */
+static void run_session(const arm64_allocator_t *allocator, const uint32_t *image) {
+    arm64_trace_cache_t cache;
+    uint64_t checksum = 0;
+    if (!arm64_trace_cache_init_alloc(&cache, 2, image, SESSION_WORDS * 4, 0x400000,
+                                      ARM64_ENDIAN_LITTLE, allocator)) {
+        return;
+    }
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < SESSION_WORDS; i++) {
+            checksum += (uint8_t)arm64_trace_lookup(&cache, 0x400000 + i * 4)->text[0];
+        }
+    }
+    arm64_trace_cache_free(&cache);
+
+    arm64_set_default_allocator(allocator);
+    csh handle;
+    if (cs_open(CS_ARCH_ARM64, CS_MODE_LITTLE_ENDIAN, &handle) == CS_ERR_OK) {
+        cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+        cs_option(handle, CS_OPT_SKIPDATA, CS_OPT_ON);
+        for (size_t i = 0; i < SESSION_WORDS; i += SESSION_CHUNK) {
+            cs_insn *insn;
+            size_t n = cs_disasm(handle, (const uint8_t *)(image + i), SESSION_CHUNK * 4,
+                                 0x400000 + i * 4, 0, &insn);
+            checksum += n;
+            cs_free(insn, n);
+        }
+        cs_close(&handle);
+    }
+    arm64_set_default_allocator(NULL);
+
+    bench_sink = checksum;
+}
+
+static void print_alloc_stats(const char *name, double ms, const arm64_alloc_stats_t *st) {
+    printf("  %-14s %7.1f ms/会话  分配 %6llu 次  使用峰值 %5.1f MB  下层申请 %5llu 次 峰值 %5.1f MB"
+           "  大页回退 %llu\n",
+           name, ms, (unsigned long long)st->allocs, (double)st->peak_bytes / 1048576.0,
+           (unsigned long long)st->system_allocs, (double)st->system_peak / 1048576.0,
+           (unsigned long long)st->hugepage_fallbacks);
+}
+
+/**
+ * 比较 malloc、区域分配器（每个会话后重置）、大页分配器下的会话耗时与分配统计
+ * 大页分配器只映射轨迹缓存的大槽位数组，cs_disasm 的结果数组低于阈值，仍由 malloc 分配
+ */
+static void report_alloc(const uint32_t *corpus, size_t count) {
+    uint32_t *image = malloc(SESSION_WORDS * sizeof(uint32_t));
+    if (!image) {
+        return;
+    }
+    for (size_t i = 0; i < SESSION_WORDS; i++) {
+        image[i] = corpus[i % count];
+    }
+
+    counting_allocator_t counting = { { counting_alloc, counting_free, NULL },
+                                      arm64_default_allocator(), { 0 } };
+    counting.allocator.ctx = &counting;
+    double start = now_seconds();
+    for (int i = 0; i < SESSIONS; i++) {
+        run_session(&counting.allocator, image);
+    }
+    print_alloc_stats("malloc", (now_seconds() - start) * 1e3 / SESSIONS, &counting.stats);
+
+    arm64_arena_t arena;
+    arm64_arena_init(&arena, 0, NULL);
+    start = now_seconds();
+    for (int i = 0; i < SESSIONS; i++) {
+        run_session(&arena.allocator, image);
+        arm64_arena_reset(&arena);
+    }
+    print_alloc_stats("区域", (now_seconds() - start) * 1e3 / SESSIONS, &arena.stats);
+    arm64_arena_destroy(&arena);
+
+    static const struct {
+        const char *name;
+        arm64_hugepage_mode_t mode;
+    } modes[] = {
+        { "匿名映射", ARM64_HUGEPAGE_NONE },
+        { "透明大页", ARM64_HUGEPAGE_TRANSPARENT },
+        { "显式大页", ARM64_HUGEPAGE_EXPLICIT },
+    };
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+        arm64_hugepage_allocator_t hp;
+        arm64_hugepage_allocator_init(&hp, modes[m].mode, 0);
+        start = now_seconds();
+        for (int i = 0; i < SESSIONS; i++) {
+            run_session(&hp.allocator, image);
+        }
+        print_alloc_stats(modes[m].name, (now_seconds() - start) * 1e3 / SESSIONS, &hp.stats);
+    }
+
+    /* 区域的块来自透明大页：所有分配都落在2MB对齐的大页上 */
+    arm64_hugepage_allocator_t hp;
+    arm64_hugepage_allocator_init(&hp, ARM64_HUGEPAGE_TRANSPARENT, 0);
+    arm64_arena_init(&arena, ARM64_HUGEPAGE_SIZE, &hp.allocator);
+    start = now_seconds();
+    for (int i = 0; i < SESSIONS; i++) {
+        run_session(&arena.allocator, image);
+        arm64_arena_reset(&arena);
+    }
+    print_alloc_stats("区域+透明大页", (now_seconds() - start) * 1e3 / SESSIONS, &arena.stats);
+    arm64_arena_destroy(&arena);
+    free(image);
+}
+
+/* ========== objdump 格式清单 ========== */
+
+#define SAMPLE_WORDS        (256 * 1024)
+#define SAMPLE_FUNC_WORDS   64
+#define SAMPLE_BASE         0x400000ull
+#define SAMPLE_RUNS         3
+
+static void put_le(uint8_t *p, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        p[i] = (uint8_t)(value >> (i * 8));
+    }
+}
+
+/*
+ * 写出样例映像：只有节头的 AArch64 ELF 可执行文件（.text、.symtab、.strtab、.shstrtab），
+ * 每 SAMPLE_FUNC_WORDS 条指令一个全局函数符号，objdump -d 可直接读取
+ */
+static bool write_sample_elf(const char *path, const uint32_t *words, size_t count,
+                             char (*names)[16], size_t nsyms) {
+    static const char shstrtab[] = "\0.text\0.symtab\0.strtab\0.shstrtab";
+    size_t text_off = 64;
+    size_t text_size = count * 4;
+    size_t sym_off = (text_off + text_size + 7) & ~(size_t)7;
+    size_t sym_size = (nsyms + 1) * 24;
+    size_t str_off = sym_off + sym_size;
+    size_t str_size = 1;
+    for (size_t i = 0; i < nsyms; i++) {
+        str_size += strlen(names[i]) + 1;
+    }
+    size_t shstr_off = str_off + str_size;
+    size_t sh_off = (shstr_off + sizeof(shstrtab) + 7) & ~(size_t)7;
+    size_t total = sh_off + 5 * 64;
+
+    uint8_t *img = calloc(1, total);
+    if (!img) {
+        return false;
+    }
+    memcpy(img, "\177ELF\2\1\1", 7);
+    put_le(img + 16, 2, 2);                 // ET_EXEC
+    put_le(img + 18, 183, 2);               // EM_AARCH64
+    put_le(img + 20, 1, 4);
+    put_le(img + 24, SAMPLE_BASE, 8);
+    put_le(img + 40, sh_off, 8);
+    put_le(img + 52, 64, 2);
+    put_le(img + 58, 64, 2);
+    put_le(img + 60, 5, 2);
+    put_le(img + 62, 4, 2);
+
+    for (size_t i = 0; i < count; i++) {
+        put_le(img + text_off + i * 4, words[i], 4);
+    }
+    size_t name = 1;
+    for (size_t i = 0; i < nsyms; i++) {
+        uint8_t *sym = img + sym_off + (i + 1) * 24;
+        put_le(sym, name, 4);
+        sym[4] = (1 << 4) | 2;              // STB_GLOBAL, STT_FUNC
+        put_le(sym + 6, 1, 2);
+        put_le(sym + 8, SAMPLE_BASE + i * SAMPLE_FUNC_WORDS * 4, 8);
+        put_le(sym + 16, SAMPLE_FUNC_WORDS * 4, 8);
+        strcpy((char *)img + str_off + name, names[i]);
+        name += strlen(names[i]) + 1;
+    }
+    memcpy(img + shstr_off, shstrtab, sizeof(shstrtab));
+
+    /* 节头：名称, 类型, 标志, 地址, 偏移, 大小, link, info, 对齐, 项大小 */
+    const uint64_t sh[5][10] = {
+        { 0 },
+        { 1, 1, 0x6, SAMPLE_BASE, text_off, text_size, 0, 0, 4, 0 },
+        { 7, 2, 0, 0, sym_off, sym_size, 3, 1, 8, 24 },
+        { 15, 3, 0, 0, str_off, str_size, 0, 0, 1, 0 },
+        { 23, 3, 0, 0, shstr_off, sizeof(shstrtab), 0, 0, 1, 0 },
+    };
+    static const int field_bytes[10] = { 4, 4, 8, 8, 8, 8, 4, 4, 8, 8 };
+    for (int s = 0; s < 5; s++) {
+        uint8_t *p = img + sh_off + s * 64;
+        for (int f = 0; f < 10; f++) {
+            put_le(p, sh[s][f], field_bytes[f]);
+            p += field_bytes[f];
+        }
+    }
+
+    FILE *f = fopen(path, "wb");
+    bool ok = f && fwrite(img, 1, total, f) == total;
+    if (f && fclose(f) != 0) {
+        ok = false;
+    }
+    free(img);
+    return ok;
+}
+
+#if !defined(_WIN32)
+/*
+ * 运行外部反汇编命令并读完输出（与流水线中读取管道的方式相同），返回秒数；
+ * 命令失败或输出不像反汇编清单（行数不到指令数的一半）时返回负数
+ */
+static double time_command(const char *tool, const char *path, size_t count) {
+    char cmd[1024];
+    snprintf(cmd, sizeof(cmd), "%s -d '%s' 2>/dev/null", tool, path);
+    double best = -1;
+    for (int run = 0; run < SAMPLE_RUNS; run++) {
+        double start = now_seconds();
+        FILE *p = popen(cmd, "r");
+        if (!p) {
+            return -1;
+        }
+        static char buf[1 << 16];
+        size_t got, lines = 0;
+        while ((got = fread(buf, 1, sizeof(buf), p)) > 0) {
+            for (size_t i = 0; i < got; i++) {
+                lines += buf[i] == '\n';
+            }
+        }
+        int status = pclose(p);
+        double elapsed = now_seconds() - start;
+        if (status != 0 || lines < count / 2) {
+            return -1;
+        }
+        if (best < 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+#endif
+
+static void print_listing_speed(const char *name, double seconds, size_t count, size_t bytes) {
+    printf("  %-22s %8.1f ms  %7.2f M条/秒  %7.1f MB/秒\n", name, seconds * 1e3,
+           (double)count / seconds * 1e-6, (double)bytes / seconds * 1e-6);
+}
+
+#ifdef ARM64_DISASM_HAVE_GZIP
+/* 写入内存的清单输出 */
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} membuf_t;
+
+static bool membuf_write(void *ctx, const void *data, size_t size) {
+    membuf_t *m = ctx;
+    if (m->len + size > m->cap) {
+        size_t cap = m->cap ? m->cap * 2 : (1u << 20);
+        while (cap < m->len + size) {
+            cap *= 2;
+        }
+        char *p = realloc(m->data, cap);
+        if (!p) {
+            return false;
+        }
+        m->data = p;
+        m->cap = cap;
+    }
+    memcpy(m->data + m->len, data, size);
+    m->len += size;
+    return true;
+}
+
+/* 逐个成员解压（与 zcat 相同），结果与 expect 比较 */
+static bool gunzip_equals(FILE *f, const membuf_t *expect) {
+    long size = ftell(f);
+    uint8_t *in = malloc(size > 0 ? (size_t)size : 1);
+    char *out = malloc(expect->len + 1);
+    bool ok = in && out && size > 0;
+    rewind(f);
+    if (ok) {
+        ok = fread(in, 1, (size_t)size, f) == (size_t)size;
+    }
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    if (ok && inflateInit2(&zs, 15 + 16) == Z_OK) {
+        zs.next_in = in;
+        zs.avail_in = (uInt)size;
+        zs.next_out = (Bytef *)out;
+        zs.avail_out = (uInt)expect->len + 1;
+        int rc;
+        while ((rc = inflate(&zs, Z_NO_FLUSH)) == Z_STREAM_END && zs.avail_in > 0) {
+            inflateReset(&zs);
+        }
+        ok = rc == Z_STREAM_END && (size_t)((char *)zs.next_out - out) == expect->len &&
+             memcmp(out, expect->data, expect->len) == 0;
+        inflateEnd(&zs);
+    } else {
+        ok = false;
+    }
+    free(in);
+    free(out);
+    return ok;
+}
+
+/**
+ * 并行压缩清单：工作线程直接解码、格式化并压缩各块（多成员 gzip），
+ * 按线程数报告吞吐量（以未压缩文本计），并校验解压结果与单线程清单逐字节相同
+ */
+static void report_gzip(const uint32_t *words, const arm64_listing_symbol_t *syms,
+                        size_t nsyms, FILE *null_out) {
+    arm64_listing_section_t section = {
+        ".text", SAMPLE_BASE, words, SAMPLE_WORDS * 4, ARM64_ENDIAN_LITTLE
+    };
+    arm64_listing_image_t image = { "sample", "elf64-littleaarch64", &section, 1 };
+    /* 小块使样例映像也能分给多个线程 */
+    size_t block_insts = SAMPLE_WORDS / 32;
+
+    membuf_t plain = { NULL, 0, 0 };
+    arm64_listing_t listing;
+    if (!arm64_listing_init_writer(&listing, membuf_write, &plain, syms, nsyms)) {
+        return;
+    }
+    arm64_listing_image(&listing, &image);
+    arm64_listing_flush(&listing);
+    arm64_listing_free(&listing);
+
+    FILE *tmp = tmpfile();
+    arm64_gzsink_t *sink = tmp ? arm64_gzsink_open(tmp, -1, 0) : NULL;
+    arm64_gzsink_stats_t st = { 0 };
+    bool ok = sink && arm64_gzsink_listing(sink, &image, syms, nsyms, 0, block_insts);
+    ok = sink && arm64_gzsink_close(sink, &st) && ok && gunzip_equals(tmp, &plain);
+    printf("  并行压缩清单: %llu 个 gzip 成员, %zu -> %llu 字节 (%.1f%%), 解压校验 %s\n",
+           (unsigned long long)st.blocks, plain.len, (unsigned long long)st.bytes_out,
+           plain.len ? 100.0 * (double)st.bytes_out / (double)plain.len : 0.0,
+           ok ? "一致" : "失败");
+    if (tmp) {
+        fclose(tmp);
+    }
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    double single = 0;
+    for (unsigned threads = 1; threads <= (unsigned)(cpus > 1 ? cpus : 1); threads *= 2) {
+        double best = -1;
+        for (int run = 0; run < SAMPLE_RUNS; run++) {
+            double start = now_seconds();
+            sink = arm64_gzsink_open(null_out, -1, 0);
+            if (!sink) {
+                break;
+            }
+            arm64_gzsink_listing(sink, &image, syms, nsyms, threads, block_insts);
+            arm64_gzsink_close(sink, NULL);
+            double elapsed = now_seconds() - start;
+            if (best < 0 || elapsed < best) {
+                best = elapsed;
+            }
+        }
+        if (best <= 0) {
+            break;
+        }
+        if (threads == 1) {
+            single = best;
+        }
+        char label[64];
+        snprintf(label, sizeof(label), "gzip %u 线程", threads);
+        print_listing_speed(label, best, SAMPLE_WORDS, plain.len);
+        if (threads > 1) {
+            printf("  %-22s %8.2fx（在线 CPU %ld）\n", "相对单线程", single / best, cpus);
+        }
+    }
+    free(plain.data);
+}
+#endif
+
+/**
+ * 样例映像（典型语料重复，每64条指令一个函数符号）的 objdump 格式清单吞吐量：
+ * 进程内写入器、arm64_objdump 工具，以及系统中可用的 AArch64 objdump（逐个尝试
+ * $ARM64_BENCH_OBJDUMP、aarch64-linux-gnu-objdump、llvm-objdump、objdump）
+ */
+static void report_objdump(const char *prog) {
+    uint32_t *words = malloc(SAMPLE_WORDS * sizeof(uint32_t));
+    size_t nsyms = SAMPLE_WORDS / SAMPLE_FUNC_WORDS;
+    char (*names)[16] = malloc(nsyms * sizeof(*names));
+    arm64_listing_symbol_t *syms = malloc(nsyms * sizeof(*syms));
+    FILE *null_out = fopen("/dev/null", "w");
+    if (!words || !names || !syms || !null_out) {
+        printf("  不可用（内存不足或无法打开 /dev/null）\n");
+        goto done;
+    }
+    for (size_t i = 0; i < SAMPLE_WORDS; i++) {
+        words[i] = mixed_corpus[i % MIXED_COUNT];
+    }
+    for (size_t i = 0; i < nsyms; i++) {
+        snprintf(names[i], sizeof(names[i]), "func_%zu", i);
+        syms[i].address = SAMPLE_BASE + i * SAMPLE_FUNC_WORDS * 4;
+        syms[i].name = names[i];
+    }
+
+    double best = -1;
+    size_t bytes = 0;
+    for (int run = 0; run < SAMPLE_RUNS; run++) {
+        arm64_listing_t listing;
+        if (!arm64_listing_init(&listing, null_out, syms, nsyms)) {
+            break;
+        }
+        double start = now_seconds();
+        arm64_listing_file_header(&listing, "sample", "elf64-littleaarch64");
+        arm64_listing_section(&listing, ".text", SAMPLE_BASE, words, SAMPLE_WORDS * 4,
+                              ARM64_ENDIAN_LITTLE);
+        arm64_listing_flush(&listing);
+        double elapsed = now_seconds() - start;
+        bytes = (size_t)listing.bytes_written;
+        arm64_listing_free(&listing);
+        if (best < 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    printf("  样例映像 %d 条指令, %zu 个函数, 清单 %zu 字节\n", SAMPLE_WORDS, nsyms, bytes);
+    if (best > 0) {
+        print_listing_speed("arm64_listing (进程内)", best, SAMPLE_WORDS, bytes);
+    }
+
+#if !defined(_WIN32)
+    const char *tmp = getenv("TMPDIR");
+    char path[512];
+    snprintf(path, sizeof(path), "%s/arm64_bench_sample_%d.elf", tmp ? tmp : "/tmp", (int)getpid());
+    if (!write_sample_elf(path, words, SAMPLE_WORDS, names, nsyms)) {
+        printf("  无法写出样例映像 %s\n", path);
+        goto done;
+    }
+
+    /* 与本程序同目录的 arm64_objdump */
+    char tool[512];
+    const char *slash = strrchr(prog, '/');
+    snprintf(tool, sizeof(tool), "%.*sarm64_objdump",
+             slash ? (int)(slash - prog + 1) : 0, prog);
+    double ours = time_command(tool, path, SAMPLE_WORDS);
+    if (ours > 0) {
+        print_listing_speed("arm64_objdump -d", ours, SAMPLE_WORDS, bytes);
+    } else {
+        printf("  %-22s 不可用 (%s)\n", "arm64_objdump -d", tool);
+    }
+
+    const char *candidates[] = {
+        getenv("ARM64_BENCH_OBJDUMP"), "aarch64-linux-gnu-objdump", "llvm-objdump", "objdump"
+    };
+    bool found = false;
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]) && !found; i++) {
+        if (!candidates[i] || candidates[i][0] == '\0') {
+            continue;
+        }
+        double t = time_command(candidates[i], path, SAMPLE_WORDS);
+        if (t > 0) {
+            char label[64];
+            snprintf(label, sizeof(label), "%s -d", candidates[i]);
+            print_listing_speed(label, t, SAMPLE_WORDS, bytes);
+            if (ours > 0) {
+                printf("  %-22s %8.2fx\n", "arm64_objdump 加速比", t / ours);
+            }
+            found = true;
+        }
+    }
+    if (!found) {
+        printf("  %-22s 不可用（未找到支持 AArch64 的 objdump）\n", "objdump -d");
+    }
+    remove(path);
+#endif
+
+#ifdef ARM64_DISASM_HAVE_GZIP
+    report_gzip(words, syms, nsyms, null_out);
+#endif
+
+done:
+    if (null_out) {
+        fclose(null_out);
+    }
+    free(syms);
+    free(names);
+    free(words);
+}
+
+/* ========== 硬件计数器 ========== */
+
+typedef enum {
+    CNT_CYCLES,
+    CNT_INSTRUCTIONS,
+    CNT_BRANCHES,
+    CNT_BRANCH_MISSES,
+    CNT_L1I_MISSES,
+    CNT_L1D_MISSES,
+    CNT_COUNT
+} counter_id_t;
+
+#ifdef HAVE_PERF_EVENT
+#define L1_READ_MISS(cache) \
+    ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const struct {
+    const char *name;
+    uint32_t type;
+    uint64_t config;
+} counter_defs[CNT_COUNT] = {
+    [CNT_CYCLES]        = { "cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    [CNT_INSTRUCTIONS]  = { "instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    [CNT_BRANCHES]      = { "branches",      PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+    [CNT_BRANCH_MISSES] = { "branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    [CNT_L1I_MISSES]    = { "L1I-misses",    PERF_TYPE_HW_CACHE, L1_READ_MISS(PERF_COUNT_HW_CACHE_L1I) },
+    [CNT_L1D_MISSES]    = { "L1D-misses",    PERF_TYPE_HW_CACHE, L1_READ_MISS(PERF_COUNT_HW_CACHE_L1D) },
+};
+#endif
+
+/* 每个计数器单独打开（不组成组），某个事件不受支持时其余仍可使用 */
+static int counter_fds[CNT_COUNT];
+
+/**
+ * 打开计数器，返回可用的数量；全部不可用时 reason 给出原因
+ */
+static int counters_open(const char **reason) {
+    int available = 0;
+    *reason = "不是 Linux";
+    for (int i = 0; i < CNT_COUNT; i++) {
+        counter_fds[i] = -1;
+#ifdef HAVE_PERF_EVENT
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = counter_defs[i].type;
+        attr.config = counter_defs[i].config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        counter_fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (counter_fds[i] >= 0) {
+            available++;
+        } else {
+            *reason = errno == EACCES || errno == EPERM ?
+                      "权限不足（perf_event_paranoid 或容器 seccomp）" :
+                      errno == ENOENT || errno == EOPNOTSUPP ?
+                      "硬件事件不受支持（虚拟机或容器）" :
+                      errno == ENOSYS ? "内核不支持 perf_event_open" : strerror(errno);
+        }
+#endif
+    }
+    return available;
+}
+
+static void counters_close(void) {
+#ifdef HAVE_PERF_EVENT
+    for (int i = 0; i < CNT_COUNT; i++) {
+        if (counter_fds[i] >= 0) {
+            close(counter_fds[i]);
+        }
+    }
+#endif
+}
+
+static void counters_start(void) {
+#ifdef HAVE_PERF_EVENT
+    for (int i = 0; i < CNT_COUNT; i++) {
+        if (counter_fds[i] >= 0) {
+            ioctl(counter_fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(counter_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+/**
+ * 停止计数并读取结果；计数器不可用时对应值为负数
+ * 事件多于硬件计数器时内核分时复用，按运行时间比例换算
+ */
+static void counters_stop(double values[CNT_COUNT]) {
+    for (int i = 0; i < CNT_COUNT; i++) {
+        values[i] = -1.0;
+#ifdef HAVE_PERF_EVENT
+        uint64_t data[3];
+        if (counter_fds[i] >= 0) {
+            ioctl(counter_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(counter_fds[i], data, sizeof(data)) == (ssize_t)sizeof(data) && data[2] > 0) {
+                values[i] = (double)data[0] * (double)data[1] / (double)data[2];
+            }
+        }
+#endif
+    }
+}
+
+/* ========== 分阶段计数 ========== */
+
+typedef bool (*group_decode_t)(uint32_t inst, uint64_t addr, disasm_inst_t *result);
+
+typedef struct {
+    const uint32_t *corpus;
+    size_t count;
+    group_decode_t decode;          // 各组解码入口（decode_with_table）
+    disasm_inst_t *decoded;         // format 阶段的输入
+    arm64_listing_t *listing;       // listing 阶段的写入器（输出只计入校验和）
+    uint64_t checksum;
+} phase_ctx_t;
+
+static void phase_decode(phase_ctx_t *c) {
+    disasm_inst_t inst;
+    for (size_t i = 0; i < c->count; i++) {
+        c->checksum += disassemble_arm64(c->corpus[i], 0x400000 + i * 4, &inst);
+    }
+}
+
+static void phase_group(phase_ctx_t *c) {
+    disasm_inst_t inst;
+    for (size_t i = 0; i < c->count; i++) {
+        memset(&inst, 0, sizeof(inst));
+        c->checksum += c->decode(c->corpus[i], 0x400000 + i * 4, &inst);
+    }
+}
+
+static void phase_format(phase_ctx_t *c) {
+    char buffer[128];
+    for (size_t i = 0; i < c->count; i++) {
+        format_instruction(&c->decoded[i], buffer, sizeof(buffer));
+        c->checksum += (uint8_t)buffer[0];
+    }
+}
+
+/* 反汇编清单：库的 objdump 格式清单写入器（解码、格式化、符号注释、缓冲写出） */
+static bool listing_discard(void *ctx, const void *data, size_t size) {
+    *(uint64_t *)ctx += size + *(const uint8_t *)data;
+    return true;
+}
+
+static void phase_listing(phase_ctx_t *c) {
+    arm64_listing_section_t section = {
+        ".text", 0x400000, c->corpus, c->count * 4, ARM64_ENDIAN_LITTLE
+    };
+    arm64_listing_range(c->listing, &section, 0, section.size);
+    arm64_listing_flush(c->listing);
+}
+
+/**
+ * 运行一个阶段 passes 遍并报告每条指令的耗时和计数器
+ */
+static void measure_phase(const char *name, void (*fn)(phase_ctx_t *), phase_ctx_t *c,
+                          int passes) {
+    double v[CNT_COUNT];
+    double start = now_seconds();
+    counters_start();
+    for (int p = 0; p < passes; p++) {
+        fn(c);
+    }
+    counters_stop(v);
+    double n = (double)c->count * passes;
+    double ns = (now_seconds() - start) * 1e9 / n;
+
+    printf("  %-22s %6zu 条 %7.1f ns/条", name, c->count, ns);
+    if (v[CNT_CYCLES] >= 0) {
+        printf("  %7.1f 周期/条", v[CNT_CYCLES] / n);
+    }
+    if (v[CNT_INSTRUCTIONS] >= 0) {
+        printf("  %7.1f 指令/条", v[CNT_INSTRUCTIONS] / n);
+        if (v[CNT_CYCLES] > 0) {
+            printf("  IPC %4.2f", v[CNT_INSTRUCTIONS] / v[CNT_CYCLES]);
+        }
+    }
+    if (v[CNT_BRANCH_MISSES] >= 0) {
+        printf("  分支失误 %5.2f/条", v[CNT_BRANCH_MISSES] / n);
+        if (v[CNT_BRANCHES] > 0) {
+            printf(" (%4.1f%%)", 100.0 * v[CNT_BRANCH_MISSES] / v[CNT_BRANCHES]);
+        }
+    }
+    if (v[CNT_L1I_MISSES] >= 0) {
+        printf("  L1I未命中 %6.2f/千条", v[CNT_L1I_MISSES] * 1000.0 / n);
+    }
+    if (v[CNT_L1D_MISSES] >= 0) {
+        printf("  L1D未命中 %6.2f/千条", v[CNT_L1D_MISSES] * 1000.0 / n);
+    }
+    printf("\n");
+    bench_sink = c->checksum;
+}
+
+/* 按 A64 顶层编码（op0 = bits[28:25]）划分的指令组及其解码入口 */
+static const struct {
+    const char *name;
+    uint32_t mask;
+    uint32_t value;
+    group_decode_t decode;
+} decode_groups[] = {
+#if ARM64_DISASM_HAS_DATA_PROC
+    { "decode_data_proc_imm", 0x1C000000, 0x10000000, decode_data_proc_imm },   // 100x
+    { "decode_data_proc_reg", 0x0E000000, 0x0A000000, decode_data_proc_reg },   // x101
+#endif
+#if ARM64_DISASM_HAS_BRANCH || ARM64_DISASM_HAS_SYSTEM
+    { "decode_branch",        0x1C000000, 0x14000000, decode_branch },          // 101x
+#endif
+#if ARM64_DISASM_HAS_LOAD_STORE || ARM64_DISASM_HAS_ATOMICS
+    { "decode_load_store",    0x0A000000, 0x08000000, decode_load_store },      // x1x0
+#endif
+#if ARM64_DISASM_HAS_FP_SIMD
+    { "decode_fp_simd",       0x0E000000, 0x0E000000, decode_fp_simd },         // x111
+#endif
+};
+
+#define GROUP_CORPUS 16384
+
+/**
+ * 分阶段统计：整条解码、各组解码表、格式化、反汇编清单
+ * 各组使用按顶层编码筛出的随机指令字（含该组中的未分配编码）
+ */
+static void report_counters(const uint32_t *corpus, size_t count, int iterations) {
+    const char *reason;
+    int available = counters_open(&reason);
+    if (available == 0) {
+        printf("  硬件计数器不可用: %s，只报告耗时\n", reason);
+    } else if (available < CNT_COUNT) {
+        printf("  部分计数器不可用:");
+        for (int i = 0; i < CNT_COUNT; i++) {
+#ifdef HAVE_PERF_EVENT
+            if (counter_fds[i] < 0) {
+                printf(" %s", counter_defs[i].name);
+            }
+#endif
+        }
+        printf("\n");
+    }
+
+    phase_ctx_t c;
+    memset(&c, 0, sizeof(c));
+    c.corpus = corpus;
+    c.count = count;
+    measure_phase("disassemble_arm64", phase_decode, &c, iterations);
+
+    /* 各组：从随机指令字中筛出属于该组的 */
+    uint32_t *group_corpus = malloc(GROUP_CORPUS * sizeof(uint32_t));
+    for (size_t g = 0; group_corpus && g < sizeof(decode_groups) / sizeof(decode_groups[0]); g++) {
+        uint32_t seed = 0x9E3779B9u + (uint32_t)g;
+        size_t n = 0;
+        while (n < GROUP_CORPUS) {
+            seed = seed * 1664525u + 1013904223u;
+            if ((seed & decode_groups[g].mask) == decode_groups[g].value) {
+                group_corpus[n++] = seed;
+            }
+        }
+        c.corpus = group_corpus;
+        c.count = n;
+        c.decode = decode_groups[g].decode;
+        measure_phase(decode_groups[g].name, phase_group, &c,
+                      iterations * (int)count / (int)n + 1);
+    }
+    free(group_corpus);
+
+    c.corpus = corpus;
+    c.count = count;
+    c.decoded = malloc(count * sizeof(disasm_inst_t));
+    for (size_t i = 0; c.decoded && i < count; i++) {
+        disassemble_arm64(corpus[i], 0x400000 + i * 4, &c.decoded[i]);
+    }
+    if (c.decoded) {
+        measure_phase("format_instruction", phase_format, &c, iterations);
+    }
+    free(c.decoded);
+
+    arm64_listing_t listing;
+    if (arm64_listing_init_writer(&listing, listing_discard, &c.checksum, NULL, 0)) {
+        c.listing = &listing;
+        measure_phase("反汇编清单", phase_listing, &c, iterations);
+        arm64_listing_free(&listing);
+    }
+    counters_close();
+}
+
+int main(int argc, char *argv[]) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 20000;
+    if (iterations <= 0) {
+        iterations = 1;
+    }
+
+    printf("指令组配置:");
+    printf(" data_proc=%d", ARM64_DISASM_HAS_DATA_PROC);
+    printf(" branch=%d", ARM64_DISASM_HAS_BRANCH);
+    printf(" system=%d", ARM64_DISASM_HAS_SYSTEM);
+    printf(" load_store=%d", ARM64_DISASM_HAS_LOAD_STORE);
+    printf(" atomics=%d", ARM64_DISASM_HAS_ATOMICS);
+    printf(" fp_simd=%d\n", ARM64_DISASM_HAS_FP_SIMD);
+
+    printf("静态库大小: %ld 字节 (%s)\n",
+           file_size(ARM64_DISASM_LIBRARY_PATH), ARM64_DISASM_LIBRARY_PATH);
+    printf("链接后可执行文件大小: %ld 字节\n", file_size(argv[0]));
+
+    /* 随机指令字：覆盖未分配编码，测量未匹配路径的开销 */
+    static uint32_t random_corpus[RANDOM_COUNT];
+    uint32_t seed = 0x12345678;
+    for (size_t i = 0; i < RANDOM_COUNT; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        random_corpus[i] = seed;
+    }
+
+    printf("解码+格式化速度 (%d 遍):\n", iterations);
+    report("典型", mixed_corpus, MIXED_COUNT, iterations);
+    report("随机", random_corpus, RANDOM_COUNT,
+           iterations * (int)MIXED_COUNT / RANDOM_COUNT + 1);
+
+    /* 随机语料按主机字节序存放；小端主机上与 CS_MODE_LITTLE_ENDIAN 一致 */
+    printf("Capstone 兼容接口开销 (%d 遍):\n", iterations);
+    report_capstone("典型", mixed_corpus, MIXED_COUNT, iterations);
+    report_capstone("随机", random_corpus, RANDOM_COUNT,
+                    iterations * (int)MIXED_COUNT / RANDOM_COUNT + 1);
+
+    printf("执行轨迹注释 (%d 遍):\n", iterations);
+    report_trace("典型", mixed_corpus, MIXED_COUNT, iterations);
+    report_trace("随机", random_corpus, RANDOM_COUNT,
+                 iterations * (int)MIXED_COUNT / RANDOM_COUNT + 1);
+
+    printf("窥孔分析 (%d 遍):\n", iterations);
+    report_peephole("典型", mixed_corpus, MIXED_COUNT, iterations);
+    report_peephole("随机", random_corpus, RANDOM_COUNT,
+                    iterations * (int)MIXED_COUNT / RANDOM_COUNT + 1);
+
+    printf("按目标配置解码，不格式化 (%d 遍):\n", iterations);
+    report_target("典型", mixed_corpus, MIXED_COUNT, iterations);
+    report_target("随机", random_corpus, RANDOM_COUNT,
+                  iterations * (int)MIXED_COUNT / RANDOM_COUNT + 1);
+
+    printf("分配器 (每会话 %d 条指令: 轨迹缓存 + cs_disasm, %d 个会话):\n",
+           SESSION_WORDS, SESSIONS);
+    report_alloc(mixed_corpus, MIXED_COUNT);
+
+    printf("分阶段计数 (典型语料 %d 遍):\n", iterations);
+    report_counters(mixed_corpus, MIXED_COUNT, iterations);
+
+    printf("objdump 格式清单 (%d 遍取最快):\n", SAMPLE_RUNS);
+    report_objdump(argv[0]);
+    return 0;
+}
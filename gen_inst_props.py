@@ -0,0 +1,537 @@
+#!/usr/bin/env python3
+"""
+ARM64反汇编器 - 指令属性表生成器
+
+根据 isa_aarch64.json 的 io / control / ext / category 字段，
+结合解码器元数据（每个 inst_type_t 对应的助记符），
+生成按指令类型直接索引的属性位表：
+
+    arm64_inst_props.h  - 扩展特性枚举 arm64_ext_t
+    arm64_inst_props.c  - inst_prop_table / inst_ext_table / arm64_ext_names /
+                          inst_type_names / 编码 -> 扩展分类表
+
+扩展分类表由每个条目 op 字段中的固定位得到，按编码而不是按解码器的指令类型
+查询，解码器不支持的指令（SVE、点积等）也能确定所需扩展
+
+用法：
+    gen_inst_props.py <isa_aarch64.json> <arm64_disasm.h> <输出目录>
+"""
+
+import json
+import os
+import re
+import sys
+
+# ========== 解码器元数据 ==========
+#
+# 每个指令类型：(指令集分类, 解码器可能产生的助记符, 手工补充的属性)
+#   分类 "GP"    只匹配 category 以 GP 开头的条目
+#   分类 "FP"    只匹配 category 为 ASIMD 的条目（标量浮点位于此分类）
+#   分类 "LS"    加载/存储，同时匹配 GP 与 ASIMD（SIMD寄存器加载/存储）
+# 手工属性用于JSON无法表达的语义：屏障、独占、获取/释放、特权、异常等。
+
+DECODER_META = {
+    "INST_TYPE_UNKNOWN": None,
+
+    "INST_TYPE_LDR":    ("LS", ["ldr", "ldur"], []),
+    "INST_TYPE_LDRB":   ("LS", ["ldrb", "ldurb"], []),
+    "INST_TYPE_LDRH":   ("LS", ["ldrh", "ldurh"], []),
+    "INST_TYPE_LDRSW":  ("LS", ["ldrsw", "ldursw"], []),
+    "INST_TYPE_LDRSB":  ("LS", ["ldrsb", "ldursb"], []),
+    "INST_TYPE_LDRSH":  ("LS", ["ldrsh", "ldursh"], []),
+    "INST_TYPE_STR":    ("LS", ["str", "stur"], []),
+    "INST_TYPE_STRB":   ("LS", ["strb", "sturb"], []),
+    "INST_TYPE_STRH":   ("LS", ["strh", "sturh"], []),
+    "INST_TYPE_STP":    ("LS", ["stp"], []),
+    "INST_TYPE_LDP":    ("LS", ["ldp", "ldpsw"], []),
+
+    "INST_TYPE_MOV":    ("GP", ["mov"], []),
+    "INST_TYPE_MOVZ":   ("GP", ["movz"], []),
+    "INST_TYPE_MOVN":   ("GP", ["movn"], []),
+    "INST_TYPE_MOVK":   ("GP", ["movk"], []),
+
+    "INST_TYPE_ADD":    ("GP", ["add"], []),
+    "INST_TYPE_SUB":    ("GP", ["sub", "neg"], []),
+    "INST_TYPE_ADDS":   ("GP", ["adds"], []),
+    "INST_TYPE_SUBS":   ("GP", ["subs"], []),
+    "INST_TYPE_ADR":    ("GP", ["adr"], []),
+    "INST_TYPE_ADRP":   ("GP", ["adrp"], []),
+
+    "INST_TYPE_B":      ("GP", ["b"], []),
+    "INST_TYPE_BL":     ("GP", ["bl"], []),
+    "INST_TYPE_BR":     ("GP", ["br"], []),
+    "INST_TYPE_BLR":    ("GP", ["blr"], []),
+    "INST_TYPE_RET":    ("GP", ["ret"], []),
+    "INST_TYPE_CBZ":    ("GP", ["cbz"], []),
+    "INST_TYPE_CBNZ":   ("GP", ["cbnz"], []),
+    "INST_TYPE_TBZ":    ("GP", ["tbz"], ["BRANCH", "CONDITIONAL"]),
+    "INST_TYPE_TBNZ":   ("GP", ["tbnz"], ["BRANCH", "CONDITIONAL"]),
+
+    # ands/bics/tst 共用 INST_TYPE_AND，标志位由 set_flags 在实例级补充
+    "INST_TYPE_AND":    ("GP", ["and", "bic"], []),
+    "INST_TYPE_ORR":    ("GP", ["orr", "orn", "mvn"], []),
+    "INST_TYPE_EOR":    ("GP", ["eor", "eon"], []),
+    "INST_TYPE_LSL":    ("GP", ["lsl", "sbfm", "bfm", "ubfm"], []),
+    "INST_TYPE_LSR":    ("GP", ["lsr"], []),
+    "INST_TYPE_ASR":    ("GP", ["asr"], []),
+    "INST_TYPE_ROR":    ("GP", ["ror"], []),
+
+    "INST_TYPE_CMP":    ("GP", ["cmp"], []),
+    "INST_TYPE_CMN":    ("GP", ["cmn"], []),
+    "INST_TYPE_TST":    ("GP", ["tst"], []),
+
+    "INST_TYPE_MUL":    ("GP", ["mul"], []),
+    "INST_TYPE_MADD":   ("GP", ["madd"], []),
+    "INST_TYPE_MSUB":   ("GP", ["msub", "mneg"], []),
+    "INST_TYPE_SDIV":   ("GP", ["sdiv"], []),
+    "INST_TYPE_UDIV":   ("GP", ["udiv"], []),
+    "INST_TYPE_SMULL":  ("GP", ["smull"], []),
+    "INST_TYPE_UMULL":  ("GP", ["umull"], []),
+
+    "INST_TYPE_CSEL":   ("GP", ["csel"], []),
+    "INST_TYPE_CSINC":  ("GP", ["csinc"], []),
+    "INST_TYPE_CSINV":  ("GP", ["csinv"], []),
+    "INST_TYPE_CSNEG":  ("GP", ["csneg"], []),
+    "INST_TYPE_CSET":   ("GP", ["cset"], []),
+    "INST_TYPE_CSETM":  ("GP", ["csetm"], []),
+    "INST_TYPE_CINC":   ("GP", ["cinc"], []),
+    "INST_TYPE_CINV":   ("GP", ["cinv"], []),
+    "INST_TYPE_CNEG":   ("GP", ["cneg"], []),
+
+    "INST_TYPE_CLZ":    ("GP", ["clz"], []),
+    "INST_TYPE_CLS":    ("GP", ["cls"], []),
+    "INST_TYPE_RBIT":   ("GP", ["rbit"], []),
+    "INST_TYPE_REV":    ("GP", ["rev"], []),
+    "INST_TYPE_REV16":  ("GP", ["rev16"], []),
+    "INST_TYPE_REV32":  ("GP", ["rev32"], []),
+    "INST_TYPE_EXTR":   ("GP", ["extr"], []),
+
+    "INST_TYPE_LDXR":   ("GP", ["ldxr", "ldxp"], ["EXCLUSIVE"]),
+    "INST_TYPE_STXR":   ("GP", ["stxr", "stxp"], ["EXCLUSIVE"]),
+    "INST_TYPE_LDAXR":  ("GP", ["ldaxr", "ldaxp"], ["EXCLUSIVE", "ACQUIRE"]),
+    "INST_TYPE_STLXR":  ("GP", ["stlxr", "stlxp"], ["EXCLUSIVE", "RELEASE"]),
+    "INST_TYPE_LDAR":   ("GP", ["ldar", "ldlar"], ["ACQUIRE"]),
+    "INST_TYPE_STLR":   ("GP", ["stlr", "stllr"], ["RELEASE"]),
+    "INST_TYPE_LDADD":  ("GP", ["ldadd"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_LDCLR":  ("GP", ["ldclr"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_LDEOR":  ("GP", ["ldeor"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_LDSET":  ("GP", ["ldset"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_LDSMAX": ("GP", ["ldsmax"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_LDSMIN": ("GP", ["ldsmin"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_LDUMAX": ("GP", ["ldumax"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_LDUMIN": ("GP", ["ldumin"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_SWP":    ("GP", ["swp"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+    "INST_TYPE_CAS":    ("GP", ["cas"], ["ATOMIC", "MEM_READ", "MEM_WRITE"]),
+
+    "INST_TYPE_NOP":    ("GP", ["nop", "yield", "wfe", "wfi", "sev", "sevl"], []),
+    "INST_TYPE_MRS":    ("GP", ["mrs"], ["SYSTEM"]),
+    "INST_TYPE_MSR":    ("GP", ["msr"], ["SYSTEM", "PRIVILEGED"]),
+    "INST_TYPE_DMB":    ("GP", ["dmb"], ["SYSTEM", "BARRIER"]),
+    "INST_TYPE_DSB":    ("GP", ["dsb"], ["SYSTEM", "BARRIER"]),
+    "INST_TYPE_ISB":    ("GP", ["isb"], ["SYSTEM", "BARRIER"]),
+    "INST_TYPE_SVC":    ("GP", ["svc"], ["SYSTEM", "EXCEPTION"]),
+    "INST_TYPE_HVC":    ("GP", ["hvc"], ["SYSTEM", "EXCEPTION", "PRIVILEGED"]),
+    "INST_TYPE_SMC":    ("GP", ["smc"], ["SYSTEM", "EXCEPTION", "PRIVILEGED"]),
+
+    "INST_TYPE_FMOV":   ("FP", ["fmov"], []),
+    "INST_TYPE_FADD":   ("FP", ["fadd"], []),
+    "INST_TYPE_FSUB":   ("FP", ["fsub"], []),
+    "INST_TYPE_FMUL":   ("FP", ["fmul", "fnmul"], []),
+    "INST_TYPE_FDIV":   ("FP", ["fdiv"], []),
+    "INST_TYPE_FABS":   ("FP", ["fabs"], []),
+    "INST_TYPE_FNEG":   ("FP", ["fneg"], []),
+    "INST_TYPE_FSQRT":  ("FP", ["fsqrt"], []),
+    "INST_TYPE_FMADD":  ("FP", ["fmadd"], []),
+    "INST_TYPE_FMSUB":  ("FP", ["fmsub"], []),
+    "INST_TYPE_FNMADD": ("FP", ["fnmadd"], []),
+    "INST_TYPE_FNMSUB": ("FP", ["fnmsub"], []),
+    "INST_TYPE_FCMP":   ("FP", ["fcmp"], []),
+    "INST_TYPE_FCMPE":  ("FP", ["fcmpe"], []),
+    # 条件比较在条件不满足时直接写入nzcv，因此也读取标志位
+    "INST_TYPE_FCCMP":  ("FP", ["fccmp", "fccmpe"], ["READS_FLAGS"]),
+    "INST_TYPE_FCSEL":  ("FP", ["fcsel"], []),
+    "INST_TYPE_FCVT":   ("FP", ["fcvt"], []),
+    "INST_TYPE_FCVTZS": ("FP", ["fcvtzs", "fcvtns", "fcvtps", "fcvtms", "fcvtas"], []),
+    "INST_TYPE_FCVTZU": ("FP", ["fcvtzu", "fcvtnu", "fcvtpu", "fcvtmu", "fcvtau"], []),
+    "INST_TYPE_SCVTF":  ("FP", ["scvtf"], []),
+    "INST_TYPE_UCVTF":  ("FP", ["ucvtf"], []),
+    "INST_TYPE_FRINT":  ("FP", ["frintn", "frintp", "frintm", "frintz",
+                                "frinta", "frintx", "frinti"], []),
+    "INST_TYPE_FMAX":   ("FP", ["fmax", "fmaxnm"], []),
+    "INST_TYPE_FMIN":   ("FP", ["fmin", "fminnm"], []),
+
+    "INST_TYPE_BCOND":  ("GP", ["b.<cond>"], []),
+    "INST_TYPE_PRFM":   ("LS", ["prfm", "prfum"], []),
+}
+
+# JSON io 字段中的条件标志
+NZCV_FLAGS = ("N", "Z", "C", "V")
+
+# control 字段到属性的映射
+CONTROL_PROPS = {
+    "jump":   ["BRANCH"],
+    "branch": ["BRANCH", "CONDITIONAL"],
+    "call":   ["BRANCH", "CALL"],
+    "return": ["BRANCH", "RETURN"],
+}
+
+
+def parse_inst_types(header_path):
+    """从 arm64_disasm.h 中按顺序提取 inst_type_t 枚举名"""
+    with open(header_path, encoding="utf-8") as f:
+        text = f.read()
+    m = re.search(r"typedef enum\s*\{(.*?)\}\s*inst_type_t;", text, re.S)
+    if not m:
+        sys.exit("错误：在 %s 中找不到 inst_type_t" % header_path)
+    names = re.findall(r"^\s*(INST_TYPE_\w+)", m.group(1), re.M)
+    return [n for n in names if n != "INST_TYPE_COUNT"]
+
+
+def ext_ident(name):
+    return "ARM64_EXT_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def collect_extensions(isa):
+    """按JSON中首次出现的顺序收集所有扩展名（先分组级，后条目级），BASE 固定为0"""
+    exts = ["BASE"]
+    names = [group.get("ext") for group in isa["instructions"]]
+    names += [e.get("ext") for group in isa["instructions"] for e in group["data"]]
+    for name in names:
+        if name and name not in exts:
+            exts.append(name)
+    return exts
+
+
+# ========== 编码 -> 扩展分类表 ==========
+#
+# op 字段形如 "00011010|000|Rm|000000|Rn|Rd"：由 0/1 组成的段是固定位，x/X/M/W 为
+# 任意位；其余是字段名，宽度写作 name:N 或 name[hi:lo]/name[i]，常用字段名按下表取宽度
+
+FIELD_WIDTHS = {
+    "sz": 2, "msz": 2, "sop": 2, "cond": 4, "nzcv": 4, "CRn": 4, "CRm": 4,
+    "!post": 1, "W": 1, "M": 1,
+}
+
+# 分桶：bits[31:21] 作为桶号，桶内线性匹配
+EXT_BUCKET_SHIFT = 21
+EXT_BUCKET_BITS = 11
+
+
+# JSON 没有逐条收录的编码空间（如 SVE 的加载/存储）整块归入对应扩展；
+# 固定位少于所有 JSON 条目，桶内排在最后，只在没有更具体的条目匹配时生效
+EXTRA_ENCODINGS = [
+    (0x1E000000, 0x04000000, "SVE"),    # op0 = 0010：SVE 编码空间
+    (0x9E000000, 0x80000000, "SME"),    # op0 = 0000 且 bit[31] = 1：SME 编码空间
+]
+
+
+def field_width(token):
+    if re.fullmatch(r"[01xXMW]+", token):
+        return len(token)
+    m = re.fullmatch(r"[\w!]+\[(\d+):(\d+)\]", token)
+    if m:
+        return int(m.group(1)) - int(m.group(2)) + 1
+    if re.fullmatch(r"[\w!]+\[\d+\]", token):
+        return 1
+    if ":" in token:
+        return int(token.rsplit(":", 1)[1].strip(" ]"))
+    if token in FIELD_WIDTHS:
+        return FIELD_WIDTHS[token]
+    if re.fullmatch(r"[RVZ][a-z0-9]*", token):
+        return 5
+    if re.fullmatch(r"P[a-z]*", token):
+        return 4
+    return None
+
+
+def encoding_pattern(entry):
+    """op 字段的 (mask, value)"""
+    mask = value = 0
+    pos = 32
+    for token in entry["op"].split("|"):
+        token = token.strip()
+        width = field_width(token)
+        if width is None:
+            sys.exit("错误：%s 的编码中有未知字段 %s" % (entry["inst"], token))
+        literal = re.fullmatch(r"[01xXMW]+", token)
+        for i in range(width):
+            pos -= 1
+            if literal and token[i] in "01":
+                mask |= 1 << pos
+                value |= int(token[i]) << pos
+    if pos != 0:
+        sys.exit("错误：%s 的编码不是32位：%s" % (entry["inst"], entry["op"]))
+    return mask, value
+
+
+def overlaps(a, b):
+    return ((a[1] ^ b[1]) & a[0] & b[0]) == 0
+
+
+def build_ext_buckets(isa):
+    """
+    返回每个桶的 [(mask, value, ext)]：桶内按固定位数从多到少排列（同样多时保持
+    JSON 中的顺序），第一个匹配的条目决定扩展，没有匹配时为基础指令集。
+    条目级 ext（D128/XS）优先于分组 ext；同一编码出现多次时取第一次
+    """
+    patterns = []
+    seen = set()
+    for group in isa["instructions"]:
+        for entry in group["data"]:
+            mask, value = encoding_pattern(entry)
+            if (mask, value) in seen:
+                continue
+            seen.add((mask, value))
+            patterns.append((mask, value, entry.get("ext") or group.get("ext") or "BASE"))
+    patterns += EXTRA_ENCODINGS
+    patterns.sort(key=lambda p: -bin(p[0]).count("1"))
+
+    key_mask = (1 << EXT_BUCKET_BITS) - 1
+    buckets = [[] for _ in range(1 << EXT_BUCKET_BITS)]
+    for p in patterns:
+        km = (p[0] >> EXT_BUCKET_SHIFT) & key_mask
+        kv = (p[1] >> EXT_BUCKET_SHIFT) & key_mask
+        for key in range(1 << EXT_BUCKET_BITS):
+            if key & km == kv:
+                buckets[key].append(p)
+
+    # 去掉不影响结果的条目：被前面的条目完全覆盖的，以及后面没有可能被它挡住的
+    # 非基础扩展条目的基础指令集条目
+    for key, bucket in enumerate(buckets):
+        kept = []
+        for i, p in enumerate(bucket):
+            if any(q[0] & p[0] == q[0] and (p[1] & q[0]) == q[1] for q in kept):
+                continue
+            if p[2] == "BASE" and not any(q[2] != "BASE" and overlaps(p, q)
+                                          for q in bucket[i + 1:]):
+                continue
+            kept.append(p)
+        buckets[key] = kept
+    return buckets
+
+
+def category_matches(domain, category):
+    if domain == "GP":
+        return category.startswith("GP")
+    if domain == "FP":
+        return category == "ASIMD"
+    return category.startswith("GP") or category == "ASIMD"
+
+
+def mnemonic_of(entry):
+    return entry["inst"].split(" ", 1)[0]
+
+
+def operands_of(entry):
+    parts = entry["inst"].split(" ", 1)
+    return parts[1] if len(parts) > 1 else ""
+
+
+def build_props(isa, type_name, meta):
+    """计算一个指令类型的属性集合与所需扩展"""
+    domain, mnemonics, extra = meta
+    props = set(extra)
+    exts = []
+
+    for group in isa["instructions"]:
+        if not category_matches(domain, group["category"]):
+            continue
+        for entry in group["data"]:
+            if mnemonic_of(entry) not in mnemonics:
+                continue
+
+            for token in entry.get("io", "").split():
+                flag, _, mode = token.partition("=")
+                if flag in NZCV_FLAGS:
+                    if mode in ("W", "X"):
+                        props.add("SETS_FLAGS")
+                    if mode in ("R", "X"):
+                        props.add("READS_FLAGS")
+
+            control = entry.get("control")
+            if control:
+                props.update(CONTROL_PROPS[control])
+                # 操作数以寄存器开头的无条件跳转（br/blr/ret）目标来自寄存器
+                if control != "branch" and re.match(r"X[nm]", operands_of(entry)):
+                    props.add("INDIRECT")
+
+            # 内存操作数形如 [Xn|SP, ...] 或 [PC, ...]，排除向量元素下标 Vn.S[#i]
+            if re.search(r"\[(Xn|PC)", operands_of(entry)) and "ATOMIC" not in props:
+                props.add("MEM_WRITE" if mnemonic_of(entry).startswith("st") else "MEM_READ")
+
+            if group["category"] == "ASIMD" and domain == "FP":
+                props.add("FP_SIMD")
+
+            # 条目级 ext（D128/XS）只标记同一指令的变体形式，类型级要求取分组扩展
+            exts.append(group.get("ext") or "BASE")
+
+    if not exts:
+        sys.exit("错误：%s 的助记符 %s 在JSON中没有匹配条目" % (type_name, mnemonics))
+
+    # 取最低要求：基础指令集优先，其次是 ASIMD 基础集，否则取首次出现的扩展
+    for preferred in ("BASE", "ASIMD"):
+        if preferred in exts:
+            return props, preferred
+    return props, exts[0]
+
+
+HEADER_TEMPLATE = """\
+/**
+ * ARM64反汇编器 - 指令扩展特性枚举
+ * 此文件由 gen_inst_props.py 根据 isa_aarch64.json 生成，请勿手工修改
+ */
+
+#ifndef ARM64_INST_PROPS_H
+#define ARM64_INST_PROPS_H
+
+#include <stdint.h>
+
+/* 指令所需的架构扩展（ARM64_EXT_BASE 表示 ARMv8.0 基础指令集） */
+typedef enum {
+%s
+    ARM64_EXT_COUNT
+} arm64_ext_t;
+
+/* 编码 -> 扩展分类表的分桶：桶号为 bits[31:%d] */
+#define ARM64_EXT_BUCKET_SHIFT  %d
+#define ARM64_EXT_BUCKETS       %d
+#define ARM64_EXT_PATTERNS      %d
+
+/* 一个编码模式：(raw & mask) == value */
+typedef struct {
+    uint32_t mask;
+    uint32_t value;
+} arm64_ext_pattern_t;
+
+#endif /* ARM64_INST_PROPS_H */
+"""
+
+SOURCE_TEMPLATE = """\
+/**
+ * ARM64反汇编器 - 指令属性表
+ * 此文件由 gen_inst_props.py 根据 isa_aarch64.json 生成，请勿手工修改
+ */
+
+#include "arm64_disasm.h"
+
+/* 按指令类型直接索引的属性位（INST_PROP_*） */
+const uint32_t inst_prop_table[INST_TYPE_COUNT] = {
+%s
+};
+
+/* 按指令类型直接索引的最低扩展要求（arm64_ext_t） */
+const uint8_t inst_ext_table[INST_TYPE_COUNT] = {
+%s
+};
+
+/* 扩展名称 */
+const char *const arm64_ext_names[ARM64_EXT_COUNT] = {
+%s
+};
+
+/* 指令类型名称（该类型的基本助记符，B.cond 为 "b"） */
+const char *const inst_type_names[INST_TYPE_COUNT] = {
+%s
+};
+
+/*
+ * 编码 -> 扩展分类表：桶 k 的条目为 arm64_ext_patterns[arm64_ext_buckets[k] ..
+ * arm64_ext_buckets[k + 1])，按固定位数从多到少排列，第一个匹配的条目决定扩展，
+ * 没有匹配时为基础指令集；匹配时扫描的 mask/value 与命中后才读取的扩展分开存放
+ */
+const uint16_t arm64_ext_buckets[ARM64_EXT_BUCKETS + 1] = {
+%s
+};
+
+const arm64_ext_pattern_t arm64_ext_patterns[ARM64_EXT_PATTERNS] = {
+%s
+};
+
+/* 各模式的扩展（arm64_ext_t） */
+const uint8_t arm64_ext_pattern_exts[ARM64_EXT_PATTERNS] = {
+%s
+};
+"""
+
+
+def write_file(path, content):
+    # 内容未变时不重写，避免触发无谓的重新编译
+    try:
+        with open(path, encoding="utf-8", newline="\n") as f:
+            if f.read() == content:
+                return
+    except FileNotFoundError:
+        pass
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    json_path, header_path, out_dir = sys.argv[1:]
+
+    with open(json_path, encoding="utf-8") as f:
+        isa = json.load(f)
+
+    types = parse_inst_types(header_path)
+    missing = [t for t in types if t not in DECODER_META]
+    if missing:
+        sys.exit("错误：以下指令类型缺少解码器元数据：%s" % ", ".join(missing))
+
+    exts = collect_extensions(isa)
+    width = max(len(t) for t in types) + 1
+
+    prop_lines = []
+    ext_lines = []
+    type_name_lines = []
+    for t in types:
+        meta = DECODER_META[t]
+        if meta is None:
+            prop_lines.append("    [%s]%s= 0," % (t, " " * (width - len(t))))
+            ext_lines.append("    [%s]%s= ARM64_EXT_BASE," % (t, " " * (width - len(t))))
+            type_name_lines.append('    [%s]%s= "unknown",' % (t, " " * (width - len(t))))
+            continue
+        type_name_lines.append('    [%s]%s= "%s",' % (t, " " * (width - len(t)),
+                                                      meta[1][0].split(".")[0]))
+        props, ext = build_props(isa, t, meta)
+        value = " | ".join("INST_PROP_" + p for p in sorted(props)) or "0"
+        prop_lines.append("    [%s]%s= %s," % (t, " " * (width - len(t)), value))
+        ext_lines.append("    [%s]%s= %s," % (t, " " * (width - len(t)), ext_ident(ext)))
+
+    buckets = build_ext_buckets(isa)
+    offsets = [0]
+    pattern_items = []
+    pattern_exts = []
+    for bucket in buckets:
+        for mask, value, ext in bucket:
+            pattern_items.append("{ 0x%08X, 0x%08X }," % (mask, value))
+            pattern_exts.append("%d," % exts.index(ext))
+        offsets.append(len(pattern_items))
+    if len(pattern_items) > 0xFFFF:
+        sys.exit("错误：扩展分类表超过 65535 个条目")
+
+    def rows(items, per_row):
+        return "\n".join("    " + " ".join(items[i:i + per_row])
+                         for i in range(0, len(items), per_row))
+
+    enum_lines = ["    %s,%s" % (ext_ident(e), "" if i else "  /* 基础指令集 */")
+                  for i, e in enumerate(exts)]
+    name_lines = ['    "%s",' % e.lower() for e in exts]
+
+    write_file(os.path.join(out_dir, "arm64_inst_props.h"),
+                     HEADER_TEMPLATE % ("\n".join(enum_lines),
+                                        EXT_BUCKET_SHIFT, EXT_BUCKET_SHIFT,
+                                        1 << EXT_BUCKET_BITS, len(pattern_items)))
+    write_file(os.path.join(out_dir, "arm64_inst_props.c"),
+                     SOURCE_TEMPLATE % ("\n".join(prop_lines),
+                                        "\n".join(ext_lines),
+                                        "\n".join(name_lines),
+                                        "\n".join(type_name_lines),
+                                        rows(["%d," % o for o in offsets], 16),
+                                        rows(pattern_items, 3),
+                                        rows(pattern_exts, 24)))
+
+
+if __name__ == "__main__":
+    main()
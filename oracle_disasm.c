@@ -0,0 +1,833 @@
+/**
+ * ARM64反汇编器 - 差分校验工具
+ * 以 disassemble_arm64 为参考，在随机、穷举区域和真实二进制语料上并行运行其他解码路径
+ * （批量、大端批量、访问者、按目标配置解码、轨迹缓存、快速分类、Capstone 兼容接口、
+ * 编码往返），比较 disasm_inst_t
+ * 的全部字段或格式化文本；不一致时缩小到单个指令字，不能单独复现的给出最短前置上下文
+ *
+ * 新增的优化路径只需实现 run/same/show 三个函数并登记到 paths 表
+ *
+ * 用法：oracle_disasm [-j 线程] [-p 路径,...] [-m 报告上限] [-s 种子] [-r 数量]
+ *                     [-e 值/掩码]... [-b 基址] [-E] [文件...]
+ */
+
+#include "arm64_disasm.h"
+#include "arm64_capstone.h"
+#include "arm64_trace.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* 每个任务块的指令字数量 */
+#define CHUNK_WORDS 4096
+
+/* 候选路径文本的容量 */
+#define TEXT_SIZE 160
+
+#define MAX_PATHS 16
+#define MAX_REGIONS 16
+#define MAX_FILES 16
+
+/* ========== 工作线程状态 ========== */
+
+typedef struct {
+    uint32_t words[CHUNK_WORDS];
+    uint8_t bytes[CHUNK_WORDS * 4];
+    disasm_inst_t ref[CHUNK_WORDS];         // 参考解码结果
+    bool ref_ok[CHUNK_WORDS];
+    disasm_inst_t alt[CHUNK_WORDS];         // 候选路径的结果
+    bool alt_ok[CHUNK_WORDS];
+    char text[CHUNK_WORDS][TEXT_SIZE];      // 候选路径产生的文本
+    encode_roundtrip_t roundtrip[CHUNK_WORDS];  // 编码往返结果
+    uint32_t encoded[CHUNK_WORDS];          // 重新编码得到的指令字
+    csh cs;
+    cs_insn *insn;
+    uint64_t words_done;
+    uint64_t mismatches[MAX_PATHS];
+} worker_t;
+
+/* ========== 候选路径 ========== */
+
+/*
+ * run  对 w->words[first, first + count) 运行候选路径，结果写入 alt/alt_ok/text 的相同下标
+ *      （addr 为 words[first] 的地址）
+ * same 比较下标 i 处的候选结果与参考结果
+ * show 描述下标 i 处的候选结果（用于报告）
+ */
+typedef struct {
+    const char *name;
+    const char *desc;
+    void (*run)(worker_t *w, size_t first, size_t count, uint64_t addr);
+    bool (*same)(worker_t *w, size_t i);
+    void (*show)(worker_t *w, size_t i, char *buf, size_t size);
+} path_t;
+
+static void put_le(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void put_be(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+/* disasm_inst_t 的标量字段（助记符和操作数单独比较） */
+#define FIELD(f) { #f, offsetof(disasm_inst_t, f), sizeof(((disasm_inst_t *)0)->f) }
+
+static const struct {
+    const char *name;
+    size_t offset;
+    size_t size;
+} inst_fields[] = {
+    FIELD(raw), FIELD(address), FIELD(type),
+    FIELD(rd), FIELD(rn), FIELD(rm), FIELD(rt2), FIELD(ra),
+    FIELD(rd_type), FIELD(rn_type), FIELD(rm_type),
+    FIELD(imm), FIELD(has_imm), FIELD(addr_mode), FIELD(extend_type), FIELD(shift_amount),
+    FIELD(cond), FIELD(is_64bit), FIELD(set_flags), FIELD(is_acquire), FIELD(is_release),
+    FIELD(operand_count),
+};
+
+#undef FIELD
+
+/**
+ * 列出两个解码结果不同的字段，相同时返回0
+ * 两边都由 init_disasm_inst 清零后填写，整体相同时只需一次 memcmp
+ */
+static size_t inst_diff(const disasm_inst_t *a, const disasm_inst_t *b, char *buf, size_t size) {
+    size_t n = 0, len = 0;
+    if (buf && size) {
+        buf[0] = '\0';
+    }
+    if (memcmp(a, b, sizeof(*a)) == 0) {
+        return 0;
+    }
+
+#define NOTE(...)                                                       \
+    do {                                                                \
+        if (buf && len < size) {                                        \
+            len += (size_t)snprintf(buf + len, size - len, __VA_ARGS__); \
+        }                                                               \
+        n++;                                                            \
+    } while (0)
+
+    for (size_t k = 0; k < sizeof(inst_fields) / sizeof(inst_fields[0]); k++) {
+        if (memcmp((const char *)a + inst_fields[k].offset,
+                   (const char *)b + inst_fields[k].offset, inst_fields[k].size) != 0) {
+            NOTE("%s%s", n ? "," : "", inst_fields[k].name);
+        }
+    }
+    if (strncmp(a->mnemonic, b->mnemonic, sizeof(a->mnemonic)) != 0) {
+        NOTE("%smnemonic", n ? "," : "");
+    }
+    size_t ops = a->operand_count < b->operand_count ? a->operand_count : b->operand_count;
+    for (size_t k = 0; k < ops && k < DISASM_MAX_OPERANDS; k++) {
+        if (memcmp(&a->operands[k], &b->operands[k], sizeof(a->operands[k])) != 0) {
+            NOTE("%soperands[%zu]", n ? "," : "", k);
+        }
+    }
+#undef NOTE
+    return n;
+}
+
+static bool same_inst(worker_t *w, size_t i) {
+    return w->alt_ok[i] == w->ref_ok[i] && inst_diff(&w->ref[i], &w->alt[i], NULL, 0) == 0;
+}
+
+static void show_inst(worker_t *w, size_t i, char *buf, size_t size) {
+    char text[TEXT_SIZE], fields[256];
+    format_instruction(&w->alt[i], text, sizeof(text));
+    inst_diff(&w->ref[i], &w->alt[i], fields, sizeof(fields));
+    snprintf(buf, size, "%s%s  [不同字段: %s]", w->alt_ok[i] ? "" : "(失败) ", text,
+             fields[0] ? fields : "无");
+}
+
+/* 批量反汇编：小端字节缓冲区 */
+static void run_batch(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    for (size_t i = 0; i < count; i++) {
+        put_le(&w->bytes[i * 4], w->words[first + i]);
+    }
+    disassemble_buffer(w->bytes, count * 4, addr, ARM64_ENDIAN_LITTLE, &w->alt[first], count);
+    for (size_t i = first; i < first + count; i++) {
+        w->alt_ok[i] = w->alt[i].type != INST_TYPE_UNKNOWN;
+    }
+}
+
+/* 批量反汇编：大端字节缓冲区（向量化字节交换） */
+static void run_batch_be(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    for (size_t i = 0; i < count; i++) {
+        put_be(&w->bytes[i * 4], w->words[first + i]);
+    }
+    disassemble_buffer(w->bytes, count * 4, addr, ARM64_ENDIAN_BIG, &w->alt[first], count);
+    for (size_t i = first; i < first + count; i++) {
+        w->alt_ok[i] = w->alt[i].type != INST_TYPE_UNKNOWN;
+    }
+}
+
+typedef struct {
+    worker_t *w;
+    size_t next;
+} visit_ctx_t;
+
+static bool collect(const disasm_inst_t *insts, size_t count, void *ctx) {
+    visit_ctx_t *v = (visit_ctx_t *)ctx;
+    for (size_t i = 0; i < count; i++, v->next++) {
+        v->w->alt[v->next] = insts[i];
+        v->w->alt_ok[v->next] = insts[i].type != INST_TYPE_UNKNOWN;
+    }
+    return true;
+}
+
+/* 流式反汇编：不过滤，每条指令都经过批缓冲区 */
+static void run_visit(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    visit_ctx_t v = { w, first };
+    disassemble_visit(&w->words[first], count, addr, NULL, collect, &v);
+}
+
+/* 目标配置 "all"：启用全部扩展时必须与 disassemble_arm64 完全相同 */
+static arm64_target_t all_target;
+
+static void run_target(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    for (size_t i = first; i < first + count; i++, addr += 4) {
+        w->alt_ok[i] = disassemble_arm64_target(&all_target, w->words[i], addr, &w->alt[i]);
+    }
+}
+
+/* 轨迹缓存：以 PC 为键的解码缓存，比较类型、有效标志和（截断后的）格式化文本 */
+static void run_trace(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    arm64_trace_cache_t cache;
+    for (size_t i = 0; i < count; i++) {
+        put_le(&w->bytes[i * 4], w->words[first + i]);
+    }
+    if (!arm64_trace_cache_init(&cache, count * 2, w->bytes, count * 4, addr,
+                                ARM64_ENDIAN_LITTLE)) {
+        fprintf(stderr, "内存不足\n");
+        exit(1);
+    }
+    /* 先倒序再正序查找，第二遍全部命中缓存 */
+    for (size_t i = count; i-- > 0;) {
+        arm64_trace_lookup(&cache, addr + i * 4);
+    }
+    for (size_t i = 0; i < count; i++) {
+        const arm64_trace_entry_t *e = arm64_trace_lookup(&cache, addr + i * 4);
+        w->alt[first + i].type = (inst_type_t)e->type;
+        w->alt[first + i].raw = e->raw;
+        w->alt_ok[first + i] = (e->flags & ARM64_TRACE_VALID) != 0;
+        memcpy(w->text[first + i], e->text, sizeof(e->text));
+    }
+    arm64_trace_cache_free(&cache);
+}
+
+static bool same_trace(worker_t *w, size_t i) {
+    char text[ARM64_TRACE_TEXT_SIZE];
+    if (w->alt_ok[i] != w->ref_ok[i] || w->alt[i].type != w->ref[i].type ||
+        w->alt[i].raw != w->ref[i].raw) {
+        return false;
+    }
+    format_instruction(&w->ref[i], text, sizeof(text));
+    return strcmp(text, w->text[i]) == 0;
+}
+
+static void show_trace(worker_t *w, size_t i, char *buf, size_t size) {
+    snprintf(buf, size, "%s%s  [类型 %s, 编码 0x%08x]", w->alt_ok[i] ? "" : "(失败) ",
+             w->text[i], get_inst_type_name(w->alt[i].type), w->alt[i].raw);
+}
+
+/*
+ * 快速分类：命中时类型必须与完整解码一致，未命中不算不一致
+ * 屏障指令按快速表的约定例外（完整解码器尚不支持）
+ */
+static void run_fast(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    (void)addr;
+    for (size_t i = first; i < first + count; i++) {
+        inst_type_t type = INST_TYPE_UNKNOWN;
+        w->alt_ok[i] = arm64_fast_classify(w->words[i], &type);
+        w->alt[i].type = type;
+    }
+}
+
+static bool same_fast(worker_t *w, size_t i) {
+    if (!w->alt_ok[i]) {
+        return true;
+    }
+    if (!w->ref_ok[i]) {
+        return (inst_type_props(w->alt[i].type) & INST_PROP_BARRIER) != 0;
+    }
+    return w->alt[i].type == w->ref[i].type;
+}
+
+static void show_fast(worker_t *w, size_t i, char *buf, size_t size) {
+    snprintf(buf, size, "快速分类为 %s", get_inst_type_name(w->alt[i].type));
+}
+
+/* Capstone 兼容接口：逐条 cs_disasm_iter，比较指令ID、助记符和操作数文本 */
+static void run_capstone(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    for (size_t i = 0; i < count; i++) {
+        put_le(&w->bytes[i * 4], w->words[first + i]);
+    }
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *code = &w->bytes[i * 4];
+        size_t size = 4;
+        uint64_t pc = addr + i * 4;
+        disasm_inst_t *alt = &w->alt[first + i];
+        w->alt_ok[first + i] = cs_disasm_iter(w->cs, &code, &size, &pc, w->insn);
+        if (w->alt_ok[first + i]) {
+            alt->type = (inst_type_t)w->insn->id;
+            memcpy(alt->mnemonic, w->insn->mnemonic, sizeof(alt->mnemonic));
+            alt->mnemonic[sizeof(alt->mnemonic) - 1] = '\0';
+            snprintf(w->text[first + i], TEXT_SIZE, "%s", w->insn->op_str);
+        }
+    }
+}
+
+static bool same_capstone(worker_t *w, size_t i) {
+    char ops[TEXT_SIZE];
+    if (w->alt_ok[i] != w->ref_ok[i]) {
+        return false;
+    }
+    if (!w->ref_ok[i]) {
+        return true;
+    }
+    inst_type_t id = w->ref[i].type == INST_TYPE_BCOND ? INST_TYPE_B : w->ref[i].type;
+    format_instruction_operands(&w->ref[i], ops, sizeof(ops));
+    return w->alt[i].type == id && strcmp(w->alt[i].mnemonic, w->ref[i].mnemonic) == 0 &&
+           strcmp(ops, w->text[i]) == 0;
+}
+
+static void show_capstone(worker_t *w, size_t i, char *buf, size_t size) {
+    if (!w->alt_ok[i]) {
+        snprintf(buf, size, "(失败)");
+        return;
+    }
+    snprintf(buf, size, "%s %s  [id %s]", w->alt[i].mnemonic, w->text[i],
+             get_inst_type_name(w->alt[i].type));
+}
+
+/*
+ * 编码往返：能解码的指令字重新编码后，重新解码的结果必须与原结果相同，
+ * 且只能在架构规定忽略的字段上不同（过度接受同样算不一致）；编码器不支持的形式不算
+ */
+static void run_encode(worker_t *w, size_t first, size_t count, uint64_t addr) {
+    for (size_t i = first; i < first + count; i++, addr += 4) {
+        w->encoded[i] = w->words[i];
+        w->roundtrip[i] = encode_roundtrip(w->words[i], addr, &w->encoded[i]);
+        w->alt_ok[i] = w->roundtrip[i] != ENCODE_ROUNDTRIP_UNDECODED;
+    }
+}
+
+static bool same_encode(worker_t *w, size_t i) {
+    return w->alt_ok[i] == w->ref_ok[i] && w->roundtrip[i] != ENCODE_ROUNDTRIP_MISMATCH &&
+           w->roundtrip[i] != ENCODE_ROUNDTRIP_OVER_ACCEPT;
+}
+
+static void show_encode(worker_t *w, size_t i, char *buf, size_t size) {
+    static const char *const names[] = {
+        "完全相同", "等价编码", "不一致", "不支持", "无法解码", "解码器过度接受",
+    };
+    char text[TEXT_SIZE];
+    disasm_inst_t again;
+    disassemble_arm64(w->encoded[i], w->ref[i].address, &again);
+    format_instruction(&again, text, sizeof(text));
+    snprintf(buf, size, "%s: 重新编码 0x%08x -> %s", names[w->roundtrip[i]], w->encoded[i], text);
+}
+
+static const path_t paths[] = {
+    { "batch",    "disassemble_buffer（小端）",        run_batch,    same_inst,     show_inst },
+    { "batch-be", "disassemble_buffer（大端）",        run_batch_be, same_inst,     show_inst },
+    { "visit",    "disassemble_visit（不过滤）",       run_visit,    same_inst,     show_inst },
+    { "target",   "disassemble_arm64_target（all）",   run_target,   same_inst,     show_inst },
+    { "trace",    "arm64_trace 地址缓存",              run_trace,    same_trace,    show_trace },
+    { "fast",     "arm64_fast_classify",               run_fast,     same_fast,     show_fast },
+    { "capstone", "cs_disasm_iter",                    run_capstone, same_capstone, show_capstone },
+    { "encode",   "encode_roundtrip（解码→编码→比较）", run_encode,   same_encode,   show_encode },
+};
+
+#define PATH_COUNT (sizeof(paths) / sizeof(paths[0]))
+
+/* ========== 语料 ========== */
+
+typedef enum { CORPUS_RANDOM, CORPUS_REGION, CORPUS_FILE } corpus_kind_t;
+
+typedef struct {
+    corpus_kind_t kind;
+    char name[96];
+    uint64_t total;             // 指令字总数
+    uint64_t base;              // 第一个指令字的地址
+    uint64_t seed;              // 随机
+    uint32_t value, mask;       // 穷举区域：所有满足 (w & mask) == value 的指令字
+    const uint8_t *data;        // 文件
+    size_t size;
+    arm64_endian_t endian;
+} corpus_t;
+
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/* 把 index 的各位依次放入 free 的各个置位位置 */
+static uint32_t deposit_bits(uint64_t index, uint32_t free) {
+    uint32_t result = 0;
+    for (uint32_t bit = 1; free; bit <<= 1) {
+        if (free & bit) {
+            if (index & 1) {
+                result |= bit;
+            }
+            index >>= 1;
+            free &= ~bit;
+        }
+    }
+    return result;
+}
+
+/**
+ * 生成第 chunk 块的指令字
+ * 每块的内容只取决于语料和块号，与线程数无关
+ * @return 指令字数量
+ */
+static size_t corpus_fill(const corpus_t *c, uint64_t chunk, uint32_t *words, uint64_t *addr) {
+    uint64_t start = chunk * CHUNK_WORDS;
+    size_t n = (size_t)(c->total - start < CHUNK_WORDS ? c->total - start : CHUNK_WORDS);
+    *addr = c->base + start * 4;
+
+    switch (c->kind) {
+        case CORPUS_RANDOM: {
+            uint64_t state = c->seed ^ (chunk * 0xD1B54A32D192ED03ull);
+            for (size_t i = 0; i < n; i += 2) {
+                uint64_t r = splitmix64(&state);
+                words[i] = (uint32_t)r;
+                if (i + 1 < n) {
+                    words[i + 1] = (uint32_t)(r >> 32);
+                }
+            }
+            break;
+        }
+        case CORPUS_REGION: {
+            /* (x - free) & free 按递增顺序枚举 free 的子集 */
+            uint32_t free = ~c->mask;
+            uint32_t x = deposit_bits(start, free);
+            for (size_t i = 0; i < n; i++) {
+                words[i] = c->value | x;
+                x = (x - free) & free;
+            }
+            break;
+        }
+        case CORPUS_FILE:
+            arm64_load_words(c->data + start * 4, n * 4, c->endian, words);
+            break;
+    }
+    return n;
+}
+
+/* ========== 报告 ========== */
+
+typedef struct {
+    const char *path;
+    const char *corpus;
+    uint32_t raw;
+    uint64_t addr;
+    size_t context;             // 复现所需的前置指令字数量，0 表示单独即可复现
+    bool flaky;                 // 在原块中也无法再次复现
+    char expected[TEXT_SIZE];
+    char actual[TEXT_SIZE * 3];
+} report_t;
+
+static pthread_mutex_t report_lock = PTHREAD_MUTEX_INITIALIZER;
+static report_t *reports;
+static size_t report_count, report_limit = 20;
+
+/* ========== 调度 ========== */
+
+typedef struct {
+    const corpus_t *corpus;
+    const path_t *active[MAX_PATHS];
+    size_t active_count;
+    uint64_t chunks;
+    uint64_t next_chunk;        // 原子递增
+} job_t;
+
+/* 重新运行 [s, i] 并检查下标 i 是否仍不一致 */
+static bool reproduces(worker_t *w, const path_t *p, size_t s, size_t i, uint64_t addr) {
+    p->run(w, s, i - s + 1, addr + s * 4);
+    return !p->same(w, i);
+}
+
+/**
+ * 缩小不一致：先单独重放该指令字；不能复现时二分查找仍能复现的最短前置上下文
+ * （假设上下文越长越容易复现）；addr 为块首地址
+ * @return 前置上下文长度，SIZE_MAX 表示整块重放也无法复现
+ */
+static size_t minimize(worker_t *w, const path_t *p, size_t i, uint64_t addr) {
+    if (reproduces(w, p, i, i, addr)) {
+        return 0;
+    }
+    if (!reproduces(w, p, 0, i, addr)) {
+        return SIZE_MAX;
+    }
+    size_t lo = 0, hi = i;      // lo 处开始可复现，hi 处开始不可复现
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (reproduces(w, p, mid, i, addr)) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    reproduces(w, p, lo, i, addr);
+    return i - lo;
+}
+
+static void record(worker_t *w, const job_t *job, const path_t *p, size_t i, uint64_t addr) {
+    pthread_mutex_lock(&report_lock);
+    bool full = report_count >= report_limit;
+    pthread_mutex_unlock(&report_lock);
+    if (full) {
+        return;
+    }
+
+    report_t r;
+    memset(&r, 0, sizeof(r));
+    r.context = minimize(w, p, i, addr);
+    r.flaky = r.context == SIZE_MAX;
+    r.path = p->name;
+    r.corpus = job->corpus->name;
+    r.raw = w->words[i];
+    r.addr = addr + i * 4;
+    format_instruction(&w->ref[i], r.expected, sizeof(r.expected));
+    p->show(w, i, r.actual, sizeof(r.actual));
+
+    pthread_mutex_lock(&report_lock);
+    if (report_count < report_limit) {
+        reports[report_count++] = r;
+    }
+    pthread_mutex_unlock(&report_lock);
+}
+
+typedef struct {
+    job_t *job;
+    worker_t *w;
+} thread_arg_t;
+
+static void *worker_main(void *arg) {
+    job_t *job = ((thread_arg_t *)arg)->job;
+    worker_t *w = ((thread_arg_t *)arg)->w;
+
+    for (;;) {
+        uint64_t chunk = __atomic_fetch_add(&job->next_chunk, 1, __ATOMIC_RELAXED);
+        if (chunk >= job->chunks) {
+            break;
+        }
+        uint64_t addr;
+        size_t n = corpus_fill(job->corpus, chunk, w->words, &addr);
+        for (size_t i = 0; i < n; i++) {
+            w->ref_ok[i] = disassemble_arm64(w->words[i], addr + i * 4, &w->ref[i]);
+        }
+        for (size_t k = 0; k < job->active_count; k++) {
+            const path_t *p = job->active[k];
+            p->run(w, 0, n, addr);
+            for (size_t i = 0; i < n; i++) {
+                if (!p->same(w, i)) {
+                    w->mismatches[k]++;
+                    record(w, job, p, i, addr);
+                    /* 缩小时改写了 [0, i] 的候选结果，i 之后的结果仍来自整块运行 */
+                }
+            }
+        }
+        w->words_done += n;
+    }
+    return NULL;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * 用 thread_count 个线程校验一个语料
+ * @return 不一致总数
+ */
+static uint64_t run_corpus(const corpus_t *c, const path_t *const *active, size_t active_count,
+                           worker_t *workers, int thread_count) {
+    job_t job;
+    memset(&job, 0, sizeof(job));
+    job.corpus = c;
+    memcpy(job.active, active, active_count * sizeof(active[0]));
+    job.active_count = active_count;
+    job.chunks = (c->total + CHUNK_WORDS - 1) / CHUNK_WORDS;
+
+    pthread_t threads[256];
+    thread_arg_t args[256];
+    for (int t = 0; t < thread_count; t++) {
+        workers[t].words_done = 0;
+        memset(workers[t].mismatches, 0, sizeof(workers[t].mismatches));
+    }
+
+    double start = now_seconds();
+    for (int t = 0; t < thread_count; t++) {
+        args[t].job = &job;
+        args[t].w = &workers[t];
+        pthread_create(&threads[t], NULL, worker_main, &args[t]);
+    }
+    for (int t = 0; t < thread_count; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double elapsed = now_seconds() - start;
+
+    uint64_t done = 0, total_bad = 0;
+    uint64_t bad[MAX_PATHS] = {0};
+    for (int t = 0; t < thread_count; t++) {
+        done += workers[t].words_done;
+        for (size_t k = 0; k < active_count; k++) {
+            bad[k] += workers[t].mismatches[k];
+        }
+    }
+    printf("%-28s %12llu 条  %8.2f 秒  %8.1f 百万条/分钟\n", c->name, (unsigned long long)done,
+           elapsed, elapsed > 0 ? (double)done / elapsed * 60.0 / 1e6 : 0.0);
+    for (size_t k = 0; k < active_count; k++) {
+        printf("    %-10s 不一致 %llu\n", active[k]->name, (unsigned long long)bad[k]);
+        total_bad += bad[k];
+    }
+    return total_bad;
+}
+
+/* ========== 命令行 ========== */
+
+static bool map_file(const char *path, const uint8_t **data, size_t *size) {
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    *size = (size_t)st.st_size;
+    *data = NULL;
+    if (*size > 0) {
+        void *p = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        *data = p;
+    }
+    close(fd);
+    return true;
+}
+
+/* 解析 "值/掩码"（十六进制），"all" 表示全部 2^32 个指令字 */
+static bool parse_region(const char *s, uint32_t *value, uint32_t *mask) {
+    if (strcmp(s, "all") == 0) {
+        *value = *mask = 0;
+        return true;
+    }
+    char *end;
+    unsigned long long v = strtoull(s, &end, 16);
+    if (*end != '/') {
+        return false;
+    }
+    unsigned long long m = strtoull(end + 1, &end, 16);
+    if (*end != '\0' || v > 0xFFFFFFFFull || m > 0xFFFFFFFFull || (v & ~m)) {
+        return false;
+    }
+    *value = (uint32_t)v;
+    *mask = (uint32_t)m;
+    return true;
+}
+
+static const path_t *find_path(const char *name, size_t len) {
+    for (size_t k = 0; k < PATH_COUNT; k++) {
+        if (strlen(paths[k].name) == len && strncmp(paths[k].name, name, len) == 0) {
+            return &paths[k];
+        }
+    }
+    return NULL;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "用法: %s [-j 线程] [-p 路径,...] [-m 报告上限] [-s 种子] [-r 数量]\n"
+            "       [-e 值/掩码]... [-b 基址] [-E] [文件...]\n"
+            "  -j  工作线程数（默认为在线CPU数）\n"
+            "  -p  要校验的路径，逗号分隔（默认全部）\n"
+            "  -m  最多报告的不一致条数（默认20，只统计不缩小超出部分）\n"
+            "  -s  随机语料的种子\n"
+            "  -r  随机指令字数量（未指定任何语料时默认 16777216）\n"
+            "  -e  穷举满足 (w & 掩码) == 值 的全部指令字（十六进制），all 为全部 2^32 个\n"
+            "  -b  文件语料第一个字节的地址（默认0）\n"
+            "  -E  文件中的指令为大端\n"
+            "路径:\n",
+            prog);
+    for (size_t k = 0; k < PATH_COUNT; k++) {
+        fprintf(stderr, "  %-10s %s\n", paths[k].name, paths[k].desc);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const path_t *active[MAX_PATHS];
+    size_t active_count = 0;
+    corpus_t corpora[MAX_REGIONS + MAX_FILES + 1];
+    size_t corpus_count = 0;
+    uint64_t random_words = 0, seed = 0x0A6C0DE5EEDull, base = 0;
+    arm64_endian_t endian = ARM64_ENDIAN_LITTLE;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int thread_count = cpus > 0 ? (int)cpus : 1;
+    const char *files[MAX_FILES];
+    size_t file_count = 0;
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "-j") == 0 && has_value) {
+            thread_count = atoi(argv[++i]);
+        } else if (strcmp(arg, "-p") == 0 && has_value) {
+            for (const char *s = argv[++i]; *s;) {
+                size_t len = strcspn(s, ",");
+                const path_t *p = find_path(s, len);
+                if (!p || active_count >= MAX_PATHS) {
+                    usage(argv[0]);
+                    return 2;
+                }
+                active[active_count++] = p;
+                s += len + (s[len] == ',');
+            }
+        } else if (strcmp(arg, "-m") == 0 && has_value) {
+            report_limit = (size_t)strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-s") == 0 && has_value) {
+            seed = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-r") == 0 && has_value) {
+            random_words = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-e") == 0 && has_value && corpus_count < MAX_REGIONS) {
+            corpus_t *c = &corpora[corpus_count];
+            memset(c, 0, sizeof(*c));
+            c->kind = CORPUS_REGION;
+            if (!parse_region(argv[++i], &c->value, &c->mask)) {
+                usage(argv[0]);
+                return 2;
+            }
+            c->total = 1ull << (32 - __builtin_popcount(c->mask));
+            c->base = 0x100000;
+            snprintf(c->name, sizeof(c->name), "区域 %08x/%08x", c->value, c->mask);
+            corpus_count++;
+        } else if (strcmp(arg, "-b") == 0 && has_value) {
+            base = strtoull(argv[++i], NULL, 0);
+        } else if (strcmp(arg, "-E") == 0) {
+            endian = ARM64_ENDIAN_BIG;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    for (; i < argc && file_count < MAX_FILES; i++) {
+        files[file_count++] = argv[i];
+    }
+    if (i < argc || thread_count < 1 || thread_count > 256) {
+        usage(argv[0]);
+        return 2;
+    }
+    arm64_target_parse(&all_target, "all");
+    if (active_count == 0) {
+        for (size_t k = 0; k < PATH_COUNT; k++) {
+            active[active_count++] = &paths[k];
+        }
+    }
+    if (random_words == 0 && corpus_count == 0 && file_count == 0) {
+        random_words = 1u << 24;
+    }
+    if (random_words) {
+        corpus_t *c = &corpora[corpus_count++];
+        memset(c, 0, sizeof(*c));
+        c->kind = CORPUS_RANDOM;
+        c->total = random_words;
+        c->seed = seed;
+        c->base = 0x100000;
+        snprintf(c->name, sizeof(c->name), "随机 (种子 0x%llx)", (unsigned long long)seed);
+    }
+    for (size_t f = 0; f < file_count; f++) {
+        corpus_t *c = &corpora[corpus_count];
+        memset(c, 0, sizeof(*c));
+        c->kind = CORPUS_FILE;
+        if (!map_file(files[f], &c->data, &c->size)) {
+            perror(files[f]);
+            return 1;
+        }
+        c->total = c->size / 4;
+        c->base = base;
+        c->endian = endian;
+        snprintf(c->name, sizeof(c->name), "文件 %s", files[f]);
+        corpus_count++;
+    }
+
+    worker_t *workers = calloc((size_t)thread_count, sizeof(worker_t));
+    reports = calloc(report_limit ? report_limit : 1, sizeof(report_t));
+    if (!workers || !reports) {
+        fprintf(stderr, "内存不足\n");
+        return 1;
+    }
+    for (int t = 0; t < thread_count; t++) {
+        if (cs_open(CS_ARCH_ARM64, CS_MODE_ARM, &workers[t].cs) != CS_ERR_OK ||
+            !(workers[t].insn = cs_malloc(workers[t].cs))) {
+            fprintf(stderr, "内存不足\n");
+            return 1;
+        }
+    }
+
+    printf("线程 %d, 路径:", thread_count);
+    for (size_t k = 0; k < active_count; k++) {
+        printf(" %s", active[k]->name);
+    }
+    printf("\n\n");
+
+    uint64_t total_bad = 0;
+    for (size_t k = 0; k < corpus_count; k++) {
+        total_bad += run_corpus(&corpora[k], active, active_count, workers, thread_count);
+    }
+
+    if (report_count) {
+        printf("\n不一致（缩小后，最多 %zu 条）:\n", report_limit);
+        for (size_t k = 0; k < report_count; k++) {
+            const report_t *r = &reports[k];
+            printf("[%s] %s 0x%016llx: %08x", r->path, r->corpus, (unsigned long long)r->addr,
+                   r->raw);
+            if (r->flaky) {
+                printf("  (重放无法复现)\n");
+            } else if (r->context) {
+                printf("  (需要前 %zu 条指令字)\n", r->context);
+            } else {
+                printf("  (单独复现)\n");
+            }
+            printf("    参考: %s\n    候选: %s\n", r->expected, r->actual);
+        }
+    }
+    printf("\n%s\n", total_bad ? "发现不一致" : "全部一致");
+
+    for (int t = 0; t < thread_count; t++) {
+        cs_free(workers[t].insn, 1);
+        cs_close(&workers[t].cs);
+    }
+    for (size_t k = 0; k < corpus_count; k++) {
+        if (corpora[k].kind == CORPUS_FILE && corpora[k].size) {
+            munmap((void *)corpora[k].data, corpora[k].size);
+        }
+    }
+    free(workers);
+    free(reports);
+    return total_bad ? 1 : 0;
+}
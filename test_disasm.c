@@ -4,9 +4,24 @@
  */
 
 #include "arm64_disasm.h"
+#include "arm64_capstone.h"
+#include "arm64_trace.h"
+#include "arm64_alloc.h"
+#include "arm64_timeline.h"
+#include "arm64_listing.h"
+#include "arm64_peephole.h"
+#include "arm64_elf.h"
+#ifdef ARM64_DISASM_HAVE_GZIP
+#include "arm64_gzsink.h"
+#include <zlib.h>
+#endif
 #include <stdio.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 // 测试用的ARM64机器码指令
 static const uint32_t test_instructions[] = {
@@ -490,6 +505,1707 @@ static void test_detailed_output(void) {
     }
 }
 
+/**
+ * 测试字节缓冲区输入（未对齐、大/小端）
+ */
+static void test_byte_buffer_input(void) {
+    printf("\n========== 测试字节缓冲区输入 ==========\n\n");
+
+    static const uint32_t words[] = {
+        0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+        0x910003FD,  // mov x29, sp
+        0xF9400421,  // ldr x1, [x1, #8]
+        0x8B000020,  // add x0, x1, x0
+        0xA8C17BFD,  // ldp x29, x30, [sp], #16
+        0xD65F03C0,  // ret
+    };
+    size_t count = sizeof(words) / sizeof(words[0]);
+
+    /* 在奇数偏移处构造小端和大端字节流 */
+    uint8_t le_storage[sizeof(words) + 1];
+    uint8_t be_storage[sizeof(words) + 1];
+    uint8_t *le_bytes = le_storage + 1;
+    uint8_t *be_bytes = be_storage + 1;
+    for (size_t i = 0; i < count; i++) {
+        for (size_t b = 0; b < 4; b++) {
+            le_bytes[i * 4 + b] = (uint8_t)(words[i] >> (8 * b));
+            be_bytes[i * 4 + b] = (uint8_t)(words[i] >> (8 * (3 - b)));
+        }
+    }
+
+    disasm_inst_t le_insts[6], be_insts[6];
+    size_t le_count = disassemble_buffer(le_bytes, sizeof(words), 0x1000,
+                                         ARM64_ENDIAN_LITTLE, le_insts, 6);
+    size_t be_count = disassemble_buffer(be_bytes, sizeof(words), 0x1000,
+                                         ARM64_ENDIAN_BIG, be_insts, 6);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i >= le_count || i >= be_count ||
+            le_insts[i].raw != words[i] || be_insts[i].raw != words[i]) {
+            mismatches++;
+        }
+    }
+    printf("小端解码 %zu 条，大端解码 %zu 条，不一致 %zu 条\n",
+           le_count, be_count, mismatches);
+
+    disassemble_block_bytes(be_bytes, sizeof(words), 0x1000, ARM64_ENDIAN_BIG);
+}
+
+/* 访问者测试上下文 */
+typedef struct {
+    size_t batches;
+    size_t insts;
+} visit_counter_t;
+
+static bool count_visit(const disasm_inst_t *insts, size_t count, void *ctx) {
+    visit_counter_t *counter = (visit_counter_t *)ctx;
+    counter->batches++;
+    counter->insts += count;
+    for (size_t i = 0; i < count; i++) {
+        print_instruction(&insts[i]);
+    }
+    return true;
+}
+
+typedef struct {
+    size_t count;
+    uint64_t hash;
+    size_t batches;
+} visit_collect_t;
+
+static bool collect_visit(const disasm_inst_t *insts, size_t count, void *ctx) {
+    visit_collect_t *collect = (visit_collect_t *)ctx;
+    collect->batches++;
+    for (size_t i = 0; i < count; i++) {
+        collect->hash = collect->hash * 31 + insts[i].address + insts[i].type;
+        collect->count++;
+    }
+    return true;
+}
+
+/**
+ * 测试访问者流式API（仅选取分支类指令）
+ */
+static void test_visitor(void) {
+    printf("\n========== 测试访问者流式API ==========\n\n");
+
+    inst_type_set_t filter;
+    inst_type_set_clear(&filter);
+    inst_type_set_add(&filter, INST_TYPE_B);
+    inst_type_set_add(&filter, INST_TYPE_BCOND);
+    inst_type_set_add(&filter, INST_TYPE_BL);
+    inst_type_set_add(&filter, INST_TYPE_RET);
+
+    visit_counter_t counter = { 0, 0 };
+    size_t count = sizeof(test_instructions) / sizeof(test_instructions[0]);
+    size_t scanned = disassemble_visit(test_instructions, count, 0x100000,
+                                       &filter, count_visit, &counter);
+    printf("扫描 %zu 条，选中 %zu 条，回调 %zu 次\n",
+           scanned, counter.insts, counter.batches);
+    
+    /* 预筛跳过的指令字必须确实不会被选中：与逐条完整解码后过滤的结果比较 */
+    static uint32_t words[8192];
+    uint32_t seed = 0x2468ACE1;
+    for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        seed = seed * 1664525u + 1013904223u;
+        words[i] = i % 2 ? seed : test_instructions[i / 2 % count];
+    }
+    inst_type_set_t filters[3];
+    inst_type_set_clear(&filters[1]);
+    inst_type_set_add(&filters[1], INST_TYPE_UNKNOWN);
+    inst_type_set_add(&filters[1], INST_TYPE_LDR);
+    inst_type_set_clear(&filters[2]);
+    inst_type_set_add(&filters[2], INST_TYPE_DMB);
+    inst_type_set_add(&filters[2], INST_TYPE_STR);
+    filters[0] = filter;
+    for (int f = 0; f < 3; f++) {
+        visit_collect_t collect = { 0, 0, 0 };
+        disassemble_visit(words, sizeof(words) / sizeof(words[0]), 0, &filters[f],
+                          collect_visit, &collect);
+        uint64_t expect = 0;
+        size_t expect_count = 0;
+        for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+            disasm_inst_t inst;
+            disassemble_arm64(words[i], i * 4, &inst);
+            if (inst_type_set_contains(&filters[f], inst.type)) {
+                expect = expect * 31 + inst.address + inst.type;
+                expect_count++;
+            }
+        }
+        printf("过滤集合 %d: 选中 %zu 条，逐条解码 %zu 条，%s\n", f, collect.count,
+               expect_count, collect.count == expect_count && collect.hash == expect ?
+               "一致" : "不一致");
+    }
+}
+
+/**
+ * 测试操作数数组
+ */
+static void test_operands(void) {
+    printf("\n========== 测试操作数数组 ==========\n\n");
+    
+    uint32_t test_cases[] = {
+        0x92400C00,  // and x0, x0, #0xf（位掩码立即数）
+        0x8B420C20,  // add x0, x1, x2, lsr #3
+        0xF8627820,  // ldr x0, [x1, x2, lsl #3]
+        0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+        0xF2A00020,  // movk x0, #1, lsl #16
+        0x9A9F17E0,  // cset x0, eq
+        0x54000040,  // b.eq
+        0xD53B4200,  // mrs x0, nzcv
+        0xF8200041,  // ldadd x0, x1, [x2]
+    };
+    
+    disasm_inst_t inst;
+    for (size_t i = 0; i < sizeof(test_cases) / sizeof(test_cases[0]); i++) {
+        if (disassemble_arm64(test_cases[i], 0x4000 + i * 4, &inst)) {
+            print_instruction(&inst);
+            print_instruction_details(&inst);
+        }
+    }
+}
+
+/**
+ * 打印属性位名称
+ */
+static void print_props(uint32_t props) {
+    static const char *const names[] = {
+        "mem_read", "mem_write", "branch", "conditional", "call", "return",
+        "indirect", "sets_flags", "reads_flags", "barrier", "atomic",
+        "exclusive", "acquire", "release", "privileged", "exception",
+        "system", "fp_simd"
+    };
+    
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (props & (1u << i)) {
+            printf(" %s", names[i]);
+        }
+    }
+}
+
+/**
+ * 测试指令属性与扩展查询
+ */
+static void test_inst_props(void) {
+    printf("\n========== 测试指令属性 ==========\n\n");
+    
+    uint32_t test_cases[] = {
+        0xF9400020,  // ldr x0, [x1]
+        0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+        0x54000040,  // b.eq
+        0x94000010,  // bl
+        0xD63F0020,  // blr x1
+        0xD65F03C0,  // ret
+        0xD69F03E0,  // eret
+        0x36000040,  // tbz w0, #0
+        0xEB02003F,  // cmp x1, x2
+        0x9A9F17E0,  // cset x0, eq
+        0xC85FFC20,  // ldaxr x0, [x1]
+        0xF8E00041,  // ldaddal x0, x1, [x2]
+        0xD53B4200,  // mrs x0, nzcv
+        0x1E622020,  // fcmp d1, d2
+    };
+    
+    disasm_inst_t inst;
+    char buffer[128];
+    for (size_t i = 0; i < sizeof(test_cases) / sizeof(test_cases[0]); i++) {
+        if (disassemble_arm64(test_cases[i], 0x5000 + i * 4, &inst)) {
+            format_instruction(&inst, buffer, sizeof(buffer));
+            printf("%-28s [%s]", buffer, get_extension_name(get_inst_extension(&inst)));
+            print_props(get_inst_props(&inst));
+            printf("\n");
+        }
+    }
+}
+
+/**
+ * 打印往返校验统计
+ */
+static void print_verify_stats(const char *name, const encode_verify_stats_t *stats) {
+    printf("%-10s 总数 %zu: 一致 %zu, 等价 %zu, 不一致 %zu, 不支持 %zu, 无法解码 %zu, 过度接受 %zu\n",
+           name, stats->total, stats->exact, stats->equivalent, stats->mismatch,
+           stats->unsupported, stats->undecoded, stats->over_accept);
+    if (stats->mismatch) {
+        printf("           首个不一致: [%zu] 0x%08X -> 0x%08X\n", stats->first_mismatch,
+               stats->first_mismatch_raw, stats->first_mismatch_encoded);
+    }
+    if (stats->over_accept) {
+        printf("           首个过度接受: [%zu] 0x%08X\n", stats->first_over_accept,
+               stats->first_over_accept_raw);
+    }
+}
+
+/**
+ * 测试指令编码与往返校验
+ */
+static void test_encode(void) {
+    printf("\n========== 测试指令编码 ==========\n\n");
+    
+    encode_verify_stats_t stats;
+    size_t count = sizeof(test_instructions) / sizeof(test_instructions[0]);
+    encode_verify_block(test_instructions, count, 0x100000, &stats);
+    print_verify_stats("测试指令", &stats);
+    
+    /* 伪随机指令字（固定种子），覆盖保留编码和非规范编码 */
+    static uint32_t sweep[4096];
+    uint32_t seed = 0x12345678;
+    for (size_t i = 0; i < sizeof(sweep) / sizeof(sweep[0]); i++) {
+        seed = seed * 1664525u + 1013904223u;
+        sweep[i] = seed;
+    }
+    encode_verify_block(sweep, sizeof(sweep) / sizeof(sweep[0]), 0x200000, &stats);
+    print_verify_stats("随机指令", &stats);
+    
+    /* 只在可忽略字段上不同的是非规范编码；保留的 ftype 和未分配的独占编码不再解码 */
+    static const struct {
+        uint32_t raw;
+        const char *text;
+    } classify[] = {
+        { 0xC8C6F2FA, "ldar x26, [x23]（Rs/Rt2 应为1）" },
+        { 0x9224C6CC, "and x12, x22, #0x931（immr 高位）" },
+        { 0x387C5A4F, "ldrb w15, [x18, w28, uxtw #0]" },
+        { 0xC8A07C41, "cas x0, x1, [x2]" },
+        { 0xC8E0FC41, "casal x0, x1, [x2]" },
+        { 0x1EAB2879, "ftype=10 的 fadd" },
+        { 0x08A00029, "o2=1,o1=1 且 Rt2 不为31" },
+        { 0x0860002E, "size=00 的 ldxp" },
+    };
+    static const char *const results[] = {
+        "一致", "等价", "不一致", "不支持", "无法解码", "过度接受"
+    };
+    for (size_t i = 0; i < sizeof(classify) / sizeof(classify[0]); i++) {
+        printf("0x%08X %-36s %s\n", classify[i].raw, classify[i].text,
+               results[encode_roundtrip(classify[i].raw, 0, NULL)]);
+    }
+    
+    /* 修改解码结果后重新编码 */
+    printf("\n");
+    disasm_inst_t inst;
+    char before[128], after[128];
+    uint32_t word;
+    
+    static const struct {
+        uint32_t raw;
+        uint8_t rd;
+        int64_t imm;
+    } edits[] = {
+        { 0x91004020, 5, 32 },      // add x0, x1, #16   -> add x5, x1, #32
+        { 0xF9400421, 2, 64 },      // ldr x1, [x1, #8]  -> ldr x2, [x1, #64]
+        { 0x94000010, 0, -0x100 },  // bl  +0x40         -> bl  -0x100
+        { 0xB4000040, 7, 0x80 },    // cbz x0, +8        -> cbz x7, +0x80
+        { 0xD2800540, 9, 0x1234 },  // mov x0, #0x2a     -> mov x9, #0x1234
+    };
+    
+    for (size_t i = 0; i < sizeof(edits) / sizeof(edits[0]); i++) {
+        if (!disassemble_arm64(edits[i].raw, 0x3000, &inst)) {
+            continue;
+        }
+        format_instruction(&inst, before, sizeof(before));
+        inst.rd = edits[i].rd;
+        inst.imm = edits[i].imm;
+        if (encode_arm64(&inst, &word) && disassemble_arm64(word, 0x3000, &inst)) {
+            format_instruction(&inst, after, sizeof(after));
+            printf("0x%08X %-28s -> 0x%08X %s\n", edits[i].raw, before, word, after);
+        } else {
+            printf("0x%08X %-28s -> 编码失败\n", edits[i].raw, before);
+        }
+    }
+    
+    /* 超出编码范围时返回失败 */
+    disassemble_arm64(0x91004020, 0x3000, &inst);
+    inst.imm = 0x1000;
+    printf("add 立即数 0x1000: %s\n", encode_arm64(&inst, &word) ? "编码成功" : "编码失败");
+}
+
+/**
+ * 打印重定位后的指令序列
+ */
+static void print_relocated(const uint32_t *words, size_t count, uint64_t addr) {
+    disasm_inst_t inst;
+    char buffer[128];
+    for (size_t i = 0; i < count; i++) {
+        if (disassemble_arm64(words[i], addr + i * 4, &inst)) {
+            format_instruction(&inst, buffer, sizeof(buffer));
+        } else {
+            snprintf(buffer, sizeof(buffer), ".word 0x%08x", words[i]);
+        }
+        printf("    0x%016llx: %08X  %s\n", (unsigned long long)(addr + i * 4), words[i], buffer);
+    }
+}
+
+/**
+ * 测试代码重定位
+ */
+static void test_relocate(void) {
+    printf("\n========== 测试代码重定位 ==========\n\n");
+    
+    static const struct {
+        uint32_t raw;
+        uint64_t new_pc;
+        const char *desc;
+    } cases[] = {
+        { 0x14000010, 0x0000000000410000ULL, "b 范围内" },
+        { 0x14000010, 0x0000000010400000ULL, "b 超出±128MB" },
+        { 0x94000010, 0x0000123400000000ULL, "bl 超出±4GB" },
+        { 0x54000040, 0x0000000000600000ULL, "b.eq 超出±1MB" },
+        { 0x36000040, 0x0000000000410000ULL, "tbz 超出±32KB" },
+        { 0xB4000040, 0x0000000020400000ULL, "cbz 超出±128MB" },
+        { 0x10000080, 0x0000000000600000ULL, "adr 超出±1MB" },
+        { 0xB0000001, 0x0000000080400000ULL, "adrp 范围内" },
+        { 0x58000082, 0x0000000000600000ULL, "ldr 字面量 超出±1MB" },
+        { 0x1C000083, 0x0000123400000000ULL, "ldr s3 字面量 超出±4GB" },
+        { 0x8B020020, 0x0000000000600000ULL, "add 原样复制" },
+    };
+    
+    uint32_t words[ARM64_RELOC_MAX_WORDS];
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t n = arm64_relocate_inst(cases[i].raw, 0x400000, cases[i].new_pc, words);
+        printf("%s: %zu 条\n", cases[i].desc, n);
+        print_relocated(words, n, cases[i].new_pc);
+    }
+    
+    /* 复制函数序言到远处的跳板 */
+    static const uint32_t prologue[] = {
+        0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+        0x910003FD,  // mov x29, sp
+        0xB4000080,  // cbz x0, +16
+        0x90000001,  // adrp x1, 0
+    };
+    uint32_t trampoline[32];
+    size_t used = 0;
+    arm64_reloc_status_t status = arm64_relocate_block(prologue, 4, 0x400000, 0x7F0000000000ULL,
+                                                       trampoline, 32, &used);
+    printf("\n序言重定位: 状态 %d, %zu 条 -> %zu 条\n", status, (size_t)4, used);
+    print_relocated(trampoline, used, 0x7F0000000000ULL);
+    
+    status = arm64_relocate_block(prologue, 4, 0x400000, 0x7F0000000000ULL, trampoline, 4, &used);
+    printf("缓冲区不足: 状态 %d, 已写入 %zu 条\n", status, used);
+    
+    /* 批量重定位 */
+    arm64_reloc_site_t sites[64];
+    for (size_t i = 0; i < 64; i++) {
+        sites[i].raw = (i % 2) ? 0x94000000 | (uint32_t)i : 0xD503201F;
+        sites[i].old_pc = 0x400000 + i * 4;
+        sites[i].new_pc = 0x10000000 + i * 64;
+    }
+    size_t total = arm64_relocate_sites(sites, 64);
+    printf("\n批量重定位: 64 个位置, 共 %zu 条指令\n", total);
+}
+
+/**
+ * 测试JIT代码校验
+ */
+static void test_validate(void) {
+    printf("\n========== 测试JIT代码校验 ==========\n\n");
+    
+    static const uint32_t jit_code[] = {
+        0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+        0x910003FD,  // mov x29, sp
+        0xF9400800,  // ldr x0, [x0, #16]
+        0x8B020020,  // add x0, x1, x2
+        0xB4000040,  // cbz x0, +8
+        0x9A9F17E0,  // cset x0, eq
+        0xA8C17BFD,  // ldp x29, x30, [sp], #16
+        0xD65F03C0,  // ret
+    };
+    const size_t count = sizeof(jit_code) / sizeof(jit_code[0]);
+    
+    arm64_validate_policy_t policy;
+    arm64_validate_report_t report;
+    arm64_validate_policy_init(&policy);
+    
+    arm64_validate_result_t result = arm64_validate(jit_code, count, &policy, &report);
+    printf("默认策略: 结果 %d, 下标 %zu (0x%08X)\n", result, report.index, report.raw);
+    
+    policy.flags |= ARM64_VALIDATE_ALLOW_INDIRECT;
+    arm64_validate_policy_compile(&policy);
+    result = arm64_validate(jit_code, count, &policy, &report);
+    printf("允许间接分支: 结果 %d\n", result);
+    
+    /* 逐条替换为违规指令 */
+    static const struct {
+        size_t index;
+        uint32_t raw;
+        const char *desc;
+    } cases[] = {
+        { 3, 0xD4000001, "svc #0" },
+        { 3, 0xD51BD040, "msr tpidr_el0, x0" },
+        { 3, 0xD53BD040, "mrs x0, tpidr_el0" },
+        { 3, 0xD5087620, "dc ivac, x0" },
+        { 3, 0xD4200000, "brk #0" },
+        { 4, 0xB4000100, "cbz x0, 超出缓冲区" },
+        { 4, 0x97FFFFF0, "bl 缓冲区之前" },
+        { 3, 0x8B02003C, "add x28, x1, x2 写保留寄存器" },
+        { 2, 0xF8408F9B, "ldr x27, [x28, #8]! 回写保留寄存器" },
+        { 3, 0x1E602820, "fadd d0, d1, d0 类型不允许" },
+        { 3, 0x00000000, "udf #0" },
+    };
+    
+    uint32_t code[sizeof(jit_code) / sizeof(jit_code[0])];
+    policy.reserved_regs = (1u << 28) | (1u << 27);
+    inst_type_set_remove(&policy.allowed, INST_TYPE_FADD);
+    arm64_validate_policy_compile(&policy);
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        memcpy(code, jit_code, sizeof(code));
+        code[cases[i].index] = cases[i].raw;
+        result = arm64_validate(code, count, &policy, &report);
+        printf("%-36s 结果 %d, 下标 %zu\n", cases[i].desc, result, report.index);
+    }
+    
+    /* 放宽策略后 BRK 和外部调用可以通过 */
+    policy.flags |= ARM64_VALIDATE_ALLOW_BRK | ARM64_VALIDATE_ALLOW_EXTERNAL_CALL;
+    arm64_validate_policy_compile(&policy);
+    memcpy(code, jit_code, sizeof(code));
+    code[3] = 0xD4200000;
+    code[4] = 0x97FFFFF0;
+    printf("允许BRK和外部调用: 结果 %d\n", arm64_validate(code, count, &policy, NULL));
+    
+    /* 快速分类与完整解码一致 */
+    size_t agree = 0, fast = 0;
+    for (size_t i = 0; i < sizeof(test_instructions) / sizeof(test_instructions[0]); i++) {
+        inst_type_t type;
+        disasm_inst_t inst;
+        if (arm64_fast_classify(test_instructions[i], &type)) {
+            fast++;
+            if (disassemble_arm64(test_instructions[i], 0x100000, &inst) && inst.type == type) {
+                agree++;
+            }
+        }
+    }
+    printf("快速分类: %zu 条命中, %zu 条与完整解码一致\n", fast, agree);
+}
+
+/**
+ * 测试格式化输出缓冲区截断
+ */
+static void test_format_buffer(void) {
+    printf("\n========== 测试格式化缓冲区 ==========\n\n");
+    
+    disasm_inst_t inst;
+    disassemble_arm64(0xA9BF7BFD, 0x100000, &inst);  // stp x29, x30, [sp, #-16]!
+    
+    static const size_t sizes[] = { 1, 4, 9, 16, 64 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        char buffer[64];
+        memset(buffer, '#', sizeof(buffer));
+        format_instruction(&inst, buffer, sizes[i]);
+        printf("缓冲区 %2zu 字节: \"%s\"\n", sizes[i], buffer);
+    }
+    
+    char reg[16];
+    get_register_name(17, REG_TYPE_Q, reg);
+    printf("寄存器名: %s", reg);
+    get_register_name(40, REG_TYPE_X, reg);
+    printf(" %s\n", reg);
+}
+
+/**
+ * 测试Capstone兼容接口
+ */
+static void test_capstone(void) {
+    printf("\n========== 测试Capstone兼容接口 ==========\n\n");
+    
+    static const uint8_t code[] = {
+        0xFD, 0x7B, 0xBF, 0xA9,  // stp x29, x30, [sp, #-16]!
+        0x20, 0x04, 0x44, 0xF8,  // ldr x0, [x1], #64
+        0x20, 0x68, 0x60, 0xF8,  // ldr x0, [x1, x0]
+        0x20, 0x0C, 0x02, 0x8B,  // add x0, x1, x2, lsl #3
+        0x3F, 0x00, 0x00, 0xEB,  // cmp x1, x0
+        0x40, 0x00, 0x00, 0x54,  // b.eq +8
+        0x00, 0x00, 0x00, 0x94,  // bl +0
+        0xE0, 0x07, 0x9F, 0x1A,  // cset w0, ne
+        0x00, 0x42, 0x3B, 0xD5,  // mrs x0, NZCV
+        0xC0, 0x03, 0x5F, 0xD6,  // ret
+        0xFF, 0xFF, 0xFF, 0xFF,  // 未分配编码
+        0x1F, 0x20, 0x03, 0xD5,  // nop
+    };
+    
+    csh handle;
+    cs_insn *insn;
+    if (cs_open(CS_ARCH_ARM64, CS_MODE_LITTLE_ENDIAN, &handle) != CS_ERR_OK) {
+        printf("cs_open 失败\n");
+        return;
+    }
+    cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+    
+    /* 遇到未分配编码停止，文本与 format_instruction 一致 */
+    size_t n = cs_disasm(handle, code, sizeof(code), 0x1000, 0, &insn);
+    printf("cs_disasm: %zu 条\n", n);
+    for (size_t i = 0; i < n; i++) {
+        const cs_arm64 *arm64 = &insn[i].detail->arm64;
+        disasm_inst_t inst;
+        char expected[128], actual[256];
+        disassemble_arm64(code[i * 4] | code[i * 4 + 1] << 8 | code[i * 4 + 2] << 16 |
+                          (uint32_t)code[i * 4 + 3] << 24, insn[i].address, &inst);
+        format_instruction(&inst, expected, sizeof(expected));
+        if (insn[i].op_str[0]) {
+            snprintf(actual, sizeof(actual), "%-8s %s", insn[i].mnemonic, insn[i].op_str);
+        } else {
+            snprintf(actual, sizeof(actual), "%s", insn[i].mnemonic);
+        }
+        
+        printf("0x%llx: %-8s %-24s id=%-4s ops=%u cc=%d wb=%d uf=%d%s",
+               (unsigned long long)insn[i].address, insn[i].mnemonic, insn[i].op_str,
+               cs_insn_name(handle, insn[i].id), arm64->op_count, arm64->cc,
+               arm64->writeback, arm64->update_flags,
+               strcmp(expected, actual) == 0 ? "" : " [文本不一致]");
+        for (uint8_t g = 0; g < insn[i].detail->groups_count; g++) {
+            printf(" %s", cs_group_name(handle, insn[i].detail->groups[g]));
+        }
+        printf("\n");
+        
+        for (uint8_t j = 0; j < arm64->op_count; j++) {
+            const cs_arm64_op *op = &arm64->operands[j];
+            switch (op->type) {
+                case ARM64_OP_REG:
+                    printf("    reg %s", cs_reg_name(handle, op->reg));
+                    break;
+                case ARM64_OP_IMM:
+                    printf("    imm 0x%llx", (unsigned long long)op->imm);
+                    break;
+                case ARM64_OP_MEM:
+                    printf("    mem base=%s index=%s disp=%d",
+                           cs_reg_name(handle, op->mem.base),
+                           op->mem.index ? cs_reg_name(handle, op->mem.index) : "-",
+                           op->mem.disp);
+                    break;
+                case ARM64_OP_REG_MRS:
+                    printf("    mrs 0x%x", op->reg);
+                    break;
+                default:
+                    printf("    type %d", op->type);
+                    break;
+            }
+            if (op->shift.type != ARM64_SFT_INVALID) {
+                printf(" shift=%d #%u", op->shift.type, op->shift.value);
+            }
+            printf(" access=%d\n", op->access);
+        }
+        
+        uint16_t regs_read[64], regs_write[64];
+        uint8_t nr, nw;
+        if (cs_regs_access(handle, &insn[i], regs_read, &nr, regs_write, &nw) == CS_ERR_OK) {
+            printf("    读:");
+            for (uint8_t j = 0; j < nr; j++) {
+                printf(" %s", cs_reg_name(handle, regs_read[j]));
+            }
+            printf("  写:");
+            for (uint8_t j = 0; j < nw; j++) {
+                printf(" %s", cs_reg_name(handle, regs_write[j]));
+            }
+            printf("\n");
+        }
+    }
+    cs_free(insn, n);
+    
+    /* SKIPDATA：未分配编码输出为 .byte，继续解码 */
+    cs_option(handle, CS_OPT_SKIPDATA, CS_OPT_ON);
+    n = cs_disasm(handle, code + 40, 8, 0x1028, 0, &insn);
+    for (size_t i = 0; i < n; i++) {
+        printf("skipdata 0x%llx: %s %s\n",
+               (unsigned long long)insn[i].address, insn[i].mnemonic, insn[i].op_str);
+    }
+    cs_free(insn, n);
+    
+    /* cs_disasm_iter：复用 cs_malloc 分配的一条指令，循环内不分配内存 */
+    const uint8_t *p = code;
+    size_t size = sizeof(code);
+    uint64_t address = 0x1000;
+    size_t calls = 0, branches = 0;
+    cs_insn *it = cs_malloc(handle);
+    while (cs_disasm_iter(handle, &p, &size, &address, it)) {
+        calls++;
+        branches += cs_insn_group(handle, it, ARM64_GRP_JUMP) ||
+                    cs_insn_group(handle, it, ARM64_GRP_CALL) ||
+                    cs_insn_group(handle, it, ARM64_GRP_RET);
+    }
+    printf("cs_disasm_iter: %zu 条, 其中分支 %zu 条, 剩余 %zu 字节\n", calls, branches, size);
+    cs_free(it, 1);
+    
+    /* 大端模式和错误码 */
+    static const uint8_t be_code[] = { 0xD6, 0x5F, 0x03, 0xC0 };
+    cs_option(handle, CS_OPT_MODE, CS_MODE_BIG_ENDIAN);
+    n = cs_disasm(handle, be_code, sizeof(be_code), 0, 1, &insn);
+    printf("大端: %s\n", n ? insn[0].mnemonic : "(失败)");
+    cs_free(insn, n);
+    printf("未知选项: %s\n", cs_strerror(cs_option(handle, CS_OPT_SYNTAX, 0)));
+    csh bad;
+    printf("其他架构: %s\n", cs_strerror(cs_open((cs_arch)2, CS_MODE_ARM, &bad)));
+    cs_close(&handle);
+}
+
+/**
+ * 测试执行轨迹的地址缓存
+ */
+static void test_trace(void) {
+    printf("\n========== 测试执行轨迹地址缓存 ==========\n\n");
+    
+    static const uint8_t image[] = {
+        0xFD, 0x7B, 0xBF, 0xA9,  // stp x29, x30, [sp, #-16]!
+        0xFD, 0x03, 0x00, 0x91,  // mov x29, sp
+        0x20, 0x04, 0x00, 0xF1,  // subs x0, x1, #1
+        0xE1, 0xFF, 0xFF, 0x54,  // b.ne -4
+        0xFF, 0xFF, 0xFF, 0xFF,  // 未分配编码
+        0xFD, 0x7B, 0xC1, 0xA8,  // ldp x29, x30, [sp], #16
+        0xC0, 0x03, 0x5F, 0xD6,  // ret
+    };
+    const uint64_t base = 0x400000;
+    
+    /* 初始只有2个槽位：插入过程中发生冲突和扩容 */
+    arm64_trace_cache_t cache;
+    if (!arm64_trace_cache_init(&cache, 1, image, sizeof(image), base, ARM64_ENDIAN_LITTLE)) {
+        printf("初始化失败\n");
+        return;
+    }
+    
+    /* 循环体执行多次，其余指令各一次，再加上映像外和未对齐的地址 */
+    uint64_t trace[64];
+    size_t n = 0;
+    trace[n++] = base;
+    trace[n++] = base + 4;
+    for (int i = 0; i < 10; i++) {
+        trace[n++] = base + 8;
+        trace[n++] = base + 12;
+    }
+    trace[n++] = base + 16;
+    trace[n++] = base + 20;
+    trace[n++] = base + 24;
+    trace[n++] = base + 28;   // 映像末尾之后
+    trace[n++] = base - 4;    // 映像之前
+    trace[n++] = base + 2;    // 未对齐
+    trace[n++] = ARM64_TRACE_EMPTY;
+    
+    int mismatches = 0;
+    for (size_t i = 0; i < n; i++) {
+        const arm64_trace_entry_t *e = arm64_trace_lookup(&cache, trace[i]);
+        uint64_t offset = trace[i] - base;
+        if (trace[i] >= base && offset + 4 <= sizeof(image) && (offset & 3) == 0) {
+            disasm_inst_t inst;
+            char text[ARM64_TRACE_TEXT_SIZE];
+            uint32_t raw;
+            arm64_load_words(image + offset, 4, ARM64_ENDIAN_LITTLE, &raw);
+            bool ok = disassemble_arm64(raw, trace[i], &inst);
+            format_instruction(&inst, text, sizeof(text));
+            if (e->pc != trace[i] || e->raw != raw || (e->flags & ARM64_TRACE_OUTSIDE) ||
+                ((e->flags & ARM64_TRACE_VALID) != 0) != ok ||
+                strcmp(e->text, text) != 0 || e->text_len != strlen(text)) {
+                mismatches++;
+            }
+            if (i < 4 || i >= n - 7) {
+                printf("0x%llx: %08x  %s%s\n", (unsigned long long)e->pc, e->raw, e->text,
+                       (e->flags & ARM64_TRACE_VALID) ? "" : "  [无效]");
+            }
+        } else {
+            printf("0x%llx: %s\n", (unsigned long long)trace[i],
+                   (e->flags & ARM64_TRACE_OUTSIDE) ? "<映像外>" : "[应为映像外]");
+        }
+    }
+    printf("查找 %llu 次, 未命中 %llu 次, 条目 %zu / 槽位 %zu, 扩容 %llu 次, 与直接解码不一致 %d\n",
+           (unsigned long long)cache.lookups, (unsigned long long)cache.misses,
+           cache.count, cache.capacity, (unsigned long long)cache.grows, mismatches);
+    
+    /* 重复访问热点地址后，这些地址都停留在首个探测位置 */
+    for (int round = 0; round < 2; round++) {
+        for (uint64_t pc = base + 8; pc <= base + 12; pc += 4) {
+            arm64_trace_lookup(&cache, pc);
+        }
+    }
+    uint64_t probes = cache.probes;
+    uint64_t lookups = cache.lookups;
+    for (int round = 0; round < 100; round++) {
+        for (uint64_t pc = base + 8; pc <= base + 12; pc += 4) {
+            arm64_trace_lookup(&cache, pc);
+        }
+    }
+    printf("热点循环 %llu 次查找, 慢路径探测 %llu 次\n",
+           (unsigned long long)(cache.lookups - lookups),
+           (unsigned long long)(cache.probes - probes));
+    arm64_trace_cache_free(&cache);
+}
+
+/* CS_OPT_MEM 测试用的计数内存函数 */
+static size_t test_mem_mallocs = 0;
+static size_t test_mem_frees = 0;
+
+static void *test_mem_malloc(size_t size) {
+    test_mem_mallocs++;
+    return malloc(size);
+}
+
+static void test_mem_free(void *ptr) {
+    test_mem_frees++;
+    free(ptr);
+}
+
+/**
+ * 测试分配器接口（区域分配器、大页分配器及各子系统的接入）
+ */
+static void test_alloc(void) {
+    printf("\n========== 测试分配器接口 ==========\n\n");
+    
+    /* 区域分配器：对齐、单独成块的大请求、回退最近一次分配 */
+    arm64_arena_t arena;
+    arm64_arena_init(&arena, 4096, NULL);
+    const arm64_allocator_t *a = &arena.allocator;
+    uint8_t *p1 = arm64_alloc(a, 10, 1);
+    uint8_t *p2 = arm64_alloc(a, 100, 64);
+    uint8_t *big = arm64_alloc(a, 5000, 16);
+    uint8_t *p3 = arm64_alloc(a, 8, 8);
+    printf("区域: p2 64字节对齐 %d, p3 紧随 p2 %d, 大请求单独成块 %d\n",
+           ((uintptr_t)p2 & 63) == 0, p3 >= p2 + 100 && p3 < p2 + 100 + 8, big < p1 || big > p1 + 4096);
+    memset(big, 0xAB, 5000);
+    arm64_free(a, p3, 8);
+    uint8_t *p4 = arm64_alloc(a, 8, 8);
+    printf("释放最近一次分配后复用: %d\n", p4 == p3);
+    printf("分配 %llu 次, 峰值 %llu 字节, 向下层申请 %llu 次 %llu 字节\n",
+           (unsigned long long)arena.stats.allocs, (unsigned long long)arena.stats.peak_bytes,
+           (unsigned long long)arena.stats.system_allocs,
+           (unsigned long long)arena.stats.system_bytes);
+    arm64_arena_reset(&arena);
+    printf("重置后: 占用 %llu 字节, 保留 %llu 字节",
+           (unsigned long long)arena.stats.bytes_in_use,
+           (unsigned long long)arena.stats.system_bytes);
+    printf(", 首次分配复用首块 %d\n", arm64_alloc(a, 10, 1) == p1);
+    
+    /* 执行轨迹缓存使用区域分配器：扩容后旧槽位数组随区域一起释放 */
+    static const uint32_t code[] = { 0xD503201F, 0xD503201F, 0xD65F03C0 };
+    arm64_trace_cache_t cache;
+    arm64_trace_cache_init_alloc(&cache, 2, code, sizeof(code), 0x1000, ARM64_ENDIAN_LITTLE, a);
+    for (uint64_t pc = 0x1000; pc < 0x1000 + 64; pc += 4) {
+        arm64_trace_lookup(&cache, pc);
+    }
+    printf("轨迹缓存: 槽位数组64字节对齐 %d, 扩容 %llu 次, 0x1008 为 %s\n",
+           ((uintptr_t)cache.slots & 63) == 0, (unsigned long long)cache.grows,
+           arm64_trace_lookup(&cache, 0x1008)->text);
+    arm64_trace_cache_free(&cache);
+    
+    /* Capstone 兼容接口在 cs_open 时取得默认分配器，结果数组来自区域 */
+    arm64_set_default_allocator(a);
+    uint64_t before = arena.stats.allocs;
+    csh handle;
+    cs_insn *insn;
+    cs_open(CS_ARCH_ARM64, CS_MODE_LITTLE_ENDIAN, &handle);
+    cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+    size_t n = cs_disasm(handle, (const uint8_t *)code, sizeof(code), 0x1000, 0, &insn);
+    printf("cs_disasm 经区域分配: %zu 条, 分配 %llu 次, 末条 %s\n", n,
+           (unsigned long long)(arena.stats.allocs - before), n ? insn[n - 1].mnemonic : "-");
+    cs_free(insn, n);
+    cs_close(&handle);
+    arm64_set_default_allocator(NULL);
+    printf("恢复默认分配器: %d\n", arm64_default_allocator() != a);
+    arm64_arena_destroy(&arena);
+    printf("销毁后向下层占用 %llu 字节\n", (unsigned long long)arena.stats.system_bytes);
+    
+#ifndef _WIN32
+    /* 大页分配器：小请求交给 malloc，大请求按2MB对齐映射 */
+    arm64_hugepage_allocator_t hp;
+    arm64_hugepage_allocator_init(&hp, ARM64_HUGEPAGE_TRANSPARENT, 0);
+    void *small = arm64_alloc(&hp.allocator, 1000, 16);
+    uint8_t *huge = arm64_alloc(&hp.allocator, 3 * 1024 * 1024, 64);
+    if (huge) {
+        huge[0] = 1;
+        huge[3 * 1024 * 1024 - 1] = 2;
+    }
+    printf("大页: 映射成功 %d, 2MB对齐 %d, 大页字节 %llu\n", huge != NULL,
+           ((uintptr_t)huge & (ARM64_HUGEPAGE_SIZE - 1)) == 0,
+           (unsigned long long)hp.stats.hugepage_bytes);
+    arm64_free(&hp.allocator, huge, 3 * 1024 * 1024);
+    arm64_free(&hp.allocator, small, 1000);
+    printf("大页释放后: 占用 %llu 字节, 向下层占用 %llu 字节\n",
+           (unsigned long long)hp.stats.bytes_in_use, (unsigned long long)hp.stats.system_bytes);
+#endif
+    
+    /* CS_OPT_MEM：全局替换 Capstone 兼容接口的内存函数（之后一直有效） */
+    cs_opt_mem mem = { test_mem_malloc, NULL, NULL, test_mem_free, NULL };
+    printf("CS_OPT_MEM: %s\n", cs_strerror(cs_option(0, CS_OPT_MEM, (size_t)&mem)));
+    cs_open(CS_ARCH_ARM64, CS_MODE_LITTLE_ENDIAN, &handle);
+    n = cs_disasm(handle, (const uint8_t *)code, sizeof(code), 0x1000, 0, &insn);
+    cs_free(insn, n);
+    cs_close(&handle);
+    printf("自定义 malloc %zu 次, free %zu 次\n", test_mem_mallocs, test_mem_frees);
+}
+
+#ifndef _WIN32
+/* 在新线程中记录 n 对事件（新线程取得自己的缓冲区） */
+static void *timeline_worker(void *arg) {
+    size_t n = *(const size_t *)arg;
+    for (size_t i = 0; i < n; i++) {
+        ARM64_TIMELINE_BEGIN("worker", 0, 0, 0, 0);
+        ARM64_TIMELINE_END("worker", 0, 0, 0, 1);
+    }
+    return NULL;
+}
+#endif
+
+/* 统计文件中子串出现的次数 */
+static int count_in_file(const char *path, const char *needle) {
+    FILE *f = fopen(path, "r");
+    char buf[4096];
+    int count = 0;
+    if (!f) {
+        return -1;
+    }
+    size_t len = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[len] = '\0';
+    for (const char *p = buf; (p = strstr(p, needle)) != NULL; p++) {
+        count++;
+    }
+    return count;
+}
+
+static void test_timeline(void) {
+    printf("\n========== 测试阶段时间线 ==========\n\n");
+    
+    uint64_t recorded, dropped;
+    const char *path = "test_timeline.json";
+    
+    /* 未启用时记录点不产生事件 */
+    ARM64_TIMELINE_BEGIN("disabled", 0, 0, 0, 0);
+    ARM64_TIMELINE_END("disabled", 0, 0, 0, 0);
+    arm64_timeline_counts(&recorded, &dropped);
+    printf("未启用: 记录 %llu 个事件\n", (unsigned long long)recorded);
+    
+    /* 嵌套阶段：load -> decode（两个分段） */
+    arm64_timeline_start(0);
+    ARM64_TIMELINE_BEGIN("load", 0, 0, 0, 0);
+    ARM64_TIMELINE_END("load", 0x1000, 0x2000, 4096, 0);
+    for (uint64_t seg = 0x1000; seg < 0x2000; seg += 0x800) {
+        ARM64_TIMELINE_BEGIN("decode", seg, seg + 0x800, 0, 0);
+        ARM64_TIMELINE_END("decode", seg, seg + 0x800, 0x800, 0x200);
+    }
+    arm64_timeline_stop();
+    ARM64_TIMELINE_BEGIN("stopped", 0, 0, 0, 0);
+    arm64_timeline_counts(&recorded, &dropped);
+    long written = arm64_timeline_export(path);
+    printf("记录 %llu 个事件, 丢弃 %llu, 导出 %ld 个\n",
+           (unsigned long long)recorded, (unsigned long long)dropped, written);
+    printf("导出内容: decode %d, load %d, 开始 %d, 结束 %d, 分段 0x1800 %d, stopped %d\n",
+           count_in_file(path, "\"name\":\"decode\""), count_in_file(path, "\"name\":\"load\""),
+           count_in_file(path, "\"ph\":\"B\""), count_in_file(path, "\"ph\":\"E\""),
+           count_in_file(path, "\"start\":\"0x1800\",\"end\":\"0x2000\""),
+           count_in_file(path, "stopped"));
+    arm64_timeline_clear();
+    
+#ifndef _WIN32
+    /* 新线程的缓冲区只容纳4个事件，其余丢弃并计数；线程退出后事件保留 */
+    arm64_timeline_start(4);
+    pthread_t tid;
+    size_t pairs = 5;
+    pthread_create(&tid, NULL, timeline_worker, &pairs);
+    pthread_join(tid, NULL);
+    arm64_timeline_stop();
+    arm64_timeline_counts(&recorded, &dropped);
+    written = arm64_timeline_export(path);
+    printf("小缓冲区线程: 记录 %llu, 丢弃 %llu, 导出 %ld, dropped_events %d\n",
+           (unsigned long long)recorded, (unsigned long long)dropped, written,
+           count_in_file(path, "\"dropped_events\":6"));
+    arm64_timeline_clear();
+#endif
+    remove(path);
+    arm64_timeline_counts(&recorded, &dropped);
+    printf("清空后: 记录 %llu, 丢弃 %llu\n", (unsigned long long)recorded,
+           (unsigned long long)dropped);
+}
+
+/**
+ * 测试单寄存器加载/存储的各种形式（Q寄存器、PRFM/PRFUM、SIMD寄存器偏移）
+ */
+static void test_ls_forms(void) {
+    printf("\n========== 测试加载/存储形式 ==========\n\n");
+    
+    static const uint32_t words[] = {
+        0x3DC00420,     // ldr q0, [x1, #16]
+        0x3D800420,     // str q0, [x1, #16]
+        0x3CC10420,     // ldr q0, [x1], #16
+        0x3C9F03E0,     // stur q0, [sp, #-16]
+        0x3CE27820,     // ldr q0, [x1, x2, lsl #4]
+        0xFC627820,     // ldr d0, [x1, x2, lsl #3]
+        0xF9800020,     // prfm pldl1keep, [x1]
+        0xF9800430,     // prfm pstl1keep, [x1, #8]
+        0xF89F0021,     // prfum pldl1strm, [x1, #-16]
+        0xF8A27822,     // prfm pldl2keep, [x1, x2, lsl #3]
+        0xD8000080,     // prfm pldl1keep, <pc+16>
+        0xF980003F,     // prfm #31, [x1]
+        0xF8800C20,     // PRFM 没有前索引形式（未分配）
+        0x7CC00000,     // size=1, V=1, opc=3（未分配）
+    };
+    
+    for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        disasm_inst_t inst;
+        char buffer[128];
+        uint32_t word = 0;
+        inst_type_t type;
+        
+        if (!disassemble_arm64(words[i], 0x1000, &inst)) {
+            printf("0x%08X  无法解码\n", words[i]);
+            continue;
+        }
+        format_instruction(&inst, buffer, sizeof(buffer));
+        bool encoded = encode_arm64(&inst, &word) && word == words[i];
+        bool fast = arm64_fast_classify(words[i], &type);
+        printf("0x%08X  %-32s 操作数 %u  重新编码 %s  快速分类 %s\n", words[i], buffer,
+               inst.operand_count, encoded ? "一致" : "失败",
+               !fast ? "未命中" : (type == inst.type ? "一致" : "不一致"));
+    }
+}
+
+/**
+ * 测试 objdump 格式清单：函数头、地址列宽度、目标注释和 .word
+ */
+static void test_objdump_listing(void) {
+    printf("\n========== 测试 objdump 格式清单 ==========\n");
+    
+    static const uint32_t words[] = {
+        0xD10043FF,     // sub sp, sp, #16
+        0x94000004,     // bl helper
+        0xB4000040,     // cbz x0, <pc+8>
+        0x17FFFFFD,     // b <段首>（没有符号，使用段名）
+        0x00000000,     // 未分配
+        0x58FFFFE1,     // ldr x1, <pc-4>
+        0x90000000,     // adrp x0, <本页>
+        0x17FFFC00,     // b <段外>
+        0xD65F03C0,     // ret
+    };
+    /* 乱序给出，同一地址的第二个符号被忽略 */
+    static const arm64_listing_symbol_t symbols[] = {
+        { 0x10014, "helper" },
+        { 0x10004, "main" },
+        { 0x10014, "helper_alias" },
+    };
+    
+    arm64_listing_t listing;
+    if (!arm64_listing_init(&listing, stdout, symbols, 3)) {
+        printf("初始化失败\n");
+        return;
+    }
+    fflush(stdout);
+    arm64_listing_file_header(&listing, "test.elf", "elf64-littleaarch64");
+    size_t n = arm64_listing_section(&listing, ".text", 0x10000, words, sizeof(words),
+                                     ARM64_ENDIAN_LITTLE);
+    bool ok = arm64_listing_flush(&listing);
+    printf("\n指令行 %zu, 无法解码 %llu, 写出 %s\n", n,
+           (unsigned long long)listing.unknown, ok ? "成功" : "失败");
+    arm64_listing_free(&listing);
+}
+
+/* 写入内存的清单输出 */
+typedef struct {
+    char data[4096];
+    size_t len;
+} listing_mem_t;
+
+static bool listing_mem_write(void *ctx, const void *data, size_t size) {
+    listing_mem_t *m = ctx;
+    if (m->len + size > sizeof(m->data)) {
+        return false;
+    }
+    memcpy(m->data + m->len, data, size);
+    m->len += size;
+    return true;
+}
+
+/**
+ * 测试分块清单和并行压缩输出：按范围分块拼接的结果与整段输出相同，
+ * 压缩输出逐个成员解压后与单线程清单相同
+ */
+static void test_listing_blocks(void) {
+    printf("\n========== 测试分块清单和压缩输出 ==========\n\n");
+    
+    static const uint32_t words[] = {
+        0xD10043FF, 0x94000004, 0xB4000040, 0x17FFFFFD, 0x00000000,
+        0x58FFFFE1, 0x90000000, 0x17FFFC00, 0xD65F03C0, 0xD503201F,
+    };
+    static const arm64_listing_symbol_t symbols[] = {
+        { 0x10004, "main" }, { 0x10014, "helper" }, { 0x10018, "tail" },
+    };
+    arm64_listing_section_t sections[] = {
+        { ".text", 0x10000, words, sizeof(words), ARM64_ENDIAN_LITTLE },
+        { ".init", 0x20000, words, 8, ARM64_ENDIAN_LITTLE },
+    };
+    arm64_listing_image_t image = { "test.elf", "elf64-littleaarch64", sections, 2 };
+    
+    static listing_mem_t whole, blocks;
+    arm64_listing_t listing;
+    whole.len = blocks.len = 0;
+    if (!arm64_listing_init_writer(&listing, listing_mem_write, &whole, symbols, 3)) {
+        printf("初始化失败\n");
+        return;
+    }
+    uint64_t n = arm64_listing_image(&listing, &image);
+    arm64_listing_flush(&listing);
+    arm64_listing_free(&listing);
+    
+    /* 每块3条指令（块边界正好落在 main+0x8 和 helper 上） */
+    arm64_listing_init_writer(&listing, listing_mem_write, &blocks, symbols, 3);
+    arm64_listing_file_header(&listing, image.path, image.format);
+    for (size_t s = 0; s < 2; s++) {
+        arm64_listing_section_header(&listing, &sections[s]);
+        for (size_t off = 0; off < sections[s].size; off += 12) {
+            size_t len = sections[s].size - off < 12 ? sections[s].size - off : 12;
+            arm64_listing_range(&listing, &sections[s], off, len);
+        }
+    }
+    arm64_listing_flush(&listing);
+    arm64_listing_free(&listing);
+    printf("整段 %llu 条指令, %zu 字节; 分块拼接 %s\n", (unsigned long long)n, whole.len,
+           whole.len == blocks.len && memcmp(whole.data, blocks.data, whole.len) == 0 ?
+           "一致" : "不一致");
+    
+#ifdef ARM64_DISASM_HAVE_GZIP
+    FILE *tmp = tmpfile();
+    arm64_gzsink_t *sink = tmp ? arm64_gzsink_open(tmp, 6, 2) : NULL;
+    arm64_gzsink_stats_t st = { 0 };
+    bool ok = sink && arm64_gzsink_listing(sink, &image, symbols, 3, 3, 2);
+    ok = sink && arm64_gzsink_close(sink, &st) && ok;
+    
+    /* 逐个成员解压 */
+    static uint8_t packed[8192];
+    static char unpacked[4096];
+    size_t packed_size = 0;
+    if (tmp) {
+        rewind(tmp);
+        packed_size = fread(packed, 1, sizeof(packed), tmp);
+        fclose(tmp);
+    }
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    size_t unpacked_size = 0;
+    if (ok && inflateInit2(&zs, 15 + 16) == Z_OK) {
+        zs.next_in = packed;
+        zs.avail_in = (uInt)packed_size;
+        zs.next_out = (Bytef *)unpacked;
+        zs.avail_out = sizeof(unpacked);
+        int rc;
+        while ((rc = inflate(&zs, Z_NO_FLUSH)) == Z_STREAM_END && zs.avail_in > 0) {
+            inflateReset(&zs);
+        }
+        ok = rc == Z_STREAM_END;
+        unpacked_size = (size_t)((char *)zs.next_out - unpacked);
+        inflateEnd(&zs);
+    }
+    printf("压缩输出: %llu 个 gzip 成员, 解压 %s\n", (unsigned long long)st.blocks,
+           ok && unpacked_size == whole.len && memcmp(unpacked, whole.data, whole.len) == 0 ?
+           "一致" : "不一致");
+#endif
+}
+
+/* ========== 分配器覆盖 ========== */
+
+#ifdef ARM64_TEST_WRAP_MALLOC
+/*
+ * 测试程序以 -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc 链接：
+ * 库和测试代码中的直接调用都转到这里计数（libc、zlib 内部的调用不受影响）
+ */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+static size_t stray_allocs = 0;
+
+void *__wrap_malloc(size_t size) {
+    __atomic_fetch_add(&stray_allocs, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    __atomic_fetch_add(&stray_allocs, 1, __ATOMIC_RELAXED);
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    __atomic_fetch_add(&stray_allocs, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+}
+#endif
+
+/* 计数分配器：从静态内存池顺序切分（不经过 malloc），释放只计数；可被多个线程同时使用 */
+typedef struct {
+    size_t used;
+    size_t allocs;
+    size_t frees;
+    size_t bytes_in_use;
+} counting_pool_t;
+
+static uint8_t counting_memory[16u << 20];
+
+static void *counting_alloc(void *ctx, size_t size, size_t align) {
+    counting_pool_t *pool = ctx;
+    size_t need = size + align - 1;
+    size_t start = __atomic_fetch_add(&pool->used, need, __ATOMIC_RELAXED);
+    if (start + need > sizeof(counting_memory)) {
+        return NULL;
+    }
+    uintptr_t p = ((uintptr_t)(counting_memory + start) + align - 1) & ~(uintptr_t)(align - 1);
+    __atomic_fetch_add(&pool->allocs, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&pool->bytes_in_use, size, __ATOMIC_RELAXED);
+    return (void *)p;
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+    counting_pool_t *pool = ctx;
+    (void)ptr;
+    __atomic_fetch_add(&pool->frees, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&pool->bytes_in_use, size, __ATOMIC_RELAXED);
+}
+
+/* 按小端写入 */
+static void put_le(uint8_t *p, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        p[i] = (uint8_t)(value >> (i * 8));
+    }
+}
+
+/* 测试用 ELF 的符号 */
+typedef struct {
+    const char *name;
+    uint64_t address;
+    uint8_t info;               // 绑定 << 4 | 类型
+} test_elf_sym_t;
+
+/**
+ * 在 out 中构造一个最小的 AArch64 ELF64：.text、.shstrtab、.symtab、.strtab 四节
+ * @return 文件大小
+ */
+static size_t build_test_elf(uint8_t *out, size_t cap, const uint32_t *text, size_t words,
+                             uint64_t address, const test_elf_sym_t *syms, size_t sym_count) {
+    static const char shstr[] = "\0.text\0.shstrtab\0.symtab\0.strtab";
+    size_t text_off = 64;
+    size_t shstr_off = text_off + words * 4;
+    size_t str_off = shstr_off + sizeof(shstr);
+    size_t str_size = 1;
+    for (size_t i = 0; i < sym_count; i++) {
+        str_size += strlen(syms[i].name) + 1;
+    }
+    size_t sym_off = (str_off + str_size + 7) & ~(size_t)7;
+    size_t sym_size = (sym_count + 1) * 24;
+    size_t sh_off = sym_off + sym_size;
+    size_t total = sh_off + 5 * 64;
+    if (total > cap) {
+        return 0;
+    }
+    memset(out, 0, total);
+
+    memcpy(out, "\177ELF\2\1\1", 7);
+    put_le(out + 16, 1, 2);             // ET_REL
+    put_le(out + 18, 183, 2);           // EM_AARCH64
+    put_le(out + 20, 1, 4);
+    put_le(out + 40, sh_off, 8);
+    put_le(out + 52, 64, 2);
+    put_le(out + 58, 64, 2);
+    put_le(out + 60, 5, 2);
+    put_le(out + 62, 2, 2);             // .shstrtab
+
+    for (size_t i = 0; i < words; i++) {
+        put_le(out + text_off + i * 4, text[i], 4);
+    }
+    memcpy(out + shstr_off, shstr, sizeof(shstr));
+    size_t name = 1;
+    for (size_t i = 0; i < sym_count; i++) {
+        uint8_t *sym = out + sym_off + (i + 1) * 24;
+        size_t len = strlen(syms[i].name) + 1;
+        memcpy(out + str_off + name, syms[i].name, len);
+        put_le(sym, name, 4);
+        sym[4] = syms[i].info;
+        put_le(sym + 6, 1, 2);          // .text
+        put_le(sym + 8, syms[i].address, 8);
+        name += len;
+    }
+
+    /* 节头：名称, 类型, 标志, 地址, 偏移, 大小, link, entsize */
+    static const uint32_t names[] = { 0, 1, 7, 17, 25 };
+    const uint64_t sh[5][7] = {
+        { 0 },
+        { 1, 0x6, address, text_off, words * 4, 0, 0 },     // PROGBITS, ALLOC|EXECINSTR
+        { 3, 0, 0, shstr_off, sizeof(shstr), 0, 0 },
+        { 2, 0, 0, sym_off, sym_size, 4, 24 },
+        { 3, 0, 0, str_off, str_size, 0, 0 },
+    };
+    for (int i = 1; i < 5; i++) {
+        uint8_t *h = out + sh_off + (size_t)i * 64;
+        put_le(h, names[i], 4);
+        put_le(h + 4, sh[i][0], 4);
+        put_le(h + 8, sh[i][1], 8);
+        put_le(h + 16, sh[i][2], 8);
+        put_le(h + 24, sh[i][3], 8);
+        put_le(h + 32, sh[i][4], 8);
+        put_le(h + 40, sh[i][5], 4);
+        put_le(h + 56, sh[i][6], 8);
+    }
+    return total;
+}
+
+/**
+ * objdump 兼容输出的黄金文件：手工按 GNU binutils（aarch64 objdump -d）的格式编写，
+ * 本机的 GNU objdump 只支持 x86，无法直接生成
+ * 覆盖 x29/x30 寄存器名、mov x29, sp、字面量加载的目标注释和 $d 标出的字面量池
+ */
+static void test_objdump_golden(void) {
+    printf("\n========== 测试 objdump 黄金文件 ==========\n\n");
+
+    static const uint32_t code[] = {
+        0xA9BF7BFD,     // stp x29, x30, [sp, #-16]!
+        0x910003FD,     // mov x29, sp
+        0x58000080,     // ldr x0, <字面量池>
+        0x94000005,     // bl helper
+        0xA8C17BFD,     // ldp x29, x30, [sp], #16
+        0xD65F03C0,     // ret
+        0x9ABCDEF0,     // 字面量池（$d）
+        0x12345678,
+        0x91000400,     // helper: add x0, x0, #1（$x）
+        0xD65F03C0,     // ret
+    };
+    static const test_elf_sym_t syms[] = {
+        { "$x", 0x00, 0x00 }, { "$d.1", 0x18, 0x00 }, { "$x", 0x20, 0x00 },
+        { "main", 0x00, 0x12 }, { "helper", 0x20, 0x12 },
+    };
+    static const char golden[] =
+        "\n"
+        "golden.o:     file format elf64-littleaarch64\n"
+        "\n"
+        "\n"
+        "Disassembly of section .text:\n"
+        "\n"
+        "0000000000000000 <main>:\n"
+        "   0:\ta9bf7bfd \tstp\tx29, x30, [sp, #-16]!\n"
+        "   4:\t910003fd \tmov\tx29, sp\n"
+        "   8:\t58000080 \tldr\tx0, 18 <main+0x18>\n"
+        "   c:\t94000005 \tbl\t20 <helper>\n"
+        "  10:\ta8c17bfd \tldp\tx29, x30, [sp], #16\n"
+        "  14:\td65f03c0 \tret\n"
+        "  18:\t9abcdef0 \t.word\t0x9abcdef0\n"
+        "  1c:\t12345678 \t.word\t0x12345678\n"
+        "\n"
+        "0000000000000020 <helper>:\n"
+        "  20:\t91000400 \tadd\tx0, x0, #0x1\n"
+        "  24:\td65f03c0 \tret\n";
+
+    static uint8_t image[1024];
+    size_t size = build_test_elf(image, sizeof(image), code, 10, 0, syms, 5);
+    arm64_elf_t elf;
+    if (arm64_elf_parse(&elf, image, size) != ARM64_ELF_OK) {
+        printf("ELF 解析失败\n");
+        return;
+    }
+
+    /* 与 arm64_objdump 相同：映射符号转为段的映射表，其余符号作为函数头 */
+    arm64_listing_mapping_t maps[8];
+    arm64_listing_symbol_t lsyms[8];
+    for (size_t i = 0; i < elf.mapping_count && i < 8; i++) {
+        maps[i] = (arm64_listing_mapping_t){ elf.mappings[i].address, elf.mappings[i].data };
+    }
+    for (size_t i = 0; i < elf.symbol_count && i < 8; i++) {
+        lsyms[i] = (arm64_listing_symbol_t){ elf.symbols[i].address, elf.symbols[i].name };
+    }
+    const arm64_elf_section_t *text = &elf.sections[0];
+    arm64_listing_section_t section = {
+        text->name, text->address, text->data, (size_t)text->size, ARM64_ENDIAN_LITTLE,
+        maps, elf.mapping_count
+    };
+    arm64_listing_image_t listing_image = { "golden.o", "elf64-littleaarch64", &section, 1 };
+
+    static listing_mem_t mem;
+    arm64_listing_t listing;
+    mem.len = 0;
+    bool ok = arm64_listing_init_writer(&listing, listing_mem_write, &mem, lsyms,
+                                        elf.symbol_count);
+    if (ok) {
+        arm64_listing_image(&listing, &listing_image);
+        ok = arm64_listing_flush(&listing);
+        printf("映射符号 %zu 个, 数据字 %llu\n", elf.mapping_count,
+               (unsigned long long)listing.data);
+        arm64_listing_free(&listing);
+    }
+    arm64_elf_free(&elf);
+
+    bool same = ok && mem.len == sizeof(golden) - 1 && memcmp(mem.data, golden, mem.len) == 0;
+    printf("与黄金文件%s\n", same ? "一致" : "不一致");
+    if (!same) {
+        printf("实际输出:\n%.*s", (int)mem.len, mem.data);
+    }
+}
+
+/**
+ * 测试工具共用的输入格式选项和文件映像
+ */
+static void test_image_input(void) {
+    printf("\n========== 测试输入格式选项和文件映像 ==========\n\n");
+
+    char *argv[] = {
+        "tool", "-b", "binary", "--adjust-vma=0x400000", "-EB", "-EL", "-EB", "-x", "-b",
+    };
+    int argc = (int)(sizeof(argv) / sizeof(argv[0]));
+    arm64_image_options_t input;
+    arm64_image_options_init(&input);
+    for (int i = 1; i < argc; i++) {
+        int used = arm64_image_option(&input, argc, argv, i);
+        printf("%-22s 消耗 %d\n", argv[i], used);
+        if (used > 0) {
+            i += used - 1;
+        }
+    }
+    printf("binary %d, vma 0x%llx, 大端 %d\n", input.binary, (unsigned long long)input.vma,
+           input.endian == ARM64_ENDIAN_BIG);
+
+    static const uint8_t bytes[] = { 0x20, 0x00, 0x02, 0x8B, 0xC0, 0x03, 0x5F, 0xD6 };
+    const char *path = "arm64_image_test.bin";
+    FILE *f = fopen(path, "wb");
+    bool written = f && fwrite(bytes, 1, sizeof(bytes), f) == sizeof(bytes);
+    if (f) {
+        fclose(f);
+    }
+    arm64_image_t img;
+    bool opened = written && arm64_image_open(&img, path);
+    bool same = opened && img.size == sizeof(bytes) && memcmp(img.data, bytes, img.size) == 0;
+    if (opened) {
+        arm64_image_close(&img);
+    }
+    remove(path);
+    printf("打开映像: %s\n", same ? "内容一致" : "失败");
+    bool missing = arm64_image_open(&img, "arm64_image_missing.bin");
+    printf("不存在的文件: %s\n", missing ? "错误地成功" : "失败");
+}
+
+#ifndef _WIN32
+static void *timeline_thread(void *arg) {
+    (void)arg;
+    ARM64_TIMELINE_BEGIN("coverage", 0, 0, 0, 0);
+    ARM64_TIMELINE_END("coverage", 0, 0, 0, 0);
+    return NULL;
+}
+#endif
+
+/**
+ * 安装计数分配器后运行各个需要分配内存的子系统：
+ * 分配都经过分配器且全部配对释放，没有直接调用 malloc/calloc/realloc
+ */
+static void test_alloc_coverage(void) {
+    printf("\n========== 测试分配器覆盖 ==========\n\n");
+
+    static const uint32_t code[] = {
+        0xA9BF7BFD, 0x910003FD, 0x94000002, 0xD65F03C0, 0xD503201F, 0xD65F03C0,
+    };
+    static const test_elf_sym_t syms[] = {
+        { "main", 0x1000, 0x12 }, { "leaf", 0x1010, 0x02 },
+    };
+    static const arm64_listing_symbol_t lsyms[] = { { 0x1000, "main" }, { 0x1010, "leaf" } };
+    arm64_listing_section_t section = { ".text", 0x1000, code, sizeof(code), ARM64_ENDIAN_LITTLE };
+    arm64_listing_image_t image = { "test.elf", "elf64-littleaarch64", &section, 1 };
+
+    static counting_pool_t pool;
+    arm64_allocator_t counting = { counting_alloc, counting_free, &pool };
+    memset(&pool, 0, sizeof(pool));
+#ifdef ARM64_TEST_WRAP_MALLOC
+    size_t stray = __atomic_load_n(&stray_allocs, __ATOMIC_RELAXED);
+#endif
+    arm64_set_default_allocator(&counting);
+
+    /* ELF 读取 */
+    static uint8_t elf_image[1024];
+    size_t elf_size = build_test_elf(elf_image, sizeof(elf_image), code, 6, 0x1000, syms, 2);
+    arm64_elf_t elf;
+    bool elf_ok = arm64_elf_parse(&elf, elf_image, elf_size) == ARM64_ELF_OK &&
+                  elf.symbol_count == 2;
+    arm64_elf_free(&elf);
+    size_t after_elf = pool.allocs;
+
+    /* 清单 */
+    static listing_mem_t mem;
+    arm64_listing_t listing;
+    mem.len = 0;
+    bool listing_ok = arm64_listing_init_writer(&listing, listing_mem_write, &mem, lsyms, 2);
+    if (listing_ok) {
+        arm64_listing_image(&listing, &image);
+        listing_ok = arm64_listing_flush(&listing);
+        arm64_listing_free(&listing);
+    }
+    size_t after_listing = pool.allocs;
+
+    /* 执行轨迹缓存（Capstone 兼容接口已由 test_capstone 用 CS_OPT_MEM 换成测试的 malloc） */
+    arm64_trace_cache_t cache;
+    arm64_trace_cache_init(&cache, 2, code, sizeof(code), 0x1000, ARM64_ENDIAN_LITTLE);
+    for (uint64_t pc = 0x1000; pc < 0x1000 + sizeof(code); pc += 4) {
+        arm64_trace_lookup(&cache, pc);
+    }
+    bool trace_ok = strcmp(arm64_trace_lookup(&cache, 0x1008)->text, "bl       0x1010") == 0;
+    arm64_trace_cache_free(&cache);
+    size_t after_other = pool.allocs;
+
+#ifdef ARM64_DISASM_HAVE_GZIP
+    /* 并行压缩输出（工作线程中的清单、压缩块、暂存区） */
+    FILE *tmp = tmpfile();
+    arm64_gzsink_t *sink = tmp ? arm64_gzsink_open(tmp, 1, 2) : NULL;
+    bool gz_ok = sink && arm64_gzsink_listing(sink, &image, lsyms, 2, 2, 2);
+    gz_ok = sink && arm64_gzsink_close(sink, NULL) && gz_ok;
+    if (tmp) {
+        fclose(tmp);
+    }
+    printf("压缩输出: 成功 %d, 经分配器 %zu 次\n", gz_ok, pool.allocs - after_other);
+#endif
+
+    size_t in_use = pool.bytes_in_use;
+#ifndef _WIN32
+    /* 新线程的时间线缓冲区（没有可复用的缓冲区时分配；缓冲区在进程内复用，不释放） */
+    pthread_t tid;
+    arm64_timeline_start(0);
+    if (pthread_create(&tid, NULL, timeline_thread, NULL) == 0) {
+        pthread_join(tid, NULL);
+    }
+    arm64_timeline_stop();
+    arm64_timeline_clear();
+#endif
+
+    arm64_set_default_allocator(NULL);
+    printf("ELF: 成功 %d, 经分配器 %zu 次\n", elf_ok, after_elf);
+    printf("清单: 成功 %d, 经分配器 %zu 次\n", listing_ok, after_listing - after_elf);
+    printf("轨迹缓存: 成功 %d, 经分配器 %zu 次\n", trace_ok, after_other - after_listing);
+    printf("合计（时间线以外）: 未释放 %zu 字节\n", in_use);
+#ifdef ARM64_TEST_WRAP_MALLOC
+    printf("直接调用 malloc/calloc/realloc: %zu 次\n",
+           __atomic_load_n(&stray_allocs, __ATOMIC_RELAXED) - stray);
+#endif
+}
+
+static void peephole_print(void *ctx, const arm64_peep_site_t *site) {
+    (void)ctx;
+    disasm_inst_t inst;
+    char text[128] = ".word";
+    if (disassemble_arm64(site->raw, site->address, &inst)) {
+        format_instruction(&inst, text, sizeof(text));
+    }
+    printf("  0x%llx  %-28s %s", (unsigned long long)site->address, text,
+           arm64_peephole_rule_name(site->rule));
+    if (site->related) {
+        printf(" -> 0x%llx", (unsigned long long)site->related);
+    }
+    printf("\n");
+}
+
+static void test_peephole(void) {
+    printf("\n========== 测试窥孔分析 ==========\n\n");
+    
+    /* f1: 0x10000，11条；f2: 0x1002c，18条 */
+    static const uint32_t words[] = {
+        0xAA0103E1,     // mov x1, x1                   mov-self
+        0x2A0203E2,     // mov w2, w2                   清零高32位，不报告
+        0x91000063,     // add x3, x3, #0               add-zero
+        0x910003E0,     // mov x0, sp                   SP 拷贝，不报告
+        0x90000004,     // adrp x4, ...
+        0x91000084,     // add x4, x4, #0               :lo12: 低位，不报告
+        0xB10004A5,     // adds x5, x5, #1              dead-flags（被下一条覆盖）
+        0xF10004C6,     // subs x6, x6, #1              被 b.eq 读取
+        0x54000020,     // b.eq 下一条                  branch-next
+        0xEB01001F,     // cmp x0, x1                   dead-flags（ret）
+        0xD65F03C0,     // ret
+        0xF9400420,     // ldr x0, [x1, #8]
+        0xF9400422,     // ldr x2, [x1, #8]             redundant-load
+        0xF9000083,     // str x3, [x4]                 清空加载记录
+        0xF9400422,     // ldr x2, [x1, #8]
+        0x91002021,     // add x1, x1, #8               基址被改写
+        0xF9400422,     // ldr x2, [x1, #8]
+        0xF9400025,     // ldr x5, [x1]
+        0xF9400021,     // ldr x1, [x1]                 redundant-load（改写了自己的基址）
+        0xF9400021,     // ldr x1, [x1]                 地址已不同，不报告
+        0xF1000C1F,     // cmp x0, #3                   被 b.ne 读取
+        0x54000041,     // b.ne +8
+        0xB4000020,     // cbz x0, 下一条               branch-next
+        0xF1000C1F,     // cmp x0, #3                   被 csel 读取
+        0x9A820020,     // csel x0, x1, x2, eq
+        0xF100101F,     // cmp x0, #4                   dead-flags（bl）
+        0x94000000,     // bl 自身
+        0x14000001,     // b 下一条                     branch-next
+        0xD65F03C0,     // ret
+    };
+    arm64_peephole_t peep;
+    arm64_peephole_init(&peep, ARM64_PEEP_ALL, peephole_print, NULL);
+    arm64_peephole_scan(&peep, words, 11 * 4, 0x10000, ARM64_ENDIAN_LITTLE);
+    arm64_peephole_scan(&peep, words + 11, 18 * 4, 0x1002c, ARM64_ENDIAN_LITTLE);
+    printf("%llu 条指令:", (unsigned long long)peep.insts);
+    for (int r = 0; r < ARM64_PEEP_RULE_COUNT; r++) {
+        printf(" %s=%llu", arm64_peephole_rule_name((arm64_peep_rule_t)r),
+               (unsigned long long)peep.counts[r]);
+    }
+    printf("\n");
+    
+    /* 逐条输入与整段扫描的计数相同；只启用部分规则时其余规则不计数 */
+    arm64_peephole_t one;
+    arm64_peephole_init(&one, (1u << ARM64_PEEP_DEAD_FLAGS) | (1u << ARM64_PEEP_REDUNDANT_LOAD),
+                        NULL, NULL);
+    for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        if (i == 11) {
+            arm64_peephole_block_end(&one);
+        }
+        disasm_inst_t inst;
+        disassemble_arm64(words[i], (i < 11 ? 0x10000 : 0x1002c - 11 * 4) + i * 4, &inst);
+        arm64_peephole_feed(&one, &inst, 1);
+    }
+    printf("逐条输入: dead-flags=%llu redundant-load=%llu 其余=%llu\n",
+           (unsigned long long)one.counts[ARM64_PEEP_DEAD_FLAGS],
+           (unsigned long long)one.counts[ARM64_PEEP_REDUNDANT_LOAD],
+           (unsigned long long)(one.counts[ARM64_PEEP_MOV_SELF] +
+                                one.counts[ARM64_PEEP_ADD_ZERO] +
+                                one.counts[ARM64_PEEP_BRANCH_NEXT]));
+
+    /* 模式跨越标号：第二次加载是循环头，从回边进入时 x2 已被改写，不是冗余加载 */
+    static const uint32_t loop[] = {
+        0xF9400002,     // ldr x2, [x0]
+        0xF9400002,     // 1: ldr x2, [x0]
+        0xF9000003,     // str x3, [x0]
+        0xF1000484,     // subs x4, x4, #1
+        0x54FFFFA1,     // b.ne 1b
+        0xD65F03C0,     // ret
+    };
+    static const uint64_t loop_leaders[] = { 0x20004 };
+    arm64_peephole_t lbl;
+    arm64_peephole_init(&lbl, 1u << ARM64_PEEP_REDUNDANT_LOAD, NULL, NULL);
+    arm64_peephole_scan(&lbl, loop, sizeof(loop), 0x20000, ARM64_ENDIAN_LITTLE);
+    uint64_t without = lbl.counts[ARM64_PEEP_REDUNDANT_LOAD];
+    arm64_peephole_init(&lbl, 1u << ARM64_PEEP_REDUNDANT_LOAD, NULL, NULL);
+    arm64_peephole_set_leaders(&lbl, loop_leaders, 1);
+    arm64_peephole_scan(&lbl, loop, sizeof(loop), 0x20000, ARM64_ENDIAN_LITTLE);
+    printf("跨标号: 无块首 redundant-load=%llu, 有块首 redundant-load=%llu\n",
+           (unsigned long long)without,
+           (unsigned long long)lbl.counts[ARM64_PEEP_REDUNDANT_LOAD]);
+    printf("规则名查找: %s\n",
+           arm64_peephole_rule_find("add-zero") == ARM64_PEEP_ADD_ZERO &&
+           arm64_peephole_rule_find("add") == ARM64_PEEP_RULE_COUNT ? "正确" : "错误");
+}
+
+static void test_ldst_pair(void) {
+    printf("\n========== 测试 LDP/STP 配对分析 ==========\n\n");
+    
+    static const uint32_t words[] = {
+        0xF9400020,     // ldr x0, [x1]
+        0xF9400422,     // ldr x2, [x1, #8]             配对
+        0xB90007E3,     // str w3, [sp, #4]
+        0xB9000BE4,     // str w4, [sp, #8]             配对
+        0xB9000FE5,     // str w5, [sp, #12]            w4 已配对，不再报告
+        0xFD400840,     // ldr d0, [x2, #16]
+        0x91000529,     // add x9, x9, #1               与两次加载无关
+        0xFD400C41,     // ldr d1, [x2, #24]            配对
+        0xF9400483,     // ldr x3, [x4, #8]
+        0xAA0603E5,     // mov x5, x6                   改写第二个目标
+        0xF9400885,     // ldr x5, [x4, #16]
+        0xF9400507,     // ldr x7, [x8, #8]
+        0xF9400907,     // ldr x7, [x8, #16]            目标相同
+        0xB89FC16A,     // ldursw x10, [x11, #-4]
+        0xF85FC1AC,     // ldur x12, [x13, #-4]
+        0xB980016E,     // ldrsw x14, [x11]             配对（LDPSW）
+        0xF9000420,     // str x0, [x1, #8]
+        0xF9400043,     // ldr x3, [x2]                 存储之间有加载
+        0xF9000824,     // str x4, [x1, #16]
+        0x3DC00860,     // ldr q0, [x3, #32]
+        0x3DC00C61,     // ldr q1, [x3, #48]            配对
+        0xF9400280,     // ldr x0, [x20]
+        0xF9400694,     // ldr x20, [x20, #8]           配对（ldp x0, x20, [x20]）
+        0xF94102A0,     // ldr x0, [x21, #512]
+        0xF940FEA1,     // ldr x1, [x21, #504]          配对（偏移 504 = 63*8）
+        0xF84042C0,     // ldur x0, [x22, #4]
+        0xF840C2C1,     // ldur x1, [x22, #12]          偏移不是8的倍数
+        0xD65F03C0,     // ret
+    };
+    arm64_peephole_t peep;
+    arm64_peephole_init(&peep, 1u << ARM64_PEEP_LDST_PAIR, peephole_print, NULL);
+    arm64_peephole_scan(&peep, words, sizeof(words), 0x20000, ARM64_ENDIAN_LITTLE);
+    printf("%llu 条指令: ldst-pair=%llu\n", (unsigned long long)peep.insts,
+           (unsigned long long)peep.counts[ARM64_PEEP_LDST_PAIR]);
+
+    /* 配对不跨越分支目标：第二次存储是循环头 */
+    static const uint32_t loop[] = {
+        0xF9000001,     // str x1, [x0]
+        0xF9000402,     // 2: str x2, [x0, #8]
+        0xF1000484,     // subs x4, x4, #1
+        0x54FFFFC1,     // b.ne 2b
+        0xD65F03C0,     // ret
+    };
+    static const uint64_t loop_leaders[] = { 0x30004 };
+    arm64_peephole_init(&peep, 1u << ARM64_PEEP_LDST_PAIR, NULL, NULL);
+    arm64_peephole_scan(&peep, loop, sizeof(loop), 0x30000, ARM64_ENDIAN_LITTLE);
+    uint64_t without = peep.counts[ARM64_PEEP_LDST_PAIR];
+    arm64_peephole_init(&peep, 1u << ARM64_PEEP_LDST_PAIR, NULL, NULL);
+    arm64_peephole_set_leaders(&peep, loop_leaders, 1);
+    arm64_peephole_scan(&peep, loop, sizeof(loop), 0x30000, ARM64_ENDIAN_LITTLE);
+    printf("跨标号: 无块首 ldst-pair=%llu, 有块首 ldst-pair=%llu\n",
+           (unsigned long long)without, (unsigned long long)peep.counts[ARM64_PEEP_LDST_PAIR]);
+}
+
+static void test_extensions(void) {
+    printf("\n========== 测试扩展标记与目标配置 ==========\n\n");
+    
+    static const struct {
+        uint32_t raw;
+        const char *text;
+    } words[] = {
+        { 0x8B020020, "add x0, x1, x2" },
+        { 0xF8E00041, "ldaddal x0, x1, [x2]" },
+        { 0xC8E0FC41, "casal x0, x1, [x2]" },
+        { 0xF8BFC0E6, "ldapr x6, [x7]" },
+        { 0x4E829420, "sdot v0.4s, v1.16b, v2.16b" },
+        { 0x1EE22820, "fadd h0, h1, h2" },
+        { 0x1E604020, "fmov d0, d1" },
+        { 0x04A10000, "sve add z0.s, z0.s, z1.s" },
+        { 0xA540A000, "sve ld1w {z0.s}, p0/z, [x0]" },
+        { 0xD503233F, "paciasp (HINT)" },
+    };
+    for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        disasm_inst_t inst;
+        disassemble_arm64(words[i].raw, 0, &inst);
+        printf("%08x %-30s 编码: %-8s 指令: %s\n", words[i].raw, words[i].text,
+               get_extension_name(get_encoding_extension(words[i].raw)),
+               get_extension_name(get_inst_extension(&inst)));
+    }
+    
+    /* CAS 位于独占加载/存储的编码空间内，须在其之前匹配：检查助记符而不只是扩展 */
+    static const struct {
+        uint32_t raw;
+        const char *mnemonic;
+    } cas[] = {
+        { 0x88A07C41, "cas" },          // cas w0, w1, [x2]
+        { 0x88E07C41, "casa" },         // casa w0, w1, [x2]
+        { 0xC8A0FC41, "casl" },         // casl x0, x1, [x2]
+        { 0xC8E0FC41, "casal" },        // casal x0, x1, [x2]
+        { 0x08A37FE4, "casb" },         // casb w3, w4, [sp]
+        { 0x48E3FCA4, "casalh" },       // casalh w3, w4, [x5]
+        { 0xC8DFFC41, "ldar" },         // ldar x1, [x2]（同一空间，o2=0）
+        { 0x889F7C41, "stllr" },        // stllr w1, [x2]
+    };
+    arm64_target_t v81;
+    arm64_target_parse(&v81, "armv8.1-a");
+    for (size_t i = 0; i < sizeof(cas) / sizeof(cas[0]); i++) {
+        disasm_inst_t inst;
+        char text[128];
+        bool ok = disassemble_arm64_target(&v81, cas[i].raw, 0, &inst);
+        format_instruction(&inst, text, sizeof(text));
+        printf("%08x %-28s %-8s %s\n", cas[i].raw, text,
+               get_extension_name(get_inst_extension(&inst)),
+               ok && strcmp(inst.mnemonic, cas[i].mnemonic) == 0 ? "正确" : "错误");
+    }
+    
+    static const char *specs[] = {
+        "armv8-a", "armv8.1-a", "armv8.1-a+nolse", "armv8-a+nosimd", "armv8.2-a+dotprod+fp16",
+        "armv9-a", "all", "ARMv8.4-A+crypto", "armv8-a+bogus", "armv7-a", "armv8-a+",
+    };
+    printf("\n按目标配置解码（+ 接受，- 不在配置中或解码器不支持）:\n");
+    for (size_t i = 0; i < sizeof(specs) / sizeof(specs[0]); i++) {
+        arm64_target_t target;
+        if (!arm64_target_parse(&target, specs[i])) {
+            printf("%-24s 无效\n", specs[i]);
+            continue;
+        }
+        printf("%-24s", specs[i]);
+        for (size_t j = 0; j < sizeof(words) / sizeof(words[0]); j++) {
+            disasm_inst_t inst;
+            printf(" %c", disassemble_arm64_target(&target, words[j].raw, 0, &inst) ? '+' : '-');
+        }
+        printf("\n");
+    }
+    
+    printf("find_extension(\"lse\")=%d find_extension(\"xyz\")=%s\n",
+           find_extension("lse") == ARM64_EXT_LSE,
+           find_extension("xyz") == ARM64_EXT_COUNT ? "COUNT" : "?");
+}
+
 /**
  * 主测试函数
  */
@@ -523,7 +2239,28 @@ int main(int argc, char *argv[]) {
     test_atomic_instructions();
     test_float_instructions();
     test_detailed_output();
-    
+    test_byte_buffer_input();
+    test_visitor();
+    test_operands();
+    test_inst_props();
+    test_encode();
+    test_relocate();
+    test_validate();
+    test_format_buffer();
+    test_capstone();
+    test_trace();
+    test_alloc();
+    test_timeline();
+    test_ls_forms();
+    test_objdump_listing();
+    test_listing_blocks();
+    test_objdump_golden();
+    test_image_input();
+    test_peephole();
+    test_ldst_pair();
+    test_extensions();
+    test_alloc_coverage();
+
     // 批量反汇编测试
     printf("\n========== 批量反汇编测试 ==========\n\n");
     disassemble_block(test_instructions, count, base_addr);
@@ -0,0 +1,147 @@
+/**
+ * ARM64反汇编器 C++ 接口测试程序
+ * 编译期检查已知编码表，运行期对比 C++ 视图与 C 接口的输出
+ */
+
+#include "arm64_disasm.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+// 已知编码表：编译期逐条检查分类结果
+struct known_encoding {
+    uint32_t raw;
+    inst_type_t type;
+};
+
+static constexpr known_encoding known_encodings[] = {
+    { 0xD65F03C0, INST_TYPE_RET },      // ret
+    { 0x94000000, INST_TYPE_BL },       // bl <label>
+    { 0x54000040, INST_TYPE_BCOND },    // b.eq <label+8>
+    { 0xB4000040, INST_TYPE_CBZ },      // cbz x0, <label+8>
+    { 0x910003FD, INST_TYPE_MOV },      // mov x29, sp
+    { 0xD2800020, INST_TYPE_MOVZ },     // movz x0, #1
+    { 0xEB00003F, INST_TYPE_CMP },      // cmp x1, x0
+    { 0xF9400421, INST_TYPE_LDR },      // ldr x1, [x1, #8]
+    { 0xA9BF7BFD, INST_TYPE_STP },      // stp x29, x30, [sp, #-16]!
+    { 0xD503201F, INST_TYPE_NOP },      // nop
+};
+
+static constexpr bool check_known_encodings() {
+    for (const known_encoding &e : known_encodings) {
+        if (arm64::classify(e.raw) != e.type) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if ARM64_DISASM_HAS_BRANCH && ARM64_DISASM_HAS_DATA_PROC && ARM64_DISASM_HAS_LOAD_STORE && \
+    ARM64_DISASM_HAS_SYSTEM
+static_assert(check_known_encodings(), "fast classification disagrees with known encodings");
+static_assert(arm64::decode<arm64::fields::type>(0xD65F03C0).type() == INST_TYPE_RET);
+static_assert(*arm64::branch_offset(0x17FFFFFF) == -4);                 // b <label-4>
+static_assert(*arm64::decode<arm64::fields::branch>(0x94000010, 0x1000).branch_target() == 0x1040);
+static_assert(!arm64::branch_offset(0xD65F03C0));                       // ret：间接分支
+
+// 编译期遍历代码缓冲区：统计直接分支
+static constexpr uint32_t constexpr_code[] = { 0xA9BF7BFD, 0x94000010, 0xB4000040, 0xD65F03C0 };
+
+static constexpr size_t count_direct_branches() {
+    size_t n = 0;
+    for (const auto &inst : arm64::code_view<arm64::fields::branch>(constexpr_code, 0)) {
+        n += inst.branch_target().has_value();
+    }
+    return n;
+}
+static_assert(count_direct_branches() == 2);
+#endif
+
+// 只需要类型时不含完整解码结构
+static_assert(sizeof(arm64::instruction<arm64::fields::type>) < sizeof(disasm_inst_t));
+static_assert(std::ranges::input_range<arm64::code_view<arm64::fields::text>>);
+
+static const uint32_t test_code[] = {
+    0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+    0x910003FD,  // mov x29, sp
+    0xF9400421,  // ldr x1, [x1, #8]
+    0x94000004,  // bl <label+16>
+    0x1E622820,  // fadd d0, d1, d2
+    0xA8C17BFD,  // ldp x29, x30, [sp], #16
+    0xD65F03C0,  // ret
+    0xFFFFFFFF,  // 未分配编码
+};
+
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+    if (!ok) {
+        printf("  失败: %s\n", what);
+        failures++;
+    }
+}
+
+// 文本视图的输出与 C 接口逐条一致
+static void test_text_view() {
+    printf("\n=== C++ 视图：文本 ===\n");
+    for (const auto &inst : arm64::code_view<arm64::fields::text>(test_code, 0x400000)) {
+        disasm_inst_t c_inst;
+        char c_text[128];
+        disassemble_arm64(inst.raw(), inst.address(), &c_inst);
+        format_instruction(&c_inst, c_text, sizeof(c_text));
+
+        printf("  0x%llx: %08x  %s\n", (unsigned long long)inst.address(), inst.raw(), inst.text());
+        expect(strcmp(inst.text(), c_text) == 0, "text matches format_instruction");
+        expect(inst.type() == c_inst.type, "type matches disassemble_arm64");
+    }
+}
+
+// 只取类型和分支目标：运行期分类与完整解码一致
+static void test_branch_view() {
+    printf("\n=== C++ 视图：类型和分支目标 ===\n");
+    constexpr auto wanted = arm64::fields::type | arm64::fields::branch;
+    for (const auto &inst : arm64::code_view<wanted>(test_code, 0x400000)) {
+        disasm_inst_t c_inst;
+        bool ok = disassemble_arm64(inst.raw(), inst.address(), &c_inst);
+        expect(inst.type() == (ok ? c_inst.type : INST_TYPE_UNKNOWN), "classify matches decoder");
+
+        uint64_t target;
+        bool c_direct = ok && c_inst.type != INST_TYPE_BR && c_inst.type != INST_TYPE_BLR &&
+                        c_inst.type != INST_TYPE_RET && get_branch_target(&c_inst, &target);
+        if (auto t = inst.branch_target()) {
+            printf("  0x%llx: 分支目标 0x%llx\n",
+                   (unsigned long long)inst.address(), (unsigned long long)*t);
+            expect(c_direct && *t == target, "branch target matches get_branch_target");
+        } else {
+            expect(!c_direct, "no branch target for non-branch");
+        }
+    }
+}
+
+// 字节缓冲区（大端）和 C 接口互通
+static void test_byte_view() {
+    printf("\n=== C++ 视图：大端字节缓冲区 ===\n");
+    const uint8_t be_bytes[] = { 0xD6, 0x5F, 0x03, 0xC0, 0xD5, 0x03, 0x20, 0x1F, 0x00 };
+    arm64::code_view<> view(std::span<const uint8_t>(be_bytes), 0x1000, ARM64_ENDIAN_BIG);
+    expect(view.size() == 2, "trailing partial word ignored");
+
+    size_t n = 0;
+    for (const auto &inst : view) {
+        const disasm_inst_t &c_inst = inst.c_inst();
+        char text[64];
+        format_instruction(&c_inst, text, sizeof(text));
+        printf("  0x%llx: %s\n", (unsigned long long)c_inst.address, text);
+        n++;
+    }
+    expect(n == 2, "two instructions decoded");
+    expect(arm64::decode(0xD65F03C0).c_inst().type == INST_TYPE_RET, "decode() full result");
+}
+
+int main() {
+    printf("ARM64反汇编器 C++ 接口测试\n");
+    test_text_view();
+    test_branch_view();
+    test_byte_view();
+    printf("\n%s\n", failures == 0 ? "全部通过" : "存在失败");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+ARM64反汇编器 Python 扩展测试程序
+用法：PYTHONPATH=outputs python3 test_disasm_python.py
+没有安装 numpy 时只检查 memoryview 路径
+"""
+
+import mmap
+import struct
+import sys
+import tempfile
+
+import arm64_disasm
+
+TEST_CODE = [
+    0xA9BF7BFD,  # stp x29, x30, [sp, #-16]!
+    0x910003FD,  # mov x29, sp
+    0xF9400421,  # ldr x1, [x1, #8]
+    0x94000004,  # bl <label+16>
+    0x1E622820,  # fadd d0, d1, d2
+    0xFFFFFFFF,  # 未分配编码
+    0xD65F03C0,  # ret
+]
+
+RECORD = struct.Struct("=QQqIIHBBBBBB")
+
+failures = 0
+
+
+def expect(ok, what):
+    global failures
+    if not ok:
+        print("  失败:", what)
+        failures += 1
+
+
+def unpack(records):
+    """不依赖 numpy：按 record_t 布局逐条解包"""
+    raw = memoryview(records).cast("B")
+    return [RECORD.unpack_from(raw, i * RECORD.size) for i in range(len(records))]
+
+
+def test_records():
+    print("\n=== 记录数组 ===")
+    code = struct.pack("<%dI" % len(TEST_CODE), *TEST_CODE) + b"\x00\x00"
+    records = arm64_disasm.decode(code, address=0x400000)
+    expect(len(records) == len(TEST_CODE), "trailing partial word ignored")
+    expect(records.decoded == len(TEST_CODE) - 1, "one undecodable word")
+    expect(memoryview(records).itemsize == arm64_disasm.RECORD_SIZE == RECORD.size,
+           "record size")
+
+    for address, target, imm, props, raw, type_, rd, rn, rm, cond, flags, nops in unpack(records):
+        text = arm64_disasm.format(raw, address)
+        print("  0x%x: %08x  %-28s %s" % (address, raw, text, arm64_disasm.TYPE_NAMES[type_]))
+        expect((text is not None) == bool(flags & arm64_disasm.FLAG_VALID), "valid flag")
+        if raw == 0x94000004:
+            expect(type_ == arm64_disasm.TYPE_BL, "bl type")
+            expect(flags & arm64_disasm.FLAG_HAS_TARGET and target == address + 16, "bl target")
+            expect(props & arm64_disasm.PROP_CALL, "bl props")
+
+
+def test_big_endian_and_out():
+    print("\n=== 大端输入 / 预分配输出 ===")
+    code = struct.pack(">%dI" % len(TEST_CODE), *TEST_CODE)
+    out = bytearray(len(TEST_CODE) * arm64_disasm.RECORD_SIZE)
+    n = arm64_disasm.decode(code, address=0x400000, endian="big", out=out)
+    little = arm64_disasm.decode(struct.pack("<%dI" % len(TEST_CODE), *TEST_CODE), 0x400000)
+    print("  解码 %d 条" % n)
+    expect(n == len(TEST_CODE) - 1, "big-endian decode count")
+    expect(bytes(out) == memoryview(little).tobytes(), "out matches Records")
+
+    try:
+        arm64_disasm.decode(code, out=bytearray(8))
+        expect(False, "short out rejected")
+    except ValueError:
+        pass
+
+
+def test_mmap_threads():
+    print("\n=== mmap 输入 / 多线程 ===")
+    words = TEST_CODE * 50000
+    with tempfile.TemporaryFile() as f:
+        f.write(struct.pack("<%dI" % len(words), *words))
+        f.flush()
+        with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mm:
+            single = arm64_disasm.decode(mm, address=0x10000)
+            multi = arm64_disasm.decode(mm, address=0x10000, threads=4)
+            print("  %d 条, 单线程 %d 条已解码, 4 线程 %d 条已解码"
+                  % (len(single), single.decoded, multi.decoded))
+            expect(memoryview(single).tobytes() == memoryview(multi).tobytes(),
+                   "threaded result matches")
+            del single, multi
+
+
+def test_timeline():
+    print("\n=== 阶段时间线 ===")
+    import json
+    import os
+    words = TEST_CODE * (65536 * 4 // len(TEST_CODE) + 1)
+    data = struct.pack("<%dI" % len(words), *words)
+    arm64_disasm.timeline_start()
+    arm64_disasm.decode(data, address=0x10000, threads=4)
+    recorded, dropped = arm64_disasm.timeline_stop()
+    fd, path = tempfile.mkstemp(suffix=".json")
+    os.close(fd)
+    try:
+        written = arm64_disasm.timeline_export(path)
+        with open(path) as f:
+            trace = json.load(f)
+    finally:
+        os.unlink(path)
+    events = [e for e in trace["traceEvents"] if e["name"] == "decode"]
+    begins = [e for e in events if e["ph"] == "B"]
+    ends = [e for e in events if e["ph"] == "E"]
+    insts = sum(e["args"]["insts"] for e in ends)
+    print("  记录 %d 个事件, 丢弃 %d, 解码分段 %d, 线程 %d, 指令 %d"
+          % (recorded, dropped, len(ends), len({e["tid"] for e in ends}), insts))
+    expect(written == recorded and dropped == 0, "all events exported")
+    expect(len(begins) == len(ends) and len(ends) >= 1, "paired decode events")
+    expect(insts == len(words), "decode events cover every instruction")
+    expect(any(int(e["args"]["start"], 16) == 0x10000 for e in ends), "segment range")
+    expect(trace["otherData"]["dropped_events"] == 0, "dropped count in otherData")
+
+
+def test_numpy():
+    try:
+        import numpy as np
+    except ImportError:
+        print("\n=== numpy：未安装，跳过 ===")
+        return
+    print("\n=== numpy ===")
+    code = np.array(TEST_CODE, dtype="<u4")
+    rec = np.asarray(arm64_disasm.decode(code, address=0x400000))
+    expect(rec.dtype == np.dtype(arm64_disasm.DTYPE), "dtype from PEP 3118 format")
+    branches = rec[(rec["props"] & arm64_disasm.PROP_BRANCH) != 0]
+    print("  分支: %s" % [arm64_disasm.TYPE_NAMES[t] for t in branches["type"]])
+    expect(list(branches["type"]) == [arm64_disasm.TYPE_BL, arm64_disasm.TYPE_RET], "branches")
+
+
+def main():
+    print("ARM64反汇编器 Python 扩展测试")
+    test_records()
+    test_big_endian_and_out()
+    test_mmap_threads()
+    test_timeline()
+    test_numpy()
+    print("\n%s" % ("全部通过" if failures == 0 else "存在失败"))
+    return 0 if failures == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
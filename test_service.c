@@ -0,0 +1,472 @@
+/**
+ * ARM64反汇编服务测试程序
+ * 在本进程的线程中运行服务端，通过套接字发送请求并与直接解码的结果比较
+ */
+
+#define _GNU_SOURCE
+#include "arm64_service.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/fsuid.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+static const uint32_t image_code[] = {
+    0xA9BF7BFD,  // stp x29, x30, [sp, #-16]!
+    0x910003FD,  // mov x29, sp
+    0xF9400421,  // ldr x1, [x1, #8]
+    0x94000004,  // bl <label+16>
+    0x1E622820,  // fadd d0, d1, d2
+    0xFFFFFFFF,  // 未分配编码
+    0xA8C17BFD,  // ldp x29, x30, [sp], #16
+    0xD65F03C0,  // ret
+};
+
+#define IMAGE_WORDS (sizeof(image_code) / sizeof(image_code[0]))
+
+static char dir[] = "/tmp/arm64_svc_testXXXXXX";
+static char socket_path[128];
+static int failures = 0;
+
+static void expect(bool ok, const char *what) {
+    if (!ok) {
+        printf("  失败: %s\n", what);
+        failures++;
+    }
+}
+
+/* 写一个映像文件：image_code 重复 repeat 次，salt 非零时改写最后一条指令 */
+static void write_image(const char *path, size_t repeat, uint32_t salt) {
+    FILE *f = fopen(path, "wb");
+    for (size_t i = 0; i < repeat; i++) {
+        fwrite(image_code, sizeof(image_code), 1, f);
+    }
+    if (salt) {
+        fseek(f, -4, SEEK_END);
+        fwrite(&salt, 4, 1, f);
+    }
+    fclose(f);
+}
+
+static void *server_thread(void *arg) {
+    arm64_svc_server_run((arm64_svc_server_t *)arg);
+    return NULL;
+}
+
+static arm64_svc_server_t *start_server(size_t budget, unsigned max_clients, pthread_t *tid) {
+    arm64_svc_config_t config;
+    arm64_svc_config_init(&config);
+    config.socket_path = socket_path;
+    config.cache_budget = budget;
+    config.max_clients = max_clients;
+    arm64_svc_server_t *s = arm64_svc_server_create(&config);
+    if (s) {
+        pthread_create(tid, NULL, server_thread, s);
+    }
+    return s;
+}
+
+static void stop_server(arm64_svc_server_t *s, pthread_t tid) {
+    arm64_svc_server_stop(s);
+    pthread_join(tid, NULL);
+    arm64_svc_server_destroy(s);
+}
+
+/**
+ * 测试解码结果与缓存命中
+ */
+static void test_decode(const char *image) {
+    printf("\n========== 解码请求 ==========\n\n");
+    int fd = arm64_svc_connect(socket_path);
+    expect(fd >= 0, "connect");
+
+    /* 完整解码结构：与本地解码逐字节一致 */
+    arm64_svc_request_t req;
+    arm64_svc_result_t result;
+    arm64_svc_request_init(&req, image, ARM64_SVC_KIND_INST);
+    req.offset = 8;
+    req.length = 16;
+    req.address = 0x400008;
+    arm64_svc_status_t status = arm64_svc_decode(fd, &req, &result);
+    printf("INST 偏移8 长度16: %s, %zu 条, 命中 %d\n",
+           arm64_svc_status_name(status), result.count, result.cache_hit);
+    expect(status == ARM64_SVC_OK && result.count == 4 && !result.cache_hit, "inst range");
+    for (size_t i = 0; status == ARM64_SVC_OK && i < result.count; i++) {
+        disasm_inst_t local;
+        disassemble_arm64(image_code[2 + i], 0x400008 + i * 4, &local);
+        const disasm_inst_t *remote = (const disasm_inst_t *)result.data + i;
+        expect(memcmp(&local, remote, sizeof(local)) == 0, "inst matches local decode");
+    }
+    arm64_svc_release(&result);
+
+    /* 同一映像再次请求：命中 */
+    req.offset = 0;
+    req.length = 0;
+    req.address = 0x400000;
+    status = arm64_svc_decode(fd, &req, &result);
+    printf("INST 整个映像: %s, %zu 条, 命中 %d\n",
+           arm64_svc_status_name(status), result.count, result.cache_hit);
+    expect(result.cache_hit, "second request hits");
+    arm64_svc_release(&result);
+
+    /* 文本 */
+    arm64_svc_request_init(&req, image, ARM64_SVC_KIND_TEXT);
+    req.address = 0x1000;
+    status = arm64_svc_decode(fd, &req, &result);
+    for (size_t i = 0; status == ARM64_SVC_OK && i < IMAGE_WORDS; i++) {
+        disasm_inst_t inst;
+        char text[ARM64_SVC_TEXT_WIDTH];
+        const char *line = (const char *)result.data + i * ARM64_SVC_TEXT_WIDTH;
+        disassemble_arm64(image_code[i], 0x1000 + i * 4, &inst);
+        format_instruction(&inst, text, sizeof(text));
+        printf("  0x%llx: %s\n", (unsigned long long)(0x1000 + i * 4), line);
+        expect(strcmp(text, line) == 0, "text matches format_instruction");
+    }
+    arm64_svc_release(&result);
+
+    /* 内容相同的另一个文件：按内容哈希命中 */
+    char copy[256];
+    snprintf(copy, sizeof(copy), "%s/copy.bin", dir);
+    write_image(copy, 4, 0);
+    arm64_svc_request_init(&req, copy, ARM64_SVC_KIND_TEXT);
+    req.address = 0x1000;
+    status = arm64_svc_decode(fd, &req, &result);
+    printf("内容相同的副本: 命中 %d\n", result.cache_hit);
+    expect(status == ARM64_SVC_OK && result.cache_hit, "copy hits by content hash");
+    arm64_svc_release(&result);
+
+    /* 错误 */
+    arm64_svc_request_init(&req, image, ARM64_SVC_KIND_INST);
+    req.offset = 2;
+    printf("未对齐偏移: %s\n", arm64_svc_status_name(arm64_svc_decode(fd, &req, &result)));
+    req.offset = 1 << 20;
+    printf("超出映像: %s\n", arm64_svc_status_name(arm64_svc_decode(fd, &req, &result)));
+    arm64_svc_request_init(&req, "/nonexistent/image.bin", ARM64_SVC_KIND_INST);
+    printf("不存在的文件: %s\n", arm64_svc_status_name(arm64_svc_decode(fd, &req, &result)));
+    close(fd);
+}
+
+/* 并发请求同一个未缓存的映像 */
+typedef struct {
+    const char *image;
+    arm64_svc_status_t status;
+} concurrent_arg_t;
+
+static void *concurrent_client(void *arg) {
+    concurrent_arg_t *a = (concurrent_arg_t *)arg;
+    int fd = arm64_svc_connect(socket_path);
+    arm64_svc_request_t req;
+    arm64_svc_result_t result;
+    arm64_svc_request_init(&req, a->image, ARM64_SVC_KIND_INST);
+    a->status = arm64_svc_decode(fd, &req, &result);
+    arm64_svc_release(&result);
+    close(fd);
+    return NULL;
+}
+
+static void test_concurrent(arm64_svc_server_t *s) {
+    printf("\n========== 并发请求 ==========\n\n");
+    char image[256];
+    snprintf(image, sizeof(image), "%s/big.bin", dir);
+    write_image(image, 20000, 0xD503201F);
+
+    arm64_svc_stats_t before, after;
+    arm64_svc_server_stats(s, &before);
+
+    pthread_t tids[8];
+    concurrent_arg_t args[8];
+    for (int i = 0; i < 8; i++) {
+        args[i].image = image;
+        pthread_create(&tids[i], NULL, concurrent_client, &args[i]);
+    }
+    bool all_ok = true;
+    for (int i = 0; i < 8; i++) {
+        pthread_join(tids[i], NULL);
+        all_ok &= args[i].status == ARM64_SVC_OK;
+    }
+    arm64_svc_server_stats(s, &after);
+    printf("8 个客户端: 全部成功 %d, 解码指令 %llu（映像 %u 条）\n", all_ok,
+           (unsigned long long)(after.instructions_decoded - before.instructions_decoded),
+           20000 * (unsigned)IMAGE_WORDS);
+    expect(all_ok && after.instructions_decoded - before.instructions_decoded ==
+           20000 * IMAGE_WORDS, "decoded once");
+}
+
+/**
+ * 大映像中的一小段只解码它所在的块
+ */
+static void test_lazy(arm64_svc_server_t *s) {
+    printf("\n========== 按块解码 ==========\n\n");
+    char image[256];
+    snprintf(image, sizeof(image), "%s/large.bin", dir);
+    write_image(image, 1 << 14, 0);
+
+    arm64_svc_stats_t before, mid, after;
+    arm64_svc_server_stats(s, &before);
+
+    int fd = arm64_svc_connect(socket_path);
+    arm64_svc_request_t req;
+    arm64_svc_result_t result;
+    arm64_svc_request_init(&req, image, ARM64_SVC_KIND_INST);
+    req.offset = 0x40004;
+    req.length = 4;
+    req.address = 0x440004;
+    arm64_svc_status_t status = arm64_svc_decode(fd, &req, &result);
+    bool ok = status == ARM64_SVC_OK && result.count == 1 && !result.cache_hit &&
+              ((const disasm_inst_t *)result.data)[0].address == 0x440004 &&
+              ((const disasm_inst_t *)result.data)[0].type == INST_TYPE_MOV;
+    arm64_svc_release(&result);
+    arm64_svc_server_stats(s, &mid);
+
+    /* 同一块中的另一段命中缓存 */
+    req.offset = 0x40100;
+    req.length = 0x100;
+    req.address = 0x440100;
+    status = arm64_svc_decode(fd, &req, &result);
+    bool hit = result.cache_hit;
+    ok &= status == ARM64_SVC_OK && result.count == 64 && hit;
+    arm64_svc_release(&result);
+    arm64_svc_server_stats(s, &after);
+    close(fd);
+
+    uint64_t decoded = mid.instructions_decoded - before.instructions_decoded;
+    uint64_t bytes = mid.cached_bytes - before.cached_bytes;
+    printf("映像 %u 条, 请求1条: 解码 %llu 条, 缓存增加 %llu 字节; 同块再请求: 命中 %d, 解码 %llu 条\n",
+           (1u << 14) * (unsigned)IMAGE_WORDS, (unsigned long long)decoded,
+           (unsigned long long)bytes, hit,
+           (unsigned long long)(after.instructions_decoded - mid.instructions_decoded));
+    expect(ok && decoded == 1024 && bytes == 1024 * sizeof(disasm_inst_t) &&
+           after.instructions_decoded == mid.instructions_decoded, "lazy chunk decode");
+}
+
+/**
+ * 直接发送 DECODE 请求：image_fd 非负时附带该描述符，不经过 arm64_svc_decode 打开文件
+ */
+static arm64_svc_status_t raw_decode(int fd, const char *path, int image_fd) {
+    arm64_svc_request_t req;
+    arm64_svc_response_t resp;
+    char control[CMSG_SPACE(sizeof(int))];
+    struct iovec iov = { &req, sizeof(req) };
+    struct msghdr msg;
+
+    arm64_svc_request_init(&req, path, ARM64_SVC_KIND_INST);
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    if (image_fd >= 0) {
+        memset(control, 0, sizeof(control));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+        c->cmsg_level = SOL_SOCKET;
+        c->cmsg_type = SCM_RIGHTS;
+        c->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(c), &image_fd, sizeof(int));
+    }
+    if (sendmsg(fd, &msg, MSG_NOSIGNAL) != (ssize_t)sizeof(req) ||
+        recv(fd, &resp, sizeof(resp), 0) < (ssize_t)sizeof(resp)) {
+        return ARM64_SVC_IO_ERROR;
+    }
+    return (arm64_svc_status_t)resp.status;
+}
+
+/**
+ * 服务端不替客户端读取它无权读取的文件：只按路径请求、O_PATH/只写描述符、其他用户的连接都被拒绝
+ */
+static void test_access(const char *image) {
+    printf("\n========== 访问控制 ==========\n\n");
+
+    struct stat st;
+    memset(&st, 0, sizeof(st));
+    bool private_socket = stat(socket_path, &st) == 0 && S_ISSOCK(st.st_mode) &&
+                          (st.st_mode & 0777) == 0600;
+    printf("套接字权限: %03o\n", (unsigned)(st.st_mode & 0777));
+    expect(private_socket, "socket mode 0600");
+
+    char secret[256];
+    snprintf(secret, sizeof(secret), "%s/secret.bin", dir);
+    write_image(secret, 1, 0);
+    chmod(secret, 0);
+
+    int fd = arm64_svc_connect(socket_path);
+    arm64_svc_status_t status = raw_decode(fd, secret, -1);
+    printf("只有路径、没有描述符: %s\n", arm64_svc_status_name(status));
+    expect(status == ARM64_SVC_BAD_REQUEST, "path without descriptor rejected");
+
+    /* O_PATH 不需要读权限即可打开 */
+    int path_fd = open(secret, O_PATH | O_CLOEXEC);
+    status = raw_decode(fd, secret, path_fd);
+    printf("不可读文件的 O_PATH 描述符: %s\n", arm64_svc_status_name(status));
+    expect(path_fd >= 0 && status == ARM64_SVC_DENIED, "O_PATH descriptor denied");
+    close(path_fd);
+
+    /* 已缓存的映像也不能凭 O_PATH 描述符取得 */
+    int image_path_fd = open(image, O_PATH | O_CLOEXEC);
+    status = raw_decode(fd, image, image_path_fd);
+    printf("已缓存映像的 O_PATH 描述符: %s\n", arm64_svc_status_name(status));
+    expect(image_path_fd >= 0 && status == ARM64_SVC_DENIED, "O_PATH on cached image denied");
+    close(image_path_fd);
+
+    int write_fd = open(image, O_WRONLY | O_CLOEXEC);
+    status = raw_decode(fd, image, write_fd);
+    printf("只写描述符: %s\n", arm64_svc_status_name(status));
+    expect(write_fd >= 0 && status == ARM64_SVC_DENIED, "write-only descriptor denied");
+    close(write_fd);
+    close(fd);
+
+    /* 其他用户：子进程切换到 nobody 后连接；文件系统用户仍为 root 以通过套接字文件的权限检查，
+       守护进程按 SO_PEERCRED 的有效用户拒绝 */
+    if (geteuid() != 0) {
+        printf("其他用户的连接: 跳过（需要 root）\n");
+        return;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (setresuid(65534, 65534, 0) != 0) {
+            _exit(2);
+        }
+        setfsuid(0);
+        int child_fd = arm64_svc_connect(socket_path);
+        arm64_svc_stats_t stats;
+        _exit(child_fd >= 0 && arm64_svc_query_stats(child_fd, &stats) == ARM64_SVC_DENIED ? 0 : 1);
+    }
+    int wstatus = 0;
+    waitpid(pid, &wstatus, 0);
+    bool denied = pid > 0 && WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0;
+    if (WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 2) {
+        printf("其他用户的连接: 跳过（无法切换用户）\n");
+        return;
+    }
+    printf("其他用户的连接: %s\n", denied ? "denied" : "未拒绝");
+    expect(denied, "foreign uid denied");
+}
+
+/**
+ * 套接字路径上已有的普通文件不被删除，服务端创建失败
+ */
+static void test_socket_path(void) {
+    printf("\n========== 套接字路径 ==========\n\n");
+    char path[256];
+    snprintf(path, sizeof(path), "%s/not_a_socket", dir);
+    write_image(path, 1, 0);
+
+    arm64_svc_config_t config;
+    arm64_svc_config_init(&config);
+    config.socket_path = path;
+    arm64_svc_server_t *s = arm64_svc_server_create(&config);
+    struct stat st;
+    bool kept = stat(path, &st) == 0 && S_ISREG(st.st_mode);
+    printf("已有普通文件: 创建%s, 文件%s\n", s ? "成功" : "失败", kept ? "保留" : "被删除");
+    expect(!s && kept, "regular file at socket path kept");
+    arm64_svc_server_destroy(s);
+
+    /* 默认路径在 $XDG_RUNTIME_DIR 或按 uid 区分的目录中，不直接放在 /tmp */
+    const char *def = arm64_svc_default_socket();
+    bool private_dir = strstr(def, "/" ARM64_SVC_SOCKET_NAME) != NULL &&
+                       strcmp(def, "/tmp/" ARM64_SVC_SOCKET_NAME) != 0;
+    printf("默认路径在私有目录中: %d\n", private_dir);
+    expect(private_dir, "default socket path");
+}
+
+/**
+ * 测试内存预算淘汰和连接上限
+ */
+static void test_limits(void) {
+    printf("\n========== 淘汰与连接上限 ==========\n\n");
+
+    /* 每个映像 8 条 INST 记录；预算只容纳两个 */
+    pthread_t tid;
+    arm64_svc_server_t *s = start_server(2 * IMAGE_WORDS * sizeof(disasm_inst_t), 1, &tid);
+    expect(s != NULL, "server create");
+    if (!s) {
+        return;
+    }
+
+    int fd = arm64_svc_connect(socket_path);
+    arm64_svc_result_t first;
+    memset(&first, 0, sizeof(first));
+    for (uint32_t i = 1; i <= 4; i++) {
+        char path[256];
+        arm64_svc_request_t req;
+        arm64_svc_result_t result;
+        snprintf(path, sizeof(path), "%s/img%u.bin", dir, i);
+        write_image(path, 1, 0xD503201F + (i << 5));
+        arm64_svc_request_init(&req, path, ARM64_SVC_KIND_INST);
+        arm64_svc_decode(fd, &req, i == 1 ? &first : &result);
+        if (i != 1) {
+            arm64_svc_release(&result);
+        }
+    }
+
+    arm64_svc_stats_t st;
+    arm64_svc_server_stats(s, &st);
+    printf("4 个映像: 缓存 %llu 条目 %llu 字节, 淘汰 %llu\n",
+           (unsigned long long)st.cached_entries, (unsigned long long)st.cached_bytes,
+           (unsigned long long)st.evictions);
+    expect(st.cached_entries == 2 && st.evictions == 2, "lru eviction");
+    /* 已淘汰条目的映射仍然有效 */
+    expect(first.count == IMAGE_WORDS &&
+           ((const disasm_inst_t *)first.data)[0].type == INST_TYPE_STP, "evicted mapping valid");
+    arm64_svc_release(&first);
+
+    /* 连接上限为1：第二个连接收到 BUSY */
+    int fd2 = arm64_svc_connect(socket_path);
+    arm64_svc_stats_t remote;
+    arm64_svc_status_t status = arm64_svc_query_stats(fd2, &remote);
+    printf("第二个连接: %s\n", arm64_svc_status_name(status));
+    expect(status == ARM64_SVC_BUSY, "busy");
+    close(fd2);
+
+    status = arm64_svc_query_stats(fd, &remote);
+    printf("统计: 请求 %llu, 拒绝 %llu, p50 %llu ns <= p99 %llu ns <= 最大 %llu ns\n",
+           (unsigned long long)remote.requests, (unsigned long long)remote.rejected,
+           (unsigned long long)remote.latency_p50_ns, (unsigned long long)remote.latency_p99_ns,
+           (unsigned long long)remote.latency_max_ns);
+    expect(status == ARM64_SVC_OK && remote.rejected == 1 &&
+           remote.latency_p50_ns <= remote.latency_p99_ns &&
+           remote.latency_p99_ns <= remote.latency_max_ns, "stats");
+    close(fd);
+    stop_server(s, tid);
+}
+
+int main(void) {
+    printf("ARM64反汇编服务测试\n");
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    snprintf(socket_path, sizeof(socket_path), "%s/disasmd.sock", dir);
+
+    char image[256];
+    snprintf(image, sizeof(image), "%s/image.bin", dir);
+    write_image(image, 4, 0);
+
+    pthread_t tid;
+    arm64_svc_server_t *s = start_server(ARM64_SVC_DEFAULT_BUDGET, 16, &tid);
+    expect(s != NULL, "server create");
+    if (s) {
+        test_decode(image);
+        test_concurrent(s);
+        test_lazy(s);
+        test_access(image);
+        stop_server(s, tid);
+    }
+    test_limits();
+    test_socket_path();
+
+    char cmd[300];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", dir);
+    if (system(cmd) != 0) {
+        printf("无法删除 %s\n", dir);
+    }
+
+    printf("\n%s\n", failures == 0 ? "全部通过" : "存在失败");
+    return failures == 0 ? 0 : 1;
+}